@@ -32,23 +32,106 @@
     } while (0)
 
 /* Macro to adjust the next OIDX and max. OIDX pointers after
- * allocating more OIDXs from DAOS.
+ * allocating a block of nalloc more OIDXs from DAOS.
  */
-#define H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx_ptr, max_oidx_ptr)                                        \
+#define H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx_ptr, max_oidx_ptr, nalloc)                                \
     do {                                                                                                     \
         /* Set max oidx */                                                                                   \
-        (*max_oidx_ptr) = (*next_oidx_ptr) + H5_DAOS_OIDX_NALLOC - 1;                                        \
+        (*max_oidx_ptr) = (*next_oidx_ptr) + (nalloc)-1;                                                     \
                                                                                                              \
         /* Skip over reserved indices for the next oidx */                                                   \
-        assert(H5_DAOS_OIDX_NALLOC > H5_DAOS_OIDX_FIRST_USER);                                               \
+        assert((nalloc) > H5_DAOS_OIDX_FIRST_USER);                                                          \
         if ((*next_oidx_ptr) < H5_DAOS_OIDX_FIRST_USER)                                                      \
             (*next_oidx_ptr) = H5_DAOS_OIDX_FIRST_USER;                                                      \
     } while (0)
 
+/* Macro to compute the size of the next block of OIDXs to allocate from
+ * DAOS, given the size of the previous block (0 if none).  The first block
+ * holds at least H5_DAOS_OIDX_NALLOC OIDXs, or the number requested with
+ * H5daos_set_oidx_prealloc(), and each block after that doubles until
+ * H5_DAOS_OIDX_NALLOC_MAX is reached.
+ */
+#define H5_DAOS_NEXT_OIDX_NALLOC(file, nalloc)                                                               \
+    ((nalloc) == 0                               ? MAX(H5_DAOS_OIDX_NALLOC, (file)->fapl_cache.oidx_prealloc) \
+     : ((nalloc) >= H5_DAOS_OIDX_NALLOC_MAX / 2) ? MAX((nalloc), H5_DAOS_OIDX_NALLOC_MAX)                     \
+                                                 : 2 * (nalloc))
+
+/* Name of the optional operation registered for H5_daos_public_call() */
+#define H5_DAOS_PUBLIC_CALL_OP_NAME H5_DAOS_CONNECTOR_NAME ".public_call"
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
 
+/* What to do when an in-flight MPI operation finishes */
+typedef enum H5_daos_mpi_stage_t {
+    H5_DAOS_MPI_STAGE_DONE,       /* Complete the task */
+    H5_DAOS_MPI_STAGE_INTER_NODE, /* Start the broadcast within this node */
+    H5_DAOS_MPI_STAGE_NODE_READ,  /* Read the broadcast data from the node's shared memory */
+    H5_DAOS_MPI_STAGE_FRAME,      /* Handle the first part of a coalesced broadcast frame */
+    H5_DAOS_MPI_STAGE_FRAME_REST  /* Handle a coalesced broadcast frame after receiving its rest */
+} H5_daos_mpi_stage_t;
+
+/* Information about an in-flight MPI operation.  bcast_ud is set for
+ * broadcasts made by H5_daos_mpi_ibcast_task(), and prefetch_copy is set if
+ * the data is received into the lane's broadcast prefetch buffer and must be
+ * copied to bcast_ud's buffer.  stream is set instead of task for the
+ * receipt of a coalesced broadcast frame. */
+typedef struct H5_daos_mpi_req_info_t {
+    tse_task_t              *task;
+    H5_daos_mpi_ibcast_ud_t *bcast_ud;
+    hbool_t                  prefetch_copy;
+    H5_daos_mpi_stage_t      stage;
+    uint8_t                 *shm_slot;
+    H5_daos_bcast_stream_t  *stream;
+} H5_daos_mpi_req_info_t;
+
+/* Table of in-flight MPI operations and the DAOS tasks to complete when
+ * each one finishes.  Operations from collective requests on different files
+ * or in different collective lanes of a file (and from the node-local
+ * broadcast stages of a single broadcast) may be in the table at once;
+ * collective requests in the same lane are serialized before they get here
+ * (see H5_daos_coll_lane_t). */
+typedef struct H5_daos_mpi_req_table_t {
+    H5_daos_mpi_req_info_t *infos;
+    MPI_Request            *reqs;
+    int                    *indices;
+    int                     nreqs;
+    int                     nalloc;
+} H5_daos_mpi_req_table_t;
+
+/* In-flight budget for one priority class of DAOS tasks, with the gate tasks
+ * holding back the tasks of that class that are over budget, oldest first.
+ * The queued gates are gates[head] through gates[head + ngates - 1].  A
+ * budget of 0 means the class is not limited. */
+typedef struct H5_daos_io_budget_t {
+    size_t       budget;
+    size_t       nin_flight;
+    tse_task_t **gates;
+    size_t       head;
+    size_t       ngates;
+    size_t       nalloc;
+} H5_daos_io_budget_t;
+
+/* State of the optional background progress thread.  The mutex and
+ * condition variable are used to wake the thread when an application thread
+ * leaves the connector, which may have left operations in flight, and when
+ * the thread is being stopped. */
+typedef struct H5_daos_progress_thread_t {
+    pthread_t       thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    hbool_t         work;
+    hbool_t         stop;
+} H5_daos_progress_thread_t;
+
+/* Arguments passed through H5VLoptional() by H5_daos_public_call() */
+typedef struct H5_daos_public_call_t {
+    H5_daos_public_op_t op;
+    void               *op_args;
+    herr_t              op_ret;
+} H5_daos_public_call_t;
+
 /* Task user data for pool connect */
 typedef struct H5_daos_pool_connect_ud_t {
     H5_daos_req_t    *req;
@@ -72,12 +155,20 @@ typedef struct H5_daos_obj_open_ud_t {
     daos_obj_id_t          *oid;
 } H5_daos_obj_open_ud_t;
 
+/* Task user data for a batched collective error check */
+typedef struct H5_daos_coll_err_batch_ud_t {
+    H5_daos_req_t **reqs;
+    int            *status;
+    int             nreqs;
+} H5_daos_coll_err_batch_ud_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
 
 static herr_t H5_daos_set_prop(hid_t fcpl_id, const char *prop_str);
 static herr_t H5_daos_set_object_class(hid_t plist_id, char *object_class);
+static herr_t H5_daos_get_alloc_stats_op(void *_stats);
 static herr_t H5_daos_str_prop_delete(hid_t prop_id, const char *name, size_t size, void *_value);
 static herr_t H5_daos_str_prop_copy(const char *name, size_t size, void *_value);
 static int    H5_daos_str_prop_compare(const void *_value1, const void *_value2, size_t size);
@@ -86,6 +177,11 @@ static int    H5_daos_bool_prop_compare(const void *_value1, const void *_value2
 static herr_t H5_daos_init(hid_t vipl_id);
 static herr_t H5_daos_term(void);
 static herr_t H5_daos_fill_def_plist_cache(void);
+static herr_t H5_daos_progress_thread_start(void);
+static void   H5_daos_progress_thread_stop(void);
+#ifdef H5_HAVE_THREADSAFE
+static void *H5_daos_progress_thread_func(void *arg);
+#endif
 static void  *H5_daos_faccess_info_copy(const void *_old_fa);
 static herr_t H5_daos_faccess_info_free(void *_fa);
 static herr_t H5_daos_get_conn_cls(void *item, H5VL_get_conn_lvl_t lvl, const H5VL_class_t **conn_cls);
@@ -100,8 +196,9 @@ static herr_t H5_daos_opt_query(void *item, H5VL_subclass_t cls, int opt_type,
                                 H5_DAOS_OPT_QUERY_OUT_TYPE *supported);
 static herr_t H5_daos_optional(void *item, H5VL_optional_args_t *opt_args, hid_t dxpl_id, void **req);
 
-static herr_t H5_daos_oidx_bcast(H5_daos_file_t *file, uint64_t *oidx_out, H5_daos_req_t *req,
-                                 tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t H5_daos_oidx_bcast(H5_daos_file_t *file, H5_daos_coll_lane_t *lane, uint64_t *oidx_out,
+                                 uint64_t nalloc, H5_daos_req_t *req, tse_task_t **first_task,
+                                 tse_task_t **dep_task);
 static int    H5_daos_oidx_bcast_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_oidx_bcast_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_oidx_generate_prep_cb(tse_task_t *task, void *args);
@@ -115,10 +212,37 @@ static int    H5_daos_pool_connect_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_pool_disconnect_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_pool_disconnect_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_task_wait_task(tse_task_t *task);
+static herr_t H5_daos_mpi_req_table_reserve(void);
+static void   H5_daos_mpi_req_table_add(tse_task_t *task, H5_daos_mpi_ibcast_ud_t *bcast_ud,
+                                        hbool_t prefetch_copy, H5_daos_mpi_stage_t stage, uint8_t *shm_slot);
+static herr_t H5_daos_mpi_req_table_progress(void);
+static herr_t H5_daos_mpi_node_bcast(tse_task_t *task, H5_daos_mpi_ibcast_ud_t *bcast_ud,
+                                     hbool_t prefetch_copy);
+static herr_t H5_daos_node_bcast_init(H5_daos_file_t *file, H5_daos_coll_lane_t *lane);
+static herr_t H5_daos_node_bcast_free(H5_daos_coll_lane_t *lane);
+static herr_t H5_daos_bcast_stream_add(tse_task_t *task, H5_daos_mpi_ibcast_ud_t *bcast_ud, void *buffer,
+                                       int count);
+static herr_t H5_daos_bcast_stream_deliver(tse_task_t *task, H5_daos_mpi_ibcast_ud_t *bcast_ud,
+                                           hbool_t prefetch_copy, int count, const uint8_t *data,
+                                           int data_count);
+static herr_t H5_daos_bcast_stream_post(H5_daos_bcast_stream_t *stream);
+static herr_t H5_daos_bcast_stream_recv(H5_daos_bcast_stream_t *stream, hbool_t rest);
+static void   H5_daos_bcast_stream_fail(H5_daos_bcast_stream_t *stream);
+static herr_t H5_daos_bcast_stream_flush(H5_daos_bcast_stream_t *stream);
+static herr_t H5_daos_bcast_stream_flush_queued(void);
+static herr_t H5_daos_bcast_stream_reap(H5_daos_bcast_stream_t *stream, hbool_t wait);
+static herr_t H5_daos_bcast_stream_free(H5_daos_bcast_stream_t *stream);
+static void   H5_daos_req_coll_tail_clear(H5_daos_req_t *req);
 
 static int H5_daos_collective_error_check_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_collective_error_check_comp_cb(tse_task_t *task, void *args);
 
+static hbool_t H5_daos_coll_err_batch_add(H5_daos_req_t *req);
+static int     H5_daos_coll_err_batch_task(tse_task_t *task);
+static int     H5_daos_coll_err_batch_comp_cb(tse_task_t *task, void *args);
+static int     H5_daos_coll_err_batch_resolve(H5_daos_req_t *req, int err);
+static int     H5_daos_coll_err_batch_cmp(const void *req1, const void *req2);
+
 #if H5VL_VERSION >= 3
 
 #define H5VL_DAOS_CAP_FLAGS                                                                                  \
@@ -309,17 +433,44 @@ H5_daos_plist_cache_t *H5_daos_plist_cache_g;
 /* Global DAOS task list */
 H5_daos_task_list_t *H5_daos_task_list_g = NULL;
 
-/* DAOS task and MPI request for current in-flight MPI operation */
-tse_task_t *H5_daos_mpi_task_g = NULL;
-MPI_Request H5_daos_mpi_req_g;
+/* In-flight MPI operations */
+static H5_daos_mpi_req_table_t H5_daos_mpi_req_table_g = {NULL, NULL, NULL, 0, 0};
+
+/* Coalesced broadcast streams with data queued to be sent in the next
+ * progress tick */
+static H5_daos_bcast_stream_t *H5_daos_bcast_stream_queue_g = NULL;
 
-/* Last collective request scheduled.  Only one collective operation can be in
- * flight at any one time. */
+/* In-flight budgets for each priority class of DAOS tasks */
+static H5_daos_io_budget_t H5_daos_io_budget_g[H5_DAOS_IO_CLASS_NCLASSES] = {
+    {0, 0, NULL, 0, 0, 0},
+    {H5_DAOS_SMALL_IO_BUDGET_DEF, 0, NULL, 0, 0, 0},
+    {H5_DAOS_BULK_IO_BUDGET_DEF, 0, NULL, 0, 0, 0}};
+
+/* Background progress thread, if enabled with HDF5_DAOS_PROGRESS_THREAD */
+static H5_daos_progress_thread_t H5_daos_progress_thread_g = {0};
+
+/* Optional operation used by H5_daos_public_call() to enter the connector
+ * through HDF5 while the progress thread is running */
+static int H5_daos_public_call_op_g = -1;
+
+/* Whether the background progress thread is running, and the mutex held by
+ * the application while inside a top-level connector callback.  The
+ * progress thread only makes progress while it holds this mutex.  See
+ * H5_daos_inc_api_cnt(). */
+hbool_t         H5_daos_progress_thread_on_g = FALSE;
+pthread_mutex_t H5_daos_api_mutex_g          = PTHREAD_MUTEX_INITIALIZER;
+
+/* Last collective request scheduled that is not tied to a file.  Only one
+ * such collective operation can be in flight at any one time. */
 struct H5_daos_req_t *H5_daos_collective_req_tail = NULL;
 
 /* Counter to keep track of the level of recursion with
- * regards to top-level connector callback routines. */
-int H5_daos_api_count = 0;
+ * regards to top-level connector callback routines on
+ * this thread. */
+__thread int H5_daos_api_count = 0;
+
+/* Whether this thread holds H5_daos_api_mutex_g */
+__thread hbool_t H5_daos_api_locked = FALSE;
 
 /* Constant Keys */
 const char H5_daos_int_md_key_g[]          = "/Internal Metadata";
@@ -330,14 +481,24 @@ const char H5_daos_link_key_g[]            = "Link";
 const char H5_daos_link_corder_key_g[]     = "/Link Creation Order";
 const char H5_daos_nlinks_key_g[]          = "Num Links";
 const char H5_daos_max_link_corder_key_g[] = "Max Link Creation Order";
+const char H5_daos_link_corder_holes_key_g[]  = "Link Creation Order Holes";
+const char H5_daos_nlink_corder_holes_key_g[] = "Num Link Creation Order Holes";
+const char H5_daos_link_corder_fmt_key_g[]    = "Link Creation Order Index Format";
 const char H5_daos_type_key_g[]            = "Datatype";
 const char H5_daos_space_key_g[]           = "Dataspace";
 const char H5_daos_attr_key_g[]            = "/Attribute";
 const char H5_daos_nattr_key_g[]           = "Num Attributes";
 const char H5_daos_max_attr_corder_key_g[] = "Max Attribute Creation Order";
+const char H5_daos_attr_corder_holes_key_g[]  = "Attribute Creation Order Holes";
+const char H5_daos_nattr_corder_holes_key_g[] = "Num Attribute Creation Order Holes";
+const char H5_daos_attr_corder_fmt_key_g[]    = "Attribute Creation Order Index Format";
 const char H5_daos_ktype_g[]               = "Key Datatype";
 const char H5_daos_vtype_g[]               = "Value Datatype";
 const char H5_daos_map_key_g[]             = "Map Record";
+const char H5_daos_map_count_key_g[]       = "Map Entry Count";
+const char H5_daos_map_bloom_key_g[]       = "Map Bloom Filter";
+const char H5_daos_map_bloom_size_key_g[]  = "Map Bloom Filter Size";
+const char H5_daos_map_val_key_g[]         = "Map Value";
 const char H5_daos_blob_key_g[]            = "Blob";
 const char H5_daos_fillval_key_g[]         = "Fill Value";
 
@@ -350,15 +511,32 @@ const daos_size_t H5_daos_link_corder_key_size_g  = (daos_size_t)(sizeof(H5_daos
 const daos_size_t H5_daos_nlinks_key_size_g       = (daos_size_t)(sizeof(H5_daos_nlinks_key_g) - 1);
 const daos_size_t H5_daos_max_link_corder_key_size_g =
     (daos_size_t)(sizeof(H5_daos_max_link_corder_key_g) - 1);
+const daos_size_t H5_daos_link_corder_holes_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_link_corder_holes_key_g) - 1);
+const daos_size_t H5_daos_nlink_corder_holes_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_nlink_corder_holes_key_g) - 1);
+const daos_size_t H5_daos_link_corder_fmt_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_link_corder_fmt_key_g) - 1);
 const daos_size_t H5_daos_type_key_size_g  = (daos_size_t)(sizeof(H5_daos_type_key_g) - 1);
 const daos_size_t H5_daos_space_key_size_g = (daos_size_t)(sizeof(H5_daos_space_key_g) - 1);
 const daos_size_t H5_daos_attr_key_size_g  = (daos_size_t)(sizeof(H5_daos_attr_key_g) - 1);
 const daos_size_t H5_daos_nattr_key_size_g = (daos_size_t)(sizeof(H5_daos_nattr_key_g) - 1);
 const daos_size_t H5_daos_max_attr_corder_key_size_g =
     (daos_size_t)(sizeof(H5_daos_max_attr_corder_key_g) - 1);
+const daos_size_t H5_daos_attr_corder_holes_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_attr_corder_holes_key_g) - 1);
+const daos_size_t H5_daos_nattr_corder_holes_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_nattr_corder_holes_key_g) - 1);
+const daos_size_t H5_daos_attr_corder_fmt_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_attr_corder_fmt_key_g) - 1);
 const daos_size_t H5_daos_ktype_size_g       = (daos_size_t)(sizeof(H5_daos_ktype_g) - 1);
 const daos_size_t H5_daos_vtype_size_g       = (daos_size_t)(sizeof(H5_daos_vtype_g) - 1);
 const daos_size_t H5_daos_map_key_size_g     = (daos_size_t)(sizeof(H5_daos_map_key_g) - 1);
+const daos_size_t H5_daos_map_count_key_size_g = (daos_size_t)(sizeof(H5_daos_map_count_key_g) - 1);
+const daos_size_t H5_daos_map_bloom_key_size_g = (daos_size_t)(sizeof(H5_daos_map_bloom_key_g) - 1);
+const daos_size_t H5_daos_map_bloom_size_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_map_bloom_size_key_g) - 1);
+const daos_size_t H5_daos_map_val_key_size_g = (daos_size_t)(sizeof(H5_daos_map_val_key_g) - 1);
 const daos_size_t H5_daos_blob_key_size_g    = (daos_size_t)(sizeof(H5_daos_blob_key_g) - 1);
 const daos_size_t H5_daos_fillval_key_size_g = (daos_size_t)(sizeof(H5_daos_fillval_key_g) - 1);
 
@@ -446,7 +624,7 @@ H5daos_set_prop(hid_t fcpl_id, const char *prop_str)
     htri_t is_fcpl;
     herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     /* Check arguments */
     if (fcpl_id == H5P_DEFAULT)
@@ -530,7 +708,7 @@ H5daos_set_object_class(hid_t plist_id, char *object_class)
 {
     herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     if (plist_id == H5P_DEFAULT)
         D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
@@ -648,7 +826,7 @@ H5daos_get_object_class(hid_t plist_id, char *object_class, size_t size)
     size_t  len;
     ssize_t ret_value;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     /* Check if the property already exists on the property list */
     if ((prop_exists = H5Pexist(plist_id, H5_DAOS_OBJ_CLASS_NAME)) < 0)
@@ -709,7 +887,7 @@ H5daos_set_root_open_object_class(hid_t fapl_id, char *object_class)
     htri_t prop_exists;
     herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     if (fapl_id == H5P_DEFAULT)
         D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
@@ -767,7 +945,7 @@ H5daos_get_root_open_object_class(hid_t fapl_id, char *object_class, size_t size
     size_t  len;
     ssize_t ret_value;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
@@ -834,7 +1012,7 @@ H5daos_set_all_ind_metadata_ops(hid_t accpl_id, hbool_t is_independent)
     htri_t prop_exists;
     herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     if (accpl_id == H5P_DEFAULT)
         D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
@@ -884,7 +1062,7 @@ H5daos_get_all_ind_metadata_ops(hid_t accpl_id, hbool_t *is_independent)
     htri_t prop_exists;
     herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     if ((is_fapl = H5Pisa_class(accpl_id, H5P_FILE_ACCESS)) < 0)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
@@ -915,201 +1093,290 @@ done:
 } /* end H5daos_get_all_ind_metadata_ops() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_str_prop_delete
+ * Function:    H5daos_set_unordered_visit
  *
- * Purpose:     Property list callback for deleting a string property.
- *              Frees the string.
+ * Purpose:     Modifies the file access property list to allow H5Ovisit
+ *              and H5Lvisit to visit sibling subgroups concurrently,
+ *              making operator callbacks in no particular order.
  *
- * Return:      SUCCEED (never fails)
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_str_prop_delete(hid_t H5VL_DAOS_UNUSED prop_id, const char H5VL_DAOS_UNUSED *name,
-                        size_t H5VL_DAOS_UNUSED size, void *_value)
+herr_t
+H5daos_set_unordered_visit(hid_t fapl_id, hbool_t unordered)
 {
-    char **value = (char **)_value;
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    if (*value)
-        free(*value);
+    H5_daos_inc_public_api_cnt();
 
-    return SUCCEED;
-} /* end H5_daos_str_prop_delete() */
+    if (fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the unordered visit property already exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_UNORDERED_VISIT_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for unordered visit property");
+
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(fapl_id, H5_DAOS_UNORDERED_VISIT_PROP_NAME, &unordered) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set unordered visit property");
+    } /* end if */
+    else if (H5Pinsert2(fapl_id, H5_DAOS_UNORDERED_VISIT_PROP_NAME, sizeof(hbool_t), &unordered, NULL, NULL,
+                        NULL, NULL, H5_daos_bool_prop_compare, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_unordered_visit() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_str_prop_copy
+ * Function:    H5daos_get_unordered_visit
  *
- * Purpose:     Property list callback for copying a string property.
- *              Duplicates the string.
+ * Purpose:     Retrieves the unordered visit setting from the file access
+ *              property list fapl_id.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_str_prop_copy(const char H5VL_DAOS_UNUSED *name, size_t H5VL_DAOS_UNUSED size, void *_value)
+herr_t
+H5daos_get_unordered_visit(hid_t fapl_id, hbool_t *unordered)
 {
-    char **value     = (char **)_value;
+    htri_t is_fapl;
+    htri_t prop_exists;
     herr_t ret_value = SUCCEED;
 
-    if (*value)
-        if (NULL == (*value = strdup(*value)))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't copy string property");
+    H5_daos_inc_public_api_cnt();
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (!unordered)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unordered is NULL");
+
+    /* Check if the unordered visit property exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_UNORDERED_VISIT_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for unordered visit property");
+
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(fapl_id, H5_DAOS_UNORDERED_VISIT_PROP_NAME, unordered) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get unordered visit property");
+    } /* end if */
+    else
+        /* Visits are ordered by default */
+        *unordered = FALSE;
 
 done:
-    D_FUNC_LEAVE;
-} /* end H5_daos_str_prop_copy() */
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_unordered_visit() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_str_prop_compare
+ * Function:    H5daos_set_oidx_prealloc
  *
- * Purpose:     Property list callback for comparing string properties.
- *              Compares the strings using strcmp().
+ * Purpose:     Modifies the file access property list to have each
+ *              process reserve at least num_oidx object indices the
+ *              first time it creates an object in the file.
  *
- * Return:      SUCCEED (never fails)
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_str_prop_compare(const void *_value1, const void *_value2, size_t H5VL_DAOS_UNUSED size)
+herr_t
+H5daos_set_oidx_prealloc(hid_t fapl_id, uint64_t num_oidx)
 {
-    char *const *value1 = (char *const *)_value1;
-    char *const *value2 = (char *const *)_value2;
-    int          ret_value;
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    if (*value1) {
-        if (*value2)
-            ret_value = strcmp(*value1, *value2);
-        else
-            ret_value = 1;
+    H5_daos_inc_public_api_cnt();
+
+    if (fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the OIDX preallocation property already exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_OIDX_PREALLOC_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for OIDX preallocation property");
+
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(fapl_id, H5_DAOS_OIDX_PREALLOC_PROP_NAME, &num_oidx) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set OIDX preallocation property");
     } /* end if */
-    else {
-        if (*value2)
-            ret_value = -1;
-        else
-            ret_value = 0;
-    } /* end else */
+    else if (H5Pinsert2(fapl_id, H5_DAOS_OIDX_PREALLOC_PROP_NAME, sizeof(uint64_t), &num_oidx, NULL, NULL,
+                        NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
-    return ret_value;
-} /* end H5_daos_str_prop_compare() */
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_oidx_prealloc() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_str_prop_close
+ * Function:    H5daos_get_oidx_prealloc
  *
- * Purpose:     Property list callback for deleting a string property.
- *              Frees the string.
+ * Purpose:     Retrieves the number of object indices to reserve up
+ *              front from the file access property list fapl_id.
  *
- * Return:      SUCCEED (never fails)
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_str_prop_close(const char H5VL_DAOS_UNUSED *name, size_t H5VL_DAOS_UNUSED size, void *_value)
+herr_t
+H5daos_get_oidx_prealloc(hid_t fapl_id, uint64_t *num_oidx)
 {
-    char **value = (char **)_value;
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    if (*value)
-        free(*value);
+    H5_daos_inc_public_api_cnt();
 
-    return SUCCEED;
-} /* end H5_daos_str_prop_close() */
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (!num_oidx)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "num_oidx is NULL");
+
+    /* Check if the OIDX preallocation property exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_OIDX_PREALLOC_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for OIDX preallocation property");
+
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(fapl_id, H5_DAOS_OIDX_PREALLOC_PROP_NAME, num_oidx) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get OIDX preallocation property");
+    } /* end if */
+    else
+        /* Nothing is reserved beyond the default first block */
+        *num_oidx = 0;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_oidx_prealloc() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_bool_prop_compare
+ * Function:    H5daos_set_node_local_bcast
  *
- * Purpose:     Property list callback for comparing boolean properties.
- *              Compares the boolean values directly.
+ * Purpose:     Modifies the file access property list to send broadcasts
+ *              only to the first rank on each node, which then shares the
+ *              data with the other ranks on its node through shared
+ *              memory.
  *
- * Return:      SUCCEED (never fails)
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_bool_prop_compare(const void *_value1, const void *_value2, size_t H5VL_DAOS_UNUSED size)
+herr_t
+H5daos_set_node_local_bcast(hid_t fapl_id, hbool_t node_local)
 {
-    const hbool_t *bool1 = (const hbool_t *)_value1;
-    const hbool_t *bool2 = (const hbool_t *)_value2;
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    return *bool1 == *bool2;
-} /* end H5_daos_bool_prop_compare() */
+    H5_daos_inc_public_api_cnt();
+
+    if (fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the node-local broadcast property already exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_NODE_LOCAL_BCAST_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for node-local broadcast property");
+
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(fapl_id, H5_DAOS_NODE_LOCAL_BCAST_PROP_NAME, &node_local) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set node-local broadcast property");
+    } /* end if */
+    else if (H5Pinsert2(fapl_id, H5_DAOS_NODE_LOCAL_BCAST_PROP_NAME, sizeof(hbool_t), &node_local, NULL, NULL,
+                        NULL, NULL, H5_daos_bool_prop_compare, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_node_local_bcast() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5daos_snap_create
+ * Function:    H5daos_get_node_local_bcast
  *
- * Purpose:     Creates a snapshot and returns the snapshot ID.
+ * Purpose:     Retrieves the node-local broadcast setting from the file
+ *              access property list fapl_id.
  *
  * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:  Neil Fortner
- *              January, 2017
- *
  *-------------------------------------------------------------------------
  */
-#ifdef DSINC
 herr_t
-H5daos_snap_create(hid_t loc_id, H5_daos_snap_id_t *snap_id)
+H5daos_get_node_local_bcast(hid_t fapl_id, hbool_t *node_local)
 {
-    H5_daos_item_t *item;
-    H5_daos_file_t *file;
-    H5VL_object_t  *obj       = NULL; /* object token of loc_id */
-    herr_t          ret_value = SUCCEED;
-
-    H5_daos_inc_api_cnt();
-
-    if (!snap_id)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "snapshot ID pointer is NULL");
-
-    /* get the location object */
-    if (NULL == (obj = (H5VL_object_t *)H5I_object(loc_id)))
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid location identifier");
-
-    /* Make sure object's VOL is this one */
-    if (obj->driver->id != H5_DAOS_g)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "location does not use DAOS VOL connector");
-
-    /* Get file object */
-    if (NULL == (item = H5VLobject(loc_id)))
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a VOL object");
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    file = item->file;
+    H5_daos_inc_public_api_cnt();
 
-    /* Check for write access */
-    if (!(file->flags & H5F_ACC_RDWR))
-        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (!node_local)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "node_local is NULL");
 
-    /* Tell the file to save a snapshot next time it is flushed (committed) */
-    file->snap_epoch = (int)TRUE;
+    /* Check if the node-local broadcast property exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_NODE_LOCAL_BCAST_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for node-local broadcast property");
 
-    /* Return epoch in snap_id */
-    *snap_id = (uint64_t)file->epoch;
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(fapl_id, H5_DAOS_NODE_LOCAL_BCAST_PROP_NAME, node_local) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get node-local broadcast property");
+    } /* end if */
+    else
+        /* Broadcasts go directly to all ranks by default */
+        *node_local = FALSE;
 
 done:
     D_FUNC_LEAVE_API;
-} /* end H5daos_snap_create() */
-#endif
+} /* end H5daos_get_node_local_bcast() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5Pset_daos_snap_open
+ * Function:    H5daos_set_coll_err_batch
  *
- * XXX: text to be changed
- * Purpose:     Modify the file access property list to use the DAOS VOL
- *              connector defined in this source file.
+ * Purpose:     Modifies the file access property list to defer the
+ *              collective error checks made after collective operations,
+ *              checking up to batch_size of them at once.  0 disables
+ *              batching.
  *
  * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:  Neil Fortner
- *              October, 2016
- *
  *-------------------------------------------------------------------------
  */
-#ifdef DV_HAVE_SNAP_OPEN_ID
 herr_t
-H5Pset_daos_snap_open(hid_t fapl_id, H5_daos_snap_id_t snap_id)
+H5daos_set_coll_err_batch(hid_t fapl_id, unsigned batch_size)
 {
     htri_t is_fapl;
+    htri_t prop_exists;
     herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     if (fapl_id == H5P_DEFAULT)
         D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
@@ -1119,1400 +1386,1535 @@ H5Pset_daos_snap_open(hid_t fapl_id, H5_daos_snap_id_t snap_id)
     if (!is_fapl)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
 
-    /* Set the property */
-    if (H5Pset(fapl_id, H5_DAOS_SNAP_OPEN_ID, &snap_id) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set property value for snap id");
+    /* Check if the collective error check batch property already exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_COLL_ERR_BATCH_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for collective error check batch property");
+
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(fapl_id, H5_DAOS_COLL_ERR_BATCH_PROP_NAME, &batch_size) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set collective error check batch property");
+    } /* end if */
+    else if (H5Pinsert2(fapl_id, H5_DAOS_COLL_ERR_BATCH_PROP_NAME, sizeof(unsigned), &batch_size, NULL, NULL,
+                        NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
 done:
     D_FUNC_LEAVE_API;
-} /* end H5Pset_daos_snap_open() */
-#endif
+} /* end H5daos_set_coll_err_batch() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_init
+ * Function:    H5daos_get_coll_err_batch
  *
- * Purpose:     Initialize this VOL connector by registering the connector
- *              with the library.
+ * Purpose:     Retrieves the collective error check batch size from the
+ *              file access property list fapl_id.
  *
  * Return:      Non-negative on success/Negative on failure
  *
- * Programmer:  Neil Fortner
- *              October, 2016
- *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_init(hid_t H5VL_DAOS_UNUSED vipl_id)
+H5daos_get_coll_err_batch(hid_t fapl_id, unsigned *batch_size)
 {
-#ifdef DV_HAVE_SNAP_OPEN_ID
-    H5_daos_snap_id_t snap_id_default;
-#endif
-    char  *auto_chunk_str = NULL;
-    int    ret;
-    herr_t ret_value = SUCCEED; /* Return value */
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    if (H5_daos_initialized_g)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "attempting to initialize connector twice");
+    H5_daos_inc_public_api_cnt();
 
-    if ((dv_err_stack_g = H5Ecreate_stack()) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create HDF5 error stack");
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (!batch_size)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "batch_size is NULL");
 
-    /* Register the connector with HDF5's error reporting API */
-    if ((dv_err_class_g = H5Eregister_class(DAOS_VOL_ERR_CLS_NAME, DAOS_VOL_ERR_LIB_NAME, DAOS_VOL_ERR_VER)) <
-        0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register error class with HDF5 error API");
+    /* Check if the collective error check batch property exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_COLL_ERR_BATCH_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for collective error check batch property");
 
-    /* Register major error code for failures in object interface */
-    if ((dv_obj_err_maj_g = H5Ecreate_msg(dv_err_class_g, H5E_MAJOR, "Object interface")) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register error message for object interface");
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(fapl_id, H5_DAOS_COLL_ERR_BATCH_PROP_NAME, batch_size) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get collective error check batch property");
+    } /* end if */
+    else
+        /* Collective error checks are made after each operation by default */
+        *batch_size = 0;
 
-    /* Register major error code for failures in asynchronous interface */
-    if ((dv_async_err_g = H5Ecreate_msg(dv_err_class_g, H5E_MAJOR, "Asynchronous interface")) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register error message for asynchronous interface");
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_coll_err_batch() */
 
-#ifdef DV_HAVE_SNAP_OPEN_ID
-    /* Register the DAOS SNAP_OPEN_ID property with HDF5 */
-    snap_id_default = H5_DAOS_SNAP_ID_INVAL;
-    if (H5Pregister2(H5P_FILE_ACCESS, H5_DAOS_SNAP_OPEN_ID, sizeof(H5_daos_snap_id_t),
-                     (H5_daos_snap_id_t *)&snap_id_default, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "unable to register DAOS SNAP_OPEN_ID property");
-#endif
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_coll_lanes
+ *
+ * Purpose:     Modifies the file access property list to set the number
+ *              of collective lanes of files opened with it.  Collective
+ *              operations on a file are assigned to its lanes in turn,
+ *              and operations in different lanes may run at the same
+ *              time.  1 runs all collective operations on a file one
+ *              after another.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_coll_lanes(hid_t fapl_id, unsigned nlanes)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    /* Initialize daos */
-    if ((0 != (ret = daos_init())) && (ret != -DER_ALREADY))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "DAOS failed to initialize: %s",
-                     H5_daos_err_to_string(ret));
+    H5_daos_inc_public_api_cnt();
 
-#ifdef DV_TRACK_MEM_USAGE
-    /* Initialize allocated memory counter */
-    daos_vol_curr_alloc_bytes = 0;
-#endif
+    if (fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+    if (nlanes == 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of collective lanes must be positive");
 
-    /* Determine if bypassing of the DUNS has been requested */
-    if (NULL != getenv("HDF5_DAOS_BYPASS_DUNS"))
-        H5_daos_bypass_duns_g = TRUE;
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
 
-    /* Determine automatic chunking target size */
-    if (NULL != (auto_chunk_str = getenv("HDF5_DAOS_CHUNK_TARGET_SIZE"))) {
-        long long chunk_target_size_ll;
+    /* Check if the collective lanes property already exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_COLL_LANES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for collective lanes property");
 
-        errno = 0;
-        if ((chunk_target_size_ll = strtoll(auto_chunk_str, NULL, 10)) < 0 || errno)
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
-                         "failed to parse automatic chunking target size from environment or invalid value "
-                         "(H5_DAOS_CHUNK_TARGET_SIZE)");
-        H5_daos_chunk_target_size_g = (uint64_t)chunk_target_size_ll;
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(fapl_id, H5_DAOS_COLL_LANES_PROP_NAME, &nlanes) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set collective lanes property");
     } /* end if */
+    else if (H5Pinsert2(fapl_id, H5_DAOS_COLL_LANES_PROP_NAME, sizeof(unsigned), &nlanes, NULL, NULL, NULL,
+                        NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
-    /* Initialize global scheduler */
-    if (0 != (ret = tse_sched_init(&H5_daos_glob_sched_g, NULL, NULL)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create global task scheduler: %s",
-                     H5_daos_err_to_string(ret));
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_coll_lanes() */
 
-    /* Create global DAOS task list */
-    if (H5_daos_task_list_create(&H5_daos_task_list_g) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create DAOS task list");
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_coll_lanes
+ *
+ * Purpose:     Retrieves the number of collective lanes from the file
+ *              access property list fapl_id.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_coll_lanes(hid_t fapl_id, unsigned *nlanes)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    /* Setup HDF5 default property list cache */
-    if (H5_daos_fill_def_plist_cache() < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't populate HDF5 default property list cache");
+    H5_daos_inc_public_api_cnt();
 
-    /* Initialized */
-    H5_daos_initialized_g = TRUE;
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (!nlanes)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nlanes is NULL");
 
-done:
-    if (ret_value < 0) {
-        H5_daos_term();
+    /* Check if the collective lanes property exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_COLL_LANES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for collective lanes property");
+
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(fapl_id, H5_DAOS_COLL_LANES_PROP_NAME, nlanes) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get collective lanes property");
     } /* end if */
+    else
+        *nlanes = H5_DAOS_COLL_LANES_DEFAULT;
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_init() */
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_coll_lanes() */
 
-/*---------------------------------------------------------------------------
- * Function:    H5_daos_term
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_bcast_coalesce
  *
- * Purpose:     Shut down the DAOS VOL
+ * Purpose:     Modifies the file access property list to pack the
+ *              broadcasts of all collective lanes that are started in the
+ *              same progress tick into one message.
  *
- * Returns:     Non-negative on success/Negative on failure
+ * Return:      Non-negative on success/Negative on failure
  *
- *---------------------------------------------------------------------------
+ *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_term(void)
+herr_t
+H5daos_set_bcast_coalesce(hid_t fapl_id, hbool_t coalesce)
 {
+    htri_t is_fapl;
+    htri_t prop_exists;
     herr_t ret_value = SUCCEED;
 
-    /**
-     * H5_DAOS_g is only set if the connector is manually initialized,
-     * therefore we must check for proper DAOS initialization.
-     */
-    if (!H5_daos_initialized_g)
-        D_GOTO_DONE(ret_value);
-
-    /* Release global op pool */
-    if (H5_daos_glob_cur_op_pool_g)
-        H5_daos_op_pool_free(H5_daos_glob_cur_op_pool_g);
-
-    /* Free global DAOS task list */
-    if (H5_daos_task_list_g) {
-        H5_daos_task_list_free(H5_daos_task_list_g);
-        H5_daos_task_list_g = NULL;
-    }
-
-    /* Close global scheduler */
-    if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_WAIT) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress scheduler");
-    tse_sched_fini(&H5_daos_glob_sched_g);
-
-    /* Terminate DAOS */
-    if (daos_fini() < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "DAOS failed to terminate");
+    H5_daos_inc_public_api_cnt();
 
-#ifdef DV_HAVE_SNAP_OPEN_ID
-    /* Unregister the DAOS SNAP_OPEN_ID property from HDF5 */
-    if (H5Punregister(H5P_FILE_ACCESS, H5_DAOS_SNAP_OPEN_ID) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't unregister DAOS SNAP_OPEN_ID property");
-#endif
+    if (fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
 
-    /* Free default property list cache */
-    DV_free((void *)H5_daos_plist_cache_g);
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
 
-    /* "Forget" connector id.  This should normally be called by the library
-     * when it is closing the id, so no need to close it here. */
-    H5_DAOS_g = H5I_INVALID_HID;
+    /* Check if the broadcast coalescing property already exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_BCAST_COALESCE_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for broadcast coalescing property");
 
-    /* No longer initialized */
-    H5_daos_initialized_g = FALSE;
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(fapl_id, H5_DAOS_BCAST_COALESCE_PROP_NAME, &coalesce) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set broadcast coalescing property");
+    } /* end if */
+    else if (H5Pinsert2(fapl_id, H5_DAOS_BCAST_COALESCE_PROP_NAME, sizeof(hbool_t), &coalesce, NULL, NULL,
+                        NULL, NULL, H5_daos_bool_prop_compare, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
 done:
-#ifdef DV_TRACK_MEM_USAGE
-    /* Check for allocated memory */
-    if (0 != daos_vol_curr_alloc_bytes)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "%zu bytes were still left allocated",
-                     daos_vol_curr_alloc_bytes)
-
-    daos_vol_curr_alloc_bytes = 0;
-#endif
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_bcast_coalesce() */
 
-    /* Unregister from the HDF5 error API */
-    if (dv_err_class_g >= 0) {
-        if (dv_obj_err_maj_g >= 0 && H5Eclose_msg(dv_obj_err_maj_g) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL,
-                         "can't unregister error message for object interface");
-        if (dv_async_err_g >= 0 && H5Eclose_msg(dv_async_err_g) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL,
-                         "can't unregister error message for asynchronous interface");
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_bcast_coalesce
+ *
+ * Purpose:     Retrieves the broadcast coalescing setting from the file
+ *              access property list fapl_id.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_bcast_coalesce(hid_t fapl_id, hbool_t *coalesce)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-        if (H5Eunregister_class(dv_err_class_g) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't unregister error class from HDF5 error API");
+    H5_daos_inc_public_api_cnt();
 
-        /* Print the current error stack before destroying it */
-        PRINT_ERROR_STACK;
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (!coalesce)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "coalesce is NULL");
 
-        /* Destroy the error stack */
-        if (H5Eclose_stack(dv_err_stack_g) < 0) {
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close HDF5 error stack");
-            PRINT_ERROR_STACK;
-        } /* end if */
+    /* Check if the broadcast coalescing property exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_BCAST_COALESCE_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for broadcast coalescing property");
 
-        dv_err_stack_g   = H5I_INVALID_HID;
-        dv_err_class_g   = H5I_INVALID_HID;
-        dv_obj_err_maj_g = H5I_INVALID_HID;
-        dv_async_err_g   = H5I_INVALID_HID;
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(fapl_id, H5_DAOS_BCAST_COALESCE_PROP_NAME, coalesce) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get broadcast coalescing property");
     } /* end if */
+    else
+        /* Each broadcast is sent on its own by default */
+        *coalesce = FALSE;
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_term() */
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_bcast_coalesce() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_fill_def_plist_cache
+ * Function:    H5daos_set_wait_mode
  *
- * Purpose:     Sets up a global cache of the default values for several
- *              properties of HDF5's default property lists. This can avoid
- *              some overhead from H5P calls when default property lists
- *              are used.
+ * Purpose:     Modifies the file access property list to set the policy
+ *              used when waiting for asynchronous operations to complete.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_fill_def_plist_cache(void)
+herr_t
+H5daos_set_wait_mode(hid_t fapl_id, H5_daos_wait_mode_t wait_mode)
 {
-    H5_daos_plist_cache_t *cache_ptr = NULL;
-    herr_t                 ret_value = SUCCEED;
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    if (NULL == (cache_ptr = DV_malloc(sizeof(H5_daos_plist_cache_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate property list cache");
+    H5_daos_inc_public_api_cnt();
 
-    /* GCPL cache */
-    if (H5Pget_link_creation_order(H5P_GROUP_CREATE_DEFAULT, &cache_ptr->gcpl_cache.link_corder_flags) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get default link creation order flags");
-    if (H5Pget_attr_creation_order(H5P_GROUP_CREATE_DEFAULT, &cache_ptr->gcpl_cache.acorder_flags) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
-                     "can't get default attribute creation order flags for groups");
-
-    /* DCPL cache */
-    if ((cache_ptr->dcpl_cache.layout = H5Pget_layout(H5P_DATASET_CREATE_DEFAULT)) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get default dataset layout property");
-    if (H5Pfill_value_defined(H5P_DATASET_CREATE_DEFAULT, &cache_ptr->dcpl_cache.fill_status) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get default dataset fill value status");
-    if (H5Pget_fill_time(H5P_DATASET_CREATE_DEFAULT, &cache_ptr->dcpl_cache.fill_time) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get default dataset fill time");
-    if (H5Pget_attr_creation_order(H5P_DATASET_CREATE_DEFAULT, &cache_ptr->dcpl_cache.acorder_flags) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
-                     "can't get default attribute creation order flags for datasets");
-
-    /* TCPL cache */
-    if (H5Pget_attr_creation_order(H5P_DATATYPE_CREATE_DEFAULT, &cache_ptr->tcpl_cache.acorder_flags) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
-                     "can't get default attribute creation order flags for committed datatypes");
-
-    /* MCPL cache */
-    if (H5Pget_attr_creation_order(H5P_MAP_CREATE_DEFAULT, &cache_ptr->mcpl_cache.acorder_flags) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
-                     "can't get default attribute creation order flags for maps");
-
-    /* MAPL cache */
-    if (H5Pget_map_iterate_hints(H5P_MAP_ACCESS_DEFAULT, &cache_ptr->mapl_cache.dkey_prefetch_size,
-                                 &cache_ptr->mapl_cache.dkey_alloc_size) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map iterate hints");
+    if (fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
 
-    /* LCPL cache */
-    if (H5Pget_create_intermediate_group(H5P_LINK_CREATE_DEFAULT, &cache_ptr->lcpl_cache.crt_intermed_grp) <
-        0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
-                     "can't get default intermediate group creation property value");
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (wait_mode != H5_DAOS_WAIT_POLL && wait_mode != H5_DAOS_WAIT_ADAPTIVE)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid wait mode");
 
-    /* OcopyPL cache */
-    if (H5Pget_copy_object(H5P_OBJECT_COPY_DEFAULT, &cache_ptr->ocpypl_cache.obj_copy_options) < 0)
-        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "failed to retrieve default object copy options");
+    /* Check if the wait mode property already exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_WAIT_MODE_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for wait mode property");
 
-    H5_daos_plist_cache_g = cache_ptr;
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(fapl_id, H5_DAOS_WAIT_MODE_PROP_NAME, &wait_mode) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set wait mode property");
+    } /* end if */
+    else if (H5Pinsert2(fapl_id, H5_DAOS_WAIT_MODE_PROP_NAME, sizeof(H5_daos_wait_mode_t), &wait_mode, NULL,
+                        NULL, NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
 done:
-    if (ret_value < 0 && cache_ptr)
-        DV_free(cache_ptr);
-
-    D_FUNC_LEAVE;
-} /* end H5_daos_fill_def_plist_cache() */
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_wait_mode() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_pool_connect
- *
- * Purpose:     Creates an asynchronous task for connecting to the
- *              specified pool.
+ * Function:    H5daos_get_wait_mode
  *
- *              DSINC - This routine should eventually be modified to serve
- *                      pool handles from a cache of open handles so that
- *                      we don't re-connect to pools which are already
- *                      connected to when doing multiple file creates/opens
- *                      within the same pool.
+ * Purpose:     Retrieves the policy used when waiting for asynchronous
+ *              operations from the file access property list fapl_id.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_pool_connect(H5_daos_acc_params_t *pool_acc_params, unsigned int flags, daos_handle_t *poh_out,
-                     daos_pool_info_t *pool_info_out, H5_daos_req_t *req, tse_task_t **first_task,
-                     tse_task_t **dep_task)
+H5daos_get_wait_mode(hid_t fapl_id, H5_daos_wait_mode_t *wait_mode)
 {
-    H5_daos_pool_connect_ud_t *connect_udata = NULL;
-    tse_task_t                *connect_task  = NULL;
-    int                        ret;
-    herr_t                     ret_value = SUCCEED;
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    assert(pool_acc_params);
-    assert(pool_acc_params->pool);
-    assert(poh_out);
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
+    H5_daos_inc_public_api_cnt();
 
-    if (NULL == (connect_udata = (H5_daos_pool_connect_ud_t *)DV_malloc(sizeof(H5_daos_pool_connect_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "can't allocate user data struct for pool connect task");
-    connect_udata->req   = req;
-    connect_udata->pool  = pool_acc_params->pool;
-    connect_udata->poh   = poh_out;
-    connect_udata->sys   = pool_acc_params->sys;
-    connect_udata->flags = flags;
-    connect_udata->info  = pool_info_out;
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (!wait_mode)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "wait_mode is NULL");
 
-    /* Create task for pool connect */
-    if (H5_daos_create_daos_task(DAOS_OPC_POOL_CONNECT, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_pool_connect_prep_cb, H5_daos_pool_connect_comp_cb, connect_udata,
-                                 &connect_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to connect to DAOS pool");
+    /* Check if the wait mode property exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_WAIT_MODE_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for wait mode property");
 
-    /* Schedule DAOS pool connect task (or save it to be scheduled later) and
-     * give it a reference to req */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(connect_task, false)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to connect to DAOS pool: %s",
-                         H5_daos_err_to_string(ret));
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(fapl_id, H5_DAOS_WAIT_MODE_PROP_NAME, wait_mode) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get wait mode property");
     } /* end if */
     else
-        *first_task = connect_task;
-    req->rc++;
-
-    /* Relinquish control of the pool connect udata to the
-     * task's function body */
-    connect_udata = NULL;
-
-    *dep_task = connect_task;
+        /* Poll at a fixed interval by default */
+        *wait_mode = H5_DAOS_WAIT_POLL;
 
 done:
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        connect_udata = DV_free(connect_udata);
-    } /* end if */
-
-    assert(!connect_udata);
-
-    D_FUNC_LEAVE;
-} /* end H5_daos_pool_connect() */
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_wait_mode() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_pool_connect_prep_cb
+ * Function:    H5daos_set_map_bloom_filter
  *
- * Purpose:     Prepare callback for asynchronous daos_pool_connect.
- *              Currently checks for errors from previous tasks then sets
- *              arguments for daos_pool_connect.
+ * Purpose:     Modifies the map creation property list to give maps
+ *              created with it a Bloom filter of nbits bits over their
+ *              keys, so that checks for keys that are not in the map can
+ *              usually be answered without accessing the map.  0
+ *              disables the Bloom filter.  Keys put by another process
+ *              are seen once both processes have flushed the file with
+ *              H5Fflush, or the other process has closed the map and it
+ *              is opened afterwards.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_pool_connect_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5daos_set_map_bloom_filter(hid_t mcpl_id, uint64_t nbits)
 {
-    H5_daos_pool_connect_ud_t *udata;
-    daos_pool_connect_t       *connect_args;
-    int                        ret_value = 0;
+    htri_t is_mcpl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for pool connect task");
+    H5_daos_inc_public_api_cnt();
 
-    assert(udata->req);
-    assert(udata->pool);
+    if (mcpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
+    if ((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_mcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+    if (nbits > H5_DAOS_MAP_BLOOM_MAX_BITS)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Bloom filter size is too large");
 
-    /* Ensure that DAOS pool is set */
-    if (!udata->pool || (0 == strlen(udata->pool)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_BAD_VALUE, "DAOS pool is not set");
+    /* Check if the Bloom filter property already exists on the property list */
+    if ((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_BLOOM_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for Bloom filter property");
 
-    /* Set daos_pool_connect task args */
-    if (NULL == (connect_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for pool connect task");
-    memset(connect_args, 0, sizeof(*connect_args));
-    connect_args->poh   = udata->poh;
-    connect_args->grp   = udata->sys;
-    connect_args->flags = udata->flags;
-    connect_args->info  = udata->info;
-#if CHECK_DAOS_API_VERSION(1, 4)
-    connect_args->pool = udata->pool;
-#else
-    if (uuid_parse(udata->pool, connect_args->uuid) < 0)
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "invalid pool uuid");
-#endif
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(mcpl_id, H5_DAOS_MAP_BLOOM_PROP_NAME, &nbits) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set Bloom filter property");
+    } /* end if */
+    else if (H5Pinsert2(mcpl_id, H5_DAOS_MAP_BLOOM_PROP_NAME, sizeof(uint64_t), &nbits, NULL, NULL, NULL,
+                        NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
 done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
-
-    D_FUNC_LEAVE;
-} /* end H5_daos_pool_connect_prep_cb() */
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_map_bloom_filter() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_pool_connect_comp_cb
+ * Function:    H5daos_get_map_bloom_filter
  *
- * Purpose:     Completion callback for asynchronous daos_pool_connect.
- *              Currently checks for a failed task then frees private data.
+ * Purpose:     Retrieves the size in bits of the Bloom filter set on the
+ *              map creation property list mcpl_id.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_pool_connect_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5daos_get_map_bloom_filter(hid_t mcpl_id, uint64_t *nbits)
 {
-    H5_daos_pool_connect_ud_t *udata;
-    int                        ret_value = 0;
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for DAOS pool connect task");
-
-    assert(udata->req);
-
-    /* Handle errors in daos_pool_connect task.  Only record error in udata->req_status
-     * if it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = task->dt_result;
-        udata->req->failed_task = "DAOS pool connect";
-    } /* end if */
-    else if (task->dt_result == 0) {
-        /* After connecting to a pool, check if the file object's container_poh
-         * field has been set yet. If not, make sure it gets updated with the
-         * handle of the pool that we just connected to. This will most often
-         * happen during file opens, where the file object's container_poh
-         * field is initially invalid.
-         */
-        if (udata->req->file && daos_handle_is_inval(udata->req->file->container_poh))
-            udata->req->file->container_poh = *udata->poh;
-    } /* end else */
+    htri_t is_mcpl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-done:
-    /* Free private data if we haven't released ownership */
-    if (udata) {
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except
-         * for H5_daos_req_free_int, which updates req->status if it sees an
-         * error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->req->status      = ret_value;
-            udata->req->failed_task = "DAOS pool connect completion callback";
-        } /* end if */
+    H5_daos_inc_public_api_cnt();
 
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+    if ((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_mcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+    if (!nbits)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nbits is NULL");
 
-#if !defined(DAOS_API_VERSION_MAJOR) || DAOS_API_VERSION_MAJOR < 1
-        if (udata->svc)
-            d_rank_list_free(udata->svc);
-#endif
+    /* Check if the Bloom filter property exists on the property list */
+    if ((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_BLOOM_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for Bloom filter property");
 
-        /* Free private data */
-        DV_free(udata);
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(mcpl_id, H5_DAOS_MAP_BLOOM_PROP_NAME, nbits) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get Bloom filter property");
     } /* end if */
     else
-        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+        /* Maps have no Bloom filter by default */
+        *nbits = 0;
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_pool_connect_comp_cb() */
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_map_bloom_filter() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_pool_disconnect
+ * Function:    H5daos_set_map_large_value_threshold
  *
- * Purpose:     Creates an asynchronous task for disconnecting from the
- *              specified pool.
+ * Purpose:     Modifies the map creation property list so that maps
+ *              created with it store their values out of line, as byte
+ *              arrays under a separate akey, if the size of the map's
+ *              value datatype is larger than threshold bytes.  Values
+ *              stored this way can be read in part with
+ *              H5daos_map_get_partial.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_pool_disconnect(daos_handle_t *poh, H5_daos_req_t *req, tse_task_t **first_task,
-                        tse_task_t **dep_task)
+H5daos_set_map_large_value_threshold(hid_t mcpl_id, size_t threshold)
 {
-    H5_daos_pool_disconnect_ud_t *disconnect_udata = NULL;
-    tse_task_t                   *disconnect_task  = NULL;
-    int                           ret;
-    herr_t                        ret_value = SUCCEED;
+    htri_t is_mcpl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    assert(poh);
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
-
-    if (NULL ==
-        (disconnect_udata = (H5_daos_pool_disconnect_ud_t *)DV_malloc(sizeof(H5_daos_pool_disconnect_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "can't allocate user data struct for pool disconnect task");
-    disconnect_udata->req = req;
-    disconnect_udata->poh = poh;
-
-    /* Create task for pool disconnect */
-    if (H5_daos_create_daos_task(DAOS_OPC_POOL_DISCONNECT, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_pool_disconnect_prep_cb, H5_daos_pool_disconnect_comp_cb,
-                                 disconnect_udata, &disconnect_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to disconnect from DAOS pool");
+    H5_daos_inc_public_api_cnt();
 
-    /* Schedule DAOS pool disconnect task (or save it to be scheduled later) and
-     * give it a reference to req */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(disconnect_task, false)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to disconnect from DAOS pool: %s",
-                         H5_daos_err_to_string(ret));
-    } /* end if */
-    else
-        *first_task = disconnect_task;
-    req->rc++;
+    if (mcpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
 
-    /* Relinquish control of the pool disconnect udata to the
-     * task's function body */
-    disconnect_udata = NULL;
+    if ((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_mcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
 
-    *dep_task = disconnect_task;
+    /* Check if the threshold property already exists on the property list */
+    if ((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_LARGE_VAL_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for large value threshold property");
 
-done:
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        disconnect_udata = DV_free(disconnect_udata);
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(mcpl_id, H5_DAOS_MAP_LARGE_VAL_PROP_NAME, &threshold) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set large value threshold property");
     } /* end if */
+    else if (H5Pinsert2(mcpl_id, H5_DAOS_MAP_LARGE_VAL_PROP_NAME, sizeof(size_t), &threshold, NULL, NULL,
+                        NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
-    assert(!disconnect_udata);
-
-    D_FUNC_LEAVE;
-} /* end H5_daos_pool_disconnect() */
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_map_large_value_threshold() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_pool_disconnect_prep_cb
+ * Function:    H5daos_get_map_large_value_threshold
  *
- * Purpose:     Prepare callback for asynchronous daos_pool_disconnect.
- *              Currently checks for errors from previous tasks then sets
- *              arguments for daos_pool_disconnect.
+ * Purpose:     Retrieves the value size above which maps created with
+ *              the map creation property list mcpl_id store their values
+ *              out of line.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_pool_disconnect_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5daos_get_map_large_value_threshold(hid_t mcpl_id, size_t *threshold)
 {
-    H5_daos_pool_disconnect_ud_t *udata;
-    daos_pool_disconnect_t       *disconnect_args;
-    int                           ret_value = 0;
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for pool disconnect task");
+    htri_t is_mcpl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
 
-    assert(udata->req);
-    assert(udata->poh);
+    H5_daos_inc_public_api_cnt();
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
+    if ((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_mcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+    if (!threshold)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "threshold is NULL");
 
-    if (daos_handle_is_inval(*udata->poh))
-        D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "pool handle is invalid");
+    /* Check if the threshold property exists on the property list */
+    if ((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_LARGE_VAL_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for large value threshold property");
 
-    /* Set daos_pool_disconnect task args */
-    if (NULL == (disconnect_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for pool disconnect task");
-    disconnect_args->poh = *udata->poh;
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(mcpl_id, H5_DAOS_MAP_LARGE_VAL_PROP_NAME, threshold) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get large value threshold property");
+    } /* end if */
+    else
+        *threshold = H5_DAOS_MAP_LARGE_VAL_THRESHOLD_DEFAULT;
 
 done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
-
-    D_FUNC_LEAVE;
-} /* end H5_daos_pool_disconnect_prep_cb() */
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_map_large_value_threshold() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_pool_disconnect_comp_cb
+ * Function:    H5daos_get_alloc_stats
  *
- * Purpose:     Completion callback for asynchronous daos_pool_disconnect.
- *              Currently checks for a failed task then frees private data.
+ * Purpose:     Retrieves statistics for the connector's free lists of
+ *              per-operation structures, summed over all free lists.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_pool_disconnect_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5daos_get_alloc_stats(H5_daos_alloc_stats_t *stats)
 {
-    H5_daos_pool_disconnect_ud_t *udata;
-    int                           ret_value = 0;
-
-    assert(H5_daos_task_list_g);
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for DAOS pool disconnect task");
-
-    assert(udata->req);
-
-    /* Handle errors in daos_pool_disconnect task.  Only record error in udata->req_status
-     * if it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = task->dt_result;
-        udata->req->failed_task = "DAOS pool disconnect";
-    } /* end if */
-
-done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
-    /* Free private data if we haven't released ownership */
-    if (udata) {
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except
-         * for H5_daos_req_free_int, which updates req->status if it sees an
-         * error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->req->status      = ret_value;
-            udata->req->failed_task = "DAOS pool disconnect completion callback";
-        } /* end if */
-
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-        /* Free private data */
-        DV_free(udata);
-    } /* end if */
-    else
-        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
-
-    D_FUNC_LEAVE;
-} /* end H5_daos_pool_disconnect_comp_cb() */
+    /* The free lists are also used by the background progress thread */
+    return H5_daos_public_call(H5_daos_get_alloc_stats_op, stats);
+} /* end H5daos_get_alloc_stats() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_faccess_info_copy
- *
- * Purpose:     Copies the DAOS-specific file access properties.
+ * Function:    H5_daos_get_alloc_stats_op
  *
- * Return:      Success:        Ptr to a new property list
- *              Failure:        NULL
+ * Purpose:     Body of H5daos_get_alloc_stats(), run through
+ *              H5_daos_public_call().
  *
- * Programmer:  Neil Fortner
- *              October, 2016
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static void *
-H5_daos_faccess_info_copy(const void *_old_fa)
+static herr_t
+H5_daos_get_alloc_stats_op(void *_stats)
 {
-    const H5_daos_acc_params_t *old_fa    = (const H5_daos_acc_params_t *)_old_fa;
-    H5_daos_acc_params_t       *new_fa    = NULL;
-    void                       *ret_value = NULL;
-
-    H5_daos_inc_api_cnt();
-
-    if (!_old_fa)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid fapl");
-
-    if (NULL == (new_fa = (H5_daos_acc_params_t *)DV_malloc(sizeof(H5_daos_acc_params_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
+    H5_daos_alloc_stats_t *stats     = (H5_daos_alloc_stats_t *)_stats;
+    herr_t                 ret_value = SUCCEED;
 
-    /* Copy the general information */
-    memcpy(new_fa, old_fa, sizeof(H5_daos_acc_params_t));
+    if (!stats)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stats is NULL");
 
-    ret_value = new_fa;
+    H5_daos_free_list_get_stats(stats);
 
 done:
-    if (NULL == ret_value) {
-        /* cleanup */
-        if (new_fa && H5_daos_faccess_info_free(new_fa) < 0)
-            D_DONE_ERROR(H5E_PLIST, H5E_CANTFREE, NULL, "can't free fapl");
-    } /* end if */
-
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_faccess_info_copy() */
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_alloc_stats_op() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_faccess_info_free
- *
- * Purpose:     Frees the DAOS-specific file access properties.
+ * Function:    H5_daos_str_prop_delete
  *
- * Return:      Success:    0
- *              Failure:    -1
+ * Purpose:     Property list callback for deleting a string property.
+ *              Frees the string.
  *
- * Programmer:  Neil Fortner
- *              October, 2016
+ * Return:      SUCCEED (never fails)
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_faccess_info_free(void *_fa)
+H5_daos_str_prop_delete(hid_t H5VL_DAOS_UNUSED prop_id, const char H5VL_DAOS_UNUSED *name,
+                        size_t H5VL_DAOS_UNUSED size, void *_value)
 {
-    H5_daos_acc_params_t *fa        = (H5_daos_acc_params_t *)_fa;
-    herr_t                ret_value = SUCCEED;
-
-    H5_daos_inc_api_cnt();
-
-    if (!_fa)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid fapl");
+    char **value = (char **)_value;
 
-done:
-    /* free the struct */
-    DV_free(fa);
+    if (*value)
+        free(*value);
 
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_faccess_info_free() */
+    return SUCCEED;
+} /* end H5_daos_str_prop_delete() */
 
-/*---------------------------------------------------------------------------
- * Function:    H5_daos_get_conn_cls
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_str_prop_copy
  *
- * Purpose:     Query the connector class.
+ * Purpose:     Property list callback for copying a string property.
+ *              Duplicates the string.
  *
- * Return:      Success:    0
- *              Failure:    -1
+ * Return:      Non-negative on success/Negative on failure
  *
- *---------------------------------------------------------------------------
+ *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_get_conn_cls(void *item, H5VL_get_conn_lvl_t H5VL_DAOS_UNUSED lvl, const H5VL_class_t **conn_cls)
+H5_daos_str_prop_copy(const char H5VL_DAOS_UNUSED *name, size_t H5VL_DAOS_UNUSED size, void *_value)
 {
+    char **value     = (char **)_value;
     herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
-
-    if (!item)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "item parameter not supplied");
-    if (!conn_cls)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "conn_cls parameter not supplied");
-
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
-
-    /* Retrieve the DAOS VOL connector class */
-    *conn_cls = &H5_daos_g;
+    if (*value)
+        if (NULL == (*value = strdup(*value)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't copy string property");
 
 done:
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_get_conn_cls() */
+    D_FUNC_LEAVE;
+} /* end H5_daos_str_prop_copy() */
 
-/*---------------------------------------------------------------------------
- * Function:    H5_daos_get_cap_flags
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_str_prop_compare
  *
- * Purpose:     Retrieves the capability flags for this VOL connector.
+ * Purpose:     Property list callback for comparing string properties.
+ *              Compares the strings using strcmp().
  *
- * Return:      Non-negative on Success/Negative on failure
+ * Return:      SUCCEED (never fails)
  *
- *---------------------------------------------------------------------------
+ *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_get_cap_flags(const void H5VL_DAOS_UNUSED *info,
-#if H5VL_VERSION >= 3
-                      uint64_t *cap_flags
-#else
-                      unsigned *cap_flags
-#endif
-)
+static int
+H5_daos_str_prop_compare(const void *_value1, const void *_value2, size_t H5VL_DAOS_UNUSED size)
 {
-    herr_t ret_value = SUCCEED;
+    char *const *value1 = (char *const *)_value1;
+    char *const *value2 = (char *const *)_value2;
+    int          ret_value;
 
-    H5_daos_inc_api_cnt();
+    if (*value1) {
+        if (*value2)
+            ret_value = strcmp(*value1, *value2);
+        else
+            ret_value = 1;
+    } /* end if */
+    else {
+        if (*value2)
+            ret_value = -1;
+        else
+            ret_value = 0;
+    } /* end else */
 
-    if (!cap_flags)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid cap_flags parameter");
+    return ret_value;
+} /* end H5_daos_str_prop_compare() */
 
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_str_prop_close
+ *
+ * Purpose:     Property list callback for deleting a string property.
+ *              Frees the string.
+ *
+ * Return:      SUCCEED (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_str_prop_close(const char H5VL_DAOS_UNUSED *name, size_t H5VL_DAOS_UNUSED size, void *_value)
+{
+    char **value = (char **)_value;
 
-    /* Set the flags from the connector's capability flags field */
-    *cap_flags = H5_daos_g.cap_flags;
+    if (*value)
+        free(*value);
 
-done:
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_get_cap_flags() */
+    return SUCCEED;
+} /* end H5_daos_str_prop_close() */
 
-/*---------------------------------------------------------------------------
- * Function:    H5_daos_opt_query
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bool_prop_compare
  *
- * Purpose:     Query if an optional operation is supported by this connector
+ * Purpose:     Property list callback for comparing boolean properties.
+ *              Compares the boolean values directly.
  *
- * Return:      Success:    0
- *              Failure:    -1
+ * Return:      SUCCEED (never fails)
  *
- *---------------------------------------------------------------------------
+ *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_opt_query(void *item, H5VL_subclass_t H5VL_DAOS_UNUSED cls, int opt_type,
-                  H5_DAOS_OPT_QUERY_OUT_TYPE *supported)
+static int
+H5_daos_bool_prop_compare(const void *_value1, const void *_value2, size_t H5VL_DAOS_UNUSED size)
 {
-    herr_t ret_value = SUCCEED;
-
-    H5_daos_inc_api_cnt();
+    const hbool_t *bool1 = (const hbool_t *)_value1;
+    const hbool_t *bool2 = (const hbool_t *)_value2;
 
-    if (!item)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "\"item\" parameter not supplied");
-    if (!supported)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output parameter not supplied");
+    return *bool1 == *bool2;
+} /* end H5_daos_bool_prop_compare() */
 
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_snap_create
+ *
+ * Purpose:     Creates a snapshot and returns the snapshot ID.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2017
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifdef DSINC
+herr_t
+H5daos_snap_create(hid_t loc_id, H5_daos_snap_id_t *snap_id)
+{
+    H5_daos_item_t *item;
+    H5_daos_file_t *file;
+    H5VL_object_t  *obj       = NULL; /* object token of loc_id */
+    herr_t          ret_value = SUCCEED;
 
-    /* Check operation type */
-    switch (opt_type) {
-        /* H5Mcreate/create_anon */
-        case H5VL_MAP_CREATE: {
-            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_MODIFY_METADATA;
-            break;
-        } /* end block */
+    H5_daos_inc_public_api_cnt();
 
-        /* H5Mopen */
-        case H5VL_MAP_OPEN: {
-            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_QUERY_METADATA;
-            break;
-        } /* end block */
+    if (!snap_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "snapshot ID pointer is NULL");
 
-        /* H5Mget */
-        case H5VL_MAP_GET_VAL: {
-            *supported =
-                H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_READ_DATA | H5_DAOS_OPT_QUERY_NO_ASYNC;
-            break;
-        } /* end block */
+    /* get the location object */
+    if (NULL == (obj = (H5VL_object_t *)H5I_object(loc_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid location identifier");
 
-        /* H5Mexists */
-        case H5VL_MAP_EXISTS: {
-            *supported =
-                H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_READ_DATA | H5_DAOS_OPT_QUERY_NO_ASYNC;
-            break;
-        } /* end block */
+    /* Make sure object's VOL is this one */
+    if (obj->driver->id != H5_DAOS_g)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "location does not use DAOS VOL connector");
 
-        /* H5Mput */
-        case H5VL_MAP_PUT: {
-            *supported =
-                H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_READ_DATA | H5_DAOS_OPT_QUERY_NO_ASYNC;
-            break;
-        } /* end block */
+    /* Get file object */
+    if (NULL == (item = H5VLobject(loc_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a VOL object");
 
-        /* Operations that get misc info from the map */
-        case H5VL_MAP_GET: {
-            *supported =
-                H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_QUERY_METADATA | H5_DAOS_OPT_QUERY_NO_ASYNC;
-            break;
-        } /* end block */
+    file = item->file;
 
-        /* Specific operations (H5Miterate and H5Mdelete) */
-        case H5VL_MAP_SPECIFIC: {
-            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_QUERY_METADATA |
-                         H5_DAOS_OPT_QUERY_MODIFY_METADATA | H5_DAOS_OPT_QUERY_NO_ASYNC;
-            break;
-        } /* end block */
+    /* Check for write access */
+    if (!(file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
 
-        /* H5Mclose */
-        case H5VL_MAP_CLOSE: {
-            *supported = H5_DAOS_OPT_QUERY_SUPPORTED;
-            break;
-        } /* end block */
+    /* Tell the file to save a snapshot next time it is flushed (committed) */
+    file->snap_epoch = (int)TRUE;
 
-        default: {
-            /* Not supported */
-            *supported = 0;
-            break;
-        } /* end block */
-    }     /* end switch */
+    /* Return epoch in snap_id */
+    *snap_id = (uint64_t)file->epoch;
 
 done:
     D_FUNC_LEAVE_API;
-} /* end H5_daos_opt_query() */
+} /* end H5daos_snap_create() */
+#endif
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_optional
+ * Function:    H5Pset_daos_snap_open
  *
- * Purpose:     Optional VOL callbacks.  Thin switchboard to translate map
- *              object calls to a format analogous to other VOL object
- *              callbacks.
+ * XXX: text to be changed
+ * Purpose:     Modify the file access property list to use the DAOS VOL
+ *              connector defined in this source file.
  *
- * Return:      Success:    0
- *              Failure:    -1
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Neil Fortner
+ *              October, 2016
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_optional(void *item, H5VL_optional_args_t *opt_args, hid_t dxpl_id, void **req)
+#ifdef DV_HAVE_SNAP_OPEN_ID
+herr_t
+H5Pset_daos_snap_open(hid_t fapl_id, H5_daos_snap_id_t snap_id)
 {
+    htri_t is_fapl;
     herr_t ret_value = SUCCEED;
 
     H5_daos_inc_api_cnt();
 
-    /* Check operation type */
-    switch (opt_args->op_type) {
-        /* H5Mcreate/create_anon */
-        case H5VL_MAP_CREATE: {
-            H5VL_map_args_t *map_args = (H5VL_map_args_t *)opt_args->args;
-            hid_t            lcpl_id  = H5I_INVALID_HID;
-            hid_t            ktype_id = H5I_INVALID_HID;
-            hid_t            vtype_id = H5I_INVALID_HID;
-            hid_t            mcpl_id  = H5I_INVALID_HID;
-            hid_t            mapl_id  = H5I_INVALID_HID;
+    if (fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
 
-            /* Check operation arguments pointer.  All other arguments will
-             * be checked by H5_daos_map_create. */
-            if (!map_args)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
 
-            lcpl_id  = map_args->create.lcpl_id;
-            ktype_id = map_args->create.key_type_id;
-            vtype_id = map_args->create.val_type_id;
-            mcpl_id  = map_args->create.mcpl_id;
-            mapl_id  = map_args->create.mapl_id;
+    /* Set the property */
+    if (H5Pset(fapl_id, H5_DAOS_SNAP_OPEN_ID, &snap_id) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set property value for snap id");
 
-            /* Pass the call */
-            if (NULL == (map_args->create.map =
-                             H5_daos_map_create(item, &map_args->create.loc_params, map_args->create.name,
-                                                lcpl_id, ktype_id, vtype_id, mcpl_id, mapl_id, dxpl_id, req)))
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create map object");
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5Pset_daos_snap_open() */
+#endif
 
-            break;
-        } /* end block */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_init
+ *
+ * Purpose:     Initialize this VOL connector by registering the connector
+ *              with the library.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Neil Fortner
+ *              October, 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_init(hid_t H5VL_DAOS_UNUSED vipl_id)
+{
+#ifdef DV_HAVE_SNAP_OPEN_ID
+    H5_daos_snap_id_t snap_id_default;
+#endif
+    char  *auto_chunk_str = NULL;
+    char  *budget_str     = NULL;
+    int    ret;
+    herr_t ret_value = SUCCEED; /* Return value */
 
-        /* H5Mopen */
-        case H5VL_MAP_OPEN: {
-            H5VL_map_args_t *map_args = (H5VL_map_args_t *)opt_args->args;
-            hid_t            mapl_id  = H5I_INVALID_HID;
+    if (H5_daos_initialized_g)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "attempting to initialize connector twice");
 
-            /* Check operation arguments pointer.  All other arguments will
-             * be checked by H5_daos_map_open. */
-            if (!map_args)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    if ((dv_err_stack_g = H5Ecreate_stack()) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create HDF5 error stack");
 
-            mapl_id = map_args->open.mapl_id;
+    /* Register the connector with HDF5's error reporting API */
+    if ((dv_err_class_g = H5Eregister_class(DAOS_VOL_ERR_CLS_NAME, DAOS_VOL_ERR_LIB_NAME, DAOS_VOL_ERR_VER)) <
+        0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register error class with HDF5 error API");
 
-            /* Pass the call */
-            if (NULL == (map_args->open.map = H5_daos_map_open(item, &map_args->open.loc_params,
-                                                               map_args->open.name, mapl_id, dxpl_id, req)))
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map object");
+    /* Register major error code for failures in object interface */
+    if ((dv_obj_err_maj_g = H5Ecreate_msg(dv_err_class_g, H5E_MAJOR, "Object interface")) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register error message for object interface");
 
-            break;
-        } /* end block */
+    /* Register major error code for failures in asynchronous interface */
+    if ((dv_async_err_g = H5Ecreate_msg(dv_err_class_g, H5E_MAJOR, "Asynchronous interface")) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register error message for asynchronous interface");
 
-        /* H5Mget */
-        case H5VL_MAP_GET_VAL: {
-            H5VL_map_args_t *map_args        = (H5VL_map_args_t *)opt_args->args;
-            hid_t            key_mem_type_id = H5I_INVALID_HID;
-            hid_t            val_mem_type_id = H5I_INVALID_HID;
-            void            *value           = NULL;
+#ifdef DV_HAVE_SNAP_OPEN_ID
+    /* Register the DAOS SNAP_OPEN_ID property with HDF5 */
+    snap_id_default = H5_DAOS_SNAP_ID_INVAL;
+    if (H5Pregister2(H5P_FILE_ACCESS, H5_DAOS_SNAP_OPEN_ID, sizeof(H5_daos_snap_id_t),
+                     (H5_daos_snap_id_t *)&snap_id_default, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "unable to register DAOS SNAP_OPEN_ID property");
+#endif
 
-            /* Check operation arguments pointer.  All other arguments will
-             * be checked by H5_daos_map_get_val. */
-            if (!map_args)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    /* Initialize daos */
+    if ((0 != (ret = daos_init())) && (ret != -DER_ALREADY))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "DAOS failed to initialize: %s",
+                     H5_daos_err_to_string(ret));
 
-            key_mem_type_id = map_args->get_val.key_mem_type_id;
-            val_mem_type_id = map_args->get_val.value_mem_type_id;
-            value           = map_args->get_val.value;
+#ifdef DV_TRACK_MEM_USAGE
+    /* Initialize allocated memory counter */
+    daos_vol_curr_alloc_bytes = 0;
+#endif
 
-            /* Pass the call */
-            if ((ret_value = H5_daos_map_get_val(item, key_mem_type_id, map_args->get_val.key,
-                                                 val_mem_type_id, value, dxpl_id, req)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_READERROR, ret_value, "can't get value");
+    /* Determine if bypassing of the DUNS has been requested */
+    if (NULL != getenv("HDF5_DAOS_BYPASS_DUNS"))
+        H5_daos_bypass_duns_g = TRUE;
 
-            break;
-        } /* end block */
+    /* Determine automatic chunking target size */
+    if (NULL != (auto_chunk_str = getenv("HDF5_DAOS_CHUNK_TARGET_SIZE"))) {
+        long long chunk_target_size_ll;
 
-        /* H5Mexists */
-        case H5VL_MAP_EXISTS: {
-            H5VL_map_args_t *map_args        = (H5VL_map_args_t *)opt_args->args;
-            hid_t            key_mem_type_id = H5I_INVALID_HID;
-            hbool_t         *exists          = NULL;
+        errno = 0;
+        if ((chunk_target_size_ll = strtoll(auto_chunk_str, NULL, 10)) < 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse automatic chunking target size from environment or invalid value "
+                         "(H5_DAOS_CHUNK_TARGET_SIZE)");
+        H5_daos_chunk_target_size_g = (uint64_t)chunk_target_size_ll;
+    } /* end if */
 
-            /* Check operation arguments pointer.  All other arguments will
-             * be checked by H5_daos_map_exists. */
-            if (!map_args)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    /* Determine in-flight budgets for small and bulk raw data I/O */
+    if (NULL != (budget_str = getenv("HDF5_DAOS_SMALL_IO_BUDGET"))) {
+        long long budget_ll;
 
-            key_mem_type_id = map_args->exists.key_mem_type_id;
-            exists          = &map_args->exists.exists;
+        errno = 0;
+        if ((budget_ll = strtoll(budget_str, NULL, 10)) < 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse small I/O budget from environment or invalid value "
+                         "(HDF5_DAOS_SMALL_IO_BUDGET)");
+        H5_daos_io_budget_g[H5_DAOS_IO_CLASS_SMALL].budget = (size_t)budget_ll;
+    } /* end if */
+    if (NULL != (budget_str = getenv("HDF5_DAOS_BULK_IO_BUDGET"))) {
+        long long budget_ll;
 
-            /* Pass the call */
-            if ((ret_value = H5_daos_map_exists(item, key_mem_type_id, map_args->exists.key, exists, dxpl_id,
-                                                req)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_READERROR, ret_value, "can't check if value exists");
+        errno = 0;
+        if ((budget_ll = strtoll(budget_str, NULL, 10)) < 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse bulk I/O budget from environment or invalid value "
+                         "(HDF5_DAOS_BULK_IO_BUDGET)");
+        H5_daos_io_budget_g[H5_DAOS_IO_CLASS_BULK].budget = (size_t)budget_ll;
+    } /* end if */
 
-            break;
-        } /* end block */
+    /* Initialize global scheduler */
+    if (0 != (ret = tse_sched_init(&H5_daos_glob_sched_g, NULL, NULL)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create global task scheduler: %s",
+                     H5_daos_err_to_string(ret));
 
-        /* H5Mput */
-        case H5VL_MAP_PUT: {
-            H5VL_map_args_t *map_args        = (H5VL_map_args_t *)opt_args->args;
-            hid_t            key_mem_type_id = H5I_INVALID_HID;
-            hid_t            val_mem_type_id = H5I_INVALID_HID;
+    /* Create global DAOS task list */
+    if (H5_daos_task_list_create(&H5_daos_task_list_g) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create DAOS task list");
 
-            /* Check operation arguments pointer.  All other arguments will
-             * be checked by H5_daos_map_put. */
-            if (!map_args)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    /* Setup HDF5 default property list cache */
+    if (H5_daos_fill_def_plist_cache() < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't populate HDF5 default property list cache");
 
-            key_mem_type_id = map_args->put.key_mem_type_id;
-            val_mem_type_id = map_args->put.value_mem_type_id;
+    /* Initialized */
+    H5_daos_initialized_g = TRUE;
 
-            /* Pass the call */
-            if ((ret_value = H5_daos_map_put(item, key_mem_type_id, map_args->put.key, val_mem_type_id,
-                                             map_args->put.value, dxpl_id, req)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, ret_value, "can't put value");
+    /* Start background progress thread if requested.  This must be done last
+     * since the thread drives the global scheduler and task list. */
+    if (NULL != getenv("HDF5_DAOS_PROGRESS_THREAD"))
+        if (H5_daos_progress_thread_start() < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't start background progress thread");
 
-            break;
-        } /* end block */
+done:
+    if (ret_value < 0) {
+        H5_daos_term();
+    } /* end if */
 
-        /* Operations that get misc info from the map */
-        case H5VL_MAP_GET: {
-            H5VL_map_args_t *map_args = (H5VL_map_args_t *)opt_args->args;
+    D_FUNC_LEAVE;
+} /* end H5_daos_init() */
 
-            /* Check operation arguments pointer.  All other arguments will
-             * be checked by H5_daos_map_get. */
-            if (!map_args)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+/*---------------------------------------------------------------------------
+ * Function:    H5_daos_term
+ *
+ * Purpose:     Shut down the DAOS VOL
+ *
+ * Returns:     Non-negative on success/Negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_term(void)
+{
+    int    i;
+    herr_t ret_value = SUCCEED;
 
-            /* Pass the call */
-            if ((ret_value = H5_daos_map_get(item, map_args, dxpl_id, req)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, ret_value, "can't perform map get operation");
+    /**
+     * H5_DAOS_g is only set if the connector is manually initialized,
+     * therefore we must check for proper DAOS initialization.
+     */
+    if (!H5_daos_initialized_g)
+        D_GOTO_DONE(ret_value);
 
-            break;
-        } /* end block */
+    /* Stop background progress thread before freeing anything it uses */
+    if (H5_daos_progress_thread_on_g)
+        H5_daos_progress_thread_stop();
 
-        /* Specific operations (H5Miterate and H5Mdelete) */
-        case H5VL_MAP_SPECIFIC: {
-            H5VL_map_args_t *map_args = (H5VL_map_args_t *)opt_args->args;
+    /* Release global op pool */
+    if (H5_daos_glob_cur_op_pool_g)
+        H5_daos_op_pool_free(H5_daos_glob_cur_op_pool_g);
 
-            /* Check operation arguments pointer.  All other arguments will
-             * be checked by H5_daos_map_specific. */
-            if (!map_args)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    /* Free global DAOS task list */
+    if (H5_daos_task_list_g) {
+        H5_daos_task_list_free(H5_daos_task_list_g);
+        H5_daos_task_list_g = NULL;
+    }
 
-            /* Pass the call */
-            if ((ret_value = H5_daos_map_specific(item, map_args, dxpl_id, req)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret_value, "can't perform specific map operation");
+    /* Close global scheduler */
+    if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_WAIT) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress scheduler");
+    tse_sched_fini(&H5_daos_glob_sched_g);
 
-            break;
-        } /* end block */
+    /* Free I/O budget gate queues */
+    for (i = 0; i < H5_DAOS_IO_CLASS_NCLASSES; i++) {
+        assert(H5_daos_io_budget_g[i].ngates == 0);
+        H5_daos_io_budget_g[i].gates      = DV_free(H5_daos_io_budget_g[i].gates);
+        H5_daos_io_budget_g[i].nin_flight = 0;
+        H5_daos_io_budget_g[i].head       = 0;
+        H5_daos_io_budget_g[i].nalloc     = 0;
+    } /* end for */
+
+    /* Release blocks cached on free lists */
+    H5_daos_free_list_term();
+
+    /* Free MPI request table */
+    assert(H5_daos_mpi_req_table_g.nreqs == 0);
+    H5_daos_mpi_req_table_g.infos   = DV_free(H5_daos_mpi_req_table_g.infos);
+    H5_daos_mpi_req_table_g.reqs    = DV_free(H5_daos_mpi_req_table_g.reqs);
+    H5_daos_mpi_req_table_g.indices = DV_free(H5_daos_mpi_req_table_g.indices);
+    H5_daos_mpi_req_table_g.nalloc  = 0;
 
-        /* H5Mclose */
-        case H5VL_MAP_CLOSE: {
-            /* Pass the call */
-            if ((ret_value = H5_daos_map_close(item, dxpl_id, req)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CLOSEERROR, ret_value, "can't close map object");
+    /* Terminate DAOS */
+    if (daos_fini() < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "DAOS failed to terminate");
 
-            break;
-        } /* end block */
+#ifdef DV_HAVE_SNAP_OPEN_ID
+    /* Unregister the DAOS SNAP_OPEN_ID property from HDF5 */
+    if (H5Punregister(H5P_FILE_ACCESS, H5_DAOS_SNAP_OPEN_ID) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't unregister DAOS SNAP_OPEN_ID property");
+#endif
 
-        default:
-            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid or unsupported optional operation");
-    } /* end switch */
+    /* Free default property list cache */
+    DV_free((void *)H5_daos_plist_cache_g);
 
-done:
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_optional() */
+    /* "Forget" connector id.  This should normally be called by the library
+     * when it is closing the id, so no need to close it here. */
+    H5_DAOS_g = H5I_INVALID_HID;
 
-/*-------------------------------------------------------------------------
- * Function:    H5_daos_oidx_generate
- *
- * Purpose:     Generates a unique 64 bit object index.  This index will be
- *              used as the lower 64 bits of a DAOS object ID. If
- *              necessary, this routine creates a task to allocate
- *              additional object indices for the given container before
- *              generating the object index that is returned.
- *
- * Return:      Success:    0
- *              Failure:    -1
- *
- *-------------------------------------------------------------------------
- */
-herr_t
-H5_daos_oidx_generate(uint64_t *oidx, H5_daos_file_t *file, hbool_t collective, H5_daos_req_t *req,
-                      tse_task_t **first_task, tse_task_t **dep_task)
-{
-    H5_daos_oidx_generate_ud_t *generate_udata = NULL;
-    tse_task_t                 *generate_task  = NULL;
-    uint64_t                   *next_oidx      = collective ? &file->next_oidx_collective : &file->next_oidx;
-    uint64_t                   *max_oidx       = collective ? &file->max_oidx_collective : &file->max_oidx;
-    int                         ret;
-    herr_t                      ret_value = SUCCEED;
+    /* No longer initialized */
+    H5_daos_initialized_g = FALSE;
 
-    assert(file);
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
+done:
+#ifdef DV_TRACK_MEM_USAGE
+    /* Check for allocated memory */
+    if (0 != daos_vol_curr_alloc_bytes)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "%zu bytes were still left allocated",
+                     daos_vol_curr_alloc_bytes)
 
-    /* Allocate more object indices for this process if necessary */
-    if ((*max_oidx == 0) || (*next_oidx > *max_oidx)) {
-        /* Check if this process should allocate object IDs or just wait for the
-         * result from the leader process */
-        if (!collective || (file->my_rank == 0)) {
-            /* Set private data for OIDX generation task */
-            if (NULL == (generate_udata =
-                             (H5_daos_oidx_generate_ud_t *)DV_malloc(sizeof(H5_daos_oidx_generate_ud_t))))
-                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                             "can't allocate user data struct for OIDX generation task");
-            generate_udata->generic_ud.req       = req;
-            generate_udata->generic_ud.task_name = "OIDX generation";
-            generate_udata->file                 = file;
-            generate_udata->collective           = collective;
-            generate_udata->oidx_out             = oidx;
-            generate_udata->next_oidx            = next_oidx;
-            generate_udata->max_oidx             = max_oidx;
+    daos_vol_curr_alloc_bytes = 0;
+#endif
 
-            /* Create task to allocate oidxs */
-            if (H5_daos_create_daos_task(DAOS_OPC_CONT_ALLOC_OIDS, *dep_task ? 1 : 0,
-                                         *dep_task ? dep_task : NULL, H5_daos_oidx_generate_prep_cb,
-                                         H5_daos_oidx_generate_comp_cb, generate_udata, &generate_task) < 0)
-                D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to generate OIDXs");
+    /* Unregister from the HDF5 error API */
+    if (dv_err_class_g >= 0) {
+        if (dv_obj_err_maj_g >= 0 && H5Eclose_msg(dv_obj_err_maj_g) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL,
+                         "can't unregister error message for object interface");
+        if (dv_async_err_g >= 0 && H5Eclose_msg(dv_async_err_g) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL,
+                         "can't unregister error message for asynchronous interface");
 
-            /* Schedule OIDX generation task (or save it to be scheduled later) and give it
-             * a reference to req */
-            if (*first_task) {
-                if (0 != (ret = tse_task_schedule(generate_task, false)))
-                    D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to generate OIDXs: %s",
-                                 H5_daos_err_to_string(ret));
-            }
-            else
-                *first_task = generate_task;
-            req->rc++;
-            file->item.rc++;
+        if (H5Eunregister_class(dv_err_class_g) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't unregister error class from HDF5 error API");
 
-            /* Relinquish control of the OIDX generation udata to the
-             * task's completion callback */
-            generate_udata = NULL;
+        /* Print the current error stack before destroying it */
+        PRINT_ERROR_STACK;
 
-            *dep_task = generate_task;
+        /* Destroy the error stack */
+        if (H5Eclose_stack(dv_err_stack_g) < 0) {
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't close HDF5 error stack");
+            PRINT_ERROR_STACK;
         } /* end if */
 
-        /* Broadcast next_oidx if there are other processes that need it */
-        if (collective && (file->num_procs > 1) &&
-            H5_daos_oidx_bcast(file, oidx, req, first_task, dep_task) < 0)
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't broadcast next object index");
+        dv_err_stack_g   = H5I_INVALID_HID;
+        dv_err_class_g   = H5I_INVALID_HID;
+        dv_obj_err_maj_g = H5I_INVALID_HID;
+        dv_async_err_g   = H5I_INVALID_HID;
     } /* end if */
-    else {
-        /* Allocate oidx from local allocation */
-        H5_DAOS_ALLOCATE_NEXT_OIDX(oidx, next_oidx, max_oidx);
-    }
-
-done:
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        generate_udata = DV_free(generate_udata);
-    }
-
-    /* Make sure we cleaned up */
-    assert(!generate_udata);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_oidx_generate() */
+} /* end H5_daos_term() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oidx_generate_prep_cb
- *
- * Purpose:     Prepare callback for DAOS OIDX generation task.
+ * Function:    H5_daos_progress_thread_start
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Purpose:     Starts the background progress thread, which drives the
+ *              global scheduler and in-flight MPI operations while the
+ *              application is outside of the connector.  Requires a
+ *              thread-safe build of HDF5, and MPI_THREAD_MULTIPLE if MPI
+ *              has already been initialized.
  *
- * Programmer:  Neil Fortner
- *              November, 2020
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_oidx_generate_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_progress_thread_start(void)
 {
-    H5_daos_oidx_generate_ud_t *udata;
-    daos_cont_alloc_oids_t     *alloc_args;
-    int                         ret_value = 0;
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for generic task");
+#ifdef H5_HAVE_THREADSAFE
+    int mpi_initialized;
+    int mpi_thread_level;
+    int ret;
+#endif
+    herr_t ret_value = SUCCEED;
 
-    assert(udata->generic_ud.req);
+    assert(!H5_daos_progress_thread_on_g);
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->generic_ud.req, H5E_VOL);
+#ifdef H5_HAVE_THREADSAFE
+    /* The progress thread issues MPI calls concurrently with the
+     * application */
+    if (MPI_SUCCESS != MPI_Initialized(&mpi_initialized))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't determine if MPI has been initialized");
+    if (mpi_initialized) {
+        if (MPI_SUCCESS != MPI_Query_thread(&mpi_thread_level))
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't query MPI thread support level");
+        if (mpi_thread_level != MPI_THREAD_MULTIPLE)
+            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL,
+                         "background progress thread requires MPI_THREAD_MULTIPLE");
+    } /* end if */
 
-    assert(udata->generic_ud.req->file);
-    assert(udata->generic_ud.req->file->item.open_req);
+    /* If we are currently inside a connector callback take the API mutex now,
+     * since H5_daos_inc_api_cnt() did not */
+    if (H5_daos_api_count > 0) {
+        if (0 != (ret = pthread_mutex_lock(&H5_daos_api_mutex_g)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTLOCK, FAIL, "can't lock API mutex: %s", strerror(ret));
+        H5_daos_api_locked = TRUE;
+    } /* end if */
 
-    /* Verify file was successfully opened */
-    if (udata->generic_ud.req->file->item.open_req->status != 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, -H5_DAOS_PREREQ_ERROR, "file open is incomplete");
+    /* Register the operation public routines enter the connector through
+     * while the thread is running */
+    if (H5VLregister_opt_operation(H5VL_SUBCLS_NONE, H5_DAOS_PUBLIC_CALL_OP_NAME,
+                                   &H5_daos_public_call_op_g) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTREGISTER, FAIL, "can't register public routine operation");
+
+    if (0 != (ret = pthread_mutex_init(&H5_daos_progress_thread_g.mutex, NULL)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize progress thread mutex: %s",
+                     strerror(ret));
+    if (0 != (ret = pthread_cond_init(&H5_daos_progress_thread_g.cond, NULL))) {
+        (void)pthread_mutex_destroy(&H5_daos_progress_thread_g.mutex);
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize progress thread condition: %s",
+                     strerror(ret));
+    } /* end if */
 
-    /* Set arguments for OIDX generation */
-    if (NULL == (alloc_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_FILE, H5E_CANTGET, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for OIDX generation task");
-    alloc_args->coh      = udata->generic_ud.req->file->coh;
-    alloc_args->num_oids = H5_DAOS_OIDX_NALLOC;
-    alloc_args->oid      = udata->next_oidx;
+    /* Start thread */
+    H5_daos_progress_thread_g.work = FALSE;
+    H5_daos_progress_thread_g.stop = FALSE;
+    H5_daos_progress_thread_on_g   = TRUE;
+    if (0 != (ret = pthread_create(&H5_daos_progress_thread_g.thread, NULL, H5_daos_progress_thread_func,
+                                   NULL))) {
+        H5_daos_progress_thread_on_g = FALSE;
+        (void)pthread_cond_destroy(&H5_daos_progress_thread_g.cond);
+        (void)pthread_mutex_destroy(&H5_daos_progress_thread_g.mutex);
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTCREATE, FAIL, "can't create progress thread: %s", strerror(ret));
+    } /* end if */
 
 done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
+    if (ret_value < 0 && H5_daos_public_call_op_g >= 0) {
+        (void)H5VLunregister_opt_operation(H5VL_SUBCLS_NONE, H5_DAOS_PUBLIC_CALL_OP_NAME);
+        H5_daos_public_call_op_g = -1;
+    } /* end if */
+    if (ret_value < 0 && H5_daos_api_locked) {
+        H5_daos_api_locked = FALSE;
+        (void)pthread_mutex_unlock(&H5_daos_api_mutex_g);
+    } /* end if */
+#else
+    D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL,
+                 "background progress thread requires a thread-safe build of HDF5");
 
+done:
+#endif
     D_FUNC_LEAVE;
-} /* end H5_daos_oidx_generate_prep_cb() */
+} /* end H5_daos_progress_thread_start() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oidx_generate_comp_cb
+ * Function:    H5_daos_progress_thread_stop
  *
- * Purpose:     Complete callback for the DAOS OIDX generation task. When
- *              H5_daos_oidx_generate is called independently, this
- *              callback is responsible for updating the current process'
- *              file's max_oidx and next_oidx fields and "allocating" the
- *              actually returned next oidx. When H5_daos_oidx_generate is
- *              called collectively, the completion callback for the
- *              ensuing oidx broadcast task will be responsible for these
- *              tasks instead.
+ * Purpose:     Signals the background progress thread to stop and waits
+ *              for it to exit.  Operations still in flight afterwards are
+ *              progressed by the application thread as usual.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      void
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_oidx_generate_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static void
+H5_daos_progress_thread_stop(void)
 {
-    H5_daos_oidx_generate_ud_t *udata;
-    uint64_t                   *next_oidx;
-    uint64_t                   *max_oidx;
-    int                         ret_value = 0;
+    assert(H5_daos_progress_thread_on_g);
+
+    /* Wake the thread and wait for it to exit */
+    (void)pthread_mutex_lock(&H5_daos_progress_thread_g.mutex);
+    H5_daos_progress_thread_g.stop = TRUE;
+    (void)pthread_cond_signal(&H5_daos_progress_thread_g.cond);
+    (void)pthread_mutex_unlock(&H5_daos_progress_thread_g.mutex);
+    (void)pthread_join(H5_daos_progress_thread_g.thread, NULL);
+
+    (void)pthread_cond_destroy(&H5_daos_progress_thread_g.cond);
+    (void)pthread_mutex_destroy(&H5_daos_progress_thread_g.mutex);
+
+    /* Public routines now run on the calling thread again */
+    (void)H5VLunregister_opt_operation(H5VL_SUBCLS_NONE, H5_DAOS_PUBLIC_CALL_OP_NAME);
+    H5_daos_public_call_op_g = -1;
+
+    /* Release the API mutex if we are inside a connector callback, since
+     * H5_daos_dec_api_cnt() will no longer do so */
+    H5_daos_progress_thread_on_g = FALSE;
+    if (H5_daos_api_locked) {
+        H5_daos_api_locked = FALSE;
+        (void)pthread_mutex_unlock(&H5_daos_api_mutex_g);
+    } /* end if */
 
-    assert(H5_daos_task_list_g);
+    return;
+} /* end H5_daos_progress_thread_stop() */
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for OIDX generation task");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_api_lock
+ *
+ * Purpose:     Called on entry to the outermost connector callback on
+ *              this thread while the background progress thread is
+ *              running.  Blocks on the API mutex, which keeps the
+ *              progress thread and all other application threads out of
+ *              the connector until H5_daos_api_unlock() is called.
+ *
+ *              The caller already holds the HDF5 library lock: connector
+ *              callbacks are called through HDF5, and public H5daos
+ *              routines that need this lock enter through HDF5 with
+ *              H5_daos_public_call().  Every thread therefore takes the
+ *              two locks in the same order, and a thread holding the API
+ *              mutex can call into HDF5.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_api_lock(void)
+{
+    assert(!H5_daos_api_locked);
 
-    assert(udata->file);
+    (void)pthread_mutex_lock(&H5_daos_api_mutex_g);
+    H5_daos_api_locked = TRUE;
 
-    /* Handle errors in OIDX generation task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->generic_ud.req->status      = task->dt_result;
-        udata->generic_ud.req->failed_task = udata->generic_ud.task_name;
+    return;
+} /* end H5_daos_api_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_api_unlock
+ *
+ * Purpose:     Called on exit from the outermost connector callback on
+ *              this thread.  Releases the API mutex and wakes the
+ *              background progress thread, since the callback may have
+ *              left operations in flight.  The HDF5 library lock is
+ *              released by HDF5 when the callback returns, one level at
+ *              a time, so levels held by the caller are kept.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_api_unlock(void)
+{
+    assert(H5_daos_api_locked);
+
+    H5_daos_api_locked = FALSE;
+    (void)pthread_mutex_unlock(&H5_daos_api_mutex_g);
+
+    /* Wake the progress thread */
+    if (H5_daos_progress_thread_on_g) {
+        (void)pthread_mutex_lock(&H5_daos_progress_thread_g.mutex);
+        H5_daos_progress_thread_g.work = TRUE;
+        (void)pthread_cond_signal(&H5_daos_progress_thread_g.cond);
+        (void)pthread_mutex_unlock(&H5_daos_progress_thread_g.mutex);
     } /* end if */
-    else if (task->dt_result == 0) {
-        next_oidx = udata->next_oidx;
-        max_oidx  = udata->max_oidx;
 
-        /* If H5_daos_oidx_generate was called independently, it is
-         * safe to update the file's max and next OIDX fields and
-         * allocate the next OIDX. Otherwise, this must be delayed
-         * until after the next OIDX value has been broadcasted to
-         * the other ranks.
-         */
-        if (!udata->collective || (udata->generic_ud.req->file->num_procs == 1)) {
-            /* Adjust the max and next OIDX values for the file on this process */
-            H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx, max_oidx);
+    return;
+} /* end H5_daos_api_unlock() */
 
-            /* Allocate oidx from local allocation */
-            H5_DAOS_ALLOCATE_NEXT_OIDX(udata->oidx_out, next_oidx, max_oidx);
-        }
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_public_call
+ *
+ * Purpose:     Runs op, the body of a public H5daos routine that uses the
+ *              scheduler or other shared connector state, as a top-level
+ *              connector routine.
+ *
+ *              While the background progress thread is running, and this
+ *              thread is not already inside the connector, op is run
+ *              from H5_daos_optional() through H5VLoptional().  HDF5
+ *              blocks until it can take its library lock, then the
+ *              connector blocks on the API mutex, in the same order as
+ *              for any other connector callback.  HDF5 takes and
+ *              releases a single level of its lock, so a caller that
+ *              already holds it, such as an HDF5 callback, keeps it.
+ *              Otherwise op is run directly.
+ *
+ * Return:      The value returned by op/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_public_call(H5_daos_public_op_t op, void *op_args)
+{
+    H5_daos_public_call_t call;
+    H5VL_optional_args_t  opt_args;
+    herr_t                ret_value = SUCCEED;
+
+    assert(op);
+
+    if (H5_daos_progress_thread_on_g && H5_daos_api_count == 0) {
+        assert(H5_daos_public_call_op_g >= 0);
+
+        call.op          = op;
+        call.op_args     = op_args;
+        call.op_ret      = FAIL;
+        opt_args.op_type = H5_daos_public_call_op_g;
+        opt_args.args    = &call;
+
+        /* Errors are reported by H5VLoptional() and H5_daos_optional() */
+        if (H5VLoptional(&call, H5_DAOS_g, &opt_args, H5P_DATASET_XFER_DEFAULT, NULL) < 0)
+            return FAIL;
+
+        return call.op_ret;
     } /* end if */
 
-done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    H5_daos_inc_api_cnt();
 
-    if (udata) {
-        /* Release our reference on the file */
-        if (H5_daos_file_close_helper(udata->file) < 0)
-            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
+    ret_value = op(op_args);
 
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->generic_ud.req->status      = ret_value;
-            udata->generic_ud.req->failed_task = udata->generic_ud.task_name;
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_public_call() */
+
+#ifdef H5_HAVE_THREADSAFE
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_progress_thread_func
+ *
+ * Purpose:     Body of the background progress thread.  While operations
+ *              are in flight, kicks the global scheduler and the MPI
+ *              request table, then makes "unsafe" task list tasks
+ *              available, as is done when leaving a top-level connector
+ *              callback.  Attempts start
+ *              H5_DAOS_PROGRESS_THREAD_INTERVAL microseconds apart and
+ *              back off to H5_DAOS_PROGRESS_THREAD_MAX_INTERVAL while
+ *              nothing completes.  Once nothing is in flight the thread
+ *              blocks until an application thread leaves the connector.
+ *
+ *              The thread only makes progress while it holds both the
+ *              HDF5 library lock and the connector's API mutex, so no
+ *              application thread is inside HDF5 or the connector and
+ *              the scheduler, task list and op pools are never touched
+ *              concurrently.  Neither lock is waited on, so the thread
+ *              can never deadlock with an application thread that
+ *              enters the connector through HDF5; it simply tries again
+ *              at the next interval.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5_daos_progress_thread_func(void H5VL_DAOS_UNUSED *arg)
+{
+    struct timespec wake;
+    long            interval = H5_DAOS_PROGRESS_THREAD_INTERVAL;
+    unsigned        lock_count;
+    hbool_t         acquired;
+    hbool_t         busy = TRUE;
+    bool            is_empty;
+
+    (void)pthread_mutex_lock(&H5_daos_progress_thread_g.mutex);
+    while (!H5_daos_progress_thread_g.stop) {
+        /* An application thread left the connector: start over at the
+         * shortest interval */
+        if (H5_daos_progress_thread_g.work) {
+            H5_daos_progress_thread_g.work = FALSE;
+            busy                           = TRUE;
+            interval                       = H5_DAOS_PROGRESS_THREAD_INTERVAL;
         } /* end if */
+        (void)pthread_mutex_unlock(&H5_daos_progress_thread_g.mutex);
+
+        /* Try to take over the connector from the application */
+        if (busy && H5TSmutex_acquire(1, &acquired) >= 0 && acquired) {
+            if (0 == pthread_mutex_trylock(&H5_daos_api_mutex_g)) {
+                /* Act as a top-level connector callback while making
+                 * progress, so any callbacks reentered from tasks see
+                 * themselves as nested and do not take the API mutex */
+                assert(H5_daos_api_count == 0);
+                H5_daos_api_count++;
+
+                /* Make progress without blocking.  Errors are reported by
+                 * the operations' own requests. */
+                (void)H5_daos_mpi_req_table_progress();
+                is_empty = FALSE;
+                (void)daos_progress(&H5_daos_glob_sched_g, 0, &is_empty);
+                if (H5_daos_task_list_g)
+                    H5_daos_task_list_safe(H5_daos_task_list_g);
+                PRINT_ERROR_STACK;
+
+                /* Stop polling once nothing is left in flight */
+                busy = !is_empty || H5_daos_mpi_req_table_g.nreqs > 0;
+
+                H5_daos_api_count--;
+
+                (void)pthread_mutex_unlock(&H5_daos_api_mutex_g);
+            } /* end if */
 
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->generic_ud.req) < 0)
-            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+            (void)H5TSmutex_release(&lock_count);
+        } /* end if */
 
-        /* Free private data */
-        DV_free(udata);
-    } /* end if */
+        (void)pthread_mutex_lock(&H5_daos_progress_thread_g.mutex);
+        if (H5_daos_progress_thread_g.stop || H5_daos_progress_thread_g.work)
+            continue;
+
+        if (busy) {
+            /* Sleep until the next interval, backing off while operations
+             * remain in flight */
+            (void)clock_gettime(CLOCK_REALTIME, &wake);
+            wake.tv_nsec += interval * 1000;
+            wake.tv_sec += wake.tv_nsec / 1000000000;
+            wake.tv_nsec %= 1000000000;
+            (void)pthread_cond_timedwait(&H5_daos_progress_thread_g.cond, &H5_daos_progress_thread_g.mutex,
+                                         &wake);
+            if (interval < H5_DAOS_PROGRESS_THREAD_MAX_INTERVAL)
+                interval *= 2;
+        } /* end if */
+        else
+            /* Nothing in flight, block until an application thread leaves
+             * the connector or we are told to stop */
+            (void)pthread_cond_wait(&H5_daos_progress_thread_g.cond, &H5_daos_progress_thread_g.mutex);
+    } /* end while */
+    (void)pthread_mutex_unlock(&H5_daos_progress_thread_g.mutex);
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_oidx_generate_comp_cb() */
+    return NULL;
+} /* end H5_daos_progress_thread_func() */
+#endif /* H5_HAVE_THREADSAFE */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oidx_bcast
+ * Function:    H5_daos_fill_def_plist_cache
  *
- * Purpose:     Creates an asynchronous task for broadcasting the next OIDX
- *              value after rank 0 has allocated more from DAOS.
+ * Purpose:     Sets up a global cache of the default values for several
+ *              properties of HDF5's default property lists. This can avoid
+ *              some overhead from H5P calls when default property lists
+ *              are used.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_oidx_bcast(H5_daos_file_t *file, uint64_t *oidx_out, H5_daos_req_t *req, tse_task_t **first_task,
-                   tse_task_t **dep_task)
+H5_daos_fill_def_plist_cache(void)
 {
-    H5_daos_oidx_bcast_ud_t *oidx_bcast_udata = NULL;
-    tse_task_t              *bcast_task       = NULL;
-    int                      ret;
-    herr_t                   ret_value = SUCCEED;
+    H5_daos_plist_cache_t *cache_ptr = NULL;
+    herr_t                 ret_value = SUCCEED;
 
-    assert(file);
-    assert(oidx_out);
+    if (NULL == (cache_ptr = DV_malloc(sizeof(H5_daos_plist_cache_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate property list cache");
+
+    /* GCPL cache */
+    if (H5Pget_link_creation_order(H5P_GROUP_CREATE_DEFAULT, &cache_ptr->gcpl_cache.link_corder_flags) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get default link creation order flags");
+    if (H5Pget_attr_creation_order(H5P_GROUP_CREATE_DEFAULT, &cache_ptr->gcpl_cache.acorder_flags) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
+                     "can't get default attribute creation order flags for groups");
+
+    /* DCPL cache */
+    if ((cache_ptr->dcpl_cache.layout = H5Pget_layout(H5P_DATASET_CREATE_DEFAULT)) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get default dataset layout property");
+    if (H5Pfill_value_defined(H5P_DATASET_CREATE_DEFAULT, &cache_ptr->dcpl_cache.fill_status) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get default dataset fill value status");
+    if (H5Pget_fill_time(H5P_DATASET_CREATE_DEFAULT, &cache_ptr->dcpl_cache.fill_time) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get default dataset fill time");
+    if (H5Pget_attr_creation_order(H5P_DATASET_CREATE_DEFAULT, &cache_ptr->dcpl_cache.acorder_flags) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
+                     "can't get default attribute creation order flags for datasets");
+
+    /* TCPL cache */
+    if (H5Pget_attr_creation_order(H5P_DATATYPE_CREATE_DEFAULT, &cache_ptr->tcpl_cache.acorder_flags) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
+                     "can't get default attribute creation order flags for committed datatypes");
+
+    /* MCPL cache */
+    if (H5Pget_attr_creation_order(H5P_MAP_CREATE_DEFAULT, &cache_ptr->mcpl_cache.acorder_flags) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
+                     "can't get default attribute creation order flags for maps");
+
+    /* MAPL cache */
+    if (H5Pget_map_iterate_hints(H5P_MAP_ACCESS_DEFAULT, &cache_ptr->mapl_cache.dkey_prefetch_size,
+                                 &cache_ptr->mapl_cache.dkey_alloc_size) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map iterate hints");
+
+    /* LCPL cache */
+    if (H5Pget_create_intermediate_group(H5P_LINK_CREATE_DEFAULT, &cache_ptr->lcpl_cache.crt_intermed_grp) <
+        0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL,
+                     "can't get default intermediate group creation property value");
+
+    /* OcopyPL cache */
+    if (H5Pget_copy_object(H5P_OBJECT_COPY_DEFAULT, &cache_ptr->ocpypl_cache.obj_copy_options) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "failed to retrieve default object copy options");
+
+    H5_daos_plist_cache_g = cache_ptr;
+
+done:
+    if (ret_value < 0 && cache_ptr)
+        DV_free(cache_ptr);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_fill_def_plist_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_pool_connect
+ *
+ * Purpose:     Creates an asynchronous task for connecting to the
+ *              specified pool.
+ *
+ *              DSINC - This routine should eventually be modified to serve
+ *                      pool handles from a cache of open handles so that
+ *                      we don't re-connect to pools which are already
+ *                      connected to when doing multiple file creates/opens
+ *                      within the same pool.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_pool_connect(H5_daos_acc_params_t *pool_acc_params, unsigned int flags, daos_handle_t *poh_out,
+                     daos_pool_info_t *pool_info_out, H5_daos_req_t *req, tse_task_t **first_task,
+                     tse_task_t **dep_task)
+{
+    H5_daos_pool_connect_ud_t *connect_udata = NULL;
+    tse_task_t                *connect_task  = NULL;
+    int                        ret;
+    herr_t                     ret_value = SUCCEED;
+
+    assert(pool_acc_params);
+    assert(pool_acc_params->pool);
+    assert(poh_out);
     assert(req);
     assert(first_task);
     assert(dep_task);
 
-    /* Set up broadcast user data */
-    if (NULL == (oidx_bcast_udata = (H5_daos_oidx_bcast_ud_t *)DV_malloc(sizeof(H5_daos_oidx_bcast_ud_t))))
+    if (NULL == (connect_udata = (H5_daos_pool_connect_ud_t *)DV_malloc(sizeof(H5_daos_pool_connect_ud_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "failed to allocate buffer for MPI broadcast user data");
-    oidx_bcast_udata->bcast_udata.req            = req;
-    oidx_bcast_udata->bcast_udata.obj            = NULL;
-    oidx_bcast_udata->bcast_udata.bcast_metatask = NULL;
-    oidx_bcast_udata->bcast_udata.buffer         = oidx_bcast_udata->next_oidx_buf;
-    oidx_bcast_udata->bcast_udata.buffer_len     = H5_DAOS_ENCODED_UINT64_T_SIZE;
-    oidx_bcast_udata->bcast_udata.count          = H5_DAOS_ENCODED_UINT64_T_SIZE;
-    oidx_bcast_udata->bcast_udata.comm           = req->file->comm;
-    oidx_bcast_udata->file                       = file;
-    oidx_bcast_udata->oidx_out                   = oidx_out;
-    oidx_bcast_udata->next_oidx                  = &file->next_oidx_collective;
-    oidx_bcast_udata->max_oidx                   = &file->max_oidx_collective;
+                     "can't allocate user data struct for pool connect task");
+    connect_udata->req   = req;
+    connect_udata->pool  = pool_acc_params->pool;
+    connect_udata->poh   = poh_out;
+    connect_udata->sys   = pool_acc_params->sys;
+    connect_udata->flags = flags;
+    connect_udata->info  = pool_info_out;
 
-    /* Create task for broadcast */
-    if (H5_daos_create_task(H5_daos_mpi_ibcast_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                            (file->my_rank == 0) ? H5_daos_oidx_bcast_prep_cb : NULL,
-                            H5_daos_oidx_bcast_comp_cb, oidx_bcast_udata, &bcast_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to broadcast next object index");
+    /* Create task for pool connect */
+    if (H5_daos_create_daos_task(DAOS_OPC_POOL_CONNECT, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_pool_connect_prep_cb, H5_daos_pool_connect_comp_cb, connect_udata,
+                                 &connect_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to connect to DAOS pool");
 
-    /* Schedule OIDX broadcast task (or save it to be scheduled later) and give it
-     * a reference to req */
+    /* Schedule DAOS pool connect task (or save it to be scheduled later) and
+     * give it a reference to req */
     if (*first_task) {
-        if (0 != (ret = tse_task_schedule(bcast_task, false)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
-                         "can't schedule task to broadcast next object index: %s",
+        if (0 != (ret = tse_task_schedule(connect_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to connect to DAOS pool: %s",
                          H5_daos_err_to_string(ret));
-    }
+    } /* end if */
     else
-        *first_task = bcast_task;
+        *first_task = connect_task;
     req->rc++;
-    file->item.rc++;
 
-    /* Relinquish control of the OIDX broadcast udata to the
-     * task's completion callback */
-    oidx_bcast_udata = NULL;
+    /* Relinquish control of the pool connect udata to the
+     * task's function body */
+    connect_udata = NULL;
 
-    *dep_task = bcast_task;
+    *dep_task = connect_task;
 
 done:
     /* Cleanup on failure */
-    if (oidx_bcast_udata) {
-        assert(ret_value < 0);
-        oidx_bcast_udata = DV_free(oidx_bcast_udata);
+    if (ret_value < 0) {
+        connect_udata = DV_free(connect_udata);
     } /* end if */
 
+    assert(!connect_udata);
+
     D_FUNC_LEAVE;
-} /* end H5_daos_oidx_bcast() */
+} /* end H5_daos_pool_connect() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oidx_bcast_prep_cb
+ * Function:    H5_daos_pool_connect_prep_cb
  *
- * Purpose:     Prepare callback for asynchronous OIDX broadcasts.
- *              Currently checks for errors from previous tasks and then
- *              encodes the OIDX value into the broadcast buffer before
- *              sending. Meant only to be called by rank 0.
+ * Purpose:     Prepare callback for asynchronous daos_pool_connect.
+ *              Currently checks for errors from previous tasks then sets
+ *              arguments for daos_pool_connect.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2520,50 +2922,55 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_oidx_bcast_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_pool_connect_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_oidx_bcast_ud_t *udata;
-    uint8_t                 *p;
-    int                      ret_value = 0;
+    H5_daos_pool_connect_ud_t *udata;
+    daos_pool_connect_t       *connect_args;
+    int                        ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for object index broadcast task");
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for pool connect task");
 
-    assert(udata->bcast_udata.req);
-    assert(udata->bcast_udata.buffer);
-    assert(udata->next_oidx);
-    assert(H5_DAOS_ENCODED_UINT64_T_SIZE == udata->bcast_udata.buffer_len);
-    assert(H5_DAOS_ENCODED_UINT64_T_SIZE == udata->bcast_udata.count);
+    assert(udata->req);
+    assert(udata->pool);
 
-    /* Note that we do not handle errors from a previous task here.
-     * The broadcast must still proceed on all ranks even if a
-     * previous task has failed.
-     */
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
 
-    p = udata->bcast_udata.buffer;
-    UINT64ENCODE(p, *udata->next_oidx);
+    /* Ensure that DAOS pool is set */
+    if (!udata->pool || (0 == strlen(udata->pool)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_BAD_VALUE, "DAOS pool is not set");
+
+    /* Set daos_pool_connect task args */
+    if (NULL == (connect_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for pool connect task");
+    memset(connect_args, 0, sizeof(*connect_args));
+    connect_args->poh   = udata->poh;
+    connect_args->grp   = udata->sys;
+    connect_args->flags = udata->flags;
+    connect_args->info  = udata->info;
+#if CHECK_DAOS_API_VERSION(1, 4)
+    connect_args->pool = udata->pool;
+#else
+    if (uuid_parse(udata->pool, connect_args->uuid) < 0)
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "invalid pool uuid");
+#endif
 
 done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
     D_FUNC_LEAVE;
-} /* end H5_daos_oidx_bcast_prep_cb() */
+} /* end H5_daos_pool_connect_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oidx_bcast_comp_cb
- *
- * Purpose:     Complete callback for asynchronous OIDX broadcasts.
- *              Currently checks for a failed task, then performs the
- *              following in order:
- *
- *              - decodes the sent OIDX buffer on the ranks that are
- *                receiving it
- *              - adjusts the max OIDX and next OIDX fields in the file on
- *                all ranks
- *              - allocates the next OIDX value on all ranks
- *              - frees private data
+ * Function:    H5_daos_pool_connect_comp_cb
  *
- *              Meant to be called by all ranks.
+ * Purpose:     Completion callback for asynchronous daos_pool_connect.
+ *              Currently checks for a failed task then frees private data.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2571,842 +2978,2929 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_oidx_bcast_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_pool_connect_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_oidx_bcast_ud_t *udata;
-    uint64_t                *next_oidx;
-    uint64_t                *max_oidx;
-    int                      ret_value = 0;
+    H5_daos_pool_connect_ud_t *udata;
+    int                        ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for object index broadcast task");
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for DAOS pool connect task");
 
-    assert(udata->bcast_udata.req);
-    assert(udata->bcast_udata.buffer);
-    assert(udata->file);
-    assert(udata->oidx_out);
-    assert(udata->next_oidx);
-    assert(udata->max_oidx);
-    assert(H5_DAOS_ENCODED_UINT64_T_SIZE == udata->bcast_udata.buffer_len);
-    assert(H5_DAOS_ENCODED_UINT64_T_SIZE == udata->bcast_udata.count);
+    assert(udata->req);
 
-    /* Handle errors in OIDX broadcast task.  Only record error in
-     * udata->req_status if it does not already contain an error (it could
-     * contain an error if another task this task is not dependent on also
-     * failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->bcast_udata.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->bcast_udata.req->status      = task->dt_result;
-        udata->bcast_udata.req->failed_task = "MPI_Ibcast next object index";
+    /* Handle errors in daos_pool_connect task.  Only record error in udata->req_status
+     * if it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "DAOS pool connect";
     } /* end if */
     else if (task->dt_result == 0) {
-        next_oidx = udata->next_oidx;
-        max_oidx  = udata->max_oidx;
-
-        /* Decode sent OIDX on receiving ranks */
-        if (udata->bcast_udata.req->file->my_rank != 0) {
-            uint8_t *p = udata->bcast_udata.buffer;
-            UINT64DECODE(p, *next_oidx);
-        }
-
-        /* Adjust the max and next OIDX values for the file on this process */
-        H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx, max_oidx);
-
-        /* Allocate oidx from local allocation */
-        H5_DAOS_ALLOCATE_NEXT_OIDX(udata->oidx_out, next_oidx, max_oidx);
+        /* After connecting to a pool, check if the file object's container_poh
+         * field has been set yet. If not, make sure it gets updated with the
+         * handle of the pool that we just connected to. This will most often
+         * happen during file opens, where the file object's container_poh
+         * field is initially invalid.
+         */
+        if (udata->req->file && daos_handle_is_inval(udata->req->file->container_poh))
+            udata->req->file->container_poh = *udata->poh;
     } /* end else */
 
 done:
+    /* Free private data if we haven't released ownership */
     if (udata) {
-        /* Release our reference on the file */
-        if (H5_daos_file_close_helper(udata->file) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
-
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except
          * for H5_daos_req_free_int, which updates req->status if it sees an
          * error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->bcast_udata.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->bcast_udata.req->status      = ret_value;
-            udata->bcast_udata.req->failed_task = "MPI_Ibcast next object index completion callback";
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "DAOS pool connect completion callback";
         } /* end if */
 
         /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->bcast_udata.req) < 0)
+        if (H5_daos_req_free_int(udata->req) < 0)
             D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
+#if !defined(DAOS_API_VERSION_MAJOR) || DAOS_API_VERSION_MAJOR < 1
+        if (udata->svc)
+            d_rank_list_free(udata->svc);
+#endif
+
         /* Free private data */
         DV_free(udata);
-    }
+    } /* end if */
     else
-        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_oidx_bcast_comp_cb() */
+} /* end H5_daos_pool_connect_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oid_encode
+ * Function:    H5_daos_pool_disconnect
  *
- * Purpose:     Creates a DAOS OID given the object type and a 64 bit
- *              object index.  Note that `file` must have at least the
- *              default_object_class field set, but may be otherwise
- *              uninitialized.
+ * Purpose:     Creates an asynchronous task for disconnecting from the
+ *              specified pool.
  *
- * Return:      Success:    0
- *              Failure:    -1
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_oid_encode(daos_obj_id_t *oid, uint64_t oidx, H5I_type_t obj_type, hid_t crt_plist_id,
-                   const char *oclass_prop_name, H5_daos_file_t *file)
+H5_daos_pool_disconnect(daos_handle_t *poh, H5_daos_req_t *req, tse_task_t **first_task,
+                        tse_task_t **dep_task)
 {
-    daos_oclass_id_t object_class = OC_UNKNOWN;
-#if CHECK_DAOS_API_VERSION(2, 0)
-    enum daos_otype_t object_type;
-#else
-    daos_ofeat_t object_feats;
-#endif
-    herr_t ret_value = SUCCEED;
-
-    /* Initialize oid.lo to oidx */
-    oid->lo = oidx;
+    H5_daos_pool_disconnect_ud_t *disconnect_udata = NULL;
+    tse_task_t                   *disconnect_task  = NULL;
+    int                           ret;
+    herr_t                        ret_value = SUCCEED;
 
-    /* Set type bits in the upper 2 bits of the lower 32 of oid.hi (for
-     * simplicity so they're in the same location as in the compacted haddr_t
-     * form) */
-    if (obj_type == H5I_GROUP)
-        oid->hi = H5_DAOS_TYPE_GRP;
-    else if (obj_type == H5I_DATASET)
-        oid->hi = H5_DAOS_TYPE_DSET;
-    else if (obj_type == H5I_DATATYPE)
-        oid->hi = H5_DAOS_TYPE_DTYPE;
-    else {
-        assert(obj_type == H5I_MAP);
-        oid->hi = H5_DAOS_TYPE_MAP;
-    } /* end else */
+    assert(poh);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-    /* Set the object feature flags */
-    if (H5I_GROUP == obj_type)
-#if CHECK_DAOS_API_VERSION(2, 0)
-        object_type = DAOS_OT_MULTI_LEXICAL;
-    else
-        object_type = DAOS_OT_AKEY_LEXICAL;
-#else
-        object_feats = DAOS_OF_DKEY_LEXICAL | DAOS_OF_AKEY_LEXICAL;
-    else
-        object_feats = DAOS_OF_DKEY_HASHED | DAOS_OF_AKEY_LEXICAL;
-#endif
+    if (NULL ==
+        (disconnect_udata = (H5_daos_pool_disconnect_ud_t *)DV_malloc(sizeof(H5_daos_pool_disconnect_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate user data struct for pool disconnect task");
+    disconnect_udata->req = req;
+    disconnect_udata->poh = poh;
 
-    /* Check for object class set on crt_plist_id */
-    /* Note we do not copy the oclass_str in the property callbacks (there is no
-     * "get" callback, so this is more like an H5P_peek, and we do not need to
-     * free oclass_str as it points directly into the plist value */
-    if (crt_plist_id != H5P_DEFAULT) {
-        htri_t prop_exists;
+    /* Create task for pool disconnect */
+    if (H5_daos_create_daos_task(DAOS_OPC_POOL_DISCONNECT, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_pool_disconnect_prep_cb, H5_daos_pool_disconnect_comp_cb,
+                                 disconnect_udata, &disconnect_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to disconnect from DAOS pool");
 
-        if ((prop_exists = H5Pexist(crt_plist_id, oclass_prop_name)) < 0)
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object class property");
-        if (prop_exists) {
-            char *oclass_str = NULL;
+    /* Schedule DAOS pool disconnect task (or save it to be scheduled later) and
+     * give it a reference to req */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(disconnect_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to disconnect from DAOS pool: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = disconnect_task;
+    req->rc++;
 
-            if (H5Pget(crt_plist_id, oclass_prop_name, &oclass_str) < 0)
-                D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get object class");
-            if (oclass_str && (oclass_str[0] != '\0'))
-                if (OC_UNKNOWN == (object_class = (daos_oclass_id_t)daos_oclass_name2id(oclass_str)))
-                    D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "unknown object class");
-        } /* end if */
-    }     /* end if */
+    /* Relinquish control of the pool disconnect udata to the
+     * task's function body */
+    disconnect_udata = NULL;
 
-    /* Check for object class set on file if not set from plist */
-    if (object_class == OC_UNKNOWN)
-        object_class = file->fapl_cache.default_object_class;
+    *dep_task = disconnect_task;
 
-    /* Generate oid */
-    daos_oclass_hints_t hints = 0;
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0) {
+        disconnect_udata = DV_free(disconnect_udata);
+    } /* end if */
 
-    /** if user does not set default object class, use DAOS default, but set a large oclass for
-     * datasets, and small for other object types */
-    if (object_class == OC_UNKNOWN) {
-        if (obj_type == H5I_DATASET)
-            hints = DAOS_OCH_SHD_MAX;
-        else
-            hints = DAOS_OCH_SHD_DEF;
-    }
-#if CHECK_DAOS_API_VERSION(2, 0)
-    if (daos_obj_generate_oid(file->coh, oid, object_type, object_class, hints, 0) != 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "Can't set object class");
-#else
-    if (daos_obj_generate_oid(file->coh, oid, object_feats, object_class, hints, 0) != 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "Can't set object class");
-#endif
+    assert(!disconnect_udata);
 
-done:
     D_FUNC_LEAVE;
-} /* end H5_daos_oid_encode() */
+} /* end H5_daos_pool_disconnect() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oid_encode_task
+ * Function:    H5_daos_pool_disconnect_prep_cb
  *
- * Purpose:     Asynchronous task for calling H5_daos_oid_encode.
+ * Purpose:     Prepare callback for asynchronous daos_pool_disconnect.
+ *              Currently checks for errors from previous tasks then sets
+ *              arguments for daos_pool_disconnect.
  *
- * Return:      Non-negative on success/Negative on failure
+ * Return:      Success:        0
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_oid_encode_task(tse_task_t *task)
+H5_daos_pool_disconnect_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_oid_encode_ud_t *udata     = NULL;
-    int                      ret_value = 0;
+    H5_daos_pool_disconnect_ud_t *udata;
+    daos_pool_disconnect_t       *disconnect_args;
+    int                           ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for OID encoding task");
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for pool disconnect task");
 
     assert(udata->req);
-    assert(udata->oid_out);
+    assert(udata->poh);
 
-    /* Check for previous errors */
+    /* Handle errors */
     H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
 
-    if (H5_daos_oid_encode(udata->oid_out, udata->oidx, udata->obj_type, udata->crt_plist_id,
-                           udata->oclass_prop_name, udata->req->file) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTENCODE, -H5_DAOS_H5_ENCODE_ERROR, "can't encode object ID");
-
-done:
-    /* Free private data if we haven't released ownership */
-    if (udata) {
-        if (H5P_DEFAULT != udata->crt_plist_id)
-            if (H5Idec_ref(udata->crt_plist_id) < 0)
-                D_DONE_ERROR(H5E_PLIST, H5E_CANTDEC, -H5_DAOS_H5_CLOSE_ERROR,
-                             "can't decrement ref. count on creation plist");
-
-        /* Release our reference on the file */
-        if (H5_daos_file_close_helper(udata->file) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
-
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->req->status      = ret_value;
-            udata->req->failed_task = "OID encoding task";
-        } /* end if */
-
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-        /* Free private data */
-        DV_free(udata);
-    } /* end if */
-    else
-        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+    if (daos_handle_is_inval(*udata->poh))
+        D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "pool handle is invalid");
 
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    /* Set daos_pool_disconnect task args */
+    if (NULL == (disconnect_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for pool disconnect task");
+    disconnect_args->poh = *udata->poh;
 
-    /* Complete this task */
-    tse_task_complete(task, ret_value);
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_oid_encode_task() */
+} /* end H5_daos_pool_disconnect_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oid_generate
+ * Function:    H5_daos_pool_disconnect_comp_cb
  *
- * Purpose:     Generate a DAOS OID given the object type and file
+ * Purpose:     Completion callback for asynchronous daos_pool_disconnect.
+ *              Currently checks for a failed task then frees private data.
  *
- * Return:      Success:    0
- *              Failure:    -1
+ * Return:      Success:        0
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_oid_generate(daos_obj_id_t *oid, hbool_t oidx_set, uint64_t oidx, H5I_type_t obj_type,
-                     hid_t crt_plist_id, const char *oclass_prop_name, H5_daos_file_t *file,
-                     hbool_t collective, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+static int
+H5_daos_pool_disconnect_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_oid_encode_ud_t *encode_udata = NULL;
-    tse_task_t              *encode_task  = NULL;
-    int                      ret;
-    herr_t                   ret_value = SUCCEED;
-
-    assert(file);
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
-
-    /* Set up user data for OID encoding */
-    if (NULL == (encode_udata = (H5_daos_oid_encode_ud_t *)DV_malloc(sizeof(H5_daos_oid_encode_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "failed to allocate buffer for OID encoding user data");
-    encode_udata->req     = req;
-    encode_udata->oid_out = oid;
+    H5_daos_pool_disconnect_ud_t *udata;
+    int                           ret_value = 0;
 
-    if (oidx_set) {
-        encode_udata->oidx = oidx;
-    }
-    else {
-        /* Generate oidx */
-        if (H5_daos_oidx_generate(&encode_udata->oidx, file, collective, req, first_task, dep_task) < 0)
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't generate object index");
-    }
+    assert(H5_daos_task_list_g);
 
-    /* Create asynchronous task for OID encoding */
-    encode_udata->file             = file;
-    encode_udata->obj_type         = obj_type;
-    encode_udata->crt_plist_id     = crt_plist_id;
-    encode_udata->oclass_prop_name = oclass_prop_name;
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for DAOS pool disconnect task");
 
-    /* Create task to encode OID */
-    if (H5_daos_create_task(H5_daos_oid_encode_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
-                            NULL, encode_udata, &encode_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to encode OID");
+    assert(udata->req);
 
-    /* Schedule OID encoding task (or save it to be scheduled later) and give it
-     * a reference to req */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(encode_task, false)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to encode OID: %s",
-                         H5_daos_err_to_string(ret));
-    }
-    else
-        *first_task = encode_task;
-    req->rc++;
-    file->item.rc++;
+    /* Handle errors in daos_pool_disconnect task.  Only record error in udata->req_status
+     * if it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "DAOS pool disconnect";
+    } /* end if */
 
-    /* Relinquish control of the OID encoding udata to the task's completion callback */
-    encode_udata = NULL;
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-    if (H5P_DEFAULT != crt_plist_id)
-        if (H5Iinc_ref(crt_plist_id) < 0)
-            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINC, FAIL, "can't increment ref. count on creation plist");
+    /* Free private data if we haven't released ownership */
+    if (udata) {
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "DAOS pool disconnect completion callback";
+        } /* end if */
 
-    *dep_task = encode_task;
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-done:
-    encode_udata = DV_free(encode_udata);
+        /* Free private data */
+        DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_oid_generate() */
+} /* end H5_daos_pool_disconnect_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_oid_to_token
+ * Function:    H5_daos_faccess_info_copy
  *
- * Purpose:     Converts an OID to an object "token".
+ * Purpose:     Copies the DAOS-specific file access properties.
  *
- * Return:      Success:    0
- *              Failure:    -1
+ * Return:      Success:        Ptr to a new property list
+ *              Failure:        NULL
+ *
+ * Programmer:  Neil Fortner
+ *              October, 2016
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_oid_to_token(daos_obj_id_t oid, H5O_token_t *obj_token)
+static void *
+H5_daos_faccess_info_copy(const void *_old_fa)
 {
-    uint8_t *p;
-    herr_t   ret_value = SUCCEED;
+    const H5_daos_acc_params_t *old_fa    = (const H5_daos_acc_params_t *)_old_fa;
+    H5_daos_acc_params_t       *new_fa    = NULL;
+    void                       *ret_value = NULL;
 
-    assert(obj_token);
-    H5daos_compile_assert(H5_DAOS_ENCODED_OID_SIZE <= H5O_MAX_TOKEN_SIZE);
+    H5_daos_inc_api_cnt();
 
-    p = (uint8_t *)obj_token;
+    if (!_old_fa)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid fapl");
 
-    UINT64ENCODE(p, oid.lo);
-    UINT64ENCODE(p, oid.hi);
+    if (NULL == (new_fa = (H5_daos_acc_params_t *)DV_malloc(sizeof(H5_daos_acc_params_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_oid_to_token() */
+    /* Copy the general information */
+    memcpy(new_fa, old_fa, sizeof(H5_daos_acc_params_t));
+
+    ret_value = new_fa;
+
+done:
+    if (NULL == ret_value) {
+        /* cleanup */
+        if (new_fa && H5_daos_faccess_info_free(new_fa) < 0)
+            D_DONE_ERROR(H5E_PLIST, H5E_CANTFREE, NULL, "can't free fapl");
+    } /* end if */
+
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_faccess_info_copy() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_token_to_oid
+ * Function:    H5_daos_faccess_info_free
  *
- * Purpose:     Converts an object "token" to an OID.
+ * Purpose:     Frees the DAOS-specific file access properties.
  *
  * Return:      Success:    0
  *              Failure:    -1
  *
+ * Programmer:  Neil Fortner
+ *              October, 2016
+ *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_token_to_oid(const H5O_token_t *obj_token, daos_obj_id_t *oid)
+static herr_t
+H5_daos_faccess_info_free(void *_fa)
 {
-    const uint8_t *p;
-    herr_t         ret_value = SUCCEED;
+    H5_daos_acc_params_t *fa        = (H5_daos_acc_params_t *)_fa;
+    herr_t                ret_value = SUCCEED;
 
-    assert(obj_token);
-    assert(oid);
-    H5daos_compile_assert(H5_DAOS_ENCODED_OID_SIZE <= H5O_MAX_TOKEN_SIZE);
+    H5_daos_inc_api_cnt();
 
-    p = (const uint8_t *)obj_token;
+    if (!_fa)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid fapl");
 
-    UINT64DECODE(p, oid->lo);
-    UINT64DECODE(p, oid->hi);
+done:
+    /* free the struct */
+    DV_free(fa);
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_token_to_oid() */
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_faccess_info_free() */
 
-/*-------------------------------------------------------------------------
- * Function:    H5_daos_oid_to_type
+/*---------------------------------------------------------------------------
+ * Function:    H5_daos_get_conn_cls
  *
- * Purpose:     Retrieve the HDF5 object type from an OID
+ * Purpose:     Query the connector class.
  *
- * Return:      Success:    Object type
- *              Failure:    H5I_BADID
+ * Return:      Success:    0
+ *              Failure:    -1
  *
- *-------------------------------------------------------------------------
+ *---------------------------------------------------------------------------
  */
-H5I_type_t
-H5_daos_oid_to_type(daos_obj_id_t oid)
+static herr_t
+H5_daos_get_conn_cls(void *item, H5VL_get_conn_lvl_t H5VL_DAOS_UNUSED lvl, const H5VL_class_t **conn_cls)
 {
-    uint64_t type_bits;
+    herr_t ret_value = SUCCEED;
 
-    /* Retrieve type */
-    type_bits = oid.hi & H5_DAOS_TYPE_MASK;
-    if (type_bits == H5_DAOS_TYPE_GRP)
-        return (H5I_GROUP);
-    else if (type_bits == H5_DAOS_TYPE_DSET)
-        return (H5I_DATASET);
-    else if (type_bits == H5_DAOS_TYPE_DTYPE)
-        return (H5I_DATATYPE);
-    else if (type_bits == H5_DAOS_TYPE_MAP)
-        return (H5I_MAP);
-    else
-        return (H5I_BADID);
-} /* end H5_daos_oid_to_type() */
+    H5_daos_inc_api_cnt();
 
-/*-------------------------------------------------------------------------
- * Function:    H5_daos_mult128
+    if (!item)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "item parameter not supplied");
+    if (!conn_cls)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "conn_cls parameter not supplied");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Retrieve the DAOS VOL connector class */
+    *conn_cls = &H5_daos_g;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_get_conn_cls() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5_daos_get_cap_flags
  *
- * Purpose:     Multiply two 128 bit unsigned integers to yield a 128 bit
- *              unsigned integer
+ * Purpose:     Retrieves the capability flags for this VOL connector.
  *
- * Return:      void
+ * Return:      Non-negative on Success/Negative on failure
  *
- *-------------------------------------------------------------------------
+ *---------------------------------------------------------------------------
  */
-static void
-H5_daos_mult128(uint64_t x_lo, uint64_t x_hi, uint64_t y_lo, uint64_t y_hi, uint64_t *ans_lo,
-                uint64_t *ans_hi)
+static herr_t
+H5_daos_get_cap_flags(const void H5VL_DAOS_UNUSED *info,
+#if H5VL_VERSION >= 3
+                      uint64_t *cap_flags
+#else
+                      unsigned *cap_flags
+#endif
+)
 {
-    uint64_t xlyl;
-    uint64_t xlyh;
-    uint64_t xhyl;
-    uint64_t xhyh;
-    uint64_t temp;
+    herr_t ret_value = SUCCEED;
 
-    assert(ans_lo);
-    assert(ans_hi);
+    H5_daos_inc_api_cnt();
 
-    /*
-     * First calculate x_lo * y_lo
-     */
-    /* Compute 64 bit results of multiplication of each combination of high and
-     * low 32 bit sections of x_lo and y_lo */
-    xlyl = (x_lo & 0xffffffff) * (y_lo & 0xffffffff);
-    xlyh = (x_lo & 0xffffffff) * (y_lo >> 32);
-    xhyl = (x_lo >> 32) * (y_lo & 0xffffffff);
-    xhyh = (x_lo >> 32) * (y_lo >> 32);
-
-    /* Calculate lower 32 bits of the answer */
-    *ans_lo = xlyl & 0xffffffff;
-
-    /* Calculate second 32 bits of the answer. Use temp to keep a 64 bit result
-     * of the calculation for these 32 bits, to keep track of overflow past
-     * these 32 bits. */
-    temp = (xlyl >> 32) + (xlyh & 0xffffffff) + (xhyl & 0xffffffff);
-    *ans_lo += temp << 32;
-
-    /* Calculate third 32 bits of the answer, including overflowed result from
-     * the previous operation */
-    temp >>= 32;
-    temp += (xlyh >> 32) + (xhyl >> 32) + (xhyh & 0xffffffff);
-    *ans_hi = temp & 0xffffffff;
+    if (!cap_flags)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid cap_flags parameter");
 
-    /* Calculate highest 32 bits of the answer. No need to keep track of
-     * overflow because it has overflowed past the end of the 128 bit answer */
-    temp >>= 32;
-    temp += (xhyh >> 32);
-    *ans_hi += temp << 32;
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
-    /*
-     * Now add the results from multiplying x_lo * y_hi and x_hi * y_lo. No need
-     * to consider overflow here, and no need to consider x_hi * y_hi because
-     * those results would overflow past the end of the 128 bit answer.
-     */
-    *ans_hi += (x_lo * y_hi) + (x_hi * y_lo);
+    /* Set the flags from the connector's capability flags field */
+    *cap_flags = H5_daos_g.cap_flags;
 
-    return;
-} /* end H5_daos_mult128() */
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_get_cap_flags() */
 
-/*-------------------------------------------------------------------------
- * Function:    H5_daos_hash128
+/*---------------------------------------------------------------------------
+ * Function:    H5_daos_opt_query
  *
- * Purpose:     Hashes the string name to a 128 bit buffer (hash).
- *              Implementation of the FNV hash algorithm.
+ * Purpose:     Query if an optional operation is supported by this connector
  *
- * Return:      void
+ * Return:      Success:    0
+ *              Failure:    -1
  *
- *-------------------------------------------------------------------------
+ *---------------------------------------------------------------------------
  */
-void
-H5_daos_hash128(const char *name, void *hash)
+static herr_t
+H5_daos_opt_query(void *item, H5VL_subclass_t H5VL_DAOS_UNUSED cls, int opt_type,
+                  H5_DAOS_OPT_QUERY_OUT_TYPE *supported)
 {
-    const uint8_t *name_p = (const uint8_t *)name;
-    uint8_t       *hash_p = (uint8_t *)hash;
-    uint64_t       name_lo;
-    uint64_t       name_hi;
-    /* Initialize hash value in accordance with the FNV algorithm */
-    uint64_t hash_lo = 0x62b821756295c58d;
-    uint64_t hash_hi = 0x6c62272e07bb0142;
-    /* Initialize FNV prime number in accordance with the FNV algorithm */
-    const uint64_t fnv_prime_lo = 0x13b;
-    const uint64_t fnv_prime_hi = 0x1000000;
-    size_t         name_len_rem;
+    herr_t ret_value = SUCCEED;
 
-    assert(name);
-    assert(hash);
+    H5_daos_inc_api_cnt();
 
-    name_len_rem = strlen(name);
+    if (!item)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "\"item\" parameter not supplied");
+    if (!supported)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output parameter not supplied");
 
-    while (name_len_rem > 0) {
-        /* "Decode" lower 64 bits of this 128 bit section of the name, so the
-         * numberical value of the integer is the same on both little endian and
-         * big endian systems */
-        if (name_len_rem >= 8) {
-            UINT64DECODE(name_p, name_lo)
-            name_len_rem -= 8;
-        } /* end if */
-        else {
-            name_lo = 0;
-            UINT64DECODE_VAR(name_p, name_lo, name_len_rem)
-            name_len_rem = 0;
-        } /* end else */
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
-        /* "Decode" second 64 bits */
-        if (name_len_rem > 0) {
-            if (name_len_rem >= 8) {
-                UINT64DECODE(name_p, name_hi)
-                name_len_rem -= 8;
-            } /* end if */
-            else {
-                name_hi = 0;
-                UINT64DECODE_VAR(name_p, name_hi, name_len_rem)
-                name_len_rem = 0;
-            } /* end else */
-        }     /* end if */
-        else
-            name_hi = 0;
+    /* Public H5daos routine entered through H5_daos_public_call() */
+    if (H5_daos_public_call_op_g >= 0 && opt_type == H5_daos_public_call_op_g) {
+        *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_NO_ASYNC;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
 
-        /* FNV algorithm - XOR hash with name then multiply by fnv_prime */
-        hash_lo ^= name_lo;
-        hash_hi ^= name_hi;
-        H5_daos_mult128(hash_lo, hash_hi, fnv_prime_lo, fnv_prime_hi, &hash_lo, &hash_hi);
-    } /* end while */
+    /* Check operation type */
+    switch (opt_type) {
+        /* H5Mcreate/create_anon */
+        case H5VL_MAP_CREATE: {
+            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_MODIFY_METADATA;
+            break;
+        } /* end block */
 
-    /* "Encode" hash integers to char buffer, so the buffer is the same on both
-     * little endian and big endian systems */
-    UINT64ENCODE(hash_p, hash_lo)
-    UINT64ENCODE(hash_p, hash_hi)
+        /* H5Mopen */
+        case H5VL_MAP_OPEN: {
+            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_QUERY_METADATA;
+            break;
+        } /* end block */
 
-    return;
-} /* end H5_daos_hash128() */
+        /* H5Mget */
+        case H5VL_MAP_GET_VAL: {
+            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_READ_DATA;
+            break;
+        } /* end block */
+
+        /* H5Mexists */
+        case H5VL_MAP_EXISTS: {
+            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_READ_DATA;
+            break;
+        } /* end block */
+
+        /* H5Mput */
+        case H5VL_MAP_PUT: {
+            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_READ_DATA;
+            break;
+        } /* end block */
+
+        /* Operations that get misc info from the map */
+        case H5VL_MAP_GET: {
+            *supported =
+                H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_QUERY_METADATA | H5_DAOS_OPT_QUERY_NO_ASYNC;
+            break;
+        } /* end block */
+
+        /* Specific operations (H5Miterate and H5Mdelete) */
+        case H5VL_MAP_SPECIFIC: {
+            *supported = H5_DAOS_OPT_QUERY_SUPPORTED | H5_DAOS_OPT_QUERY_QUERY_METADATA |
+                         H5_DAOS_OPT_QUERY_MODIFY_METADATA | H5_DAOS_OPT_QUERY_NO_ASYNC;
+            break;
+        } /* end block */
+
+        /* H5Mclose */
+        case H5VL_MAP_CLOSE: {
+            *supported = H5_DAOS_OPT_QUERY_SUPPORTED;
+            break;
+        } /* end block */
+
+        default: {
+            /* Not supported */
+            *supported = 0;
+            break;
+        } /* end block */
+    }     /* end switch */
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_opt_query() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_tx_comp_cb
- *
- * Purpose:     Callback for daos_tx_commit()/abort() which closes the
- *              transaction.
+ * Function:    H5_daos_optional
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Purpose:     Optional VOL callbacks.  Thin switchboard to translate map
+ *              object calls to a format analogous to other VOL object
+ *              callbacks.
  *
- * Programmer:  Neil Fortner
- *              January, 2019
+ * Return:      Success:    0
+ *              Failure:    -1
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_tx_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_optional(void *item, H5VL_optional_args_t *opt_args, hid_t dxpl_id, void **req)
 {
-    H5_daos_req_t *req;
-    int            ret;
-    int            ret_value = 0;
+    herr_t ret_value = SUCCEED;
 
-    assert(H5_daos_task_list_g);
+    H5_daos_inc_api_cnt();
 
-    /* Get private data */
-    if (NULL == (req = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for transaction commit/abort task");
+    /* Public H5daos routine entered through H5_daos_public_call().  Its
+     * operation value is assigned at run time so it can't be a case below. */
+    if (H5_daos_public_call_op_g >= 0 && opt_args->op_type == H5_daos_public_call_op_g) {
+        H5_daos_public_call_t *call = (H5_daos_public_call_t *)opt_args->args;
 
-    /* Handle errors in commit/abort task.  Only record error in
-     * udata->req_status if it does not already contain an error (it could
-     * contain an error if another task this task is not dependent on also
-     * failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        req->status      = task->dt_result;
-        req->failed_task = "transaction commit/abort";
+        if ((ret_value = call->op_ret = call->op(call->op_args)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTOPERATE, ret_value, "public routine failed");
+
+        D_GOTO_DONE(ret_value);
     } /* end if */
 
-    /* Close transaction */
-    if (0 != (ret = daos_tx_close(req->th, NULL /*event*/)))
-        D_GOTO_ERROR(H5E_IO, H5E_CLOSEERROR, ret, "can't close transaction: %s", H5_daos_err_to_string(ret));
-    req->th_open = FALSE;
+    /* Check operation type */
+    switch (opt_args->op_type) {
+        /* H5Mcreate/create_anon */
+        case H5VL_MAP_CREATE: {
+            H5VL_map_args_t *map_args = (H5VL_map_args_t *)opt_args->args;
+            hid_t            lcpl_id  = H5I_INVALID_HID;
+            hid_t            ktype_id = H5I_INVALID_HID;
+            hid_t            vtype_id = H5I_INVALID_HID;
+            hid_t            mcpl_id  = H5I_INVALID_HID;
+            hid_t            mapl_id  = H5I_INVALID_HID;
 
-done:
-    /* Make notify callback */
-    if (req->notify_cb) {
-        H5_DAOS_REQ_STATUS_OUT_TYPE req_status;
+            /* Check operation arguments pointer.  All other arguments will
+             * be checked by H5_daos_map_create. */
+            if (!map_args)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
 
-        /* Determine request status */
-        if (ret_value >= 0 && (req->status == -H5_DAOS_INCOMPLETE || req->status == -H5_DAOS_SHORT_CIRCUIT))
-            req_status = H5_DAOS_REQ_STATUS_OUT_SUCCEED;
-        else if (req->status == -H5_DAOS_CANCELED)
-            req_status = H5_DAOS_REQ_STATUS_OUT_CANCELED;
-        else
-            req_status = H5_DAOS_REQ_STATUS_OUT_FAIL;
+            lcpl_id  = map_args->create.lcpl_id;
+            ktype_id = map_args->create.key_type_id;
+            vtype_id = map_args->create.val_type_id;
+            mcpl_id  = map_args->create.mcpl_id;
+            mapl_id  = map_args->create.mapl_id;
 
-        /* Make callback */
-        if (req->notify_cb(req->notify_ctx, req_status) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CANTOPERATE, -H5_DAOS_CALLBACK_ERROR,
-                         "notify callback returned failure");
-    } /* end if */
+            /* Pass the call */
+            if (NULL == (map_args->create.map =
+                             H5_daos_map_create(item, &map_args->create.loc_params, map_args->create.name,
+                                                lcpl_id, ktype_id, vtype_id, mcpl_id, mapl_id, dxpl_id, req)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create map object");
 
-    /* Clear H5_daos_collective_req_tail if it refers to this request */
-    if (H5_daos_collective_req_tail == req)
+            break;
+        } /* end block */
+
+        /* H5Mopen */
+        case H5VL_MAP_OPEN: {
+            H5VL_map_args_t *map_args = (H5VL_map_args_t *)opt_args->args;
+            hid_t            mapl_id  = H5I_INVALID_HID;
+
+            /* Check operation arguments pointer.  All other arguments will
+             * be checked by H5_daos_map_open. */
+            if (!map_args)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+
+            mapl_id = map_args->open.mapl_id;
+
+            /* Pass the call */
+            if (NULL == (map_args->open.map = H5_daos_map_open(item, &map_args->open.loc_params,
+                                                               map_args->open.name, mapl_id, dxpl_id, req)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map object");
+
+            break;
+        } /* end block */
+
+        /* H5Mget */
+        case H5VL_MAP_GET_VAL: {
+            H5VL_map_args_t *map_args        = (H5VL_map_args_t *)opt_args->args;
+            hid_t            key_mem_type_id = H5I_INVALID_HID;
+            hid_t            val_mem_type_id = H5I_INVALID_HID;
+            void            *value           = NULL;
+
+            /* Check operation arguments pointer.  All other arguments will
+             * be checked by H5_daos_map_get_val. */
+            if (!map_args)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+
+            key_mem_type_id = map_args->get_val.key_mem_type_id;
+            val_mem_type_id = map_args->get_val.value_mem_type_id;
+            value           = map_args->get_val.value;
+
+            /* Pass the call */
+            if ((ret_value = H5_daos_map_get_val(item, key_mem_type_id, map_args->get_val.key,
+                                                 val_mem_type_id, value, dxpl_id, req)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_READERROR, ret_value, "can't get value");
+
+            break;
+        } /* end block */
+
+        /* H5Mexists */
+        case H5VL_MAP_EXISTS: {
+            H5VL_map_args_t *map_args        = (H5VL_map_args_t *)opt_args->args;
+            hid_t            key_mem_type_id = H5I_INVALID_HID;
+            hbool_t         *exists          = NULL;
+
+            /* Check operation arguments pointer.  All other arguments will
+             * be checked by H5_daos_map_exists. */
+            if (!map_args)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+
+            key_mem_type_id = map_args->exists.key_mem_type_id;
+            exists          = &map_args->exists.exists;
+
+            /* Pass the call */
+            if ((ret_value = H5_daos_map_exists(item, key_mem_type_id, map_args->exists.key, exists, dxpl_id,
+                                                req)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_READERROR, ret_value, "can't check if value exists");
+
+            break;
+        } /* end block */
+
+        /* H5Mput */
+        case H5VL_MAP_PUT: {
+            H5VL_map_args_t *map_args        = (H5VL_map_args_t *)opt_args->args;
+            hid_t            key_mem_type_id = H5I_INVALID_HID;
+            hid_t            val_mem_type_id = H5I_INVALID_HID;
+
+            /* Check operation arguments pointer.  All other arguments will
+             * be checked by H5_daos_map_put. */
+            if (!map_args)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+
+            key_mem_type_id = map_args->put.key_mem_type_id;
+            val_mem_type_id = map_args->put.value_mem_type_id;
+
+            /* Pass the call */
+            if ((ret_value = H5_daos_map_put(item, key_mem_type_id, map_args->put.key, val_mem_type_id,
+                                             map_args->put.value, dxpl_id, req)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, ret_value, "can't put value");
+
+            break;
+        } /* end block */
+
+        /* Operations that get misc info from the map */
+        case H5VL_MAP_GET: {
+            H5VL_map_args_t *map_args = (H5VL_map_args_t *)opt_args->args;
+
+            /* Check operation arguments pointer.  All other arguments will
+             * be checked by H5_daos_map_get. */
+            if (!map_args)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+
+            /* Pass the call */
+            if ((ret_value = H5_daos_map_get(item, map_args, dxpl_id, req)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, ret_value, "can't perform map get operation");
+
+            break;
+        } /* end block */
+
+        /* Specific operations (H5Miterate and H5Mdelete) */
+        case H5VL_MAP_SPECIFIC: {
+            H5VL_map_args_t *map_args = (H5VL_map_args_t *)opt_args->args;
+
+            /* Check operation arguments pointer.  All other arguments will
+             * be checked by H5_daos_map_specific. */
+            if (!map_args)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+
+            /* Pass the call */
+            if ((ret_value = H5_daos_map_specific(item, map_args, dxpl_id, req)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret_value, "can't perform specific map operation");
+
+            break;
+        } /* end block */
+
+        /* H5Mclose */
+        case H5VL_MAP_CLOSE: {
+            /* Pass the call */
+            if ((ret_value = H5_daos_map_close(item, dxpl_id, req)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CLOSEERROR, ret_value, "can't close map object");
+
+            break;
+        } /* end block */
+
+        default:
+            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid or unsupported optional operation");
+    } /* end switch */
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_optional() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oidx_generate
+ *
+ * Purpose:     Generates a unique 64 bit object index.  This index will be
+ *              used as the lower 64 bits of a DAOS object ID. If
+ *              necessary, this routine creates a task to allocate
+ *              additional object indices for the given container before
+ *              generating the object index that is returned.
+ *
+ *              Object indices are allocated in blocks that double in
+ *              size each time one is used up (see
+ *              H5_DAOS_NEXT_OIDX_NALLOC), so processes that create many
+ *              objects rarely need to go back to DAOS.  When called
+ *              collectively, rank 0 allocates a block for the collective
+ *              object indices plus one block of the same size for each
+ *              rank, and broadcasts the start of the allocation.  Each
+ *              rank then takes its own block as its independent object
+ *              indices if it has none left, saving it a later trip to
+ *              DAOS.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_oidx_generate(uint64_t *oidx, H5_daos_file_t *file, hbool_t collective, H5_daos_req_t *req,
+                      tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_oidx_generate_ud_t *generate_udata = NULL;
+    tse_task_t                 *generate_task  = NULL;
+    H5_daos_coll_lane_t        *lane           = NULL;
+    uint64_t                   *next_oidx;
+    uint64_t                   *max_oidx;
+    uint64_t                   *nalloc;
+    int                         ret;
+    herr_t                      ret_value = SUCCEED;
+
+    assert(file);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Collective object indices are allocated per collective lane, since
+     * requests in different lanes may allocate them in a different order on
+     * each rank.  An operation on another file (such as a copy) uses the
+     * first lane of the file the object is created in. */
+    if (collective) {
+        lane      = req->file == file ? H5_daos_req_coll_lane(req) : &file->coll_lanes[0];
+        next_oidx = &lane->next_oidx;
+        max_oidx  = &lane->max_oidx;
+        nalloc    = &lane->oidx_nalloc;
+    } /* end if */
+    else {
+        next_oidx = &file->next_oidx;
+        max_oidx  = &file->max_oidx;
+        nalloc    = &file->oidx_nalloc;
+    } /* end else */
+
+    /* Allocate more object indices for this process if necessary */
+    if ((*max_oidx == 0) || (*next_oidx > *max_oidx)) {
+        /* Grow the size of the block to allocate.  For collective
+         * allocations this happens identically on all ranks. */
+        *nalloc = H5_DAOS_NEXT_OIDX_NALLOC(file, *nalloc);
+
+        /* Check if this process should allocate object IDs or just wait for the
+         * result from the leader process */
+        if (!collective || (file->my_rank == 0)) {
+            /* Set private data for OIDX generation task */
+            if (NULL == (generate_udata =
+                             (H5_daos_oidx_generate_ud_t *)DV_malloc(sizeof(H5_daos_oidx_generate_ud_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                             "can't allocate user data struct for OIDX generation task");
+            generate_udata->generic_ud.req       = req;
+            generate_udata->generic_ud.task_name = "OIDX generation";
+            generate_udata->file                 = file;
+            generate_udata->collective           = collective;
+            generate_udata->oidx_out             = oidx;
+            generate_udata->next_oidx            = next_oidx;
+            generate_udata->max_oidx             = max_oidx;
+            generate_udata->nalloc               = *nalloc;
+
+            /* If other ranks will receive this allocation, also allocate a
+             * block of independent object indices for each rank */
+            if (collective && (file->num_procs > 1))
+                generate_udata->num_oids = *nalloc * ((uint64_t)file->num_procs + 1);
+            else
+                generate_udata->num_oids = *nalloc;
+
+            /* Create task to allocate oidxs */
+            if (H5_daos_create_daos_task(DAOS_OPC_CONT_ALLOC_OIDS, *dep_task ? 1 : 0,
+                                         *dep_task ? dep_task : NULL, H5_daos_oidx_generate_prep_cb,
+                                         H5_daos_oidx_generate_comp_cb, generate_udata, &generate_task) < 0)
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to generate OIDXs");
+
+            /* Schedule OIDX generation task (or save it to be scheduled later) and give it
+             * a reference to req */
+            if (*first_task) {
+                if (0 != (ret = tse_task_schedule(generate_task, false)))
+                    D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to generate OIDXs: %s",
+                                 H5_daos_err_to_string(ret));
+            }
+            else
+                *first_task = generate_task;
+            req->rc++;
+            file->item.rc++;
+
+            /* Relinquish control of the OIDX generation udata to the
+             * task's completion callback */
+            generate_udata = NULL;
+
+            *dep_task = generate_task;
+        } /* end if */
+
+        /* Broadcast next_oidx if there are other processes that need it */
+        if (collective && (file->num_procs > 1) &&
+            H5_daos_oidx_bcast(file, lane, oidx, *nalloc, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't broadcast next object index");
+    } /* end if */
+    else {
+        /* Allocate oidx from local allocation */
+        H5_DAOS_ALLOCATE_NEXT_OIDX(oidx, next_oidx, max_oidx);
+    }
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0) {
+        generate_udata = DV_free(generate_udata);
+    }
+
+    /* Make sure we cleaned up */
+    assert(!generate_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oidx_generate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oidx_generate_prep_cb
+ *
+ * Purpose:     Prepare callback for DAOS OIDX generation task.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_oidx_generate_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_oidx_generate_ud_t *udata;
+    daos_cont_alloc_oids_t     *alloc_args;
+    int                         ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for generic task");
+
+    assert(udata->generic_ud.req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->generic_ud.req, H5E_VOL);
+
+    assert(udata->generic_ud.req->file);
+    assert(udata->generic_ud.req->file->item.open_req);
+
+    /* Verify file was successfully opened */
+    if (udata->generic_ud.req->file->item.open_req->status != 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, -H5_DAOS_PREREQ_ERROR, "file open is incomplete");
+
+    /* Set arguments for OIDX generation */
+    if (NULL == (alloc_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTGET, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for OIDX generation task");
+    alloc_args->coh      = udata->generic_ud.req->file->coh;
+    alloc_args->num_oids = udata->num_oids;
+    alloc_args->oid      = udata->next_oidx;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oidx_generate_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oidx_generate_comp_cb
+ *
+ * Purpose:     Complete callback for the DAOS OIDX generation task. When
+ *              H5_daos_oidx_generate is called independently, this
+ *              callback is responsible for updating the current process'
+ *              file's max_oidx and next_oidx fields and "allocating" the
+ *              actually returned next oidx. When H5_daos_oidx_generate is
+ *              called collectively, the completion callback for the
+ *              ensuing oidx broadcast task will be responsible for these
+ *              tasks instead.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_oidx_generate_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_oidx_generate_ud_t *udata;
+    uint64_t                   *next_oidx;
+    uint64_t                   *max_oidx;
+    int                         ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for OIDX generation task");
+
+    assert(udata->file);
+
+    /* Handle errors in OIDX generation task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->generic_ud.req->status      = task->dt_result;
+        udata->generic_ud.req->failed_task = udata->generic_ud.task_name;
+    } /* end if */
+    else if (task->dt_result == 0) {
+        next_oidx = udata->next_oidx;
+        max_oidx  = udata->max_oidx;
+
+        /* If H5_daos_oidx_generate was called independently, it is
+         * safe to update the file's max and next OIDX fields and
+         * allocate the next OIDX. Otherwise, this must be delayed
+         * until after the next OIDX value has been broadcasted to
+         * the other ranks.
+         */
+        if (!udata->collective || (udata->generic_ud.req->file->num_procs == 1)) {
+            /* Adjust the max and next OIDX values for the file on this process */
+            H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx, max_oidx, udata->nalloc);
+
+            /* Allocate oidx from local allocation */
+            H5_DAOS_ALLOCATE_NEXT_OIDX(udata->oidx_out, next_oidx, max_oidx);
+        }
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if (udata) {
+        /* Release our reference on the file */
+        if (H5_daos_file_close_helper(udata->file) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->generic_ud.req->status      = ret_value;
+            udata->generic_ud.req->failed_task = udata->generic_ud.task_name;
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->generic_ud.req) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oidx_generate_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oidx_bcast
+ *
+ * Purpose:     Creates an asynchronous task for broadcasting the next OIDX
+ *              value after rank 0 has allocated more from DAOS for the
+ *              collective object indices of lane.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_oidx_bcast(H5_daos_file_t *file, H5_daos_coll_lane_t *lane, uint64_t *oidx_out, uint64_t nalloc,
+                   H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_oidx_bcast_ud_t *oidx_bcast_udata = NULL;
+    tse_task_t              *bcast_task       = NULL;
+    int                      ret;
+    herr_t                   ret_value = SUCCEED;
+
+    assert(file);
+    assert(lane);
+    assert(oidx_out);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Set up broadcast user data */
+    if (NULL == (oidx_bcast_udata = (H5_daos_oidx_bcast_ud_t *)DV_malloc(sizeof(H5_daos_oidx_bcast_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "failed to allocate buffer for MPI broadcast user data");
+    oidx_bcast_udata->bcast_udata.req            = req;
+    oidx_bcast_udata->bcast_udata.obj            = NULL;
+    oidx_bcast_udata->bcast_udata.bcast_metatask = NULL;
+    oidx_bcast_udata->bcast_udata.buffer         = oidx_bcast_udata->next_oidx_buf;
+    oidx_bcast_udata->bcast_udata.buffer_len     = H5_DAOS_ENCODED_UINT64_T_SIZE;
+    oidx_bcast_udata->bcast_udata.count          = H5_DAOS_ENCODED_UINT64_T_SIZE;
+    oidx_bcast_udata->bcast_udata.lane           = NULL;
+    oidx_bcast_udata->bcast_udata.prefetch       = FALSE;
+    oidx_bcast_udata->file                       = file;
+    oidx_bcast_udata->oidx_out                   = oidx_out;
+    oidx_bcast_udata->next_oidx                  = &lane->next_oidx;
+    oidx_bcast_udata->max_oidx                   = &lane->max_oidx;
+    oidx_bcast_udata->nalloc                     = nalloc;
+
+    /* Create task for broadcast */
+    if (H5_daos_create_task(H5_daos_mpi_ibcast_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            (file->my_rank == 0) ? H5_daos_oidx_bcast_prep_cb : NULL,
+                            H5_daos_oidx_bcast_comp_cb, oidx_bcast_udata, &bcast_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to broadcast next object index");
+
+    /* Schedule OIDX broadcast task (or save it to be scheduled later) and give it
+     * a reference to req */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(bcast_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "can't schedule task to broadcast next object index: %s",
+                         H5_daos_err_to_string(ret));
+    }
+    else
+        *first_task = bcast_task;
+    req->rc++;
+    file->item.rc++;
+
+    /* Relinquish control of the OIDX broadcast udata to the
+     * task's completion callback */
+    oidx_bcast_udata = NULL;
+
+    *dep_task = bcast_task;
+
+done:
+    /* Cleanup on failure */
+    if (oidx_bcast_udata) {
+        assert(ret_value < 0);
+        oidx_bcast_udata = DV_free(oidx_bcast_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oidx_bcast() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oidx_bcast_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous OIDX broadcasts.
+ *              Currently checks for errors from previous tasks and then
+ *              encodes the OIDX value into the broadcast buffer before
+ *              sending. Meant only to be called by rank 0.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_oidx_bcast_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_oidx_bcast_ud_t *udata;
+    uint8_t                 *p;
+    int                      ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for object index broadcast task");
+
+    assert(udata->bcast_udata.req);
+    assert(udata->bcast_udata.buffer);
+    assert(udata->next_oidx);
+    assert(H5_DAOS_ENCODED_UINT64_T_SIZE == udata->bcast_udata.buffer_len);
+    assert(H5_DAOS_ENCODED_UINT64_T_SIZE == udata->bcast_udata.count);
+
+    /* Note that we do not handle errors from a previous task here.
+     * The broadcast must still proceed on all ranks even if a
+     * previous task has failed.
+     */
+
+    p = udata->bcast_udata.buffer;
+    UINT64ENCODE(p, *udata->next_oidx);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_oidx_bcast_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oidx_bcast_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous OIDX broadcasts.
+ *              Currently checks for a failed task, then performs the
+ *              following in order:
+ *
+ *              - decodes the sent OIDX buffer on the ranks that are
+ *                receiving it
+ *              - adjusts the max OIDX and next OIDX fields in the file on
+ *                all ranks
+ *              - takes this rank's block of independent OIDXs that
+ *                follows the collective block, if this rank has no
+ *                independent OIDXs left
+ *              - allocates the next OIDX value on all ranks
+ *              - frees private data
+ *
+ *              Meant to be called by all ranks.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_oidx_bcast_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_oidx_bcast_ud_t *udata;
+    uint64_t                *next_oidx;
+    uint64_t                *max_oidx;
+    int                      ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for object index broadcast task");
+
+    assert(udata->bcast_udata.req);
+    assert(udata->bcast_udata.buffer);
+    assert(udata->file);
+    assert(udata->oidx_out);
+    assert(udata->next_oidx);
+    assert(udata->max_oidx);
+    assert(H5_DAOS_ENCODED_UINT64_T_SIZE == udata->bcast_udata.buffer_len);
+    assert(H5_DAOS_ENCODED_UINT64_T_SIZE == udata->bcast_udata.count);
+
+    /* Handle errors in OIDX broadcast task.  Only record error in
+     * udata->req_status if it does not already contain an error (it could
+     * contain an error if another task this task is not dependent on also
+     * failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->bcast_udata.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->bcast_udata.req->status      = task->dt_result;
+        udata->bcast_udata.req->failed_task = "MPI_Ibcast next object index";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        next_oidx = udata->next_oidx;
+        max_oidx  = udata->max_oidx;
+
+        /* Decode sent OIDX on receiving ranks */
+        if (udata->bcast_udata.req->file->my_rank != 0) {
+            uint8_t *p = udata->bcast_udata.buffer;
+            UINT64DECODE(p, *next_oidx);
+        }
+
+        /* Take this rank's block of independent OIDXs if needed.  The
+         * blocks for each rank follow the collective block. */
+        if ((udata->file->max_oidx == 0) || (udata->file->next_oidx > udata->file->max_oidx)) {
+            udata->file->next_oidx = *next_oidx + (udata->nalloc * ((uint64_t)udata->file->my_rank + 1));
+            H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(&udata->file->next_oidx, &udata->file->max_oidx,
+                                             udata->nalloc);
+            if (udata->file->oidx_nalloc < udata->nalloc)
+                udata->file->oidx_nalloc = udata->nalloc;
+        } /* end if */
+
+        /* Adjust the max and next OIDX values for the file on this process */
+        H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx, max_oidx, udata->nalloc);
+
+        /* Allocate oidx from local allocation */
+        H5_DAOS_ALLOCATE_NEXT_OIDX(udata->oidx_out, next_oidx, max_oidx);
+    } /* end else */
+
+done:
+    if (udata) {
+        /* Release our reference on the file */
+        if (H5_daos_file_close_helper(udata->file) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->bcast_udata.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->bcast_udata.req->status      = ret_value;
+            udata->bcast_udata.req->failed_task = "MPI_Ibcast next object index completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->bcast_udata.req) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        DV_free(udata);
+    }
+    else
+        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oidx_bcast_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oid_encode
+ *
+ * Purpose:     Creates a DAOS OID given the object type and a 64 bit
+ *              object index.  Note that `file` must have at least the
+ *              default_object_class field set, but may be otherwise
+ *              uninitialized.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_oid_encode(daos_obj_id_t *oid, uint64_t oidx, H5I_type_t obj_type, hid_t crt_plist_id,
+                   const char *oclass_prop_name, H5_daos_file_t *file)
+{
+    daos_oclass_id_t object_class = OC_UNKNOWN;
+#if CHECK_DAOS_API_VERSION(2, 0)
+    enum daos_otype_t object_type;
+#else
+    daos_ofeat_t object_feats;
+#endif
+    herr_t ret_value = SUCCEED;
+
+    /* Initialize oid.lo to oidx */
+    oid->lo = oidx;
+
+    /* Set type bits in the upper 2 bits of the lower 32 of oid.hi (for
+     * simplicity so they're in the same location as in the compacted haddr_t
+     * form) */
+    if (obj_type == H5I_GROUP)
+        oid->hi = H5_DAOS_TYPE_GRP;
+    else if (obj_type == H5I_DATASET)
+        oid->hi = H5_DAOS_TYPE_DSET;
+    else if (obj_type == H5I_DATATYPE)
+        oid->hi = H5_DAOS_TYPE_DTYPE;
+    else {
+        assert(obj_type == H5I_MAP);
+        oid->hi = H5_DAOS_TYPE_MAP;
+    } /* end else */
+
+    /* Set the object feature flags */
+    if (H5I_GROUP == obj_type)
+#if CHECK_DAOS_API_VERSION(2, 0)
+        object_type = DAOS_OT_MULTI_LEXICAL;
+    else
+        object_type = DAOS_OT_AKEY_LEXICAL;
+#else
+        object_feats = DAOS_OF_DKEY_LEXICAL | DAOS_OF_AKEY_LEXICAL;
+    else
+        object_feats = DAOS_OF_DKEY_HASHED | DAOS_OF_AKEY_LEXICAL;
+#endif
+
+    /* Check for object class set on crt_plist_id */
+    /* Note we do not copy the oclass_str in the property callbacks (there is no
+     * "get" callback, so this is more like an H5P_peek, and we do not need to
+     * free oclass_str as it points directly into the plist value */
+    if (crt_plist_id != H5P_DEFAULT) {
+        htri_t prop_exists;
+
+        if ((prop_exists = H5Pexist(crt_plist_id, oclass_prop_name)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object class property");
+        if (prop_exists) {
+            char *oclass_str = NULL;
+
+            if (H5Pget(crt_plist_id, oclass_prop_name, &oclass_str) < 0)
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get object class");
+            if (oclass_str && (oclass_str[0] != '\0'))
+                if (OC_UNKNOWN == (object_class = (daos_oclass_id_t)daos_oclass_name2id(oclass_str)))
+                    D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "unknown object class");
+        } /* end if */
+    }     /* end if */
+
+    /* Check for object class set on file if not set from plist */
+    if (object_class == OC_UNKNOWN)
+        object_class = file->fapl_cache.default_object_class;
+
+    /* Generate oid */
+    daos_oclass_hints_t hints = 0;
+
+    /** if user does not set default object class, use DAOS default, but set a large oclass for
+     * datasets, and small for other object types */
+    if (object_class == OC_UNKNOWN) {
+        if (obj_type == H5I_DATASET)
+            hints = DAOS_OCH_SHD_MAX;
+        else
+            hints = DAOS_OCH_SHD_DEF;
+    }
+#if CHECK_DAOS_API_VERSION(2, 0)
+    if (daos_obj_generate_oid(file->coh, oid, object_type, object_class, hints, 0) != 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "Can't set object class");
+#else
+    if (daos_obj_generate_oid(file->coh, oid, object_feats, object_class, hints, 0) != 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "Can't set object class");
+#endif
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_oid_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oid_encode_task
+ *
+ * Purpose:     Asynchronous task for calling H5_daos_oid_encode.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_oid_encode_task(tse_task_t *task)
+{
+    H5_daos_oid_encode_ud_t *udata     = NULL;
+    int                      ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for OID encoding task");
+
+    assert(udata->req);
+    assert(udata->oid_out);
+
+    /* Check for previous errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
+
+    if (H5_daos_oid_encode(udata->oid_out, udata->oidx, udata->obj_type, udata->crt_plist_id,
+                           udata->oclass_prop_name, udata->req->file) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTENCODE, -H5_DAOS_H5_ENCODE_ERROR, "can't encode object ID");
+
+done:
+    /* Free private data if we haven't released ownership */
+    if (udata) {
+        if (H5P_DEFAULT != udata->crt_plist_id)
+            if (H5Idec_ref(udata->crt_plist_id) < 0)
+                D_DONE_ERROR(H5E_PLIST, H5E_CANTDEC, -H5_DAOS_H5_CLOSE_ERROR,
+                             "can't decrement ref. count on creation plist");
+
+        /* Release our reference on the file */
+        if (H5_daos_file_close_helper(udata->file) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "OID encoding task";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oid_encode_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oid_generate
+ *
+ * Purpose:     Generate a DAOS OID given the object type and file
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_oid_generate(daos_obj_id_t *oid, hbool_t oidx_set, uint64_t oidx, H5I_type_t obj_type,
+                     hid_t crt_plist_id, const char *oclass_prop_name, H5_daos_file_t *file,
+                     hbool_t collective, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_oid_encode_ud_t *encode_udata = NULL;
+    tse_task_t              *encode_task  = NULL;
+    int                      ret;
+    herr_t                   ret_value = SUCCEED;
+
+    assert(file);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Set up user data for OID encoding */
+    if (NULL == (encode_udata = (H5_daos_oid_encode_ud_t *)DV_malloc(sizeof(H5_daos_oid_encode_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "failed to allocate buffer for OID encoding user data");
+    encode_udata->req     = req;
+    encode_udata->oid_out = oid;
+
+    if (oidx_set) {
+        encode_udata->oidx = oidx;
+    }
+    else {
+        /* Generate oidx */
+        if (H5_daos_oidx_generate(&encode_udata->oidx, file, collective, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't generate object index");
+    }
+
+    /* Create asynchronous task for OID encoding */
+    encode_udata->file             = file;
+    encode_udata->obj_type         = obj_type;
+    encode_udata->crt_plist_id     = crt_plist_id;
+    encode_udata->oclass_prop_name = oclass_prop_name;
+
+    /* Create task to encode OID */
+    if (H5_daos_create_task(H5_daos_oid_encode_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
+                            NULL, encode_udata, &encode_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to encode OID");
+
+    /* Schedule OID encoding task (or save it to be scheduled later) and give it
+     * a reference to req */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(encode_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to encode OID: %s",
+                         H5_daos_err_to_string(ret));
+    }
+    else
+        *first_task = encode_task;
+    req->rc++;
+    file->item.rc++;
+
+    /* Relinquish control of the OID encoding udata to the task's completion callback */
+    encode_udata = NULL;
+
+    if (H5P_DEFAULT != crt_plist_id)
+        if (H5Iinc_ref(crt_plist_id) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINC, FAIL, "can't increment ref. count on creation plist");
+
+    *dep_task = encode_task;
+
+done:
+    encode_udata = DV_free(encode_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oid_generate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oid_to_token
+ *
+ * Purpose:     Converts an OID to an object "token".
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_oid_to_token(daos_obj_id_t oid, H5O_token_t *obj_token)
+{
+    uint8_t *p;
+    herr_t   ret_value = SUCCEED;
+
+    assert(obj_token);
+    H5daos_compile_assert(H5_DAOS_ENCODED_OID_SIZE <= H5O_MAX_TOKEN_SIZE);
+
+    p = (uint8_t *)obj_token;
+
+    UINT64ENCODE(p, oid.lo);
+    UINT64ENCODE(p, oid.hi);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oid_to_token() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_token_to_oid
+ *
+ * Purpose:     Converts an object "token" to an OID.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_token_to_oid(const H5O_token_t *obj_token, daos_obj_id_t *oid)
+{
+    const uint8_t *p;
+    herr_t         ret_value = SUCCEED;
+
+    assert(obj_token);
+    assert(oid);
+    H5daos_compile_assert(H5_DAOS_ENCODED_OID_SIZE <= H5O_MAX_TOKEN_SIZE);
+
+    p = (const uint8_t *)obj_token;
+
+    UINT64DECODE(p, oid->lo);
+    UINT64DECODE(p, oid->hi);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_token_to_oid() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oid_to_type
+ *
+ * Purpose:     Retrieve the HDF5 object type from an OID
+ *
+ * Return:      Success:    Object type
+ *              Failure:    H5I_BADID
+ *
+ *-------------------------------------------------------------------------
+ */
+H5I_type_t
+H5_daos_oid_to_type(daos_obj_id_t oid)
+{
+    uint64_t type_bits;
+
+    /* Retrieve type */
+    type_bits = oid.hi & H5_DAOS_TYPE_MASK;
+    if (type_bits == H5_DAOS_TYPE_GRP)
+        return (H5I_GROUP);
+    else if (type_bits == H5_DAOS_TYPE_DSET)
+        return (H5I_DATASET);
+    else if (type_bits == H5_DAOS_TYPE_DTYPE)
+        return (H5I_DATATYPE);
+    else if (type_bits == H5_DAOS_TYPE_MAP)
+        return (H5I_MAP);
+    else
+        return (H5I_BADID);
+} /* end H5_daos_oid_to_type() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_mult128
+ *
+ * Purpose:     Multiply two 128 bit unsigned integers to yield a 128 bit
+ *              unsigned integer
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_mult128(uint64_t x_lo, uint64_t x_hi, uint64_t y_lo, uint64_t y_hi, uint64_t *ans_lo,
+                uint64_t *ans_hi)
+{
+    uint64_t xlyl;
+    uint64_t xlyh;
+    uint64_t xhyl;
+    uint64_t xhyh;
+    uint64_t temp;
+
+    assert(ans_lo);
+    assert(ans_hi);
+
+    /*
+     * First calculate x_lo * y_lo
+     */
+    /* Compute 64 bit results of multiplication of each combination of high and
+     * low 32 bit sections of x_lo and y_lo */
+    xlyl = (x_lo & 0xffffffff) * (y_lo & 0xffffffff);
+    xlyh = (x_lo & 0xffffffff) * (y_lo >> 32);
+    xhyl = (x_lo >> 32) * (y_lo & 0xffffffff);
+    xhyh = (x_lo >> 32) * (y_lo >> 32);
+
+    /* Calculate lower 32 bits of the answer */
+    *ans_lo = xlyl & 0xffffffff;
+
+    /* Calculate second 32 bits of the answer. Use temp to keep a 64 bit result
+     * of the calculation for these 32 bits, to keep track of overflow past
+     * these 32 bits. */
+    temp = (xlyl >> 32) + (xlyh & 0xffffffff) + (xhyl & 0xffffffff);
+    *ans_lo += temp << 32;
+
+    /* Calculate third 32 bits of the answer, including overflowed result from
+     * the previous operation */
+    temp >>= 32;
+    temp += (xlyh >> 32) + (xhyl >> 32) + (xhyh & 0xffffffff);
+    *ans_hi = temp & 0xffffffff;
+
+    /* Calculate highest 32 bits of the answer. No need to keep track of
+     * overflow because it has overflowed past the end of the 128 bit answer */
+    temp >>= 32;
+    temp += (xhyh >> 32);
+    *ans_hi += temp << 32;
+
+    /*
+     * Now add the results from multiplying x_lo * y_hi and x_hi * y_lo. No need
+     * to consider overflow here, and no need to consider x_hi * y_hi because
+     * those results would overflow past the end of the 128 bit answer.
+     */
+    *ans_hi += (x_lo * y_hi) + (x_hi * y_lo);
+
+    return;
+} /* end H5_daos_mult128() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_hash128
+ *
+ * Purpose:     Hashes the string name to a 128 bit buffer (hash).
+ *              Implementation of the FNV hash algorithm.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_hash128(const char *name, void *hash)
+{
+    const uint8_t *name_p = (const uint8_t *)name;
+    uint8_t       *hash_p = (uint8_t *)hash;
+    uint64_t       name_lo;
+    uint64_t       name_hi;
+    /* Initialize hash value in accordance with the FNV algorithm */
+    uint64_t hash_lo = 0x62b821756295c58d;
+    uint64_t hash_hi = 0x6c62272e07bb0142;
+    /* Initialize FNV prime number in accordance with the FNV algorithm */
+    const uint64_t fnv_prime_lo = 0x13b;
+    const uint64_t fnv_prime_hi = 0x1000000;
+    size_t         name_len_rem;
+
+    assert(name);
+    assert(hash);
+
+    name_len_rem = strlen(name);
+
+    while (name_len_rem > 0) {
+        /* "Decode" lower 64 bits of this 128 bit section of the name, so the
+         * numberical value of the integer is the same on both little endian and
+         * big endian systems */
+        if (name_len_rem >= 8) {
+            UINT64DECODE(name_p, name_lo)
+            name_len_rem -= 8;
+        } /* end if */
+        else {
+            name_lo = 0;
+            UINT64DECODE_VAR(name_p, name_lo, name_len_rem)
+            name_len_rem = 0;
+        } /* end else */
+
+        /* "Decode" second 64 bits */
+        if (name_len_rem > 0) {
+            if (name_len_rem >= 8) {
+                UINT64DECODE(name_p, name_hi)
+                name_len_rem -= 8;
+            } /* end if */
+            else {
+                name_hi = 0;
+                UINT64DECODE_VAR(name_p, name_hi, name_len_rem)
+                name_len_rem = 0;
+            } /* end else */
+        }     /* end if */
+        else
+            name_hi = 0;
+
+        /* FNV algorithm - XOR hash with name then multiply by fnv_prime */
+        hash_lo ^= name_lo;
+        hash_hi ^= name_hi;
+        H5_daos_mult128(hash_lo, hash_hi, fnv_prime_lo, fnv_prime_hi, &hash_lo, &hash_hi);
+    } /* end while */
+
+    /* "Encode" hash integers to char buffer, so the buffer is the same on both
+     * little endian and big endian systems */
+    UINT64ENCODE(hash_p, hash_lo)
+    UINT64ENCODE(hash_p, hash_hi)
+
+    return;
+} /* end H5_daos_hash128() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_req_coll_tail_clear
+ *
+ * Purpose:     Clears the global collective request tail and the tails
+ *              of the collective lanes of req's file that refer to req,
+ *              once req has finished.  A barrier request can be the tail
+ *              of several lanes.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_req_coll_tail_clear(H5_daos_req_t *req)
+{
+    unsigned i;
+
+    assert(req);
+
+    if (H5_daos_collective_req_tail == req)
         H5_daos_collective_req_tail = NULL;
+    if (req->file)
+        for (i = 0; i < req->file->ncoll_lanes; i++)
+            if (req->file->coll_lanes[i].req_tail == req)
+                req->file->coll_lanes[i].req_tail = NULL;
+} /* end H5_daos_req_coll_tail_clear() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tx_comp_cb
+ *
+ * Purpose:     Callback for daos_tx_commit()/abort() which closes the
+ *              transaction.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_tx_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_req_t *req;
+    hbool_t        pending;
+    int            ret;
+    int            ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (req = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for transaction commit/abort task");
+
+    /* Handle errors in commit/abort task.  Only record error in
+     * udata->req_status if it does not already contain an error (it could
+     * contain an error if another task this task is not dependent on also
+     * failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status      = task->dt_result;
+        req->failed_task = "transaction commit/abort";
+    } /* end if */
+
+    /* Close transaction */
+    if (0 != (ret = daos_tx_close(req->th, NULL /*event*/)))
+        D_GOTO_ERROR(H5E_IO, H5E_CLOSEERROR, ret, "can't close transaction: %s", H5_daos_err_to_string(ret));
+    req->th_open = FALSE;
+
+done:
+    /* Add the request to the file's deferred collective error check batch if
+     * necessary.  In that case the notify callback and error propagation are
+     * handled when the batch is checked. */
+    pending = H5_daos_coll_err_batch_add(req);
+
+    /* Make notify callback */
+    if (req->notify_cb && !pending) {
+        H5_DAOS_REQ_STATUS_OUT_TYPE req_status;
+
+        /* Determine request status */
+        if (ret_value >= 0 && (req->status == -H5_DAOS_INCOMPLETE || req->status == -H5_DAOS_SHORT_CIRCUIT))
+            req_status = H5_DAOS_REQ_STATUS_OUT_SUCCEED;
+        else if (req->status == -H5_DAOS_CANCELED)
+            req_status = H5_DAOS_REQ_STATUS_OUT_CANCELED;
+        else
+            req_status = H5_DAOS_REQ_STATUS_OUT_FAIL;
+
+        /* Make callback */
+        if (req->notify_cb(req->notify_ctx, req_status) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTOPERATE, -H5_DAOS_CALLBACK_ERROR,
+                         "notify callback returned failure");
+    } /* end if */
+
+    /* Clear the collective request tails that refer to this request */
+    H5_daos_req_coll_tail_clear(req);
+
+    /* Mark request as completed */
+    if (ret_value >= 0 && (req->status == -H5_DAOS_INCOMPLETE || req->status == -H5_DAOS_SHORT_CIRCUIT))
+        req->status = 0;
+
+    /* Complete finalize task in engine */
+    tse_task_complete(req->finalize_task, req->status);
+    req->finalize_task = NULL;
+
+    /* Complete dep_task.  Always succeeds since the purpose of dep_task is to
+     * prevent errors from propagating. */
+    if (req->dep_task) {
+        tse_task_complete(req->dep_task, 0);
+        req->dep_task = NULL;
+    } /* end if */
+
+    /* Propagate errors to parent request */
+    if (req->parent_req && req->status != 0 && !pending) {
+        req->parent_req->status      = req->status;
+        req->parent_req->failed_task = req->failed_task;
+    } /* end else */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status      = ret_value;
+        req->failed_task = "transaction commit/abort completion callback";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(req) < 0)
+        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tx_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_h5op_finalize
+ *
+ * Purpose:     Task function which is called when an HDF5 operation is
+ *              complete.  Commits the transaction if one was opened for
+ *              the operation, then releases its reference to req.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_h5op_finalize(tse_task_t *task)
+{
+    H5_daos_req_t *req;
+    hbool_t        close_tx = FALSE;
+    hbool_t        pending  = FALSE;
+    int            ret;
+    int            ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (req = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for operation finalize task");
+    assert(task == req->finalize_task);
+
+    /* Check for error */
+    if (req->status < -H5_DAOS_SHORT_CIRCUIT) {
+        /* Print error message (unless the operation was canceled) */
+        if (req->status < -H5_DAOS_CANCELED)
+            D_DONE_ERROR(H5E_IO, H5E_CANTINIT, req->status, "operation \"%s\" failed in task \"%s\": %s",
+                         req->op_name, req->failed_task, H5_daos_err_to_string(req->status));
+
+        /* Abort transaction if opened */
+        if (req->th_open) {
+            tse_task_t      *abort_task;
+            daos_tx_abort_t *abort_args;
+
+            /* Create task */
+            if (H5_daos_create_daos_task(DAOS_OPC_TX_ABORT, 0, NULL, NULL, H5_daos_tx_comp_cb, req,
+                                         &abort_task) < 0) {
+                close_tx     = TRUE;
+                req->th_open = FALSE;
+                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create task to abort transaction");
+            } /* end if */
+
+            /* Set arguments */
+            if (NULL == (abort_args = daos_task_get_args(abort_task))) {
+                close_tx     = TRUE;
+                req->th_open = FALSE;
+                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                             "can't get arguments for transaction abort task");
+            } /* end if */
+            abort_args->th = req->th;
+
+            /* Schedule abort task */
+            if (0 != (ret = tse_task_schedule(abort_task, false))) {
+                close_tx     = TRUE;
+                req->th_open = FALSE;
+                tse_task_complete(abort_task, ret_value);
+                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, ret, "can't schedule task to abort transaction: %s",
+                             H5_daos_err_to_string(ret));
+            } /* end if */
+            req->rc++;
+        } /* end if */
+    }     /* end if */
+    else {
+        /* Commit transaction if opened */
+        if (req->th_open) {
+            tse_task_t       *commit_task;
+            daos_tx_commit_t *commit_args;
+
+            /* Create task */
+            if (H5_daos_create_daos_task(DAOS_OPC_TX_COMMIT, 0, NULL, NULL, H5_daos_tx_comp_cb, req,
+                                         &commit_task) < 0) {
+                close_tx     = TRUE;
+                req->th_open = FALSE;
+                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create task to commit transaction");
+            } /* end if */
+
+            /* Set arguments */
+            if (NULL == (commit_args = daos_task_get_args(commit_task))) {
+                close_tx     = TRUE;
+                req->th_open = FALSE;
+                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                             "can't get arguments for transaction commit task");
+            } /* end if */
+            commit_args->th    = req->th;
+            commit_args->flags = 0;
+
+            /* Schedule commit task */
+            if (0 != (ret = tse_task_schedule(commit_task, false))) {
+                close_tx     = TRUE;
+                req->th_open = FALSE;
+                tse_task_complete(commit_task, ret_value);
+                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, ret, "can't schedule task to commit transaction: %s",
+                             H5_daos_err_to_string(ret));
+            } /* end if */
+            req->rc++;
+        } /* end if */
+    }     /* end else */
+
+done:
+    if (req) {
+        /* Check if we failed to start tx commit/abort task */
+        if (close_tx) {
+            /* Close transaction */
+            if (0 != (ret = daos_tx_close(req->th, NULL /*event*/)))
+                D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, ret, "can't close transaction: %s",
+                             H5_daos_err_to_string(ret));
+            req->th_open = FALSE;
+        } /* end if */
+
+        /* Check if we're done */
+        if (!req->th_open) {
+            /* Add the request to the file's deferred collective error check
+             * batch if necessary.  In that case the notify callback and error
+             * propagation are handled when the batch is checked. */
+            pending = H5_daos_coll_err_batch_add(req);
+
+            /* Make notify callback */
+            if (req->notify_cb && !pending)
+                if (req->notify_cb(req->notify_ctx, ret_value >= 0 && (req->status == -H5_DAOS_INCOMPLETE ||
+                                                                       req->status == -H5_DAOS_SHORT_CIRCUIT)
+                                                        ? H5_DAOS_REQ_STATUS_OUT_SUCCEED
+                                                    : req->status == -H5_DAOS_CANCELED
+                                                        ? H5_DAOS_REQ_STATUS_OUT_CANCELED
+                                                        : H5_DAOS_REQ_STATUS_OUT_FAIL) < 0)
+                    D_DONE_ERROR(H5E_VOL, H5E_CANTOPERATE, -H5_DAOS_CALLBACK_ERROR,
+                                 "notify callback returned failure");
+
+            /* Clear the collective request tails that refer to this request */
+            H5_daos_req_coll_tail_clear(req);
+
+            /* Mark request as completed if there were no errors */
+            if (ret_value >= 0 &&
+                (req->status == -H5_DAOS_INCOMPLETE || req->status == -H5_DAOS_SHORT_CIRCUIT))
+                req->status = 0;
+
+            /* Return task to task list */
+            if (H5_daos_task_list_put(H5_daos_task_list_g, req->finalize_task) < 0)
+                D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                             "can't return task to task list");
+
+            /* Complete task in engine */
+            tse_task_complete(req->finalize_task, req->status);
+            req->finalize_task = NULL;
+
+            /* Complete dep_task.  Always succeeds since the purpose of dep_task
+             * is to prevent errors from propagating. */
+            if (req->dep_task) {
+                tse_task_complete(req->dep_task, 0);
+                req->dep_task = NULL;
+            } /* end if */
+        }     /* end if */
+
+        /* Report failures in this routine */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            req->status      = ret_value;
+            req->failed_task = "h5 op finalize";
+        } /* end if */
+
+        /* Propagate errors to parent request */
+        if (req->parent_req && req->status != 0 && !req->th_open && !pending) {
+            req->parent_req->status      = req->status;
+            req->parent_req->failed_task = req->failed_task;
+        } /* end else */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(req) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_h5op_finalize() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_generic_prep_cb
+ *
+ * Purpose:     Prepare callback for generic DAOS operations.  Currently
+ *              only checks for errors from previous tasks.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              February, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_generic_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_generic_cb_ud_t *udata;
+    int                      ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for generic task");
+
+    assert(udata->req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
+
+    assert(udata->req->file);
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_generic_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_generic_comp_cb
+ *
+ * Purpose:     Complete callback for generic DAOS operations.  Currently
+ *              checks for a failed task then frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              February, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_generic_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_generic_cb_ud_t *udata;
+    int                      ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for generic task");
+
+    assert(udata->req);
+    assert(udata->req->file || task->dt_result != 0);
+
+    /* Handle errors in task.  Only record error in udata->req_status if it does
+     * not already contain an error (it could contain an error if another task
+     * this task is not dependent on also failed). */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = udata->task_name;
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if (udata) {
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        DV_free(udata);
+    }
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_generic_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_md_rw_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for metadata I/O.  Currently checks for
+ *              errors from previous tasks then sets arguments for the
+ *              DAOS operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_md_rw_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_md_rw_cb_ud_t *udata;
+    daos_obj_rw_t         *update_args;
+    int                    ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for metadata I/O task");
+
+    assert(udata->req);
+    assert(udata->obj);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
+
+    assert(udata->obj->item.file);
+
+    /* Set update task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for metadata I/O task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh    = udata->obj->obj_oh;
+    update_args->th    = udata->req->th;
+    update_args->flags = udata->flags;
+    update_args->dkey  = &udata->dkey;
+    update_args->nr    = udata->nr;
+    update_args->iods  = udata->iod;
+    update_args->sgls  = udata->sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_md_rw_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_md_update_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update for
+ *              metadata writes.  Currently checks for a failed task then
+ *              frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_md_update_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_md_rw_cb_ud_t *udata;
+    unsigned               i;
+    int                    ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for metadata I/O task");
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = udata->task_name;
+    } /* end if */
+
+    /* Close object */
+    if (udata->obj && H5_daos_object_close(&udata->obj->item) < 0)
+        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = udata->task_name;
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    if (udata->free_dkey)
+        DV_free(udata->dkey.iov_buf);
+    if (udata->free_akeys)
+        for (i = 0; i < udata->nr; i++)
+            DV_free(udata->iod[i].iod_name.iov_buf);
+    for (i = 0; i < udata->nr; i++)
+        if (udata->free_sg_iov[i])
+            DV_free(udata->sg_iov[i].iov_buf);
+    DV_free(udata);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_md_update_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_mpi_ibcast_task
+ *
+ * Purpose:     Wraps a call to MPI_Ibcast in a DAOS/TSE task.  The
+ *              broadcast is made over the communicator of the collective
+ *              lane of udata->req (see H5_daos_coll_lane_t).
+ *
+ *              If udata->prefetch is set, the broadcast may be followed
+ *              by a second, larger broadcast with the same udata when
+ *              rank 0 has more data than fits in the first (as done for
+ *              object info on open).  In this case, once a second
+ *              broadcast has been seen in the lane, the first broadcast
+ *              also sends up to lane->bcast_prefetch_ext extra bytes of
+ *              rank 0's buffer, which are kept in
+ *              lane->bcast_prefetch_buf.  If the second broadcast fits in
+ *              what was sent it is then completed locally without
+ *              calling MPI.  All ranks make the same decisions since
+ *              counts are the same on all ranks and broadcasts in a lane
+ *              are made in the same order.
+ *
+ *              If broadcasts are coalesced on the file, broadcasts of up
+ *              to H5_DAOS_BCAST_COALESCE_MAX bytes are sent through the
+ *              file's coalesced broadcast stream instead (see
+ *              H5_daos_bcast_stream_add()).  Otherwise, if node-local
+ *              broadcasts are enabled on the file, the data is first
+ *              broadcast among the node leaders, then passed to the other
+ *              ranks on each node (see H5_daos_mpi_node_bcast()).
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_mpi_ibcast_task(tse_task_t *task)
+{
+    H5_daos_mpi_ibcast_ud_t *udata;
+    H5_daos_coll_lane_t     *lane;
+    void                    *buffer;
+    int                      count;
+    int                      ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for MPI broadcast task");
+
+    assert(udata->req);
+    assert(udata->req->file);
+    assert(udata->buffer);
+
+    lane        = H5_daos_req_coll_lane(udata->req);
+    udata->lane = lane;
+    buffer      = udata->buffer;
+    count       = udata->count;
+
+    if (udata->prefetch) {
+        if (udata->prefetch_id != 0 && udata->prefetch_id == lane->bcast_prefetch_id) {
+            /* This is a second broadcast following the last first broadcast in
+             * this lane.  Remember how much more data was needed. */
+            assert(count > lane->bcast_prefetch_count);
+            if (count - lane->bcast_prefetch_count > lane->bcast_prefetch_ext)
+                lane->bcast_prefetch_ext =
+                    MIN(count - lane->bcast_prefetch_count, H5_DAOS_BCAST_PREFETCH_MAX);
+            udata->prefetch_id = 0;
+
+            /* Check if the data was already received with the first broadcast */
+            if (count <= lane->bcast_prefetch_len) {
+                assert(lane->bcast_prefetch_buf);
+                if (udata->req->file->my_rank != 0)
+                    (void)memcpy(udata->buffer, lane->bcast_prefetch_buf, (size_t)count);
+                lane->bcast_prefetch_buf = DV_free(lane->bcast_prefetch_buf);
+
+                /* Return task to task list */
+                if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+                    D_GOTO_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                                 "can't return task to task list");
+
+                /* Complete this task */
+                tse_task_complete(task, 0);
+                D_GOTO_DONE(0);
+            } /* end if */
+
+            lane->bcast_prefetch_buf = DV_free(lane->bcast_prefetch_buf);
+        } /* end if */
+        else {
+            /* This is a first broadcast.  Record it so a following second
+             * broadcast can be recognized, and send extra data if a second
+             * broadcast has been needed before. */
+            lane->bcast_prefetch_buf   = DV_free(lane->bcast_prefetch_buf);
+            udata->prefetch_id         = ++lane->bcast_prefetch_id;
+            lane->bcast_prefetch_count = count;
+            lane->bcast_prefetch_len   = count;
+
+            if (lane->bcast_prefetch_ext > 0) {
+                lane->bcast_prefetch_len = count + lane->bcast_prefetch_ext;
+                if (NULL == (lane->bcast_prefetch_buf = DV_calloc((size_t)lane->bcast_prefetch_len)))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                                 "can't allocate broadcast prefetch buffer");
+                if (udata->req->file->my_rank == 0)
+                    (void)memcpy(lane->bcast_prefetch_buf, udata->buffer,
+                                 (size_t)MIN(udata->buffer_len, lane->bcast_prefetch_len));
+                buffer = lane->bcast_prefetch_buf;
+                count  = lane->bcast_prefetch_len;
+            } /* end if */
+        }     /* end else */
+    }         /* end if */
+
+    /* Check for a coalesced broadcast */
+    if (udata->req->file->bcast_stream.comm != MPI_COMM_NULL && count <= H5_DAOS_BCAST_COALESCE_MAX) {
+        if (H5_daos_bcast_stream_add(task, udata, buffer, count) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "can't start coalesced broadcast");
+
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* Check for a node-local broadcast */
+    if (lane->node_bcast.comm != MPI_COMM_NULL) {
+        if (lane->node_bcast.rank == 0 && lane->node_bcast.nleaders > 1) {
+            /* Make sure there is room to track the MPI request */
+            if (H5_daos_mpi_req_table_reserve() < 0)
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't grow MPI request table");
+
+            /* Broadcast to the other node leaders */
+            if (MPI_SUCCESS != MPI_Ibcast(buffer, count, MPI_BYTE, 0, lane->node_bcast.leader_comm,
+                                          &H5_daos_mpi_req_table_g.reqs[H5_daos_mpi_req_table_g.nreqs]))
+                D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Ibcast failed");
+
+            /* Register this task as an in-flight MPI task.  The broadcast
+             * within this node will be started once this finishes. */
+            H5_daos_mpi_req_table_add(task, udata, buffer != udata->buffer, H5_DAOS_MPI_STAGE_INTER_NODE,
+                                      NULL);
+        } /* end if */
+        else if (H5_daos_mpi_node_bcast(task, udata, buffer != udata->buffer) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "can't start node-local broadcast");
+
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* Make sure there is room to track the MPI request */
+    if (H5_daos_mpi_req_table_reserve() < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't grow MPI request table");
+
+    /* Make call to MPI_Ibcast */
+    if (MPI_SUCCESS != MPI_Ibcast(buffer, count, MPI_BYTE, 0, lane->comm,
+                                  &H5_daos_mpi_req_table_g.reqs[H5_daos_mpi_req_table_g.nreqs]))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Ibcast failed");
+
+    /* Register this task as an in-flight MPI task.  If the data is being
+     * received into the prefetch buffer, the progress function will copy it
+     * to udata's buffer */
+    H5_daos_mpi_req_table_add(task, udata, buffer != udata->buffer, H5_DAOS_MPI_STAGE_DONE, NULL);
+
+    /* This task will be completed by the progress function once that function
+     * detects that the MPI request is finished */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_mpi_ibcast_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_mpi_ibarrier_task
+ *
+ * Purpose:     Wraps a call to MPI_Ibarrier in a DAOS/TSE task.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_mpi_ibarrier_task(tse_task_t *task)
+{
+    H5_daos_req_t *req;
+    int            ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (req = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for MPI barrier task");
+
+    assert(req);
+    assert(req->file);
+
+    /* Make sure there is room to track the MPI request */
+    if (H5_daos_mpi_req_table_reserve() < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't grow MPI request table");
+
+    /* Make call to MPI_Ibarrier */
+    if (MPI_SUCCESS != MPI_Ibarrier(H5_daos_req_coll_lane(req)->comm,
+                                    &H5_daos_mpi_req_table_g.reqs[H5_daos_mpi_req_table_g.nreqs]))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Ibarrier failed");
+
+    /* Register this task as an in-flight MPI task */
+    H5_daos_mpi_req_table_add(task, NULL, FALSE, H5_DAOS_MPI_STAGE_DONE, NULL);
+
+    /* This task will be completed by the progress function once that function
+     * detects that the MPI request is finished */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_mpi_ibarrier_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_metatask_autocomp_other
+ *
+ * Purpose:     Body function for a metatask that needs to complete
+ *              itself and another task.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              March, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_metatask_autocomp_other(tse_task_t *task)
+{
+    tse_task_t *other_task = NULL;
+    int         ret_value  = 0;
 
-    /* Mark request as completed */
-    if (ret_value >= 0 && (req->status == -H5_DAOS_INCOMPLETE || req->status == -H5_DAOS_SHORT_CIRCUIT))
-        req->status = 0;
+    /* Get other task */
+    if (NULL == (other_task = (tse_task_t *)tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for autocomplete other metatask");
 
-    /* Complete finalize task in engine */
-    tse_task_complete(req->finalize_task, req->status);
-    req->finalize_task = NULL;
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, other_task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-    /* Complete dep_task.  Always succeeds since the purpose of dep_task is to
-     * prevent errors from propagating. */
-    if (req->dep_task) {
-        tse_task_complete(req->dep_task, 0);
-        req->dep_task = NULL;
+    /* Complete other task */
+    tse_task_complete(other_task, ret_value);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_metatask_autocomp_other() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_metatask_autocomplete
+ *
+ * Purpose:     Body function for a metatask that needs to complete
+ *              itself.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              March, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_metatask_autocomplete(tse_task_t *task)
+{
+    tse_task_complete(task, 0);
+
+    return 0;
+} /* end H5_daos_metatask_autocomplete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_list_key_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos key list
+ *              operations.  Currently checks for errors from previous
+ *              tasks then sets arguments for the DAOS operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_list_key_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_iter_ud_t *udata;
+    daos_obj_list_t   *list_args;
+    int                ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for key list task");
+
+    assert(udata->iter_data->req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->iter_data->req, H5E_VOL);
+
+    assert(udata->target_obj);
+    assert(udata->iter_data->req->file);
+
+    /* Set oh argument */
+    if (NULL == (list_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for key list task");
+    if (udata->iter_data->iter_type == H5_DAOS_ITER_TYPE_MAP) {
+        /* Map iteration lists the dkeys of the object holding the map's
+         * key-value pairs */
+        assert(udata->target_obj->item.type == H5I_MAP);
+        list_args->oh = H5_DAOS_MAP_DATA_OH((H5_daos_map_t *)udata->target_obj);
+    } /* end if */
+    else
+        list_args->oh = udata->target_obj->obj_oh;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_list_key_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_list_key_finish
+ *
+ * Purpose:     Frees key list udata and, if this is the base level of
+ *              iteration, iter data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_list_key_finish(tse_task_t *task)
+{
+    H5_daos_iter_ud_t *udata;
+    H5_daos_req_t     *req = NULL;
+    int                ret;
+    int                ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for iteration task");
+
+    assert(task == udata->iter_metatask);
+
+    /* Assign req convenience pointer.  We do this so we can still handle errors
+     * after freeing.  This should be safe since we don't decrease the ref count
+     * on req until we're done with it. */
+    req = udata->iter_data->req;
+
+    assert(req);
+    assert(req->file);
+
+    /* Finalize iter_data if this is the base of iteration */
+    if (udata->base_iter) {
+        /* Iteration is complete, we are no longer short-circuiting (if this
+         * iteration caused the short circuit) */
+        if (udata->iter_data->short_circuit_init) {
+            if (udata->iter_data->req->status == -H5_DAOS_SHORT_CIRCUIT)
+                udata->iter_data->req->status = -H5_DAOS_INCOMPLETE;
+            udata->iter_data->short_circuit_init = FALSE;
+        } /* end if */
+
+        /* Decrement reference count on root obj id.  Use nonblocking close so
+         * it doesn't deadlock */
+        udata->target_obj->item.nonblocking_close = TRUE;
+        if ((ret = H5Idec_ref(udata->iter_data->iter_root_obj)) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CANTDEC, -H5_DAOS_H5_CLOSE_ERROR,
+                         "can't decrement reference count on iteration base object");
+        if (ret)
+            udata->target_obj->item.nonblocking_close = FALSE;
+        udata->iter_data->iter_root_obj = H5I_INVALID_HID;
+
+        /* Set *op_ret_p if present */
+        if (udata->iter_data->op_ret_p)
+            *udata->iter_data->op_ret_p = udata->iter_data->op_ret;
+
+        /* Free hash table */
+        if (udata->iter_data->iter_type == H5_DAOS_ITER_TYPE_LINK) {
+            udata->iter_data->u.link_iter_data.recursive_link_path =
+                DV_free(udata->iter_data->u.link_iter_data.recursive_link_path);
+
+            if (udata->iter_data->u.link_iter_data.visited_link_table) {
+                dv_hash_table_free(udata->iter_data->u.link_iter_data.visited_link_table);
+                udata->iter_data->u.link_iter_data.visited_link_table = NULL;
+            } /* end if */
+        }     /* end if */
+
+        /* Free iter data */
+        udata->iter_data = DV_free(udata->iter_data);
+    } /* end if */
+    else
+        assert(udata->iter_data->is_recursive);
+
+    /* Close target_obj */
+    if (H5_daos_object_close(&udata->target_obj->item) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+    /* Free buffer */
+    if (udata->sg_iov.iov_buf)
+        DV_free(udata->sg_iov.iov_buf);
+
+    /* Free kds buffer if one was allocated */
+    if (udata->kds_dyn)
+        DV_free(udata->kds_dyn);
+
+    /* Free udata */
+    udata = DV_free(udata);
+
+    /* Handle errors */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status      = ret_value;
+        req->failed_task = "key list finish";
+    } /* end if */
+
+    /* Release req */
+    if (H5_daos_req_free_int(req) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Mark task as complete */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_list_key_finish() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_list_key_start
+ *
+ * Purpose:     Begins listing keys (akeys or dkeys depending on opc)
+ *              asynchronously, calling comp_cb when finished.  iter_udata
+ *              must already be exist and be filled in with valid info.
+ *              Can be used to continue iteration if the first call did
+ *              not return all the keys.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_list_key_start(H5_daos_iter_ud_t *iter_udata, daos_opc_t opc, tse_task_cb_t comp_cb,
+                       tse_task_t **first_task, tse_task_t **dep_task)
+{
+    daos_obj_list_t *list_args;
+    tse_task_t      *list_task = NULL;
+    int              ret;
+    int              ret_value = 0;
+
+    assert(iter_udata);
+    assert(iter_udata->iter_metatask);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Create task for key list */
+    if (H5_daos_create_daos_task(opc, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_list_key_prep_cb, comp_cb, iter_udata, &list_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to list keys");
+
+    /* Get arguments for list operation */
+    if (NULL == (list_args = daos_task_get_args(list_task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for key list task");
+    memset(list_args, 0, sizeof(daos_obj_list_t));
+
+    /* Set arguments */
+    list_args->th  = iter_udata->iter_data->req->th;
+    iter_udata->nr = (uint32_t)iter_udata->kds_len;
+    list_args->nr  = &iter_udata->nr;
+    list_args->kds = iter_udata->kds;
+    list_args->sgl = &iter_udata->sgl;
+    if (opc == DAOS_OPC_OBJ_LIST_DKEY)
+        list_args->dkey_anchor = &iter_udata->anchor;
+    else {
+        assert(opc == DAOS_OPC_OBJ_LIST_AKEY);
+        list_args->dkey        = &iter_udata->dkey;
+        list_args->akey_anchor = &iter_udata->anchor;
     } /* end if */
 
-    /* Propagate errors to parent request */
-    if (req->parent_req && req->status != 0) {
-        req->parent_req->status      = req->status;
-        req->parent_req->failed_task = req->failed_task;
-    } /* end else */
+    /* Schedule list task (or save it to be scheduled later) and give it a
+     * reference to req and target_obj */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(list_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule task to list keys: %s",
+                         H5_daos_err_to_string(ret));
+    }
+    else
+        *first_task = list_task;
+    *dep_task  = iter_udata->iter_metatask;
+    iter_udata = NULL;
 
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+done:
+    /* Cleanup */
+    if (iter_udata) {
+        assert(ret_value < 0);
+        assert(iter_udata->iter_metatask);
+        assert(iter_udata->sg_iov.iov_buf);
 
-    /* Handle errors in this function */
-    /* Do not place any code that can issue errors after this block, except for
-     * H5_daos_req_free_int, which updates req->status if it sees an error */
-    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        req->status      = ret_value;
-        req->failed_task = "transaction commit/abort completion callback";
-    } /* end if */
+        if (*dep_task && 0 != (ret = tse_task_register_deps(iter_udata->iter_metatask, 1, dep_task)))
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't create dependencies for iteration metatask: %s",
+                         H5_daos_err_to_string(ret));
 
-    /* Release our reference to req */
-    if (H5_daos_req_free_int(req) < 0)
-        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+        if (*first_task) {
+            if (0 != (ret = tse_task_schedule(iter_udata->iter_metatask, false)))
+                D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule iteration metatask: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            *first_task = iter_udata->iter_metatask;
+        *dep_task = iter_udata->iter_metatask;
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_tx_comp_cb() */
+} /* end H5_daos_list_key_start() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_h5op_finalize
+ * Function:    H5_daos_list_key_init
  *
- * Purpose:     Task function which is called when an HDF5 operation is
- *              complete.  Commits the transaction if one was opened for
- *              the operation, then releases its reference to req.
+ * Purpose:     Begins listing keys (akeys or dkeys depending on opc)
+ *              asynchronously, calling comp_cb when finished.  Creates a
+ *              metatask in the udata struct's "iter_metatask" field but
+ *              does not schedule it.  It is the responsibility of comp_cb
+ *              to make sure iter_metatask is scheduled such that it
+ *              executes when everything is complete a this level of
+ *              iteration.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ *              key_prefetch_size specifies the number of keys to fetch at
+ *              a time while prefetching keys during the listing operation.
+ *              key_buf_size_init specifies the initial size in bytes of
+ *              the buffer allocated to hold these keys. This buffer will
+ *              be re-allocated as necessary if it is too small to hold the
+ *              keys, but this may incur additional I/O overhead.
  *
- * Programmer:  Neil Fortner
- *              January, 2019
+ *              path_prefix, if not NULL, is the path (ending in '/') from
+ *              the root of an unordered recursive visit to target_obj.
+ *              It is not copied, so the caller must keep it valid until
+ *              iter_metatask completes.
+ *
+ *              If this is the base of iteration and
+ *              iter_data->start_anchor is not NULL, listing starts from a
+ *              copy of that anchor instead of the start of the object.
+ *
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 int
-H5_daos_h5op_finalize(tse_task_t *task)
+H5_daos_list_key_init(H5_daos_iter_data_t *iter_data, H5_daos_obj_t *target_obj, daos_key_t *dkey,
+                      daos_opc_t opc, tse_task_cb_t comp_cb, hbool_t base_iter, const char *path_prefix,
+                      size_t key_prefetch_size, size_t key_buf_size_init, tse_task_t **first_task,
+                      tse_task_t **dep_task)
 {
-    H5_daos_req_t *req;
-    hbool_t        close_tx = FALSE;
-    int            ret;
-    int            ret_value = 0;
+    H5_daos_iter_ud_t *iter_udata = NULL;
+    char              *tmp_alloc  = NULL;
+    int                ret;
+    int                ret_value = 0;
 
-    /* Get private data */
-    if (NULL == (req = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for operation finalize task");
-    assert(task == req->finalize_task);
+    assert(iter_data);
+    assert(target_obj);
+    assert(comp_cb);
+    assert(key_prefetch_size > 0);
+    assert(key_buf_size_init > 0);
+    assert(first_task);
+    assert(dep_task);
 
-    /* Check for error */
-    if (req->status < -H5_DAOS_SHORT_CIRCUIT) {
-        /* Print error message (unless the operation was canceled) */
-        if (req->status < -H5_DAOS_CANCELED)
-            D_DONE_ERROR(H5E_IO, H5E_CANTINIT, req->status, "operation \"%s\" failed in task \"%s\": %s",
-                         req->op_name, req->failed_task, H5_daos_err_to_string(req->status));
+    /* Allocate iter udata */
+    if (NULL == (iter_udata = (H5_daos_iter_ud_t *)DV_calloc(sizeof(H5_daos_iter_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate iteration user data");
 
-        /* Abort transaction if opened */
-        if (req->th_open) {
-            tse_task_t      *abort_task;
-            daos_tx_abort_t *abort_args;
+    /* Fill in user data fields */
+    iter_udata->target_obj = target_obj;
+    if (dkey)
+        iter_udata->dkey = *dkey;
+    else
+        assert(opc == DAOS_OPC_OBJ_LIST_DKEY);
+    iter_udata->base_iter   = base_iter;
+    iter_udata->path_prefix = path_prefix;
+    if (base_iter && iter_data->start_anchor)
+        iter_udata->anchor = *iter_data->start_anchor;
+    else
+        memset(&iter_udata->anchor, 0, sizeof(iter_udata->anchor));
 
-            /* Create task */
-            if (H5_daos_create_daos_task(DAOS_OPC_TX_ABORT, 0, NULL, NULL, H5_daos_tx_comp_cb, req,
-                                         &abort_task) < 0) {
-                close_tx     = TRUE;
-                req->th_open = FALSE;
-                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                             "can't create task to abort transaction");
-            } /* end if */
+    /* Copy iter_data if this is the base of iteration, otherwise point to
+     * existing iter_data */
+    if (base_iter) {
+        if (NULL == (iter_udata->iter_data = (H5_daos_iter_data_t *)DV_malloc(sizeof(H5_daos_iter_data_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate iteration data");
+        memcpy(iter_udata->iter_data, iter_data, sizeof(*iter_data));
+        iter_udata->iter_data->start_anchor = NULL;
+    } /* end if */
+    else
+        iter_udata->iter_data = iter_data;
 
-            /* Set arguments */
-            if (NULL == (abort_args = daos_task_get_args(abort_task))) {
-                close_tx     = TRUE;
-                req->th_open = FALSE;
-                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                             "can't get arguments for transaction abort task");
-            } /* end if */
-            abort_args->th = req->th;
+    /* Allocate kds buffer if necessary */
+    iter_udata->kds     = iter_udata->kds_static;
+    iter_udata->kds_len = key_prefetch_size;
+    if (key_prefetch_size * sizeof(daos_key_desc_t) > sizeof(iter_udata->kds_static)) {
+        if (NULL ==
+            (iter_udata->kds_dyn = (daos_key_desc_t *)DV_malloc(key_prefetch_size * sizeof(daos_key_desc_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate key descriptor buffer");
+        iter_udata->kds = iter_udata->kds_dyn;
+    } /* end if */
 
-            /* Schedule abort task */
-            if (0 != (ret = tse_task_schedule(abort_task, false))) {
-                close_tx     = TRUE;
-                req->th_open = FALSE;
-                tse_task_complete(abort_task, ret_value);
-                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, ret, "can't schedule task to abort transaction: %s",
-                             H5_daos_err_to_string(ret));
-            } /* end if */
-            req->rc++;
-        } /* end if */
-    }     /* end if */
-    else {
-        /* Commit transaction if opened */
-        if (req->th_open) {
-            tse_task_t       *commit_task;
-            daos_tx_commit_t *commit_args;
+    /* Allocate key_buf */
+    if (NULL == (tmp_alloc = (char *)DV_malloc(key_buf_size_init)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for keys");
 
-            /* Create task */
-            if (H5_daos_create_daos_task(DAOS_OPC_TX_COMMIT, 0, NULL, NULL, H5_daos_tx_comp_cb, req,
-                                         &commit_task) < 0) {
-                close_tx     = TRUE;
-                req->th_open = FALSE;
-                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                             "can't create task to commit transaction");
-            } /* end if */
+    /* Set up sg_iov.  Report size as 1 less than buffer size so we always have
+     * room for a null terminator. */
+    daos_iov_set(&iter_udata->sg_iov, tmp_alloc, (daos_size_t)(key_buf_size_init - 1));
 
-            /* Set arguments */
-            if (NULL == (commit_args = daos_task_get_args(commit_task))) {
-                close_tx     = TRUE;
-                req->th_open = FALSE;
-                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                             "can't get arguments for transaction commit task");
-            } /* end if */
-            commit_args->th    = req->th;
-            commit_args->flags = 0;
+    /* Set up sgl */
+    iter_udata->sgl.sg_nr     = 1;
+    iter_udata->sgl.sg_nr_out = 0;
+    iter_udata->sgl.sg_iovs   = &iter_udata->sg_iov;
 
-            /* Schedule commit task */
-            if (0 != (ret = tse_task_schedule(commit_task, false))) {
-                close_tx     = TRUE;
-                req->th_open = FALSE;
-                tse_task_complete(commit_task, ret_value);
-                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, ret, "can't schedule task to commit transaction: %s",
-                             H5_daos_err_to_string(ret));
-            } /* end if */
-            req->rc++;
-        } /* end if */
-    }     /* end else */
+    /* Create meta task for iteration.  This empty task will be completed when
+     * the iteration is finished by comp_cb.  We can't use list_task since it
+     * may not be completed by the first list.  Only free iter_data at the end
+     * if this is the base of iteration. */
+    if (H5_daos_create_task(H5_daos_list_key_finish, 0, NULL, NULL, NULL, iter_udata,
+                            &iter_udata->iter_metatask) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create meta task for iteration");
 
-done:
-    if (req) {
-        /* Check if we failed to start tx commit/abort task */
-        if (close_tx) {
-            /* Close transaction */
-            if (0 != (ret = daos_tx_close(req->th, NULL /*event*/)))
-                D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, ret, "can't close transaction: %s",
-                             H5_daos_err_to_string(ret));
-            req->th_open = FALSE;
-        } /* end if */
+    /* Start list (create tasks) give it a reference to req and target obj, and
+     * transfer ownership of iter_udata */
+    if (0 != (ret = H5_daos_list_key_start(iter_udata, opc, comp_cb, first_task, dep_task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't start iteration");
+    iter_udata->iter_data->req->rc++;
+    iter_udata->target_obj->item.rc++;
+    iter_udata = NULL;
 
-        /* Check if we're done */
-        if (!req->th_open) {
-            /* Make notify callback */
-            if (req->notify_cb)
-                if (req->notify_cb(req->notify_ctx, ret_value >= 0 && (req->status == -H5_DAOS_INCOMPLETE ||
-                                                                       req->status == -H5_DAOS_SHORT_CIRCUIT)
-                                                        ? H5_DAOS_REQ_STATUS_OUT_SUCCEED
-                                                    : req->status == -H5_DAOS_CANCELED
-                                                        ? H5_DAOS_REQ_STATUS_OUT_CANCELED
-                                                        : H5_DAOS_REQ_STATUS_OUT_FAIL) < 0)
-                    D_DONE_ERROR(H5E_VOL, H5E_CANTOPERATE, -H5_DAOS_CALLBACK_ERROR,
-                                 "notify callback returned failure");
+done:
+    /* Cleanup */
+    if (iter_udata) {
+        assert(ret_value < 0);
 
-            /* Clear H5_daos_collective_req_tail if it refers to this request */
-            if (H5_daos_collective_req_tail == req)
-                H5_daos_collective_req_tail = NULL;
+        if (iter_udata->iter_metatask) {
+            /* The metatask should clean everything up */
+            if (iter_udata->iter_metatask != *dep_task) {
+                /* Queue up the metatask */
+                if (*dep_task && 0 != (ret = tse_task_register_deps(iter_udata->iter_metatask, 1, dep_task)))
+                    D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret,
+                                 "can't create dependencies for iteration metatask: %s",
+                                 H5_daos_err_to_string(ret));
 
-            /* Mark request as completed if there were no errors */
-            if (ret_value >= 0 &&
-                (req->status == -H5_DAOS_INCOMPLETE || req->status == -H5_DAOS_SHORT_CIRCUIT))
-                req->status = 0;
+                if (*first_task) {
+                    if (0 != (ret = tse_task_schedule(iter_udata->iter_metatask, false)))
+                        D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule iteration metatask: %s",
+                                     H5_daos_err_to_string(ret));
+                } /* end if */
+                else
+                    *first_task = iter_udata->iter_metatask;
+                *dep_task = iter_udata->iter_metatask;
+            } /* end if */
+        }     /* end if */
+        else {
+            /* No metatask, clean up directly here */
+            /* Free iter_data if this is the base of iteration */
+            if (iter_data->is_recursive && iter_udata->base_iter) {
+                /* Free hash table */
+                if (iter_data->iter_type == H5_DAOS_ITER_TYPE_LINK) {
+                    iter_data->u.link_iter_data.recursive_link_path =
+                        DV_free(iter_data->u.link_iter_data.recursive_link_path);
 
-            /* Return task to task list */
-            if (H5_daos_task_list_put(H5_daos_task_list_g, req->finalize_task) < 0)
-                D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
-                             "can't return task to task list");
+                    if (iter_data->u.link_iter_data.visited_link_table) {
+                        dv_hash_table_free(iter_data->u.link_iter_data.visited_link_table);
+                        iter_data->u.link_iter_data.visited_link_table = NULL;
+                    } /* end if */
+                }     /* end if */
 
-            /* Complete task in engine */
-            tse_task_complete(req->finalize_task, req->status);
-            req->finalize_task = NULL;
+                /* Free iter data */
+                iter_udata->iter_data = DV_free(iter_udata->iter_data);
+            } /* end if */
 
-            /* Complete dep_task.  Always succeeds since the purpose of dep_task
-             * is to prevent errors from propagating. */
-            if (req->dep_task) {
-                tse_task_complete(req->dep_task, 0);
-                req->dep_task = NULL;
+            /* Decrement reference count on root obj id.  Use nonblocking close
+             * so it doesn't deadlock */
+            if (iter_udata->base_iter) {
+                iter_udata->target_obj->item.nonblocking_close = TRUE;
+                if ((ret = H5Idec_ref(iter_data->iter_root_obj)) < 0)
+                    D_DONE_ERROR(H5E_VOL, H5E_CANTDEC, -H5_DAOS_H5_CLOSE_ERROR,
+                                 "can't decrement reference count on iteration base object");
+                if (ret)
+                    iter_udata->target_obj->item.nonblocking_close = FALSE;
             } /* end if */
-        }     /* end if */
 
-        /* Report failures in this routine */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            req->status      = ret_value;
-            req->failed_task = "h5 op finalize";
-        } /* end if */
+            /* Free key buffer */
+            if (iter_udata->sg_iov.iov_buf)
+                DV_free(iter_udata->sg_iov.iov_buf);
 
-        /* Propagate errors to parent request */
-        if (req->parent_req && req->status != 0 && !req->th_open) {
-            req->parent_req->status      = req->status;
-            req->parent_req->failed_task = req->failed_task;
-        } /* end else */
+            /* Free kds buffer if one was allocated */
+            if (iter_udata->kds_dyn)
+                DV_free(iter_udata->kds_dyn);
 
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(req) < 0)
-            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-    } /* end if */
-    else
-        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+            /* Free udata */
+            iter_udata = DV_free(iter_udata);
+        } /* end else */
+    }     /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_h5op_finalize() */
+} /* end H5_daos_list_key_init() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_generic_prep_cb
+ * Function:    H5_daos_obj_open_prep_cb
  *
- * Purpose:     Prepare callback for generic DAOS operations.  Currently
- *              only checks for errors from previous tasks.
+ * Purpose:     Prepare callback for daos_obj_open.  Currently only sets
+ *              the coh and checks for errors from previous tasks.  This
+ *              is only necessary for operations that might otherwise be
+ *              run before file->coh is set up, since daos_obj_open is a
+ *              non-blocking operation.  The other fields in the argument
+ *              struct must have already been filled in.  Since this does
+ *              not hold the object open it must only be used when there
+ *              is a task that depends on it that does so.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -3417,1354 +5911,1831 @@ done:
  *-------------------------------------------------------------------------
  */
 int
-H5_daos_generic_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_obj_open_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_generic_cb_ud_t *udata;
-    int                      ret_value = 0;
+    H5_daos_obj_open_ud_t *udata;
+    daos_obj_open_t       *open_args;
+    int                    ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for generic task");
+                     "can't get private data for object open task");
 
-    assert(udata->req);
+    assert(udata->generic_ud.req);
 
     /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
+    H5_DAOS_PREP_REQ(udata->generic_ud.req, H5E_VOL);
 
-    assert(udata->req->file);
+    assert(udata->file);
+
+    /* Set container open handle and oid in args */
+    if (NULL == (open_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for object open task");
+    open_args->coh = udata->file->coh;
+    open_args->oid = *udata->oid;
 
 done:
     if (ret_value < 0)
         tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_generic_prep_cb() */
+} /* end H5_daos_obj_open_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_generic_comp_cb
- *
- * Purpose:     Complete callback for generic DAOS operations.  Currently
- *              checks for a failed task then frees private data.
+ * Function:    H5_daos_obj_open
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Purpose:     Open a DAOS object object asynchronously.  daos_obj_open
+ *              is a non-blocking call but it might be necessary to insert
+ *              it into the scheduler so it doesn't run until certain
+ *              conditions are met (such as the file's container handle
+ *              being open).  oid must not point to memory that might be
+ *              freed or go out of scope before the open task executes.
  *
- * Programmer:  Neil Fortner
- *              February, 2020
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_generic_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5_daos_obj_open(H5_daos_file_t *file, H5_daos_req_t *req, daos_obj_id_t *oid, unsigned mode,
+                 daos_handle_t *oh, const char *task_name, tse_task_t **first_task, tse_task_t **dep_task)
 {
-    H5_daos_generic_cb_ud_t *udata;
-    int                      ret_value = 0;
+    tse_task_t            *open_task;
+    H5_daos_obj_open_ud_t *open_udata = NULL;
+    daos_obj_open_t       *open_args;
+    int                    ret;
+    herr_t                 ret_value = SUCCEED; /* Return value */
 
-    assert(H5_daos_task_list_g);
+    assert(file);
+    assert(req);
+    assert(oid);
+    assert(first_task);
+    assert(dep_task);
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for generic task");
+    /* Set private data for object open */
+    if (NULL == (open_udata = (H5_daos_obj_open_ud_t *)DV_malloc(sizeof(H5_daos_obj_open_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate user data struct for object open task");
+    open_udata->generic_ud.req       = req;
+    open_udata->generic_ud.task_name = task_name;
+    open_udata->file                 = file;
+    open_udata->oid                  = oid;
 
-    assert(udata->req);
-    assert(udata->req->file || task->dt_result != 0);
+    /* Create task for object open */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_OPEN, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_obj_open_prep_cb, H5_daos_generic_comp_cb, open_udata,
+                                 &open_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to open object");
 
-    /* Handle errors in task.  Only record error in udata->req_status if it does
-     * not already contain an error (it could contain an error if another task
-     * this task is not dependent on also failed). */
-    /* Do not place any code that can issue errors after this block, except for
-     * H5_daos_req_free_int, which updates req->status if it sees an error */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = task->dt_result;
-        udata->req->failed_task = udata->task_name;
+    /* Set arguments for object open (oid will be set later by the prep
+     * callback) */
+    if (NULL == (open_args = daos_task_get_args(open_task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get arguments for object open task");
+    open_args->mode = mode;
+    open_args->oh   = oh;
+
+    /* Schedule object open task (or save it to be scheduled later) and give it
+     * a reference to req */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(open_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to open object: %s",
+                         H5_daos_err_to_string(ret));
     } /* end if */
+    else
+        *first_task = open_task;
+    req->rc++;
+    open_udata = NULL;
+    *dep_task  = open_task;
 
 done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
-    if (udata) {
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-        /* Free private data */
-        DV_free(udata);
-    }
-    else
-        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+    /* Cleanup */
+    if (open_udata) {
+        assert(ret_value < 0);
+        open_udata = DV_free(open_udata);
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_generic_comp_cb() */
+} /* end H5_daos_obj_open() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_md_rw_prep_cb
+ * Function:    H5_daos_mpi_ibcast
  *
- * Purpose:     Prepare callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for metadata I/O.  Currently checks for
- *              errors from previous tasks then sets arguments for the
- *              DAOS operation.
+ * Purpose:     Creates an asynchronous task for broadcasting a buffer.
+ *              `_bcast_udata` may be NULL, in which case this routine will
+ *              allocate a broadcast udata struct and assume an empty
+ *              buffer is to be sent to trigger a failure on other
+ *              processes. If `empty` is TRUE, the buffer will be memset
+ *              with 0. `prefetch` must be TRUE if the broadcast may be
+ *              followed by a second broadcast with the same udata to send
+ *              the rest of rank 0's buffer, and must be the same on all
+ *              ranks (see H5_daos_mpi_ibcast_task).
  *
  * Return:      Success:        0
  *              Failure:        Error code
  *
- * Programmer:  Neil Fortner
- *              January, 2019
- *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_md_rw_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5_daos_mpi_ibcast(H5_daos_mpi_ibcast_ud_t *_bcast_udata, H5_daos_obj_t *obj, size_t buffer_size,
+                   hbool_t empty, hbool_t prefetch, tse_task_cb_t bcast_prep_cb,
+                   tse_task_cb_t bcast_comp_cb, H5_daos_req_t *req, tse_task_t **first_task,
+                   tse_task_t **dep_task)
 {
-    H5_daos_md_rw_cb_ud_t *udata;
-    daos_obj_rw_t         *update_args;
-    int                    ret_value = 0;
+    H5_daos_mpi_ibcast_ud_t *bcast_udata = _bcast_udata;
+    H5_daos_item_t          *item        = (H5_daos_item_t *)obj;
+    tse_task_t              *bcast_task;
+    int                      ret;
+    herr_t                   ret_value = SUCCEED;
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for metadata I/O task");
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-    assert(udata->req);
-    assert(udata->obj);
+    /* Allocate bcast_udata if necessary */
+    if (!bcast_udata) {
+        if (NULL == (bcast_udata = (H5_daos_mpi_ibcast_ud_t *)DV_calloc(sizeof(H5_daos_mpi_ibcast_ud_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                         "failed to allocate buffer for MPI broadcast user data");
+        bcast_udata->req  = req;
+        bcast_udata->obj  = obj;
+    } /* end if */
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_VOL);
+    /* Allocate bcast_udata's buffer if necessary */
+    if (!bcast_udata->buffer) {
+        if (NULL == (bcast_udata->buffer = DV_calloc(buffer_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "failed to allocate MPI broadcast buffer");
+        bcast_udata->buffer_len = (int)buffer_size;
+        bcast_udata->count      = (int)buffer_size;
+    } /* end if */
+    else {
+        assert(bcast_udata->buffer_len == (int)buffer_size);
+        assert(bcast_udata->count == (int)buffer_size);
+        if (empty)
+            memset(bcast_udata->buffer, 0, buffer_size);
+    } /* end else */
+    bcast_udata->prefetch    = prefetch;
+    bcast_udata->prefetch_id = 0;
 
-    assert(udata->obj->item.file);
+    /* Create meta task for bcast.  This empty task will be completed when
+     * the bcast is finished by the completion callback. We can't use
+     * bcast_task since it may not be completed after the first bcast. */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &bcast_udata->bcast_metatask) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create meta task for empty buffer broadcast");
 
-    /* Set update task arguments */
-    if (NULL == (update_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for metadata I/O task");
-    memset(update_args, 0, sizeof(*update_args));
-    update_args->oh    = udata->obj->obj_oh;
-    update_args->th    = udata->req->th;
-    update_args->flags = udata->flags;
-    update_args->dkey  = &udata->dkey;
-    update_args->nr    = udata->nr;
-    update_args->iods  = udata->iod;
-    update_args->sgls  = udata->sgl;
+    /* Create task for bcast */
+    if (H5_daos_create_task(H5_daos_mpi_ibcast_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            bcast_prep_cb, bcast_comp_cb, bcast_udata, &bcast_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to broadcast empty buffer");
+
+    /* Schedule meta task */
+    if (0 != (ret = tse_task_schedule(bcast_udata->bcast_metatask, false)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule meta task for empty buffer broadcast: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Schedule bcast task and transfer ownership of bcast_udata */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(bcast_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task for empty buffer broadcast: %s",
+                         H5_daos_err_to_string(ret));
+        else {
+            req->rc++;
+            if (item)
+                item->rc++;
+            *dep_task   = bcast_udata->bcast_metatask;
+            bcast_udata = NULL;
+        } /* end else */
+    }     /* end if */
+    else {
+        *first_task = bcast_task;
+        req->rc++;
+        if (item)
+            item->rc++;
+        *dep_task   = bcast_udata->bcast_metatask;
+        bcast_udata = NULL;
+    } /* end else */
 
 done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
+    /* Cleanup on failure */
+    if (bcast_udata) {
+        DV_free(bcast_udata->buffer);
+        DV_free(bcast_udata);
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_md_rw_prep_cb() */
+} /* end H5_daos_mpi_ibcast() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_md_update_comp_cb
+ * Function:    H5_daos_collective_error_check
  *
- * Purpose:     Complete callback for asynchronous daos_obj_update for
- *              metadata writes.  Currently checks for a failed task then
- *              frees private data.
+ * Purpose:     Creates an asynchronous task for broadcasting the status of
+ *              a collective asynchronous operation. `_bcast_udata` may be
+ *              NULL, in which case this routine will allocate a broadcast
+ *              udata struct and assume an empty buffer is to be sent to
+ *              trigger a failure on other processes.  If the file batches
+ *              collective error checks, no tasks are created and the check
+ *              is deferred until the request finalizes.
  *
  * Return:      Success:        0
  *              Failure:        Error code
  *
- * Programmer:  Neil Fortner
- *              January, 2019
- *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_md_update_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5_daos_collective_error_check(H5_daos_obj_t *obj, H5_daos_req_t *req, tse_task_t **first_task,
+                               tse_task_t **dep_task)
 {
-    H5_daos_md_rw_cb_ud_t *udata;
-    unsigned               i;
-    int                    ret_value = 0;
-
-    assert(H5_daos_task_list_g);
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for metadata I/O task");
-
-    /* Handle errors in update task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = task->dt_result;
-        udata->req->failed_task = udata->task_name;
-    } /* end if */
-
-    /* Close object */
-    if (udata->obj && H5_daos_object_close(&udata->obj->item) < 0)
-        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+    herr_t ret_value = SUCCEED;
 
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    assert(req);
+    assert(req->file->num_procs > 1);
+    assert(first_task);
+    assert(dep_task);
 
-    /* Handle errors in this function */
-    /* Do not place any code that can issue errors after this block, except for
-     * H5_daos_req_free_int, which updates req->status if it sees an error */
-    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = ret_value;
-        udata->req->failed_task = udata->task_name;
+    /* If collective error checks are batched on this file, just mark the
+     * request.  Its status is checked along with other deferred requests by
+     * the next flush (see H5_daos_collective_error_check_flush()). */
+    if (req->file->fapl_cache.coll_err_batch > 0) {
+        req->collective.deferred = TRUE;
+        D_GOTO_DONE(SUCCEED);
     } /* end if */
 
-    /* Release our reference to req */
-    if (H5_daos_req_free_int(udata->req) < 0)
-        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+    /* Setup the request's bcast udata structure for broadcasting the operation status */
+    req->collective.coll_status                 = 0;
+    req->collective.err_check_ud.req            = req;
+    req->collective.err_check_ud.obj            = obj;
+    req->collective.err_check_ud.buffer         = &req->collective.coll_status;
+    req->collective.err_check_ud.buffer_len     = sizeof(req->collective.coll_status);
+    req->collective.err_check_ud.count          = req->collective.err_check_ud.buffer_len;
+    req->collective.err_check_ud.bcast_metatask = NULL;
+    req->collective.err_check_ud.lane           = NULL;
 
-    /* Free private data */
-    if (udata->free_dkey)
-        DV_free(udata->dkey.iov_buf);
-    if (udata->free_akeys)
-        for (i = 0; i < udata->nr; i++)
-            DV_free(udata->iod[i].iod_name.iov_buf);
-    for (i = 0; i < udata->nr; i++)
-        if (udata->free_sg_iov[i])
-            DV_free(udata->sg_iov[i].iov_buf);
-    DV_free(udata);
+    if (H5_daos_mpi_ibcast(&req->collective.err_check_ud, obj, sizeof(req->collective.coll_status), FALSE,
+                           FALSE, (req->file->my_rank == 0) ? H5_daos_collective_error_check_prep_cb : NULL,
+                           H5_daos_collective_error_check_comp_cb, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't broadcast collective operation status");
 
 done:
     D_FUNC_LEAVE;
-} /* end H5_daos_md_update_comp_cb() */
+} /* end H5_daos_collective_error_check() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_mpi_ibcast_task
+ * Function:    H5_daos_collective_error_check_prep_cb
  *
- * Purpose:     Wraps a call to MPI_Ibcast in a DAOS/TSE task.
+ * Purpose:     Prepare callback for asynchronous MPI_Ibcast to broadcast
+ *              the result status of a collective operation. Currently just
+ *              sets the value for the status buffer on rank 0. Only meant
+ *              to be called by the rank that is the root of broadcasting
+ *              (usually rank 0).
  *
  * Return:      Success:        0
  *              Failure:        Error code
  *
- * Programmer:  Neil Fortner
- *              January, 2020
- *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_mpi_ibcast_task(tse_task_t *task)
+static int
+H5_daos_collective_error_check_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
     H5_daos_mpi_ibcast_ud_t *udata;
     int                      ret_value = 0;
 
-    assert(!H5_daos_mpi_task_g);
-
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
                      "can't get private data for MPI broadcast task");
 
     assert(udata->req);
+    assert(udata->req->file->my_rank == 0);
     assert(udata->buffer);
+    assert(udata->buffer_len == sizeof(udata->req->status));
 
-    /* Make call to MPI_Ibcast */
-    if (MPI_SUCCESS != MPI_Ibcast(udata->buffer, udata->count, MPI_BYTE, 0, udata->comm, &H5_daos_mpi_req_g))
-        D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Ibcast failed");
-
-    /* Register this task as the current in-flight MPI task */
-    H5_daos_mpi_task_g = task;
-
-    /* This task will be completed by the progress function once that function
-     * detects that the MPI request is finished */
+    *((int *)udata->buffer) = udata->req->status;
 
 done:
     D_FUNC_LEAVE;
-} /* end H5_daos_mpi_ibcast_task() */
+} /* end H5_daos_collective_error_check_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_mpi_ibarrier_task
+ * Function:    H5_daos_collective_error_check_comp_cb
  *
- * Purpose:     Wraps a call to MPI_Ibarrier in a DAOS/TSE task.
+ * Purpose:     Complete callback for asynchronous MPI_Ibcast to broadcast
+ *              the result status of a collective operation. Currently
+ *              checks for a failed task, checks the status buffer to
+ *              determine whether an error occurred on the broadcasting
+ *              root rank, and then frees private data. Meant to be called
+ *              by all ranks.
  *
  * Return:      Success:        0
  *              Failure:        Error code
  *
- * Programmer:  Neil Fortner
- *              November, 2020
- *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_mpi_ibarrier_task(tse_task_t *task)
+static int
+H5_daos_collective_error_check_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_req_t *req;
-    int            ret_value = 0;
-
-    assert(!H5_daos_mpi_task_g);
+    H5_daos_mpi_ibcast_ud_t *udata;
+    int                      ret_value = 0;
 
     /* Get private data */
-    if (NULL == (req = tse_task_get_priv(task)))
+    if (NULL == (udata = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for MPI barrier task");
+                     "can't get private data for MPI broadcast task");
 
-    assert(req);
-    assert(req->file);
+    assert(udata->req);
+    assert(udata->buffer);
+    assert(udata->buffer_len == sizeof(udata->req->status));
 
-    /* Make call to MPI_Ibarrier */
-    if (MPI_SUCCESS != MPI_Ibarrier(req->file->comm, &H5_daos_mpi_req_g))
-        D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Ibarrier failed");
+    /* Handle errors in broadcast task.  Only record error in
+     * udata->req_status if it does not already contain an error (it could
+     * contain an error if another task this task is not dependent on also
+     * failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "MPI_Ibcast of collective operation status";
+    } /* end if */
+    else if ((task->dt_result == 0) && (udata->req->file->my_rank != 0)) {
+        int *status_buf = (int *)udata->buffer;
+
+        assert(*status_buf != -H5_DAOS_PRE_ERROR);
+        if ((*status_buf) <= -H5_DAOS_H5_OPEN_ERROR) {
+            udata->req->status      = -H5_DAOS_REMOTE_ERROR;
+            udata->req->failed_task = "remote task";
+        } /* end if */
+    }     /* end else */
+
+done:
+    if (udata) {
+        /* Close object */
+        if (udata->obj && H5_daos_object_close(&udata->obj->item) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-    /* Register this task as the current in-flight MPI task */
-    H5_daos_mpi_task_g = task;
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, udata->bcast_metatask) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-    /* This task will be completed by the progress function once that function
-     * detects that the MPI request is finished */
+        /* Complete bcast metatask */
+        tse_task_complete(udata->bcast_metatask, ret_value);
+    } /* end if */
+    else
+        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
-done:
     D_FUNC_LEAVE;
-} /* end H5_daos_mpi_ibarrier_task() */
+} /* end H5_daos_collective_error_check_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_metatask_autocomp_other
- *
- * Purpose:     Body function for a metatask that needs to complete
- *              itself and another task.
- *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Function:    H5_daos_collective_error_check_flush
+ *
+ * Purpose:     Checks all collective error checks deferred on the file
+ *              since the last flush.  Creates an internal collective
+ *              request whose task issues a single MPI_Iallreduce over the
+ *              statuses of all deferred requests once they have
+ *              finalized.  The request is a barrier across all of the
+ *              file's collective lanes, so the batch contains the same
+ *              requests on all ranks, though not necessarily in the same
+ *              order.  Must be called collectively, and does nothing if
+ *              no checks were deferred.
  *
- * Programmer:  Neil Fortner
- *              March, 2020
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_metatask_autocomp_other(tse_task_t *task)
+herr_t
+H5_daos_collective_error_check_flush(H5_daos_file_t *file)
 {
-    tse_task_t *other_task = NULL;
-    int         ret_value  = 0;
+    H5_daos_req_t *int_req    = NULL;
+    tse_task_t    *first_task = NULL;
+    tse_task_t    *dep_task   = NULL;
+    int            ret;
+    herr_t         ret_value = SUCCEED;
 
-    /* Get other task */
-    if (NULL == (other_task = (tse_task_t *)tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for autocomplete other metatask");
+    assert(file);
 
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, other_task) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    /* Check if there is anything to do */
+    if (file->coll_err_batch.nqueued == 0)
+        D_GOTO_DONE(SUCCEED);
 
-    /* Complete other task */
-    tse_task_complete(other_task, ret_value);
+    /* Start a new batch */
+    file->coll_err_batch.nqueued = 0;
+    file->coll_err_batch.flush_gen++;
 
-done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    /* Start internal H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(file, "deferred collective error check", NULL, NULL, NULL,
+                                              H5I_INVALID_HID)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't create DAOS request");
 
-    tse_task_complete(task, ret_value);
+    /* Wait for the requests in all collective lanes */
+    int_req->collective.barrier = TRUE;
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_metatask_autocomp_other() */
+    /* Create task to check the batch */
+    if (H5_daos_create_task(H5_daos_coll_err_batch_task, 0, NULL, NULL, NULL, int_req, &first_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to check deferred collective errors");
 
-/*-------------------------------------------------------------------------
- * Function:    H5_daos_metatask_autocomplete
- *
- * Purpose:     Body function for a metatask that needs to complete
- *              itself.
- *
- * Return:      Success:        0
- *              Failure:        Error code
- *
- * Programmer:  Neil Fortner
- *              March, 2020
- *
- *-------------------------------------------------------------------------
- */
-int
-H5_daos_metatask_autocomplete(tse_task_t *task)
-{
-    tse_task_complete(task, 0);
+    /* Task now owns a reference to req */
+    dep_task = first_task;
+    int_req->rc++;
 
-    return 0;
-} /* end H5_daos_metatask_autocomplete() */
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the collective request queue, after all
+         * requests in the batch */
+        if (H5_daos_req_enqueue(int_req, first_task, &file->item, H5_DAOS_OP_TYPE_NOPOOL,
+                                H5_DAOS_OP_SCOPE_FILE, TRUE, FALSE) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Release our reference to int_req */
+        if (H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_collective_error_check_flush() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_list_key_prep_cb
+ * Function:    H5_daos_coll_err_batch_add
  *
- * Purpose:     Prepare callback for asynchronous daos key list
- *              operations.  Currently checks for errors from previous
- *              tasks then sets arguments for the DAOS operation.
- *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Purpose:     Adds a finalized request to its file's batch of deferred
+ *              collective error checks, if its check was deferred.  The
+ *              batch takes a reference to the request, which stays
+ *              pending until the batch is checked.
  *
- * Programmer:  Neil Fortner
- *              January, 2019
+ * Return:      TRUE if the request was added/FALSE otherwise
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_list_key_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static hbool_t
+H5_daos_coll_err_batch_add(H5_daos_req_t *req)
 {
-    H5_daos_iter_ud_t *udata;
-    daos_obj_list_t   *list_args;
-    int                ret_value = 0;
+    H5_daos_coll_err_batch_t *batch;
+    hbool_t                   ret_value = FALSE;
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for key list task");
+    assert(req);
 
-    assert(udata->iter_data->req);
+    /* Only requests that were added to the collective request queue can be
+     * batched, since the batch must be identical on all ranks */
+    if (!req->collective.ordered || req->collective.pending)
+        D_GOTO_DONE(FALSE);
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->iter_data->req, H5E_VOL);
+    /* Append to batch */
+    batch                         = &req->file->coll_err_batch;
+    req->collective.next_deferred = NULL;
+    if (batch->tail)
+        batch->tail->collective.next_deferred = req;
+    else
+        batch->head = req;
+    batch->tail = req;
+    batch->nreqs++;
 
-    assert(udata->target_obj);
-    assert(udata->iter_data->req->file);
+    /* Mark request as pending and take a reference for the batch */
+    req->collective.pending = TRUE;
+    req->rc++;
 
-    /* Set oh argument */
-    if (NULL == (list_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for key list task");
-    list_args->oh = udata->target_obj->obj_oh;
+    ret_value = TRUE;
 
 done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
-
     D_FUNC_LEAVE;
-} /* end H5_daos_list_key_prep_cb() */
+} /* end H5_daos_coll_err_batch_add() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_list_key_finish
+ * Function:    H5_daos_coll_err_batch_task
  *
- * Purpose:     Frees key list udata and, if this is the base level of
- *              iteration, iter data.
+ * Purpose:     Asynchronous task that takes the file's current batch of
+ *              deferred collective error checks and starts an
+ *              MPI_Iallreduce over the statuses of the requests in it.
+ *              The requests are resolved in
+ *              H5_daos_coll_err_batch_comp_cb() once the reduction
+ *              completes.  This task completes itself immediately so
+ *              following collective operations are not held up.
  *
  * Return:      Success:        0
  *              Failure:        Error code
  *
- * Programmer:  Neil Fortner
- *              January, 2020
- *
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_list_key_finish(tse_task_t *task)
+H5_daos_coll_err_batch_task(tse_task_t *task)
 {
-    H5_daos_iter_ud_t *udata;
-    H5_daos_req_t     *req = NULL;
-    int                ret;
-    int                ret_value = 0;
+    H5_daos_req_t               *req        = NULL;
+    H5_daos_coll_err_batch_ud_t *udata      = NULL;
+    H5_daos_req_t               *batch_head = NULL;
+    H5_daos_req_t               *tmp_req;
+    tse_task_t                  *check_task = NULL;
+    int                          nreqs;
+    int                          i;
+    int                          ret;
+    int                          ret_value = 0;
+
+    assert(H5_daos_task_list_g);
 
     /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
+    if (NULL == (req = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for iteration task");
-
-    assert(task == udata->iter_metatask);
-
-    /* Assign req convenience pointer.  We do this so we can still handle errors
-     * after freeing.  This should be safe since we don't decrease the ref count
-     * on req until we're done with it. */
-    req = udata->iter_data->req;
-
-    assert(req);
-    assert(req->file);
-
-    /* Finalize iter_data if this is the base of iteration */
-    if (udata->base_iter) {
-        /* Iteration is complete, we are no longer short-circuiting (if this
-         * iteration caused the short circuit) */
-        if (udata->iter_data->short_circuit_init) {
-            if (udata->iter_data->req->status == -H5_DAOS_SHORT_CIRCUIT)
-                udata->iter_data->req->status = -H5_DAOS_INCOMPLETE;
-            udata->iter_data->short_circuit_init = FALSE;
-        } /* end if */
-
-        /* Decrement reference count on root obj id.  Use nonblocking close so
-         * it doesn't deadlock */
-        udata->target_obj->item.nonblocking_close = TRUE;
-        if ((ret = H5Idec_ref(udata->iter_data->iter_root_obj)) < 0)
-            D_DONE_ERROR(H5E_LINK, H5E_CANTDEC, -H5_DAOS_H5_CLOSE_ERROR,
-                         "can't decrement reference count on iteration base object");
-        if (ret)
-            udata->target_obj->item.nonblocking_close = FALSE;
-        udata->iter_data->iter_root_obj = H5I_INVALID_HID;
+                     "can't get private data for collective error check task");
+
+    /* Take the current batch.  Do not check for errors in previous tasks
+     * here, the reduction must be made on all ranks. */
+    batch_head                      = req->file->coll_err_batch.head;
+    nreqs                           = req->file->coll_err_batch.nreqs;
+    req->file->coll_err_batch.head  = NULL;
+    req->file->coll_err_batch.tail  = NULL;
+    req->file->coll_err_batch.nreqs = 0;
+    if (nreqs == 0)
+        D_GOTO_DONE(0);
+
+    /* Allocate udata */
+    if (NULL == (udata = (H5_daos_coll_err_batch_ud_t *)DV_calloc(sizeof(H5_daos_coll_err_batch_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate user data struct for collective error check");
+    if (NULL == (udata->reqs = (H5_daos_req_t **)DV_malloc((size_t)nreqs * sizeof(H5_daos_req_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate request array for collective error check");
+    if (NULL == (udata->status = (int *)DV_malloc((size_t)nreqs * sizeof(int))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate status buffer for collective error check");
+
+    /* Take the requests out of the batch list */
+    for (tmp_req = batch_head, i = 0; tmp_req; tmp_req = tmp_req->collective.next_deferred, i++) {
+        assert(i < nreqs);
+        udata->reqs[i] = tmp_req;
+    } /* end for */
+    assert(i == nreqs);
+    udata->nreqs = nreqs;
+    batch_head   = NULL;
+
+    /* Requests in different collective lanes can finalize in a different
+     * order on each rank, so sort the batch by issue order */
+    qsort(udata->reqs, (size_t)nreqs, sizeof(H5_daos_req_t *), H5_daos_coll_err_batch_cmp);
+
+    /* Fill in local statuses.  The minimum over all ranks is the first error
+     * on any rank. */
+    for (i = 0; i < nreqs; i++)
+        udata->status[i] =
+            udata->reqs[i]->status < -H5_DAOS_SHORT_CIRCUIT ? udata->reqs[i]->status : 0;
+
+    /* Create task to track the reduction, completed by the MPI request
+     * table */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, H5_daos_coll_err_batch_comp_cb, udata, &check_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create task for collective error check");
+    if (0 != (ret = tse_task_schedule(check_task, false)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule task for collective error check: %s",
+                     H5_daos_err_to_string(ret));
 
-        /* Set *op_ret_p if present */
-        if (udata->iter_data->op_ret_p)
-            *udata->iter_data->op_ret_p = udata->iter_data->op_ret;
+    /* Start reduction */
+    if (H5_daos_mpi_req_table_reserve() < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't grow MPI request table");
+    if (MPI_SUCCESS != MPI_Iallreduce(MPI_IN_PLACE, udata->status, nreqs, MPI_INT, MPI_MIN,
+                                      H5_daos_req_coll_lane(req)->comm,
+                                      &H5_daos_mpi_req_table_g.reqs[H5_daos_mpi_req_table_g.nreqs]))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Iallreduce failed");
+    H5_daos_mpi_req_table_add(check_task, NULL, FALSE, H5_DAOS_MPI_STAGE_DONE, NULL);
 
-        /* Free hash table */
-        if (udata->iter_data->iter_type == H5_DAOS_ITER_TYPE_LINK) {
-            udata->iter_data->u.link_iter_data.recursive_link_path =
-                DV_free(udata->iter_data->u.link_iter_data.recursive_link_path);
+    /* udata is now owned by check_task */
+    udata      = NULL;
+    check_task = NULL;
 
-            if (udata->iter_data->u.link_iter_data.visited_link_table) {
-                dv_hash_table_free(udata->iter_data->u.link_iter_data.visited_link_table);
-                udata->iter_data->u.link_iter_data.visited_link_table = NULL;
-            } /* end if */
-        }     /* end if */
+done:
+    if (check_task) {
+        assert(ret_value < 0);
 
-        /* Free iter data */
-        udata->iter_data = DV_free(udata->iter_data);
+        /* Complete check task, which resolves the batch with the error */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, check_task) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(check_task, ret_value);
+        udata = NULL;
     } /* end if */
-    else
-        assert(udata->iter_data->is_recursive);
-
-    /* Close target_obj */
-    if (H5_daos_object_close(&udata->target_obj->item) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
-
-    /* Free buffer */
-    if (udata->sg_iov.iov_buf)
-        DV_free(udata->sg_iov.iov_buf);
+    else if (udata || batch_head) {
+        assert(ret_value < 0);
 
-    /* Free kds buffer if one was allocated */
-    if (udata->kds_dyn)
-        DV_free(udata->kds_dyn);
+        /* Resolve any requests taken from the batch with the error */
+        if (udata)
+            for (i = 0; i < udata->nreqs; i++)
+                (void)H5_daos_coll_err_batch_resolve(udata->reqs[i], ret_value);
+        for (tmp_req = batch_head; tmp_req; tmp_req = batch_head) {
+            batch_head = tmp_req->collective.next_deferred;
+            (void)H5_daos_coll_err_batch_resolve(tmp_req, ret_value);
+        } /* end for */
+
+        if (udata) {
+            DV_free(udata->reqs);
+            DV_free(udata->status);
+            udata = DV_free(udata);
+        } /* end if */
+    } /* end if */
 
-    /* Free udata */
-    udata = DV_free(udata);
+    if (req) {
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            req->status      = ret_value;
+            req->failed_task = "collective error check";
+        } /* end if */
 
-    /* Handle errors */
-    /* Do not place any code that can issue errors after this block, except for
-     * H5_daos_req_free_int, which updates req->status if it sees an error */
-    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        req->status      = ret_value;
-        req->failed_task = "key list finish";
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(req) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
     } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
-    /* Release req */
-    if (H5_daos_req_free_int(req) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-done:
     /* Return task to task list */
     if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
         D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-    /* Mark task as complete */
+    /* Complete this task */
     tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_list_key_finish() */
+} /* end H5_daos_coll_err_batch_task() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_list_key_start
+ * Function:    H5_daos_coll_err_batch_cmp
  *
- * Purpose:     Begins listing keys (akeys or dkeys depending on opc)
- *              asynchronously, calling comp_cb when finished.  iter_udata
- *              must already be exist and be filled in with valid info.
- *              Can be used to continue iteration if the first call did
- *              not return all the keys.
+ * Purpose:     qsort() callback that orders the requests in a batch of
+ *              deferred collective error checks by the position in the
+ *              issue order they were assigned when they were enqueued.
  *
- * Return:      Non-negative on success/Negative on failure
+ * Return:      Negative, zero or positive, like strcmp()
  *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_list_key_start(H5_daos_iter_ud_t *iter_udata, daos_opc_t opc, tse_task_cb_t comp_cb,
-                       tse_task_t **first_task, tse_task_t **dep_task)
-{
-    daos_obj_list_t *list_args;
-    tse_task_t      *list_task = NULL;
-    int              ret;
-    int              ret_value = 0;
-
-    assert(iter_udata);
-    assert(iter_udata->iter_metatask);
-    assert(first_task);
-    assert(dep_task);
-
-    /* Create task for key list */
-    if (H5_daos_create_daos_task(opc, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_list_key_prep_cb, comp_cb, iter_udata, &list_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to list keys");
-
-    /* Get arguments for list operation */
-    if (NULL == (list_args = daos_task_get_args(list_task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for key list task");
-    memset(list_args, 0, sizeof(daos_obj_list_t));
-
-    /* Set arguments */
-    list_args->th  = iter_udata->iter_data->req->th;
-    iter_udata->nr = (uint32_t)iter_udata->kds_len;
-    list_args->nr  = &iter_udata->nr;
-    list_args->kds = iter_udata->kds;
-    list_args->sgl = &iter_udata->sgl;
-    if (opc == DAOS_OPC_OBJ_LIST_DKEY)
-        list_args->dkey_anchor = &iter_udata->anchor;
-    else {
-        assert(opc == DAOS_OPC_OBJ_LIST_AKEY);
-        list_args->dkey        = &iter_udata->dkey;
-        list_args->akey_anchor = &iter_udata->anchor;
-    } /* end if */
+static int
+H5_daos_coll_err_batch_cmp(const void *req1, const void *req2)
+{
+    const H5_daos_req_t *r1 = *(H5_daos_req_t *const *)req1;
+    const H5_daos_req_t *r2 = *(H5_daos_req_t *const *)req2;
 
-    /* Schedule list task (or save it to be scheduled later) and give it a
-     * reference to req and target_obj */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(list_task, false)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule task to list keys: %s",
-                         H5_daos_err_to_string(ret));
-    }
-    else
-        *first_task = list_task;
-    *dep_task  = iter_udata->iter_metatask;
-    iter_udata = NULL;
+    if (r1->collective.seq != r2->collective.seq)
+        return r1->collective.seq < r2->collective.seq ? -1 : 1;
 
-done:
-    /* Cleanup */
-    if (iter_udata) {
-        assert(ret_value < 0);
-        assert(iter_udata->iter_metatask);
-        assert(iter_udata->sg_iov.iov_buf);
+    return (r1->collective.sub_seq > r2->collective.sub_seq) -
+           (r1->collective.sub_seq < r2->collective.sub_seq);
+} /* end H5_daos_coll_err_batch_cmp() */
 
-        if (*dep_task && 0 != (ret = tse_task_register_deps(iter_udata->iter_metatask, 1, dep_task)))
-            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't create dependencies for iteration metatask: %s",
-                         H5_daos_err_to_string(ret));
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_err_batch_comp_cb
+ *
+ * Purpose:     Complete callback for the MPI_Iallreduce of a batch of
+ *              deferred collective error checks.  Marks each request in
+ *              the batch that failed on another rank as failed, then
+ *              resolves all requests in the batch.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_err_batch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_coll_err_batch_ud_t *udata;
+    int                          err;
+    int                          i;
+    int                          ret_value = 0;
 
-        if (*first_task) {
-            if (0 != (ret = tse_task_schedule(iter_udata->iter_metatask, false)))
-                D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule iteration metatask: %s",
-                             H5_daos_err_to_string(ret));
-        } /* end if */
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for collective error check task");
+
+    /* Resolve each request, attributing remote failures to the request that
+     * failed */
+    for (i = 0; i < udata->nreqs; i++) {
+        if (task->dt_result != 0)
+            err = task->dt_result;
+        else if (udata->status[i] <= -H5_DAOS_H5_OPEN_ERROR)
+            err = -H5_DAOS_REMOTE_ERROR;
         else
-            *first_task = iter_udata->iter_metatask;
-        *dep_task = iter_udata->iter_metatask;
+            err = 0;
+
+        if (H5_daos_coll_err_batch_resolve(udata->reqs[i], err) < 0)
+            ret_value = -H5_DAOS_CALLBACK_ERROR;
+    } /* end for */
+
+done:
+    if (udata) {
+        DV_free(udata->reqs);
+        DV_free(udata->status);
+        udata = DV_free(udata);
     } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_list_key_start() */
+} /* end H5_daos_coll_err_batch_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_list_key_init
+ * Function:    H5_daos_coll_err_batch_resolve
  *
- * Purpose:     Begins listing keys (akeys or dkeys depending on opc)
- *              asynchronously, calling comp_cb when finished.  Creates a
- *              metatask in the udata struct's "iter_metatask" field but
- *              does not schedule it.  It is the responsibility of comp_cb
- *              to make sure iter_metatask is scheduled such that it
- *              executes when everything is complete a this level of
- *              iteration.
- *
- *              key_prefetch_size specifies the number of keys to fetch at
- *              a time while prefetching keys during the listing operation.
- *              key_buf_size_init specifies the initial size in bytes of
- *              the buffer allocated to hold these keys. This buffer will
- *              be re-allocated as necessary if it is too small to hold the
- *              keys, but this may incur additional I/O overhead.
+ * Purpose:     Completes a request whose collective error check was
+ *              deferred, once the check is done.  err is recorded as the
+ *              request's status if it is an error and the request did not
+ *              already fail.  Then makes the notify callback, propagates
+ *              errors to the parent request and releases the batch's
+ *              reference to the request.
  *
- * Return:      Non-negative on success/Negative on failure
+ * Return:      Success:        0
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_list_key_init(H5_daos_iter_data_t *iter_data, H5_daos_obj_t *target_obj, daos_key_t *dkey,
-                      daos_opc_t opc, tse_task_cb_t comp_cb, hbool_t base_iter, size_t key_prefetch_size,
-                      size_t key_buf_size_init, tse_task_t **first_task, tse_task_t **dep_task)
+static int
+H5_daos_coll_err_batch_resolve(H5_daos_req_t *req, int err)
 {
-    H5_daos_iter_ud_t *iter_udata = NULL;
-    char              *tmp_alloc  = NULL;
-    int                ret;
-    int                ret_value = 0;
+    int ret_value = 0;
 
-    assert(iter_data);
-    assert(target_obj);
-    assert(comp_cb);
-    assert(key_prefetch_size > 0);
-    assert(key_buf_size_init > 0);
-    assert(first_task);
-    assert(dep_task);
+    assert(req);
+    assert(req->collective.pending);
+
+    /* Record error */
+    if (err < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status      = err;
+        req->failed_task = err == -H5_DAOS_REMOTE_ERROR ? "remote task" : "batched collective error check";
+        D_DONE_ERROR(H5E_IO, H5E_CANTINIT, err, "operation \"%s\" failed in task \"%s\": %s", req->op_name,
+                     req->failed_task, H5_daos_err_to_string(err));
+    } /* end if */
 
-    /* Allocate iter udata */
-    if (NULL == (iter_udata = (H5_daos_iter_ud_t *)DV_calloc(sizeof(H5_daos_iter_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate iteration user data");
+    req->collective.pending       = FALSE;
+    req->collective.next_deferred = NULL;
 
-    /* Fill in user data fields */
-    iter_udata->target_obj = target_obj;
-    if (dkey)
-        iter_udata->dkey = *dkey;
-    else
-        assert(opc == DAOS_OPC_OBJ_LIST_DKEY);
-    iter_udata->base_iter = base_iter;
-    memset(&iter_udata->anchor, 0, sizeof(iter_udata->anchor));
+    /* Make notify callback */
+    if (req->notify_cb) {
+        H5_DAOS_REQ_STATUS_OUT_TYPE req_status;
 
-    /* Copy iter_data if this is the base of iteration, otherwise point to
-     * existing iter_data */
-    if (base_iter) {
-        if (NULL == (iter_udata->iter_data = (H5_daos_iter_data_t *)DV_malloc(sizeof(H5_daos_iter_data_t))))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate iteration data");
-        memcpy(iter_udata->iter_data, iter_data, sizeof(*iter_data));
+        /* Determine request status */
+        if (req->status == 0)
+            req_status = H5_DAOS_REQ_STATUS_OUT_SUCCEED;
+        else if (req->status == -H5_DAOS_CANCELED)
+            req_status = H5_DAOS_REQ_STATUS_OUT_CANCELED;
+        else
+            req_status = H5_DAOS_REQ_STATUS_OUT_FAIL;
+
+        /* Make callback */
+        if (req->notify_cb(req->notify_ctx, req_status) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTOPERATE, -H5_DAOS_CALLBACK_ERROR,
+                         "notify callback returned failure");
     } /* end if */
-    else
-        iter_udata->iter_data = iter_data;
 
-    /* Allocate kds buffer if necessary */
-    iter_udata->kds     = iter_udata->kds_static;
-    iter_udata->kds_len = key_prefetch_size;
-    if (key_prefetch_size * sizeof(daos_key_desc_t) > sizeof(iter_udata->kds_static)) {
-        if (NULL ==
-            (iter_udata->kds_dyn = (daos_key_desc_t *)DV_malloc(key_prefetch_size * sizeof(daos_key_desc_t))))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
-                         "can't allocate key descriptor buffer");
-        iter_udata->kds = iter_udata->kds_dyn;
+    /* Propagate errors to parent request */
+    if (req->parent_req && req->status != 0) {
+        req->parent_req->status      = req->status;
+        req->parent_req->failed_task = req->failed_task;
     } /* end if */
 
-    /* Allocate key_buf */
-    if (NULL == (tmp_alloc = (char *)DV_malloc(key_buf_size_init)))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for keys");
+    /* Release the batch's reference to req */
+    if (H5_daos_req_free_int(req) < 0)
+        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-    /* Set up sg_iov.  Report size as 1 less than buffer size so we always have
-     * room for a null terminator. */
-    daos_iov_set(&iter_udata->sg_iov, tmp_alloc, (daos_size_t)(key_buf_size_init - 1));
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_err_batch_resolve() */
 
-    /* Set up sgl */
-    iter_udata->sgl.sg_nr     = 1;
-    iter_udata->sgl.sg_nr_out = 0;
-    iter_udata->sgl.sg_iovs   = &iter_udata->sg_iov;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_free_async_task
+ *
+ * Purpose:     Frees a buffer (the private data).
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_free_async_task(tse_task_t *task)
+{
+    void *buf       = NULL;
+    int   ret_value = 0;
 
-    /* Create meta task for iteration.  This empty task will be completed when
-     * the iteration is finished by comp_cb.  We can't use list_task since it
-     * may not be completed by the first list.  Only free iter_data at the end
-     * if this is the base of iteration. */
-    if (H5_daos_create_task(H5_daos_list_key_finish, 0, NULL, NULL, NULL, iter_udata,
-                            &iter_udata->iter_metatask) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create meta task for iteration");
+    /* Get private data */
+    if (NULL == (buf = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for free task");
 
-    /* Start list (create tasks) give it a reference to req and target obj, and
-     * transfer ownership of iter_udata */
-    if (0 != (ret = H5_daos_list_key_start(iter_udata, opc, comp_cb, first_task, dep_task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't start iteration");
-    iter_udata->iter_data->req->rc++;
-    iter_udata->target_obj->item.rc++;
-    iter_udata = NULL;
+    /* Free buffer */
+    DV_free(buf);
 
 done:
-    /* Cleanup */
-    if (iter_udata) {
-        assert(ret_value < 0);
-
-        if (iter_udata->iter_metatask) {
-            /* The metatask should clean everything up */
-            if (iter_udata->iter_metatask != *dep_task) {
-                /* Queue up the metatask */
-                if (*dep_task && 0 != (ret = tse_task_register_deps(iter_udata->iter_metatask, 1, dep_task)))
-                    D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret,
-                                 "can't create dependencies for iteration metatask: %s",
-                                 H5_daos_err_to_string(ret));
-
-                if (*first_task) {
-                    if (0 != (ret = tse_task_schedule(iter_udata->iter_metatask, false)))
-                        D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule iteration metatask: %s",
-                                     H5_daos_err_to_string(ret));
-                } /* end if */
-                else
-                    *first_task = iter_udata->iter_metatask;
-                *dep_task = iter_udata->iter_metatask;
-            } /* end if */
-        }     /* end if */
-        else {
-            /* No metatask, clean up directly here */
-            /* Free iter_data if this is the base of iteration */
-            if (iter_data->is_recursive && iter_udata->base_iter) {
-                /* Free hash table */
-                if (iter_data->iter_type == H5_DAOS_ITER_TYPE_LINK) {
-                    iter_data->u.link_iter_data.recursive_link_path =
-                        DV_free(iter_data->u.link_iter_data.recursive_link_path);
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-                    if (iter_data->u.link_iter_data.visited_link_table) {
-                        dv_hash_table_free(iter_data->u.link_iter_data.visited_link_table);
-                        iter_data->u.link_iter_data.visited_link_table = NULL;
-                    } /* end if */
-                }     /* end if */
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
 
-                /* Free iter data */
-                iter_udata->iter_data = DV_free(iter_udata->iter_data);
-            } /* end if */
+    D_FUNC_LEAVE;
+} /* end H5_daos_free_async_task() */
 
-            /* Decrement reference count on root obj id.  Use nonblocking close
-             * so it doesn't deadlock */
-            if (iter_udata->base_iter) {
-                iter_udata->target_obj->item.nonblocking_close = TRUE;
-                if ((ret = H5Idec_ref(iter_data->iter_root_obj)) < 0)
-                    D_DONE_ERROR(H5E_VOL, H5E_CANTDEC, -H5_DAOS_H5_CLOSE_ERROR,
-                                 "can't decrement reference count on iteration base object");
-                if (ret)
-                    iter_udata->target_obj->item.nonblocking_close = FALSE;
-            } /* end if */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_free_async
+ *
+ * Purpose:     Schedules a task to free a buffer.  Executes even if a
+ *              previous task failed, does not issue new failures.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_free_async(void *buf, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    tse_task_t *free_task;
+    int         ret;
+    herr_t      ret_value = SUCCEED; /* Return value */
 
-            /* Free key buffer */
-            if (iter_udata->sg_iov.iov_buf)
-                DV_free(iter_udata->sg_iov.iov_buf);
+    assert(buf);
+    assert(first_task);
+    assert(dep_task);
 
-            /* Free kds buffer if one was allocated */
-            if (iter_udata->kds_dyn)
-                DV_free(iter_udata->kds_dyn);
+    /* Create task for free */
+    if (H5_daos_create_task(H5_daos_free_async_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
+                            NULL, buf, &free_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to free buffer");
 
-            /* Free udata */
-            iter_udata = DV_free(iter_udata);
-        } /* end else */
-    }     /* end if */
+    /* Schedule free task (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(free_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to free buffer: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = free_task;
+
+    /* Do not update *dep_task since nothing depends on this buffer being freed
+     */
 
+done:
     D_FUNC_LEAVE;
-} /* end H5_daos_list_key_init() */
+} /* end H5_daos_free_async() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_obj_open_prep_cb
- *
- * Purpose:     Prepare callback for daos_obj_open.  Currently only sets
- *              the coh and checks for errors from previous tasks.  This
- *              is only necessary for operations that might otherwise be
- *              run before file->coh is set up, since daos_obj_open is a
- *              non-blocking operation.  The other fields in the argument
- *              struct must have already been filled in.  Since this does
- *              not hold the object open it must only be used when there
- *              is a task that depends on it that does so.
+ * Function:    H5_daos_create_task
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Purpose:     Creates a TSE task. May re-use a task from a task list if a
+ *              task is available.
  *
- * Programmer:  Neil Fortner
- *              February, 2020
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-int
-H5_daos_obj_open_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5_daos_create_task(tse_task_func_t task_func, unsigned num_deps, tse_task_t *dep_tasks[],
+                    tse_task_cb_t task_prep_cb, tse_task_cb_t task_comp_cb, void *task_priv,
+                    tse_task_t **taskp)
 {
-    H5_daos_obj_open_ud_t *udata;
-    daos_obj_open_t       *open_args;
-    int                    ret_value = 0;
+    int    ret;
+    herr_t ret_value = SUCCEED;
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for object open task");
+    assert(taskp);
+    assert(H5_daos_task_list_g);
 
-    assert(udata->generic_ud.req);
+    if (H5_daos_task_list_avail(H5_daos_task_list_g)) {
+        if (H5_daos_task_list_get(H5_daos_task_list_g, taskp) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get task from task list");
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->generic_ud.req, H5E_VOL);
+        if (0 != (ret = tse_task_reset(*taskp, task_func, task_priv)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't reset task: %s", H5_daos_err_to_string(ret));
+    }
+    else {
+        if (0 != (ret = tse_task_create(task_func, &H5_daos_glob_sched_g, task_priv, taskp)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task: %s", H5_daos_err_to_string(ret));
+    }
 
-    assert(udata->file);
+    assert(*taskp);
 
-    /* Set container open handle and oid in args */
-    if (NULL == (open_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for object open task");
-    open_args->coh = udata->file->coh;
-    open_args->oid = *udata->oid;
+    /* Register task dependency */
+    if (num_deps && 0 != (ret = tse_task_register_deps(*taskp, (int)num_deps, dep_tasks)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register task dependencies: %s",
+                     H5_daos_err_to_string(ret));
+
+    if (task_prep_cb || task_comp_cb)
+        if (0 != (ret = tse_task_register_cbs(*taskp, task_prep_cb, NULL, 0, task_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register callbacks for task: %s",
+                         H5_daos_err_to_string(ret));
 
 done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
+    if (ret_value < 0 && *taskp)
+        tse_task_complete(*taskp, -H5_DAOS_SETUP_ERROR);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_obj_open_prep_cb() */
+} /* end H5_daos_create_task() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_obj_open
+ * Function:    H5_daos_create_daos_task
  *
- * Purpose:     Open a DAOS object object asynchronously.  daos_obj_open
- *              is a non-blocking call but it might be necessary to insert
- *              it into the scheduler so it doesn't run until certain
- *              conditions are met (such as the file's container handle
- *              being open).  oid must not point to memory that might be
- *              freed or go out of scope before the open task executes.
+ * Purpose:     Creates a DAOS task. May re-use a DAOS task from a task
+ *              list if a task is available.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_obj_open(H5_daos_file_t *file, H5_daos_req_t *req, daos_obj_id_t *oid, unsigned mode,
-                 daos_handle_t *oh, const char *task_name, tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_create_daos_task(daos_opc_t daos_opc, unsigned num_deps, tse_task_t *dep_tasks[],
+                         tse_task_cb_t task_prep_cb, tse_task_cb_t task_comp_cb, void *task_priv,
+                         tse_task_t **taskp)
 {
-    tse_task_t            *open_task;
-    H5_daos_obj_open_ud_t *open_udata = NULL;
-    daos_obj_open_t       *open_args;
-    int                    ret;
-    herr_t                 ret_value = SUCCEED; /* Return value */
+    int    ret;
+    herr_t ret_value = SUCCEED;
 
-    assert(file);
-    assert(req);
-    assert(oid);
-    assert(first_task);
-    assert(dep_task);
+    assert(taskp);
+    assert(H5_daos_task_list_g);
 
-    /* Set private data for object open */
-    if (NULL == (open_udata = (H5_daos_obj_open_ud_t *)DV_malloc(sizeof(H5_daos_obj_open_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "can't allocate user data struct for object open task");
-    open_udata->generic_ud.req       = req;
-    open_udata->generic_ud.task_name = task_name;
-    open_udata->file                 = file;
-    open_udata->oid                  = oid;
+    if (H5_daos_task_list_avail(H5_daos_task_list_g)) {
+        if (H5_daos_task_list_get(H5_daos_task_list_g, taskp) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get DAOS task from task list");
 
-    /* Create task for object open */
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_OPEN, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_obj_open_prep_cb, H5_daos_generic_comp_cb, open_udata,
-                                 &open_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to open object");
+        if (0 != (ret = daos_task_reset(*taskp, daos_opc)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't reset DAOS task: %s",
+                         H5_daos_err_to_string(ret));
 
-    /* Set arguments for object open (oid will be set later by the prep
-     * callback) */
-    if (NULL == (open_args = daos_task_get_args(open_task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get arguments for object open task");
-    open_args->mode = mode;
-    open_args->oh   = oh;
+        if (num_deps && 0 != (ret = tse_task_register_deps(*taskp, (int)num_deps, dep_tasks)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register task dependencies: %s",
+                         H5_daos_err_to_string(ret));
+    }
+    else {
+        if (0 != (ret = daos_task_create(daos_opc, &H5_daos_glob_sched_g, num_deps, dep_tasks, taskp)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create DAOS task: %s",
+                         H5_daos_err_to_string(ret));
+    }
 
-    /* Schedule object open task (or save it to be scheduled later) and give it
-     * a reference to req */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(open_task, false)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to open object: %s",
+    assert(*taskp);
+
+    if (task_prep_cb || task_comp_cb)
+        if (0 != (ret = tse_task_register_cbs(*taskp, task_prep_cb, NULL, 0, task_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register callbacks for task: %s",
                          H5_daos_err_to_string(ret));
-    } /* end if */
-    else
-        *first_task = open_task;
-    req->rc++;
-    open_udata = NULL;
-    *dep_task  = open_task;
+
+    /* Set private data for task */
+    tse_task_set_priv(*taskp, task_priv);
 
 done:
-    /* Cleanup */
-    if (open_udata) {
-        assert(ret_value < 0);
-        open_udata = DV_free(open_udata);
-    } /* end if */
+    if (ret_value < 0 && *taskp)
+        tse_task_complete(*taskp, -H5_DAOS_SETUP_ERROR);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_obj_open() */
+} /* end H5_daos_create_daos_task() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_mpi_ibcast
+ * Function:    H5_daos_mpi_req_table_reserve
  *
- * Purpose:     Creates an asynchronous task for broadcasting a buffer.
- *              `_bcast_udata` may be NULL, in which case this routine will
- *              allocate a broadcast udata struct and assume an empty
- *              buffer is to be sent to trigger a failure on other
- *              processes. If `empty` is TRUE, the buffer will be memset
- *              with 0.
+ * Purpose:     Makes sure the MPI request table has room for one more
+ *              in-flight MPI operation.  The caller starts the operation
+ *              using the request at index nreqs, then calls
+ *              H5_daos_mpi_req_table_add().
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_mpi_ibcast(H5_daos_mpi_ibcast_ud_t *_bcast_udata, H5_daos_obj_t *obj, size_t buffer_size,
-                   hbool_t empty, tse_task_cb_t bcast_prep_cb, tse_task_cb_t bcast_comp_cb,
-                   H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+static herr_t
+H5_daos_mpi_req_table_reserve(void)
 {
-    H5_daos_mpi_ibcast_ud_t *bcast_udata = _bcast_udata;
-    H5_daos_item_t          *item        = (H5_daos_item_t *)obj;
-    tse_task_t              *bcast_task;
-    int                      ret;
+    H5_daos_mpi_req_table_t *table     = &H5_daos_mpi_req_table_g;
     herr_t                   ret_value = SUCCEED;
 
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
+    if (table->nreqs == table->nalloc) {
+        int                     new_nalloc = table->nalloc ? 2 * table->nalloc : 8;
+        H5_daos_mpi_req_info_t *tmp_infos;
+        MPI_Request            *tmp_reqs;
+        int                    *tmp_indices;
 
-    /* Allocate bcast_udata if necessary */
-    if (!bcast_udata) {
-        if (NULL == (bcast_udata = (H5_daos_mpi_ibcast_ud_t *)DV_calloc(sizeof(H5_daos_mpi_ibcast_ud_t))))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                         "failed to allocate buffer for MPI broadcast user data");
-        bcast_udata->req  = req;
-        bcast_udata->obj  = obj;
-        bcast_udata->comm = req->file->comm;
+        if (NULL ==
+            (tmp_infos = DV_realloc(table->infos, (size_t)new_nalloc * sizeof(H5_daos_mpi_req_info_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate MPI task table");
+        table->infos = tmp_infos;
+        if (NULL == (tmp_reqs = DV_realloc(table->reqs, (size_t)new_nalloc * sizeof(MPI_Request))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate MPI request table");
+        table->reqs = tmp_reqs;
+        if (NULL == (tmp_indices = DV_realloc(table->indices, (size_t)new_nalloc * sizeof(int))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate MPI request index table");
+        table->indices = tmp_indices;
+        table->nalloc  = new_nalloc;
     } /* end if */
 
-    /* Allocate bcast_udata's buffer if necessary */
-    if (!bcast_udata->buffer) {
-        if (NULL == (bcast_udata->buffer = DV_calloc(buffer_size)))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "failed to allocate MPI broadcast buffer");
-        bcast_udata->buffer_len = (int)buffer_size;
-        bcast_udata->count      = (int)buffer_size;
-    } /* end if */
-    else {
-        assert(bcast_udata->buffer_len == (int)buffer_size);
-        assert(bcast_udata->count == (int)buffer_size);
-        if (empty)
-            memset(bcast_udata->buffer, 0, buffer_size);
-    } /* end else */
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_mpi_req_table_reserve() */
 
-    /* Create meta task for bcast.  This empty task will be completed when
-     * the bcast is finished by the completion callback. We can't use
-     * bcast_task since it may not be completed after the first bcast. */
-    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &bcast_udata->bcast_metatask) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create meta task for empty buffer broadcast");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_mpi_req_table_add
+ *
+ * Purpose:     Registers the MPI operation just started using the request
+ *              at index nreqs of the MPI request table.  stage tells the
+ *              progress function what to do when it finishes.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_mpi_req_table_add(tse_task_t *task, H5_daos_mpi_ibcast_ud_t *bcast_ud, hbool_t prefetch_copy,
+                          H5_daos_mpi_stage_t stage, uint8_t *shm_slot)
+{
+    H5_daos_mpi_req_info_t *info;
 
-    /* Create task for bcast */
-    if (H5_daos_create_task(H5_daos_mpi_ibcast_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                            bcast_prep_cb, bcast_comp_cb, bcast_udata, &bcast_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to broadcast empty buffer");
+    assert(H5_daos_mpi_req_table_g.nreqs < H5_daos_mpi_req_table_g.nalloc);
+
+    info                = &H5_daos_mpi_req_table_g.infos[H5_daos_mpi_req_table_g.nreqs++];
+    info->task          = task;
+    info->bcast_ud      = bcast_ud;
+    info->prefetch_copy = prefetch_copy;
+    info->stage         = stage;
+    info->shm_slot      = shm_slot;
+    info->stream        = NULL;
+} /* end H5_daos_mpi_req_table_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_mpi_node_bcast
+ *
+ * Purpose:     Starts the part of a node-local broadcast within this
+ *              node.  On the node leader this is called once the leader
+ *              has the data.  If the data fits in a slot of the node's
+ *              shared memory window the leader copies it there and all
+ *              ranks on the node enter a barrier, after which the other
+ *              ranks copy it out (see H5_daos_mpi_req_table_progress()).
+ *              Otherwise the data is broadcast within the node with
+ *              MPI_Ibcast.  Each collective lane has its own window, and
+ *              its two slots are used in turn.  Since a rank does not
+ *              start a broadcast until its previous one in the lane is
+ *              complete, once the leader is past the barrier for the
+ *              previous slot broadcast, all ranks on the node are done
+ *              reading the slot it is about to overwrite.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_mpi_node_bcast(tse_task_t *task, H5_daos_mpi_ibcast_ud_t *bcast_ud, hbool_t prefetch_copy)
+{
+    H5_daos_coll_lane_t  *lane;
+    H5_daos_node_bcast_t *node_bcast;
+    uint8_t              *shm_slot;
+    void                 *buffer;
+    int                   count;
+    herr_t                ret_value = SUCCEED;
+
+    assert(bcast_ud);
+    assert(bcast_ud->lane);
+
+    lane       = bcast_ud->lane;
+    node_bcast = &lane->node_bcast;
+    buffer     = prefetch_copy ? (void *)lane->bcast_prefetch_buf : bcast_ud->buffer;
+    count      = prefetch_copy ? lane->bcast_prefetch_len : bcast_ud->count;
+
+    /* Make sure there is room to track the MPI request */
+    if (H5_daos_mpi_req_table_reserve() < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't grow MPI request table");
 
-    /* Schedule meta task */
-    if (0 != (ret = tse_task_schedule(bcast_udata->bcast_metatask, false)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule meta task for empty buffer broadcast: %s",
-                     H5_daos_err_to_string(ret));
+    if (count <= H5_DAOS_NODE_BCAST_SLOT_SIZE) {
+        shm_slot = node_bcast->shm + (size_t)(node_bcast->nbcast++ % 2) * H5_DAOS_NODE_BCAST_SLOT_SIZE;
 
-    /* Schedule bcast task and transfer ownership of bcast_udata */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(bcast_task, false)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task for empty buffer broadcast: %s",
-                         H5_daos_err_to_string(ret));
-        else {
-            req->rc++;
-            if (item)
-                item->rc++;
-            *dep_task   = bcast_udata->bcast_metatask;
-            bcast_udata = NULL;
-        } /* end else */
-    }     /* end if */
+        /* Publish the data to the rest of the node */
+        if (node_bcast->rank == 0) {
+            (void)memcpy(shm_slot, buffer, (size_t)count);
+            if (MPI_SUCCESS != MPI_Win_sync(node_bcast->win))
+                D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Win_sync failed");
+        } /* end if */
+
+        if (MPI_SUCCESS !=
+            MPI_Ibarrier(node_bcast->comm, &H5_daos_mpi_req_table_g.reqs[H5_daos_mpi_req_table_g.nreqs]))
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Ibarrier failed");
+
+        /* Ranks other than the leader read the data once the barrier
+         * finishes */
+        H5_daos_mpi_req_table_add(task, bcast_ud, prefetch_copy,
+                                  node_bcast->rank == 0 ? H5_DAOS_MPI_STAGE_DONE
+                                                        : H5_DAOS_MPI_STAGE_NODE_READ,
+                                  shm_slot);
+    } /* end if */
     else {
-        *first_task = bcast_task;
-        req->rc++;
-        if (item)
-            item->rc++;
-        *dep_task   = bcast_udata->bcast_metatask;
-        bcast_udata = NULL;
+        if (MPI_SUCCESS != MPI_Ibcast(buffer, count, MPI_BYTE, 0, node_bcast->comm,
+                                      &H5_daos_mpi_req_table_g.reqs[H5_daos_mpi_req_table_g.nreqs]))
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Ibcast failed");
+
+        H5_daos_mpi_req_table_add(task, bcast_ud, prefetch_copy, H5_DAOS_MPI_STAGE_DONE, NULL);
     } /* end else */
 
 done:
-    /* Cleanup on failure */
-    if (bcast_udata) {
-        DV_free(bcast_udata->buffer);
-        DV_free(bcast_udata);
-    } /* end if */
-
     D_FUNC_LEAVE;
-} /* end H5_daos_mpi_ibcast() */
+} /* end H5_daos_mpi_node_bcast() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_collective_error_check
+ * Function:    H5_daos_bcast_stream_add
  *
- * Purpose:     Creates an asynchronous task for broadcasting the status of
- *              a collective asynchronous operation. `_bcast_udata` may be
- *              NULL, in which case this routine will allocate a broadcast
- *              udata struct and assume an empty buffer is to be sent to
- *              trigger a failure on other processes.
+ * Purpose:     Makes the broadcast of count bytes in buffer for the
+ *              broadcast task task through the coalesced broadcast stream
+ *              of the file.  On rank 0 the data is queued to be sent with
+ *              the next frame, and the task is completed since the data
+ *              was copied.  On other ranks the task is completed with the
+ *              data received for the next broadcast of its lane if it
+ *              already arrived, otherwise it waits for the data, and the
+ *              broadcast of the next frame is posted if necessary.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_collective_error_check(H5_daos_obj_t *obj, H5_daos_req_t *req, tse_task_t **first_task,
-                               tse_task_t **dep_task)
+static herr_t
+H5_daos_bcast_stream_add(tse_task_t *task, H5_daos_mpi_ibcast_ud_t *bcast_ud, void *buffer, int count)
 {
-    herr_t ret_value = SUCCEED;
+    H5_daos_bcast_stream_t *stream;
+    H5_daos_coll_lane_t    *lane;
+    H5_daos_bcast_entry_t  *entry;
+    uint8_t                *p;
+    size_t                  new_alloc;
+    herr_t                  ret_value = SUCCEED;
+
+    assert(task);
+    assert(bcast_ud);
+    assert(bcast_ud->lane);
+    assert(buffer);
+    assert(count <= H5_DAOS_BCAST_COALESCE_MAX);
+
+    stream = &bcast_ud->req->file->bcast_stream;
+    lane   = bcast_ud->lane;
+    assert(stream->comm != MPI_COMM_NULL);
+
+    if (stream->file->my_rank == 0) {
+        /* Send the data already queued first if the frame would grow too
+         * large */
+        if ((stream->out_data_len + (size_t)count > H5_DAOS_BCAST_FRAME_MAX ||
+             (size_t)(stream->out_nentries + 1) * H5_DAOS_BCAST_FRAME_DESC_SIZE > H5_DAOS_BCAST_FRAME_MAX) &&
+            H5_daos_bcast_stream_flush(stream) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't send coalesced broadcast frame");
+
+        /* Make room for the entry */
+        if ((size_t)(stream->out_nentries + 1) * H5_DAOS_BCAST_FRAME_DESC_SIZE > stream->out_desc_alloc) {
+            new_alloc = MAX(2 * stream->out_desc_alloc, 16 * H5_DAOS_BCAST_FRAME_DESC_SIZE);
+            if (NULL == (p = (uint8_t *)DV_realloc(stream->out_desc, new_alloc)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                             "can't allocate coalesced broadcast descriptors");
+            stream->out_desc       = p;
+            stream->out_desc_alloc = new_alloc;
+        } /* end if */
+        if (stream->out_data_len + (size_t)count > stream->out_data_alloc) {
+            new_alloc = MAX(2 * stream->out_data_alloc, stream->out_data_len + (size_t)count);
+            if (NULL == (p = (uint8_t *)DV_realloc(stream->out_data, new_alloc)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate coalesced broadcast data");
+            stream->out_data       = p;
+            stream->out_data_alloc = new_alloc;
+        } /* end if */
 
-    assert(req);
-    assert(req->file->num_procs > 1);
-    assert(first_task);
-    assert(dep_task);
+        /* Queue the entry */
+        p = stream->out_desc + (size_t)stream->out_nentries * H5_DAOS_BCAST_FRAME_DESC_SIZE;
+        UINT64ENCODE(p, (uint64_t)(lane - stream->file->coll_lanes));
+        UINT64ENCODE(p, (uint64_t)count);
+        (void)memcpy(stream->out_data + stream->out_data_len, buffer, (size_t)count);
+        stream->out_data_len += (size_t)count;
+        stream->out_nentries++;
+
+        /* Queue the stream to be sent in the next progress tick */
+        if (!stream->queued) {
+            stream->queued               = TRUE;
+            stream->next_queued          = H5_daos_bcast_stream_queue_g;
+            H5_daos_bcast_stream_queue_g = stream;
+        } /* end if */
 
-    /* Setup the request's bcast udata structure for broadcasting the operation status */
-    req->collective.coll_status                 = 0;
-    req->collective.err_check_ud.req            = req;
-    req->collective.err_check_ud.obj            = obj;
-    req->collective.err_check_ud.buffer         = &req->collective.coll_status;
-    req->collective.err_check_ud.buffer_len     = sizeof(req->collective.coll_status);
-    req->collective.err_check_ud.count          = req->collective.err_check_ud.buffer_len;
-    req->collective.err_check_ud.bcast_metatask = NULL;
-    req->collective.err_check_ud.comm           = req->file->comm;
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't return task to task list");
 
-    if (H5_daos_mpi_ibcast(&req->collective.err_check_ud, obj, sizeof(req->collective.coll_status), FALSE,
-                           (req->file->my_rank == 0) ? H5_daos_collective_error_check_prep_cb : NULL,
-                           H5_daos_collective_error_check_comp_cb, req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't broadcast collective operation status");
+        /* Complete this task */
+        tse_task_complete(task, 0);
+    } /* end if */
+    else if (NULL != (entry = lane->bcast_recvd_head)) {
+        /* The data was already received */
+        lane->bcast_recvd_head = entry->next;
+        if (!lane->bcast_recvd_head)
+            lane->bcast_recvd_tail = NULL;
+        if (H5_daos_bcast_stream_deliver(task, bcast_ud, buffer != bcast_ud->buffer, count, entry->buf,
+                                         entry->count) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't complete coalesced broadcast");
+        DV_free(entry->buf);
+        DV_free(entry);
+    } /* end if */
+    else {
+        /* Wait for the data */
+        if (NULL == (entry = (H5_daos_bcast_entry_t *)DV_calloc(sizeof(H5_daos_bcast_entry_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate coalesced broadcast entry");
+        entry->task          = task;
+        entry->bcast_ud      = bcast_ud;
+        entry->count         = count;
+        entry->prefetch_copy = buffer != bcast_ud->buffer;
+        if (lane->bcast_waiting_tail)
+            lane->bcast_waiting_tail->next = entry;
+        else
+            lane->bcast_waiting_head = entry;
+        lane->bcast_waiting_tail = entry;
+        stream->nwaiting++;
+
+        if (!stream->in_posted && H5_daos_bcast_stream_post(stream) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't receive coalesced broadcast frame");
+    } /* end else */
 
 done:
     D_FUNC_LEAVE;
-} /* end H5_daos_collective_error_check() */
+} /* end H5_daos_bcast_stream_add() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_collective_error_check_prep_cb
+ * Function:    H5_daos_bcast_stream_deliver
  *
- * Purpose:     Prepare callback for asynchronous MPI_Ibcast to broadcast
- *              the result status of a collective operation. Currently just
- *              sets the value for the status buffer on rank 0. Only meant
- *              to be called by the rank that is the root of broadcasting
- *              (usually rank 0).
+ * Purpose:     Completes the coalesced broadcast task task, which expects
+ *              count bytes, with the data_count bytes in data.  If data is
+ *              NULL the task fails.  If prefetch_copy is set, the data is
+ *              copied to the lane's broadcast prefetch buffer and from
+ *              there to bcast_ud's buffer, as for broadcasts in the MPI
+ *              request table.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_collective_error_check_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_bcast_stream_deliver(tse_task_t *task, H5_daos_mpi_ibcast_ud_t *bcast_ud, hbool_t prefetch_copy,
+                             int count, const uint8_t *data, int data_count)
 {
-    H5_daos_mpi_ibcast_ud_t *udata;
-    int                      ret_value = 0;
+    H5_daos_coll_lane_t *lane;
+    int                  task_ret  = 0;
+    herr_t               ret_value = SUCCEED;
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for MPI broadcast task");
+    assert(task);
+    assert(bcast_ud);
+    assert(bcast_ud->lane);
 
-    assert(udata->req);
-    assert(udata->req->file->my_rank == 0);
-    assert(udata->buffer);
-    assert(udata->buffer_len == sizeof(udata->req->status));
+    lane = bcast_ud->lane;
 
-    *((int *)udata->buffer) = udata->req->status;
+    if (!data)
+        task_ret = -H5_DAOS_MPI_ERROR;
+    else if (data_count != count) {
+        D_DONE_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "coalesced broadcast data has the wrong size");
+        task_ret = -H5_DAOS_MPI_ERROR;
+    } /* end if */
+    else if (prefetch_copy) {
+        assert(lane->bcast_prefetch_buf);
+        (void)memcpy(lane->bcast_prefetch_buf, data, (size_t)count);
+        (void)memcpy(bcast_ud->buffer, lane->bcast_prefetch_buf, (size_t)bcast_ud->count);
+    } /* end if */
+    else
+        (void)memcpy(bcast_ud->buffer, data, (size_t)count);
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, task_ret);
 
-done:
     D_FUNC_LEAVE;
-} /* end H5_daos_collective_error_check_prep_cb() */
+} /* end H5_daos_bcast_stream_deliver() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_collective_error_check_comp_cb
+ * Function:    H5_daos_bcast_stream_post
  *
- * Purpose:     Complete callback for asynchronous MPI_Ibcast to broadcast
- *              the result status of a collective operation. Currently
- *              checks for a failed task, checks the status buffer to
- *              determine whether an error occurred on the broadcasting
- *              root rank, and then frees private data. Meant to be called
- *              by all ranks.
+ * Purpose:     Posts the broadcast of the first H5_DAOS_BCAST_FRAME_SIZE
+ *              bytes of the next frame of a coalesced broadcast stream on
+ *              a rank other than rank 0.  It is handled by
+ *              H5_daos_bcast_stream_recv() once it completes.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_collective_error_check_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_bcast_stream_post(H5_daos_bcast_stream_t *stream)
 {
-    H5_daos_mpi_ibcast_ud_t *udata;
-    int                      ret_value = 0;
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for MPI broadcast task");
+    herr_t ret_value = SUCCEED;
 
-    assert(udata->req);
-    assert(udata->buffer);
-    assert(udata->buffer_len == sizeof(udata->req->status));
+    assert(stream);
+    assert(!stream->in_posted);
+    assert(stream->file->my_rank != 0);
 
-    /* Handle errors in broadcast task.  Only record error in
-     * udata->req_status if it does not already contain an error (it could
-     * contain an error if another task this task is not dependent on also
-     * failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = task->dt_result;
-        udata->req->failed_task = "MPI_Ibcast of collective operation status";
+    if (stream->in_alloc < H5_DAOS_BCAST_FRAME_SIZE) {
+        DV_free(stream->in_buf);
+        stream->in_alloc = 0;
+        if (NULL == (stream->in_buf = (uint8_t *)DV_malloc(H5_DAOS_BCAST_FRAME_SIZE)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate coalesced broadcast frame");
+        stream->in_alloc = H5_DAOS_BCAST_FRAME_SIZE;
     } /* end if */
-    else if ((task->dt_result == 0) && (udata->req->file->my_rank != 0)) {
-        int *status_buf = (int *)udata->buffer;
 
-        assert(*status_buf != -H5_DAOS_PRE_ERROR);
-        if ((*status_buf) <= -H5_DAOS_H5_OPEN_ERROR) {
-            udata->req->status      = -H5_DAOS_REMOTE_ERROR;
-            udata->req->failed_task = "remote task";
-        } /* end if */
-    }     /* end else */
+    /* Make sure there is room to track the MPI request */
+    if (H5_daos_mpi_req_table_reserve() < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't grow MPI request table");
+
+    if (MPI_SUCCESS != MPI_Ibcast(stream->in_buf, H5_DAOS_BCAST_FRAME_SIZE, MPI_BYTE, 0, stream->comm,
+                                  &H5_daos_mpi_req_table_g.reqs[H5_daos_mpi_req_table_g.nreqs]))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Ibcast failed");
+    H5_daos_mpi_req_table_add(NULL, NULL, FALSE, H5_DAOS_MPI_STAGE_FRAME, NULL);
+    H5_daos_mpi_req_table_g.infos[H5_daos_mpi_req_table_g.nreqs - 1].stream = stream;
+    stream->in_posted                                                      = TRUE;
 
 done:
-    if (udata) {
-        /* Close object */
-        if (udata->obj && H5_daos_object_close(&udata->obj->item) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+    D_FUNC_LEAVE;
+} /* end H5_daos_bcast_stream_post() */
 
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bcast_stream_recv
+ *
+ * Purpose:     Handles the receipt of a frame of a coalesced broadcast
+ *              stream on a rank other than rank 0, once the broadcast of
+ *              its first part (or, if rest is set, of its rest) has
+ *              completed.  If the frame is longer than the first part and
+ *              its rest has not been received, starts the broadcast of
+ *              the rest.  Otherwise passes the data of each entry to the
+ *              next waiting broadcast of its lane, or keeps it until that
+ *              broadcast starts, then posts the broadcast of the next
+ *              frame if any broadcasts are still waiting.  On failure,
+ *              all waiting broadcasts fail.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_bcast_stream_recv(H5_daos_bcast_stream_t *stream, hbool_t rest)
+{
+    H5_daos_coll_lane_t   *lane;
+    H5_daos_bcast_entry_t *entry;
+    uint8_t               *p;
+    uint8_t               *data;
+    uint64_t               frame_len;
+    uint64_t               nentries;
+    uint64_t               lane_idx;
+    uint64_t               count;
+    uint64_t               i;
+    herr_t                 ret_value = SUCCEED;
 
-        /* Return task to task list */
-        if (H5_daos_task_list_put(H5_daos_task_list_g, udata->bcast_metatask) < 0)
-            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    assert(stream);
+    assert(stream->in_posted);
+
+    /* Decode header */
+    p = stream->in_buf;
+    UINT64DECODE(p, frame_len);
+    UINT64DECODE(p, nentries);
+    if (frame_len < H5_DAOS_BCAST_FRAME_HDR_SIZE ||
+        nentries > (frame_len - H5_DAOS_BCAST_FRAME_HDR_SIZE) / H5_DAOS_BCAST_FRAME_DESC_SIZE ||
+        frame_len > H5_DAOS_BCAST_FRAME_HDR_SIZE + 2 * H5_DAOS_BCAST_FRAME_MAX)
+        D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid coalesced broadcast frame header");
+
+    /* Receive the rest of a long frame */
+    if (!rest && frame_len > H5_DAOS_BCAST_FRAME_SIZE) {
+        if (frame_len > stream->in_alloc) {
+            if (NULL == (p = (uint8_t *)DV_realloc(stream->in_buf, (size_t)frame_len)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate coalesced broadcast frame");
+            stream->in_buf   = p;
+            stream->in_alloc = (size_t)frame_len;
+        } /* end if */
 
-        /* Complete bcast metatask */
-        tse_task_complete(udata->bcast_metatask, ret_value);
+        /* Make sure there is room to track the MPI request */
+        if (H5_daos_mpi_req_table_reserve() < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't grow MPI request table");
+
+        if (MPI_SUCCESS != MPI_Ibcast(stream->in_buf + H5_DAOS_BCAST_FRAME_SIZE,
+                                      (int)(frame_len - H5_DAOS_BCAST_FRAME_SIZE), MPI_BYTE, 0, stream->comm,
+                                      &H5_daos_mpi_req_table_g.reqs[H5_daos_mpi_req_table_g.nreqs]))
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Ibcast failed");
+        H5_daos_mpi_req_table_add(NULL, NULL, FALSE, H5_DAOS_MPI_STAGE_FRAME_REST, NULL);
+        H5_daos_mpi_req_table_g.infos[H5_daos_mpi_req_table_g.nreqs - 1].stream = stream;
+
+        D_GOTO_DONE(SUCCEED);
     } /* end if */
-    else
-        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Pass on the data of each entry.  Broadcasts completed here may start
+     * new broadcasts, which then wait without posting another frame until
+     * this frame is done. */
+    data = stream->in_buf + H5_DAOS_BCAST_FRAME_HDR_SIZE + nentries * H5_DAOS_BCAST_FRAME_DESC_SIZE;
+    for (i = 0; i < nentries; i++) {
+        p = stream->in_buf + H5_DAOS_BCAST_FRAME_HDR_SIZE + i * H5_DAOS_BCAST_FRAME_DESC_SIZE;
+        UINT64DECODE(p, lane_idx);
+        UINT64DECODE(p, count);
+        if (lane_idx >= stream->file->ncoll_lanes || count > H5_DAOS_BCAST_COALESCE_MAX ||
+            count > frame_len - (uint64_t)(data - stream->in_buf))
+            D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "invalid coalesced broadcast descriptor");
+        lane = &stream->file->coll_lanes[lane_idx];
+
+        if (NULL != (entry = lane->bcast_waiting_head)) {
+            /* Complete the waiting broadcast */
+            lane->bcast_waiting_head = entry->next;
+            if (!lane->bcast_waiting_head)
+                lane->bcast_waiting_tail = NULL;
+            assert(stream->nwaiting > 0);
+            stream->nwaiting--;
+            if (H5_daos_bcast_stream_deliver(entry->task, entry->bcast_ud, entry->prefetch_copy, entry->count,
+                                             data, (int)count) < 0)
+                D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't complete coalesced broadcast");
+            DV_free(entry);
+        } /* end if */
+        else {
+            /* Keep the data until the broadcast starts */
+            if (NULL == (entry = (H5_daos_bcast_entry_t *)DV_calloc(sizeof(H5_daos_bcast_entry_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate coalesced broadcast entry");
+            if (NULL == (entry->buf = (uint8_t *)DV_malloc(MAX((size_t)count, 1)))) {
+                DV_free(entry);
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate coalesced broadcast data");
+            } /* end if */
+            (void)memcpy(entry->buf, data, (size_t)count);
+            entry->count = (int)count;
+            if (lane->bcast_recvd_tail)
+                lane->bcast_recvd_tail->next = entry;
+            else
+                lane->bcast_recvd_head = entry;
+            lane->bcast_recvd_tail = entry;
+        } /* end else */
+
+        data += count;
+    } /* end for */
+
+    /* Wait for the next frame if necessary.  If passing on the data failed
+     * the waiting broadcasts fail instead. */
+    stream->in_posted = FALSE;
+    if (ret_value >= 0 && stream->nwaiting > 0 && H5_daos_bcast_stream_post(stream) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't receive coalesced broadcast frame");
+
+done:
+    if (ret_value < 0)
+        H5_daos_bcast_stream_fail(stream);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_collective_error_check_comp_cb() */
+} /* end H5_daos_bcast_stream_recv() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_free_async_task
+ * Function:    H5_daos_bcast_stream_fail
  *
- * Purpose:     Frees a buffer (the private data).
+ * Purpose:     Fails all broadcasts waiting for data from a coalesced
+ *              broadcast stream, after the receipt of a frame failed.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      void
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_free_async_task(tse_task_t *task)
+static void
+H5_daos_bcast_stream_fail(H5_daos_bcast_stream_t *stream)
 {
-    void *buf       = NULL;
-    int   ret_value = 0;
+    H5_daos_coll_lane_t   *lane;
+    H5_daos_bcast_entry_t *entry;
+    unsigned               i;
 
-    /* Get private data */
-    if (NULL == (buf = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for free task");
+    assert(stream);
 
-    /* Free buffer */
-    DV_free(buf);
+    stream->in_posted = FALSE;
+    for (i = 0; i < stream->file->ncoll_lanes; i++) {
+        lane = &stream->file->coll_lanes[i];
+        while (NULL != (entry = lane->bcast_waiting_head)) {
+            lane->bcast_waiting_head = entry->next;
+            (void)H5_daos_bcast_stream_deliver(entry->task, entry->bcast_ud, entry->prefetch_copy,
+                                               entry->count, NULL, 0);
+            DV_free(entry);
+        } /* end while */
+        lane->bcast_waiting_tail = NULL;
+    } /* end for */
+    stream->nwaiting = 0;
+} /* end H5_daos_bcast_stream_fail() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bcast_stream_flush
+ *
+ * Purpose:     Sends the data queued on a coalesced broadcast stream on
+ *              rank 0 as one frame, if any is queued.  The first
+ *              H5_DAOS_BCAST_FRAME_SIZE bytes of the frame are broadcast
+ *              first, followed by the rest of a longer frame.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_bcast_stream_flush(H5_daos_bcast_stream_t *stream)
+{
+    MPI_Request *new_reqs;
+    uint8_t    **new_bufs;
+    uint8_t     *frame = NULL;
+    uint8_t     *rest  = NULL;
+    uint8_t     *p;
+    size_t       desc_len;
+    size_t       frame_len;
+    int          new_alloc;
+    herr_t       ret_value = SUCCEED;
+
+    assert(stream);
+    assert(stream->file->my_rank == 0);
+
+    if (stream->out_nentries == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Forget earlier frames that were sent, and make room to track this
+     * frame's broadcasts */
+    if (H5_daos_bcast_stream_reap(stream, FALSE) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't check sent coalesced broadcast frames");
+    if (stream->nsent + 2 > stream->sent_alloc) {
+        new_alloc = MAX(2 * stream->sent_alloc, 8);
+        if (NULL == (new_reqs = (MPI_Request *)DV_realloc(stream->sent_reqs,
+                                                          (size_t)new_alloc * sizeof(MPI_Request))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't grow sent coalesced broadcast frame list");
+        stream->sent_reqs = new_reqs;
+        if (NULL ==
+            (new_bufs = (uint8_t **)DV_realloc(stream->sent_bufs, (size_t)new_alloc * sizeof(uint8_t *))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't grow sent coalesced broadcast frame list");
+        stream->sent_bufs  = new_bufs;
+        stream->sent_alloc = new_alloc;
+    } /* end if */
+
+    /* Assemble the frame */
+    desc_len  = (size_t)stream->out_nentries * H5_DAOS_BCAST_FRAME_DESC_SIZE;
+    frame_len = H5_DAOS_BCAST_FRAME_HDR_SIZE + desc_len + stream->out_data_len;
+    if (NULL == (frame = (uint8_t *)DV_calloc(MAX(frame_len, H5_DAOS_BCAST_FRAME_SIZE))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate coalesced broadcast frame");
+    p = frame;
+    UINT64ENCODE(p, (uint64_t)frame_len);
+    UINT64ENCODE(p, (uint64_t)stream->out_nentries);
+    (void)memcpy(p, stream->out_desc, desc_len);
+    (void)memcpy(p + desc_len, stream->out_data, stream->out_data_len);
+    if (frame_len > H5_DAOS_BCAST_FRAME_SIZE) {
+        if (NULL == (rest = (uint8_t *)DV_malloc(frame_len - H5_DAOS_BCAST_FRAME_SIZE)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate coalesced broadcast frame");
+        (void)memcpy(rest, frame + H5_DAOS_BCAST_FRAME_SIZE, frame_len - H5_DAOS_BCAST_FRAME_SIZE);
+    } /* end if */
+    stream->out_nentries = 0;
+    stream->out_data_len = 0;
+
+    /* Send the frame */
+    if (MPI_SUCCESS != MPI_Ibcast(frame, H5_DAOS_BCAST_FRAME_SIZE, MPI_BYTE, 0, stream->comm,
+                                  &stream->sent_reqs[stream->nsent]))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Ibcast failed");
+    stream->sent_bufs[stream->nsent++] = frame;
+    frame                              = NULL;
+    if (rest) {
+        if (MPI_SUCCESS != MPI_Ibcast(rest, (int)(frame_len - H5_DAOS_BCAST_FRAME_SIZE), MPI_BYTE, 0,
+                                      stream->comm, &stream->sent_reqs[stream->nsent]))
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Ibcast failed");
+        stream->sent_bufs[stream->nsent++] = rest;
+        rest                               = NULL;
+    } /* end if */
 
 done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    DV_free(frame);
+    DV_free(rest);
 
-    /* Complete this task */
-    tse_task_complete(task, ret_value);
+    D_FUNC_LEAVE;
+} /* end H5_daos_bcast_stream_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bcast_stream_flush_queued
+ *
+ * Purpose:     Sends the data queued on all coalesced broadcast streams,
+ *              once per progress tick.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_bcast_stream_flush_queued(void)
+{
+    H5_daos_bcast_stream_t *stream;
+    herr_t                  ret_value = SUCCEED;
+
+    while (NULL != (stream = H5_daos_bcast_stream_queue_g)) {
+        H5_daos_bcast_stream_queue_g = stream->next_queued;
+        stream->next_queued          = NULL;
+        stream->queued               = FALSE;
+
+        if (H5_daos_bcast_stream_flush(stream) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't send coalesced broadcast frame");
+    } /* end while */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_free_async_task() */
+} /* end H5_daos_bcast_stream_flush_queued() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_free_async
+ * Function:    H5_daos_bcast_stream_reap
  *
- * Purpose:     Schedules a task to free a buffer.  Executes even if a
- *              previous task failed, does not issue new failures.
+ * Purpose:     Frees the buffers of the frames sent on a coalesced
+ *              broadcast stream whose broadcasts have completed.  If wait
+ *              is set, first waits for all of them to complete.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_free_async(void *buf, tse_task_t **first_task, tse_task_t **dep_task)
+static herr_t
+H5_daos_bcast_stream_reap(H5_daos_bcast_stream_t *stream, hbool_t wait)
 {
-    tse_task_t *free_task;
-    int         ret;
-    herr_t      ret_value = SUCCEED; /* Return value */
+    int    flag;
+    int    i, j;
+    herr_t ret_value = SUCCEED;
 
-    assert(buf);
-    assert(first_task);
-    assert(dep_task);
+    assert(stream);
 
-    /* Create task for free */
-    if (H5_daos_create_task(H5_daos_free_async_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
-                            NULL, buf, &free_task) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to free buffer");
+    if (stream->nsent == 0)
+        D_GOTO_DONE(SUCCEED);
 
-    /* Schedule free task (or save it to be scheduled later) */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(free_task, false)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to free buffer: %s",
-                         H5_daos_err_to_string(ret));
+    /* Completed requests are set to MPI_REQUEST_NULL */
+    if (wait) {
+        if (MPI_SUCCESS != MPI_Waitall(stream->nsent, stream->sent_reqs, MPI_STATUSES_IGNORE))
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Waitall failed");
     } /* end if */
     else
-        *first_task = free_task;
+        for (i = 0; i < stream->nsent; i++)
+            if (MPI_SUCCESS != MPI_Test(&stream->sent_reqs[i], &flag, MPI_STATUS_IGNORE))
+                D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Test failed");
 
-    /* Do not update *dep_task since nothing depends on this buffer being freed
-     */
+    for (i = 0, j = 0; i < stream->nsent; i++)
+        if (stream->sent_reqs[i] == MPI_REQUEST_NULL)
+            DV_free(stream->sent_bufs[i]);
+        else {
+            stream->sent_reqs[j]   = stream->sent_reqs[i];
+            stream->sent_bufs[j++] = stream->sent_bufs[i];
+        } /* end else */
+    stream->nsent = j;
 
 done:
     D_FUNC_LEAVE;
-} /* end H5_daos_free_async() */
+} /* end H5_daos_bcast_stream_reap() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_create_task
+ * Function:    H5_daos_bcast_stream_free
  *
- * Purpose:     Creates a TSE task. May re-use a task from a task list if a
- *              task is available.
+ * Purpose:     Frees the coalesced broadcast stream of a file, after
+ *              waiting for the frames sent on it.  Must be called
+ *              collectively on the file's communicator once all
+ *              broadcasts on the file have completed.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_create_task(tse_task_func_t task_func, unsigned num_deps, tse_task_t *dep_tasks[],
-                    tse_task_cb_t task_prep_cb, tse_task_cb_t task_comp_cb, void *task_priv,
-                    tse_task_t **taskp)
+static herr_t
+H5_daos_bcast_stream_free(H5_daos_bcast_stream_t *stream)
 {
-    int    ret;
-    herr_t ret_value = SUCCEED;
-
-    assert(taskp);
-    assert(H5_daos_task_list_g);
-
-    if (H5_daos_task_list_avail(H5_daos_task_list_g)) {
-        if (H5_daos_task_list_get(H5_daos_task_list_g, taskp) < 0)
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get task from task list");
-
-        if (0 != (ret = tse_task_reset(*taskp, task_func, task_priv)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't reset task: %s", H5_daos_err_to_string(ret));
-    }
-    else {
-        if (0 != (ret = tse_task_create(task_func, &H5_daos_glob_sched_g, task_priv, taskp)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task: %s", H5_daos_err_to_string(ret));
-    }
-
-    assert(*taskp);
+    H5_daos_bcast_stream_t **link;
+    herr_t                   ret_value = SUCCEED;
 
-    /* Register task dependency */
-    if (num_deps && 0 != (ret = tse_task_register_deps(*taskp, (int)num_deps, dep_tasks)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register task dependencies: %s",
-                     H5_daos_err_to_string(ret));
+    assert(stream);
+    assert(!stream->in_posted);
+    assert(stream->nwaiting == 0);
 
-    if (task_prep_cb || task_comp_cb)
-        if (0 != (ret = tse_task_register_cbs(*taskp, task_prep_cb, NULL, 0, task_comp_cb, NULL, 0)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register callbacks for task: %s",
-                         H5_daos_err_to_string(ret));
+    /* Remove the stream from the queue */
+    if (stream->queued) {
+        for (link = &H5_daos_bcast_stream_queue_g; *link != stream; link = &(*link)->next_queued)
+            assert(*link);
+        *link          = stream->next_queued;
+        stream->queued = FALSE;
+    } /* end if */
 
-done:
-    if (ret_value < 0 && *taskp)
-        tse_task_complete(*taskp, -H5_DAOS_SETUP_ERROR);
+    if (H5_daos_bcast_stream_reap(stream, TRUE) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't wait for sent coalesced broadcast frames");
+
+    stream->sent_reqs      = DV_free(stream->sent_reqs);
+    stream->sent_bufs      = DV_free(stream->sent_bufs);
+    stream->nsent          = 0;
+    stream->sent_alloc     = 0;
+    stream->out_desc       = DV_free(stream->out_desc);
+    stream->out_data       = DV_free(stream->out_data);
+    stream->out_desc_alloc = 0;
+    stream->out_data_alloc = 0;
+    stream->out_data_len   = 0;
+    stream->out_nentries   = 0;
+    stream->in_buf         = DV_free(stream->in_buf);
+    stream->in_alloc       = 0;
+    if (stream->comm != MPI_COMM_NULL)
+        MPI_Comm_free(&stream->comm);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_create_task() */
+} /* end H5_daos_bcast_stream_free() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_create_daos_task
- *
- * Purpose:     Creates a DAOS task. May re-use a DAOS task from a task
- *              list if a task is available.
+ * Function:    H5_daos_mpi_req_table_progress
+ *
+ * Purpose:     Checks all in-flight MPI operations with MPI_Testsome and
+ *              completes the DAOS task for each one that has finished.
+ *              If MPI_Testsome fails, all in-flight tasks are completed
+ *              with an error.  Broadcasts received into a collective
+ *              lane's broadcast prefetch buffer are copied to the task's
+ *              buffer first (see H5_daos_mpi_ibcast_task).  Node-local
+ *              broadcasts move on to their next stage instead of
+ *              completing (see H5_daos_mpi_node_bcast()).  Before
+ *              checking, sends the frames of coalesced broadcasts queued
+ *              since the last call, and received frames are passed on to
+ *              the broadcasts waiting for them (see
+ *              H5_daos_bcast_stream_recv()).
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_create_daos_task(daos_opc_t daos_opc, unsigned num_deps, tse_task_t *dep_tasks[],
-                         tse_task_cb_t task_prep_cb, tse_task_cb_t task_comp_cb, void *task_priv,
-                         tse_task_t **taskp)
+static herr_t
+H5_daos_mpi_req_table_progress(void)
 {
-    int    ret;
-    herr_t ret_value = SUCCEED;
-
-    assert(taskp);
-    assert(H5_daos_task_list_g);
+    H5_daos_mpi_req_table_t *table = &H5_daos_mpi_req_table_g;
+    H5_daos_mpi_req_info_t   tmp_info;
+    H5_daos_coll_lane_t     *lane;
+    hbool_t                  mpi_failed = FALSE;
+    int                      task_ret;
+    int                      outcount;
+    int                      i;
+    int                      ret;
+    herr_t                   ret_value = SUCCEED;
 
-    if (H5_daos_task_list_avail(H5_daos_task_list_g)) {
-        if (H5_daos_task_list_get(H5_daos_task_list_g, taskp) < 0)
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get DAOS task from task list");
+    /* Send the frames of coalesced broadcasts queued since the last tick */
+    if (H5_daos_bcast_stream_queue_g && H5_daos_bcast_stream_flush_queued() < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't send coalesced broadcast frames");
 
-        if (0 != (ret = daos_task_reset(*taskp, daos_opc)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't reset DAOS task: %s",
-                         H5_daos_err_to_string(ret));
+    if (table->nreqs == 0)
+        D_GOTO_DONE(SUCCEED);
 
-        if (num_deps && 0 != (ret = tse_task_register_deps(*taskp, (int)num_deps, dep_tasks)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register task dependencies: %s",
-                         H5_daos_err_to_string(ret));
-    }
-    else {
-        if (0 != (ret = daos_task_create(daos_opc, &H5_daos_glob_sched_g, num_deps, dep_tasks, taskp)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create DAOS task: %s",
-                         H5_daos_err_to_string(ret));
-    }
+    /* Check which operations are complete.  Completed requests are set to
+     * MPI_REQUEST_NULL. */
+    if (MPI_SUCCESS !=
+        (ret = MPI_Testsome(table->nreqs, table->reqs, &outcount, table->indices, MPI_STATUSES_IGNORE))) {
+        mpi_failed = TRUE;
+        D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Testsome failed: %d", ret);
+    } /* end if */
+    else if (outcount == 0 || outcount == MPI_UNDEFINED)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Remove finished operations from the table and complete their tasks.
+     * Each one is replaced by the last entry in the table before its task is
+     * completed, since completion callbacks may start new MPI operations,
+     * which are appended to the table.  Iterating backwards means entries
+     * that have not been checked yet are never moved. */
+    for (i = table->nreqs - 1; i >= 0; i--)
+        if (mpi_failed || table->reqs[i] == MPI_REQUEST_NULL) {
+            tmp_info = table->infos[i];
+            table->nreqs--;
+            table->reqs[i]  = table->reqs[table->nreqs];
+            table->infos[i] = table->infos[table->nreqs];
+            task_ret        = mpi_failed ? -H5_DAOS_MPI_ERROR : 0;
+
+            if (tmp_info.stream) {
+                /* Pass the data in the frame on to the waiting broadcasts */
+                if (mpi_failed)
+                    H5_daos_bcast_stream_fail(tmp_info.stream);
+                else if (H5_daos_bcast_stream_recv(tmp_info.stream,
+                                                   tmp_info.stage == H5_DAOS_MPI_STAGE_FRAME_REST) < 0)
+                    D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't receive coalesced broadcast frame");
+                continue;
+            } /* end if */
 
-    assert(*taskp);
+            if (!mpi_failed && tmp_info.stage == H5_DAOS_MPI_STAGE_INTER_NODE) {
+                /* Pass the data on to the rest of this node.  The task will be
+                 * completed once that finishes. */
+                if (H5_daos_mpi_node_bcast(tmp_info.task, tmp_info.bcast_ud, tmp_info.prefetch_copy) >= 0)
+                    continue;
+                D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't start node-local broadcast");
+                task_ret = -H5_DAOS_MPI_ERROR;
+            } /* end if */
+            else if (!mpi_failed && tmp_info.bcast_ud) {
+                lane = tmp_info.bcast_ud->lane;
+
+                /* Read data published by the node leader */
+                if (tmp_info.stage == H5_DAOS_MPI_STAGE_NODE_READ) {
+                    if (MPI_SUCCESS != MPI_Win_sync(lane->node_bcast.win)) {
+                        D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Win_sync failed");
+                        task_ret = -H5_DAOS_MPI_ERROR;
+                    } /* end if */
+                    else if (tmp_info.prefetch_copy)
+                        (void)memcpy(lane->bcast_prefetch_buf, tmp_info.shm_slot,
+                                     (size_t)lane->bcast_prefetch_len);
+                    else
+                        (void)memcpy(tmp_info.bcast_ud->buffer, tmp_info.shm_slot,
+                                     (size_t)tmp_info.bcast_ud->count);
+                } /* end if */
 
-    if (task_prep_cb || task_comp_cb)
-        if (0 != (ret = tse_task_register_cbs(*taskp, task_prep_cb, NULL, 0, task_comp_cb, NULL, 0)))
-            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't register callbacks for task: %s",
-                         H5_daos_err_to_string(ret));
+                /* Copy data received into the prefetch buffer */
+                if (tmp_info.prefetch_copy && task_ret == 0 && tmp_info.bcast_ud->req->file->my_rank != 0) {
+                    assert(lane->bcast_prefetch_buf);
+                    (void)memcpy(tmp_info.bcast_ud->buffer, lane->bcast_prefetch_buf,
+                                 (size_t)tmp_info.bcast_ud->count);
+                } /* end if */
+            }     /* end if */
 
-    /* Set private data for task */
-    tse_task_set_priv(*taskp, task_priv);
+            /* Return task to task list */
+            if (H5_daos_task_list_put(H5_daos_task_list_g, tmp_info.task) < 0)
+                D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't return task to task list");
+            tse_task_complete(tmp_info.task, task_ret);
+        } /* end if */
 
 done:
-    if (ret_value < 0 && *taskp)
-        tse_task_complete(*taskp, -H5_DAOS_SETUP_ERROR);
-
     D_FUNC_LEAVE;
-} /* end H5_daos_create_daos_task() */
+} /* end H5_daos_mpi_req_table_progress() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_progress
@@ -4779,7 +7750,14 @@ done:
  *              long as it takes, or with timeout set to a value in
  *              nanoseconds in which case it waits up to that amount of
  *              time then exits as soon as the exit condition or the
- *              timeout is met.
+ *              timeout is met.  If the request's file uses
+ *              H5_DAOS_WAIT_ADAPTIVE, progress is first made without
+ *              blocking for H5_DAOS_WAIT_SPIN_COUNT iterations, then
+ *              daos_progress() blocks for intervals doubling up to
+ *              H5_DAOS_WAIT_MAX_INTERVAL.  While MPI operations are in
+ *              flight or coalesced broadcasts are queued the interval stays
+ *              at H5_DAOS_ASYNC_POLL_INTERVAL, since their completion does
+ *              not wake up daos_progress().
  *
  * Return:      Success:    Non-negative.
  *
@@ -4790,60 +7768,54 @@ done:
 herr_t
 H5_daos_progress(H5_daos_req_t *req, uint64_t timeout)
 {
-    int64_t     timeout_rem;
-    int         completed;
-    bool        is_empty = FALSE;
-    tse_task_t *tmp_task;
-    int         ret;
-    herr_t      ret_value = SUCCEED;
+    H5_daos_wait_mode_t wait_mode = H5_DAOS_WAIT_POLL;
+    int64_t             timeout_rem;
+    int64_t             interval = H5_DAOS_ASYNC_POLL_INTERVAL;
+    unsigned            nspin    = 0;
+    bool                is_empty = FALSE;
+    int                 ret;
+    herr_t              ret_value = SUCCEED;
 
     /* Set timeout_rem, being careful to avoid overflow */
     timeout_rem = timeout > INT64_MAX ? INT64_MAX : (int64_t)timeout;
 
+    /* Use the wait policy of the request's file */
+    if (req && req->file)
+        wait_mode = req->file->fapl_cache.wait_mode;
+
     /* Loop until the scheduler is empty, the timeout is met, the scheduler is
      * empty, or the provided request is complete */
     do {
-        /* Progress MPI if there is a task in flight */
-        if (H5_daos_mpi_task_g) {
-            /* Check if task is complete */
-            if (MPI_SUCCESS != (ret = MPI_Test(&H5_daos_mpi_req_g, &completed, MPI_STATUS_IGNORE)))
-                D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Test failed: %d", ret);
-
-            /* Complete matching DAOS task if so */
-            if (ret_value < 0) {
-                tmp_task           = H5_daos_mpi_task_g;
-                H5_daos_mpi_task_g = NULL;
-                /* Return task to task list */
-                if (H5_daos_task_list_put(H5_daos_task_list_g, tmp_task) < 0)
-                    D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
-                                 "can't return task to task list");
-                tse_task_complete(tmp_task, -H5_DAOS_MPI_ERROR);
-            } /* end if */
-            else if (completed) {
-                tmp_task           = H5_daos_mpi_task_g;
-                H5_daos_mpi_task_g = NULL;
-                /* Return task to task list */
-                if (H5_daos_task_list_put(H5_daos_task_list_g, tmp_task) < 0)
-                    D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
-                                 "can't return task to task list");
-                tse_task_complete(tmp_task, 0);
+        /* Progress MPI if there are tasks in flight */
+        if (H5_daos_mpi_req_table_progress() < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't progress MPI operations");
+
+        /* Determine how long to block in DAOS */
+        if (wait_mode == H5_DAOS_WAIT_ADAPTIVE) {
+            if (nspin < H5_DAOS_WAIT_SPIN_COUNT) {
+                interval = 0;
+                nspin++;
             } /* end if */
-        }     /* end if */
+            else if (interval == 0 || H5_daos_mpi_req_table_g.nreqs > 0 || H5_daos_bcast_stream_queue_g)
+                interval = H5_DAOS_ASYNC_POLL_INTERVAL;
+            else if (interval < H5_DAOS_WAIT_MAX_INTERVAL)
+                interval *= 2;
+        } /* end if */
 
         /* Progress DAOS */
         if ((0 != (ret = daos_progress(&H5_daos_glob_sched_g,
-                                       timeout_rem > (1000000 * H5_DAOS_ASYNC_POLL_INTERVAL)
-                                           ? H5_DAOS_ASYNC_POLL_INTERVAL
-                                           : (timeout_rem / 1000000),
+                                       timeout_rem > (1000000 * interval) ? interval
+                                                                          : (timeout_rem / 1000000),
                                        &is_empty))) &&
             (ret != -DER_TIMEDOUT))
             D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress scheduler: %s",
                          H5_daos_err_to_string(ret));
 
-        /* Advance time (H5_DAOS_ASYNC_POLL_INTERVAL is in milliseconds) */
+        /* Advance time (H5_DAOS_ASYNC_POLL_INTERVAL is in milliseconds).  When
+         * spinning, no time is deducted, the spin count bounds this. */
         /* Actually check clock here? */
-        timeout_rem -= (1000000 * H5_DAOS_ASYNC_POLL_INTERVAL);
-    } while ((req ? req->finalize_task != NULL : !is_empty) && timeout_rem > 0);
+        timeout_rem -= (1000000 * interval);
+    } while ((req ? req->finalize_task != NULL || req->collective.pending : !is_empty) && timeout_rem > 0);
 
 done:
     D_FUNC_LEAVE;
@@ -4900,9 +7872,7 @@ done:
 herr_t
 H5_daos_task_wait(tse_task_t **first_task, tse_task_t **dep_task)
 {
-    int         completed;
     bool        is_empty = FALSE;
-    tse_task_t *tmp_task;
     tse_task_t *end_task;
     hbool_t     task_complete = FALSE;
     int         ret;
@@ -4935,32 +7905,9 @@ H5_daos_task_wait(tse_task_t **first_task, tse_task_t **dep_task)
 
         /* Loop until the task is complete */
         while (!task_complete) {
-            /* Progress MPI if there is a task in flight */
-            if (H5_daos_mpi_task_g) {
-                /* Check if task is complete */
-                if (MPI_SUCCESS != (ret = MPI_Test(&H5_daos_mpi_req_g, &completed, MPI_STATUS_IGNORE)))
-                    D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Test failed: %d", ret);
-
-                /* Complete matching DAOS task if so */
-                if (ret_value < 0) {
-                    tmp_task           = H5_daos_mpi_task_g;
-                    H5_daos_mpi_task_g = NULL;
-                    /* Return task to task list */
-                    if (H5_daos_task_list_put(H5_daos_task_list_g, tmp_task) < 0)
-                        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
-                                     "can't return task to task list");
-                    tse_task_complete(tmp_task, -H5_DAOS_MPI_ERROR);
-                } /* end if */
-                else if (completed) {
-                    tmp_task           = H5_daos_mpi_task_g;
-                    H5_daos_mpi_task_g = NULL;
-                    /* Return task to task list */
-                    if (H5_daos_task_list_put(H5_daos_task_list_g, tmp_task) < 0)
-                        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
-                                     "can't return task to task list");
-                    tse_task_complete(tmp_task, 0);
-                } /* end if */
-            }     /* end if */
+            /* Progress MPI if there are tasks in flight */
+            if (H5_daos_mpi_req_table_progress() < 0)
+                D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "can't progress MPI operations");
 
             /* Progress DAOS */
             if ((0 != (ret = daos_progress(&H5_daos_glob_sched_g, H5_DAOS_ASYNC_POLL_INTERVAL, &is_empty))) &&
@@ -4976,6 +7923,180 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_task_wait() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_io_budget_acquire
+ *
+ * Purpose:     Admits a raw data I/O task of priority class io_class,
+ *              which must not yet be scheduled.  If the class already has
+ *              as many tasks in flight as its budget allows, or other
+ *              tasks of the class are already waiting, the task is made
+ *              to depend on a new gate task which is completed by
+ *              H5_daos_io_budget_release() once an earlier task of the
+ *              class completes.  Tasks of a class are therefore admitted
+ *              in the order they were created, which means a task holding
+ *              a slot never depends on a task waiting for one.
+ *
+ *              Tasks outside the budgeted classes (metadata) never go
+ *              through here, so they bypass any queued raw data I/O.
+ *              Each class always keeps its own budget, so bulk I/O is not
+ *              starved either.  Every successful call must be matched by
+ *              a call to H5_daos_io_budget_release() when the task
+ *              completes, or to H5_daos_io_budget_cancel() if the task
+ *              will never run.
+ *
+ *              The gate task the task was made to wait on, if any, is
+ *              returned in *gate_out, otherwise NULL is returned.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_io_budget_acquire(H5_daos_io_class_t io_class, tse_task_t *task, tse_task_t **gate_out)
+{
+    H5_daos_io_budget_t *budget;
+    tse_task_t          *gate = NULL;
+    int                  ret;
+    herr_t               ret_value = SUCCEED;
+
+    assert(io_class < H5_DAOS_IO_CLASS_NCLASSES);
+    assert(task);
+    assert(gate_out);
+
+    *gate_out = NULL;
+
+    budget = &H5_daos_io_budget_g[io_class];
+
+    /* Admit the task now if there is room and no task is waiting */
+    if (budget->budget == 0 || (budget->nin_flight < budget->budget && budget->ngates == 0)) {
+        budget->nin_flight++;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Make room in the gate queue if necessary */
+    if (budget->head + budget->ngates == budget->nalloc) {
+        if (budget->head > 0) {
+            memmove(budget->gates, &budget->gates[budget->head], budget->ngates * sizeof(tse_task_t *));
+            budget->head = 0;
+        } /* end if */
+        else {
+            size_t       new_nalloc = budget->nalloc ? 2 * budget->nalloc : 64;
+            tse_task_t **tmp_gates;
+
+            if (NULL == (tmp_gates = DV_realloc(budget->gates, new_nalloc * sizeof(tse_task_t *))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate I/O budget gate queue");
+            budget->gates  = tmp_gates;
+            budget->nalloc = new_nalloc;
+        } /* end else */
+    }     /* end if */
+
+    /* Create gate task */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &gate) < 0)
+        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't create I/O budget gate task");
+
+    if (0 != (ret = tse_task_schedule(gate, false)))
+        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't schedule I/O budget gate task: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Hold back task until the gate is completed */
+    if (0 != (ret = tse_task_register_deps(task, 1, &gate))) {
+        tse_task_complete(gate, 0);
+        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't register task dependency: %s",
+                     H5_daos_err_to_string(ret));
+    } /* end if */
+
+    /* Add gate to queue */
+    budget->gates[budget->head + budget->ngates++] = gate;
+    *gate_out                                      = gate;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_io_budget_acquire() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_io_budget_release
+ *
+ * Purpose:     Releases the slot held by a completed raw data I/O task of
+ *              priority class io_class.  If another task of the class is
+ *              waiting the slot is handed directly to the oldest one by
+ *              completing its gate task.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_io_budget_release(H5_daos_io_class_t io_class)
+{
+    H5_daos_io_budget_t *budget;
+    tse_task_t          *gate;
+
+    assert(io_class < H5_DAOS_IO_CLASS_NCLASSES);
+
+    budget = &H5_daos_io_budget_g[io_class];
+
+    if (budget->ngates > 0) {
+        /* Pop the oldest gate and complete it */
+        gate = budget->gates[budget->head];
+        budget->ngates--;
+        budget->head = budget->ngates ? budget->head + 1 : 0;
+        tse_task_complete(gate, 0);
+    } /* end if */
+    else {
+        assert(budget->nin_flight > 0);
+        budget->nin_flight--;
+    } /* end else */
+} /* end H5_daos_io_budget_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_io_budget_cancel
+ *
+ * Purpose:     Undoes a successful call to H5_daos_io_budget_acquire()
+ *              for a task that will never run, so its completion callback
+ *              will never release its slot.  gate must be the gate task
+ *              returned by H5_daos_io_budget_acquire().  If the task was
+ *              admitted directly its slot is released, otherwise its gate
+ *              is removed from the queue and completed.
+ *
+ *              Gates are only completed from task completion callbacks,
+ *              so this must be called before the scheduler is progressed
+ *              after the task was admitted.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_io_budget_cancel(H5_daos_io_class_t io_class, tse_task_t *gate)
+{
+    H5_daos_io_budget_t *budget;
+    size_t               i;
+
+    assert(io_class < H5_DAOS_IO_CLASS_NCLASSES);
+
+    budget = &H5_daos_io_budget_g[io_class];
+
+    /* Task was admitted directly, release its slot */
+    if (!gate) {
+        H5_daos_io_budget_release(io_class);
+        return;
+    } /* end if */
+
+    /* Find the gate and remove it from the queue */
+    for (i = budget->head; i < budget->head + budget->ngates; i++)
+        if (budget->gates[i] == gate)
+            break;
+    assert(i < budget->head + budget->ngates);
+    memmove(&budget->gates[i], &budget->gates[i + 1],
+            (budget->head + budget->ngates - i - 1) * sizeof(tse_task_t *));
+    budget->ngates--;
+    if (budget->ngates == 0)
+        budget->head = 0;
+
+    /* Complete the gate so nothing is left waiting on it */
+    tse_task_complete(gate, 0);
+} /* end H5_daos_io_budget_cancel() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_get_mpi_info
  *
@@ -5087,6 +8208,225 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_comm_info_free() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_node_bcast_init
+ *
+ * Purpose:     Sets up node-local broadcasts in a collective lane of a
+ *              file.  Splits the lane's communicator into one
+ *              communicator per shared-memory node and one for the node
+ *              leaders, and allocates the node's shared memory window.
+ *              Must be called collectively on the file's communicator.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_node_bcast_init(H5_daos_file_t *file, H5_daos_coll_lane_t *lane)
+{
+    H5_daos_node_bcast_t *node_bcast;
+    MPI_Aint              win_size;
+    MPI_Aint              shm_size;
+    int                   disp_unit;
+    herr_t                ret_value = SUCCEED;
+
+    assert(file);
+    assert(lane);
+    assert(lane->comm != MPI_COMM_NULL);
+
+    node_bcast = &lane->node_bcast;
+    assert(node_bcast->comm == MPI_COMM_NULL);
+
+    /* Split the lane's communicator by node.  Ordering by file rank makes
+     * rank 0 the leader of its node and rank 0 among the leaders. */
+    if (MPI_SUCCESS != MPI_Comm_split_type(lane->comm, MPI_COMM_TYPE_SHARED, file->my_rank, MPI_INFO_NULL,
+                                           &node_bcast->comm))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Comm_split_type failed");
+    if (MPI_SUCCESS != MPI_Comm_rank(node_bcast->comm, &node_bcast->rank))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Comm_rank failed");
+    if (MPI_SUCCESS != MPI_Comm_split(lane->comm, node_bcast->rank == 0 ? 0 : MPI_UNDEFINED, file->my_rank,
+                                      &node_bcast->leader_comm))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Comm_split failed");
+    if (node_bcast->rank == 0 && MPI_SUCCESS != MPI_Comm_size(node_bcast->leader_comm, &node_bcast->nleaders))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Comm_size failed");
+
+    /* Allocate the shared memory window on the node leader and map it on
+     * the other ranks */
+    win_size = node_bcast->rank == 0 ? 2 * H5_DAOS_NODE_BCAST_SLOT_SIZE : 0;
+    if (MPI_SUCCESS != MPI_Win_allocate_shared(win_size, 1, MPI_INFO_NULL, node_bcast->comm, &node_bcast->shm,
+                                               &node_bcast->win))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Win_allocate_shared failed");
+    if (node_bcast->rank != 0 &&
+        MPI_SUCCESS != MPI_Win_shared_query(node_bcast->win, 0, &shm_size, &disp_unit, &node_bcast->shm))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Win_shared_query failed");
+
+    /* Keep the window open for access for the life of the file.  Accesses
+     * are synchronized with MPI_Win_sync and barriers on the node. */
+    if (MPI_SUCCESS != MPI_Win_lock_all(MPI_MODE_NOCHECK, node_bcast->win))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Win_lock_all failed");
+
+done:
+    if (ret_value < 0 && H5_daos_node_bcast_free(lane) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CANTFREE, FAIL, "can't free node-local broadcast resources");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_node_bcast_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_node_bcast_free
+ *
+ * Purpose:     Frees the communicators and shared memory window used for
+ *              node-local broadcasts in a collective lane of a file, if
+ *              any.  Must be called collectively on the file's
+ *              communicator.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_node_bcast_free(H5_daos_coll_lane_t *lane)
+{
+    H5_daos_node_bcast_t *node_bcast;
+    herr_t                ret_value = SUCCEED;
+
+    assert(lane);
+
+    node_bcast = &lane->node_bcast;
+
+    if (node_bcast->win != MPI_WIN_NULL) {
+        if (MPI_SUCCESS != MPI_Win_unlock_all(node_bcast->win))
+            D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Win_unlock_all failed");
+        if (MPI_SUCCESS != MPI_Win_free(&node_bcast->win))
+            D_DONE_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Win_free failed");
+        node_bcast->win = MPI_WIN_NULL;
+    } /* end if */
+    node_bcast->shm = NULL;
+    if (node_bcast->leader_comm != MPI_COMM_NULL)
+        MPI_Comm_free(&node_bcast->leader_comm);
+    if (node_bcast->comm != MPI_COMM_NULL)
+        MPI_Comm_free(&node_bcast->comm);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_node_bcast_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_lanes_init
+ *
+ * Purpose:     Sets up the collective lanes of a file.  A file opened by
+ *              more than one process gets the number of lanes set in its
+ *              FAPL, each with its own duplicate of the file's
+ *              communicator and, if enabled, its own node-local
+ *              broadcast resources, and, if enabled, the coalesced
+ *              broadcast stream shared by the lanes.  A file opened by one
+ *              process gets a single lane without a communicator.  Must be called
+ *              collectively on the file's communicator.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_coll_lanes_init(H5_daos_file_t *file)
+{
+    H5_daos_coll_lane_t *lane;
+    unsigned             nlanes;
+    unsigned             i;
+    herr_t               ret_value = SUCCEED;
+
+    assert(file);
+    assert(!file->coll_lanes);
+
+    nlanes = file->num_procs > 1 ? MAX(file->fapl_cache.coll_lanes, 1) : 1;
+
+    if (NULL == (file->coll_lanes = (H5_daos_coll_lane_t *)DV_calloc(nlanes * sizeof(H5_daos_coll_lane_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate collective lanes");
+    for (i = 0; i < nlanes; i++) {
+        lane                         = &file->coll_lanes[i];
+        lane->comm                   = MPI_COMM_NULL;
+        lane->node_bcast.comm        = MPI_COMM_NULL;
+        lane->node_bcast.leader_comm = MPI_COMM_NULL;
+        lane->node_bcast.win         = MPI_WIN_NULL;
+    } /* end for */
+    file->ncoll_lanes       = nlanes;
+    file->bcast_stream.file = file;
+
+    if (file->num_procs > 1) {
+        for (i = 0; i < nlanes; i++) {
+            lane = &file->coll_lanes[i];
+
+            if (MPI_SUCCESS != MPI_Comm_dup(file->comm, &lane->comm))
+                D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Comm_dup failed");
+            if (file->fapl_cache.node_local_bcast && H5_daos_node_bcast_init(file, lane) < 0)
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't set up node-local broadcasts");
+        } /* end for */
+
+        /* Set up the coalesced broadcast stream shared by the lanes */
+        if (file->fapl_cache.bcast_coalesce &&
+            MPI_SUCCESS != MPI_Comm_dup(file->comm, &file->bcast_stream.comm))
+            D_GOTO_ERROR(H5E_VOL, H5E_MPI, FAIL, "MPI_Comm_dup failed");
+    } /* end if */
+
+done:
+    if (ret_value < 0 && file->coll_lanes && H5_daos_coll_lanes_free(file) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CANTFREE, FAIL, "can't free collective lanes");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_lanes_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_lanes_free
+ *
+ * Purpose:     Frees the collective lanes of a file, if any, and its
+ *              coalesced broadcast stream.  Must be called collectively on
+ *              the file's communicator.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_coll_lanes_free(H5_daos_file_t *file)
+{
+    H5_daos_coll_lane_t   *lane;
+    H5_daos_bcast_entry_t *entry;
+    unsigned               i;
+    herr_t                 ret_value = SUCCEED;
+
+    assert(file);
+
+    if (H5_daos_bcast_stream_free(&file->bcast_stream) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CANTFREE, FAIL, "can't free coalesced broadcast stream");
+
+    if (!file->coll_lanes)
+        D_GOTO_DONE(SUCCEED);
+
+    for (i = 0; i < file->ncoll_lanes; i++) {
+        lane = &file->coll_lanes[i];
+
+        /* Free data received for broadcasts that never started */
+        assert(!lane->bcast_waiting_head);
+        while (NULL != (entry = lane->bcast_recvd_head)) {
+            lane->bcast_recvd_head = entry->next;
+            DV_free(entry->buf);
+            DV_free(entry);
+        } /* end while */
+        lane->bcast_recvd_tail = NULL;
+
+        if (H5_daos_node_bcast_free(lane) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTFREE, FAIL, "can't free node-local broadcast resources");
+        lane->bcast_prefetch_buf = DV_free(lane->bcast_prefetch_buf);
+        if (lane->comm != MPI_COMM_NULL)
+            MPI_Comm_free(&lane->comm);
+    } /* end for */
+
+    file->coll_lanes  = DV_free(file->coll_lanes);
+    file->ncoll_lanes = 0;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_lanes_free() */
+
 H5PL_type_t
 H5PLget_plugin_type(void)
 {
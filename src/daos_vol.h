@@ -34,12 +34,35 @@
 
 #define H5_DAOS_SNAP_ID_INVAL (uint64_t)(int64_t) - 1
 
+/* Default number of collective lanes on a file opened by more than one
+ * process.  See H5daos_set_coll_lanes(). */
+#define H5_DAOS_COLL_LANES_DEFAULT 4
+
 /*******************/
 /* Public Typedefs */
 /*******************/
 
 typedef uint64_t H5_daos_snap_id_t;
 
+/* Policies for waiting on asynchronous operations.  See H5daos_set_wait_mode(). */
+typedef enum H5_daos_wait_mode_t {
+    H5_DAOS_WAIT_POLL,    /* Poll DAOS and MPI at a fixed interval */
+    H5_DAOS_WAIT_ADAPTIVE /* Spin without blocking, then block for increasing intervals */
+} H5_daos_wait_mode_t;
+
+/* Statistics for the connector's free lists of per-operation structures.
+ * See H5daos_get_alloc_stats(). */
+typedef struct H5_daos_alloc_stats_t {
+    uint64_t nallocs;      /* Number of blocks handed out */
+    uint64_t nreused;      /* Number of those blocks taken from a free list instead of malloc */
+    uint64_t nfrees;       /* Number of blocks returned */
+    uint64_t ncached;      /* Number of blocks currently kept for re-use */
+    uint64_t cached_bytes; /* Size in bytes of the blocks currently kept for re-use */
+} H5_daos_alloc_stats_t;
+
+/* Operator for map iteration over keys and values.  See H5daos_map_iterate_kv(). */
+typedef herr_t (*H5_daos_map_iterate_kv_t)(hid_t map_id, const void *key, const void *value, void *op_data);
+
 /********************/
 /* Public Variables */
 /********************/
@@ -168,6 +191,427 @@ H5VL_DAOS_PUBLIC herr_t H5daos_set_all_ind_metadata_ops(hid_t accpl_id, hbool_t
  */
 H5VL_DAOS_PUBLIC herr_t H5daos_get_all_ind_metadata_ops(hid_t accpl_id, hbool_t *is_independent);
 
+/**
+ * Modifies the given file access property list to allow H5Ovisit and
+ * H5Lvisit (by name) on files opened with it to visit sibling
+ * subgroups concurrently. The operator callback is then not made in
+ * any particular order, though each group is still visited before
+ * the objects below it. By default, callbacks are made in order.
+ *
+ * \param fapl_id   [IN]   File access property list
+ * \param unordered [IN]   Boolean flag indicating whether visits may be made out of order
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_unordered_visit(hid_t fapl_id, hbool_t unordered);
+
+/**
+ * Retrieves the unordered visit setting from the given file access
+ * property list.
+ *
+ * \param fapl_id   [IN]   File access property list
+ * \param unordered [OUT]  Boolean flag indicating whether visits may be made out of order
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_unordered_visit(hid_t fapl_id, hbool_t *unordered);
+
+/**
+ * Modifies the given file access property list so that each process
+ * reserves at least num_oidx object indices the first time it creates
+ * an object in a file opened with it. Later reservations double in
+ * size each time the previous one is used up. This is useful for
+ * applications that know they will create many objects. A value of 0
+ * (the default) uses the connector's default first reservation size.
+ *
+ * \param fapl_id  [IN]   File access property list
+ * \param num_oidx [IN]   Number of object indices to reserve up front
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_oidx_prealloc(hid_t fapl_id, uint64_t num_oidx);
+
+/**
+ * Retrieves the number of object indices to reserve up front from the
+ * given file access property list.
+ *
+ * \param fapl_id  [IN]   File access property list
+ * \param num_oidx [OUT]  Number of object indices to reserve up front
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_oidx_prealloc(hid_t fapl_id, uint64_t *num_oidx);
+
+/**
+ * Modifies the given file access property list so that, in files opened
+ * with it, data broadcast from rank 0 is sent over the network only to
+ * the first rank on each node. That rank then shares it with the other
+ * ranks on its node through an MPI shared memory window. This reduces
+ * network traffic when many ranks run on each node. Files must be opened
+ * with an MPI communicator for this to have any effect.
+ *
+ * \param fapl_id    [IN]   File access property list
+ * \param node_local [IN]   Boolean flag indicating whether to use node-local broadcasts
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_node_local_bcast(hid_t fapl_id, hbool_t node_local);
+
+/**
+ * Retrieves the node-local broadcast setting from the given file access
+ * property list.
+ *
+ * \param fapl_id    [IN]   File access property list
+ * \param node_local [OUT]  Boolean flag indicating whether to use node-local broadcasts
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_node_local_bcast(hid_t fapl_id, hbool_t *node_local);
+
+/**
+ * Modifies the given file access property list so that, in files opened
+ * with it, the check made after each collective operation to make sure it
+ * succeeded on all ranks is deferred. Deferred checks are made together
+ * with a single collective reduction when batch_size of them are pending,
+ * on a blocking H5ESwait() or H5VLrequest_wait(), and on H5Fflush() and
+ * H5Fclose(), all of which must then be called collectively. Until then,
+ * later operations proceed as if the operation succeeded, and its request
+ * is reported as in progress. An operation that failed on another rank is
+ * then reported as failed. A value of 0 (the default) checks each
+ * operation as it completes.
+ *
+ * \param fapl_id    [IN]   File access property list
+ * \param batch_size [IN]   Maximum number of deferred collective error checks
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_coll_err_batch(hid_t fapl_id, unsigned batch_size);
+
+/**
+ * Retrieves the collective error check batch size from the given file
+ * access property list.
+ *
+ * \param fapl_id    [IN]   File access property list
+ * \param batch_size [OUT]  Maximum number of deferred collective error checks
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_coll_err_batch(hid_t fapl_id, unsigned *batch_size);
+
+/**
+ * Modifies the given file access property list to set the number of
+ * collective lanes of files opened with it by more than one process.
+ * Collective metadata operations on a file are assigned to its lanes in
+ * turn, in the order they are issued. Operations in the same lane run one
+ * after another, while operations in different lanes, each of which uses
+ * its own duplicate of the file's communicator, may be in progress at the
+ * same time. The default is 4. A value of 1 runs all collective operations
+ * on a file one after another.
+ *
+ * \param fapl_id [IN]   File access property list
+ * \param nlanes  [IN]   Number of collective lanes (must be positive)
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_coll_lanes(hid_t fapl_id, unsigned nlanes);
+
+/**
+ * Retrieves the number of collective lanes from the given file access
+ * property list.
+ *
+ * \param fapl_id [IN]   File access property list
+ * \param nlanes  [OUT]  Number of collective lanes
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_coll_lanes(hid_t fapl_id, unsigned *nlanes);
+
+/**
+ * Modifies the given file access property list so that, in files opened
+ * with it by more than one process, the small broadcasts from rank 0 of
+ * all collective lanes that are started in the same progress tick are
+ * packed into one message, preceded by a table giving the lane and size
+ * of each. Other ranks hand each broadcast's data to the operation
+ * waiting for it in its lane. This reduces the number of broadcasts when
+ * many collective operations are in progress at the same time. Coalesced
+ * broadcasts do not use node-local broadcasts. Coalescing is disabled by
+ * default.
+ *
+ * \param fapl_id  [IN]   File access property list
+ * \param coalesce [IN]   Boolean flag indicating whether to coalesce broadcasts
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_bcast_coalesce(hid_t fapl_id, hbool_t coalesce);
+
+/**
+ * Retrieves the broadcast coalescing setting from the given file access
+ * property list.
+ *
+ * \param fapl_id  [IN]   File access property list
+ * \param coalesce [OUT]  Boolean flag indicating whether to coalesce broadcasts
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_bcast_coalesce(hid_t fapl_id, hbool_t *coalesce);
+
+/**
+ * Modifies the given file access property list to set how the connector
+ * waits for asynchronous operations on files opened with it to complete.
+ * With H5_DAOS_WAIT_POLL (the default), DAOS and MPI are polled at a fixed
+ * interval. With H5_DAOS_WAIT_ADAPTIVE, the connector first makes progress
+ * without blocking for a short while, so short operations complete with
+ * little added latency, then blocks for increasing intervals so that long
+ * waits use less CPU time. Blocking is kept short while MPI operations are
+ * in flight.
+ *
+ * \param fapl_id   [IN]   File access property list
+ * \param wait_mode [IN]   Policy for waiting on asynchronous operations
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_wait_mode(hid_t fapl_id, H5_daos_wait_mode_t wait_mode);
+
+/**
+ * Retrieves the policy for waiting on asynchronous operations from the
+ * given file access property list.
+ *
+ * \param fapl_id   [IN]   File access property list
+ * \param wait_mode [OUT]  Policy for waiting on asynchronous operations
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_wait_mode(hid_t fapl_id, H5_daos_wait_mode_t *wait_mode);
+
+/**
+ * Modifies the given map creation property list to give maps created with it
+ * a Bloom filter of nbits bits over their keys.  H5Mexists() and
+ * H5daos_map_exists_multi() then answer most checks for keys that are not in
+ * the map without accessing the map.  Each handle that adds keys keeps its
+ * own copy of the filter and writes it when the map is flushed or closed; a
+ * handle opening the map combines the copies of all handles.  The filter is
+ * consulted together with those of other handles open on the map in the same
+ * process.  It is not used while the file is open read-write in more than
+ * one process, nor if another handle had unsynced changes to the map when
+ * this handle opened it.  Keys added by processes outside the file's
+ * communicator after the map was opened are seen once it is reopened.  A size
+ * of 0, the default, disables the filter.  With the connector's 6 hashes per
+ * key, about 10 bits per expected key give a false positive rate near 1%.
+ *
+ * \param mcpl_id [IN]   Map creation property list
+ * \param nbits   [IN]   Size of the Bloom filter in bits
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_map_bloom_filter(hid_t mcpl_id, uint64_t nbits);
+
+/**
+ * Retrieves the size of the Bloom filter set on the given map creation
+ * property list.
+ *
+ * \param mcpl_id [IN]   Map creation property list
+ * \param nbits   [OUT]  Size of the Bloom filter in bits, 0 if disabled
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_map_bloom_filter(hid_t mcpl_id, uint64_t *nbits);
+
+/**
+ * Modifies the given map creation property list so that maps created with it
+ * store their values out of line, as byte arrays under a separate akey, if
+ * the size of the map's value datatype is larger than threshold bytes.  The
+ * map record then only holds the length of the value.  Values stored out of
+ * line can be read in part with H5daos_map_get_partial without fetching the
+ * whole value.  The default threshold is 1 MiB.
+ *
+ * The choice is made once per map, from the fixed size of the value datatype
+ * in the file, and not per value.  Variable-length value datatypes have a
+ * small fixed size in the file, so maps with them never store their values
+ * out of line regardless of the threshold.
+ *
+ * \param mcpl_id   [IN]   Map creation property list
+ * \param threshold [IN]   Value size in bytes above which values are stored out of line
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_map_large_value_threshold(hid_t mcpl_id, size_t threshold);
+
+/**
+ * Retrieves the value size above which maps created with the given map
+ * creation property list store their values out of line.
+ *
+ * \param mcpl_id   [IN]   Map creation property list
+ * \param threshold [OUT]  Value size in bytes above which values are stored out of line
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_map_large_value_threshold(hid_t mcpl_id, size_t *threshold);
+
+/**
+ * Retrieves statistics for the connector's free lists, which recycle the
+ * structures allocated for each chunk I/O and link read or write instead of
+ * returning them to the system allocator.  The statistics are summed over all
+ * free lists since the connector was initialized.
+ *
+ * \param stats [OUT]  Allocator statistics
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_alloc_stats(H5_daos_alloc_stats_t *stats);
+
+/**
+ * Adds or updates count key-value pairs in the map map_id, as if H5Mput were
+ * called for each pair, but with the DAOS updates for all of them issued
+ * under a single operation with a bounded number in flight at once.  The
+ * outcome for each key is stored in statuses, if not NULL.  Value conversions
+ * that need a background buffer are not supported.
+ *
+ * \param map_id          [IN]   Map
+ * \param key_mem_type_id [IN]   Memory datatype of the keys
+ * \param count           [IN]   Number of key-value pairs
+ * \param keys            [IN]   Array of count keys
+ * \param val_mem_type_id [IN]   Memory datatype of the values
+ * \param values          [IN]   Array of count values
+ * \param statuses        [OUT]  Array of count per-key results, or NULL
+ * \param dxpl_id         [IN]   Data transfer property list
+ *
+ * \return Non-negative if all keys succeeded/Negative otherwise
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_map_put_multi(hid_t map_id, hid_t key_mem_type_id, size_t count,
+                                             const void *keys, hid_t val_mem_type_id, const void *values,
+                                             herr_t *statuses, hid_t dxpl_id);
+
+/**
+ * Retrieves the values for count keys from the map map_id, as if H5Mget were
+ * called for each key, but with the DAOS fetches for all of them issued under
+ * a single operation with a bounded number in flight at once.  The outcome
+ * for each key is stored in statuses, if not NULL.  Keys that are not present
+ * in the map fail.
+ *
+ * \param map_id          [IN]   Map
+ * \param key_mem_type_id [IN]   Memory datatype of the keys
+ * \param count           [IN]   Number of keys
+ * \param keys            [IN]   Array of count keys
+ * \param val_mem_type_id [IN]   Memory datatype of the values
+ * \param values          [OUT]  Array of count values
+ * \param statuses        [OUT]  Array of count per-key results, or NULL
+ * \param dxpl_id         [IN]   Data transfer property list
+ *
+ * \return Non-negative if all keys succeeded/Negative otherwise
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_map_get_multi(hid_t map_id, hid_t key_mem_type_id, size_t count,
+                                             const void *keys, hid_t val_mem_type_id, void *values,
+                                             herr_t *statuses, hid_t dxpl_id);
+
+/**
+ * Checks whether each of count keys exists in the map map_id, as if H5Mexists
+ * were called for each key, but with the DAOS fetches for all of them issued
+ * under a single operation with a bounded number in flight at once.  The
+ * outcome for each key is stored in statuses, if not NULL.
+ *
+ * \param map_id          [IN]   Map
+ * \param key_mem_type_id [IN]   Memory datatype of the keys
+ * \param count           [IN]   Number of keys
+ * \param keys            [IN]   Array of count keys
+ * \param exists          [OUT]  Array of count existence flags
+ * \param statuses        [OUT]  Array of count per-key results, or NULL
+ * \param dxpl_id         [IN]   Data transfer property list
+ *
+ * \return Non-negative if all keys succeeded/Negative otherwise
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_map_exists_multi(hid_t map_id, hid_t key_mem_type_id, size_t count,
+                                                const void *keys, hbool_t *exists, herr_t *statuses,
+                                                hid_t dxpl_id);
+
+/**
+ * Iterates over the key-value pairs in the map map_id, as H5Miterate does,
+ * but passes each key's value to the operator along with the key.  The values
+ * for each batch of keys listed from DAOS are fetched concurrently and
+ * converted to val_mem_type_id together before the operator is called for
+ * any of them, so operators do not need to call H5Mget.  The value pointer is
+ * only valid until the operator returns.  A nonzero *idx restarts the
+ * iteration after that many pairs, as long as the map was not modified since
+ * they were iterated over.
+ *
+ * \param map_id          [IN]     Map
+ * \param idx             [IN/OUT] Number of pairs already iterated over, or NULL
+ * \param key_mem_type_id [IN]     Memory datatype of the keys
+ * \param val_mem_type_id [IN]     Memory datatype of the values
+ * \param op              [IN]     Operator called for each key-value pair
+ * \param op_data         [IN]     User data passed to op
+ * \param dxpl_id         [IN]     Data transfer property list
+ *
+ * \return The last value returned by op on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_map_iterate_kv(hid_t map_id, hsize_t *idx, hid_t key_mem_type_id,
+                                              hid_t val_mem_type_id, H5_daos_map_iterate_kv_t op,
+                                              void *op_data, hid_t dxpl_id);
+
+/**
+ * Collectively iterates over the key-value pairs in the map map_id, with each
+ * process in the file's communicator iterating over a disjoint part of the
+ * map concurrently with the others.  op is called on each process only for
+ * the keys in that process's part, so any aggregation should be done in
+ * op_data and combined by the application afterwards.  If the DAOS library
+ * cannot split the map, process 0 iterates over the whole map.  Must be called
+ * by all processes.
+ *
+ * \param map_id          [IN]   Map
+ * \param key_mem_type_id [IN]   Memory datatype of the keys
+ * \param op              [IN]   Operator called for each key in this process's part
+ * \param op_data         [IN]   User data passed to op
+ * \param nvisited        [OUT]  Total number of pairs iterated over by all processes, or NULL
+ * \param dxpl_id         [IN]   Data transfer property list
+ *
+ * \return The largest value returned by op on any process on success/Negative
+ *         on failure on any process
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_map_iterate_partitioned(hid_t map_id, hid_t key_mem_type_id, H5M_iterate_t op,
+                                                       void *op_data, hsize_t *nvisited, hid_t dxpl_id);
+
+/**
+ * Iterates in increasing key order over the keys in the map map_id that are
+ * greater than or equal to low_key and less than high_key (or less than or
+ * equal to high_key if high_inclusive is TRUE), calling op on each as
+ * H5Miterate does.  high_inclusive must be set for the range to include the
+ * largest key value, such as INT64_MAX or UINT64_MAX.  Only supported for
+ * maps with 64 bit integer keys, and requires DAOS 2.2 or later.
+ *
+ * \param map_id          [IN]   Map
+ * \param key_mem_type_id [IN]   Memory datatype of the keys and range bounds
+ * \param low_key         [IN]   Lower bound of the key range (inclusive)
+ * \param high_key        [IN]   Upper bound of the key range
+ * \param high_inclusive  [IN]   Whether high_key itself is in the range
+ * \param op              [IN]   Operator called for each key in the range
+ * \param op_data         [IN]   User data passed to op
+ * \param dxpl_id         [IN]   Data transfer property list
+ *
+ * \return The last value returned by op on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_map_iterate_range(hid_t map_id, hid_t key_mem_type_id, const void *low_key,
+                                                 const void *high_key, hbool_t high_inclusive,
+                                                 H5M_iterate_t op, void *op_data, hid_t dxpl_id);
+
+/**
+ * Reads len bytes starting at byte offset of the value for the given key in
+ * the map map_id into buf.  The bytes are read from the value as stored, in
+ * the map's value file datatype, without datatype conversion.  For maps that
+ * store their values out of line only the requested bytes are fetched,
+ * otherwise the whole value is fetched and the requested bytes copied out.
+ *
+ * \param map_id          [IN]   Map
+ * \param key_mem_type_id [IN]   Memory datatype of the key
+ * \param key             [IN]   Key
+ * \param offset          [IN]   Offset in bytes into the value
+ * \param len             [IN]   Number of bytes to read
+ * \param buf             [OUT]  Buffer to read the bytes into
+ * \param dxpl_id         [IN]   Data transfer property list
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_map_get_partial(hid_t map_id, hid_t key_mem_type_id, const void *key,
+                                               size_t offset, size_t len, void *buf, hid_t dxpl_id);
+
 #ifdef DSINC
 H5VL_DAOS_PUBLIC herr_t H5daos_snap_create(hid_t loc_id, H5_daos_snap_id_t *snap_id);
 #endif
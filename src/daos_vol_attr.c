@@ -22,6 +22,12 @@
     (H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE + H5_DAOS_ACPL_BUF_SIZE +                                \
      3 * H5_DAOS_ENCODED_UINT64_T_SIZE)
 
+/* Leading bytes of the akeys of the records a compaction adds to an object's
+ * attribute creation order index (the leading byte of the akey mapping a slot
+ * to the attribute name is 0) */
+#define H5_DAOS_ATTR_CORDER_REC_TAG 1 /* Slot -> attribute creation order value */
+#define H5_DAOS_ATTR_SLOT_REC_TAG   2 /* Attribute creation order value -> slot */
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -37,6 +43,7 @@ typedef struct H5_daos_attr_create_ud_t {
     uint8_t               nattr_old_buf[H5_DAOS_ENCODED_NUM_ATTRS_SIZE + 1];
     uint8_t               max_corder_old_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     uint8_t               max_corder_new_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    uint8_t               fmt_buf[H5_DAOS_ENCODED_CORDER_FMT_SIZE];
     uint8_t               flex_buf[];
 } H5_daos_attr_create_ud_t;
 
@@ -127,7 +134,7 @@ typedef struct H5_daos_attr_iterate_ud_t {
         } name_order_data;
 
         struct {
-            hsize_t obj_nattrs;
+            H5_daos_corder_info_t corder_info;
         } crt_order_data;
     } u;
 } H5_daos_attr_iterate_ud_t;
@@ -144,17 +151,18 @@ typedef struct H5_daos_attr_iterate_op_ud_t {
 /* User data struct for attribute get name by index
  * with automatic asynchronous name buffer allocation */
 typedef struct H5_daos_attr_gnbi_alloc_ud_t {
-    H5_daos_req_t  *req;
-    tse_task_t     *gnbi_task;
-    H5_daos_obj_t  *target_obj;
-    H5_index_t      index_type;
-    H5_iter_order_t iter_order;
-    uint64_t        idx;
-    const char    **attr_name;
-    size_t         *attr_name_size;
-    char          **attr_name_buf;
-    size_t         *attr_name_buf_size;
-    size_t          cur_attr_name_size;
+    H5_daos_req_t               *req;
+    tse_task_t                  *gnbi_task;
+    H5_daos_obj_t               *target_obj;
+    H5_index_t                   index_type;
+    H5_iter_order_t              iter_order;
+    uint64_t                     idx;
+    const H5_daos_corder_info_t *corder_info;
+    const char                 **attr_name;
+    size_t                      *attr_name_size;
+    char                       **attr_name_buf;
+    size_t                      *attr_name_buf_size;
+    size_t                       cur_attr_name_size;
 } H5_daos_attr_gnbi_alloc_ud_t;
 
 /* Task user data for retrieving an attribute's name
@@ -166,17 +174,21 @@ typedef struct H5_daos_attr_get_name_by_idx_ud_t {
     H5_index_t      index_type;
     H5_iter_order_t iter_order;
     uint64_t        idx;
-    hsize_t         obj_nattrs;
     char           *attr_name_out;
     size_t          attr_name_out_size;
     size_t         *attr_name_size_ret;
     union {
         struct {
-            uint64_t cur_attr_idx;
+            tse_task_t          *gnbno_task;
+            H5_daos_name_cache_t names;
+            hbool_t              names_built;
+            uint64_t             build_gen;
         } by_name_data;
         struct {
-            H5_daos_md_rw_cb_ud_t md_rw_cb_ud;
-            uint8_t               idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
+            H5_daos_md_rw_cb_ud_t        md_rw_cb_ud;
+            const H5_daos_corder_info_t *corder_info;
+            H5_daos_corder_info_t        own_corder_info;
+            uint8_t                      idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
         } by_crt_order_data;
     } u;
 } H5_daos_attr_get_name_by_idx_ud_t;
@@ -252,8 +264,12 @@ static herr_t H5_daos_attribute_remove_from_crt_idx(H5_daos_obj_t
                                                     const H5VL_attr_specific_args_t *delete_args,
                                                     const char *attr_name, H5_daos_req_t *req,
                                                     tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t H5_daos_attribute_remove_from_sparse_crt_idx(H5_daos_obj_t *target_obj, const char *attr_name,
+                                                           const H5_daos_corder_info_t *corder_info);
 static herr_t H5_daos_attribute_remove_from_crt_idx_name_cb(hid_t loc_id, const char *attr_name,
                                                             const H5A_info_t *attr_info, void *op_data);
+static herr_t H5_daos_attribute_compact_crt_idx(H5_daos_obj_t                *target_obj,
+                                                const H5_daos_corder_info_t *corder_info, uint64_t skip_slot);
 static herr_t H5_daos_attribute_shift_crt_idx_keys_down(H5_daos_obj_t *target_obj, uint64_t idx_begin,
                                                         uint64_t idx_end);
 static herr_t H5_daos_attribute_exists(H5_daos_obj_t *attr_container_obj, const char *attr_name,
@@ -283,12 +299,14 @@ static herr_t H5_daos_attribute_rename(H5_daos_obj_t *attr_container_obj, const
 static int    H5_daos_attr_gnbi_alloc_task(tse_task_t *task);
 static herr_t H5_daos_attribute_get_name_by_idx_alloc(H5_daos_obj_t *target_obj, H5_index_t index_type,
                                                       H5_iter_order_t iter_order, uint64_t idx,
+                                                      const H5_daos_corder_info_t *corder_info,
                                                       const char **attr_name, size_t *attr_name_size,
                                                       char **attr_name_buf, size_t *attr_name_buf_size,
                                                       H5_daos_req_t *req, tse_task_t **first_task,
                                                       tse_task_t **dep_task);
 static herr_t H5_daos_attribute_get_name_by_idx(H5_daos_obj_t *target_obj, H5_index_t index_type,
-                                                H5_iter_order_t iter_order, uint64_t idx, char *attr_name_out,
+                                                H5_iter_order_t iter_order, uint64_t idx,
+                                                const H5_daos_corder_info_t *corder_info, char *attr_name_out,
                                                 size_t attr_name_out_size, size_t *attr_name_size,
                                                 H5_daos_req_t *req, tse_task_t **first_task,
                                                 tse_task_t **dep_task);
@@ -297,8 +315,10 @@ static herr_t H5_daos_attribute_get_name_by_name_order(H5_daos_attr_get_name_by_
                                                        tse_task_t **dep_task);
 static herr_t H5_daos_attribute_get_name_by_name_order_cb(hid_t loc_id, const char *attr_name,
                                                           const H5A_info_t *attr_info, void *op_data);
-static int    H5_daos_attribute_gnbno_no_attrs_check_task(tse_task_t *task);
+static int    H5_daos_attribute_gnbno_task(tse_task_t *task);
+static int    H5_daos_attribute_gnbno_end_task(tse_task_t *task);
 static herr_t H5_daos_attribute_get_name_by_crt_order(H5_daos_attr_get_name_by_idx_ud_t *get_name_udata,
+                                                      const H5_daos_corder_info_t     *corder_info,
                                                       H5_daos_req_t *req, tse_task_t **first_task,
                                                       tse_task_t **dep_task);
 static int    H5_daos_attribute_get_name_by_crt_order_prep_cb(tse_task_t *task, void *args);
@@ -1047,6 +1067,9 @@ H5_daos_attribute_create_helper_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED
         udata->req->failed_task = udata->md_rw_cb_ud.task_name;
     } /* end if */
 
+    /* Invalidate cached attribute name lists */
+    udata->req->file->attr_mod_gen++;
+
     /* Close attribute  */
     if (H5_daos_attribute_close_real(udata->attr) < 0)
         D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close attribute");
@@ -1113,12 +1136,13 @@ H5_daos_attribute_create_get_crt_order_info(H5_daos_attr_create_ud_t *create_ud,
     assert(dep_task);
     assert(create_ud->md_rw_cb_ud.nr == 3u);
 
-    /* Create task to read object's current number of attributes
-     * and maximum attribute creation order value
+    /* Create task to read object's current number of attributes, maximum
+     * attribute creation order value and number of creation order index holes
      */
 
     /* Modify existing iod. iod[3] contains the key for the number of attributes.
      * iod[4] contains the key for the object's max. attribute creation order value.
+     * iod[5] contains the key for the number of holes in the creation order index.
      * iod[0], iod[1] and iod[2] are assumed to already be set.
      */
     daos_const_iov_set((d_const_iov_t *)&create_ud->md_rw_cb_ud.iod[3].iod_name, H5_daos_nattr_key_g,
@@ -1135,6 +1159,13 @@ H5_daos_attribute_create_get_crt_order_info(H5_daos_attr_create_ud_t *create_ud,
     create_ud->md_rw_cb_ud.iod[4].iod_type  = DAOS_IOD_SINGLE;
     create_ud->md_rw_cb_ud.iod[4].iod_flags = 0;
 
+    daos_const_iov_set((d_const_iov_t *)&create_ud->md_rw_cb_ud.iod[5].iod_name,
+                       H5_daos_attr_corder_fmt_key_g, H5_daos_attr_corder_fmt_key_size_g);
+    create_ud->md_rw_cb_ud.iod[5].iod_nr    = 1u;
+    create_ud->md_rw_cb_ud.iod[5].iod_size  = (uint64_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE;
+    create_ud->md_rw_cb_ud.iod[5].iod_type  = DAOS_IOD_SINGLE;
+    create_ud->md_rw_cb_ud.iod[5].iod_flags = 0;
+
     /* Modify existing sgl.
      *
      * sgl[3] contains the read buffer for the number of attributes.
@@ -1146,6 +1177,11 @@ H5_daos_attribute_create_get_crt_order_info(H5_daos_attr_create_ud_t *create_ud,
      * sgl[4] contains the read buffer for the object's max. attribute creation
      * order value. It is used to determine an attribute's permanent creation
      * order value.
+     *
+     * sgl[5] contains the read buffer for the format record of the object's
+     * attribute creation order index. If present, the index is sparse and
+     * the new attribute's slot in the index is derived from its permanent
+     * creation order value.
      */
     create_ud->nattr_old_buf[0] = 0;
     daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[3], &create_ud->nattr_old_buf[1], (daos_size_t)8);
@@ -1160,6 +1196,13 @@ H5_daos_attribute_create_get_crt_order_info(H5_daos_attr_create_ud_t *create_ud,
     create_ud->md_rw_cb_ud.sgl[4].sg_iovs   = &create_ud->md_rw_cb_ud.sg_iov[4];
     create_ud->md_rw_cb_ud.free_sg_iov[4]   = FALSE;
 
+    daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[5], create_ud->fmt_buf,
+                 (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE);
+    create_ud->md_rw_cb_ud.sgl[5].sg_nr     = 1;
+    create_ud->md_rw_cb_ud.sgl[5].sg_nr_out = 0;
+    create_ud->md_rw_cb_ud.sgl[5].sg_iovs   = &create_ud->md_rw_cb_ud.sg_iov[5];
+    create_ud->md_rw_cb_ud.free_sg_iov[5]   = FALSE;
+
     /* Create task for attribute creation order metadata fetch */
     if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
                                  H5_daos_attribute_create_get_crt_order_info_prep_cb,
@@ -1231,7 +1274,7 @@ H5_daos_attribute_create_get_crt_order_info_prep_cb(tse_task_t *task, void H5VL_
         update_args->th    = DAOS_TX_NONE;
         update_args->flags = udata->md_rw_cb_ud.flags;
         update_args->dkey  = &udata->md_rw_cb_ud.dkey;
-        update_args->nr    = 2u;
+        update_args->nr    = 3u;
         update_args->iods  = &udata->md_rw_cb_ud.iod[3];
         update_args->sgls  = &udata->md_rw_cb_ud.sgl[3];
     } /* end if */
@@ -1281,10 +1324,12 @@ H5_daos_attribute_create_get_crt_order_info_comp_cb(tse_task_t *task, void H5VL_
         udata->req->failed_task = udata->md_rw_cb_ud.task_name;
     } /* end if */
     else if (task->dt_result == 0 && udata->attr->parent->ocpl_cache.track_acorder) {
-        uint64_t max_corder;
-        uint64_t nattr;
-        size_t   name_len = strlen(udata->attr->name);
-        uint8_t *p;
+        H5_daos_corder_info_t corder_info;
+        uint64_t              max_corder;
+        uint64_t              nattr;
+        hbool_t               new_fmt  = FALSE;
+        size_t                name_len = strlen(udata->attr->name);
+        uint8_t              *p;
 
         p = &udata->nattr_old_buf[1];
 
@@ -1329,6 +1374,39 @@ H5_daos_attribute_create_get_crt_order_info_comp_cb(tse_task_t *task, void H5VL_
             UINT64DECODE(p, max_corder);
         } /* end else */
 
+        /* Determine the new attribute's slot in the index.  The first
+         * attribute added to an empty index without a format record (a new
+         * index, or an emptied one in the older format) starts a sparse index
+         * whose slots begin at the attribute's creation order value, and the
+         * index's format record is written with the attribute.  In a sparse
+         * index the slot is derived from the attribute's creation order
+         * value, in an index in the older format it is the current number of
+         * attributes (already encoded). */
+        if (udata->md_rw_cb_ud.iod[5].iod_size == (uint64_t)0) {
+            if (nattr == 1) {
+                new_fmt = TRUE;
+                H5_daos_corder_fmt_encode(udata->fmt_buf, max_corder, max_corder);
+            } /* end if */
+        }     /* end if */
+        else {
+            /* Verify the iod size was as expected */
+            if (udata->md_rw_cb_ud.iod[5].iod_size != (uint64_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE)
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTDECODE, -H5_DAOS_BAD_VALUE,
+                             "invalid size of attribute creation order index format record");
+
+            /* Decode the index format */
+            memset(&corder_info, 0, sizeof(corder_info));
+            if (H5_daos_corder_fmt_decode(udata->fmt_buf, &corder_info) < 0)
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTDECODE, -H5_DAOS_H5_DECODE_ERROR,
+                             "can't decode attribute creation order index format record");
+            if (max_corder < corder_info.slot_base)
+                D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                             "attribute creation order index slot base is invalid");
+
+            p = &udata->nattr_old_buf[1];
+            UINT64ENCODE(p, max_corder - corder_info.slot_base);
+        } /* end else */
+
         /* Increase max. creation order value */
         max_corder++;
 
@@ -1402,6 +1480,25 @@ H5_daos_attribute_create_get_crt_order_info_comp_cb(tse_task_t *task, void H5VL_
         /* Update nr for subsequent daos_obj_update call */
         udata->md_rw_cb_ud.nr = 7u;
 
+        /* iod[7] and sgl[7] contain the format record of a new sparse index */
+        if (new_fmt) {
+            daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[7].iod_name,
+                               H5_daos_attr_corder_fmt_key_g, H5_daos_attr_corder_fmt_key_size_g);
+            udata->md_rw_cb_ud.iod[7].iod_nr    = 1u;
+            udata->md_rw_cb_ud.iod[7].iod_size  = (uint64_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE;
+            udata->md_rw_cb_ud.iod[7].iod_type  = DAOS_IOD_SINGLE;
+            udata->md_rw_cb_ud.iod[7].iod_flags = 0;
+
+            daos_iov_set(&udata->md_rw_cb_ud.sg_iov[7], udata->fmt_buf,
+                         (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE);
+            udata->md_rw_cb_ud.sgl[7].sg_nr     = 1;
+            udata->md_rw_cb_ud.sgl[7].sg_nr_out = 0;
+            udata->md_rw_cb_ud.sgl[7].sg_iovs   = &udata->md_rw_cb_ud.sg_iov[7];
+            udata->md_rw_cb_ud.free_sg_iov[7]   = FALSE;
+
+            udata->md_rw_cb_ud.nr = 8u;
+        } /* end if */
+
         /* Set conditional per-akey insert for the attribute metadata write operation */
         udata->md_rw_cb_ud.flags = DAOS_COND_PER_AKEY;
     } /* end else */
@@ -1609,7 +1706,7 @@ H5_daos_attribute_open_helper(H5_daos_item_t *item, const H5VL_loc_params_t *loc
         bcast_udata->bcast_ud.buffer     = bcast_udata->flex_buf;
         bcast_udata->bcast_ud.buffer_len = H5_DAOS_AINFO_BCAST_BUF_SIZE;
         bcast_udata->bcast_ud.count      = H5_DAOS_AINFO_BCAST_BUF_SIZE;
-        bcast_udata->bcast_ud.comm       = req->file->comm;
+        bcast_udata->bcast_ud.lane       = NULL;
         bcast_udata->attr                = attr;
 
         ainfo_buf_size = H5_DAOS_AINFO_BCAST_BUF_SIZE;
@@ -1817,7 +1914,7 @@ done:
     /* Broadcast attribute info */
     if (bcast_udata) {
         if (H5_daos_mpi_ibcast((H5_daos_mpi_ibcast_ud_t *)bcast_udata, NULL, ainfo_buf_size,
-                               NULL == ret_value ? TRUE : FALSE, NULL,
+                               NULL == ret_value ? TRUE : FALSE, TRUE, NULL,
                                item->file->my_rank == 0 ? H5_daos_attribute_open_bcast_comp_cb
                                                         : H5_daos_attribute_open_recv_comp_cb,
                                req, first_task, dep_task) < 0) {
@@ -1933,7 +2030,7 @@ H5_daos_attribute_open_by_idx_helper(H5_daos_obj_t *target_obj, const H5VL_loc_p
     /* Retrieve the attribute's name by index */
     if (H5_daos_attribute_get_name_by_idx_alloc(
             attr_parent_obj, loc_params->loc_data.loc_by_idx.idx_type, loc_params->loc_data.loc_by_idx.order,
-            (uint64_t)loc_params->loc_data.loc_by_idx.n, &target_attr_name, &target_attr_name_len,
+            (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL, &target_attr_name, &target_attr_name_len,
             &attr_name_buf, NULL, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute name");
 
@@ -2709,7 +2806,7 @@ H5_daos_attribute_read_int(H5_daos_attr_t *attr, hid_t mem_type_id, hbool_t coll
         bcast_udata->buffer     = need_tconv ? tconv_buf : buf;
         bcast_udata->buffer_len = bcast_buf_size;
         bcast_udata->count      = bcast_udata->buffer_len;
-        bcast_udata->comm       = req->file->comm;
+        bcast_udata->lane       = NULL;
     } /* end if */
 
     if (!collective || (attr->item.file->my_rank == 0) || need_tconv) {
@@ -2833,7 +2930,7 @@ done:
     /* Broadcast attribute data buffer if necessary */
     if (collective && attr && (attr->item.file->num_procs > 1)) {
         if (bcast_udata &&
-            H5_daos_mpi_ibcast(bcast_udata, NULL, (size_t)bcast_udata->buffer_len, FALSE, NULL,
+            H5_daos_mpi_ibcast(bcast_udata, NULL, (size_t)bcast_udata->buffer_len, FALSE, FALSE, NULL,
                                H5_daos_attribute_read_bcast_comp_cb, req, first_task, dep_task) < 0)
             D_DONE_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't broadcast attribute data buffer");
 
@@ -4669,7 +4766,7 @@ H5_daos_attribute_get_name(H5_daos_obj_t *target_obj, const H5VL_loc_params_t *l
 
             if (H5_daos_attribute_get_name_by_idx(
                     parent_obj, loc_params->loc_data.loc_by_idx.idx_type,
-                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
+                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL,
                     attr_name_out, attr_name_out_size, size_ret, req, first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, (-1), "can't get attribute name by index");
 
@@ -5058,7 +5155,7 @@ H5_daos_attribute_delete(H5_daos_obj_t *attr_container_obj, const H5VL_loc_param
         if (H5VL_ATTR_DELETE_BY_IDX == delete_args->op_type) {
             if (H5_daos_attribute_get_name_by_idx_alloc(
                     attr_container_obj, delete_args->args.delete_by_idx.idx_type,
-                    delete_args->args.delete_by_idx.order, (uint64_t)delete_args->args.delete_by_idx.n,
+                    delete_args->args.delete_by_idx.order, (uint64_t)delete_args->args.delete_by_idx.n, NULL,
                     &delete_udata->target_attr_name, &delete_udata->target_attr_name_len,
                     &delete_udata->attr_name_buf, NULL, req, first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute name");
@@ -5220,6 +5317,9 @@ H5_daos_attribute_delete_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         udata->req->failed_task = "attribute deletion task";
     } /* end if */
 
+    /* Invalidate cached attribute name lists */
+    udata->req->file->attr_mod_gen++;
+
 done:
     /* Return task to task list */
     if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
@@ -5270,14 +5370,15 @@ H5_daos_attribute_remove_from_crt_idx(H5_daos_obj_t *target_obj, const H5VL_attr
                                       const char *attr_name, H5_daos_req_t *req, tse_task_t **first_task,
                                       tse_task_t **dep_task)
 {
-    daos_key_t dkey;
-    daos_key_t crt_akey;
-    uint64_t   delete_idx = 0;
-    uint8_t    idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
-    uint8_t   *p;
-    hsize_t    obj_nattrs_remaining;
-    int        ret;
-    herr_t     ret_value = SUCCEED;
+    H5_daos_corder_info_t corder_info;
+    daos_key_t            dkey;
+    daos_key_t            crt_akey;
+    uint64_t              delete_idx = 0;
+    uint8_t               idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
+    uint8_t              *p;
+    hsize_t               obj_nattrs_remaining;
+    int                   ret;
+    herr_t                ret_value = SUCCEED;
 
     assert(target_obj);
     assert(delete_args);
@@ -5287,12 +5388,30 @@ H5_daos_attribute_remove_from_crt_idx(H5_daos_obj_t *target_obj, const H5VL_attr
     assert(dep_task);
     H5daos_compile_assert(H5_DAOS_ENCODED_CRT_ORDER_SIZE == 8);
 
-    /* Retrieve the current number of attributes attached to the object */
-    if (H5_daos_object_get_num_attrs(target_obj, &obj_nattrs_remaining, FALSE, req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get the number of attributes attached to object");
+    /* Retrieve the current number of attributes attached to the object, along
+     * with the information needed to determine if its creation order index is
+     * sparse */
+    if (H5_daos_object_get_corder_info(target_obj, TRUE, TRUE, &corder_info, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute creation order index info");
 
     H5_DAOS_WAIT_ON_ASYNC_CHAIN(req, *first_task, *dep_task, H5E_ATTR, H5E_CANTINIT, FAIL);
 
+    obj_nattrs_remaining = (hsize_t)corder_info.nobjs;
+
+    /*
+     * The index is sparse if it has a format record. A sparse index records
+     * the removed attribute's slot as a hole (compacting the index once too
+     * many of its slots are holes), otherwise the index is an index from an
+     * older file and the akeys past the removed attribute must be shifted
+     * down.
+     */
+    if (corder_info.sparse) {
+        if (H5_daos_attribute_remove_from_sparse_crt_idx(target_obj, attr_name, &corder_info) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTREMOVE, FAIL,
+                         "can't remove attribute from sparse creation order index");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
     /* Determine the index value of the attribute to be removed */
     if (H5VL_ATTR_DELETE_BY_IDX == delete_args->op_type) {
         /* DSINC - no check for safe cast here */
@@ -5395,9 +5514,227 @@ H5_daos_attribute_remove_from_crt_idx(H5_daos_obj_t *target_obj, const H5VL_attr
     } /* end if */
 
 done:
+    corder_info.holes = DV_free(corder_info.holes);
+
     D_FUNC_LEAVE;
 } /* end H5_daos_attribute_remove_from_crt_idx() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_attribute_remove_from_sparse_crt_idx
+ *
+ * Purpose:     Helper routine for H5_daos_attribute_remove_from_crt_idx
+ *              which removes an attribute from a sparse attribute
+ *              creation order index. The attribute's slot in the index is
+ *              derived from its permanent creation order value, or looked
+ *              up if the attribute was moved by the last compaction. The
+ *              slot's akeys are removed and the slot is added to the
+ *              index's holes, or the index is compacted once too many of
+ *              its slots are holes. If the last attribute was removed,
+ *              the index is reset to its initial empty state.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_attribute_remove_from_sparse_crt_idx(H5_daos_obj_t *target_obj, const char *attr_name,
+                                             const H5_daos_corder_info_t *corder_info)
+{
+    H5_daos_corder_holes_update_t holes_update;
+    daos_key_t                    dkey;
+    daos_key_t                    punch_akeys[3];
+    daos_iod_t                    iods[2];
+    daos_sg_list_t                sgls[2];
+    daos_iov_t                    sg_iovs[2];
+    uint64_t                      corder;
+    uint64_t                      slot;
+    hbool_t                       moved;
+    uint8_t                       idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
+    uint8_t                       corder_rec_key_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
+    uint8_t                       slot_rec_key_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
+    uint8_t                       slot_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    uint8_t                       nholes_buf[H5_DAOS_ENCODED_UINT64_T_SIZE];
+    uint8_t                       fmt_buf[H5_DAOS_ENCODED_CORDER_FMT_SIZE];
+    uint8_t                      *p;
+    int                           ret;
+    herr_t                        ret_value = SUCCEED;
+
+    assert(target_obj);
+    assert(attr_name);
+    assert(corder_info);
+    assert(corder_info->sparse);
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&dkey, H5_daos_attr_key_g, H5_daos_attr_key_size_g);
+
+    /* Retrieve the attribute's permanent creation order value */
+    if (H5_daos_attribute_get_crt_order_by_name(target_obj, attr_name, &corder) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute's creation order value");
+
+    /* Set up akey which maps the attribute's creation order value -> slot */
+    p    = slot_rec_key_buf;
+    *p++ = H5_DAOS_ATTR_SLOT_REC_TAG;
+    UINT64ENCODE(p, corder);
+
+    /* Determine the attribute's slot.  Attributes created after the index was
+     * last compacted sit in the slot derived from their creation order
+     * value, attributes moved by the last compaction have a record of their
+     * slot. */
+    moved = corder < corder_info->compact_mark;
+    if (moved) {
+        memset(&iods[0], 0, sizeof(iods[0]));
+        daos_iov_set(&iods[0].iod_name, (void *)slot_rec_key_buf, sizeof(slot_rec_key_buf));
+        iods[0].iod_nr   = 1u;
+        iods[0].iod_size = (uint64_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+        iods[0].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&sg_iovs[0], slot_buf, (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+        sgls[0].sg_nr     = 1;
+        sgls[0].sg_nr_out = 0;
+        sgls[0].sg_iovs   = &sg_iovs[0];
+
+        if (0 != (ret = daos_obj_fetch(target_obj->obj_oh, DAOS_TX_NONE, DAOS_COND_AKEY_FETCH, &dkey, 1,
+                                       &iods[0], &sgls[0], NULL /*maps*/, NULL /*event*/)))
+            D_GOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL,
+                         "can't read attribute's slot in creation order index: %s",
+                         H5_daos_err_to_string(ret));
+        if (iods[0].iod_size != (uint64_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE)
+            D_GOTO_ERROR(H5E_ATTR, H5E_BADSIZE, FAIL,
+                         "invalid size of attribute creation order index slot record");
+
+        p = slot_buf;
+        UINT64DECODE(p, slot);
+    } /* end if */
+    else {
+        if (corder < corder_info->slot_base)
+            D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL,
+                         "attribute creation order value is below the index's slot base");
+        slot = corder - corder_info->slot_base;
+    } /* end else */
+
+    /* Remove the akey which maps creation order -> attribute name */
+    idx_buf[0] = 0;
+    p          = &idx_buf[1];
+    UINT64ENCODE(p, slot);
+    daos_iov_set(&punch_akeys[0], (void *)idx_buf, H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+
+    /* Remove the records mapping the slot of a moved attribute to its
+     * creation order value and back */
+    if (moved) {
+        p    = corder_rec_key_buf;
+        *p++ = H5_DAOS_ATTR_CORDER_REC_TAG;
+        UINT64ENCODE(p, slot);
+        daos_iov_set(&punch_akeys[1], (void *)corder_rec_key_buf, sizeof(corder_rec_key_buf));
+        daos_iov_set(&punch_akeys[2], (void *)slot_rec_key_buf, sizeof(slot_rec_key_buf));
+    } /* end if */
+
+    if (0 != (ret = daos_obj_punch_akeys(target_obj->obj_oh, DAOS_TX_NONE, DAOS_COND_PUNCH, &dkey,
+                                         moved ? 3 : 1, punch_akeys, NULL /*event*/)))
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTREMOVE, FAIL, "failed to punch attribute akey: %s",
+                     H5_daos_err_to_string(ret));
+
+    if (corder_info->nobjs == 0) {
+        uint8_t max_corder_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+
+        /* If the last attribute was removed from the object, reset the max.
+         * attribute creation order value and the index's format record and
+         * remove the index's holes so the index starts over as an empty
+         * index.
+         */
+        memset(max_corder_buf, 0, sizeof(max_corder_buf));
+        memset(iods, 0, sizeof(iods));
+        daos_const_iov_set((d_const_iov_t *)&iods[0].iod_name, H5_daos_max_attr_corder_key_g,
+                           H5_daos_max_attr_corder_key_size_g);
+        iods[0].iod_nr   = 1u;
+        iods[0].iod_size = (uint64_t)8;
+        iods[0].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&sg_iovs[0], max_corder_buf, (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+        sgls[0].sg_nr     = 1;
+        sgls[0].sg_nr_out = 0;
+        sgls[0].sg_iovs   = &sg_iovs[0];
+
+        H5_daos_corder_fmt_encode(fmt_buf, 0, 0);
+        daos_const_iov_set((d_const_iov_t *)&iods[1].iod_name, H5_daos_attr_corder_fmt_key_g,
+                           H5_daos_attr_corder_fmt_key_size_g);
+        iods[1].iod_nr   = 1u;
+        iods[1].iod_size = (uint64_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE;
+        iods[1].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&sg_iovs[1], fmt_buf, (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE);
+        sgls[1].sg_nr     = 1;
+        sgls[1].sg_nr_out = 0;
+        sgls[1].sg_iovs   = &sg_iovs[1];
+
+        if (0 != (ret = daos_obj_update(target_obj->obj_oh, DAOS_TX_NONE, DAOS_COND_AKEY_UPDATE, &dkey, 2,
+                                        iods, sgls, NULL /*event*/)))
+            D_GOTO_ERROR(H5E_ATTR, H5E_WRITEERROR, FAIL,
+                         "failed to reset attribute creation order index: %s", H5_daos_err_to_string(ret));
+
+        /* Remove the holes, if any were recorded */
+        if (corder_info->nholes > 0) {
+            daos_const_iov_set((d_const_iov_t *)&punch_akeys[0], H5_daos_nattr_corder_holes_key_g,
+                               H5_daos_nattr_corder_holes_key_size_g);
+            daos_const_iov_set((d_const_iov_t *)&punch_akeys[1], H5_daos_attr_corder_holes_key_g,
+                               H5_daos_attr_corder_holes_key_size_g);
+
+            if (0 != (ret = daos_obj_punch_akeys(target_obj->obj_oh, DAOS_TX_NONE, 0, &dkey, 2, punch_akeys,
+                                                 NULL /*event*/)))
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTREMOVE, FAIL,
+                             "failed to punch attribute creation order index holes: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+    }     /* end if */
+    else if (H5_daos_corder_compact_needed(corder_info, corder_info->nobjs)) {
+        /* Too many of the index's slots are holes, compact it */
+        if (H5_daos_attribute_compact_crt_idx(target_obj, corder_info, slot) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTMODIFY, FAIL, "can't compact attribute creation order index");
+    } /* end if */
+    else {
+        /* Add the slot to the index's holes */
+        if (H5_daos_corder_holes_insert(corder_info, slot, &holes_update) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTINSERT, FAIL, "can't add hole to attribute creation order index");
+
+        p = nholes_buf;
+        UINT64ENCODE(p, holes_update.nholes);
+
+        /* Write the changed hole records */
+        memset(iods, 0, sizeof(iods));
+        daos_const_iov_set((d_const_iov_t *)&iods[0].iod_name, H5_daos_nattr_corder_holes_key_g,
+                           H5_daos_nattr_corder_holes_key_size_g);
+        iods[0].iod_nr   = 1u;
+        iods[0].iod_size = (uint64_t)8;
+        iods[0].iod_type = DAOS_IOD_SINGLE;
+
+        daos_const_iov_set((d_const_iov_t *)&iods[1].iod_name, H5_daos_attr_corder_holes_key_g,
+                           H5_daos_attr_corder_holes_key_size_g);
+        iods[1].iod_nr    = holes_update.nrecs;
+        iods[1].iod_size  = (daos_size_t)H5_DAOS_ENCODED_CORDER_HOLE_SIZE;
+        iods[1].iod_recxs = holes_update.recxs;
+        iods[1].iod_type  = DAOS_IOD_ARRAY;
+
+        daos_iov_set(&sg_iovs[0], nholes_buf, (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+        sgls[0].sg_nr     = 1;
+        sgls[0].sg_nr_out = 0;
+        sgls[0].sg_iovs   = &sg_iovs[0];
+
+        daos_iov_set(&sg_iovs[1], holes_update.recs_buf,
+                     (daos_size_t)holes_update.nrecs * H5_DAOS_ENCODED_CORDER_HOLE_SIZE);
+        sgls[1].sg_nr     = 1;
+        sgls[1].sg_nr_out = 0;
+        sgls[1].sg_iovs   = &sg_iovs[1];
+
+        if (0 != (ret = daos_obj_update(target_obj->obj_oh, DAOS_TX_NONE, 0, &dkey, 2, iods, sgls,
+                                        NULL /*event*/)))
+            D_GOTO_ERROR(H5E_ATTR, H5E_WRITEERROR, FAIL,
+                         "failed to update attribute creation order index holes: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end else */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_attribute_remove_from_sparse_crt_idx() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_attribute_remove_from_crt_idx_name_cb
  *
@@ -5425,6 +5762,299 @@ H5_daos_attribute_remove_from_crt_idx_name_cb(hid_t H5VL_DAOS_UNUSED loc_id, con
     return 0;
 } /* end H5_daos_attribute_remove_from_crt_idx_name_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_attribute_compact_crt_idx
+ *
+ * Purpose:     After an attribute has been deleted from an object, this
+ *              routine is used to compact the object's sparse attribute
+ *              creation order index once too many of its slots are holes.
+ *              The akeys of all remaining attributes are read and then
+ *              re-written to the first slots of the index, the creation
+ *              order value of each moved attribute is recorded under its
+ *              new slot (and its new slot under its creation order value),
+ *              and the index's format record is updated so attributes
+ *              created later are placed after the moved attributes.
+ *              Finally the akeys left past the end of the index and the
+ *              index's holes are removed.
+ *
+ *              skip_slot is the slot of the deleted attribute, which has
+ *              not been added to the index's holes.
+ *
+ * Return:      Non-negative on success/negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_attribute_compact_crt_idx(H5_daos_obj_t *target_obj, const H5_daos_corder_info_t *corder_info,
+                                  uint64_t skip_slot)
+{
+    daos_sg_list_t *sgls        = NULL;
+    daos_iod_t     *iods        = NULL;
+    daos_iov_t     *sg_iovs     = NULL;
+    daos_key_t     *punch_akeys = NULL;
+    daos_key_t      dkey;
+    uint64_t       *slots = NULL;
+    uint64_t        corder;
+    uint8_t        *keys_buf = NULL;
+    uint8_t        *name_keys;
+    uint8_t        *corder_rec_keys;
+    uint8_t        *corder_vals;
+    uint8_t        *slot_rec_keys;
+    uint8_t        *slot_vals;
+    uint8_t         fmt_buf[H5_DAOS_ENCODED_CORDER_FMT_SIZE];
+    uint8_t         nholes_buf[H5_DAOS_ENCODED_UINT64_T_SIZE];
+    uint8_t        *p;
+    char           *data_buf = NULL;
+    char           *data_cur_pos;
+    size_t          data_buf_size = 0;
+    size_t          nattrs;
+    size_t          ncorder_recs = 0;
+    size_t          npunch       = 0;
+    size_t          i;
+    int             ret;
+    herr_t          ret_value = SUCCEED;
+
+    assert(target_obj);
+    assert(corder_info);
+    assert(corder_info->sparse);
+    assert(corder_info->nobjs > 0);
+    H5daos_compile_assert(H5_DAOS_ENCODED_CRT_ORDER_SIZE == 8);
+
+    nattrs = (size_t)corder_info->nobjs;
+
+    /*
+     * Allocate space for the 3 akeys written per attribute: the akey that maps
+     * the attribute's slot to the attribute's name and the records mapping
+     * the slot to the attribute's creation order value and back, plus the
+     * index's format record and number of holes.
+     */
+    if (NULL == (iods = DV_calloc((3 * nattrs + 2) * sizeof(*iods))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate IOD buffer");
+    if (NULL == (sgls = DV_malloc((3 * nattrs + 2) * sizeof(*sgls))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate SGL buffer");
+    if (NULL == (sg_iovs = DV_calloc((3 * nattrs + 2) * sizeof(*sg_iovs))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate IOV buffer");
+    if (NULL == (punch_akeys = DV_calloc((2 * nattrs + 1) * sizeof(*punch_akeys))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate akey buffer");
+    if (NULL == (slots = DV_malloc(nattrs * sizeof(*slots))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate slot buffer");
+    if (NULL == (keys_buf = DV_malloc(nattrs * (3 * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1) +
+                                                2 * H5_DAOS_ENCODED_CRT_ORDER_SIZE))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate akey data buffer");
+    name_keys       = keys_buf;
+    corder_rec_keys = name_keys + nattrs * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+    corder_vals     = corder_rec_keys + nattrs * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+    slot_rec_keys   = corder_vals + nattrs * H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+    slot_vals       = slot_rec_keys + nattrs * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+
+    /* Determine the slots of the remaining attributes.  Attributes moved by
+     * the last compaction have creation order records and occupy the slots
+     * below compact_mark - slot_base. */
+    if (H5_daos_corder_get_slots(corder_info, skip_slot, slots, nattrs) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL, "can't get slots of attribute creation order index");
+    while (ncorder_recs < nattrs && slots[ncorder_recs] < corder_info->compact_mark - corder_info->slot_base)
+        ncorder_recs++;
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&dkey, H5_daos_attr_key_g, H5_daos_attr_key_size_g);
+
+    /* Set up iods */
+    for (i = 0; i < nattrs; i++) {
+        /* Setup the integer 'name' value for the current 'creation order -> attribute name' akey */
+        p    = &name_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+        *p++ = 0;
+        UINT64ENCODE(p, slots[i]);
+
+        /* Set up iods for the current 'creation order -> attribute name' akey */
+        daos_iov_set(&iods[i].iod_name, &name_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                     H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        iods[i].iod_nr   = 1u;
+        iods[i].iod_size = DAOS_REC_ANY;
+        iods[i].iod_type = DAOS_IOD_SINGLE;
+    } /* end for */
+
+    /* Fetch the data size for each akey */
+    if (0 != (ret = daos_obj_fetch(target_obj->obj_oh, DAOS_TX_NONE, DAOS_COND_AKEY_FETCH, &dkey,
+                                   (unsigned)nattrs, iods, NULL, NULL /*maps*/, NULL /*event*/)))
+        D_GOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "can't read akey data sizes: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Allocate a single buffer for the akeys' data */
+    for (i = 0; i < nattrs; i++) {
+        if (iods[i].iod_size == 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_BADSIZE, FAIL, "invalid iod size - missing metadata");
+        data_buf_size += iods[i].iod_size;
+    } /* end for */
+    if (NULL == (data_buf = DV_malloc(data_buf_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for akey data");
+
+    /* Setup sgls for each akey */
+    data_cur_pos = data_buf;
+    for (i = 0; i < nattrs; i++) {
+        daos_iov_set(&sg_iovs[i], data_cur_pos, iods[i].iod_size);
+        sgls[i].sg_nr     = 1;
+        sgls[i].sg_nr_out = 0;
+        sgls[i].sg_iovs   = &sg_iovs[i];
+
+        data_cur_pos += iods[i].iod_size;
+    } /* end for */
+
+    /* Set up iods and sgls for the 'slot -> creation order' records of
+     * attributes moved by the last compaction */
+    for (i = 0; i < ncorder_recs; i++) {
+        p    = &corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+        *p++ = H5_DAOS_ATTR_CORDER_REC_TAG;
+        UINT64ENCODE(p, slots[i]);
+
+        daos_iov_set(&iods[nattrs + i].iod_name, &corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                     H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        iods[nattrs + i].iod_nr   = 1u;
+        iods[nattrs + i].iod_size = (uint64_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+        iods[nattrs + i].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&sg_iovs[nattrs + i], &corder_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE],
+                     (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+        sgls[nattrs + i].sg_nr     = 1;
+        sgls[nattrs + i].sg_nr_out = 0;
+        sgls[nattrs + i].sg_iovs   = &sg_iovs[nattrs + i];
+    } /* end for */
+
+    /* Read the akeys' data */
+    if (0 != (ret = daos_obj_fetch(target_obj->obj_oh, DAOS_TX_NONE, DAOS_COND_AKEY_FETCH, &dkey,
+                                   (unsigned)(nattrs + ncorder_recs), iods, sgls, NULL /*maps*/,
+                                   NULL /*event*/)))
+        D_GOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "can't read akey data: %s", H5_daos_err_to_string(ret));
+
+    /*
+     * Move each attribute to the slot at its position in the index and set up
+     * the records of its creation order value
+     */
+    for (i = 0; i < nattrs; i++) {
+        /* Determine the attribute's creation order value, from its record if
+         * it was moved by the last compaction, otherwise from its slot */
+        if (i < ncorder_recs) {
+            if (iods[nattrs + i].iod_size != (uint64_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE)
+                D_GOTO_ERROR(H5E_ATTR, H5E_BADSIZE, FAIL, "invalid iod size - missing metadata");
+            p = &corder_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+            UINT64DECODE(p, corder);
+        } /* end if */
+        else
+            corder = slots[i] + corder_info->slot_base;
+
+        /* Setup the integer 'name' value for the current 'creation order -> attribute name' akey */
+        p = &name_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1) + 1];
+        UINT64ENCODE(p, (uint64_t)i);
+
+        /* Set up the 'slot -> creation order' record */
+        p    = &corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+        *p++ = H5_DAOS_ATTR_CORDER_REC_TAG;
+        UINT64ENCODE(p, (uint64_t)i);
+        p = &corder_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+        UINT64ENCODE(p, corder);
+
+        daos_iov_set(&iods[nattrs + i].iod_name, &corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                     H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        iods[nattrs + i].iod_nr   = 1u;
+        iods[nattrs + i].iod_size = (uint64_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+        iods[nattrs + i].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&sg_iovs[nattrs + i], &corder_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE],
+                     (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+        sgls[nattrs + i].sg_nr     = 1;
+        sgls[nattrs + i].sg_nr_out = 0;
+        sgls[nattrs + i].sg_iovs   = &sg_iovs[nattrs + i];
+
+        /* Set up the 'creation order -> slot' record */
+        p    = &slot_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+        *p++ = H5_DAOS_ATTR_SLOT_REC_TAG;
+        UINT64ENCODE(p, corder);
+        p = &slot_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+        UINT64ENCODE(p, (uint64_t)i);
+
+        daos_iov_set(&iods[(2 * nattrs) + i].iod_name,
+                     &slot_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                     H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        iods[(2 * nattrs) + i].iod_nr   = 1u;
+        iods[(2 * nattrs) + i].iod_size = (uint64_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+        iods[(2 * nattrs) + i].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&sg_iovs[(2 * nattrs) + i], &slot_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE],
+                     (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+        sgls[(2 * nattrs) + i].sg_nr     = 1;
+        sgls[(2 * nattrs) + i].sg_nr_out = 0;
+        sgls[(2 * nattrs) + i].sg_iovs   = &sg_iovs[(2 * nattrs) + i];
+    } /* end for */
+
+    /* Set up the new format record */
+    H5_daos_corder_fmt_encode(fmt_buf, corder_info->max_corder - nattrs, corder_info->max_corder);
+    daos_const_iov_set((d_const_iov_t *)&iods[3 * nattrs].iod_name, H5_daos_attr_corder_fmt_key_g,
+                       H5_daos_attr_corder_fmt_key_size_g);
+    iods[3 * nattrs].iod_nr   = 1u;
+    iods[3 * nattrs].iod_size = (uint64_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE;
+    iods[3 * nattrs].iod_type = DAOS_IOD_SINGLE;
+
+    daos_iov_set(&sg_iovs[3 * nattrs], fmt_buf, (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE);
+    sgls[3 * nattrs].sg_nr     = 1;
+    sgls[3 * nattrs].sg_nr_out = 0;
+    sgls[3 * nattrs].sg_iovs   = &sg_iovs[3 * nattrs];
+
+    /* Set up the new number of holes */
+    p = nholes_buf;
+    UINT64ENCODE(p, (uint64_t)0);
+    daos_const_iov_set((d_const_iov_t *)&iods[(3 * nattrs) + 1].iod_name, H5_daos_nattr_corder_holes_key_g,
+                       H5_daos_nattr_corder_holes_key_size_g);
+    iods[(3 * nattrs) + 1].iod_nr   = 1u;
+    iods[(3 * nattrs) + 1].iod_size = (uint64_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+    iods[(3 * nattrs) + 1].iod_type = DAOS_IOD_SINGLE;
+
+    daos_iov_set(&sg_iovs[(3 * nattrs) + 1], nholes_buf, (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+    sgls[(3 * nattrs) + 1].sg_nr     = 1;
+    sgls[(3 * nattrs) + 1].sg_nr_out = 0;
+    sgls[(3 * nattrs) + 1].sg_iovs   = &sg_iovs[(3 * nattrs) + 1];
+
+    /* Write the akeys back */
+    if (0 != (ret = daos_obj_update(target_obj->obj_oh, DAOS_TX_NONE, 0 /*flags*/, &dkey,
+                                    (unsigned)(3 * nattrs + 2), iods, sgls, NULL /*event*/)))
+        D_GOTO_ERROR(H5E_ATTR, H5E_WRITEERROR, FAIL, "can't write akey data: %s", H5_daos_err_to_string(ret));
+
+    /* Delete the (now invalid) akeys past the end of the creation order index
+     * and the index's holes */
+    for (i = 0; i < nattrs; i++) {
+        if (slots[i] < (uint64_t)nattrs)
+            continue;
+
+        p = &name_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1) + 1];
+        UINT64ENCODE(p, slots[i]);
+        daos_iov_set(&punch_akeys[npunch++], &name_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                     H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+
+        if (i < ncorder_recs) {
+            p = &corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1) + 1];
+            UINT64ENCODE(p, slots[i]);
+            daos_iov_set(&punch_akeys[npunch++], &corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                         H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        } /* end if */
+    }     /* end for */
+    daos_const_iov_set((d_const_iov_t *)&punch_akeys[npunch++], H5_daos_attr_corder_holes_key_g,
+                       H5_daos_attr_corder_holes_key_size_g);
+
+    if (0 != (ret = daos_obj_punch_akeys(target_obj->obj_oh, DAOS_TX_NONE, 0, &dkey, (unsigned)npunch,
+                                         punch_akeys, NULL /*event*/)))
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTDELETE, FAIL,
+                     "can't trim akeys from attribute creation order index: %s", H5_daos_err_to_string(ret));
+
+done:
+    data_buf    = DV_free(data_buf);
+    keys_buf    = DV_free(keys_buf);
+    slots       = DV_free(slots);
+    punch_akeys = DV_free(punch_akeys);
+    sg_iovs     = DV_free(sg_iovs);
+    sgls        = DV_free(sgls);
+    iods        = DV_free(iods);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_attribute_compact_crt_idx() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_attribute_shift_crt_idx_keys_down
  *
@@ -5632,7 +6262,7 @@ H5_daos_attribute_exists(H5_daos_obj_t *attr_container_obj, const char *attr_nam
         attr_exists_ud->bcast_ud.buffer     = (void *)&attr_exists_ud->bcast_exists;
         attr_exists_ud->bcast_ud.buffer_len = (int)sizeof(htri_t);
         attr_exists_ud->bcast_ud.count      = (int)sizeof(htri_t);
-        attr_exists_ud->bcast_ud.comm       = req->file->comm;
+        attr_exists_ud->bcast_ud.lane       = NULL;
         must_bcast                          = TRUE;
     } /* end if */
 
@@ -5710,8 +6340,8 @@ H5_daos_attribute_exists(H5_daos_obj_t *attr_container_obj, const char *attr_nam
 
     /* Broadcast attribute existence status if there are other processes that need it */
     if (collective && (attr_container_obj->item.file->num_procs > 1))
-        if (H5_daos_mpi_ibcast(&attr_exists_ud->bcast_ud, attr_container_obj, sizeof(htri_t), FALSE, NULL,
-                               H5_daos_attr_exists_bcast_comp_cb, req, first_task, dep_task) < 0)
+        if (H5_daos_mpi_ibcast(&attr_exists_ud->bcast_ud, attr_container_obj, sizeof(htri_t), FALSE, FALSE,
+                               NULL, H5_daos_attr_exists_bcast_comp_cb, req, first_task, dep_task) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't broadcast attribute existence status");
     attr_exists_ud = NULL;
 
@@ -5733,8 +6363,9 @@ done:
         if (must_bcast) {
             assert(attr_exists_ud->bcast_ud.buffer);
             *((htri_t *)attr_exists_ud->bcast_ud.buffer) = FAIL;
-            if (H5_daos_mpi_ibcast(&attr_exists_ud->bcast_ud, attr_container_obj, sizeof(htri_t), FALSE, NULL,
-                                   H5_daos_attr_exists_bcast_comp_cb, req, first_task, dep_task) < 0)
+            if (H5_daos_mpi_ibcast(&attr_exists_ud->bcast_ud, attr_container_obj, sizeof(htri_t), FALSE,
+                                   FALSE, NULL, H5_daos_attr_exists_bcast_comp_cb, req, first_task,
+                                   dep_task) < 0)
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTSET, FAIL,
                              "can't broadcast attribute existence check failure");
         } /* end if */
@@ -6453,16 +7084,19 @@ H5_daos_attribute_iterate_by_crt_order(H5_daos_attr_iterate_ud_t *iterate_udata,
         D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL,
                      "creation order is not tracked for attribute's parent object");
 
-    /* Retrieve the number of attributes attached to the target object */
-    if (H5_daos_object_get_num_attrs(iterate_udata->attr_container_obj,
-                                     &iterate_udata->u.crt_order_data.obj_nattrs, FALSE, req, first_task,
-                                     dep_task) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get number of attributes attached to object");
+    /* Retrieve the number of attributes attached to the target object and the
+     * holes in its attribute creation order index once for the whole
+     * iteration, so looking up each attribute's name doesn't need to
+     * retrieve them again */
+    if (H5_daos_object_get_corder_info(iterate_udata->attr_container_obj, TRUE, TRUE,
+                                       &iterate_udata->u.crt_order_data.corder_info, req, first_task,
+                                       dep_task) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute creation order index info");
 
     H5_DAOS_WAIT_ON_ASYNC_CHAIN(req, *first_task, *dep_task, H5E_ATTR, H5E_CANTINIT, FAIL);
 
     /* Check if there are no attributes to process */
-    if (iterate_udata->u.crt_order_data.obj_nattrs == 0)
+    if (iterate_udata->u.crt_order_data.corder_info.nobjs == 0)
         D_GOTO_DONE(SUCCEED);
 
     /* Register ID for target obj */
@@ -6471,11 +7105,12 @@ H5_daos_attribute_iterate_by_crt_order(H5_daos_attr_iterate_ud_t *iterate_udata,
         D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
     iterate_udata->attr_container_obj->item.rc++;
 
-    for (cur_idx = 0; cur_idx < (uint64_t)iterate_udata->u.crt_order_data.obj_nattrs; cur_idx++) {
+    for (cur_idx = 0; cur_idx < iterate_udata->u.crt_order_data.corder_info.nobjs; cur_idx++) {
         if (H5_daos_attribute_get_name_by_idx_alloc(
                 iterate_udata->attr_container_obj, iterate_udata->iter_data.index_type,
-                iterate_udata->iter_data.iter_order, cur_idx, &target_attr_name, &target_attr_name_len,
-                &attr_name_buf, NULL, req, first_task, dep_task) < 0)
+                iterate_udata->iter_data.iter_order, cur_idx, &iterate_udata->u.crt_order_data.corder_info,
+                &target_attr_name, &target_attr_name_len, &attr_name_buf, NULL, req, first_task,
+                dep_task) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute name");
 
         H5_DAOS_WAIT_ON_ASYNC_CHAIN(req, *first_task, *dep_task, H5E_ATTR, H5E_CANTINIT, FAIL);
@@ -6805,9 +7440,12 @@ H5_daos_attribute_iterate_finish(tse_task_t *task)
         D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
     /* Free private data */
-    if (udata->iter_data.index_type == H5_INDEX_NAME)
+    if (udata->iter_data.index_type == H5_INDEX_NAME) {
         if (udata->u.name_order_data.md_rw_cb_ud.free_sg_iov[0])
             DV_free(udata->u.name_order_data.md_rw_cb_ud.sg_iov[0].iov_buf);
+    } /* end if */
+    else
+        DV_free(udata->u.crt_order_data.corder_info.holes);
 
     DV_free(udata);
 
@@ -7040,8 +7678,9 @@ H5_daos_attr_gnbi_alloc_task(tse_task_t *task)
 
         /* Reissue call with larger buffer and transfer ownership of udata */
         if (H5_daos_attribute_get_name_by_idx(udata->target_obj, udata->index_type, udata->iter_order,
-                                              udata->idx, *udata->attr_name_buf, udata->cur_attr_name_size,
-                                              udata->attr_name_size, udata->req, &first_task, &dep_task) < 0)
+                                              udata->idx, udata->corder_info, *udata->attr_name_buf,
+                                              udata->cur_attr_name_size, udata->attr_name_size, udata->req,
+                                              &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get attribute name by index");
         udata = NULL;
     } /* end if */
@@ -7109,7 +7748,8 @@ done:
  */
 static herr_t
 H5_daos_attribute_get_name_by_idx_alloc(H5_daos_obj_t *target_obj, H5_index_t index_type,
-                                        H5_iter_order_t iter_order, uint64_t idx, const char **attr_name,
+                                        H5_iter_order_t iter_order, uint64_t idx,
+                                        const H5_daos_corder_info_t *corder_info, const char **attr_name,
                                         size_t *attr_name_size, char **attr_name_buf,
                                         size_t *attr_name_buf_size, H5_daos_req_t *req,
                                         tse_task_t **first_task, tse_task_t **dep_task)
@@ -7127,6 +7767,7 @@ H5_daos_attribute_get_name_by_idx_alloc(H5_daos_obj_t *target_obj, H5_index_t in
     gnbi_udata->index_type         = index_type;
     gnbi_udata->iter_order         = iter_order;
     gnbi_udata->idx                = idx;
+    gnbi_udata->corder_info        = corder_info;
     gnbi_udata->attr_name          = attr_name;
     gnbi_udata->attr_name_size     = attr_name_size;
     gnbi_udata->attr_name_buf      = attr_name_buf;
@@ -7146,9 +7787,9 @@ H5_daos_attribute_get_name_by_idx_alloc(H5_daos_obj_t *target_obj, H5_index_t in
     } /* end else */
 
     /* Call underlying function */
-    if (H5_daos_attribute_get_name_by_idx(target_obj, index_type, iter_order, idx, *gnbi_udata->attr_name_buf,
-                                          gnbi_udata->cur_attr_name_size, gnbi_udata->attr_name_size, req,
-                                          first_task, dep_task) < 0)
+    if (H5_daos_attribute_get_name_by_idx(target_obj, index_type, iter_order, idx, corder_info,
+                                          *gnbi_udata->attr_name_buf, gnbi_udata->cur_attr_name_size,
+                                          gnbi_udata->attr_name_size, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get link name by index");
 
     /* Create task to finish this operation */
@@ -7195,13 +7836,20 @@ done:
  *              size_ret. If non-NULL, the attribute's name is stored in
  *              attr_name_out.
  *
+ *              For the creation order index, corder_info may point to
+ *              index info the caller has already retrieved (and keeps
+ *              valid until this operation completes), so repeated lookups
+ *              during an iteration don't each fetch it again. If NULL,
+ *              the index info is retrieved here.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
 H5_daos_attribute_get_name_by_idx(H5_daos_obj_t *target_obj, H5_index_t index_type,
-                                  H5_iter_order_t iter_order, uint64_t idx, char *attr_name_out,
+                                  H5_iter_order_t iter_order, uint64_t idx,
+                                  const H5_daos_corder_info_t *corder_info, char *attr_name_out,
                                   size_t attr_name_out_size, size_t *attr_name_size, H5_daos_req_t *req,
                                   tse_task_t **first_task, tse_task_t **dep_task)
 {
@@ -7232,7 +7880,8 @@ H5_daos_attribute_get_name_by_idx(H5_daos_obj_t *target_obj, H5_index_t index_ty
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't retrieve attribute name from name order index");
     } /* end if */
     else if (H5_INDEX_CRT_ORDER == index_type) {
-        if (H5_daos_attribute_get_name_by_crt_order(get_name_udata, req, first_task, dep_task) < 0)
+        if (H5_daos_attribute_get_name_by_crt_order(get_name_udata, corder_info, req, first_task,
+                                                    dep_task) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL,
                          "can't retrieve attribute name from creation order index");
     } /* end else */
@@ -7259,6 +7908,11 @@ done:
  * Purpose:     Creates asynchronous tasks for retrieving an attribute's
  *              name by an index value according to alphabetical order.
  *
+ *              The object's attribute names are cached on the target
+ *              object the first time this is called, so later calls don't
+ *              need to iterate over the object's attributes until an
+ *              attribute is created or deleted in the file.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
@@ -7267,10 +7921,8 @@ static herr_t
 H5_daos_attribute_get_name_by_name_order(H5_daos_attr_get_name_by_idx_ud_t *get_name_udata,
                                          H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
-    H5_daos_iter_data_t iter_data;
-    tse_task_t         *no_attrs_check_task = NULL;
-    int                 ret;
-    herr_t              ret_value = 0;
+    int    ret;
+    herr_t ret_value = 0;
 
     assert(get_name_udata);
     assert(req);
@@ -7280,41 +7932,24 @@ H5_daos_attribute_get_name_by_name_order(H5_daos_attr_get_name_by_idx_ud_t *get_
     if (H5_ITER_DEC == get_name_udata->iter_order)
         D_GOTO_ERROR(H5E_ATTR, H5E_UNSUPPORTED, FAIL, "decreasing order iteration is unsupported");
 
-    /* Retrieve the current number of attributes attached to the target object */
-    if (H5_daos_object_get_num_attrs(get_name_udata->target_obj, &get_name_udata->obj_nattrs, FALSE, req,
-                                     first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get number of attributes attached to object");
+    /* Create task to retrieve the attribute name */
+    if (H5_daos_create_task(H5_daos_attribute_gnbno_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, get_name_udata, &get_name_udata->u.by_name_data.gnbno_task) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't create task for attribute get name by name order");
 
-    /* Create task to check that requested index value is within range
-     * of the number of attributes attached to the object.
-     */
-    if (H5_daos_create_task(H5_daos_attribute_gnbno_no_attrs_check_task, *dep_task ? 1 : 0,
-                            *dep_task ? dep_task : NULL, NULL, NULL, get_name_udata,
-                            &no_attrs_check_task) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't create task to check for no attributes on object");
-
-    /* Schedule attribute count check task (or save it to be scheduled later) and
-     * give it a reference to req */
+    /* Schedule gnbno task (or save it to be scheduled later) and give it a
+     * reference to req */
     if (*first_task) {
-        if (0 != (ret = tse_task_schedule(no_attrs_check_task, false)))
+        if (0 != (ret = tse_task_schedule(get_name_udata->u.by_name_data.gnbno_task, false)))
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL,
-                         "can't schedule task to check for no attributes on object: %s",
+                         "can't schedule task for attribute get name by name order: %s",
                          H5_daos_err_to_string(ret));
     } /* end if */
     else
-        *first_task = no_attrs_check_task;
-    *dep_task = no_attrs_check_task;
+        *first_task = get_name_udata->u.by_name_data.gnbno_task;
+    *dep_task = get_name_udata->u.by_name_data.gnbno_task;
     req->rc++;
 
-    /* Initialize iteration data */
-    get_name_udata->u.by_name_data.cur_attr_idx = 0;
-    H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_ATTR, H5_INDEX_NAME, get_name_udata->iter_order,
-                           FALSE, NULL, H5I_INVALID_HID, get_name_udata, NULL, req);
-    iter_data.u.attr_iter_data.u.attr_iter_op = H5_daos_attribute_get_name_by_name_order_cb;
-
-    if (H5_daos_attribute_iterate(get_name_udata->target_obj, &iter_data, req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "attribute iteration failed");
-
 done:
     D_FUNC_LEAVE;
 } /* end H5_daos_attribute_get_name_by_name_order() */
@@ -7324,11 +7959,10 @@ done:
  *
  * Purpose:     Attribute iteration callback for
  *              H5_daos_attribute_get_name_by_name_order which iterates
- *              through attributes by name order until the specified index
- *              value is reached, at which point the target attribute has
- *              been found and its name is copied back.
+ *              through all attributes by name order, adding each
+ *              attribute's name to the name list being built.
  *
- * Return:      Non-negative (can't fail)
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
@@ -7336,87 +7970,175 @@ static herr_t
 H5_daos_attribute_get_name_by_name_order_cb(hid_t H5VL_DAOS_UNUSED loc_id, const char *attr_name,
                                             const H5A_info_t H5VL_DAOS_UNUSED *attr_info, void *op_data)
 {
-    H5_daos_attr_get_name_by_idx_ud_t *udata     = (H5_daos_attr_get_name_by_idx_ud_t *)op_data;
-    herr_t                             ret_value = H5_ITER_CONT;
-
-    /* Check the index is within range */
-    if (udata->u.by_name_data.cur_attr_idx >= (uint64_t)udata->obj_nattrs)
-        D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, H5_ITER_ERROR, "index value out of range");
+    H5_daos_name_cache_t *names     = (H5_daos_name_cache_t *)op_data;
+    herr_t                ret_value = H5_ITER_CONT;
 
-    /*
-     * Once the target index has been reached, set the size of the attribute
-     * name to be returned and copy the attribute name if the attribute name
-     * output buffer is not NULL.
-     */
-    if (udata->u.by_name_data.cur_attr_idx == udata->idx) {
-        size_t attr_name_len = strlen(attr_name);
-
-        if (udata->attr_name_out && udata->attr_name_out_size > 0) {
-            size_t copy_len = MIN(attr_name_len, udata->attr_name_out_size - 1);
-
-            memcpy(udata->attr_name_out, attr_name, copy_len);
-            udata->attr_name_out[copy_len] = '\0';
-        }
-
-        *udata->attr_name_size_ret = attr_name_len;
-
-        D_GOTO_DONE(H5_ITER_STOP);
-    }
-
-    udata->u.by_name_data.cur_attr_idx++;
+    if (H5_daos_name_cache_append(names, attr_name) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, H5_ITER_ERROR, "can't add attribute name to name list");
 
 done:
     D_FUNC_LEAVE;
 } /* end H5_daos_attribute_get_name_by_name_order_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_attribute_gnbno_no_attrs_check_task
+ * Function:    H5_daos_attribute_gnbno_task
  *
- * Purpose:     Asynchronous task to check that an object has attributes
- *              attached to it before attempting to retrieve the name of an
- *              attribute on that object according to an index value.
+ * Purpose:     Asynchronous task for
+ *              H5_daos_attribute_get_name_by_name_order().  If the target
+ *              object's cached list of attribute names is still valid the
+ *              name is retrieved from it directly, otherwise the object's
+ *              attributes are iterated over to rebuild the list.
  *
  * Return:      Success:        0
- *              Failure:        Error code
+ *              Failure:        Negative
  *
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_attribute_gnbno_no_attrs_check_task(tse_task_t *task)
+H5_daos_attribute_gnbno_task(tse_task_t *task)
 {
-    H5_daos_attr_get_name_by_idx_ud_t *udata     = NULL;
+    H5_daos_attr_get_name_by_idx_ud_t *udata = NULL;
+    H5_daos_iter_data_t                iter_data;
+    tse_task_t                        *first_task = NULL;
+    tse_task_t                        *dep_task   = NULL;
+    htri_t                             cache_ret;
+    int                                ret;
     int                                ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for attribute count check task");
+                     "can't get private data for attribute get name by name order task");
 
     /* Handle errors in previous tasks */
     H5_DAOS_PREP_REQ(udata->req, H5E_ATTR);
 
-    /* Ensure the index is within range */
-    if (udata->idx >= (uint64_t)udata->obj_nattrs)
+    /* Try to retrieve the name from the object's name cache */
+    if ((cache_ret = H5_daos_name_cache_lookup(
+             &udata->target_obj->attr_name_cache, udata->target_obj->item.file->attr_mod_gen, udata->idx,
+             udata->attr_name_out, udata->attr_name_out_size, udata->attr_name_size_ret)) < 0)
         D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
+    if (cache_ret)
+        D_GOTO_DONE(0);
+
+    /* Rebuild the name cache.  Save the current modification generation
+     * first, so the rebuilt cache is invalid if an attribute is created or
+     * deleted while iterating. */
+    udata->u.by_name_data.build_gen   = udata->target_obj->item.file->attr_mod_gen;
+    udata->u.by_name_data.names_built = TRUE;
+    H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_ATTR, H5_INDEX_NAME, udata->iter_order, FALSE, NULL,
+                           H5I_INVALID_HID, &udata->u.by_name_data.names, NULL, udata->req);
+    iter_data.u.attr_iter_data.u.attr_iter_op = H5_daos_attribute_get_name_by_name_order_cb;
+
+    /* Perform iteration */
+    if (H5_daos_attribute_iterate(udata->target_obj, &iter_data, udata->req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_BADITER, -H5_DAOS_H5_GET_ERROR, "attribute iteration failed");
 
 done:
     if (udata) {
+        tse_task_t *end_task = NULL;
+
+        /* Create task to finalize gnbno task */
+        if (H5_daos_create_task(H5_daos_attribute_gnbno_end_task, dep_task ? 1 : 0,
+                                dep_task ? &dep_task : NULL, NULL, NULL, udata, &end_task) < 0)
+            D_DONE_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task for attribute get name by name order end");
+        else {
+            /* Schedule gnbno end task (or save it to be scheduled later) */
+            if (first_task) {
+                if (0 != (ret = tse_task_schedule(end_task, false)))
+                    D_DONE_ERROR(H5E_ATTR, H5E_CANTINIT, ret,
+                                 "can't schedule task for attribute get name by name order end: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end if */
+            else
+                first_task = end_task;
+            dep_task = end_task;
+        } /* end else */
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_ATTR, H5E_CANTINIT, ret,
+                         "can't schedule initial task for attribute get name by name order: %s",
+                         H5_daos_err_to_string(ret));
+
         /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except
-         * for H5_daos_req_free_int, which updates req->status if it sees an
-         * error */
-        if (ret_value < 0) {
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
             udata->req->status      = ret_value;
-            udata->req->failed_task = "attribute count check";
-        }
-
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-    }
-    else
+            udata->req->failed_task = "attribute get name by name order task";
+        } /* end if */
+    }     /* end if */
+    else {
         assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    } /* end else */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_attribute_gnbno_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_attribute_gnbno_end_task
+ *
+ * Purpose:     Finalizes the attribute get name by name order operation.
+ *              If the name list was rebuilt it is installed in the target
+ *              object's name cache and the name is retrieved from it.
+ *
+ * Return:      Success:        0
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_attribute_gnbno_end_task(tse_task_t *task)
+{
+    H5_daos_attr_get_name_by_idx_ud_t *udata     = NULL;
+    int                                ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for attribute get name by name order task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_DONE(udata->req);
+
+    /* Install the rebuilt name list and retrieve the name */
+    if (ret_value >= 0 && udata->u.by_name_data.names_built) {
+        H5_daos_name_cache_install(&udata->target_obj->attr_name_cache, &udata->u.by_name_data.names,
+                                   udata->u.by_name_data.build_gen);
+        if (H5_daos_name_cache_lookup(&udata->target_obj->attr_name_cache, udata->u.by_name_data.build_gen,
+                                      udata->idx, udata->attr_name_out, udata->attr_name_out_size,
+                                      udata->attr_name_size_ret) < 0)
+            D_DONE_ERROR(H5E_ATTR, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
+    } /* end if */
+    H5_daos_name_cache_free(&udata->u.by_name_data.names);
 
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, udata->u.by_name_data.gnbno_task) < 0)
+        D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete main task */
+    tse_task_complete(udata->u.by_name_data.gnbno_task, ret_value);
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "attribute get name by name order end task";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+done:
     /* Return task to task list */
     if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
         D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
@@ -7425,7 +8147,7 @@ done:
     tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_attribute_gnbno_no_attrs_check_task() */
+} /* end H5_daos_attribute_gnbno_end_task() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_attribute_get_name_by_crt_order
@@ -7438,7 +8160,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_attribute_get_name_by_crt_order(H5_daos_attr_get_name_by_idx_ud_t *get_name_udata, H5_daos_req_t *req,
+H5_daos_attribute_get_name_by_crt_order(H5_daos_attr_get_name_by_idx_ud_t *get_name_udata,
+                                        const H5_daos_corder_info_t *corder_info, H5_daos_req_t *req,
                                         tse_task_t **first_task, tse_task_t **dep_task)
 {
     tse_task_t *fetch_task;
@@ -7456,10 +8179,19 @@ H5_daos_attribute_get_name_by_crt_order(H5_daos_attr_get_name_by_idx_ud_t *get_n
         D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, FAIL,
                      "creation order is not tracked for attribute's parent object");
 
-    /* Retrieve the current number of attributes attached to the target object */
-    if (H5_daos_object_get_num_attrs(get_name_udata->target_obj, &get_name_udata->obj_nattrs, FALSE, req,
-                                     first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get number of attributes attached to object");
+    /* Retrieve the current number of attributes attached to the target object
+     * and the holes in its attribute creation order index, unless the caller
+     * already has them */
+    if (corder_info)
+        get_name_udata->u.by_crt_order_data.corder_info = corder_info;
+    else {
+        if (H5_daos_object_get_corder_info(get_name_udata->target_obj, TRUE, TRUE,
+                                           &get_name_udata->u.by_crt_order_data.own_corder_info, req,
+                                           first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute creation order index info");
+        get_name_udata->u.by_crt_order_data.corder_info =
+            &get_name_udata->u.by_crt_order_data.own_corder_info;
+    } /* end else */
 
     get_name_udata->u.by_crt_order_data.md_rw_cb_ud.obj = get_name_udata->target_obj;
     get_name_udata->u.by_crt_order_data.md_rw_cb_ud.req = req;
@@ -7557,15 +8289,18 @@ H5_daos_attribute_get_name_by_crt_order_prep_cb(tse_task_t *task, void H5VL_DAOS
     assert(udata->u.by_crt_order_data.md_rw_cb_ud.req->file);
 
     /* Ensure the index is within range */
-    if (udata->idx >= (uint64_t)udata->obj_nattrs)
+    if (udata->idx >= udata->u.by_crt_order_data.corder_info->nobjs)
         D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
 
     /* Calculate the correct index of the attribute, based upon the iteration order */
     if (H5_ITER_DEC == udata->iter_order)
-        fetch_idx = (uint64_t)udata->obj_nattrs - udata->idx - 1;
+        fetch_idx = udata->u.by_crt_order_data.corder_info->nobjs - udata->idx - 1;
     else
         fetch_idx = udata->idx;
 
+    /* Skip over any holes in the index to find the slot holding the attribute */
+    fetch_idx = H5_daos_corder_idx_to_slot(udata->u.by_crt_order_data.corder_info, fetch_idx);
+
     p    = udata->u.by_crt_order_data.idx_buf;
     *p++ = 0;
     UINT64ENCODE(p, fetch_idx);
@@ -7737,6 +8472,10 @@ done:
             D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
         /* Free private data */
+        if (H5_INDEX_CRT_ORDER == udata->index_type)
+            DV_free(udata->u.by_crt_order_data.own_corder_info.holes);
+        else
+            H5_daos_name_cache_free(&udata->u.by_name_data.names);
         DV_free(udata);
     }
     else
@@ -81,6 +81,10 @@ typedef struct H5_daos_chunk_io_ud_t {
     daos_iov_t      sg_iov;
     daos_iov_t     *sg_iovs;
 
+    /* Priority class whose I/O budget this task holds a slot in, or
+     * H5_DAOS_IO_CLASS_META if none */
+    H5_daos_io_class_t io_class;
+
     /* Fields used for datatype conversion */
     struct {
         hssize_t              num_elem;
@@ -126,6 +130,13 @@ typedef struct H5_daos_dset_set_extent_ud_t {
     hid_t                 new_space_id;
 } H5_daos_dset_set_extent_ud_t;
 
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Free list for per-chunk user data */
+H5_DAOS_FL_DEFINE_STATIC(H5_daos_chunk_io_ud_t);
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -362,7 +373,8 @@ H5_daos_bcast_fill_val(H5_daos_dset_t *dset, H5_daos_req_t *req, size_t fill_val
     bcast_udata->buffer         = dset->fill_val;
     bcast_udata->buffer_len     = (int)fill_val_size;
     bcast_udata->count          = (int)fill_val_size;
-    bcast_udata->comm           = req->file->comm;
+    bcast_udata->lane           = NULL;
+    bcast_udata->prefetch       = FALSE;
 
     /* Create task for fill value bcast */
     if (H5_daos_create_task(H5_daos_mpi_ibcast_task, 1, dep_task, NULL, H5_daos_fill_val_bcast_comp_cb,
@@ -523,11 +535,9 @@ done:
             op_type = H5_DAOS_OP_TYPE_WRITE_ORDERED;
 
         /* Add the request to the object's request queue.  This will add the
-         * dependency on the group open if necessary.  If this is an anonymous
-         * create add to the file pool. */
-        if (H5_daos_req_enqueue(int_req, first_task, item, op_type,
-                                target_obj ? H5_DAOS_OP_SCOPE_OBJ : H5_DAOS_OP_SCOPE_FILE, collective,
-                                !req) < 0)
+         * dependency on the group open if necessary. */
+        if (H5_daos_req_enqueue_create(int_req, first_task, item, ret_value ? &dset->obj.item : NULL,
+                                       !target_obj, op_type, collective, !req) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't add request to request queue");
 
         /* Check for external async */
@@ -1838,7 +1848,7 @@ done:
     /* Cleanup on failure */
     if (NULL == ret_value) {
         /* Broadcast dataset info if needed */
-        if (must_bcast && H5_daos_mpi_ibcast(NULL, &dset->obj, H5_DAOS_DINFO_BCAST_BUF_SIZE, TRUE, NULL,
+        if (must_bcast && H5_daos_mpi_ibcast(NULL, &dset->obj, H5_DAOS_DINFO_BCAST_BUF_SIZE, TRUE, TRUE, NULL,
                                              item->file->my_rank == 0 ? H5_daos_dset_open_bcast_comp_cb
                                                                       : H5_daos_dset_open_recv_comp_cb,
                                              int_req, &first_task, &dep_task) < 0)
@@ -1979,7 +1989,7 @@ H5_daos_dataset_open_helper(H5_daos_file_t *file, hid_t dapl_id, hbool_t collect
         bcast_udata->bcast_udata.buffer     = bcast_udata->flex_buf;
         bcast_udata->bcast_udata.buffer_len = H5_DAOS_DINFO_BCAST_BUF_SIZE;
         bcast_udata->bcast_udata.count      = H5_DAOS_DINFO_BCAST_BUF_SIZE;
-        bcast_udata->bcast_udata.comm       = req->file->comm;
+        bcast_udata->bcast_udata.lane       = NULL;
 
         dinfo_buf_size = H5_DAOS_DINFO_BCAST_BUF_SIZE;
     } /* end if */
@@ -2127,9 +2137,9 @@ done:
     /* Broadcast dataset info */
     if (bcast_udata) {
         if (H5_daos_mpi_ibcast(
-                &bcast_udata->bcast_udata, &dset->obj, dinfo_buf_size, NULL == ret_value ? TRUE : FALSE, NULL,
-                file->my_rank == 0 ? H5_daos_dset_open_bcast_comp_cb : H5_daos_dset_open_recv_comp_cb, req,
-                first_task, dep_task) < 0) {
+                &bcast_udata->bcast_udata, &dset->obj, dinfo_buf_size, NULL == ret_value ? TRUE : FALSE, TRUE,
+                NULL, file->my_rank == 0 ? H5_daos_dset_open_bcast_comp_cb : H5_daos_dset_open_recv_comp_cb,
+                req, first_task, dep_task) < 0) {
             DV_free(bcast_udata);
             D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "failed to broadcast dataset info buffer");
         } /* end if */
@@ -2366,6 +2376,10 @@ done:
         D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
     if (udata) {
+        /* Let the next task of this class proceed */
+        if (udata->io_class != H5_DAOS_IO_CLASS_META)
+            H5_daos_io_budget_release(udata->io_class);
+
         /* Close dataset */
         if (H5_daos_dataset_close_real(udata->dset) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
@@ -2387,7 +2401,7 @@ done:
             DV_free(udata->recxs);
         if (udata->sg_iovs != &udata->sg_iov)
             DV_free(udata->sg_iovs);
-        DV_free(udata);
+        H5_DAOS_FL_FREE(H5_daos_chunk_io_ud_t, udata);
     } /* end if */
 
     D_FUNC_LEAVE;
@@ -2418,9 +2432,12 @@ H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_
 {
     H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
     daos_opc_t             daos_op;
+    H5_daos_io_class_t     io_class    = H5_DAOS_IO_CLASS_META;
+    hbool_t                budget_held = FALSE;
     size_t                 tot_nseq;
     size_t                 file_type_size;
     tse_task_t            *io_task;
+    tse_task_t            *io_gate = NULL;
     uint64_t               i;
     uint8_t               *p;
     int                    ret;
@@ -2433,7 +2450,7 @@ H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_
     assert(dep_task);
 
     /* Allocate argument struct */
-    if (NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
+    if (NULL == (chunk_io_ud = H5_DAOS_FL_CALLOC(H5_daos_chunk_io_ud_t)))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
     chunk_io_ud->recxs   = &chunk_io_ud->recx;
     chunk_io_ud->sg_iovs = &chunk_io_ud->sg_iov;
@@ -2550,6 +2567,14 @@ H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
                      (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
 
+    /* Hold back IO task if too many raw data I/O tasks of its priority class
+     * are already in flight */
+    io_class = H5_DAOS_IO_CLASS((size_t)chunk_info->num_elem_sel_file * file_type_size);
+    if (H5_daos_io_budget_acquire(io_class, io_task, &io_gate) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't acquire I/O budget for dataset I/O task");
+    chunk_io_ud->io_class = io_class;
+    budget_held           = TRUE;
+
     /* Schedule IO task (or save it to be scheduled later) */
     if (*first_task) {
         assert(*dep_task);
@@ -2560,18 +2585,26 @@ H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_
         *first_task = io_task;
     *dep_task = io_task;
 
+    /* The IO task's completion callback now releases its budget slot */
+    budget_held = FALSE;
+
     /* Task will be scheduled, give it a reference to req */
     chunk_io_ud->req->rc++;
     chunk_io_ud->dset->obj.item.rc++;
 
 done:
+    /* Give back the budget slot (or drop the gate) if the IO task will never
+     * run */
+    if (budget_held)
+        H5_daos_io_budget_cancel(io_class, io_gate);
+
     /* Cleanup on failure */
     if (ret_value < 0 && chunk_io_ud) {
         if (chunk_io_ud->recxs != &chunk_io_ud->recx)
             DV_free(chunk_io_ud->recxs);
         if (chunk_io_ud->sg_iovs != &chunk_io_ud->sg_iov)
             DV_free(chunk_io_ud->sg_iovs);
-        chunk_io_ud = DV_free(chunk_io_ud);
+        chunk_io_ud = H5_DAOS_FL_FREE(H5_daos_chunk_io_ud_t, chunk_io_ud);
     } /* end if */
 
     D_FUNC_LEAVE;
@@ -2708,6 +2741,10 @@ done:
         D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
     if (udata) {
+        /* Let the next task of this class proceed */
+        if (udata->io_class != H5_DAOS_IO_CLASS_META)
+            H5_daos_io_budget_release(udata->io_class);
+
         /* Close dataset */
         if (H5_daos_dataset_close_real(udata->dset) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
@@ -2738,7 +2775,7 @@ done:
             DV_free(udata->tconv.tconv_buf);
         if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
             DV_free(udata->tconv.bkg_buf);
-        DV_free(udata);
+        H5_DAOS_FL_FREE(H5_daos_chunk_io_ud_t, udata);
     } /* end if */
 
     D_FUNC_LEAVE;
@@ -2871,10 +2908,13 @@ H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_dao
 {
     H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
     daos_opc_t             daos_op;
-    hbool_t                contig = FALSE;
+    H5_daos_io_class_t     io_class    = H5_DAOS_IO_CLASS_META;
+    hbool_t                contig      = FALSE;
+    hbool_t                budget_held = FALSE;
     size_t                 tot_nseq;
     tse_task_t            *io_task       = NULL;
     tse_task_t            *fill_bkg_task = NULL;
+    tse_task_t            *io_gate       = NULL;
     uint64_t               i;
     uint8_t               *p;
     int                    ret;
@@ -2887,7 +2927,7 @@ H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_dao
     assert(dep_task);
 
     /* Allocate argument struct */
-    if (NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
+    if (NULL == (chunk_io_ud = H5_DAOS_FL_CALLOC(H5_daos_chunk_io_ud_t)))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
 
     /* Setup type conversion-related fields */
@@ -3037,6 +3077,17 @@ H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_dao
                 D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
                              "can't create task to read data to background buffer");
 
+            /* Hold back the background buffer fill task (and therefore the
+             * write task) if too many raw data I/O tasks of its priority
+             * class are already in flight */
+            io_class = H5_DAOS_IO_CLASS((size_t)chunk_info->num_elem_sel_file *
+                                        chunk_io_ud->tconv.file_type_size);
+            if (H5_daos_io_budget_acquire(io_class, fill_bkg_task, &io_gate) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't acquire I/O budget for background buffer fill task");
+            chunk_io_ud->io_class = io_class;
+            budget_held           = TRUE;
+
             /* Save bkg fill task to be scheduled later */
             if (*first_task) {
                 if (0 != (ret = tse_task_schedule(fill_bkg_task, false)))
@@ -3058,6 +3109,18 @@ H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_dao
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
                      (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
 
+    /* Hold back IO task if too many raw data I/O tasks of its priority class
+     * are already in flight, unless this was already done for the
+     * background buffer fill task */
+    if (!fill_bkg_task) {
+        io_class =
+            H5_DAOS_IO_CLASS((size_t)chunk_info->num_elem_sel_file * chunk_io_ud->tconv.file_type_size);
+        if (H5_daos_io_budget_acquire(io_class, io_task, &io_gate) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't acquire I/O budget for dataset I/O task");
+        chunk_io_ud->io_class = io_class;
+        budget_held           = TRUE;
+    } /* end if */
+
     /* Schedule IO task (or save it to be scheduled later) */
     if (*first_task) {
         assert(*dep_task);
@@ -3068,11 +3131,20 @@ H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_dao
         *first_task = io_task;
     *dep_task = io_task;
 
+    /* The IO task's completion callback now releases its budget slot */
+    budget_held = FALSE;
+
     /* Task will be scheduled, give it a reference to req and the dataset */
     chunk_io_ud->req->rc++;
     chunk_io_ud->dset->obj.item.rc++;
 
 done:
+    /* Give back the budget slot (or drop the gate) if the IO task will never
+     * run.  A background buffer fill task that was already scheduled then
+     * runs outside the budget. */
+    if (budget_held)
+        H5_daos_io_budget_cancel(io_class, io_gate);
+
     /* Cleanup on failure */
     if (ret_value < 0 && chunk_io_ud && !fill_bkg_task) {
         if (chunk_io_ud->tconv.mem_type_id >= 0 && H5Tclose(chunk_io_ud->tconv.mem_type_id) < 0)
@@ -3085,7 +3157,7 @@ done:
             chunk_io_ud->tconv.tconv_buf = DV_free(chunk_io_ud->tconv.tconv_buf);
         if (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
             chunk_io_ud->tconv.bkg_buf = DV_free(chunk_io_ud->tconv.bkg_buf);
-        chunk_io_ud = DV_free(chunk_io_ud);
+        chunk_io_ud = H5_DAOS_FL_FREE(H5_daos_chunk_io_ud_t, chunk_io_ud);
     } /* end if */
 
     D_FUNC_LEAVE;
@@ -3989,6 +4061,10 @@ done:
         if (ret_value < 0)
             int_req->status = -H5_DAOS_SETUP_ERROR;
 
+        /* Raw data writes touch no metadata, so they can be canceled after
+         * they start */
+        int_req->cancel_in_flight = TRUE;
+
         /* Add the request to the object's request queue.  This will add the
          * dependency on the dataset open if necessary. */
         if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_WRITE,
@@ -4816,6 +4892,7 @@ H5_daos_dataset_close_real(H5_daos_dset_t *dset)
 
             DV_free(dset->io_cache.chunk_info);
         }
+        H5_daos_name_cache_free(&dset->obj.attr_name_cache);
         dset = H5FL_FREE(H5_daos_dset_t, dset);
     } /* end if */
 
@@ -725,7 +725,7 @@ H5_daos_file_handles_bcast(H5_daos_file_t *file, H5_daos_req_t *req, tse_task_t
     bcast_udata->buffer         = NULL;
     bcast_udata->buffer_len     = 0;
     bcast_udata->count          = 0;
-    bcast_udata->comm           = req->file->comm;
+    bcast_udata->lane           = NULL;
 
     buf_size = (2 * H5_DAOS_GH_BUF_SIZE) + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
 
@@ -766,7 +766,7 @@ H5_daos_file_handles_bcast(H5_daos_file_t *file, H5_daos_req_t *req, tse_task_t
 done:
     /* Do broadcast */
     if (bcast_udata) {
-        if (H5_daos_mpi_ibcast(bcast_udata, NULL, buf_size, (ret_value < 0 ? TRUE : FALSE), NULL,
+        if (H5_daos_mpi_ibcast(bcast_udata, NULL, buf_size, (ret_value < 0 ? TRUE : FALSE), FALSE, NULL,
                                H5_daos_handles_bcast_comp_cb, req, first_task, dep_task) < 0) {
             DV_free(bcast_udata->buffer);
             DV_free(bcast_udata);
@@ -835,16 +835,19 @@ H5_daos_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_
     /* allocate the file object that is returned to the user */
     if (NULL == (file = H5FL_CALLOC(H5_daos_file_t)))
         D_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "can't allocate DAOS file struct");
-    file->item.open_req = NULL;
-    file->container_poh = DAOS_HDL_INVAL;
-    file->glob_md_oh    = DAOS_HDL_INVAL;
-    file->root_grp      = NULL;
-    file->create_prop   = NULL;
-    file->fcpl_id       = H5P_FILE_CREATE_DEFAULT;
-    file->fapl_id       = H5P_FILE_ACCESS_DEFAULT;
-    file->item.rc       = 1;
-    file->comm          = MPI_COMM_NULL;
-    file->info          = MPI_INFO_NULL;
+    file->item.open_req     = NULL;
+    file->container_poh     = DAOS_HDL_INVAL;
+    file->glob_md_oh        = DAOS_HDL_INVAL;
+    file->root_grp          = NULL;
+    file->create_prop       = NULL;
+    file->fcpl_id           = H5P_FILE_CREATE_DEFAULT;
+    file->fapl_id           = H5P_FILE_ACCESS_DEFAULT;
+    file->item.rc           = 1;
+    file->comm              = MPI_COMM_NULL;
+    file->info              = MPI_INFO_NULL;
+    file->coll_lanes        = NULL;
+    file->ncoll_lanes       = 0;
+    file->bcast_stream.comm = MPI_COMM_NULL;
 
     /* Fill in fields of file we know */
     file->item.type    = H5I_FILE;
@@ -880,6 +883,10 @@ H5_daos_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_
     if (H5_daos_fill_fapl_cache(file, fapl_id) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "failed to fill FAPL cache");
 
+    /* Set up collective lanes */
+    if (H5_daos_coll_lanes_init(file) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't set up collective lanes");
+
     /* Fill encoded default property list buffer cache */
     if (H5_daos_fill_enc_plist_cache(file, fapl_id) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "failed to fill encoded property list buffer cache");
@@ -921,7 +928,7 @@ H5_daos_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_
     /* Create root group */
     if (NULL == (file->root_grp = (H5_daos_group_t *)H5_daos_group_create_helper(
                      file, TRUE, fcpl_id, H5P_GROUP_ACCESS_DEFAULT, NULL, NULL, 0, TRUE, int_req, &first_task,
-                     &dep_task)))
+                     &dep_task, NULL)))
         D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't create root group");
 
         /* Write root group OID to global metadata object */
@@ -1572,14 +1579,17 @@ H5_daos_file_open(const char *name, unsigned flags, hid_t fapl_id, hid_t H5VL_DA
     /* Allocate the file object that is returned to the user */
     if (NULL == (file = H5FL_CALLOC(H5_daos_file_t)))
         D_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "can't allocate DAOS file struct");
-    file->item.open_req = NULL;
-    file->container_poh = DAOS_HDL_INVAL;
-    file->glob_md_oh    = DAOS_HDL_INVAL;
-    file->root_grp      = NULL;
-    file->fapl_id       = H5P_FILE_ACCESS_DEFAULT;
-    file->item.rc       = 1;
-    file->comm          = MPI_COMM_NULL;
-    file->info          = MPI_INFO_NULL;
+    file->item.open_req     = NULL;
+    file->container_poh     = DAOS_HDL_INVAL;
+    file->glob_md_oh        = DAOS_HDL_INVAL;
+    file->root_grp          = NULL;
+    file->fapl_id           = H5P_FILE_ACCESS_DEFAULT;
+    file->item.rc           = 1;
+    file->comm              = MPI_COMM_NULL;
+    file->info              = MPI_INFO_NULL;
+    file->coll_lanes        = NULL;
+    file->ncoll_lanes       = 0;
+    file->bcast_stream.comm = MPI_COMM_NULL;
 
     /* Fill in fields of file we know */
     file->item.type = H5I_FILE;
@@ -1623,6 +1633,10 @@ H5_daos_file_open(const char *name, unsigned flags, hid_t fapl_id, hid_t H5VL_DA
     if (H5_daos_fill_fapl_cache(file, fapl_id) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "failed to fill FAPL cache");
 
+    /* Set up collective lanes */
+    if (H5_daos_coll_lanes_init(file) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't set up collective lanes");
+
     /* Fill encoded default property list buffer cache */
     if (H5_daos_fill_enc_plist_cache(file, fapl_id) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "failed to fill encoded property list buffer cache");
@@ -2686,6 +2700,10 @@ H5_daos_file_specific(void *item, H5VL_file_specific_args_t *specific_args, hid_
             if (!file)
                 D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "file not provided to file flush operation");
 
+            /* Check any deferred collective errors before flushing */
+            if (H5_daos_collective_error_check_flush(file) < 0)
+                D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't check deferred collective errors");
+
             /* Start H5 operation */
             if (NULL == (int_req = H5_daos_req_create(file, "file flush", file->item.open_req, NULL, NULL,
                                                       H5I_INVALID_HID)))
@@ -2807,7 +2825,7 @@ H5_daos_file_specific(void *item, H5VL_file_specific_args_t *specific_args, hid_
                 bcast_info->buffer_len = bcast_info->count = (int)sizeof(file_delete_status);
                 bcast_info->comm                           = file_delete_comm;
 
-                if (H5_daos_mpi_ibcast(bcast_info, NULL, sizeof(file_delete_status), FALSE, NULL,
+                if (H5_daos_mpi_ibcast(bcast_info, NULL, sizeof(file_delete_status), FALSE, FALSE, NULL,
                                        H5_daos_file_delete_status_bcast_comp_cb, int_req, &first_task,
                                        &dep_task) < 0)
                     D_GOTO_ERROR(H5E_FILE, H5E_CANTDELETE, FAIL, "can't broadcast file deletion status");
@@ -3424,6 +3442,8 @@ H5_daos_file_close_helper(H5_daos_file_t *file)
             file->file_name = DV_free(file->file_name);
         if (file->def_plist_cache.plist_buffer)
             file->def_plist_cache.plist_buffer = DV_free(file->def_plist_cache.plist_buffer);
+        if (H5_daos_coll_lanes_free(file) < 0)
+            D_DONE_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL, "failed to free collective lanes");
         if (H5_daos_comm_info_free(&file->comm, &file->info) < 0)
             D_DONE_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL,
                          "failed to free copy of MPI communicator and info");
@@ -3576,11 +3596,18 @@ H5_daos_file_close(void *_file, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
     if (H5I_FILE != file->item.type)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a file");
 
+    /* Check any deferred collective errors before closing */
+    if (H5_daos_collective_error_check_flush(file) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't check deferred collective errors");
+
     /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
     if (NULL == (int_req = H5_daos_req_create(file, "file close", file->item.open_req, NULL, NULL,
                                               H5P_DATASET_XFER_DEFAULT)))
         D_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't create DAOS request");
 
+    /* Wait for the requests in all collective lanes */
+    int_req->collective.barrier = TRUE;
+
     /* Create task for barrier (or just close if there is only one process) */
     if (H5_daos_create_task(file->num_procs > 1 ? H5_daos_mpi_ibarrier_task : H5_daos_metatask_autocomplete,
                             0, NULL, NULL, H5_daos_file_close_barrier_comp_cb, int_req, &barrier_task) < 0)
@@ -3650,8 +3677,12 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_file_flush
  *
- * Purpose:     Flushes a DAOS file.  Currently a no-op, may create a
- *              snapshot in the future.
+ * Purpose:     Flushes a DAOS file.  Merges the changes to the maps
+ *              open on the file with those made by the other processes
+ *              (see H5_daos_map_file_sync()), which for a file opened
+ *              read-write in more than one process requires H5Fflush to
+ *              be called collectively.  May create a snapshot in the
+ *              future.
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -3662,8 +3693,7 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_file_flush(H5_daos_file_t H5VL_DAOS_UNUSED *file, H5_daos_req_t H5VL_DAOS_UNUSED *req,
-                   tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_file_flush(H5_daos_file_t *file, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
     tse_task_t *barrier_task = NULL;
     herr_t      ret_value    = SUCCEED; /* Return value */
@@ -3680,6 +3710,10 @@ H5_daos_file_flush(H5_daos_file_t H5VL_DAOS_UNUSED *file, H5_daos_req_t H5VL_DAO
     *first_task = barrier_task;
     *dep_task   = barrier_task;
 
+    /* Sync the maps open on the file */
+    if (H5_daos_map_file_sync(file, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't sync maps");
+
 #if 0
     /* Collectively determine if anyone requested a snapshot of the epoch */
     if(MPI_SUCCESS != MPI_Reduce(file->my_rank == 0 ? MPI_IN_PLACE : &file->snap_epoch, &file->snap_epoch, 1, MPI_INT, MPI_LOR, 0, file->facc_params.comm))
@@ -3766,6 +3800,62 @@ H5_daos_fill_fapl_cache(H5_daos_file_t *file, hid_t fapl_id)
                 D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "unknown object class");
     } /* end if */
 
+    /* Check for unordered visit setting on fapl_id */
+    file->fapl_cache.unordered_visit = FALSE;
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_UNORDERED_VISIT_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for unordered visit property");
+    if (prop_exists)
+        if (H5Pget(fapl_id, H5_DAOS_UNORDERED_VISIT_PROP_NAME, &file->fapl_cache.unordered_visit) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get unordered visit property");
+
+    /* Check for OIDX preallocation setting on fapl_id */
+    file->fapl_cache.oidx_prealloc = 0;
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_OIDX_PREALLOC_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for OIDX preallocation property");
+    if (prop_exists)
+        if (H5Pget(fapl_id, H5_DAOS_OIDX_PREALLOC_PROP_NAME, &file->fapl_cache.oidx_prealloc) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get OIDX preallocation property");
+
+    /* Check for node-local broadcast setting on fapl_id */
+    file->fapl_cache.node_local_bcast = FALSE;
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_NODE_LOCAL_BCAST_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for node-local broadcast property");
+    if (prop_exists)
+        if (H5Pget(fapl_id, H5_DAOS_NODE_LOCAL_BCAST_PROP_NAME, &file->fapl_cache.node_local_bcast) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get node-local broadcast property");
+
+    /* Check for collective error check batch size on fapl_id */
+    file->fapl_cache.coll_err_batch = 0;
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_COLL_ERR_BATCH_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for collective error check batch property");
+    if (prop_exists)
+        if (H5Pget(fapl_id, H5_DAOS_COLL_ERR_BATCH_PROP_NAME, &file->fapl_cache.coll_err_batch) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get collective error check batch property");
+
+    /* Check for number of collective lanes on fapl_id */
+    file->fapl_cache.coll_lanes = H5_DAOS_COLL_LANES_DEFAULT;
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_COLL_LANES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for collective lanes property");
+    if (prop_exists)
+        if (H5Pget(fapl_id, H5_DAOS_COLL_LANES_PROP_NAME, &file->fapl_cache.coll_lanes) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get collective lanes property");
+
+    /* Check for broadcast coalescing setting on fapl_id */
+    file->fapl_cache.bcast_coalesce = FALSE;
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_BCAST_COALESCE_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for broadcast coalescing property");
+    if (prop_exists)
+        if (H5Pget(fapl_id, H5_DAOS_BCAST_COALESCE_PROP_NAME, &file->fapl_cache.bcast_coalesce) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get broadcast coalescing property");
+
+    /* Check for wait mode setting on fapl_id */
+    file->fapl_cache.wait_mode = H5_DAOS_WAIT_POLL;
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_WAIT_MODE_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for wait mode property");
+    if (prop_exists)
+        if (H5Pget(fapl_id, H5_DAOS_WAIT_MODE_PROP_NAME, &file->fapl_cache.wait_mode) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get wait mode property");
+
 done:
     D_FUNC_LEAVE;
 } /* end H5_daos_fill_fapl_cache() */
@@ -150,8 +150,78 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path, hid_t lcpl_id, H5
         tmp_path_buf[*obj_name_len] = '\0';
         *obj_name                   = tmp_path_buf;
 
-        /* Search for '/' */
-        next_obj = strchr(*obj_name, '/');
+        /* If creating intermediate groups, hand the whole intermediate path
+         * to a single follow, so once a missing group is found all groups
+         * below it can be created at once */
+        if (crt_intermed_grp && NULL != (next_obj = strrchr(*obj_name, '/'))) {
+            daos_obj_id_t **oid_ptr;
+            size_t          intermed_len = (size_t)(next_obj - *obj_name);
+            htri_t          followed;
+
+            /* Advance obj_name_len past the intermediate path */
+            *obj_name_len -= intermed_len + 1;
+
+            /* Follow (and create) intermediate path */
+            assert(obj->item.type == H5I_GROUP);
+            if ((followed = H5_daos_link_follow_crt_path((H5_daos_group_t *)obj, *obj_name, intermed_len, req,
+                                                         &oid_ptr, first_task, dep_task)) < 0)
+                D_GOTO_ERROR(H5E_SYM, H5E_TRAVERSE, NULL, "can't follow path to group");
+
+            /* Open the last group in the path, unless the path only had "."
+             * components */
+            if (followed) {
+                /* Close previous group */
+                if (H5_daos_group_close_real((H5_daos_group_t *)obj) < 0)
+                    D_GOTO_ERROR(H5E_SYM, H5E_CLOSEERROR, NULL, "can't close group");
+                obj = NULL;
+
+                /* Start internal H5 operation for group open.  This will
+                 * not be visible to the API, will not be added to an operation
+                 * pool, and will be integrated into this function's task chain. */
+                if (NULL == (int_int_req = H5_daos_req_create(item->file, "group open within group traversal",
+                                                              NULL, NULL, req, H5I_INVALID_HID)))
+                    D_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, NULL, "can't create DAOS request");
+
+                /* Allocate the group object that is returned to the user */
+                if (NULL == (obj = H5FL_CALLOC(H5_daos_group_t)))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate DAOS group struct");
+
+                /* Open last group in path */
+                if (H5_daos_group_open_helper(item->file, (H5_daos_group_t *)obj, H5P_GROUP_ACCESS_DEFAULT,
+                                              FALSE, int_int_req, first_task, dep_task) < 0)
+                    D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group");
+
+                /* Create task to finalize internal operation */
+                if (H5_daos_create_task(H5_daos_h5op_finalize, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                        NULL, NULL, int_int_req, &int_int_req->finalize_task) < 0)
+                    D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL,
+                                 "can't create task to finalize internal operation");
+
+                /* Schedule finalize task (or save it to be scheduled later),
+                 * give it ownership of int_int_req, and update task pointers */
+                if (*first_task) {
+                    if (0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
+                        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL,
+                                     "can't schedule task to finalize H5 operation: %s",
+                                     H5_daos_err_to_string(ret));
+                } /* end if */
+                else
+                    *first_task = int_int_req->finalize_task;
+                *dep_task   = int_int_req->finalize_task;
+                int_int_req = NULL;
+
+                /* Retarget oid_ptr to grp->obj.oid so the follow fills in the
+                 * group's oid */
+                *oid_ptr = &obj->oid;
+            } /* end if */
+
+            /* Advance to final path element */
+            *obj_name = next_obj + 1;
+            next_obj  = NULL;
+        } /* end if */
+        else
+            /* Search for '/' */
+            next_obj = strchr(*obj_name, '/');
 
         /* Traverse path */
         while (next_obj) {
@@ -299,6 +369,11 @@ done:
  *
  * Purpose:     Performs the actual group creation.
  *
+ *              If open_dep_task is not NULL, it is set to the task after
+ *              which the group's oid is set and its DAOS object is open.
+ *              Tasks that only need that (such as creating a child group)
+ *              can depend on it instead of on the whole create.
+ *
  * Return:      Success:        group object.
  *              Failure:        NULL
  *
@@ -311,7 +386,7 @@ void *
 H5_daos_group_create_helper(H5_daos_file_t *file, hbool_t is_root, hid_t gcpl_id, hid_t gapl_id,
                             H5_daos_group_t *parent_grp, const char *name, size_t name_len,
                             hbool_t collective, H5_daos_req_t *req, tse_task_t **first_task,
-                            tse_task_t **dep_task)
+                            tse_task_t **dep_task, tse_task_t **open_dep_task)
 {
     H5_daos_group_t            *grp          = NULL;
     H5_daos_md_rw_cb_ud_flex_t *update_cb_ud = NULL;
@@ -359,6 +434,11 @@ H5_daos_group_create_helper(H5_daos_file_t *file, hbool_t is_root, hid_t gcpl_id
                          first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group object");
 
+    /* Return the task after which the group's oid is set and its object is
+     * open, if requested */
+    if (open_dep_task)
+        *open_dep_task = *dep_task;
+
     /* Create group and write metadata if this process should */
     if (!collective || (file->my_rank == 0)) {
         size_t      gcpl_size = 0;
@@ -628,7 +708,7 @@ H5_daos_group_create(void *_item, const H5VL_loc_params_t H5VL_DAOS_UNUSED *loc_
     /* Create group and link to group */
     if (NULL == (grp = (H5_daos_group_t *)H5_daos_group_create_helper(
                      item->file, FALSE, gcpl_id, gapl_id, (H5_daos_group_t *)target_obj, target_name,
-                     target_name_len, collective, int_req, &first_task, &dep_task)))
+                     target_name_len, collective, int_req, &first_task, &dep_task, NULL)))
         D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL, "can't create group");
 
     /* Set return value */
@@ -672,11 +752,9 @@ done:
             op_type = H5_DAOS_OP_TYPE_WRITE_ORDERED;
 
         /* Add the request to the object's request queue.  This will add the
-         * dependency on the group open if necessary.  If this is an anonymous
-         * create add to the file pool. */
-        if (H5_daos_req_enqueue(int_req, first_task, item, op_type,
-                                target_obj ? H5_DAOS_OP_SCOPE_OBJ : H5_DAOS_OP_SCOPE_FILE, collective,
-                                !req) < 0)
+         * dependency on the group open if necessary. */
+        if (H5_daos_req_enqueue_create(int_req, first_task, item, ret_value ? &grp->obj.item : NULL,
+                                       !target_obj, op_type, collective, !req) < 0)
             D_DONE_ERROR(H5E_SYM, H5E_CANTINIT, NULL, "can't add request to request queue");
 
         /* Check for external async */
@@ -1257,7 +1335,7 @@ H5_daos_group_open_helper(H5_daos_file_t *file, H5_daos_group_t *grp, hid_t gapl
         bcast_udata->bcast_udata.buffer     = bcast_udata->flex_buf;
         bcast_udata->bcast_udata.buffer_len = H5_DAOS_GINFO_BUF_SIZE;
         bcast_udata->bcast_udata.count      = H5_DAOS_GINFO_BUF_SIZE;
-        bcast_udata->bcast_udata.comm       = req->file->comm;
+        bcast_udata->bcast_udata.lane       = NULL;
     } /* end if */
 
     /* Open group and read metadata if this process should */
@@ -1355,8 +1433,9 @@ done:
     if (bcast_udata) {
         if (H5_daos_mpi_ibcast(
                 &bcast_udata->bcast_udata, &grp->obj, H5_DAOS_GINFO_BUF_SIZE, 0 != ret_value ? TRUE : FALSE,
-                NULL, file->my_rank == 0 ? H5_daos_group_open_bcast_comp_cb : H5_daos_group_open_recv_comp_cb,
-                req, first_task, dep_task) < 0) {
+                TRUE, NULL,
+                file->my_rank == 0 ? H5_daos_group_open_bcast_comp_cb : H5_daos_group_open_recv_comp_cb, req,
+                first_task, dep_task) < 0) {
             DV_free(bcast_udata);
             D_DONE_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_H5_OPEN_ERROR,
                          "failed to broadcast group info buffer");
@@ -1501,7 +1580,7 @@ done:
     /* Cleanup on failure */
     if (NULL == ret_value) {
         /* Broadcast failure */
-        if (must_bcast && H5_daos_mpi_ibcast(NULL, &grp->obj, H5_DAOS_GINFO_BUF_SIZE, TRUE, NULL,
+        if (must_bcast && H5_daos_mpi_ibcast(NULL, &grp->obj, H5_DAOS_GINFO_BUF_SIZE, TRUE, TRUE, NULL,
                                              item->file->my_rank == 0 ? H5_daos_group_open_bcast_comp_cb
                                                                       : H5_daos_group_open_recv_comp_cb,
                                              req, first_task, dep_task) < 0)
@@ -1930,6 +2009,8 @@ H5_daos_group_close_real(H5_daos_group_t *grp)
         if (grp->gapl_id != H5I_INVALID_HID && grp->gapl_id != H5P_GROUP_ACCESS_DEFAULT)
             if (H5Idec_ref(grp->gapl_id) < 0)
                 D_DONE_ERROR(H5E_SYM, H5E_CANTDEC, FAIL, "failed to close gapl");
+        H5_daos_name_cache_free(&grp->link_name_cache);
+        H5_daos_name_cache_free(&grp->obj.attr_name_cache);
         grp = H5FL_FREE(H5_daos_group_t, grp);
     } /* end if */
 
@@ -23,6 +23,12 @@
 #define H5_DAOS_HARD_LINK_VAL_SIZE         (H5_DAOS_ENCODED_OID_SIZE + 1)
 #define H5_DAOS_RECURSE_LINK_PATH_BUF_INIT 1024
 
+/* Tags following the encoded slot or creation order value in the akeys of
+ * the records a compaction adds to a group's link creation order index (the
+ * tag of the akey mapping a slot to the link target is 0) */
+#define H5_DAOS_LINK_CORDER_REC_TAG 1 /* Slot -> link creation order value */
+#define H5_DAOS_LINK_SLOT_REC_TAG   2 /* Link creation order value -> slot */
+
 /*
  * Given an H5_daos_link_val_t and the link's type, encodes
  * the link's value into the given buffer.
@@ -120,11 +126,13 @@ typedef struct H5_daos_link_write_ud_t {
 typedef struct H5_daos_link_write_corder_ud_t {
     H5_daos_md_rw_cb_ud_t    md_rw_cb_ud; /* Must be first */
     H5_daos_link_write_ud_t *link_write_ud;
-    uint8_t                  nlinks_old_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
+    uint8_t                  slot_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     uint8_t                  nlinks_new_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
     uint8_t                  max_corder_new_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     uint8_t                  corder_target_buf[H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE];
-    hsize_t                  nlinks;
+    uint8_t                  fmt_buf[H5_DAOS_ENCODED_CORDER_FMT_SIZE];
+    uint64_t                 new_max_corder;
+    H5_daos_corder_info_t    corder_info;
     tse_task_t              *write_corder_task;
 } H5_daos_link_write_corder_ud_t;
 
@@ -168,6 +176,10 @@ typedef struct H5_daos_link_follow_ud_t {
     hbool_t            link_read;
     hbool_t           *link_exists;
     char              *path_buf;
+    const char        *crt_rem_path;
+    size_t             crt_rem_path_len;
+    H5_daos_group_t  **crt_grps;
+    size_t             ncrt_grps;
 } H5_daos_link_follow_ud_t;
 
 /* User data struct for link get info */
@@ -213,24 +225,25 @@ typedef struct H5_daos_link_iter_op_ud_t {
     size_t             link_path_len;
     char              *char_replace_loc;
     char               char_replace_char;
+    char              *path_buf; /* Private copy of link path (unordered visits only) */
     tse_task_t        *op_task;
 } H5_daos_link_iter_op_ud_t;
 
 /* User data struct for iteration by creation order */
 typedef struct H5_daos_link_ibco_ud_t {
-    H5_daos_iter_data_t *iter_data;
-    H5_daos_group_t     *target_grp;
-    hsize_t              grp_nlinks;
-    hsize_t              crt_idx;
-    const char          *link_name;
-    size_t               link_name_len;
-    char                *name_buf;
-    size_t               name_buf_size;
-    H5_daos_link_val_t   link_val;
-    H5L_info2_t          linfo;
-    hbool_t              base_iter;
-    char                *null_replace_loc;
-    tse_task_t          *ibco_metatask;
+    H5_daos_iter_data_t  *iter_data;
+    H5_daos_group_t      *target_grp;
+    H5_daos_corder_info_t corder_info;
+    hsize_t               crt_idx;
+    const char           *link_name;
+    size_t                link_name_len;
+    char                 *name_buf;
+    size_t                name_buf_size;
+    H5_daos_link_val_t    link_val;
+    H5L_info2_t           linfo;
+    hbool_t               base_iter;
+    char                 *null_replace_loc;
+    tse_task_t           *ibco_metatask;
 } H5_daos_link_ibco_ud_t;
 
 /* Task user data for deleting a link */
@@ -254,31 +267,65 @@ typedef struct H5_daos_link_delete_corder_ud_t {
     const H5VL_loc_params_t       *loc_params;
     const char                    *target_link_name;
     daos_key_t                     dkey;
-    daos_key_t                     akeys[2];
+    daos_key_t                     akeys[4];
     uint64_t                       delete_idx;
     hsize_t                        grp_nlinks;
+    H5_daos_corder_info_t          corder_info;
+    uint64_t                       link_corder;
+    hbool_t                        sparse;
+    hbool_t                        moved;
+    hbool_t                        compact;
     uint8_t                        idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     uint8_t                        crt_order_target_buf[H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE];
+    uint8_t                        corder_rec_key_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
+    uint8_t                        slot_rec_key_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
     H5_daos_link_crt_idx_iter_ud_t name_order_iter_cb_ud;
+    /* Fields for looking up the slot of
+     * a link moved by a compaction.
+     */
+    struct {
+        daos_iod_t     iod;
+        daos_sg_list_t sgl;
+        daos_iov_t     sg_iov;
+        uint8_t        slot_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    } slot_data;
     /* Fields for updating the number
      * of links in the group.
      */
     struct {
-        H5_daos_md_rw_cb_ud_t unl_ud;
-        uint8_t               nlinks_new_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
+        H5_daos_md_rw_cb_ud_t         unl_ud;
+        uint8_t                       nlinks_new_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
+        uint8_t                       nholes_new_buf[H5_DAOS_ENCODED_UINT64_T_SIZE];
+        H5_daos_corder_holes_update_t holes_update;
     } unl_data;
     /* Fields for performing bookkeeping on
      * group's link creation order index.
+     * When compacting a sparse index every
+     * remaining link is moved, and the links
+     * moved by the last compaction (the first
+     * ncorder_recs) have creation order
+     * records.
      */
     struct {
         daos_key_t      dkey;
-        daos_key_t      tail_akeys[2];
+        daos_key_t     *punch_akeys;
         daos_sg_list_t *sgls;
         daos_iod_t     *iods;
         daos_iov_t     *sg_iovs;
+        uint64_t       *slots;
         uint8_t        *crt_order_link_name_buf;
         uint8_t        *crt_order_link_trgt_buf;
+        uint8_t        *link_name_data_buf;
+        uint8_t        *link_trgt_data_buf;
+        uint8_t        *recs_buf;
+        uint8_t        *corder_rec_keys;
+        uint8_t        *corder_vals;
+        uint8_t        *slot_rec_keys;
+        uint8_t        *slot_vals;
         size_t          nlinks_shift;
+        size_t          ncorder_recs;
+        uint8_t         fmt_buf[H5_DAOS_ENCODED_CORDER_FMT_SIZE];
+        uint8_t         nholes_buf[H5_DAOS_ENCODED_UINT64_T_SIZE];
     } index_data;
 } H5_daos_link_delete_corder_ud_t;
 
@@ -293,60 +340,51 @@ typedef struct H5_daos_link_delete_rc_ud_t {
     tse_task_t        *rc_task;
 } H5_daos_link_delete_rc_ud_t;
 
-/*
- * A link iteration callback function data structure. It is
- * passed during link iteration when retrieving a link's name
- * by a given creation order index value.
- */
-typedef struct H5_daos_link_find_name_by_idx_ud_t {
-    char    *link_name_out;
-    size_t   link_name_out_size;
-    uint64_t target_link_idx;
-    uint64_t cur_link_idx;
-} H5_daos_link_find_name_by_idx_ud_t;
-
 /* User data struct for link get name by index with automatic asynchronous
  * name buffer allocation */
 typedef struct H5_daos_link_gnbi_alloc_ud_t {
-    H5_daos_req_t   *req;
-    tse_task_t      *gnbi_task;
-    H5_daos_group_t *target_grp;
-    H5_index_t       index_type;
-    H5_iter_order_t  iter_order;
-    uint64_t         idx;
-    const char     **link_name;
-    size_t          *link_name_size;
-    char           **link_name_buf;
-    size_t          *link_name_buf_size;
-    size_t           cur_link_name_size;
+    H5_daos_req_t               *req;
+    tse_task_t                  *gnbi_task;
+    H5_daos_group_t             *target_grp;
+    H5_index_t                   index_type;
+    H5_iter_order_t              iter_order;
+    uint64_t                     idx;
+    const H5_daos_corder_info_t *corder_info;
+    const char                 **link_name;
+    size_t                      *link_name_size;
+    char                       **link_name_buf;
+    size_t                      *link_name_buf_size;
+    size_t                       cur_link_name_size;
 } H5_daos_link_gnbi_alloc_ud_t;
 
 /* User data struct for link get name by creation order */
 typedef struct H5_daos_link_gnbc_ud_t {
-    H5_daos_md_rw_cb_ud_t md_rw_cb_ud;
-    uint8_t               idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
-    tse_task_t           *gnbc_task;
-    hsize_t               grp_nlinks;
-    H5_iter_order_t       iter_order;
-    uint64_t              index;
-    size_t               *link_name_size;
-    char                 *link_name_out;
-    size_t                link_name_out_size;
+    H5_daos_md_rw_cb_ud_t        md_rw_cb_ud;
+    uint8_t                      idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    tse_task_t                  *gnbc_task;
+    const H5_daos_corder_info_t *corder_info;
+    H5_daos_corder_info_t        own_corder_info;
+    H5_iter_order_t              iter_order;
+    uint64_t                     index;
+    size_t                      *link_name_size;
+    char                        *link_name_out;
+    size_t                       link_name_out_size;
 } H5_daos_link_gnbc_ud_t;
 
 /* User data struct for link get name by name order */
 typedef struct H5_daos_link_gnbn_ud_t {
-    H5_daos_req_t                     *req;
-    tse_task_t                        *gnbn_task;
-    H5_daos_link_find_name_by_idx_ud_t iter_cb_ud;
-    hsize_t                            grp_nlinks;
-    hid_t                              target_grp_id;
-    H5_daos_group_t                   *target_grp;
-    H5_iter_order_t                    iter_order;
-    uint64_t                           index;
-    size_t                            *link_name_size;
-    char                              *link_name_out;
-    size_t                             link_name_out_size;
+    H5_daos_req_t       *req;
+    tse_task_t          *gnbn_task;
+    H5_daos_name_cache_t names;
+    hbool_t              names_built;
+    uint64_t             build_gen;
+    hid_t                target_grp_id;
+    H5_daos_group_t     *target_grp;
+    H5_iter_order_t      iter_order;
+    uint64_t             index;
+    size_t              *link_name_size;
+    char                *link_name_out;
+    size_t               link_name_out_size;
 } H5_daos_link_gnbn_ud_t;
 
 /* User data struct for link get creation index by name */
@@ -356,6 +394,14 @@ typedef struct H5_daos_link_gcbn_ud_t {
     uint64_t             *crt_order;
 } H5_daos_link_gcbn_ud_t;
 
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Free lists for per-link user data */
+H5_DAOS_FL_DEFINE_STATIC(H5_daos_link_read_ud_t);
+H5_DAOS_FL_DEFINE_STATIC(H5_daos_link_write_ud_t);
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -383,8 +429,21 @@ static int    H5_daos_link_write_corder_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_link_copy_move_task(tse_task_t *task);
 static int H5_daos_link_copy_move_end_task(tse_task_t *task);
 
-static int H5_daos_link_follow_end(tse_task_t *task);
-static int H5_daos_link_follow_task(tse_task_t *task);
+static int    H5_daos_link_follow_end(tse_task_t *task);
+static int    H5_daos_link_follow_task(tse_task_t *task);
+static hbool_t H5_daos_link_path_next_comp(const char **path, size_t *path_len, const char **comp,
+                                           size_t *comp_len);
+static int     H5_daos_link_follow_open_grp(H5_daos_group_t *grp, H5_daos_req_t *req,
+                                            H5_daos_group_t **open_grp, tse_task_t **first_task,
+                                            tse_task_t **dep_task);
+static int     H5_daos_link_follow_crt_missing(H5_daos_link_follow_ud_t *udata, H5_daos_req_t *req,
+                                               H5_daos_group_t **target_grp, tse_task_t **first_task,
+                                               tse_task_t **dep_task);
+static herr_t  H5_daos_link_follow_int(H5_daos_group_t *grp, const char *name, size_t name_len,
+                                       hbool_t crt_missing_grp, const char *crt_rem_path,
+                                       size_t crt_rem_path_len, H5_daos_req_t *req,
+                                       daos_obj_id_t ***oid_ptr, hbool_t *link_exists,
+                                       tse_task_t **first_task, tse_task_t **dep_task);
 
 static int H5_daos_link_get_info_end_task(tse_task_t *task);
 static int H5_daos_link_get_info(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
@@ -424,7 +483,10 @@ static herr_t H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL
                                          tse_task_t **first_task, tse_task_t **dep_task);
 static herr_t H5_daos_link_delete_corder_name_cb(hid_t group, const char *name, const H5L_info2_t *info,
                                                  void *op_data);
+static int    H5_daos_link_delete_corder_slot_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_link_delete_corder_slot_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_link_delete_corder_unl_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_link_delete_corder_iter_task(tse_task_t *task);
 static int    H5_daos_link_delete_corder_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_link_delete_corder_bookkeep_task(tse_task_t *task);
 static int    H5_daos_link_bookkeep_phase1_prep_cb(tse_task_t *task, void *args);
@@ -439,7 +501,8 @@ static int    H5_daos_link_gnbi_alloc_task(tse_task_t *task);
 static int    H5_daos_link_gnbc_task(tse_task_t *task);
 static int    H5_daos_link_gnbc_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t iter_order,
-                                                 uint64_t index, size_t *link_name_size, char *link_name_out,
+                                                 uint64_t index, const H5_daos_corder_info_t *corder_info,
+                                                 size_t *link_name_size, char *link_name_out,
                                                  size_t link_name_out_size, H5_daos_req_t *req,
                                                  tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_link_gnbn_task(tse_task_t *task);
@@ -655,7 +718,7 @@ done:
         assert(!udata->md_rw_cb_ud.free_akeys);
 
         /* Free udata */
-        DV_free(udata);
+        H5_DAOS_FL_FREE(H5_daos_link_read_ud_t, udata);
     } /* end if */
 
     D_FUNC_LEAVE;
@@ -694,7 +757,7 @@ H5_daos_link_read(H5_daos_group_t *grp, const char *name, size_t name_len, H5_da
     assert(dep_task);
 
     /* Allocate argument struct for read task */
-    if (NULL == (read_udata = (H5_daos_link_read_ud_t *)DV_calloc(sizeof(H5_daos_link_read_ud_t))))
+    if (NULL == (read_udata = H5_DAOS_FL_CALLOC(H5_daos_link_read_ud_t)))
         D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "can't allocate buffer for read callback arguments");
 
     /* Set up operation to read link value from group */
@@ -762,7 +825,7 @@ H5_daos_link_read(H5_daos_group_t *grp, const char *name, size_t name_len, H5_da
 done:
     /* Cleanup on failure */
     if (ret_value < 0) {
-        read_udata = DV_free(read_udata);
+        read_udata = H5_DAOS_FL_FREE(H5_daos_link_read_ud_t, read_udata);
     } /* end if */
 
     /* Make sure we cleaned up */
@@ -867,7 +930,7 @@ H5_daos_link_read_late_name(H5_daos_group_t *grp, const char **name, size_t *nam
     assert(dep_task);
 
     /* Allocate argument struct for read task */
-    if (NULL == (read_udata = (H5_daos_link_read_ud_t *)DV_calloc(sizeof(H5_daos_link_read_ud_t))))
+    if (NULL == (read_udata = H5_DAOS_FL_CALLOC(H5_daos_link_read_ud_t)))
         D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "can't allocate buffer for read callback arguments");
 
     /* Set up operation to read link value from group */
@@ -934,7 +997,7 @@ H5_daos_link_read_late_name(H5_daos_group_t *grp, const char **name, size_t *nam
 done:
     /* Cleanup on failure */
     if (ret_value < 0) {
-        read_udata = DV_free(read_udata);
+        read_udata = H5_DAOS_FL_FREE(H5_daos_link_read_ud_t, read_udata);
     } /* end if */
 
     /* Make sure we cleaned up */
@@ -1066,7 +1129,7 @@ done:
                 DV_free(udata->link_name_buf);
             if (udata->link_val_buf != udata->link_val_buf_static)
                 DV_free(udata->link_val_buf);
-            DV_free(udata);
+            H5_DAOS_FL_FREE(H5_daos_link_write_ud_t, udata);
         } /* end if */
     }     /* end if */
 
@@ -1195,7 +1258,7 @@ done:
                 DV_free(udata->link_name_buf);
             if (udata->link_val_buf != udata->link_val_buf_static)
                 DV_free(udata->link_val_buf);
-            DV_free(udata);
+            H5_DAOS_FL_FREE(H5_daos_link_write_ud_t, udata);
         } /* end if */
     }     /* end if */
 
@@ -1242,7 +1305,7 @@ H5_daos_link_write(H5_daos_group_t *target_grp, const char *name, size_t name_le
         D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "no write intent on file");
 
     /* Allocate argument struct */
-    if (NULL == (link_write_ud = (H5_daos_link_write_ud_t *)DV_calloc(sizeof(H5_daos_link_write_ud_t))))
+    if (NULL == (link_write_ud = H5_DAOS_FL_CALLOC(H5_daos_link_write_ud_t)))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
                      "can't allocate buffer for link write callback arguments");
     link_write_ud->link_val      = *link_val;
@@ -1354,7 +1417,7 @@ done:
             link_write_ud->link_name_buf = DV_free(link_write_ud->link_name_buf);
         if (link_write_ud->link_val_buf != link_write_ud->link_val_buf_static)
             link_write_ud->link_val_buf = DV_free(link_write_ud->link_val_buf);
-        link_write_ud = DV_free(link_write_ud);
+        link_write_ud = H5_DAOS_FL_FREE(H5_daos_link_write_ud_t, link_write_ud);
     } /* end if */
 
     D_FUNC_LEAVE;
@@ -1477,6 +1540,9 @@ H5_daos_link_write_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         assert(udata->md_rw_cb_ud.obj->item.type == H5I_GROUP);
     } /* end else */
 
+    /* Invalidate cached link name lists */
+    udata->md_rw_cb_ud.req->file->link_mod_gen++;
+
 done:
     if (udata) {
         /* Decrememnt ref count on udata and close it if it drops to 0 */
@@ -1516,7 +1582,7 @@ done:
                 DV_free(udata->link_name_buf);
             if (udata->link_val_buf != udata->link_val_buf_static)
                 DV_free(udata->link_val_buf);
-            DV_free(udata);
+            H5_DAOS_FL_FREE(H5_daos_link_write_ud_t, udata);
         } /* end if */
         else
             /* Return task to task list */
@@ -1544,6 +1610,7 @@ H5_daos_link_wr_corder_info_task(tse_task_t *task)
 {
     H5_daos_link_write_corder_ud_t *udata = NULL;
     uint64_t                        uint_nlinks;
+    uint64_t                        slot;
     tse_task_t                     *update_task = NULL;
     uint8_t                        *p;
     int                             ret;
@@ -1559,18 +1626,31 @@ H5_daos_link_wr_corder_info_task(tse_task_t *task)
     /* Handle errors in previous tasks */
     H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_LINK);
 
-    /* Encode old nlinks */
-    uint_nlinks = (uint64_t)udata->nlinks;
-    p           = udata->nlinks_old_buf;
-    UINT64ENCODE(p, uint_nlinks);
+    /* Determine the index slot for the new link.  The first link added to
+     * an empty index without a format record (a new index, or an emptied
+     * one in the older format) starts a sparse index whose slots begin at
+     * the link's creation order value, and the index's format record is
+     * written with the link.  In a sparse index the slot is derived from the
+     * link's creation order value, in an index in the older format it is
+     * the next slot after the existing links. */
+    if (!udata->corder_info.sparse && udata->corder_info.nobjs == 0) {
+        slot = 0;
+        H5_daos_corder_fmt_encode(udata->fmt_buf, udata->new_max_corder - 1, udata->new_max_corder - 1);
+    } /* end if */
+    else if (udata->corder_info.sparse)
+        slot = udata->new_max_corder - 1 - udata->corder_info.slot_base;
+    else
+        slot = udata->corder_info.nobjs;
+    p = udata->slot_buf;
+    UINT64ENCODE(p, slot);
 
     /* Add new link to count */
-    uint_nlinks++;
+    uint_nlinks = udata->corder_info.nobjs + 1;
 
     /* Encode remaining buffers */
     p = udata->nlinks_new_buf;
     UINT64ENCODE(p, uint_nlinks);
-    memcpy(udata->corder_target_buf, udata->nlinks_old_buf, 8);
+    memcpy(udata->corder_target_buf, udata->slot_buf, 8);
     udata->corder_target_buf[8] = 0;
 
     /* Set up IOD */
@@ -1590,8 +1670,8 @@ H5_daos_link_wr_corder_info_task(tse_task_t *task)
     udata->md_rw_cb_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
 
     /* Key for mapping from link creation order value -> link name */
-    daos_iov_set(&udata->md_rw_cb_ud.iod[2].iod_name, (void *)udata->nlinks_old_buf,
-                 H5_DAOS_ENCODED_NUM_LINKS_SIZE);
+    daos_iov_set(&udata->md_rw_cb_ud.iod[2].iod_name, (void *)udata->slot_buf,
+                 H5_DAOS_ENCODED_CRT_ORDER_SIZE);
     udata->md_rw_cb_ud.iod[2].iod_nr   = 1u;
     udata->md_rw_cb_ud.iod[2].iod_size = (uint64_t)udata->link_write_ud->link_name_buf_size;
     udata->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
@@ -1639,6 +1719,24 @@ H5_daos_link_wr_corder_info_task(tse_task_t *task)
     udata->md_rw_cb_ud.sgl[3].sg_iovs   = &udata->md_rw_cb_ud.sg_iov[3];
     udata->md_rw_cb_ud.free_sg_iov[3]   = TRUE;
 
+    /* Format record of a new sparse index */
+    if (!udata->corder_info.sparse && udata->corder_info.nobjs == 0) {
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[4].iod_name,
+                           H5_daos_link_corder_fmt_key_g, H5_daos_link_corder_fmt_key_size_g);
+        udata->md_rw_cb_ud.iod[4].iod_nr   = 1u;
+        udata->md_rw_cb_ud.iod[4].iod_size = (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE;
+        udata->md_rw_cb_ud.iod[4].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[4], udata->fmt_buf,
+                     (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE);
+        udata->md_rw_cb_ud.sgl[4].sg_nr     = 1;
+        udata->md_rw_cb_ud.sgl[4].sg_nr_out = 0;
+        udata->md_rw_cb_ud.sgl[4].sg_iovs   = &udata->md_rw_cb_ud.sg_iov[4];
+        udata->md_rw_cb_ud.free_sg_iov[4]   = FALSE;
+
+        udata->md_rw_cb_ud.nr = 5;
+    } /* end if */
+
     /* Create task for writing link creation order information
      * to the target group.
      */
@@ -1697,7 +1795,7 @@ done:
                 DV_free(udata->link_write_ud->link_name_buf);
             if (udata->link_write_ud->link_val_buf != udata->link_write_ud->link_val_buf_static)
                 DV_free(udata->link_write_ud->link_val_buf);
-            udata->link_write_ud = DV_free(udata->link_write_ud);
+            udata->link_write_ud = H5_DAOS_FL_FREE(H5_daos_link_write_ud_t, udata->link_write_ud);
         } /* end if */
 
         /* We do not explicitly free the sg_iovs as some of them are
@@ -1772,12 +1870,14 @@ H5_daos_link_write_corder_info(H5_daos_group_t *target_grp, uint64_t new_max_cor
                        H5_daos_link_corder_key_size_g);
     write_corder_ud->md_rw_cb_ud.free_dkey = FALSE;
 
-    /* Read number of links in target group */
-    if (H5_daos_group_get_num_links(target_grp, &write_corder_ud->nlinks, req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get number of links in group");
+    /* Read number of links and the format of the target group's index */
+    if (H5_daos_object_get_corder_info(&target_grp->obj, FALSE, FALSE, &write_corder_ud->corder_info, req,
+                                       first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get link creation order index info");
 
     /* Encode new max corder buf */
-    p = write_corder_ud->max_corder_new_buf;
+    write_corder_ud->new_max_corder = new_max_corder;
+    p                               = write_corder_ud->max_corder_new_buf;
     UINT64ENCODE(p, new_max_corder);
 
     /* Create task to finish this operation */
@@ -1890,7 +1990,7 @@ done:
                 DV_free(udata->link_write_ud->link_val_buf);
             if (udata->link_write_ud->link_name_buf != udata->link_write_ud->link_name_buf_static)
                 DV_free(udata->link_write_ud->link_name_buf);
-            udata->link_write_ud = DV_free(udata->link_write_ud);
+            udata->link_write_ud = H5_DAOS_FL_FREE(H5_daos_link_write_ud_t, udata->link_write_ud);
         } /* end if */
 
         /* We do not explicitly free the sg_iovs as some of them are
@@ -3084,8 +3184,10 @@ H5_daos_link_move(void *src_item, const H5VL_loc_params_t *loc_params1, void *ds
 
 done:
     if (int_req) {
-        H5_daos_op_pool_type_t  op_type;
-        H5_daos_op_pool_scope_t op_scope;
+        H5_daos_op_pool_type_t op_type = H5_DAOS_OP_TYPE_WRITE;
+        H5_daos_item_t        *pool_items[2];
+        size_t                 npool_items = 0;
+        size_t                 i;
 
         assert(src_item || dst_item);
 
@@ -3105,27 +3207,36 @@ done:
         if (ret_value < 0)
             int_req->status = -H5_DAOS_SETUP_ERROR;
 
-        /* Determine operation type - we will add the operation to global op
-         * pool.  If the dst_loc_obj might have link creation order tracked use
+        /* The move only touches links in the source and destination
+         * locations */
+        if (src_item)
+            pool_items[npool_items++] = (H5_daos_item_t *)src_item;
+        if (dst_item)
+            pool_items[npool_items++] = (H5_daos_item_t *)dst_item;
+
+        /* Determine operation type.  The move deletes a link from the source
+         * location and creates one in the destination location, so if either
+         * might have link creation order tracked use
          * H5_DAOS_OP_TYPE_WRITE_ORDERED, otherwise use H5_DAOS_OP_TYPE_WRITE.
          */
-        if (!dst_item || ((H5_daos_item_t *)dst_item)->type != H5I_GROUP ||
-            ((((H5_daos_item_t *)dst_item)->open_req->status == 0 || ((H5_daos_item_t *)dst_item)->created) &&
-             !((H5_daos_group_t *)dst_item)->gcpl_cache.track_corder))
-            op_type = H5_DAOS_OP_TYPE_WRITE;
-        else
-            op_type = H5_DAOS_OP_TYPE_WRITE_ORDERED;
-
-        /* Determine operation scope - use global if the files are different */
-        if (src_item && dst_item && ((H5_daos_item_t *)src_item)->file != ((H5_daos_item_t *)dst_item)->file)
-            op_scope = H5_DAOS_OP_SCOPE_GLOB;
-        else
-            op_scope = H5_DAOS_OP_SCOPE_FILE;
+        for (i = 0; i < npool_items; i++)
+            if (pool_items[i]->type == H5I_GROUP &&
+                ((pool_items[i]->open_req->status != 0 && !pool_items[i]->created) ||
+                 ((H5_daos_group_t *)pool_items[i])->gcpl_cache.track_corder))
+                op_type = H5_DAOS_OP_TYPE_WRITE_ORDERED;
 
         /* Add the request to the request queue.  This will add the dependency
-         * on the source object open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, src_item ? src_item : dst_item, op_type, op_scope,
-                                collective, !req) < 0)
+         * on the source and destination object opens if necessary.  Use the
+         * global pool if the files are different, otherwise add to the pools
+         * of the source and destination locations only, so the move does not
+         * wait for, or hold up, operations elsewhere in the file. */
+        if (npool_items == 2 && pool_items[0]->file != pool_items[1]->file) {
+            if (H5_daos_req_enqueue(int_req, first_task, pool_items[0], op_type, H5_DAOS_OP_SCOPE_GLOB,
+                                    collective, !req) < 0)
+                D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't add request to request queue");
+        } /* end if */
+        else if (H5_daos_req_enqueue_multi(int_req, first_task, npool_items, pool_items, op_type,
+                                           H5_DAOS_OP_SCOPE_OBJ, collective, !req) < 0)
             D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't add request to request queue");
 
         /* Check for external async */
@@ -3265,7 +3376,7 @@ H5_daos_link_get(void *_item, const H5VL_loc_params_t *loc_params, H5VL_link_get
              */
             if (H5_daos_link_get_name_by_idx(
                     (H5_daos_group_t *)target_obj, loc_params->loc_data.loc_by_idx.idx_type,
-                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
+                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL,
                     ret_size, name_out, name_out_size, int_req, &first_task, &dep_task) < 0)
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't retrieve link's name");
 
@@ -3510,6 +3621,11 @@ H5_daos_link_specific(void *_item, const H5VL_loc_params_t *loc_params,
                                    NULL, int_req);
             iter_data.u.link_iter_data.u.link_iter_op = iter_args->op;
 
+            /* H5Lvisit by name may make callbacks out of order if the file
+             * was opened with H5daos_set_unordered_visit() */
+            if (iter_args->recursive && H5_INDEX_NAME == iter_args->idx_type)
+                iter_data.unordered = target_grp->obj.item.file->fapl_cache.unordered_visit;
+
             /* Handle iteration return value (TODO: how to handle if called
              * async? */
             if (!req)
@@ -3669,6 +3785,17 @@ H5_daos_link_follow_end(tse_task_t *task)
             D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close target group");
     } /* end if */
 
+    /* Close any other intermediate groups created */
+    if (udata->crt_grps) {
+        size_t i;
+
+        for (i = 0; i < udata->ncrt_grps; i++)
+            if (H5_daos_group_close_real(udata->crt_grps[i]) < 0)
+                D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                             "can't close intermediate group");
+        DV_free(udata->crt_grps);
+    } /* end if */
+
     /* Close group */
     if (H5_daos_object_close(&udata->grp->obj.item) < 0)
         D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
@@ -3730,8 +3857,8 @@ H5_daos_link_follow_task(tse_task_t *task)
 {
     H5_daos_link_follow_ud_t *udata       = NULL;
     H5_daos_group_t          *target_grp  = NULL;
+    H5_daos_group_t          *next_grp    = NULL;
     H5_daos_req_t            *req         = NULL;
-    H5_daos_req_t            *int_int_req = NULL;
     tse_task_t               *first_task  = NULL;
     tse_task_t               *dep_task    = NULL;
     int                       ret;
@@ -3748,6 +3875,7 @@ H5_daos_link_follow_task(tse_task_t *task)
     assert(udata->oid);
     assert(!udata->path_buf);
     assert(udata->follow_task == task);
+    assert(!udata->crt_rem_path_len || udata->crt_missing_grp);
 
     /* Assign req convenience pointer.  We do this so we can still handle errors
      * after transferring ownership of udata.  This should be safe since we
@@ -3761,8 +3889,18 @@ H5_daos_link_follow_task(tse_task_t *task)
     if (udata->link_read) {
         switch (udata->link_val.type) {
             case H5L_TYPE_HARD:
-                /* Simply return the read oid and */
-                *udata->oid = udata->link_val.target.hard;
+                /* If there is more of the path to follow, open the target
+                 * group to continue from.  Otherwise simply return the read
+                 * oid. */
+                if (udata->crt_rem_path_len > 0) {
+                    if (0 != (ret = H5_daos_link_follow_open_grp(udata->grp, req, &next_grp, &first_task,
+                                                                 &dep_task)))
+                        D_GOTO_ERROR(H5E_LINK, H5E_CANTOPENOBJ, ret, "can't open group: %s",
+                                     H5_daos_err_to_string(ret));
+                    next_grp->obj.oid = udata->link_val.target.hard;
+                } /* end if */
+                else
+                    *udata->oid = udata->link_val.target.hard;
 
                 if (udata->link_exists)
                     *udata->link_exists = TRUE;
@@ -3782,9 +3920,15 @@ H5_daos_link_follow_task(tse_task_t *task)
                     D_GOTO_ERROR(H5E_LINK, H5E_TRAVERSE, -H5_DAOS_TRAVERSE_ERROR, "can't traverse path");
                 assert(target_grp->obj.item.type == H5I_GROUP);
 
-                /* Check for no target_name, in this case just return target_grp */
+                /* Check for no target_name, in this case just return target_grp
+                 * (or continue from it if there is more of the path to
+                 * follow) */
                 if (target_name_len == 0) {
-                    if (dep_task) {
+                    if (udata->crt_rem_path_len > 0) {
+                        next_grp   = target_grp;
+                        target_grp = NULL;
+                    } /* end if */
+                    else if (dep_task) {
                         /* target_grp may be incomplete at this point, save
                          * a pointer to it so the oid can be set by
                          * link_follow_end, and don't close it here */
@@ -3802,9 +3946,19 @@ H5_daos_link_follow_task(tse_task_t *task)
                         D_GOTO_ERROR(H5E_LINK, H5E_TRAVERSE, -H5_DAOS_FOLLOW_ERROR,
                                      "can't follow link to group");
 
-                    /* Retarget oid_ptr to grp->obj.oid so
-                     * H5_daos_link_follow fills in udata->oid */
-                    *oid_ptr = udata->oid;
+                    /* If there is more of the path to follow, open the target
+                     * group to continue from and retarget oid_ptr to its oid.
+                     * Otherwise retarget oid_ptr to udata->oid so
+                     * H5_daos_link_follow fills in udata->oid. */
+                    if (udata->crt_rem_path_len > 0) {
+                        if (0 != (ret = H5_daos_link_follow_open_grp(udata->grp, req, &next_grp,
+                                                                     &first_task, &dep_task)))
+                            D_GOTO_ERROR(H5E_LINK, H5E_CANTOPENOBJ, ret, "can't open group: %s",
+                                         H5_daos_err_to_string(ret));
+                        *oid_ptr = &next_grp->obj.oid;
+                    } /* end if */
+                    else
+                        *oid_ptr = udata->oid;
                 } /* end else */
 
                 if (target_grp) {
@@ -3827,42 +3981,33 @@ H5_daos_link_follow_task(tse_task_t *task)
             default:
                 D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "invalid link type");
         } /* end switch */
-    }     /* end if */
-    else {
-        if (udata->crt_missing_grp) {
-            /* Start internal H5 operation for target object open.  This will
-             * not be visible to the API, will not be added to an operation
-             * pool, and will be integrated into this function's task chain. */
-            if (NULL == (int_int_req = H5_daos_req_create(udata->grp->obj.item.file,
-                                                          "missing group create within link traversal", NULL,
-                                                          NULL, req, H5I_INVALID_HID)))
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't create DAOS request");
 
-            /* Create missing group and link to group */
-            if (NULL ==
-                (target_grp = (H5_daos_group_t *)H5_daos_group_create_helper(
-                     udata->grp->obj.item.file, FALSE, H5P_GROUP_CREATE_DEFAULT, H5P_GROUP_ACCESS_DEFAULT,
-                     udata->grp, udata->name, udata->name_len, FALSE, int_int_req, &first_task, &dep_task)))
-                D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create missing group");
+        /* Continue following (and possibly creating) the rest of the path
+         * from next_grp */
+        if (next_grp) {
+            daos_obj_id_t **oid_ptr = NULL;
 
-            /* Create task to finalize internal operation */
-            if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
-                                    NULL, NULL, int_int_req, &int_int_req->finalize_task) < 0)
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                             "can't create task to finalize internal operation");
+            assert(udata->crt_rem_path_len > 0);
+            if (H5_daos_link_follow_crt_path(next_grp, udata->crt_rem_path, udata->crt_rem_path_len, req,
+                                             &oid_ptr, &first_task, &dep_task) <= 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_TRAVERSE, -H5_DAOS_FOLLOW_ERROR, "can't follow path");
 
-            /* Schedule finalize task (or save it to be scheduled later),
-             * give it ownership of int_int_req, and update task pointers */
-            if (first_task) {
-                if (0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
-                    D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret,
-                                 "can't schedule task to finalize H5 operation: %s",
-                                 H5_daos_err_to_string(ret));
-            } /* end if */
-            else
-                first_task = int_int_req->finalize_task;
-            dep_task    = int_int_req->finalize_task;
-            int_int_req = NULL;
+            /* Retarget oid_ptr so the rest of the follow fills in udata->oid */
+            *oid_ptr = udata->oid;
+
+            /* Close next_grp */
+            if (H5_daos_group_close_real(next_grp) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
+            next_grp = NULL;
+        } /* end if */
+    }     /* end if */
+    else {
+        if (udata->crt_missing_grp) {
+            /* Create the missing group and the rest of the intermediate path
+             * below it */
+            if (0 != (ret = H5_daos_link_follow_crt_missing(udata, req, &target_grp, &first_task, &dep_task)))
+                D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, ret, "can't create missing groups: %s",
+                             H5_daos_err_to_string(ret));
 
             if (dep_task) {
                 /* target_grp may be incomplete at this point, save a pointer to
@@ -3934,11 +4079,6 @@ done:
         if (udata)
             udata->path_buf = DV_free(udata->path_buf);
 
-        /* Close internal request for target object create */
-        if (int_int_req && H5_daos_req_free_int(int_int_req) < 0)
-            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-        int_int_req = NULL;
-
         if (target_grp) {
             assert(req);
             if (H5_daos_group_close_real(target_grp) < 0)
@@ -3946,6 +4086,13 @@ done:
             target_grp = NULL;
         } /* end if */
 
+        if (next_grp) {
+            assert(req);
+            if (H5_daos_group_close_real(next_grp) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't close group");
+            next_grp = NULL;
+        } /* end if */
+
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except for
          * H5_daos_req_free_int, which updates req->status if it sees an error */
@@ -3975,6 +4122,17 @@ done:
         if (udata->link_val.type == H5L_TYPE_SOFT)
             DV_free(udata->link_val.target.soft);
 
+        /* Close any intermediate groups created before a failure */
+        if (udata->crt_grps) {
+            size_t i;
+
+            for (i = 0; i < udata->ncrt_grps; i++)
+                if (H5_daos_group_close_real(udata->crt_grps[i]) < 0)
+                    D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                                 "can't close intermediate group");
+            udata->crt_grps = DV_free(udata->crt_grps);
+        } /* end if */
+
         /* Free private data */
         assert(!udata->path_buf);
         udata = DV_free(udata);
@@ -3984,30 +4142,306 @@ done:
 
     /* Make sure we cleaned up */
     assert(!udata);
-    assert(!int_int_req);
     assert(!target_grp);
+    assert(!next_grp);
 
     D_FUNC_LEAVE;
 } /* end H5_daos_link_follow_task() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_link_follow
+ * Function:    H5_daos_link_path_next_comp
  *
- * Purpose:     Follows the link in grp identified with name, and returns
- *              in oid the oid of the target object.
+ * Purpose:     Extracts the next component from path, skipping empty and
+ *              "." components.  Advances path and path_len past the
+ *              component.
+ *
+ * Return:      TRUE if a component was found, FALSE if path had no more
+ *              components
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_link_path_next_comp(const char **path, size_t *path_len, const char **comp, size_t *comp_len)
+{
+    const char *next;
+
+    assert(path);
+    assert(path_len);
+    assert(comp);
+    assert(comp_len);
+
+    while (*path_len > 0) {
+        /* Find end of component */
+        if (NULL != (next = memchr(*path, '/', *path_len)))
+            *comp_len = (size_t)(next - *path);
+        else
+            *comp_len = *path_len;
+        *comp = *path;
+
+        /* Advance path past component and separator */
+        *path += *comp_len;
+        *path_len -= *comp_len;
+        if (*path_len > 0) {
+            (*path)++;
+            (*path_len)--;
+        } /* end if */
+
+        /* Return component unless it is empty or "." */
+        if (*comp_len > 0 && !(*comp_len == 1 && (*comp)[0] == '.'))
+            return TRUE;
+    } /* end while */
+
+    return FALSE;
+} /* end H5_daos_link_path_next_comp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_follow_open_grp
+ *
+ * Purpose:     Opens a group in the file containing grp, for continuing
+ *              a link follow from.  The caller must set (or retarget a
+ *              pointer to) the oid of *open_grp before the open tasks
+ *              execute.  The group must be closed with
+ *              H5_daos_group_close_real().
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_follow_open_grp(H5_daos_group_t *grp, H5_daos_req_t *req, H5_daos_group_t **open_grp,
+                             tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_group_t *new_grp     = NULL;
+    H5_daos_req_t   *int_int_req = NULL;
+    int              ret;
+    int              ret_value = 0;
+
+    assert(grp);
+    assert(req);
+    assert(open_grp);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Start internal H5 operation for group open.  This will not be visible
+     * to the API, will not be added to an operation pool, and will be
+     * integrated into this function's task chain. */
+    if (NULL == (int_int_req = H5_daos_req_create(grp->obj.item.file, "group open within link follow", NULL,
+                                                  NULL, req, H5I_INVALID_HID)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't create DAOS request");
+
+    /* Allocate the group object */
+    if (NULL == (new_grp = H5FL_CALLOC(H5_daos_group_t)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate DAOS group struct");
+
+    /* Open group */
+    if (0 != (ret = H5_daos_group_open_helper(grp->obj.item.file, new_grp, H5P_GROUP_ACCESS_DEFAULT, FALSE,
+                                              int_int_req, first_task, dep_task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTOPENOBJ, ret, "can't open group: %s", H5_daos_err_to_string(ret));
+
+    /* Create task to finalize internal operation */
+    if (H5_daos_create_task(H5_daos_h5op_finalize, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL, NULL,
+                            int_int_req, &int_int_req->finalize_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create task to finalize internal operation");
+
+    /* Schedule finalize task (or save it to be scheduled later),
+     * give it ownership of int_int_req, and update task pointers */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = int_int_req->finalize_task;
+    *dep_task   = int_int_req->finalize_task;
+    int_int_req = NULL;
+
+    /* Return group */
+    *open_grp = new_grp;
+    new_grp   = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0) {
+        if (new_grp && H5_daos_group_close_real(new_grp) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
+        new_grp = NULL;
+
+        if (int_int_req && H5_daos_req_free_int(int_int_req) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+        int_int_req = NULL;
+    } /* end if */
+
+    assert(!new_grp);
+    assert(!int_int_req);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_follow_open_grp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_follow_crt_missing
+ *
+ * Purpose:     Creates the missing group udata->name in udata->grp, and,
+ *              since a new group has no links, every group in
+ *              udata->crt_rem_path below it.  Each group's oid is
+ *              generated and its object opened in path order, since a
+ *              group's link can only be written once its parent is
+ *              open.  All metadata and link writes are then issued
+ *              together instead of one level at a time.  Returns the
+ *              last group created in *target_grp and keeps the others
+ *              open in udata->crt_grps until the follow ends.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_follow_crt_missing(H5_daos_link_follow_ud_t *udata, H5_daos_req_t *req,
+                                H5_daos_group_t **target_grp, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_req_t   *int_int_req = NULL;
+    H5_daos_group_t *parent_grp;
+    H5_daos_group_t *new_grp   = NULL;
+    tse_task_t     **crt_deps  = NULL;
+    size_t           ncrt_deps = 0;
+    tse_task_t      *open_dep  = *dep_task;
+    tse_task_t      *crt_metatask;
+    const char      *rem_path     = udata->crt_rem_path;
+    size_t           rem_path_len = udata->crt_rem_path_len;
+    const char      *name         = udata->name;
+    size_t           name_len     = udata->name_len;
+    const char      *comp;
+    size_t           comp_len;
+    size_t           ngrps = 1;
+    int              ret;
+    int              ret_value = 0;
+
+    assert(udata);
+    assert(req);
+    assert(target_grp);
+    assert(!udata->crt_grps);
+
+    /* Count groups to create */
+    {
+        const char *count_path     = rem_path;
+        size_t      count_path_len = rem_path_len;
+
+        while (H5_daos_link_path_next_comp(&count_path, &count_path_len, &comp, &comp_len))
+            ngrps++;
+    }
+
+    /* Allocate arrays for intermediate groups and create metatask deps */
+    if (NULL == (crt_deps = (tse_task_t **)DV_malloc(ngrps * sizeof(tse_task_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate array of group create tasks");
+    if (ngrps > 1 && NULL == (udata->crt_grps =
+                                  (H5_daos_group_t **)DV_malloc((ngrps - 1) * sizeof(H5_daos_group_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate array of intermediate groups");
+
+    /* Start internal H5 operation for target object create.  This will
+     * not be visible to the API, will not be added to an operation
+     * pool, and will be integrated into this function's task chain. */
+    if (NULL == (int_int_req = H5_daos_req_create(udata->grp->obj.item.file,
+                                                  "missing group create within link traversal", NULL, NULL,
+                                                  req, H5I_INVALID_HID)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't create DAOS request");
+
+    /* Create each missing group and link to it.  Each create only waits on
+     * its parent's object open, not on the parent's metadata writes. */
+    parent_grp = udata->grp;
+    do {
+        tse_task_t *crt_dep = open_dep;
+
+        if (NULL == (new_grp = (H5_daos_group_t *)H5_daos_group_create_helper(
+                         udata->grp->obj.item.file, FALSE, H5P_GROUP_CREATE_DEFAULT, H5P_GROUP_ACCESS_DEFAULT,
+                         parent_grp, name, name_len, FALSE, int_int_req, first_task, &crt_dep, &open_dep)))
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create missing group");
+        crt_deps[ncrt_deps++] = crt_dep;
+
+        /* Advance to next component, keeping this group open as its parent */
+        if (H5_daos_link_path_next_comp(&rem_path, &rem_path_len, &name, &name_len)) {
+            udata->crt_grps[udata->ncrt_grps++] = new_grp;
+            parent_grp                          = new_grp;
+            new_grp                             = NULL;
+        } /* end if */
+        else
+            break;
+    } while (1);
+    assert(ncrt_deps == ngrps);
+
+    /* Create metatask to complete when all groups are created */
+    if (H5_daos_create_task(H5_daos_metatask_autocomplete, (unsigned)ncrt_deps, crt_deps, NULL, NULL, NULL,
+                            &crt_metatask) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create meta task for missing group create");
+    assert(*first_task);
+    if (0 != (ret = tse_task_schedule(crt_metatask, false)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule meta task for missing group create: %s",
+                     H5_daos_err_to_string(ret));
+    *dep_task = crt_metatask;
+
+    /* Create task to finalize internal operation */
+    if (H5_daos_create_task(H5_daos_h5op_finalize, 1, dep_task, NULL, NULL, int_int_req,
+                            &int_int_req->finalize_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create task to finalize internal operation");
+
+    /* Schedule finalize task, give it ownership of int_int_req, and update
+     * task pointers */
+    if (0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule task to finalize H5 operation: %s",
+                     H5_daos_err_to_string(ret));
+    *dep_task   = int_int_req->finalize_task;
+    int_int_req = NULL;
+
+    /* Return last group created */
+    *target_grp = new_grp;
+    new_grp     = NULL;
+
+done:
+    /* Cleanup on failure.  Groups already in udata->crt_grps are closed by
+     * the caller. */
+    if (ret_value < 0) {
+        if (new_grp && H5_daos_group_close_real(new_grp) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
+        new_grp = NULL;
+
+        if (int_int_req && H5_daos_req_free_int(int_int_req) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+        int_int_req = NULL;
+    } /* end if */
+
+    DV_free(crt_deps);
+
+    assert(!new_grp);
+    assert(!int_int_req);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_follow_crt_missing() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_follow_int
+ *
+ * Purpose:     Internal version of H5_daos_link_follow().  If
+ *              crt_rem_path_len is greater than 0, crt_missing_grp must
+ *              be TRUE, and after following name the follow continues
+ *              through the groups in crt_rem_path, creating any that are
+ *              missing.  In this case the oid returned is that of the
+ *              last group in crt_rem_path.
  *
  * Return:      Success:        SUCCEED
  *              Failure:        FAIL
  *
- * Programmer:  Neil Fortner
- *              January, 2017
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_link_follow(H5_daos_group_t *grp, const char *name, size_t name_len, hbool_t crt_missing_grp,
-                    H5_daos_req_t *req, daos_obj_id_t ***oid_ptr, hbool_t *link_exists,
-                    tse_task_t **first_task, tse_task_t **dep_task)
+static herr_t
+H5_daos_link_follow_int(H5_daos_group_t *grp, const char *name, size_t name_len, hbool_t crt_missing_grp,
+                        const char *crt_rem_path, size_t crt_rem_path_len, H5_daos_req_t *req,
+                        daos_obj_id_t ***oid_ptr, hbool_t *link_exists, tse_task_t **first_task,
+                        tse_task_t **dep_task)
 {
     H5_daos_link_follow_ud_t *follow_udata = NULL;
     int                       ret;
@@ -4016,6 +4450,7 @@ H5_daos_link_follow(H5_daos_group_t *grp, const char *name, size_t name_len, hbo
     assert(grp);
     assert(name);
     assert(oid_ptr);
+    assert(!crt_rem_path_len || crt_missing_grp);
 
     /* Allocate private data for follow task */
     if (NULL == (follow_udata = (H5_daos_link_follow_ud_t *)DV_calloc(sizeof(H5_daos_link_follow_ud_t))))
@@ -4034,13 +4469,15 @@ H5_daos_link_follow(H5_daos_group_t *grp, const char *name, size_t name_len, hbo
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to follow link");
 
     /* Set private data for link follow */
-    follow_udata->req             = req;
-    follow_udata->grp             = grp;
-    follow_udata->name            = name;
-    follow_udata->name_len        = name_len;
-    follow_udata->crt_missing_grp = crt_missing_grp;
-    follow_udata->link_exists     = link_exists;
-    follow_udata->link_val.type   = H5L_TYPE_ERROR;
+    follow_udata->req              = req;
+    follow_udata->grp              = grp;
+    follow_udata->name             = name;
+    follow_udata->name_len         = name_len;
+    follow_udata->crt_missing_grp  = crt_missing_grp;
+    follow_udata->crt_rem_path     = crt_rem_path;
+    follow_udata->crt_rem_path_len = crt_rem_path_len;
+    follow_udata->link_exists      = link_exists;
+    follow_udata->link_val.type    = H5L_TYPE_ERROR;
 
     /* Set *oid_ptr so calling function can direct output of link follow task */
     *oid_ptr = &follow_udata->oid;
@@ -4069,8 +4506,84 @@ done:
     } /* end if */
 
     D_FUNC_LEAVE;
+} /* end H5_daos_link_follow_int() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_follow
+ *
+ * Purpose:     Follows the link in grp identified with name, and returns
+ *              in oid the oid of the target object.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *
+ * Programmer:  Neil Fortner
+ *              January, 2017
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_link_follow(H5_daos_group_t *grp, const char *name, size_t name_len, hbool_t crt_missing_grp,
+                    H5_daos_req_t *req, daos_obj_id_t ***oid_ptr, hbool_t *link_exists,
+                    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    return H5_daos_link_follow_int(grp, name, name_len, crt_missing_grp, NULL, 0, req, oid_ptr, link_exists,
+                                   first_task, dep_task);
 } /* end H5_daos_link_follow() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_follow_crt_path
+ *
+ * Purpose:     Follows the path of groups given by path (relative to
+ *              grp), creating any missing groups, and returns in oid the
+ *              oid of the last group in the path.  Once a missing group
+ *              is found, all groups below it are created at once instead
+ *              of being looked up and created one level at a time.  path
+ *              is not copied, so it must remain valid until the follow
+ *              completes.
+ *
+ * Return:      Success:        TRUE if the follow was started, FALSE if
+ *                              path only contains "." or empty
+ *                              components (*oid_ptr is not set)
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5_daos_link_follow_crt_path(H5_daos_group_t *grp, const char *path, size_t path_len, H5_daos_req_t *req,
+                             daos_obj_id_t ***oid_ptr, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    const char *name;
+    size_t      name_len;
+    htri_t      ret_value = TRUE;
+
+    assert(grp);
+    assert(path);
+
+    /* Get first component */
+    if (!H5_daos_link_path_next_comp(&path, &path_len, &name, &name_len))
+        D_GOTO_DONE(FALSE);
+
+    /* If only no-op components remain, there is nothing more to follow */
+    {
+        const char *rem_path     = path;
+        size_t      rem_path_len = path_len;
+        const char *comp;
+        size_t      comp_len;
+
+        if (!H5_daos_link_path_next_comp(&rem_path, &rem_path_len, &comp, &comp_len))
+            path_len = 0;
+    }
+
+    /* Follow first component, the follow task will continue with the rest */
+    if (H5_daos_link_follow_int(grp, name, name_len, TRUE, path, path_len, req, oid_ptr, NULL, first_task,
+                                dep_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_TRAVERSE, FAIL, "can't follow link to group");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_follow_crt_path() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_get_info_end_task
  *
@@ -4303,7 +4816,7 @@ H5_daos_link_get_info(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
             assert(task_udata->target_obj->item.type == H5I_GROUP);
             if (H5_daos_link_get_name_by_idx_alloc(
                     (H5_daos_group_t *)task_udata->target_obj, loc_params->loc_data.loc_by_idx.idx_type,
-                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
+                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL,
                     &task_udata->target_name, &task_udata->target_name_len, &task_udata->path_buf, NULL, req,
                     first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name");
@@ -4546,7 +5059,7 @@ H5_daos_link_get_val(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
             assert(task_udata->target_obj->item.type == H5I_GROUP);
             if (H5_daos_link_get_name_by_idx_alloc(
                     (H5_daos_group_t *)task_udata->target_obj, loc_params->loc_data.loc_by_idx.idx_type,
-                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
+                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL,
                     &task_udata->target_name, &task_udata->target_name_len, &task_udata->path_buf, NULL, req,
                     first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link name");
@@ -4884,6 +5397,15 @@ done:
  *              name.  Initiates operation on each link and reissues list
  *              operation if appropriate.
  *
+ *              The link info for every link in the batch is fetched
+ *              concurrently.  Normally each link's operation still waits
+ *              on the previous one so callbacks are made in order.  For
+ *              unordered visits, each operation only waits on the one
+ *              H5_DAOS_VISIT_WINDOW links before it, so up to that many
+ *              links (and the subtrees below them) are processed at once.
+ *              A barrier task then holds the next list operation until the
+ *              whole batch is done, since it reuses the key buffer.
+ *
  * Return:      Success:        0
  *              Failure:        Error code
  *
@@ -4898,9 +5420,11 @@ H5_daos_link_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
     H5_daos_iter_ud_t         *udata         = NULL;
     H5_daos_link_iter_op_ud_t *iter_op_udata = NULL;
     H5VL_loc_params_t          sub_loc_params;
-    H5_daos_req_t             *req        = NULL;
-    tse_task_t                *first_task = NULL;
-    tse_task_t                *dep_task   = NULL;
+    H5_daos_req_t             *req                              = NULL;
+    tse_task_t                *op_window[H5_DAOS_VISIT_WINDOW] = {NULL};
+    tse_task_t                *barrier_task                     = NULL;
+    tse_task_t                *first_task                       = NULL;
+    tse_task_t                *dep_task                         = NULL;
     int                        ret;
     int                        ret_value = 0;
 
@@ -4945,13 +5469,26 @@ H5_daos_link_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         } /* end if */
         else if (task->dt_result == 0) {
             uint32_t i;
-            char    *p = udata->sg_iov.iov_buf;
+            size_t   nops = 0;
+            char    *p    = udata->sg_iov.iov_buf;
+
+            /* For unordered visits, create barrier task to wait on all ops in
+             * this batch */
+            if (udata->iter_data->unordered &&
+                H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &barrier_task) <
+                    0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create barrier task for link iteration");
 
             /* Loop over returned dkeys */
             for (i = 0; i < udata->nr; i++) {
                 /* Check if this key represents a link */
                 if (p[0] != '/') {
-                    char tmp_char;
+                    tse_task_t *info_first = NULL;
+                    tse_task_t *info_dep   = NULL;
+                    tse_task_t *op_deps[2];
+                    unsigned    op_ndeps = 0;
+                    char        tmp_char;
 
                     /* Allocate iter op udata */
                     if (NULL == (iter_op_udata = (H5_daos_link_iter_op_ud_t *)DV_calloc(
@@ -4966,24 +5503,50 @@ H5_daos_link_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                     tmp_char                    = p[udata->kds[i].kd_key_len];
                     p[udata->kds[i].kd_key_len] = '\0';
 
-                    /* Retrieve link's info and value */
+                    /* Retrieve link's info and value.  This does not depend
+                     * on the previous links so start it right away. */
                     sub_loc_params.obj_type                     = udata->target_obj->item.type;
                     sub_loc_params.type                         = H5VL_OBJECT_BY_NAME;
                     sub_loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
                     sub_loc_params.loc_data.loc_by_name.name    = p;
                     if (0 != (ret = H5_daos_link_get_info(&udata->target_obj->item, &sub_loc_params,
                                                           &iter_op_udata->linfo, &iter_op_udata->link_val,
-                                                          req, &first_task, &dep_task)))
+                                                          req, &info_first, &info_dep)))
                         D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, ret, "can't get link info: %s",
                                      H5_daos_err_to_string(ret));
+                    if (info_first && 0 != (ret = tse_task_schedule(info_first, false)))
+                        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule task to get link info: %s",
+                                     H5_daos_err_to_string(ret));
+                    if (info_dep)
+                        op_deps[op_ndeps++] = info_dep;
+
+                    /* The op must also wait on the previous op, or on the op
+                     * H5_DAOS_VISIT_WINDOW links back for unordered visits */
+                    if (udata->iter_data->unordered) {
+                        if (op_window[nops % H5_DAOS_VISIT_WINDOW])
+                            op_deps[op_ndeps++] = op_window[nops % H5_DAOS_VISIT_WINDOW];
+                    } /* end if */
+                    else if (dep_task)
+                        op_deps[op_ndeps++] = dep_task;
 
                     /* Create task for iter op */
-                    if (H5_daos_create_task(H5_daos_link_iterate_op_task, dep_task ? 1 : 0,
-                                            dep_task ? &dep_task : NULL, NULL, NULL, iter_op_udata,
+                    if (H5_daos_create_task(H5_daos_link_iterate_op_task, op_ndeps,
+                                            op_ndeps > 0 ? op_deps : NULL, NULL, NULL, iter_op_udata,
                                             &iter_op_udata->op_task) < 0)
                         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
                                      "can't create task for iteration op");
 
+                    /* For unordered visits, make the barrier task wait on
+                     * this op */
+                    if (barrier_task) {
+                        if (0 != (ret = tse_task_register_deps(barrier_task, 1, &iter_op_udata->op_task)))
+                            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                                         "can't create dependencies for link iteration barrier task: %s",
+                                         H5_daos_err_to_string(ret));
+                        op_window[nops % H5_DAOS_VISIT_WINDOW] = iter_op_udata->op_task;
+                    } /* end if */
+                    nops++;
+
                     /* Schedule iter op (or save it to be scheduled later) and
                      * transfer ownership of iter_op_udata */
                     if (first_task) {
@@ -4994,7 +5557,8 @@ H5_daos_link_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                     } /* end if */
                     else
                         first_task = iter_op_udata->op_task;
-                    dep_task      = iter_op_udata->op_task;
+                    if (!udata->iter_data->unordered)
+                        dep_task = iter_op_udata->op_task;
                     iter_op_udata = NULL;
 
                     /* Replace null terminator */
@@ -5005,7 +5569,19 @@ H5_daos_link_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                 p += udata->kds[i].kd_key_len;
             } /* end for */
 
-            /* Continue iteration if we're not done */
+            /* Schedule barrier task (unordered visits only).  Everything after
+             * this batch, including the next list operation which reuses the
+             * key buffer, waits on it. */
+            if (barrier_task) {
+                if (0 != (ret = tse_task_schedule(barrier_task, false)))
+                    D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                                 "can't schedule barrier task for link iteration: %s",
+                                 H5_daos_err_to_string(ret));
+                dep_task     = barrier_task;
+                barrier_task = NULL;
+            } /* end if */
+
+            /* Continue iteration if we're not done */
             if (!daos_anchor_is_eof(&udata->anchor) && (req->status == -H5_DAOS_INCOMPLETE)) {
                 if (0 !=
                     (ret = H5_daos_list_key_start(udata, DAOS_OPC_OBJ_LIST_DKEY,
@@ -5017,6 +5593,16 @@ H5_daos_link_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
     }         /* end else */
 
 done:
+    /* If we failed before scheduling the barrier task, schedule it now so the
+     * iteration metatask still waits on the ops already created */
+    if (barrier_task) {
+        if (0 != (ret = tse_task_schedule(barrier_task, false)))
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule barrier task for link iteration: %s",
+                         H5_daos_err_to_string(ret));
+        dep_task     = barrier_task;
+        barrier_task = NULL;
+    } /* end if */
+
     /* If we still own udata then iteration is complete.  Register dependency
      * for metatask and schedule it. */
     if (udata) {
@@ -5117,8 +5703,27 @@ H5_daos_link_iterate_op_task(tse_task_t *task)
     if (H5L_TYPE_SOFT == udata->link_val.type)
         udata->link_val.target.soft = (char *)DV_free(udata->link_val.target.soft);
 
+    /* For unordered visits, other ops at this level may run before this one
+     * completes, so build this link's path in a private buffer instead of the
+     * shared key or recursive link path buffers.  Leave room to append a '/'
+     * if we recurse into this link. */
+    if (udata->iter_ud->iter_data->unordered) {
+        size_t prefix_len = udata->iter_ud->path_prefix ? strlen(udata->iter_ud->path_prefix) : 0;
+
+        if (NULL == (udata->path_buf = DV_malloc(prefix_len + udata->link_path_len + 2)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate link path buffer");
+        if (prefix_len)
+            memcpy(udata->path_buf, udata->iter_ud->path_prefix, prefix_len);
+        memcpy(&udata->path_buf[prefix_len], udata->link_path, udata->link_path_len);
+        udata->path_buf[prefix_len + udata->link_path_len] = '\0';
+
+        link_path = udata->path_buf;
+
+        /* Point udata->link_path at the link name within the copy */
+        udata->link_path = &udata->path_buf[prefix_len];
+    } /* end if */
     /* If doing recursive iteration, add the current link name to the end of the recursive link path */
-    if (udata->iter_ud->iter_data->is_recursive) {
+    else if (udata->iter_ud->iter_data->is_recursive) {
         size_t cur_link_path_len = strlen(udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path);
 
         /*
@@ -5263,30 +5868,40 @@ H5_daos_link_iterate_op_task(tse_task_t *task)
             dep_task    = int_int_req->finalize_task;
             int_int_req = NULL;
 
-            /* Add a trailing slash to the link path buffer to denote that this link points to a group */
-            cur_link_path_len = strlen(udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path);
-            while (cur_link_path_len + 2 >
-                   udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path_nalloc) {
-                char *tmp_realloc;
-
-                udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path_nalloc *= 2;
-                if (NULL == (tmp_realloc = DV_realloc(
-                                 udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path,
-                                 udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path_nalloc)))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
-                                 "failed to reallocate link path buffer");
+            if (udata->iter_ud->iter_data->unordered) {
+                /* Add a trailing slash to this link's private path, which
+                 * becomes the path prefix for the subgroup's links (space was
+                 * reserved when it was allocated) */
+                cur_link_path_len                      = strlen(udata->path_buf);
+                udata->path_buf[cur_link_path_len]     = '/';
+                udata->path_buf[cur_link_path_len + 1] = '\0';
+            } /* end if */
+            else {
+                /* Add a trailing slash to the link path buffer to denote that this link points to a group */
+                cur_link_path_len = strlen(udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path);
+                while (cur_link_path_len + 2 >
+                       udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path_nalloc) {
+                    char *tmp_realloc;
+
+                    udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path_nalloc *= 2;
+                    if (NULL == (tmp_realloc = DV_realloc(
+                                     udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path,
+                                     udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path_nalloc)))
+                        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                                     "failed to reallocate link path buffer");
 
-                udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path = tmp_realloc;
-            } /* end while */
+                    udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path = tmp_realloc;
+                } /* end while */
 
-            udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path[cur_link_path_len]     = '/';
-            udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path[cur_link_path_len + 1] = '\0';
+                udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path[cur_link_path_len]     = '/';
+                udata->iter_ud->iter_data->u.link_iter_data.recursive_link_path[cur_link_path_len + 1] = '\0';
+            } /* end else */
 
             /* Recurse on this group */
             if (0 != (ret = H5_daos_list_key_init(udata->iter_ud->iter_data, &subgroup->obj, NULL,
                                                   DAOS_OPC_OBJ_LIST_DKEY, H5_daos_link_iterate_list_comp_cb,
-                                                  FALSE, H5_DAOS_ITER_LEN, H5_DAOS_ITER_SIZE_INIT,
-                                                  &first_task, &dep_task)))
+                                                  FALSE, udata->path_buf, H5_DAOS_ITER_LEN,
+                                                  H5_DAOS_ITER_SIZE_INIT, &first_task, &dep_task)))
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't start link iteration: %s",
                              H5_daos_err_to_string(ret));
 
@@ -5296,7 +5911,8 @@ H5_daos_link_iterate_op_task(tse_task_t *task)
         } /* end if */
 
         /* Reset udata->link_path to state before adding null terminator */
-        udata->link_path[udata->link_path_len] = link_path_replace_char;
+        if (!udata->path_buf)
+            udata->link_path[udata->link_path_len] = link_path_replace_char;
     } /* end if */
 
 done:
@@ -5368,6 +5984,7 @@ done:
         tse_task_complete(task, ret_value);
 
         /* Free private data */
+        DV_free(udata->path_buf);
         udata = DV_free(udata);
     } /* end if */
     else
@@ -5434,6 +6051,7 @@ H5_daos_link_iter_op_end(tse_task_t *task)
     tse_task_complete(udata->op_task, 0);
 
     /* Free udata */
+    DV_free(udata->path_buf);
     DV_free(udata);
 
 done:
@@ -5512,7 +6130,7 @@ H5_daos_link_iterate_by_name_order(H5_daos_group_t *target_grp, H5_daos_iter_dat
 
     /* Start iteration */
     if (0 != (ret = H5_daos_list_key_init(iter_data, &target_grp->obj, NULL, DAOS_OPC_OBJ_LIST_DKEY,
-                                          H5_daos_link_iterate_list_comp_cb, TRUE, H5_DAOS_ITER_LEN,
+                                          H5_daos_link_iterate_list_comp_cb, TRUE, NULL, H5_DAOS_ITER_LEN,
                                           H5_DAOS_ITER_SIZE_INIT, first_task, dep_task)))
         D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't start link iteration: %s",
                      H5_daos_err_to_string(ret));
@@ -5631,8 +6249,9 @@ H5_daos_link_ibco_end_task(tse_task_t *task)
     if (H5_daos_group_close_real(udata->target_grp) < 0)
         D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
 
-    /* Free name buffer */
+    /* Free name buffer and creation order index holes */
     udata->name_buf = DV_free(udata->name_buf);
+    DV_free(udata->corder_info.holes);
 
     /* Free udata */
     udata = DV_free(udata);
@@ -5866,7 +6485,7 @@ H5_daos_link_ibco_op_task(tse_task_t *task)
     }     /* end if */
 
     /* Check if we should schedule another iteration */
-    if (++udata->crt_idx < udata->grp_nlinks) {
+    if (++udata->crt_idx < (hsize_t)udata->corder_info.nobjs) {
         tse_task_t *next_task = NULL;
 
         /* Create task to continue this operation */
@@ -6148,7 +6767,7 @@ H5_daos_link_ibco_task(tse_task_t *task)
              * iteration by name order don't check this field */
             if (0 != (ret = H5_daos_list_key_init(udata->iter_data, &udata->target_grp->obj, NULL,
                                                   DAOS_OPC_OBJ_LIST_DKEY, H5_daos_link_iterate_list_comp_cb,
-                                                  FALSE, H5_DAOS_ITER_LEN, H5_DAOS_ITER_SIZE_INIT,
+                                                  FALSE, NULL, H5_DAOS_ITER_LEN, H5_DAOS_ITER_SIZE_INIT,
                                                   &first_task, &dep_task)))
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't fall back to iteration by name order: %s",
                              H5_daos_err_to_string(ret));
@@ -6181,14 +6800,15 @@ H5_daos_link_ibco_task(tse_task_t *task)
     } /* end if */
 
     /* Make sure this index is within the bounds */
-    if (udata->crt_idx < udata->grp_nlinks) {
+    if (udata->crt_idx < (hsize_t)udata->corder_info.nobjs) {
         tse_task_t *task2_task = NULL;
 
-        /* Get link name */
+        /* Get link name, using the creation order index info retrieved at
+         * the start of the iteration */
         if (H5_daos_link_get_name_by_idx_alloc(
                 udata->target_grp, H5_INDEX_CRT_ORDER, udata->iter_data->iter_order, (uint64_t)udata->crt_idx,
-                &udata->link_name, &udata->link_name_len, &udata->name_buf, &udata->name_buf_size,
-                udata->iter_data->req, &first_task, &dep_task) < 0)
+                &udata->corder_info, &udata->link_name, &udata->link_name_len, &udata->name_buf,
+                &udata->name_buf_size, udata->iter_data->req, &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name");
 
         /* Create task to continue this operation */
@@ -6211,7 +6831,7 @@ H5_daos_link_ibco_task(tse_task_t *task)
         udata    = NULL;
     } /* end if */
     else
-        assert(udata->grp_nlinks == 0);
+        assert(udata->corder_info.nobjs == 0);
 
 done:
     if (udata) {
@@ -6303,10 +6923,13 @@ H5_daos_link_ibco_helper(H5_daos_group_t *target_grp, H5_daos_iter_data_t *iter_
     else
         ibco_udata->iter_data = iter_data;
 
-    /* Retrieve the number of links in the group */
-    if (H5_daos_group_get_num_links(target_grp, &ibco_udata->grp_nlinks, iter_data->req, first_task,
-                                    dep_task) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_DAOS_GET_ERROR, "can't get number of links in group");
+    /* Retrieve the number of links in the group and the holes in its creation
+     * order index once for the whole iteration, so looking up each link's
+     * name doesn't need to retrieve them again */
+    if (H5_daos_object_get_corder_info(&target_grp->obj, FALSE, TRUE, &ibco_udata->corder_info,
+                                       iter_data->req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get link creation order index info");
 
     /* Create metatask for this iteration - body function will free udata.  Will
      * be scheduled later when iteration is complete. */
@@ -6563,7 +7186,7 @@ H5_daos_link_delete(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params, h
             assert(delete_udata->target_obj->item.type == H5I_GROUP);
             if (H5_daos_link_get_name_by_idx_alloc(
                     (H5_daos_group_t *)delete_udata->target_obj, loc_params->loc_data.loc_by_idx.idx_type,
-                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
+                    loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL,
                     &delete_udata->target_link_name, &delete_udata->target_link_name_len,
                     &delete_udata->path_buf, NULL, req, first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link name");
@@ -6861,6 +7484,9 @@ H5_daos_link_delete_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         udata->req->failed_task = "link deletion task";
     } /* end if */
 
+    /* Invalidate cached link name lists */
+    udata->req->file->link_mod_gen++;
+
 done:
     /* Return task to task list */
     if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
@@ -6911,11 +7537,12 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
                            tse_task_t **dep_task)
 {
     H5_daos_link_delete_corder_ud_t *corder_delete_ud = NULL;
+    tse_task_t                      *slot_task        = NULL;
     tse_task_t                      *update_task      = NULL;
+    tse_task_t                      *iter_task        = NULL;
     tse_task_t                      *delete_task      = NULL;
     tse_task_t                      *bookkeep_task    = NULL;
     tse_task_t                      *finish_task      = NULL;
-    hid_t                            target_grp_id    = H5I_INVALID_HID;
     int                              ret;
     herr_t                           ret_value = SUCCEED;
 
@@ -6939,9 +7566,41 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
     corder_delete_ud->index_data.iods    = NULL;
     corder_delete_ud->index_data.sg_iovs = NULL;
 
-    /* Retrieve the current number of links in the group */
-    if (H5_daos_group_get_num_links(target_grp, &corder_delete_ud->grp_nlinks, req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get number of links in group");
+    /* Retrieve the current number of links in the group, along with the
+     * information needed to determine if its creation order index is sparse */
+    if (H5_daos_object_get_corder_info(&target_grp->obj, FALSE, TRUE, &corder_delete_ud->corder_info, req,
+                                       first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link creation order index info");
+
+    /* Retrieve the permanent creation order value of the link.  If the index
+     * is sparse the slot holding the link in the index is derived from it. */
+    if (H5_daos_link_get_crt_order_by_name(target_grp, target_link_name, &corder_delete_ud->link_corder, req,
+                                           first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link's creation order value");
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&corder_delete_ud->dkey, H5_daos_link_corder_key_g,
+                       H5_daos_link_corder_key_size_g);
+
+    /* Create task to look up the slot of the link if it was moved by a
+     * compaction of a sparse index */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_link_delete_corder_slot_prep_cb,
+                                 H5_daos_link_delete_corder_slot_comp_cb, corder_delete_ud, &slot_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                     "can't create task to look up link in creation order index");
+
+    /* Schedule slot lookup task */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(slot_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                         "can't schedule task to look up link in creation order index: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = slot_task;
+
+    *dep_task = slot_task;
 
     /* Create task to update the "number of links" key for the group, accounting for the removed link */
     if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
@@ -6961,45 +7620,27 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
 
     *dep_task = update_task;
 
-    /* If originally iterating by name order, create a task to iterate over links
-     * by creation order and match the target link name to a creation order index
-     * value.
+    /* Create task to resolve the index value of the link by iterating over
+     * links by creation order, if necessary.  This is only needed when
+     * deleting by name from a compacted (non-sparse) index.
      */
-    if (H5VL_OBJECT_BY_NAME == loc_params->type) {
-        H5_daos_iter_data_t iter_data;
-
-        /* Register ID for group for link iteration */
-        if ((target_grp_id = H5VLwrap_register(target_grp, H5I_GROUP)) < 0)
-            D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
-        target_grp->obj.item.rc++;
-
-        /* Initialize iteration data */
-        corder_delete_ud->name_order_iter_cb_ud.target_link_name = corder_delete_ud->target_link_name;
-        corder_delete_ud->name_order_iter_cb_ud.link_idx_out     = &corder_delete_ud->delete_idx;
-        H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_LINK, H5_INDEX_CRT_ORDER, H5_ITER_INC, FALSE,
-                               NULL, target_grp_id, &corder_delete_ud->name_order_iter_cb_ud, NULL, req);
-        iter_data.u.link_iter_data.u.link_iter_op = H5_daos_link_delete_corder_name_cb;
+    if (H5_daos_create_task(H5_daos_link_delete_corder_iter_task, *dep_task ? 1 : 0,
+                            *dep_task ? dep_task : NULL, NULL, NULL, corder_delete_ud, &iter_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                     "can't create task to find link in creation order index");
 
-        /*
-         * TODO: Currently, deleting a link by name means that we need to iterate through
-         *       the link creation order index until we find the value corresponding to
-         *       the link being deleted. This is especially important because the deletion
-         *       of links might cause the target link's index value to shift downwards.
-         *
-         *       Once iteration restart is supported for link iteration, performance can
-         *       be improved here by first looking up the original, permanent creation order
-         *       value of the link using the 'link name -> creation order' mapping and then
-         *       using that value as the starting point for iteration. In this case, the
-         *       iteration order MUST be switched to H5_ITER_DEC or the key will not be
-         *       found by the iteration.
-         */
-        if (H5_daos_link_iterate(target_grp, &iter_data, first_task, dep_task) < 0)
-            D_GOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "link iteration failed");
+    /* Schedule index resolution task */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(iter_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                         "can't schedule task to find link in creation order index: %s",
+                         H5_daos_err_to_string(ret));
     } /* end if */
-
-    /* Set up dkey */
-    daos_const_iov_set((d_const_iov_t *)&corder_delete_ud->dkey, H5_daos_link_corder_key_g,
-                       H5_daos_link_corder_key_size_g);
+    else
+        *first_task = iter_task;
+    req->rc++;
+    target_grp->obj.item.rc++;
+    *dep_task = iter_task;
 
     /* Create task to remove link creation order akeys from group */
     if (H5_daos_create_daos_task(DAOS_OPC_OBJ_PUNCH_AKEYS, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
@@ -7065,16 +7706,15 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
     corder_delete_ud = NULL;
 
 done:
-    /* Close group since iteration task will now own it.  No need to mark as
-     * nonblocking close since the ID rc shouldn't drop to 0. */
-    if ((target_grp_id >= 0) && (H5Idec_ref(target_grp_id) < 0))
-        D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close group ID");
-
     if (corder_delete_ud) {
         assert(ret_value < 0);
 
+        if (slot_task)
+            tse_task_complete(slot_task, -H5_DAOS_SETUP_ERROR);
         if (update_task)
             tse_task_complete(update_task, -H5_DAOS_SETUP_ERROR);
+        if (iter_task)
+            tse_task_complete(iter_task, -H5_DAOS_SETUP_ERROR);
         if (delete_task)
             tse_task_complete(delete_task, -H5_DAOS_SETUP_ERROR);
         if (bookkeep_task)
@@ -7113,6 +7753,145 @@ H5_daos_link_delete_corder_name_cb(hid_t H5VL_DAOS_UNUSED group, const char *nam
     return 0;
 } /* end H5_daos_link_delete_corder_name_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_delete_corder_slot_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to look up
+ *              the slot holding a link being deleted from a sparse link
+ *              creation order index.  Links created after the index was
+ *              last compacted sit in the slot derived from their creation
+ *              order value, so the lookup is only needed for links moved
+ *              by the last compaction, and this task is skipped otherwise.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_delete_corder_slot_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_delete_corder_ud_t *udata;
+    daos_obj_rw_t                   *fetch_args;
+    uint8_t                         *p;
+    int                              ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order index slot lookup task");
+
+    assert(udata->req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    assert(udata->target_grp);
+
+    /* Skip the lookup if the link was not moved by a compaction */
+    if (!udata->corder_info.sparse || udata->link_corder >= udata->corder_info.compact_mark) {
+        tse_task_complete(task, 0);
+        D_GOTO_DONE(0);
+    } /* end if */
+    udata->moved = TRUE;
+
+    /* Set up akey which maps the link's creation order value -> slot */
+    p = udata->slot_rec_key_buf;
+    UINT64ENCODE(p, udata->link_corder);
+    *p = H5_DAOS_LINK_SLOT_REC_TAG;
+
+    /* Set up iod */
+    daos_iov_set(&udata->slot_data.iod.iod_name, (void *)udata->slot_rec_key_buf,
+                 sizeof(udata->slot_rec_key_buf));
+    udata->slot_data.iod.iod_nr   = 1u;
+    udata->slot_data.iod.iod_size = (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+    udata->slot_data.iod.iod_type = DAOS_IOD_SINGLE;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->slot_data.sg_iov, udata->slot_data.slot_buf,
+                 (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+    udata->slot_data.sgl.sg_nr     = 1;
+    udata->slot_data.sgl.sg_nr_out = 0;
+    udata->slot_data.sgl.sg_iovs   = &udata->slot_data.sg_iov;
+
+    /* Set task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for link creation order index slot lookup task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh    = udata->target_grp->obj.obj_oh;
+    fetch_args->th    = DAOS_TX_NONE;
+    fetch_args->flags = DAOS_COND_AKEY_FETCH;
+    fetch_args->dkey  = &udata->dkey;
+    fetch_args->nr    = 1;
+    fetch_args->iods  = &udata->slot_data.iod;
+    fetch_args->sgls  = &udata->slot_data.sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_delete_corder_slot_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_delete_corder_slot_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to look
+ *              up the slot holding a link being deleted from a sparse
+ *              link creation order index.  Currently checks for a failed
+ *              task then decodes the slot.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_delete_corder_slot_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_delete_corder_ud_t *udata;
+    uint8_t                         *p;
+    int                              ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order index slot lookup task");
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "link creation order index slot lookup task";
+    } /* end if */
+    else if (task->dt_result == 0 && udata->moved) {
+        if (udata->slot_data.iod.iod_size != (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE)
+            D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                         "invalid size of link creation order index slot record");
+
+        /* Decode the link's slot */
+        p = udata->slot_data.slot_buf;
+        UINT64DECODE(p, udata->delete_idx);
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in this function */
+    if (udata && ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "link creation order index slot lookup completion callback";
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_delete_corder_slot_comp_cb() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_delete_corder_unl_prep_cb
  *
@@ -7146,6 +7925,48 @@ H5_daos_link_delete_corder_unl_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *
     assert(udata->req->file);
     assert(udata->target_grp);
 
+    if (udata->corder_info.nobjs == 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "group's link creation order index is empty");
+    udata->grp_nlinks = (hsize_t)udata->corder_info.nobjs;
+
+    /* The index is sparse if it has a format record.  Otherwise it is an
+     * index from an older file, which must continue to be shifted down on
+     * deletion. */
+    udata->sparse = udata->corder_info.sparse;
+
+    /* Determine the index slot of the link to delete now if possible.  For a
+     * sparse index this is derived from the link's creation order value, or
+     * was looked up by the previous task if the link was moved by a
+     * compaction.  For an older index deleted by name the slot will be
+     * found by iteration in a later task. */
+    if (udata->sparse) {
+        if (!udata->moved) {
+            if (udata->link_corder < udata->corder_info.slot_base)
+                D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                             "link creation order value is below the index's slot base");
+            udata->delete_idx = udata->link_corder - udata->corder_info.slot_base;
+        } /* end if */
+
+        /* Compact the index once too many of its slots are holes, otherwise
+         * add the slot to the index's holes */
+        udata->compact = H5_daos_corder_compact_needed(&udata->corder_info, udata->corder_info.nobjs - 1);
+        if (!udata->compact) {
+            if (H5_daos_corder_holes_insert(&udata->corder_info, udata->delete_idx,
+                                            &udata->unl_data.holes_update) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINSERT, -H5_DAOS_H5_ENCODE_ERROR,
+                             "can't add hole to link creation order index");
+            p = udata->unl_data.nholes_new_buf;
+            UINT64ENCODE(p, udata->unl_data.holes_update.nholes);
+        } /* end if */
+    } /* end if */
+    else if (H5VL_OBJECT_BY_IDX == udata->loc_params->type) {
+        /* DSINC - no check for safe cast here */
+        udata->delete_idx = (H5_ITER_DEC == udata->loc_params->loc_data.loc_by_idx.order)
+                                ? udata->corder_info.nobjs - 1 -
+                                      (uint64_t)udata->loc_params->loc_data.loc_by_idx.n
+                                : (uint64_t)udata->loc_params->loc_data.loc_by_idx.n;
+    } /* end if */
+
     /* Decrement number of links to account for removed link */
     udata->grp_nlinks--;
 
@@ -7180,9 +8001,43 @@ H5_daos_link_delete_corder_unl_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *
 
     udata->unl_data.unl_ud.nr = 1u;
 
+    /* Write the changed hole records for a sparse index that isn't being
+     * compacted.  The hole akeys may not exist yet so the update can't be
+     * conditional. */
+    if (udata->sparse && !udata->compact) {
+        daos_const_iov_set((d_const_iov_t *)&udata->unl_data.unl_ud.iod[1].iod_name,
+                           H5_daos_nlink_corder_holes_key_g, H5_daos_nlink_corder_holes_key_size_g);
+        udata->unl_data.unl_ud.iod[1].iod_nr   = 1u;
+        udata->unl_data.unl_ud.iod[1].iod_size = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+        udata->unl_data.unl_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
+
+        daos_const_iov_set((d_const_iov_t *)&udata->unl_data.unl_ud.iod[2].iod_name,
+                           H5_daos_link_corder_holes_key_g, H5_daos_link_corder_holes_key_size_g);
+        udata->unl_data.unl_ud.iod[2].iod_nr    = udata->unl_data.holes_update.nrecs;
+        udata->unl_data.unl_ud.iod[2].iod_size  = (daos_size_t)H5_DAOS_ENCODED_CORDER_HOLE_SIZE;
+        udata->unl_data.unl_ud.iod[2].iod_recxs = udata->unl_data.holes_update.recxs;
+        udata->unl_data.unl_ud.iod[2].iod_type  = DAOS_IOD_ARRAY;
+
+        daos_iov_set(&udata->unl_data.unl_ud.sg_iov[1], udata->unl_data.nholes_new_buf,
+                     (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+        udata->unl_data.unl_ud.sgl[1].sg_nr     = 1;
+        udata->unl_data.unl_ud.sgl[1].sg_nr_out = 0;
+        udata->unl_data.unl_ud.sgl[1].sg_iovs   = &udata->unl_data.unl_ud.sg_iov[1];
+        udata->unl_data.unl_ud.free_sg_iov[1]   = FALSE;
+
+        daos_iov_set(&udata->unl_data.unl_ud.sg_iov[2], udata->unl_data.holes_update.recs_buf,
+                     (daos_size_t)udata->unl_data.holes_update.nrecs * H5_DAOS_ENCODED_CORDER_HOLE_SIZE);
+        udata->unl_data.unl_ud.sgl[2].sg_nr     = 1;
+        udata->unl_data.unl_ud.sgl[2].sg_nr_out = 0;
+        udata->unl_data.unl_ud.sgl[2].sg_iovs   = &udata->unl_data.unl_ud.sg_iov[2];
+        udata->unl_data.unl_ud.free_sg_iov[2]   = FALSE;
+
+        udata->unl_data.unl_ud.nr = 3u;
+    } /* end if */
+
     udata->unl_data.unl_ud.task_name = "group number of links update task";
 
-    udata->unl_data.unl_ud.flags = DAOS_COND_AKEY_UPDATE;
+    udata->unl_data.unl_ud.flags = (udata->sparse && !udata->compact) ? 0 : DAOS_COND_AKEY_UPDATE;
 
     /* Set update task arguments */
     if (NULL == (update_args = daos_task_get_args(task)))
@@ -7204,6 +8059,129 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_link_delete_corder_unl_prep_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_delete_corder_iter_task
+ *
+ * Purpose:     Asynchronous task to find the index value of a link being
+ *              deleted by name from a link creation order index in the
+ *              older format. Iterates over links by creation order until
+ *              the target link name is found. For sparse indices, or when
+ *              deleting by index, the index value is already known and
+ *              this task does nothing.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_delete_corder_iter_task(tse_task_t *task)
+{
+    H5_daos_link_delete_corder_ud_t *udata;
+    H5_daos_iter_data_t              iter_data;
+    tse_task_t                      *metatask      = NULL;
+    tse_task_t                      *first_task    = NULL;
+    tse_task_t                      *dep_task      = NULL;
+    hid_t                            target_grp_id = H5I_INVALID_HID;
+    int                              ret;
+    int                              ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for task to find link in creation order index");
+
+    assert(udata->req);
+
+    /* Check for previous errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    /* Nothing to do unless deleting by name from an older index */
+    if (udata->sparse || H5VL_OBJECT_BY_NAME != udata->loc_params->type)
+        D_GOTO_DONE(0);
+
+    /* Register ID for group for link iteration */
+    if ((target_grp_id = H5VLwrap_register(udata->target_grp, H5I_GROUP)) < 0)
+        D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, -H5_DAOS_SETUP_ERROR, "unable to atomize object handle");
+    udata->target_grp->obj.item.rc++;
+
+    /* Initialize iteration data */
+    udata->name_order_iter_cb_ud.target_link_name = udata->target_link_name;
+    udata->name_order_iter_cb_ud.link_idx_out     = &udata->delete_idx;
+    H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_LINK, H5_INDEX_CRT_ORDER, H5_ITER_INC, FALSE, NULL,
+                           target_grp_id, &udata->name_order_iter_cb_ud, NULL, udata->req);
+    iter_data.u.link_iter_data.u.link_iter_op = H5_daos_link_delete_corder_name_cb;
+
+    /*
+     * Deleting a link by name from an older index means that we need to
+     * iterate through the link creation order index until we find the value
+     * corresponding to the link being deleted, since the deletion of links
+     * might have caused the target link's index value to shift downwards.
+     */
+    if (H5_daos_link_iterate(udata->target_grp, &iter_data, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_BADITER, -H5_DAOS_SETUP_ERROR, "link iteration failed");
+
+done:
+    /* Close group ID since iteration task will now own it.  No need to mark
+     * as nonblocking close since the ID rc shouldn't drop to 0. */
+    if ((target_grp_id >= 0) && (H5Idec_ref(target_grp_id) < 0))
+        D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group ID");
+
+    if (udata) {
+        /* Create metatask to complete this task after dep_task if necessary */
+        if (dep_task) {
+            /* Create metatask */
+            if (H5_daos_create_task(H5_daos_metatask_autocomp_other, 1, &dep_task, NULL, NULL, task,
+                                    &metatask) < 0)
+                D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create metatask for task to find link in creation order index");
+            else {
+                /* Schedule metatask */
+                assert(first_task);
+                if (0 != (ret = tse_task_schedule(metatask, false)))
+                    D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                                 "can't schedule metatask for task to find link in creation order index: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end else */
+        }     /* end if */
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                         "can't schedule initial task to find link in creation order index: %s",
+                         H5_daos_err_to_string(ret));
+
+        if (H5_daos_group_close_real(udata->target_grp) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "link creation order index lookup task";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+    }
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Complete task if necessary */
+    if (!metatask) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    }
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_delete_corder_iter_task() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_delete_corder_prep_cb
  *
@@ -7238,20 +8216,8 @@ H5_daos_link_delete_corder_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args
 
     assert(udata->target_grp);
 
-    /* If iteration was done by creation order, determine the
-     * index of the link to delete creation order info for now.
-     * If iteration was done by name order, the index will have
-     * been setup by a previous task. */
-    if (H5VL_OBJECT_BY_IDX == udata->loc_params->type) {
-        /* DSINC - no check for safe cast here */
-        udata->delete_idx =
-            (H5_ITER_DEC == udata->loc_params->loc_data.loc_by_idx.order)
-                ? (uint64_t)udata->grp_nlinks - (uint64_t)udata->loc_params->loc_data.loc_by_idx.n
-                : (uint64_t)udata->loc_params->loc_data.loc_by_idx.n;
-    } /* end if */
-
     /* Set up akey buffers now that the index for the
-     * link to delete will have been resolved.
+     * link to delete has been resolved by previous tasks.
      */
 
     /* Remove the akey which maps creation order -> link name */
@@ -7266,6 +8232,16 @@ H5_daos_link_delete_corder_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args
     daos_iov_set(&udata->akeys[1], (void *)udata->crt_order_target_buf,
                  H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE);
 
+    /* Remove the records mapping the slot of a link moved by a compaction to
+     * its creation order value and back */
+    if (udata->moved) {
+        p = udata->corder_rec_key_buf;
+        UINT64ENCODE(p, udata->delete_idx);
+        *p = H5_DAOS_LINK_CORDER_REC_TAG;
+        daos_iov_set(&udata->akeys[2], (void *)udata->corder_rec_key_buf, sizeof(udata->corder_rec_key_buf));
+        daos_iov_set(&udata->akeys[3], (void *)udata->slot_rec_key_buf, sizeof(udata->slot_rec_key_buf));
+    } /* end if */
+
     /* Set deletion task arguments */
     if (NULL == (punch_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
@@ -7276,7 +8252,7 @@ H5_daos_link_delete_corder_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args
     punch_args->dkey    = &udata->dkey;
     punch_args->akeys   = udata->akeys;
     punch_args->flags   = DAOS_COND_PUNCH;
-    punch_args->akey_nr = 2;
+    punch_args->akey_nr = udata->moved ? 4 : 2;
 
 done:
     if (ret_value < 0)
@@ -7289,12 +8265,17 @@ done:
  * Function:    H5_daos_link_delete_corder_bookkeep_task
  *
  * Purpose:     Asynchronous task to update a group's link creation order
- *              index after a link has been deleted. If links are left in
- *              the group and the link deleted wasn't at the "end" of the
- *              index, shifts the indices of all akeys past the removed
- *              link's akeys down by one. This maintains the ability to
- *              directly index into the group's link creation order index
- *              by removing any potential holes.
+ *              index after a link has been deleted. If the index is an
+ *              older index, links are left in the group and the link
+ *              deleted wasn't at the "end" of the index, shifts the
+ *              indices of all akeys past the removed link's akeys down by
+ *              one. This maintains the ability to directly index into the
+ *              group's link creation order index by removing any potential
+ *              holes. If a sparse index needs compacting, moves all
+ *              remaining links to the first slots of the index, records
+ *              the creation order value of each moved link and rewrites
+ *              the index's format record. Sparse indices otherwise need no
+ *              bookkeeping.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7309,6 +8290,8 @@ H5_daos_link_delete_corder_bookkeep_task(tse_task_t *task)
     tse_task_t                      *first_task = NULL;
     tse_task_t                      *dep_task   = NULL;
     tse_task_t                      *bookkeeping_tasks[4];
+    size_t                           nlinks;
+    size_t                           i;
     int                              ret;
     int                              ret_value = 0;
 
@@ -7323,81 +8306,132 @@ H5_daos_link_delete_corder_bookkeep_task(tse_task_t *task)
     /* Check for previous errors */
     H5_DAOS_PREP_REQ_PROG(udata->req);
 
-    /* Bookkeeping can be skipped if the last link in the group was
-     * deleted or if the link at the "end" of the index was deleted.
+    /* Bookkeeping can be skipped if the index is sparse and isn't being
+     * compacted (the removed link's slot was recorded as a hole), or for an
+     * older index if the last link in the group was deleted or if the link
+     * at the "end" of the index was deleted.
      */
-    if ((udata->grp_nlinks == 0) || (udata->delete_idx >= (uint64_t)udata->grp_nlinks))
+    if (udata->sparse ? !udata->compact
+                      : ((udata->grp_nlinks == 0) || (udata->delete_idx >= (uint64_t)udata->grp_nlinks)))
         D_GOTO_DONE(0);
 
-    /* Determine number of link akeys to rewrite and allocate sgl/iod buffers */
-    udata->index_data.nlinks_shift = (uint64_t)udata->grp_nlinks - udata->delete_idx;
+    /* Determine number of links to move.  A compaction moves every remaining
+     * link, otherwise the links past the removed link are shifted down. */
+    nlinks = udata->sparse ? (size_t)udata->grp_nlinks : (size_t)udata->grp_nlinks - udata->delete_idx;
+    udata->index_data.nlinks_shift = nlinks;
 
     /*
      * Allocate space for the 2 akeys per link, one akey that maps the link's
      * creation order value to the link's name and one akey that maps the link's
-     * creation order value to the link's target.
+     * creation order value to the link's target.  A compaction also writes 2
+     * records per link, mapping the link's new slot to its creation order
+     * value and back, plus the index's format record and number of holes.
      */
-    if (NULL == (udata->index_data.iods = DV_calloc(2 * udata->index_data.nlinks_shift * sizeof(daos_iod_t))))
+    if (NULL == (udata->index_data.iods = DV_calloc((4 * nlinks + 2) * sizeof(daos_iod_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate IOD buffer");
-    if (NULL ==
-        (udata->index_data.sgls = DV_malloc(2 * udata->index_data.nlinks_shift * sizeof(daos_sg_list_t))))
+    if (NULL == (udata->index_data.sgls = DV_malloc((4 * nlinks + 2) * sizeof(daos_sg_list_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate SGL buffer");
-    if (NULL ==
-        (udata->index_data.sg_iovs = DV_calloc(2 * udata->index_data.nlinks_shift * sizeof(daos_iov_t))))
+    if (NULL == (udata->index_data.sg_iovs = DV_calloc((4 * nlinks + 2) * sizeof(daos_iov_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate IOV buffer");
-    if (NULL == (udata->index_data.crt_order_link_name_buf =
-                     DV_malloc(udata->index_data.nlinks_shift * H5_DAOS_ENCODED_CRT_ORDER_SIZE)))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate akey data buffer");
-    if (NULL == (udata->index_data.crt_order_link_trgt_buf =
-                     DV_malloc(udata->index_data.nlinks_shift * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate akey data buffer");
+    if (NULL == (udata->index_data.punch_akeys = DV_calloc((3 * nlinks + 1) * sizeof(daos_key_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate akey buffer");
+    if (nlinks > 0) {
+        if (NULL == (udata->index_data.slots = DV_malloc(nlinks * sizeof(uint64_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate slot buffer");
+        if (NULL == (udata->index_data.crt_order_link_name_buf =
+                         DV_malloc(nlinks * H5_DAOS_ENCODED_CRT_ORDER_SIZE)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate akey data buffer");
+        if (NULL == (udata->index_data.crt_order_link_trgt_buf =
+                         DV_malloc(nlinks * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate akey data buffer");
+    } /* end if */
+
+    /* Determine the slots of the links to move */
+    if (udata->sparse) {
+        if (H5_daos_corder_get_slots(&udata->corder_info, udata->delete_idx, udata->index_data.slots,
+                                     nlinks) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                         "can't get slots of link creation order index");
+
+        /* Links moved by the last compaction have creation order records.
+         * They occupy the slots below compact_mark - slot_base. */
+        udata->index_data.ncorder_recs = 0;
+        while (udata->index_data.ncorder_recs < nlinks &&
+               udata->index_data.slots[udata->index_data.ncorder_recs] <
+                   udata->corder_info.compact_mark - udata->corder_info.slot_base)
+            udata->index_data.ncorder_recs++;
+
+        if (nlinks > 0 &&
+            NULL == (udata->index_data.recs_buf = DV_malloc(
+                         nlinks * 2 * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1 + H5_DAOS_ENCODED_CRT_ORDER_SIZE))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate creation order record buffer");
+        udata->index_data.corder_rec_keys = udata->index_data.recs_buf;
+        udata->index_data.corder_vals =
+            udata->index_data.corder_rec_keys + nlinks * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        udata->index_data.slot_rec_keys =
+            udata->index_data.corder_vals + nlinks * H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+        udata->index_data.slot_vals =
+            udata->index_data.slot_rec_keys + nlinks * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+    } /* end if */
+    else
+        for (i = 0; i < nlinks; i++)
+            udata->index_data.slots[i] = udata->delete_idx + i + 1;
 
     /* Set up dkey */
     daos_const_iov_set((d_const_iov_t *)&udata->index_data.dkey, H5_daos_link_corder_key_g,
                        H5_daos_link_corder_key_size_g);
 
-    /* Create task to fetch data size for each akey */
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_link_bookkeep_phase1_prep_cb, NULL,
-                                 udata, &bookkeeping_tasks[0]) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                     "can't create task to fetch sizes of link creation order index akeys");
+    /* Fetch the akeys of the links to move, if any */
+    if (nlinks > 0) {
+        /* Create task to fetch data size for each akey */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_link_bookkeep_phase1_prep_cb, NULL,
+                                     udata, &bookkeeping_tasks[0]) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task to fetch sizes of link creation order index akeys");
 
-    /* Save task to fetch sizes of akeys so that it can be scheduled later */
-    assert(!first_task);
-    first_task = bookkeeping_tasks[0];
-    dep_task   = bookkeeping_tasks[0];
+        /* Save task to fetch sizes of akeys so that it can be scheduled later */
+        assert(!first_task);
+        first_task = bookkeeping_tasks[0];
+        dep_task   = bookkeeping_tasks[0];
 
-    /* Create task to fetch akey data */
-    assert(dep_task);
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, &dep_task, H5_daos_link_bookkeep_phase2_prep_cb, NULL,
-                                 udata, &bookkeeping_tasks[1]) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                     "can't create task to fetch link creation order index akeys");
+        /* Create task to fetch akey data */
+        assert(dep_task);
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, &dep_task, H5_daos_link_bookkeep_phase2_prep_cb,
+                                     NULL, udata, &bookkeeping_tasks[1]) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task to fetch link creation order index akeys");
 
-    /* Schedule task to fetch akeys */
-    assert(first_task);
-    if (0 != (ret = tse_task_schedule(bookkeeping_tasks[1], false)))
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                     "can't schedule task to fetch link creation order index akeys: %s",
-                     H5_daos_err_to_string(ret));
-    dep_task = bookkeeping_tasks[1];
+        /* Schedule task to fetch akeys */
+        assert(first_task);
+        if (0 != (ret = tse_task_schedule(bookkeeping_tasks[1], false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't schedule task to fetch link creation order index akeys: %s",
+                         H5_daos_err_to_string(ret));
+        dep_task = bookkeeping_tasks[1];
+    } /* end if */
 
     /* Create task to update each akey */
-    assert(dep_task);
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 1, &dep_task, H5_daos_link_bookkeep_phase3_prep_cb,
-                                 NULL, udata, &bookkeeping_tasks[2]) < 0)
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                                 H5_daos_link_bookkeep_phase3_prep_cb, NULL, udata,
+                                 &bookkeeping_tasks[2]) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
                      "can't create task to update link creation order index akeys");
 
-    /* Schedule task to update akeys */
-    assert(first_task);
-    if (0 != (ret = tse_task_schedule(bookkeeping_tasks[2], false)))
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                     "can't schedule task to update link creation order index akeys: %s",
-                     H5_daos_err_to_string(ret));
+    /* Schedule task to update akeys (or save it to be scheduled later) */
+    if (first_task) {
+        if (0 != (ret = tse_task_schedule(bookkeeping_tasks[2], false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't schedule task to update link creation order index akeys: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        first_task = bookkeeping_tasks[2];
     dep_task = bookkeeping_tasks[2];
 
-    /* Create task to remove the (now invalid) two akeys at the end of the index */
+    /* Create task to remove the (now invalid) akeys at the end of the index */
     assert(dep_task);
     if (H5_daos_create_daos_task(DAOS_OPC_OBJ_PUNCH_AKEYS, 1, &dep_task, H5_daos_link_bookkeep_phase4_prep_cb,
                                  NULL, udata, &bookkeeping_tasks[3]) < 0)
@@ -7475,8 +8509,8 @@ done:
  * Purpose:     Prepare callback for phase 1 of link creation order index
  *              bookkeeping. Currently checks for errors from previous
  *              tasks, sets up IODs and SGLs to read the size of data for
- *              each link's creation order akeys and then sets arguments
- *              for the DAOS operation.
+ *              each moved link's creation order akeys and then sets
+ *              arguments for the DAOS operation.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7507,7 +8541,7 @@ H5_daos_link_bookkeep_phase1_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
 
     /* Set up iods */
     for (i = 0; i < udata->index_data.nlinks_shift; i++) {
-        tmp_uint = udata->delete_idx + i + 1;
+        tmp_uint = udata->index_data.slots[i];
 
         /* Setup the integer 'name' value for the current 'creation order -> link name' akey */
         p = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
@@ -7559,8 +8593,10 @@ done:
  *
  * Purpose:     Prepare callback for phase 2 of link creation order index
  *              bookkeeping. Currently checks for errors from previous
- *              tasks, allocates buffers for each link's creation order
- *              akeys and then sets arguments for the DAOS operation.
+ *              tasks, allocates buffers for each moved link's creation
+ *              order akeys, sets up the fetch of the creation order
+ *              records of links moved by the last compaction and then
+ *              sets arguments for the DAOS operation.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7572,14 +8608,14 @@ H5_daos_link_bookkeep_phase2_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
 {
     H5_daos_link_delete_corder_ud_t *udata;
     daos_obj_rw_t                   *fetch_args;
+    uint8_t                         *p;
+    size_t                           nlinks;
     size_t                           i;
     size_t                           link_corder_name_buf_size;
     size_t                           link_corder_target_buf_size;
-    char                            *link_corder_name_buf   = NULL;
-    char                            *link_corder_target_buf = NULL;
-    char                            *name_buf_cur_pos       = NULL;
-    char                            *target_buf_cur_pos     = NULL;
-    int                              ret_value              = 0;
+    uint8_t                         *name_buf_cur_pos   = NULL;
+    uint8_t                         *target_buf_cur_pos = NULL;
+    int                              ret_value          = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
@@ -7593,10 +8629,12 @@ H5_daos_link_bookkeep_phase2_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
 
     assert(udata->target_grp);
 
+    nlinks = udata->index_data.nlinks_shift;
+
     /* Determine size of buffers needed for link creation order akeys */
     link_corder_name_buf_size   = 0;
     link_corder_target_buf_size = 0;
-    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
+    for (i = 0; i < nlinks; i++) {
         /* Determine size for 'creation order -> link name' akey buffer */
         if (udata->index_data.iods[2 * i].iod_size == 0)
             D_GOTO_ERROR(H5E_SYM, H5E_BADSIZE, -H5_DAOS_BAD_VALUE, "invalid iod size - missing metadata");
@@ -7608,17 +8646,17 @@ H5_daos_link_bookkeep_phase2_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
         link_corder_target_buf_size += udata->index_data.iods[(2 * i) + 1].iod_size;
     } /* end for */
 
-    if (NULL == (link_corder_name_buf = DV_malloc(link_corder_name_buf_size)))
+    if (NULL == (udata->index_data.link_name_data_buf = DV_malloc(link_corder_name_buf_size)))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
                      "can't allocate buffer for akey data");
-    if (NULL == (link_corder_target_buf = DV_malloc(link_corder_target_buf_size)))
+    if (NULL == (udata->index_data.link_trgt_data_buf = DV_malloc(link_corder_target_buf_size)))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
                      "can't allocate buffer for akey data");
 
     /* Setup SGLs for each akey */
-    name_buf_cur_pos   = link_corder_name_buf;
-    target_buf_cur_pos = link_corder_target_buf;
-    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
+    name_buf_cur_pos   = udata->index_data.link_name_data_buf;
+    target_buf_cur_pos = udata->index_data.link_trgt_data_buf;
+    for (i = 0; i < nlinks; i++) {
         /* Set up sgls for the current 'creation order -> link name' akey */
         daos_iov_set(&udata->index_data.sg_iovs[2 * i], name_buf_cur_pos,
                      udata->index_data.iods[2 * i].iod_size);
@@ -7638,6 +8676,28 @@ H5_daos_link_bookkeep_phase2_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
         target_buf_cur_pos += udata->index_data.iods[(2 * i) + 1].iod_size;
     } /* end for */
 
+    /* Set up iods and sgls for the 'slot -> creation order' records of links
+     * moved by the last compaction */
+    for (i = 0; i < udata->index_data.ncorder_recs; i++) {
+        p = &udata->index_data.corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+        UINT64ENCODE(p, udata->index_data.slots[i]);
+        *p = H5_DAOS_LINK_CORDER_REC_TAG;
+
+        daos_iov_set(&udata->index_data.iods[(2 * nlinks) + i].iod_name,
+                     &udata->index_data.corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                     H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        udata->index_data.iods[(2 * nlinks) + i].iod_nr   = 1u;
+        udata->index_data.iods[(2 * nlinks) + i].iod_size = (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+        udata->index_data.iods[(2 * nlinks) + i].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&udata->index_data.sg_iovs[(2 * nlinks) + i],
+                     &udata->index_data.corder_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE],
+                     (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+        udata->index_data.sgls[(2 * nlinks) + i].sg_nr     = 1;
+        udata->index_data.sgls[(2 * nlinks) + i].sg_nr_out = 0;
+        udata->index_data.sgls[(2 * nlinks) + i].sg_iovs   = &udata->index_data.sg_iovs[(2 * nlinks) + i];
+    } /* end for */
+
     /* Set task arguments */
     if (NULL == (fetch_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
@@ -7647,19 +8707,13 @@ H5_daos_link_bookkeep_phase2_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
     fetch_args->th    = DAOS_TX_NONE;
     fetch_args->flags = DAOS_COND_AKEY_FETCH;
     fetch_args->dkey  = &udata->index_data.dkey;
-    fetch_args->nr    = (uint32_t)(2 * udata->index_data.nlinks_shift);
+    fetch_args->nr    = (uint32_t)((2 * nlinks) + udata->index_data.ncorder_recs);
     fetch_args->iods  = udata->index_data.iods;
     fetch_args->sgls  = udata->index_data.sgls;
 
 done:
-    if (ret_value < 0) {
-        if (link_corder_target_buf)
-            link_corder_target_buf = DV_free(link_corder_target_buf);
-        if (link_corder_name_buf)
-            link_corder_name_buf = DV_free(link_corder_name_buf);
-
+    if (ret_value < 0)
         tse_task_complete(task, ret_value);
-    }
 
     D_FUNC_LEAVE;
 } /* end H5_daos_link_bookkeep_phase2_prep_cb() */
@@ -7669,9 +8723,12 @@ done:
  *
  * Purpose:     Prepare callback for phase 3 of link creation order index
  *              bookkeeping. Currently checks for errors from previous
- *              tasks, adjusts each link's creation order akeys by setting
- *              their integer 'name' values to one less than their original
- *              values and then sets arguments for the DAOS operation.
+ *              tasks, adjusts each moved link's creation order akeys by
+ *              setting their integer 'name' values to the link's new slot
+ *              (one less than their original values for an older index,
+ *              the link's position in the index for a compaction), sets
+ *              up the records written by a compaction and then sets
+ *              arguments for the DAOS operation.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7684,7 +8741,9 @@ H5_daos_link_bookkeep_phase3_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
     H5_daos_link_delete_corder_ud_t *udata;
     daos_obj_rw_t                   *update_args;
     uint64_t                         tmp_uint;
+    uint64_t                         corder;
     uint8_t                         *p;
+    size_t                           nlinks;
     size_t                           i;
     int                              ret_value = 0;
 
@@ -7700,17 +8759,16 @@ H5_daos_link_bookkeep_phase3_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
 
     assert(udata->target_grp);
 
+    nlinks = udata->index_data.nlinks_shift;
+
     /*
-     * Adjust the akeys down by setting their integer 'name' values to
-     * one less than their original values.
+     * Move the akeys by setting their integer 'name' values to the
+     * link's new slot.
      */
-    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
+    for (i = 0; i < nlinks; i++) {
         /* Setup the integer 'name' value for the current 'creation order -> link name' akey */
-        p = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
-        UINT64DECODE(p, tmp_uint);
-
-        tmp_uint--;
-        p = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+        tmp_uint = udata->compact ? (uint64_t)i : udata->index_data.slots[i] - 1;
+        p        = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
         UINT64ENCODE(p, tmp_uint);
 
         /* Setup the integer 'name' value for the current 'creation order -> link target' akey */
@@ -7719,6 +8777,97 @@ H5_daos_link_bookkeep_phase3_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
         *p++ = 0;
     } /* end for */
 
+    /* Set up the records written by a compaction */
+    if (udata->compact) {
+        for (i = 0; i < nlinks; i++) {
+            /* Determine the link's creation order value, from its record if
+             * it was moved by the last compaction, otherwise from its slot */
+            if (i < udata->index_data.ncorder_recs) {
+                if (udata->index_data.iods[(2 * nlinks) + i].iod_size !=
+                    (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE)
+                    D_GOTO_ERROR(H5E_SYM, H5E_BADSIZE, -H5_DAOS_BAD_VALUE,
+                                 "invalid iod size - missing metadata");
+                p = &udata->index_data.corder_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+                UINT64DECODE(p, corder);
+            } /* end if */
+            else
+                corder = udata->index_data.slots[i] + udata->corder_info.slot_base;
+
+            /* Set up the 'slot -> creation order' record */
+            p = &udata->index_data.corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+            UINT64ENCODE(p, (uint64_t)i);
+            *p = H5_DAOS_LINK_CORDER_REC_TAG;
+            p  = &udata->index_data.corder_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+            UINT64ENCODE(p, corder);
+
+            daos_iov_set(&udata->index_data.iods[(2 * nlinks) + i].iod_name,
+                         &udata->index_data.corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                         H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+            udata->index_data.iods[(2 * nlinks) + i].iod_nr   = 1u;
+            udata->index_data.iods[(2 * nlinks) + i].iod_size = (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+            udata->index_data.iods[(2 * nlinks) + i].iod_type = DAOS_IOD_SINGLE;
+
+            daos_iov_set(&udata->index_data.sg_iovs[(2 * nlinks) + i],
+                         &udata->index_data.corder_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE],
+                         (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+            udata->index_data.sgls[(2 * nlinks) + i].sg_nr     = 1;
+            udata->index_data.sgls[(2 * nlinks) + i].sg_nr_out = 0;
+            udata->index_data.sgls[(2 * nlinks) + i].sg_iovs = &udata->index_data.sg_iovs[(2 * nlinks) + i];
+
+            /* Set up the 'creation order -> slot' record */
+            p = &udata->index_data.slot_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+            UINT64ENCODE(p, corder);
+            *p = H5_DAOS_LINK_SLOT_REC_TAG;
+            p  = &udata->index_data.slot_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+            UINT64ENCODE(p, (uint64_t)i);
+
+            daos_iov_set(&udata->index_data.iods[(3 * nlinks) + i].iod_name,
+                         &udata->index_data.slot_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)],
+                         H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+            udata->index_data.iods[(3 * nlinks) + i].iod_nr   = 1u;
+            udata->index_data.iods[(3 * nlinks) + i].iod_size = (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+            udata->index_data.iods[(3 * nlinks) + i].iod_type = DAOS_IOD_SINGLE;
+
+            daos_iov_set(&udata->index_data.sg_iovs[(3 * nlinks) + i],
+                         &udata->index_data.slot_vals[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE],
+                         (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+            udata->index_data.sgls[(3 * nlinks) + i].sg_nr     = 1;
+            udata->index_data.sgls[(3 * nlinks) + i].sg_nr_out = 0;
+            udata->index_data.sgls[(3 * nlinks) + i].sg_iovs = &udata->index_data.sg_iovs[(3 * nlinks) + i];
+        } /* end for */
+
+        /* Set up the new format record.  The moved links now occupy the
+         * slots below nlinks and later links are placed after them. */
+        H5_daos_corder_fmt_encode(udata->index_data.fmt_buf, udata->corder_info.max_corder - nlinks,
+                                  udata->corder_info.max_corder);
+        daos_const_iov_set((d_const_iov_t *)&udata->index_data.iods[4 * nlinks].iod_name,
+                           H5_daos_link_corder_fmt_key_g, H5_daos_link_corder_fmt_key_size_g);
+        udata->index_data.iods[4 * nlinks].iod_nr   = 1u;
+        udata->index_data.iods[4 * nlinks].iod_size = (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE;
+        udata->index_data.iods[4 * nlinks].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&udata->index_data.sg_iovs[4 * nlinks], udata->index_data.fmt_buf,
+                     (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE);
+        udata->index_data.sgls[4 * nlinks].sg_nr     = 1;
+        udata->index_data.sgls[4 * nlinks].sg_nr_out = 0;
+        udata->index_data.sgls[4 * nlinks].sg_iovs   = &udata->index_data.sg_iovs[4 * nlinks];
+
+        /* Set up the new number of holes */
+        p = udata->index_data.nholes_buf;
+        UINT64ENCODE(p, (uint64_t)0);
+        daos_const_iov_set((d_const_iov_t *)&udata->index_data.iods[(4 * nlinks) + 1].iod_name,
+                           H5_daos_nlink_corder_holes_key_g, H5_daos_nlink_corder_holes_key_size_g);
+        udata->index_data.iods[(4 * nlinks) + 1].iod_nr   = 1u;
+        udata->index_data.iods[(4 * nlinks) + 1].iod_size = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+        udata->index_data.iods[(4 * nlinks) + 1].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&udata->index_data.sg_iovs[(4 * nlinks) + 1], udata->index_data.nholes_buf,
+                     (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+        udata->index_data.sgls[(4 * nlinks) + 1].sg_nr     = 1;
+        udata->index_data.sgls[(4 * nlinks) + 1].sg_nr_out = 0;
+        udata->index_data.sgls[(4 * nlinks) + 1].sg_iovs   = &udata->index_data.sg_iovs[(4 * nlinks) + 1];
+    } /* end if */
+
     /* Set task arguments */
     if (NULL == (update_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
@@ -7727,7 +8876,7 @@ H5_daos_link_bookkeep_phase3_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
     update_args->oh   = udata->target_grp->obj.obj_oh;
     update_args->th   = DAOS_TX_NONE;
     update_args->dkey = &udata->index_data.dkey;
-    update_args->nr   = (uint32_t)(2 * udata->index_data.nlinks_shift);
+    update_args->nr   = (uint32_t)(udata->compact ? (4 * nlinks) + 2 : 2 * nlinks);
     update_args->iods = udata->index_data.iods;
     update_args->sgls = udata->index_data.sgls;
 
@@ -7744,9 +8893,10 @@ done:
  * Purpose:     Prepare callback for phase 4 of link creation order index
  *              bookkeeping. Currently checks for errors from previous
  *              tasks, then sets arguments for the DAOS operation to remove
- *              the two link creation order akeys at the "end" of the index
- *              (which are now invalid after shifting akeys downward in
- *              the index).
+ *              the link creation order akeys past the "end" of the index
+ *              (which are now invalid after moving akeys downward in the
+ *              index), along with the stale records and hole ranges of a
+ *              compacted index.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7760,6 +8910,8 @@ H5_daos_link_bookkeep_phase4_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
     daos_obj_punch_t                *punch_args;
     uint64_t                         tmp_uint;
     uint8_t                         *p;
+    size_t                           i;
+    unsigned                         nakeys    = 0;
     int                              ret_value = 0;
 
     /* Get private data */
@@ -7774,18 +8926,37 @@ H5_daos_link_bookkeep_phase4_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
 
     assert(udata->target_grp);
 
-    /* Encode last (now invalid) index value into akeys */
-    tmp_uint = (uint64_t)udata->grp_nlinks;
-    p        = &udata->index_data.crt_order_link_name_buf[0];
-    UINT64ENCODE(p, tmp_uint);
-    daos_iov_set(&udata->index_data.tail_akeys[0], (void *)udata->index_data.crt_order_link_name_buf,
-                 H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+    /* Encode the (now invalid) old slots past the end of the index into akeys */
+    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
+        tmp_uint = udata->index_data.slots[i];
+        if (tmp_uint < (uint64_t)udata->grp_nlinks)
+            continue;
 
-    p = &udata->index_data.crt_order_link_trgt_buf[0];
-    UINT64ENCODE(p, tmp_uint);
-    *p++ = 0;
-    daos_iov_set(&udata->index_data.tail_akeys[1], (void *)udata->index_data.crt_order_link_trgt_buf,
-                 H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        p = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+        daos_iov_set(&udata->index_data.punch_akeys[nakeys++], (void *)p, H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+        UINT64ENCODE(p, tmp_uint);
+
+        p = &udata->index_data.crt_order_link_trgt_buf[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+        daos_iov_set(&udata->index_data.punch_akeys[nakeys++], (void *)p, H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+        UINT64ENCODE(p, tmp_uint);
+        *p++ = 0;
+
+        /* Remove the link's old 'slot -> creation order' record */
+        if (udata->compact && i < udata->index_data.ncorder_recs) {
+            p = &udata->index_data.corder_rec_keys[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+            daos_iov_set(&udata->index_data.punch_akeys[nakeys++], (void *)p,
+                         H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+            UINT64ENCODE(p, tmp_uint);
+            *p = H5_DAOS_LINK_CORDER_REC_TAG;
+        } /* end if */
+    } /* end for */
+
+    /* Remove the hole ranges of a compacted index */
+    if (udata->compact)
+        daos_const_iov_set((d_const_iov_t *)&udata->index_data.punch_akeys[nakeys++],
+                           H5_daos_link_corder_holes_key_g, H5_daos_link_corder_holes_key_size_g);
+
+    assert(nakeys > 0);
 
     /* Set deletion task arguments */
     if (NULL == (punch_args = daos_task_get_args(task)))
@@ -7795,9 +8966,9 @@ H5_daos_link_bookkeep_phase4_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
     punch_args->oh      = udata->target_grp->obj.obj_oh;
     punch_args->th      = DAOS_TX_NONE;
     punch_args->dkey    = &udata->index_data.dkey;
-    punch_args->akeys   = udata->index_data.tail_akeys;
-    punch_args->flags   = DAOS_COND_PUNCH;
-    punch_args->akey_nr = 2;
+    punch_args->akeys   = udata->index_data.punch_akeys;
+    punch_args->flags   = udata->compact ? 0 : DAOS_COND_PUNCH;
+    punch_args->akey_nr = nakeys;
 
 done:
     if (ret_value < 0)
@@ -7849,35 +9020,17 @@ H5_daos_link_delete_corder_finish(tse_task_t *task)
         D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
     /* Free private data */
-    if (udata->index_data.crt_order_link_trgt_buf) {
-        DV_free(udata->index_data.crt_order_link_trgt_buf);
-        udata->index_data.crt_order_link_trgt_buf = NULL;
-    }
-    if (udata->index_data.crt_order_link_name_buf) {
-        DV_free(udata->index_data.crt_order_link_name_buf);
-        udata->index_data.crt_order_link_name_buf = NULL;
-    }
-    if (udata->index_data.sg_iovs) {
-        if (udata->index_data.sg_iovs[0].iov_buf) {
-            DV_free(udata->index_data.sg_iovs[0].iov_buf);
-            udata->index_data.sg_iovs[0].iov_buf = NULL;
-        }
-        if (udata->index_data.sg_iovs[1].iov_buf) {
-            DV_free(udata->index_data.sg_iovs[1].iov_buf);
-            udata->index_data.sg_iovs[1].iov_buf = NULL;
-        }
-
-        DV_free(udata->index_data.sg_iovs);
-        udata->index_data.sg_iovs = NULL;
-    }
-    if (udata->index_data.sgls) {
-        DV_free(udata->index_data.sgls);
-        udata->index_data.sgls = NULL;
-    }
-    if (udata->index_data.iods) {
-        DV_free(udata->index_data.iods);
-        udata->index_data.iods = NULL;
-    }
+    DV_free(udata->corder_info.holes);
+    DV_free(udata->index_data.crt_order_link_trgt_buf);
+    DV_free(udata->index_data.crt_order_link_name_buf);
+    DV_free(udata->index_data.link_trgt_data_buf);
+    DV_free(udata->index_data.link_name_data_buf);
+    DV_free(udata->index_data.recs_buf);
+    DV_free(udata->index_data.slots);
+    DV_free(udata->index_data.punch_akeys);
+    DV_free(udata->index_data.sg_iovs);
+    DV_free(udata->index_data.sgls);
+    DV_free(udata->index_data.iods);
 
     DV_free(udata);
 
@@ -8162,7 +9315,7 @@ H5_daos_link_gnbi_alloc_task(tse_task_t *task)
 
         /* Reissue call with larger buffer and transfer ownership of udata */
         if (H5_daos_link_get_name_by_idx(udata->target_grp, udata->index_type, udata->iter_order, udata->idx,
-                                         udata->link_name_size, *udata->link_name_buf,
+                                         udata->corder_info, udata->link_name_size, *udata->link_name_buf,
                                          udata->cur_link_name_size, udata->req, &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name by index");
         udata = NULL;
@@ -8223,7 +9376,8 @@ done:
  * Function:    H5_daos_link_get_name_by_idx_alloc
  *
  * Purpose:     Like H5_daos_link_get_name_by_idx, but automatically
- *              allocates the link_name buffer.
+ *              allocates the link_name buffer.  If corder_info is not
+ *              NULL it must remain valid until the operation completes.
  *
  * Return:      Success:        SUCCEED (0)
  *              Failure:        FAIL (Negative)
@@ -8232,7 +9386,8 @@ done:
  */
 herr_t
 H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp, H5_index_t index_type,
-                                   H5_iter_order_t iter_order, uint64_t idx, const char **link_name,
+                                   H5_iter_order_t iter_order, uint64_t idx,
+                                   const H5_daos_corder_info_t *corder_info, const char **link_name,
                                    size_t *link_name_size, char **link_name_buf, size_t *link_name_buf_size,
                                    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
@@ -8249,6 +9404,7 @@ H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp, H5_index_t index
     gnbi_udata->index_type         = index_type;
     gnbi_udata->iter_order         = iter_order;
     gnbi_udata->idx                = idx;
+    gnbi_udata->corder_info        = corder_info;
     gnbi_udata->link_name          = link_name;
     gnbi_udata->link_name_size     = link_name_size;
     gnbi_udata->link_name_buf      = link_name_buf;
@@ -8268,9 +9424,9 @@ H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp, H5_index_t index
     } /* end else */
 
     /* Call underlying function */
-    if (H5_daos_link_get_name_by_idx(target_grp, index_type, iter_order, idx, gnbi_udata->link_name_size,
-                                     *gnbi_udata->link_name_buf, gnbi_udata->cur_link_name_size, req,
-                                     first_task, dep_task) < 0)
+    if (H5_daos_link_get_name_by_idx(target_grp, index_type, iter_order, idx, corder_info,
+                                     gnbi_udata->link_name_size, *gnbi_udata->link_name_buf,
+                                     gnbi_udata->cur_link_name_size, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link name by index");
 
     /* Create task to finish this operation */
@@ -8315,6 +9471,12 @@ done:
  *              length of the link's name is simply returned. If non-NULL,
  *              the link's name is stored in link_name_out.
  *
+ *              For the creation order index, corder_info may point to
+ *              the group's creation order index info (including holes)
+ *              already retrieved by the caller, so operations that look
+ *              up many index values only retrieve it once.  Otherwise it
+ *              is NULL and the info is retrieved for this lookup.
+ *
  * Return:      Success:        SUCCEED (0)
  *              Failure:        FAIL (Negative)
  *
@@ -8322,17 +9484,18 @@ done:
  */
 herr_t
 H5_daos_link_get_name_by_idx(H5_daos_group_t *target_grp, H5_index_t index_type, H5_iter_order_t iter_order,
-                             uint64_t idx, size_t *link_name_size, char *link_name_out,
-                             size_t link_name_out_size, H5_daos_req_t *req, tse_task_t **first_task,
-                             tse_task_t **dep_task)
+                             uint64_t idx, const H5_daos_corder_info_t *corder_info, size_t *link_name_size,
+                             char *link_name_out, size_t link_name_out_size, H5_daos_req_t *req,
+                             tse_task_t **first_task, tse_task_t **dep_task)
 {
     herr_t ret_value = SUCCEED;
 
     assert(target_grp);
 
     if (H5_INDEX_CRT_ORDER == index_type) {
-        if (H5_daos_link_get_name_by_crt_order(target_grp, iter_order, idx, link_name_size, link_name_out,
-                                               link_name_out_size, req, first_task, dep_task) < 0)
+        if (H5_daos_link_get_name_by_crt_order(target_grp, iter_order, idx, corder_info, link_name_size,
+                                               link_name_out, link_name_out_size, req, first_task,
+                                               dep_task) < 0)
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't retrieve link name from creation order index");
     } /* end if */
     else if (H5_INDEX_NAME == index_type) {
@@ -8385,15 +9548,18 @@ H5_daos_link_gnbc_task(tse_task_t *task)
         D_GOTO_ERROR(H5E_SYM, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "creation order is not tracked for group");
 
     /* Ensure the index is within range */
-    if (udata->index >= (uint64_t)udata->grp_nlinks)
+    if (udata->index >= udata->corder_info->nobjs)
         D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
 
     /* Calculate the correct index of the link, based upon the iteration order */
     if (H5_ITER_DEC == udata->iter_order)
-        fetch_idx = (uint64_t)udata->grp_nlinks - udata->index - 1;
+        fetch_idx = udata->corder_info->nobjs - udata->index - 1;
     else
         fetch_idx = udata->index;
 
+    /* Skip over any holes in the index to find the slot holding the link */
+    fetch_idx = H5_daos_corder_idx_to_slot(udata->corder_info, fetch_idx);
+
     p = udata->idx_buf;
     UINT64ENCODE(p, fetch_idx);
 
@@ -8476,6 +9642,7 @@ done:
         tse_task_complete(task, ret_value);
 
         /* Free udata */
+        DV_free(udata->own_corder_info.holes);
         udata = DV_free(udata);
     } /* end if */
 
@@ -8558,6 +9725,7 @@ H5_daos_link_gnbc_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
     /* Free udata */
+    DV_free(udata->own_corder_info.holes);
     udata = DV_free(udata);
 
 done:
@@ -8577,6 +9745,9 @@ done:
  *              length of the link's name is simply returned. If non-NULL,
  *              the link's name is stored in link_name_out.
  *
+ *              If corder_info is NULL the group's creation order index
+ *              info is retrieved, otherwise the caller's is used.
+ *
  * Return:      Success:        Non-negative
  *              Failure:        Negative
  *
@@ -8584,8 +9755,9 @@ done:
  */
 static herr_t
 H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t iter_order, uint64_t index,
-                                   size_t *link_name_size, char *link_name_out, size_t link_name_out_size,
-                                   H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+                                   const H5_daos_corder_info_t *corder_info, size_t *link_name_size,
+                                   char *link_name_out, size_t link_name_out_size, H5_daos_req_t *req,
+                                   tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_link_gnbc_ud_t *gnbc_udata = NULL;
     int                     ret;
@@ -8606,9 +9778,16 @@ H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t
     gnbc_udata->link_name_out      = link_name_out;
     gnbc_udata->link_name_out_size = link_name_out_size;
 
-    /* Retrieve the current number of links in the group */
-    if (H5_daos_group_get_num_links(target_grp, &gnbc_udata->grp_nlinks, req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get number of links in group");
+    /* Retrieve the current number of links in the group and the holes in its
+     * creation order index, unless the caller already has them */
+    if (corder_info)
+        gnbc_udata->corder_info = corder_info;
+    else {
+        if (H5_daos_object_get_corder_info(&target_grp->obj, FALSE, TRUE, &gnbc_udata->own_corder_info, req,
+                                           first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link creation order index info");
+        gnbc_udata->corder_info = &gnbc_udata->own_corder_info;
+    } /* end else */
 
     /* Create task to finish this operation */
     if (H5_daos_create_task(H5_daos_link_gnbc_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
@@ -8645,7 +9824,10 @@ done:
  *
  * Purpose:     Asynchronous task for
  *              H5_daos_link_get_name_by_name_order().  Executes once
- *              target_grp is valid.
+ *              target_grp is valid.  If the group's cached list of link
+ *              names is still valid the name is retrieved from it
+ *              directly, otherwise the group's links are iterated over
+ *              to rebuild the list.
  *
  * Return:      Success:        0
  *              Failure:        Negative
@@ -8659,6 +9841,7 @@ H5_daos_link_gnbn_task(tse_task_t *task)
     H5_daos_iter_data_t     iter_data;
     tse_task_t             *first_task = NULL;
     tse_task_t             *dep_task   = NULL;
+    htri_t                  cache_ret;
     int                     ret;
     int                     ret_value = 0;
 
@@ -8670,17 +9853,21 @@ H5_daos_link_gnbn_task(tse_task_t *task)
     /* Handle errors in previous tasks */
     H5_DAOS_PREP_REQ(udata->req, H5E_LINK);
 
-    /* Ensure the index is within range */
-    if (udata->index >= (uint64_t)udata->grp_nlinks)
+    /* Try to retrieve the name from the group's name cache */
+    if ((cache_ret = H5_daos_name_cache_lookup(
+             &udata->target_grp->link_name_cache, udata->target_grp->obj.item.file->link_mod_gen,
+             udata->index, udata->link_name_out, udata->link_name_out_size, udata->link_name_size)) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
+    if (cache_ret)
+        D_GOTO_DONE(0);
 
-    /* Initialize iteration data */
-    udata->iter_cb_ud.target_link_idx    = udata->index;
-    udata->iter_cb_ud.cur_link_idx       = 0;
-    udata->iter_cb_ud.link_name_out      = udata->link_name_out;
-    udata->iter_cb_ud.link_name_out_size = udata->link_name_out_size;
+    /* Rebuild the name cache.  Save the current modification generation
+     * first, so the rebuilt cache is invalid if a link is written or deleted
+     * while iterating. */
+    udata->build_gen   = udata->target_grp->obj.item.file->link_mod_gen;
+    udata->names_built = TRUE;
     H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_LINK, H5_INDEX_NAME, udata->iter_order, FALSE, NULL,
-                           udata->target_grp_id, &udata->iter_cb_ud, NULL, udata->req);
+                           udata->target_grp_id, &udata->names, NULL, udata->req);
     iter_data.u.link_iter_data.u.link_iter_op = H5_daos_link_get_name_by_name_order_cb;
 
     /* Perform iteration */
@@ -8745,7 +9932,9 @@ done:
  * Function:    H5_daos_link_gnbn_end_task
  *
  * Purpose:     Finalizes the link get name by name operation, setting
- *              output and freeing data.
+ *              output and freeing data.  If the name list was rebuilt it
+ *              is installed in the group's name cache and the name is
+ *              retrieved from it.
  *
  * Return:      Success:        0
  *              Failure:        Negative
@@ -8766,8 +9955,15 @@ H5_daos_link_gnbn_end_task(tse_task_t *task)
     /* Handle errors in previous tasks */
     H5_DAOS_PREP_REQ_DONE(udata->req);
 
-    /* Set *link_name_size */
-    *udata->link_name_size = udata->iter_cb_ud.link_name_out_size;
+    /* Install the rebuilt name list and retrieve the name */
+    if (ret_value >= 0 && udata->names_built) {
+        H5_daos_name_cache_install(&udata->target_grp->link_name_cache, &udata->names, udata->build_gen);
+        if (H5_daos_name_cache_lookup(&udata->target_grp->link_name_cache, udata->build_gen, udata->index,
+                                      udata->link_name_out, udata->link_name_out_size,
+                                      udata->link_name_size) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
+    } /* end if */
+    H5_daos_name_cache_free(&udata->names);
 
     /* Return task to task list */
     if (H5_daos_task_list_put(H5_daos_task_list_g, udata->gnbn_task) < 0)
@@ -8814,6 +10010,11 @@ done:
  *              length of the link's name is simply returned. If non-NULL,
  *              the link's name is stored in link_name_out.
  *
+ *              The group's link names are cached on target_grp the first
+ *              time this is called, so later calls don't need to iterate
+ *              over the group's links until a link is written to or
+ *              deleted from the file.
+ *
  * Return:      Success:        Non-negative
  *              Failure:        Negative
  *
@@ -8850,10 +10051,6 @@ H5_daos_link_get_name_by_name_order(H5_daos_group_t *target_grp, H5_iter_order_t
         D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
     target_grp->obj.item.rc++;
 
-    /* Retrieve the current number of links in the group */
-    if (H5_daos_group_get_num_links(target_grp, &gnbn_udata->grp_nlinks, req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get number of links in group");
-
     /* Create task to finish this operation */
     if (H5_daos_create_task(H5_daos_link_gnbn_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
                             NULL, gnbn_udata, &gnbn_udata->gnbn_task) < 0)
@@ -8895,11 +10092,10 @@ done:
  *
  * Purpose:     Link iteration callback for
  *              H5_daos_link_get_name_by_name_order which iterates through
- *              links by name order until the specified index value is
- *              reached, at which point the target link has been found and
- *              its name is copied back.
+ *              all links by name order, adding each link's name to the
+ *              name list being built.
  *
- * Return:      Non-negative (can't fail)
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
@@ -8907,27 +10103,11 @@ static herr_t
 H5_daos_link_get_name_by_name_order_cb(hid_t H5VL_DAOS_UNUSED group, const char *name,
                                        const H5L_info2_t H5VL_DAOS_UNUSED *info, void *op_data)
 {
-    H5_daos_link_find_name_by_idx_ud_t *cb_ud     = (H5_daos_link_find_name_by_idx_ud_t *)op_data;
-    herr_t                              ret_value = H5_ITER_CONT;
-
-    if (cb_ud->cur_link_idx == cb_ud->target_link_idx) {
-        size_t name_len = strlen(name);
-
-        /* Copy name to output buffer if present */
-        if (cb_ud->link_name_out && cb_ud->link_name_out_size > 0) {
-            size_t copy_len = MIN(name_len, cb_ud->link_name_out_size - 1);
-
-            memcpy(cb_ud->link_name_out, name, copy_len);
-            cb_ud->link_name_out[copy_len] = '\0';
-        } /* end if */
-
-        /* Return name length */
-        cb_ud->link_name_out_size = name_len;
-
-        D_GOTO_DONE(H5_ITER_STOP);
-    } /* end if */
+    H5_daos_name_cache_t *names     = (H5_daos_name_cache_t *)op_data;
+    herr_t                ret_value = H5_ITER_CONT;
 
-    cb_ud->cur_link_idx++;
+    if (H5_daos_name_cache_append(names, name) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, H5_ITER_ERROR, "can't add link name to name list");
 
 done:
     D_FUNC_LEAVE;
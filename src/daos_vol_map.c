@@ -22,10 +22,54 @@
     ((2 * H5_DAOS_TYPE_BUF_SIZE) + H5_DAOS_MCPL_BUF_SIZE + H5_DAOS_ENCODED_OID_SIZE +                        \
      (3 * H5_DAOS_ENCODED_UINT64_T_SIZE))
 
+/* Maximum number of DAOS operations in flight at once for a batched
+ * multi-key map operation */
+#define H5_DAOS_MAP_MULTI_WINDOW 128
+
+/* Size of the buffer kept in each map operation's user data to hold a short
+ * converted key without allocating one */
+#define H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE 32
+
+/* Minimum number of rank slots of a map's entry count read by a count.  A
+ * count reads all slots named by the count's header in one fetch, and only
+ * needs a second one if the map was changed by a job larger than this and
+ * than the job counting it. */
+#define H5_DAOS_MAP_COUNT_NSLOTS_MIN 64
+
+/* Puts first try to update an existing key instead of inserting a new one
+ * while the map's put hint is at least H5_DAOS_MAP_PUT_HINT_UPDATE.  The
+ * hint moves up, to at most H5_DAOS_MAP_PUT_HINT_MAX, with each put that
+ * found its key in the map, and down with each put that did not. */
+#define H5_DAOS_MAP_PUT_HINT_UPDATE 2
+#define H5_DAOS_MAP_PUT_HINT_MAX    3
+
+/* Size of the akey of a rank's Bloom filter record of a map: the Bloom filter
+ * akey name followed by the encoded rank */
+#define H5_DAOS_MAP_BLOOM_REC_KEY_SIZE ((size_t)H5_daos_map_bloom_key_size_g + H5_DAOS_ENCODED_UINT64_T_SIZE)
+
+/* Maximum number of Bloom filter records, and of bytes of them, read by one
+ * fetch.  A single record larger than the byte limit is read by itself. */
+#define H5_DAOS_MAP_REC_FETCH_MAX   H5_DAOS_ITER_LEN
+#define H5_DAOS_MAP_REC_FETCH_BYTES ((size_t)4 * 1024 * 1024)
+
+/* Whether a map's shared state belongs to this rank of a file */
+#define H5_DAOS_MAP_SHARED_IN_FILE(shared, file)                                                             \
+    ((shared)->rank == (file)->my_rank && !strcmp((shared)->cont, (file)->cont) &&                           \
+     !strcmp((shared)->pool, (file)->facc_params.pool))
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
 
+/* Value extent and descriptor buffer for an I/O on a single map value, used
+ * when the map stores its values out of line.  The value is then a byte
+ * array under the Map Value akey, and the Map Record akey holds a descriptor
+ * containing the encoded length of the value. */
+typedef struct H5_daos_map_val_io_t {
+    daos_recx_t recx;
+    uint8_t     desc_buf[H5_DAOS_ENCODED_UINT64_T_SIZE];
+} H5_daos_map_val_io_t;
+
 /* Task user data for reading the value of a
  * specified key in a map object or for adding/
  * updating a key-value pair in a map object.
@@ -35,6 +79,7 @@ typedef struct H5_daos_map_rw_ud_t {
     const void           *key_buf;
     void                 *key_buf_alloc;
     size_t                key_size;
+    uint8_t               key_buf_local[H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE];
     htri_t                val_need_tconv;
     void                 *tconv_buf;
     void                 *bkg_buf;
@@ -42,6 +87,10 @@ typedef struct H5_daos_map_rw_ud_t {
     hid_t                 val_mem_type_id;
     size_t                val_mem_type_size;
     size_t                val_file_type_size;
+    tse_task_t           *end_task; /* For puts, the task waiting for the write, which may be repeated */
+    H5_daos_map_val_io_t  val_io;
+    size_t                val_offset; /* Offset of the bytes to read, for partial value reads */
+    size_t                val_len;    /* Number of bytes to read, for partial value reads */
 } H5_daos_map_rw_ud_t;
 
 /* Task user data for checking if a particular
@@ -52,9 +101,120 @@ typedef struct H5_daos_map_exists_ud_t {
     const void           *key_buf;
     void                 *key_buf_alloc;
     size_t                key_size;
+    uint8_t               key_buf_local[H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE];
     hbool_t              *exists_ret;
 } H5_daos_map_exists_ud_t;
 
+/* Task user data for opening the object holding a map's key-value pairs
+ * once the map's metadata has been read */
+typedef struct H5_daos_map_data_open_ud_t {
+    H5_daos_generic_cb_ud_t generic_ud; /* Must be first */
+    H5_daos_map_t          *map;
+} H5_daos_map_data_open_ud_t;
+
+/* Map operations that can be deferred until the map is open */
+typedef enum H5_daos_map_io_type_t {
+    H5_DAOS_MAP_IO_GET_VAL,
+    H5_DAOS_MAP_IO_PUT,
+    H5_DAOS_MAP_IO_EXISTS
+} H5_daos_map_io_type_t;
+
+/* Task user data for a map get, put or exists operation deferred until the
+ * map is open */
+typedef struct H5_daos_map_io_task_ud_t {
+    H5_daos_req_t        *req;
+    H5_daos_map_t        *map;
+    H5_daos_map_io_type_t io_type;
+    hid_t                 key_mem_type_id;
+    const void           *key;
+    hid_t                 val_mem_type_id;
+    void                 *value;
+    hbool_t              *exists;
+    tse_task_t           *end_task;
+} H5_daos_map_io_task_ud_t;
+
+/* Batched multi-key map operations */
+typedef enum H5_daos_map_multi_op_t {
+    H5_DAOS_MAP_MULTI_PUT,
+    H5_DAOS_MAP_MULTI_GET,
+    H5_DAOS_MAP_MULTI_EXISTS
+} H5_daos_map_multi_op_t;
+
+struct H5_daos_map_multi_ud_t;
+
+/* Task user data for one slot of a batched multi-key map operation.  Each
+ * slot has at most one DAOS operation in flight, for the key at index idx.
+ */
+typedef struct H5_daos_map_multi_slot_t {
+    H5_daos_md_rw_cb_ud_t          md_rw_cb_ud; /* Must be first */
+    struct H5_daos_map_multi_ud_t *multi_udata;
+    size_t                         idx;
+    const void                    *key_buf;
+    void                          *key_buf_alloc;
+    size_t                         key_size;
+    uint8_t                        key_buf_local[H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE];
+    void                          *tconv_buf;
+    void                          *bkg_buf;
+    H5_daos_map_val_io_t           val_io;
+} H5_daos_map_multi_slot_t;
+
+/* State shared by all slots of a batched multi-key map operation */
+typedef struct H5_daos_map_multi_ud_t {
+    H5_daos_req_t            *req;
+    H5_daos_map_t            *map;
+    H5_daos_map_multi_op_t    op;
+    size_t                    count;
+    size_t                    next_idx;
+    size_t                    nsucceeded;
+    const uint8_t            *keys;
+    hid_t                     key_mem_type_id;
+    size_t                    key_mem_type_size;
+    uint8_t                  *values;
+    hid_t                     val_mem_type_id;
+    size_t                    val_mem_type_size;
+    size_t                    val_file_type_size;
+    htri_t                    val_need_tconv;
+    hbool_t                   fill_bkg;
+    hbool_t                  *exists;
+    herr_t                   *statuses;
+    H5_daos_map_multi_slot_t *slots;
+    size_t                    nslots;
+    size_t                    nactive;
+    tse_task_t               *end_task;
+} H5_daos_map_multi_ud_t;
+
+/* Value fetch state for one listed key during map iteration with value
+ * prefetch */
+typedef struct H5_daos_map_iter_val_t {
+    daos_key_t           dkey;
+    daos_iod_t           iod[2];
+    daos_sg_list_t       sgl[2];
+    daos_iov_t           sg_iov[2];
+    H5_daos_map_val_io_t val_io;
+    unsigned             nr;
+    hbool_t              found;
+    size_t               conv_idx;
+} H5_daos_map_iter_val_t;
+
+/* Values prefetched for one batch of keys returned by a dkey list during
+ * map iteration.  The values are fetched concurrently, then converted to
+ * the memory type together by a single task before the iteration
+ * operator is called for any key in the batch. */
+typedef struct H5_daos_map_iter_batch_t {
+    H5_daos_generic_cb_ud_t generic_ud; /* Must be first */
+    H5_daos_map_t          *map;
+    hid_t                   val_mem_type_id;
+    size_t                  nr;
+    size_t                  val_file_type_size;
+    size_t                  val_mem_type_size;
+    htri_t                  val_need_tconv;
+    void                   *val_buf;
+    void                   *bkg_buf;
+    H5_daos_map_iter_val_t *vals;
+    tse_task_t             *conv_task;
+    unsigned                rc;
+} H5_daos_map_iter_batch_t;
+
 /* A struct used to operate on a single key-value
  * pair during map iteration */
 typedef struct H5_daos_map_iter_op_ud_t {
@@ -64,7 +224,7 @@ typedef struct H5_daos_map_iter_op_ud_t {
     void                   *key_buf;
     void                   *key_buf_alloc;
     size_t                  key_len;
-    hid_t                   key_file_type_id;
+    hid_t                   key_dkey_type_id;
     hid_t                   key_mem_type_id;
     char                   *char_replace_loc;
     char                    char_replace_char;
@@ -75,6 +235,9 @@ typedef struct H5_daos_map_iter_op_ud_t {
     hbool_t    shared_dkey;
     daos_key_t dkey;
     daos_iod_t iod;
+    /* Prefetched value, if iterating over keys and values */
+    H5_daos_map_iter_batch_t *batch;
+    size_t                    batch_idx;
 } H5_daos_map_iter_op_ud_t;
 
 /* Task user data for deleting a key-value pair from a map */
@@ -82,13 +245,239 @@ typedef struct H5_daos_map_delete_key_ud_t {
     H5_daos_req_t *req;
     H5_daos_map_t *map;
     daos_key_t     dkey;
-    daos_key_t     akey;
+    daos_key_t     akeys[2];
+    unsigned       akey_nr;
     hbool_t        shared_dkey;
     const void    *key_buf;
     void          *key_buf_alloc;
     size_t         key_size;
+    uint8_t        key_buf_local[H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE];
 } H5_daos_map_delete_key_ud_t;
 
+/* State shared by all handles open on a map in this process, found by the
+ * map's identity.  The map's entry count is an array under the Map Entry
+ * Count akey: cell 0 holds the number of rank slots that follow it, and
+ * cell 1 + r holds the net number of keys added by rank r of the
+ * communicators the map was changed through.  Changes made in this process
+ * are collected here and written to this rank's slot when any handle on the
+ * map is flushed or closed (see H5_daos_map_count_sync()).
+ *
+ * The map's Bloom filter is kept here as well, so keys put through any
+ * handle in this process are seen by all of them.  Each rank writes the
+ * filter to its own record, so the map has at most one record per rank, and
+ * the filter is the union of all records read plus the keys put in this
+ * process (see H5_daos_map_bloom_sync() and H5_daos_map_file_sync()). */
+struct H5_daos_map_shared_t {
+    daos_obj_id_t         oid;
+    char                  pool[DAOS_PROP_LABEL_MAX_LEN + 1];
+    char                  cont[DAOS_PROP_LABEL_MAX_LEN + 1];
+    int                   rank;
+    unsigned              rc;
+    hbool_t               legacy;        /* Whether the map has no entry count */
+    hbool_t               count_known;   /* Whether count_base is known */
+    int64_t               count_base;    /* Value of this rank's slot, as last read or written */
+    int64_t               count_pending; /* Changes being written to this rank's slot */
+    int64_t               count_delta;   /* Net number of keys added in this process and not yet synced */
+    uint64_t              nslots;        /* Largest number of rank slots seen in the count's header */
+    unsigned              put_hint;      /* See H5_DAOS_MAP_PUT_HINT_UPDATE */
+    tse_task_t           *sync_tail;     /* Last sync task created, until it completes */
+    uint8_t              *bloom;         /* Bloom filter over the map's keys, or NULL if the map has none */
+    uint64_t              bloom_size;    /* Size of bloom in bytes */
+    uint8_t              *bloom_rec_key; /* Akey of this rank's Bloom filter record */
+    hbool_t               bloom_loaded;  /* Whether bloom holds all records read at open */
+    hbool_t               bloom_dirty;   /* Whether bloom has keys not yet written to this rank's record */
+    H5_daos_map_t        *maps;          /* Handles attached to this state, linked by shared_next */
+    H5_daos_map_shared_t *next;
+};
+
+/* Task user data for retrieving the number of entries in a map.  Reads all
+ * rank slots of the map's entry count in one fetch.  Maps written by
+ * versions that did not maintain an entry count (legacy maps) are counted by
+ * iterating over their keys instead. */
+typedef struct H5_daos_map_get_count_ud_t {
+    H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
+    H5_daos_map_t        *map;
+    hsize_t              *count;
+    tse_task_t           *next_task; /* Task that depends on the fetch task, waits for a repeated fetch */
+    uint64_t              ncells;    /* Number of cells fetched, including the header */
+    uint8_t              *buf;
+    daos_recx_t           recx;
+} H5_daos_map_get_count_ud_t;
+
+/* Task user data for writing the changes to a map's entry count made in this
+ * process to this rank's slot.  If this rank's slot was not read yet it is
+ * read first, along with the header. */
+typedef struct H5_daos_map_count_sync_ud_t {
+    H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
+    H5_daos_map_shared_t *shared;
+    uint64_t              header; /* Value written to the header, 0 if it is not written */
+    daos_recx_t           recxs[2];
+    uint8_t               buf[2 * H5_DAOS_ENCODED_UINT64_T_SIZE];
+} H5_daos_map_count_sync_ud_t;
+
+/* Task user data for reading the Bloom filter records written by the ranks
+ * that changed a map.  Lists the akeys of the map's internal metadata dkey,
+ * then reads the records found in batches, combining the filters into the
+ * filter shared by the map's handles in this process as they arrive. */
+typedef struct H5_daos_map_rec_read_ud_t {
+    H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
+    H5_daos_map_t        *map;
+    hbool_t               skip; /* Set before the list runs to read nothing */
+    /* State for listing the akeys */
+    daos_anchor_t         anchor;
+    daos_key_desc_t       kds[H5_DAOS_ITER_LEN];
+    uint32_t              akey_nr;
+    daos_sg_list_t        list_sgl;
+    daos_iov_t            list_sg_iov;
+    uint8_t              *rec_keys;        /* Akeys of the records found, back to back */
+    size_t                rec_keys_nalloc; /* Number of akeys rec_keys has room for */
+    size_t                nrecs;
+    /* State for reading the records */
+    tse_task_t           *fetch_task;
+    tse_task_t           *next_task; /* Task that depends on the fetch task, waits for repeated fetches */
+    size_t                next_rec;  /* Index of the first record the next fetch reads */
+    size_t                fetch_nr;  /* Number of records read by the current fetch */
+    daos_iod_t            iods[H5_DAOS_MAP_REC_FETCH_MAX];
+    daos_sg_list_t        sgls[H5_DAOS_MAP_REC_FETCH_MAX];
+    daos_iov_t            sg_iovs[H5_DAOS_MAP_REC_FETCH_MAX];
+    uint8_t              *rec_buf;
+    size_t                rec_buf_size;
+} H5_daos_map_rec_read_ud_t;
+
+/* Task user data for loading a map's Bloom filter: reads the filter's size,
+ * then combines the Bloom filter records of all ranks that added keys to the
+ * map.  A reload skips the size. */
+typedef struct H5_daos_map_bloom_load_ud_t {
+    H5_daos_map_rec_read_ud_t rec_read; /* Must be first */
+    hbool_t                   reload;
+    uint8_t                   size_buf[H5_DAOS_ENCODED_UINT64_T_SIZE];
+} H5_daos_map_bloom_load_ud_t;
+
+/* Task user data for syncing, or reloading the Bloom filters of, all maps
+ * open in this process on a file */
+typedef struct H5_daos_map_file_sync_ud_t {
+    H5_daos_req_t  *req;
+    H5_daos_file_t *file;
+    hbool_t         reload;
+} H5_daos_map_file_sync_ud_t;
+
+struct H5_daos_map_range_t;
+
+/* One anchor of an ordered key range iteration.  DAOS lists the native
+ * uint64 dkeys of an anchor in increasing order, so each anchor is listed a
+ * batch at a time and the batches of all anchors are merged. */
+typedef struct H5_daos_map_range_part_t {
+    struct H5_daos_map_range_t *range;
+    daos_anchor_t               anchor;
+    daos_key_desc_t            *kds;
+    uint64_t                   *keys;   /* Current batch of dkeys, listed directly into this buffer */
+    uint32_t                    nkeys;  /* Number of dkeys in the current batch */
+    uint32_t                    next;   /* Index of the next dkey in the batch to visit */
+    hbool_t                     listed; /* Whether no dkey in the pass remains to be listed */
+    daos_sg_list_t              sgl;
+    daos_iov_t                  sg_iov;
+} H5_daos_map_range_part_t;
+
+/* State of an ordered key range iteration.  The range is visited in one or
+ * two passes, each over an interval of native dkey values that does not
+ * wrap around in uint64 order.  Each round of RPCs either positions the
+ * anchors at the start of a pass or lists the next batch of every anchor
+ * whose batch is used up.  Once a round is done the keys listed are
+ * visited in order and the next round is started from its last
+ * completion callback, so the whole iteration is a single request. */
+typedef struct H5_daos_map_range_t {
+    H5_daos_req_t            *req;
+    H5_daos_map_t            *map;
+    hid_t                     map_id;
+    hid_t                     key_mem_type_id;
+    H5M_iterate_t             op;
+    void                     *op_data;
+    herr_t                    op_ret;        /* Last value returned by op */
+    uint64_t                  pass_lower[2]; /* Lower bound of each pass (inclusive) */
+    uint64_t                  pass_upper[2]; /* Upper bound of each pass (inclusive) */
+    unsigned                  npasses;
+    unsigned                  pass;         /* Index of the current pass */
+    hbool_t                   pass_started; /* Whether the anchors were set up for the current pass */
+    uint64_t                  lower;        /* Lower bound of the current pass (inclusive) */
+    uint64_t                  upper;        /* Upper bound of the current pass (inclusive) */
+    daos_key_t                lower_dkey;   /* dkey to position the anchors at, points to lower */
+    hbool_t                   seek;         /* Whether this round positions the anchors at lower */
+    H5_daos_map_range_part_t *parts;
+    uint32_t                  nparts;
+    uint32_t                  batch_nr; /* Number of dkeys listed per RPC */
+    size_t                    nactive;  /* Number of tasks of this round in flight */
+    tse_task_t               *end_task; /* Completed once the iteration is done */
+} H5_daos_map_range_t;
+
+/* Task user data for setting the flags in a new map's OID and generating
+ * the OID of its data object once the map's own OID is known */
+typedef struct H5_daos_map_oid_flags_ud_t {
+    H5_daos_req_t *req;
+    H5_daos_map_t *map;
+} H5_daos_map_oid_flags_ud_t;
+
+/* Arguments of the public map routines, passed to their bodies through
+ * H5_daos_public_call() */
+typedef struct H5_daos_map_multi_args_t {
+    hid_t                  map_id;
+    H5_daos_map_multi_op_t op;
+    hid_t                  key_mem_type_id;
+    size_t                 count;
+    const void            *keys;
+    hid_t                  val_mem_type_id;
+    void                  *values;
+    hbool_t               *exists;
+    herr_t                *statuses;
+    hid_t                  dxpl_id;
+} H5_daos_map_multi_args_t;
+
+typedef struct H5_daos_map_iterate_kv_args_t {
+    hid_t                    map_id;
+    hsize_t                 *idx;
+    hid_t                    key_mem_type_id;
+    hid_t                    val_mem_type_id;
+    H5_daos_map_iterate_kv_t op;
+    void                    *op_data;
+    hid_t                    dxpl_id;
+} H5_daos_map_iterate_kv_args_t;
+
+typedef struct H5_daos_map_iterate_partitioned_args_t {
+    hid_t         map_id;
+    hid_t         key_mem_type_id;
+    H5M_iterate_t op;
+    void         *op_data;
+    hsize_t      *nvisited;
+    hid_t         dxpl_id;
+} H5_daos_map_iterate_partitioned_args_t;
+
+typedef struct H5_daos_map_iterate_range_args_t {
+    hid_t         map_id;
+    hid_t         key_mem_type_id;
+    const void   *low_key;
+    const void   *high_key;
+    hbool_t       high_inclusive;
+    H5M_iterate_t op;
+    void         *op_data;
+    hid_t         dxpl_id;
+} H5_daos_map_iterate_range_args_t;
+
+typedef struct H5_daos_map_get_partial_args_t {
+    hid_t       map_id;
+    hid_t       key_mem_type_id;
+    const void *key;
+    size_t      offset;
+    size_t      len;
+    void       *buf;
+    hid_t       dxpl_id;
+} H5_daos_map_get_partial_args_t;
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* State shared by the handles open on each map in this process */
+static H5_daos_map_shared_t *H5_daos_map_shared_g = NULL;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -99,26 +488,131 @@ static int H5_daos_map_open_recv_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_map_open_end(H5_daos_map_t *map, uint8_t *p, uint64_t ktype_buf_len,
                                 uint64_t vtype_buf_len, uint64_t mcpl_buf_len, hid_t dxpl_id);
 
-static herr_t H5_daos_map_key_conv(hid_t src_type_id, hid_t dst_type_id, const void *key,
-                                   const void **key_buf, size_t *key_size, void **key_buf_alloc,
-                                   hid_t dxpl_id);
+static herr_t H5_daos_map_data_oid_encode(H5_daos_map_t *map);
+static herr_t H5_daos_map_data_open(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                                    tse_task_t **dep_task);
+static int    H5_daos_map_data_open_prep_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_map_oid_set_flags(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                                        tse_task_t **dep_task);
+static int    H5_daos_map_oid_set_flags_task(tse_task_t *task);
+static herr_t H5_daos_map_shared_attach(H5_daos_map_t *map, hbool_t created);
+static void   H5_daos_map_shared_release(H5_daos_map_t *map);
+static herr_t H5_daos_map_init_dkey_type(H5_daos_map_t *map);
+static int    H5_daos_map_rw_prep_cb(tse_task_t *task, void *args);
+
+static unsigned H5_daos_map_val_io_init(H5_daos_map_t *map, H5_daos_map_val_io_t *val_io, daos_iod_t *iods,
+                                        daos_sg_list_t *sgls, daos_iov_t *sg_iovs, void *buf, size_t offset,
+                                        size_t len);
+static htri_t   H5_daos_map_val_io_found(H5_daos_map_t *map, const H5_daos_map_val_io_t *val_io,
+                                         const daos_iod_t *iods);
+
+static herr_t H5_daos_map_key_conv_cache_reset(H5_daos_map_key_conv_cache_t *cache);
+static herr_t H5_daos_map_key_conv_plan(H5_daos_map_t *map, hid_t key_mem_type_id);
+static herr_t H5_daos_map_key_conv(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
+                                   const void **key_buf, size_t *key_size, void *key_buf_local,
+                                   void **key_buf_alloc, hid_t dxpl_id);
 static herr_t H5_daos_map_key_conv_reverse(hid_t src_type_id, hid_t dst_type_id, void *key, size_t key_size,
                                            void **key_buf, void **key_buf_alloc, H5_daos_vl_union_t *vl_union,
                                            hid_t dxpl_id);
+static herr_t H5_daos_map_get_val_int(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
+                                      hid_t val_mem_type_id, void *value, hid_t dxpl_id, H5_daos_req_t *req,
+                                      tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_map_get_val_comp_cb(tse_task_t *task, void *args);
-static int    H5_daos_map_put_fill_comp_cb(tse_task_t *task, void *args);
-static int    H5_daos_map_put_comp_cb(tse_task_t *task, void *args);
-
-static int H5_daos_map_exists_prep_cb(tse_task_t *task, void *args);
-static int H5_daos_map_exists_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_map_get_partial_int(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
+                                          size_t offset, size_t len, void *buf, hid_t dxpl_id,
+                                          H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+static int    H5_daos_map_get_partial_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_map_put_int(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
+                                  hid_t val_mem_type_id, const void *value, hid_t dxpl_id, H5_daos_req_t *req,
+                                  tse_task_t **first_task, tse_task_t **dep_task);
+static int      H5_daos_map_put_fill_comp_cb(tse_task_t *task, void *args);
+static int      H5_daos_map_put_prep_cb(tse_task_t *task, void *args);
+static int      H5_daos_map_put_comp_cb(tse_task_t *task, void *args);
+static int      H5_daos_map_put_end_task(tse_task_t *task);
+static uint64_t H5_daos_map_put_flags(const H5_daos_map_t *map);
+static hbool_t  H5_daos_map_put_retry(H5_daos_map_t *map, uint64_t *flags, int result);
+
+static herr_t H5_daos_map_exists_int(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
+                                     hbool_t *exists, hid_t dxpl_id, H5_daos_req_t *req,
+                                     tse_task_t **first_task, tse_task_t **dep_task);
+static int    H5_daos_map_exists_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_exists_comp_cb(tse_task_t *task, void *args);
+
+static herr_t H5_daos_map_io_defer(H5_daos_map_t *map, H5_daos_map_io_type_t io_type, hid_t key_mem_type_id,
+                                   const void *key, hid_t val_mem_type_id, void *value, hbool_t *exists,
+                                   H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+static int    H5_daos_map_io_int_task(tse_task_t *task);
+static int    H5_daos_map_io_int_end_task(tse_task_t *task);
+
+static herr_t H5_daos_map_multi(void *_args);
+static herr_t H5_daos_map_iterate_kv_op(void *_args);
+static herr_t H5_daos_map_iterate_partitioned_op(void *_args);
+static herr_t H5_daos_map_iterate_range_op(void *_args);
+static herr_t H5_daos_map_get_partial_op(void *_args);
+static int    H5_daos_map_multi_task(tse_task_t *task);
+static herr_t H5_daos_map_multi_slot_start(H5_daos_map_multi_slot_t *slot);
+static herr_t H5_daos_map_multi_slot_issue(H5_daos_map_multi_slot_t *slot);
+static int    H5_daos_map_multi_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_multi_comp_cb(tse_task_t *task, void *args);
 
 static herr_t H5_daos_map_get_count_cb(hid_t map_id, const void *key, void *_int_count);
+static int    H5_daos_map_get_count_fetch_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_get_count_fetch_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_get_count_task(tse_task_t *task);
+static int    H5_daos_map_get_count_end_task(tse_task_t *task);
+static herr_t H5_daos_map_count_sync(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                                     tse_task_t **dep_task);
+static int    H5_daos_map_count_read_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_count_write_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_count_write_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_map_rec_read_init(H5_daos_map_rec_read_ud_t *udata, H5_daos_map_t *map,
+                                        H5_daos_req_t *req);
+static herr_t H5_daos_map_rec_read(H5_daos_map_rec_read_ud_t *udata, tse_task_t **dep_task);
+static void   H5_daos_map_rec_read_free(H5_daos_map_rec_read_ud_t *udata);
+static int    H5_daos_map_rec_list_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_rec_list_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_rec_fetch_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_rec_fetch_comp_cb(tse_task_t *task, void *args);
+
+static void    H5_daos_map_bloom_hash(const void *key, size_t key_size, uint64_t *h1, uint64_t *h2);
+static herr_t  H5_daos_map_bloom_alloc(H5_daos_map_shared_t *shared, uint64_t bloom_size);
+static void    H5_daos_map_bloom_add(H5_daos_map_t *map, const void *key, size_t key_size);
+static hbool_t H5_daos_map_bloom_test(H5_daos_map_t *map, const void *key, size_t key_size);
+static herr_t  H5_daos_map_bloom_load(H5_daos_map_t *map, hbool_t reload, H5_daos_req_t *req,
+                                      tse_task_t **first_task, tse_task_t **dep_task);
+static int     H5_daos_map_bloom_size_prep_cb(tse_task_t *task, void *args);
+static int     H5_daos_map_bloom_size_comp_cb(tse_task_t *task, void *args);
+static int     H5_daos_map_bloom_load_end_task(tse_task_t *task);
+static herr_t  H5_daos_map_bloom_sync(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                                      tse_task_t **dep_task);
+static int     H5_daos_map_bloom_sync_prep_cb(tse_task_t *task, void *args);
+static int     H5_daos_map_bloom_sync_comp_cb(tse_task_t *task, void *args);
+static herr_t  H5_daos_map_sync(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                                tse_task_t **dep_task);
+static int     H5_daos_map_file_sync_task(tse_task_t *task);
+static int     H5_daos_map_file_barrier_comp_cb(tse_task_t *task, void *args);
+
 static herr_t H5_daos_map_iterate(H5_daos_map_t *map, H5_daos_iter_data_t *iter_data, tse_task_t **first_task,
                                   tse_task_t **dep_task);
+static int    H5_daos_map_anchor_split(H5_daos_map_t *map, uint32_t *nparts);
+static int    H5_daos_map_anchor_set(H5_daos_map_t *map, uint32_t idx, daos_anchor_t *anchor);
 static int    H5_daos_map_iterate_list_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_map_iterate_query_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_map_iterate_op_task(tse_task_t *task);
 static int    H5_daos_map_iter_op_end(tse_task_t *task);
+static herr_t H5_daos_map_iter_batch_start(H5_daos_iter_ud_t *iter_ud, H5_daos_map_t *map,
+                                           H5_daos_map_iter_batch_t **batch);
+static int    H5_daos_map_iter_batch_fetch_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_iter_batch_conv_task(tse_task_t *task);
+static void   H5_daos_map_iter_batch_decref(H5_daos_map_iter_batch_t *batch);
+static int    H5_daos_map_range_task(tse_task_t *task);
+static int    H5_daos_map_range_advance(H5_daos_map_range_t *range);
+static int    H5_daos_map_range_round(H5_daos_map_range_t *range);
+#if CHECK_DAOS_API_VERSION(2, 4)
+static int H5_daos_map_range_seek_prep_cb(tse_task_t *task, void *args);
+#endif
+static int    H5_daos_map_range_list_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_map_range_comp_cb(tse_task_t *task, void *args);
 
 static herr_t H5_daos_map_delete_key(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
                                      hbool_t collective, H5_daos_req_t *req, tse_task_t **first_task,
@@ -220,10 +714,47 @@ H5_daos_map_create(void *_item, const H5VL_loc_params_t H5VL_DAOS_UNUSED *loc_pa
     map->obj.obj_oh       = DAOS_HDL_INVAL;
     map->key_type_id      = H5I_INVALID_HID;
     map->key_file_type_id = H5I_INVALID_HID;
+    map->key_dkey_type_id = H5I_INVALID_HID;
     map->val_type_id      = H5I_INVALID_HID;
     map->val_file_type_id = H5I_INVALID_HID;
     map->mcpl_id          = H5P_MAP_CREATE_DEFAULT;
     map->mapl_id          = H5P_MAP_ACCESS_DEFAULT;
+    map->data_oh          = DAOS_HDL_INVAL;
+
+    map->key_conv_cache.mem_type_id         = H5I_INVALID_HID;
+    map->key_conv_cache.mem_parent_type_id  = H5I_INVALID_HID;
+    map->key_conv_cache.dkey_parent_type_id = H5I_INVALID_HID;
+
+    /* Keep the key-value pairs of maps with 64 bit integer keys in a
+     * separate object with native uint64 dkeys */
+    map->dkey_uint64 = ktype_class == H5T_INTEGER && H5Tget_size(ktype_id) == sizeof(uint64_t);
+
+    /* Set up value types.  These are needed here to decide whether the map
+     * stores its values out of line, which is recorded in the oid. */
+    if ((map->val_type_id = H5Tcopy(vtype_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, NULL, "failed to copy datatype");
+    if ((map->val_file_type_id = H5VLget_file_type(item->file, H5_DAOS_g, vtype_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "failed to get file datatype");
+    if (0 == (map->val_file_type_size = H5Tget_size(map->val_file_type_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get value file datatype size");
+
+    /* Store values larger than the threshold out of line, so they can be
+     * read in part.  This is decided once for the whole map from the fixed
+     * file type size, so variable-length values are never stored out of
+     * line. */
+    map->large_vals = map->val_file_type_size > H5_DAOS_MAP_LARGE_VAL_THRESHOLD_DEFAULT;
+    if (!default_mcpl) {
+        htri_t threshold_exists;
+        size_t threshold;
+
+        if ((threshold_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_LARGE_VAL_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't check for large value threshold property");
+        if (threshold_exists) {
+            if (H5Pget(mcpl_id, H5_DAOS_MAP_LARGE_VAL_PROP_NAME, &threshold) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get large value threshold property");
+            map->large_vals = map->val_file_type_size > threshold;
+        } /* end if */
+    }     /* end if */
 
 #ifdef H5_DAOS_USE_TRANSACTIONS
     /* Start transaction */
@@ -258,20 +789,46 @@ H5_daos_map_create(void *_item, const H5VL_loc_params_t H5VL_DAOS_UNUSED *loc_pa
                              &dep_task) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "can't generate object id");
 
+    /* Set map oid flags and generate data object oid */
+    if (H5_daos_map_oid_set_flags(map, int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "can't set map object id flags");
+
     /* Open map object */
     if (H5_daos_obj_open(item->file, int_req, &map->obj.oid, DAOS_OO_RW, &map->obj.obj_oh, "map object open",
                          &first_task, &dep_task) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "can't open map object");
 
+    /* Open data object */
+    if (map->dkey_uint64 && H5_daos_obj_open(item->file, int_req, &map->data_oid, DAOS_OO_RW, &map->data_oh,
+                                             "map data object open", &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "can't open map data object");
+
+    /* Set up Bloom filter if requested.  The filter itself is allocated when
+     * the map is attached to its shared state. */
+    if (!default_mcpl) {
+        htri_t   bloom_exists;
+        uint64_t bloom_nbits = 0;
+
+        if ((bloom_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_BLOOM_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't check for Bloom filter property");
+        if (bloom_exists && H5Pget(mcpl_id, H5_DAOS_MAP_BLOOM_PROP_NAME, &bloom_nbits) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get Bloom filter property");
+        map->bloom_size = (bloom_nbits + 7) / 8;
+    } /* end if */
+
     /* Create map and write metadata if this process should */
     if (!collective || (item->file->my_rank == 0)) {
-        size_t      mcpl_size  = 0;
-        size_t      ktype_size = 0;
-        size_t      vtype_size = 0;
-        void       *ktype_buf  = NULL;
-        void       *vtype_buf  = NULL;
-        void       *mcpl_buf   = NULL;
-        tse_task_t *update_task;
+        size_t       mcpl_size  = 0;
+        size_t       ktype_size = 0;
+        size_t       vtype_size = 0;
+        void        *ktype_buf  = NULL;
+        void        *vtype_buf  = NULL;
+        void        *mcpl_buf   = NULL;
+        uint8_t     *count_buf  = NULL;
+        daos_recx_t *count_recx = NULL;
+        uint8_t     *bloom_buf  = NULL;
+        uint8_t     *p;
+        tse_task_t  *update_task;
 
         /* Determine serialized datatype sizes */
         if (H5Tencode(ktype_id, NULL, &ktype_size) < 0)
@@ -287,22 +844,35 @@ H5_daos_map_create(void *_item, const H5VL_loc_params_t H5VL_DAOS_UNUSED *loc_pa
         /* Create map */
         /* Allocate argument struct */
         if (NULL == (update_cb_ud = (H5_daos_md_rw_cb_ud_flex_t *)DV_calloc(
-                         sizeof(H5_daos_md_rw_cb_ud_flex_t) + ktype_size + vtype_size + mcpl_size)))
+                         sizeof(H5_daos_md_rw_cb_ud_flex_t) + sizeof(daos_recx_t) +
+                         2 * H5_DAOS_ENCODED_UINT64_T_SIZE + ktype_size + vtype_size + mcpl_size)))
             D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL,
                          "can't allocate buffer for update callback arguments");
 
+        /* The entry count header extent goes first to keep it aligned.  Encode
+         * the header, the number of rank slots. */
+        count_recx = (daos_recx_t *)update_cb_ud->flex_buf;
+        count_buf  = update_cb_ud->flex_buf + sizeof(daos_recx_t);
+        p          = count_buf;
+        UINT64ENCODE(p, (uint64_t)item->file->num_procs)
+
+        /* Encode Bloom filter size */
+        bloom_buf = count_buf + H5_DAOS_ENCODED_UINT64_T_SIZE;
+        p         = bloom_buf;
+        UINT64ENCODE(p, map->bloom_size)
+
         /* Encode datatypes */
-        ktype_buf = update_cb_ud->flex_buf;
+        ktype_buf = bloom_buf + H5_DAOS_ENCODED_UINT64_T_SIZE;
         if (H5Tencode(ktype_id, ktype_buf, &ktype_size) < 0)
             D_GOTO_ERROR(H5E_MAP, H5E_CANTENCODE, NULL, "can't serialize datatype");
 
-        vtype_buf = update_cb_ud->flex_buf + ktype_size;
+        vtype_buf = (uint8_t *)ktype_buf + ktype_size;
         if (H5Tencode(vtype_id, vtype_buf, &vtype_size) < 0)
             D_GOTO_ERROR(H5E_MAP, H5E_CANTENCODE, NULL, "can't serialize datatype");
 
         /* Encode MCPL if not the default */
         if (!default_mcpl) {
-            mcpl_buf = update_cb_ud->flex_buf + ktype_size + vtype_size;
+            mcpl_buf = (uint8_t *)vtype_buf + vtype_size;
             if (H5Pencode2(mcpl_id, mcpl_buf, &mcpl_size, item->file->fapl_id) < 0)
                 D_GOTO_ERROR(H5E_MAP, H5E_CANTENCODE, NULL, "can't serialize mcpl");
         } /* end if */
@@ -323,8 +893,9 @@ H5_daos_map_create(void *_item, const H5VL_loc_params_t H5VL_DAOS_UNUSED *loc_pa
                            H5_daos_int_md_key_size_g);
         update_cb_ud->md_rw_cb_ud.free_dkey = FALSE;
 
-        /* The elements in iod and sgl */
-        update_cb_ud->md_rw_cb_ud.nr = 3u;
+        /* The elements in iod and sgl.  The Bloom filter size is only
+         * written if the map has a filter. */
+        update_cb_ud->md_rw_cb_ud.nr = map->bloom_size > 0 ? 5u : 4u;
 
         /* Set up iod */
         /* Key datatype.  Point akey to global name buffer, do not free. */
@@ -348,6 +919,24 @@ H5_daos_map_create(void *_item, const H5VL_loc_params_t H5VL_DAOS_UNUSED *loc_pa
         update_cb_ud->md_rw_cb_ud.iod[2].iod_size = (uint64_t)mcpl_size;
         update_cb_ud->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
 
+        /* Entry count header, so the map is known to maintain a count.  The
+         * rank slots after it are written as ranks change the map. */
+        daos_const_iov_set((d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.iod[3].iod_name,
+                           H5_daos_map_count_key_g, H5_daos_map_count_key_size_g);
+        count_recx->rx_idx                         = 0;
+        count_recx->rx_nr                          = 1;
+        update_cb_ud->md_rw_cb_ud.iod[3].iod_nr    = 1u;
+        update_cb_ud->md_rw_cb_ud.iod[3].iod_recxs = count_recx;
+        update_cb_ud->md_rw_cb_ud.iod[3].iod_size  = (uint64_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+        update_cb_ud->md_rw_cb_ud.iod[3].iod_type  = DAOS_IOD_ARRAY;
+
+        /* Bloom filter size */
+        daos_const_iov_set((d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.iod[4].iod_name,
+                           H5_daos_map_bloom_size_key_g, H5_daos_map_bloom_size_key_size_g);
+        update_cb_ud->md_rw_cb_ud.iod[4].iod_nr   = 1u;
+        update_cb_ud->md_rw_cb_ud.iod[4].iod_size = (uint64_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+        update_cb_ud->md_rw_cb_ud.iod[4].iod_type = DAOS_IOD_SINGLE;
+
         /* Do not free global akey buffers */
         update_cb_ud->md_rw_cb_ud.free_akeys = FALSE;
 
@@ -367,6 +956,18 @@ H5_daos_map_create(void *_item, const H5VL_loc_params_t H5VL_DAOS_UNUSED *loc_pa
         update_cb_ud->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
         update_cb_ud->md_rw_cb_ud.sgl[2].sg_iovs   = &update_cb_ud->md_rw_cb_ud.sg_iov[2];
         update_cb_ud->md_rw_cb_ud.free_sg_iov[2]   = FALSE;
+        daos_iov_set(&update_cb_ud->md_rw_cb_ud.sg_iov[3], count_buf,
+                     (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+        update_cb_ud->md_rw_cb_ud.sgl[3].sg_nr     = 1;
+        update_cb_ud->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
+        update_cb_ud->md_rw_cb_ud.sgl[3].sg_iovs   = &update_cb_ud->md_rw_cb_ud.sg_iov[3];
+        update_cb_ud->md_rw_cb_ud.free_sg_iov[3]   = FALSE;
+        daos_iov_set(&update_cb_ud->md_rw_cb_ud.sg_iov[4], bloom_buf,
+                     (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+        update_cb_ud->md_rw_cb_ud.sgl[4].sg_nr     = 1;
+        update_cb_ud->md_rw_cb_ud.sgl[4].sg_nr_out = 0;
+        update_cb_ud->md_rw_cb_ud.sgl[4].sg_iovs   = &update_cb_ud->md_rw_cb_ud.sg_iov[4];
+        update_cb_ud->md_rw_cb_ud.free_sg_iov[4]   = FALSE;
 
         /* Set task name */
         update_cb_ud->md_rw_cb_ud.task_name = "map metadata write";
@@ -424,12 +1025,8 @@ H5_daos_map_create(void *_item, const H5VL_loc_params_t H5VL_DAOS_UNUSED *loc_pa
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "failed to get file datatype");
     if (0 == (map->key_file_type_size = H5Tget_size(map->key_file_type_id)))
         D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get key file datatype size");
-    if ((map->val_type_id = H5Tcopy(vtype_id)) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, NULL, "failed to copy datatype");
-    if ((map->val_file_type_id = H5VLget_file_type(item->file, H5_DAOS_g, vtype_id)) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "failed to get file datatype");
-    if (0 == (map->val_file_type_size = H5Tget_size(map->val_file_type_id)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get value file datatype size");
+    if (H5_daos_map_init_dkey_type(map) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "can't set key dkey datatype");
     if (!default_mcpl && (map->mcpl_id = H5Pcopy(mcpl_id)) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, NULL, "failed to copy mcpl");
     if ((mapl_id != H5P_MAP_ACCESS_DEFAULT) && (map->mapl_id = H5Pcopy(mapl_id)) < 0)
@@ -527,11 +1124,9 @@ done:
             op_type = H5_DAOS_OP_TYPE_WRITE_ORDERED;
 
         /* Add the request to the object's request queue.  This will add the
-         * dependency on the group open if necessary.  If this is an anonymous
-         * create add to the file pool. */
-        if (H5_daos_req_enqueue(int_req, first_task, item, op_type,
-                                target_obj ? H5_DAOS_OP_SCOPE_OBJ : H5_DAOS_OP_SCOPE_FILE, collective,
-                                !req) < 0)
+         * dependency on the group open if necessary. */
+        if (H5_daos_req_enqueue_create(int_req, first_task, item, ret_value ? &map->obj.item : NULL,
+                                       !target_obj, op_type, collective, !req) < 0)
             D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "can't add request to request queue");
 
         /* Check for external async */
@@ -733,10 +1328,16 @@ H5_daos_map_open_helper(H5_daos_file_t *file, hid_t mapl_id, hbool_t collective,
     map->obj.obj_oh       = DAOS_HDL_INVAL;
     map->key_type_id      = H5I_INVALID_HID;
     map->key_file_type_id = H5I_INVALID_HID;
+    map->key_dkey_type_id = H5I_INVALID_HID;
     map->val_type_id      = H5I_INVALID_HID;
     map->val_file_type_id = H5I_INVALID_HID;
     map->mcpl_id          = H5P_MAP_CREATE_DEFAULT;
     map->mapl_id          = H5P_MAP_ACCESS_DEFAULT;
+    map->data_oh          = DAOS_HDL_INVAL;
+
+    map->key_conv_cache.mem_type_id         = H5I_INVALID_HID;
+    map->key_conv_cache.mem_parent_type_id  = H5I_INVALID_HID;
+    map->key_conv_cache.dkey_parent_type_id = H5I_INVALID_HID;
     if ((mapl_id != H5P_MAP_ACCESS_DEFAULT) && (map->mapl_id = H5Pcopy(mapl_id)) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, NULL, "failed to copy mapl");
 
@@ -752,7 +1353,7 @@ H5_daos_map_open_helper(H5_daos_file_t *file, hid_t mapl_id, hbool_t collective,
         bcast_udata->bcast_udata.buffer     = bcast_udata->flex_buf;
         bcast_udata->bcast_udata.buffer_len = H5_DAOS_MINFO_BCAST_BUF_SIZE;
         bcast_udata->bcast_udata.count      = H5_DAOS_MINFO_BCAST_BUF_SIZE;
-        bcast_udata->bcast_udata.comm       = req->file->comm;
+        bcast_udata->bcast_udata.lane       = NULL;
 
         minfo_buf_size = H5_DAOS_MINFO_BCAST_BUF_SIZE;
     } /* end if */
@@ -883,9 +1484,9 @@ done:
     if (bcast_udata) {
         assert(minfo_buf_size == H5_DAOS_MINFO_BCAST_BUF_SIZE);
         if (H5_daos_mpi_ibcast(
-                &bcast_udata->bcast_udata, &map->obj, minfo_buf_size, NULL == ret_value ? TRUE : FALSE, NULL,
-                file->my_rank == 0 ? H5_daos_map_open_bcast_comp_cb : H5_daos_map_open_recv_comp_cb, req,
-                first_task, dep_task) < 0) {
+                &bcast_udata->bcast_udata, &map->obj, minfo_buf_size, NULL == ret_value ? TRUE : FALSE, TRUE,
+                NULL, file->my_rank == 0 ? H5_daos_map_open_bcast_comp_cb : H5_daos_map_open_recv_comp_cb,
+                req, first_task, dep_task) < 0) {
             DV_free(bcast_udata);
             D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "failed to broadcast map info buffer");
         } /* end if */
@@ -893,6 +1494,23 @@ done:
         bcast_udata = NULL;
     } /* end if */
 
+    /* Open map object on processes that received the map info from the
+     * leader, once the broadcast has delivered its OID */
+    if (ret_value && collective && (file->my_rank > 0) &&
+        H5_daos_obj_open(file, req, &map->obj.oid, (file->flags & H5F_ACC_RDWR ? DAOS_OO_RW : DAOS_OO_RO),
+                         &map->obj.obj_oh, "map object open", first_task, dep_task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "can't open map object");
+
+    /* Open the object holding the map's key-value pairs, if any, once the
+     * map's metadata is known */
+    if (ret_value && H5_daos_map_data_open(map, req, first_task, dep_task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "can't open map data object");
+
+    /* Load Bloom filter.  Every process reads it since each needs its own
+     * copy, but only the first handle opened on the map in a process. */
+    if (ret_value && H5_daos_map_bloom_load(map, FALSE, req, first_task, dep_task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "can't load map Bloom filter");
+
     /* Cleanup on failure */
     if (NULL == ret_value) {
         /* Close map */
@@ -1030,7 +1648,7 @@ done:
     /* Cleanup on failure */
     if (NULL == ret_value) {
         /* Broadcast failure */
-        if (must_bcast && H5_daos_mpi_ibcast(NULL, &map->obj, H5_DAOS_MINFO_BCAST_BUF_SIZE, TRUE, NULL,
+        if (must_bcast && H5_daos_mpi_ibcast(NULL, &map->obj, H5_DAOS_MINFO_BCAST_BUF_SIZE, TRUE, TRUE, NULL,
                                              item->file->my_rank == 0 ? H5_daos_map_open_bcast_comp_cb
                                                                       : H5_daos_map_open_recv_comp_cb,
                                              req, first_task, dep_task) < 0)
@@ -1241,14 +1859,9 @@ H5_daos_map_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             udata = NULL;
         } /* end if */
         else {
-            /* Open map */
-            if (0 != (ret = daos_obj_open(
-                          udata->bcast_udata.obj->item.file->coh, udata->bcast_udata.obj->oid,
-                          (udata->bcast_udata.obj->item.file->flags & H5F_ACC_RDWR ? DAOS_OO_RW : DAOS_OO_RO),
-                          &udata->bcast_udata.obj->obj_oh, NULL /*event*/)))
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, ret, "can't open map: %s", H5_daos_err_to_string(ret));
-
-            /* Finish building map object */
+            /* Finish building map object.  The map object itself is opened
+             * by a task that depends on this broadcast (see
+             * H5_daos_map_open_helper). */
             if (0 !=
                 (ret = H5_daos_map_open_end((H5_daos_map_t *)udata->bcast_udata.obj, p, ktype_buf_len,
                                             vtype_buf_len, mcpl_buf_len, udata->bcast_udata.req->dxpl_id)))
@@ -1378,6 +1991,25 @@ H5_daos_map_open_end(H5_daos_map_t *map, uint8_t *p, uint64_t ktype_buf_len, uin
     if (0 == (map->val_file_type_size = H5Tget_size(map->val_file_type_id)))
         D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get value file datatype size");
 
+    /* Check if values are stored out of line */
+    map->large_vals = (map->obj.oid.hi & H5_DAOS_MAP_LARGE_VALS) != 0;
+
+    /* Check if the map keeps its key-value pairs in a separate object under
+     * native uint64 dkeys.  That object is opened by a task that depends on
+     * this one (see H5_daos_map_data_open). */
+    if (map->obj.oid.hi & H5_DAOS_MAP_DKEY_UINT64) {
+        map->dkey_uint64 = TRUE;
+        if (H5_daos_map_data_oid_encode(map) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTENCODE, -H5_DAOS_H5_ENCODE_ERROR,
+                         "can't encode map data object ID");
+    } /* end if */
+    if (H5_daos_map_init_dkey_type(map) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_H5_GET_ERROR, "can't set key dkey datatype");
+
+    /* Attach the map to its shared state */
+    if (H5_daos_map_shared_attach(map, FALSE) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't attach shared map state");
+
     /* Fill OCPL cache */
     if (H5_daos_fill_ocpl_cache(&map->obj, map->mcpl_id) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_CPL_CACHE_ERROR, "failed to fill OCPL cache");
@@ -1592,1221 +2224,1236 @@ done:
 } /* end H5_daos_minfo_read_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_key_conv
- *
- * Purpose:     Converts the provided key from the source to destination
- *              type.  Handles vlens differently from other conversions in
- *              this connector, flattening them into a buffer.  Does not
- *              support nested vlens.
+ * Function:    H5_daos_map_data_oid_encode
  *
- * Parameters:  hid_t src_type_id: IN: Type ID that describes the data
- *                  currently in key.
- *              hid_t dst_type_id: IN: Type ID to convert data in key to.
- *              const void *key: IN: Buffer containing the key to be
- *                  converted.
- *              const void **key_buf: OUT: A pointer to a buffer
- *                  containing the converted key will be placed here.
- *              size_t *key_size: OUT: The size in bytes of the data
- *                  pointed to by *key_buf will be placed here.
- *              void **key_buf_alloc: OUT: A pointer to a buffer allocated
- *                  by this function to hold the key, if any, will be
- *                  placed here.  This must be freed by the caller when
- *                  key_buf is no longer needed.
- *              hid_t dxpl_id: IN: Dataset transfer property list ID.
+ * Purpose:     Creates the OID of the data object holding the key-value
+ *              pairs of a map with native uint64 dkeys from the map's
+ *              OID.  The data object uses the map's object index and
+ *              object class, and is distinguished from the map object by
+ *              the H5_DAOS_MAP_DATA_OBJ flag.
  *
- * Return:      Success:        0
- *              Failure:        -1
+ * Return:      Success:    0
+ *              Failure:    -1
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_map_key_conv(hid_t src_type_id, hid_t dst_type_id, const void *key, const void **key_buf,
-                     size_t *key_size, void **key_buf_alloc, hid_t dxpl_id)
+H5_daos_map_data_oid_encode(H5_daos_map_t *map)
 {
-    htri_t  need_tconv;
-    size_t  src_type_size;
-    size_t  dst_type_size;
-    hid_t   src_parent_type_id = H5I_INVALID_HID;
-    hid_t   dst_parent_type_id = H5I_INVALID_HID;
-    void   *tconv_buf          = NULL;
-    void   *bkg_buf            = NULL;
-    hbool_t fill_bkg           = FALSE;
-    herr_t  ret_value          = SUCCEED;
-
-    assert(src_type_id >= 0);
-    assert(dst_type_id >= 0);
-    assert(key);
-    assert(key_buf);
-    assert(key_size);
-    assert(key_buf_alloc);
-    assert(!*key_buf_alloc);
-
-    /* Check if type conversion is needed for the key */
-    if ((need_tconv = H5_daos_need_tconv(src_type_id, dst_type_id)) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
-    if (need_tconv) {
-        H5T_class_t type_class;
-
-        /* Get class */
-        if (H5T_NO_CLASS == (type_class = H5Tget_class(src_type_id)))
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get datatype class");
+    daos_oclass_id_t object_class;
+    herr_t           ret_value = SUCCEED;
 
-        /* Check for vlen */
-        if (type_class == H5T_VLEN) {
-            size_t       src_parent_type_size;
-            size_t       dst_parent_type_size;
-            const hvl_t *vl = (const hvl_t *)key;
-            htri_t       parent_need_tconv;
+    assert(map);
+    assert(map->obj.oid.hi & H5_DAOS_MAP_DKEY_UINT64);
+
+    /* Get object class id from the map's oid */
+#if CHECK_DAOS_API_VERSION(1, 6)
+    object_class = daos_obj_id2class(map->obj.oid);
+#else
+    object_class = ((map->obj.oid.hi & OID_FMT_CLASS_MASK) >> OID_FMT_CLASS_SHIFT) & 0xffff;
+#endif
+
+    /* Keep the lower 32 bits of the map's oid.hi (the part not set by DAOS)
+     * and mark the oid as a data object */
+    map->data_oid.lo = map->obj.oid.lo;
+    map->data_oid.hi = (map->obj.oid.hi & 0x00000000ffffffffull) | H5_DAOS_MAP_DATA_OBJ;
+
+    /* Generate oid */
+#if CHECK_DAOS_API_VERSION(2, 0)
+    if (daos_obj_generate_oid(map->obj.item.file->coh, &map->data_oid, DAOS_OT_DKEY_UINT64, object_class, 0,
+                              0) != 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTSET, FAIL, "can't generate map data object id");
+#else
+    if (daos_obj_generate_oid(map->obj.item.file->coh, &map->data_oid,
+                              DAOS_OF_DKEY_UINT64 | DAOS_OF_AKEY_LEXICAL, object_class, 0, 0) != 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTSET, FAIL, "can't generate map data object id");
+#endif
 
-            /* Check for empty key - currently unsupported */
-            if (vl->len == 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL, "vl key cannot have length of 0");
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_data_oid_encode() */
 
-            /* Get parent types */
-            if ((src_parent_type_id = H5Tget_super(src_type_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get source type parent");
-            if ((dst_parent_type_id = H5Tget_super(dst_type_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get destination type parent");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_data_open
+ *
+ * Purpose:     Creates a task to open the object holding the key-value
+ *              pairs of a map that keeps them under native uint64 dkeys.
+ *              Whether the map does so is only known once its metadata
+ *              has been read (or received from the leader), so the task
+ *              depends on *dep_task and completes without opening
+ *              anything if the map keeps its key-value pairs in the map
+ *              object itself.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_data_open(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                      tse_task_t **dep_task)
+{
+    H5_daos_map_data_open_ud_t *open_udata = NULL;
+    tse_task_t                 *open_task;
+    daos_obj_open_t            *open_args;
+    int                         ret;
+    herr_t                      ret_value = SUCCEED;
 
-            /* Check if type conversion is needed for the parent type */
-            if ((parent_need_tconv = H5_daos_need_tconv(src_parent_type_id, dst_parent_type_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
-            if (parent_need_tconv) {
-                /* Initialize type conversion */
-                if (H5_daos_tconv_init(src_parent_type_id, &src_parent_type_size, dst_parent_type_id,
-                                       &dst_parent_type_size, vl->len, FALSE, TRUE, &tconv_buf, &bkg_buf,
-                                       NULL, &fill_bkg) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-                /* If needed, fill the background buffer (with zeros) */
-                if (fill_bkg) {
-                    assert(bkg_buf);
-                    memset(bkg_buf, 0, vl->len * dst_parent_type_size);
-                } /* end if */
+    /* Set private data for object open */
+    if (NULL == (open_udata = (H5_daos_map_data_open_ud_t *)DV_malloc(sizeof(H5_daos_map_data_open_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate user data struct for map data object open task");
+    open_udata->generic_ud.req       = req;
+    open_udata->generic_ud.task_name = "map data object open";
+    open_udata->map                  = map;
+
+    /* Create task for object open */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_OPEN, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_map_data_open_prep_cb, H5_daos_generic_comp_cb, open_udata,
+                                 &open_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to open map data object");
+
+    /* Set arguments for object open (coh and oid will be set later by the
+     * prep callback) */
+    if (NULL == (open_args = daos_task_get_args(open_task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get arguments for object open task");
+    open_args->mode = map->obj.item.file->flags & H5F_ACC_RDWR ? DAOS_OO_RW : DAOS_OO_RO;
+    open_args->oh   = &map->data_oh;
+
+    /* Schedule object open task (or save it to be scheduled later) and give it
+     * a reference to req */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(open_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to open map data object: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = open_task;
+    req->rc++;
+    open_udata = NULL;
+    *dep_task  = open_task;
 
-                /* Copy data to type conversion buffer */
-                (void)memcpy(tconv_buf, vl->p, vl->len * src_parent_type_size);
+done:
+    /* Cleanup */
+    if (open_udata) {
+        assert(ret_value < 0);
+        open_udata = DV_free(open_udata);
+    } /* end if */
 
-                /* Perform type conversion */
-                if (H5Tconvert(src_parent_type_id, dst_parent_type_id, vl->len, tconv_buf, bkg_buf, dxpl_id) <
-                    0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_data_open() */
 
-                /* Set return values to point to converted buffer */
-                *key_buf       = (const void *)tconv_buf;
-                *key_size      = vl->len * dst_parent_type_size;
-                *key_buf_alloc = tconv_buf;
-                tconv_buf      = NULL;
-            }
-            else {
-                /* Just get parent size and set return values to point to vlen
-                 * buffer */
-                if (0 == (dst_parent_type_size = H5Tget_size(dst_parent_type_id)))
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
-                *key_buf  = vl->p;
-                *key_size = vl->len * dst_parent_type_size;
-            } /* end else */
-        }     /* end if */
-        else {
-            htri_t is_vl_str = FALSE;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_data_open_prep_cb
+ *
+ * Purpose:     Prepare callback for opening a map's data object.  Sets
+ *              the coh and oid, or completes the task without opening
+ *              anything if the map has no separate data object.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_data_open_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_data_open_ud_t *udata;
+    daos_obj_open_t            *open_args;
+    int                         ret_value = 0;
 
-            /* Check for VL string */
-            if (type_class == H5T_STRING)
-                if ((is_vl_str = H5Tis_variable_str(src_type_id)) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't check for variable length string");
-            if (is_vl_str) {
-                /* Set return values to point to string (exclude null terminator
-                 * since it's not needed */
-                *key_buf = (const void *)*((const char *const *)key);
-                if (*key_buf) {
-                    *key_size = strlen(*(const char *const *)key);
-
-                    /* If the key is '\0' (null string), write the null
-                     * terminator (to distinguish from NULL pointer) */
-                    if (*key_size == 0)
-                        *key_size = 1;
-                } /* end if */
-                else {
-                    /* If NULL was passed as the key, set the key to be the
-                     * magic value of {'\0', '\0'} */
-                    if (NULL == (*key_buf_alloc = DV_calloc(2)))
-                        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate space for NULL key");
-                    *key_buf  = (const void *)*key_buf_alloc;
-                    *key_size = 2;
-                } /* end else */
-            }     /* end if */
-            else {
-                /* Initialize type conversion */
-                if (H5_daos_tconv_init(src_type_id, &src_type_size, dst_type_id, &dst_type_size, 1, FALSE,
-                                       TRUE, &tconv_buf, &bkg_buf, NULL, &fill_bkg) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map data object open task");
 
-                /* If needed, fill the background buffer (with zeros) */
-                if (fill_bkg) {
-                    assert(bkg_buf);
-                    memset(bkg_buf, 0, dst_type_size);
-                } /* end if */
+    assert(udata->generic_ud.req);
+    assert(udata->map);
 
-                /* Copy data to type conversion buffer */
-                (void)memcpy(tconv_buf, key, src_type_size);
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->generic_ud.req, H5E_MAP);
 
-                /* Perform type conversion */
-                if (H5Tconvert(src_type_id, dst_type_id, 1, tconv_buf, bkg_buf, dxpl_id) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+    /* Nothing to open if the key-value pairs are in the map object */
+    if (!udata->map->dkey_uint64) {
+        tse_task_complete(task, 0);
+        D_GOTO_DONE(0);
+    } /* end if */
 
-                /* Set return values to point to converted buffer */
-                *key_buf       = (const void *)tconv_buf;
-                *key_size      = dst_type_size;
-                *key_buf_alloc = tconv_buf;
-                tconv_buf      = NULL;
-            } /* end else */
-        }     /* end else */
-    }         /* end if */
-    else {
-        /* Just get size and return key */
-        if (0 == (dst_type_size = H5Tget_size(dst_type_id)))
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
-        *key_buf  = key;
-        *key_size = dst_type_size;
-    } /* end else */
+    /* Set container open handle and oid in args */
+    if (NULL == (open_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for map data object open task");
+    open_args->coh = udata->map->obj.item.file->coh;
+    open_args->oid = udata->map->data_oid;
 
 done:
-    /* Cleanup */
-    if (src_parent_type_id > 0 && H5Tclose(src_parent_type_id) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close source type parent type");
-    if (dst_parent_type_id > 0 && H5Tclose(dst_parent_type_id) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close destination type parent type");
-    tconv_buf = DV_free(tconv_buf);
-    bkg_buf   = DV_free(bkg_buf);
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_key_conv() */
+} /* end H5_daos_map_data_open_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_key_conv_reverse
- *
- * Purpose:     Converts the provided key from the source to destination
- *              type.  Handles vlens differently from other conversions in
- *              this connector, un-flattening them into buffers and hvl_t
- *              / char * pointers.  Does not support nested vlens.
+ * Function:    H5_daos_map_oid_set_flags
  *
- * Parameters:  hid_t src_type_id: IN: Type ID that describes the data
- *                  currently in key.
- *              hid_t dst_type_id: IN: Type ID to convert data in key to.
- *              void *key: IN: Buffer containing the key to be converted.
- *                  This function may convert it in place or otherwise
- *                  change the contents of the buffer!
- *              size_t key_size: IN: Size in bytes of the data pointed to
- *                  by key.
- *              void **key_buf: OUT: A pointer to a buffer containing the
- *                  converted key will be placed here.
- *              void **key_buf_alloc: IN/OUT: On entry, optionally
- *                  contains a buffer of size *key_size.  On exit, will
- *                  contain either this buffer or another one that must
- *                  eventually be freed by the caller when key_buf is no
- *                  longer needed.
- *              H5_daos_vl_union_t *vl_union: IN: A pointer to a buffer
- *                  large enough to hold an H5_daos_vl_union_t.  Must not
- *                  be freed or go out of scope until key_buf is no longer
- *                  needed.
- *              hid_t dxpl_id: IN: Dataset transfer property list ID.
+ * Purpose:     Creates a task to set the flags in a newly created map's
+ *              OID for native uint64 dkeys and out of line values,
+ *              generate its data object's OID if it uses native uint64
+ *              dkeys, and attach the map to its shared state once the
+ *              OID is final.  Must be called after the task generating
+ *              the map's OID is in *dep_task.
  *
- * Return:      Success:        0
- *              Failure:        -1
+ * Return:      Success:    0
+ *              Failure:    -1
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_map_key_conv_reverse(hid_t src_type_id, hid_t dst_type_id, void *key, size_t key_size, void **key_buf,
-                             void **key_buf_alloc, H5_daos_vl_union_t *vl_union, hid_t dxpl_id)
+H5_daos_map_oid_set_flags(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                          tse_task_t **dep_task)
 {
-    htri_t  need_tconv;
-    size_t  src_type_size;
-    size_t  dst_type_size;
-    hid_t   src_parent_type_id = H5I_INVALID_HID;
-    hid_t   dst_parent_type_id = H5I_INVALID_HID;
-    void   *tconv_buf          = NULL;
-    void   *bkg_buf            = NULL;
-    hbool_t fill_bkg           = FALSE;
-    herr_t  ret_value          = SUCCEED;
+    H5_daos_map_oid_flags_ud_t *oid_udata = NULL;
+    tse_task_t                 *oid_task  = NULL;
+    int                         ret;
+    herr_t                      ret_value = SUCCEED;
 
-    assert(src_type_id >= 0);
-    assert(dst_type_id >= 0);
-    assert(key);
-    assert(key_size > 0);
-    assert(key_buf);
-    assert(key_buf_alloc);
-    assert(vl_union);
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-    /* Check if type conversion is needed for the key */
-    if ((need_tconv = H5_daos_need_tconv(src_type_id, dst_type_id)) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
-    if (need_tconv) {
-        H5T_class_t type_class;
+    /* Set up user data for OID flag setting */
+    if (NULL == (oid_udata = (H5_daos_map_oid_flags_ud_t *)DV_malloc(sizeof(H5_daos_map_oid_flags_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "failed to allocate buffer for map OID flag setting user data");
+    oid_udata->req = req;
+    oid_udata->map = map;
+
+    /* Create task to set OID flags */
+    if (H5_daos_create_task(H5_daos_map_oid_set_flags_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, oid_udata, &oid_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to set map OID flags");
+
+    /* Schedule OID flag setting task (or save it to be scheduled later) and
+     * give it a reference to req and the map */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(oid_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to set map OID flags: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = oid_task;
+    req->rc++;
+    map->obj.item.rc++;
+    oid_udata = NULL;
+    *dep_task = oid_task;
 
-        /* Get class */
-        if (H5T_NO_CLASS == (type_class = H5Tget_class(src_type_id)))
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get datatype class");
+done:
+    oid_udata = DV_free(oid_udata);
 
-        /* Check for vlen */
-        if (type_class == H5T_VLEN) {
-            size_t src_parent_type_size;
-            size_t dst_parent_type_size;
-            htri_t parent_need_tconv;
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_oid_set_flags() */
 
-            /* Get parent types */
-            if ((src_parent_type_id = H5Tget_super(src_type_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get source type parent");
-            if ((dst_parent_type_id = H5Tget_super(dst_type_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get destination type parent");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_oid_set_flags_task
+ *
+ * Purpose:     Asynchronous task for marking a new map's OID as using
+ *              native uint64 dkeys and/or out of line values, calling
+ *              H5_daos_map_data_oid_encode for maps with native uint64
+ *              dkeys, and attaching the map to its shared state.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_oid_set_flags_task(tse_task_t *task)
+{
+    H5_daos_map_oid_flags_ud_t *udata     = NULL;
+    int                         ret_value = 0;
 
-            /* Check if type conversion is needed for the parent type */
-            if ((parent_need_tconv = H5_daos_need_tconv(src_parent_type_id, dst_parent_type_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
-            if (parent_need_tconv) {
-                /* Get source parent type size */
-                if (0 == (src_parent_type_size = H5Tget_size(src_parent_type_id)))
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
+    assert(H5_daos_task_list_g);
 
-                /* Calculate sequence length */
-                if (key_size % src_parent_type_size)
-                    D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
-                                 "key size is not a multiple of source datatype size");
-                vl_union->vl.len = key_size / src_parent_type_size;
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map OID flag setting task");
 
-                /* Initialize type conversion */
-                if (H5_daos_tconv_init(src_parent_type_id, &src_parent_type_size, dst_parent_type_id,
-                                       &dst_parent_type_size, vl_union->vl.len, FALSE, FALSE, &tconv_buf,
-                                       &bkg_buf, NULL, &fill_bkg) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+    assert(udata->req);
+    assert(udata->map);
 
-                /* Note we could reuse buffers here if we change around some of
-                 * the logic in H5_daos_tconv_init() to support being passed the
-                 * source buffer instead of the destination buffer */
+    /* Check for previous errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_MAP);
 
-                /* Copy data to type conversion buffer */
-                (void)memcpy(tconv_buf, key, key_size);
+    /* Mark the map's oid so opens know how the key-value pairs are stored */
+    if (udata->map->large_vals)
+        udata->map->obj.oid.hi |= H5_DAOS_MAP_LARGE_VALS;
+    if (udata->map->dkey_uint64) {
+        udata->map->obj.oid.hi |= H5_DAOS_MAP_DKEY_UINT64;
 
-                /* If needed, fill the background buffer (with zeros) */
-                if (fill_bkg) {
-                    assert(bkg_buf);
-                    memset(bkg_buf, 0, vl_union->vl.len * dst_parent_type_size);
-                } /* end if */
+        if (H5_daos_map_data_oid_encode(udata->map) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTENCODE, -H5_DAOS_H5_ENCODE_ERROR,
+                         "can't encode map data object ID");
+    } /* end if */
 
-                /* Perform type conversion */
-                if (H5Tconvert(src_parent_type_id, dst_parent_type_id, vl_union->vl.len, tconv_buf, bkg_buf,
-                               dxpl_id) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+    /* Attach the map to its shared state.  The map is new so its entry count
+     * is empty. */
+    if (H5_daos_map_shared_attach(udata->map, TRUE) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't attach shared map state");
 
-                /* Set return values to point to converted buffer */
-                vl_union->vl.p = tconv_buf;
-                *key_buf       = (void *)&(vl_union->vl);
-                /*if(tconv_buf != key) {*/
-                *key_buf_alloc = tconv_buf;
-                tconv_buf      = NULL;
-                /*}*/ /* end if */
-            }
-            else {
-                /* Just get parent size and set return values to point to vlen
-                 * buffer */
-                if (0 == (dst_parent_type_size = H5Tget_size(dst_parent_type_id)))
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
+done:
+    /* Free private data if we haven't released ownership */
+    if (udata) {
+        /* Close map */
+        if (H5_daos_map_close_real(udata->map) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
 
-                /* Calculate sequence length */
-                if (key_size % dst_parent_type_size)
-                    D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
-                                 "key size is not a multiple of source datatype size");
-                vl_union->vl.len = key_size / dst_parent_type_size;
-                vl_union->vl.p   = key;
-                *key_buf         = (void *)&(vl_union->vl);
-            } /* end else */
-        }     /* end if */
-        else {
-            htri_t is_vl_str = FALSE;
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "map OID flag setting task";
+        } /* end if */
 
-            /* Check for VL string */
-            if (type_class == H5T_STRING)
-                if ((is_vl_str = H5Tis_variable_str(src_type_id)) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't check for variable length string");
-            if (is_vl_str) {
-                /* Check for magic value indicating key was passed as a NULL
-                 * pointer */
-                if (((char *)key)[0] == '\0' && key_size == 2)
-                    vl_union->vls = NULL;
-                else {
-                    /* Assign pointer and make sure it's NULL terminated */
-                    vl_union->vls = (char *)key;
-                    assert(vl_union->vls[key_size] == '\0');
-                } /* end if */
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-                /* Set return value to point to string  */
-                *key_buf = (void *)&(vl_union->vls);
-            } /* end if */
-            else {
-                /* Initialize type conversion */
-                if (H5_daos_tconv_init(src_type_id, &src_type_size, dst_type_id, &dst_type_size, 1, FALSE,
-                                       FALSE, &tconv_buf, &bkg_buf, NULL, &fill_bkg) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+        /* Free private data */
+        DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
-                /* Check size is correct */
-                if (key_size != src_type_size)
-                    D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
-                                 "key size does not match source datatype size");
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-                /* Note we could reuse buffers here if we change around some of
-                 * the logic in H5_daos_tconv_init() to support being passed the
-                 * source buffer instead of the destination buffer */
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
 
-                /* Copy data to type conversion buffer */
-                (void)memcpy(tconv_buf, key, src_type_size);
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_oid_set_flags_task() */
 
-                /* If needed, fill the background buffer (with zeros) */
-                if (fill_bkg) {
-                    assert(bkg_buf);
-                    memset(bkg_buf, 0, dst_type_size);
-                } /* end if */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_shared_attach
+ *
+ * Purpose:     Attaches a map handle to the state shared by the handles
+ *              open on the map in this process, creating the state if
+ *              this is the first such handle.  If the map was just
+ *              created, its entry count is known to be empty and its
+ *              Bloom filter, if it has one, is allocated empty.  Must be
+ *              called once the map's OID is final.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_shared_attach(H5_daos_map_t *map, hbool_t created)
+{
+    H5_daos_file_t       *file = map->obj.item.file;
+    H5_daos_map_shared_t *shared;
+    herr_t                ret_value = SUCCEED;
 
-                /* Perform type conversion */
-                if (H5Tconvert(src_type_id, dst_type_id, 1, tconv_buf, bkg_buf, dxpl_id) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+    assert(map);
+    assert(!map->shared);
 
-                /* Set return values to point to converted buffer */
-                *key_buf = tconv_buf;
-                /*if(tconv_buf != key) {*/
-                *key_buf_alloc = tconv_buf;
-                tconv_buf      = NULL;
-                /*}*/ /* end if */
-            }         /* end else */
-        }             /* end else */
-    }                 /* end if */
-    else
-        /* Just return key */
-        *key_buf = key;
+    /* Look for the map's state */
+    for (shared = H5_daos_map_shared_g; shared; shared = shared->next)
+        if (shared->oid.lo == map->obj.oid.lo && shared->oid.hi == map->obj.oid.hi &&
+            H5_DAOS_MAP_SHARED_IN_FILE(shared, file))
+            break;
 
-done:
-    /* Cleanup */
-    if (src_parent_type_id > 0 && H5Tclose(src_parent_type_id) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close source type parent type");
-    if (dst_parent_type_id > 0 && H5Tclose(dst_parent_type_id) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close destination type parent type");
-    if (tconv_buf && (tconv_buf != key))
-        DV_free(tconv_buf);
-    if (bkg_buf && (bkg_buf != key))
-        DV_free(bkg_buf);
+    /* Create it if necessary */
+    if (!shared) {
+        if (NULL == (shared = (H5_daos_map_shared_t *)DV_calloc(sizeof(H5_daos_map_shared_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate shared map state");
+        shared->oid  = map->obj.oid;
+        shared->rank = file->my_rank;
+        strcpy(shared->pool, file->facc_params.pool);
+        strcpy(shared->cont, file->cont);
+        if (created) {
+            shared->count_known = TRUE;
+            shared->nslots      = (uint64_t)file->num_procs;
+            if (map->bloom_size > 0) {
+                if (H5_daos_map_bloom_alloc(shared, map->bloom_size) < 0) {
+                    DV_free(shared);
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't allocate map Bloom filter");
+                } /* end if */
+                shared->bloom_loaded = TRUE;
+            } /* end if */
+        }     /* end if */
+        shared->next         = H5_daos_map_shared_g;
+        H5_daos_map_shared_g = shared;
+    } /* end if */
 
+    shared->rc++;
+    map->shared      = shared;
+    map->shared_next = shared->maps;
+    shared->maps     = map;
+
+done:
     D_FUNC_LEAVE;
-} /* end H5_daos_map_key_conv_reverse() */
+} /* end H5_daos_map_shared_attach() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_get_val
+ * Function:    H5_daos_map_shared_release
  *
- * Purpose:     Retrieves, from the Map specified by map_id, the value
- *              associated with the provided key.  key_mem_type_id and
- *              val_mem_type_id specify the datatypes for the provided key
- *              and value buffers. If key_mem_type_id is different from
- *              that used to create the Map object the key will be
- *              internally converted to the datatype for the map object
- *              for the query, and if val_mem_type_id is different from
- *              that used to create the Map object the returned value will
- *              be converted to val_mem_type_id before the function
- *              returns. Any further options can be specified through the
- *              property list dxpl_id.
+ * Purpose:     Detaches a map handle from the state shared by the handles
+ *              open on the map in this process, freeing the state if this
+ *              was the last such handle.  Any sync of the map must have
+ *              completed.
  *
- * Return:      Success:        0
- *              Failure:        -1, value not retrieved.
+ * Return:      Nothing
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_map_get_val(void *_map, hid_t key_mem_type_id, const void *key, hid_t val_mem_type_id, void *value,
-                    hid_t dxpl_id, void **req)
+static void
+H5_daos_map_shared_release(H5_daos_map_t *map)
 {
-    H5_daos_map_rw_ud_t  *get_val_udata = NULL;
-    H5_daos_tconv_reuse_t reuse         = H5_DAOS_TCONV_REUSE_NONE;
-    H5_daos_map_t        *map           = (H5_daos_map_t *)_map;
-    H5_daos_req_t        *int_req       = NULL;
-    tse_task_t           *first_task    = NULL;
-    tse_task_t           *dep_task      = NULL;
-    tse_task_t           *get_val_task  = NULL;
-    hbool_t               fill_bkg      = FALSE;
-    int                   ret;
-    herr_t                ret_value = SUCCEED;
+    H5_daos_map_shared_t **prev;
+    H5_daos_map_t        **prev_map;
 
-    if (!_map)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
-    if (!key)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
-    if (!value)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value is NULL");
+    assert(map);
 
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+    if (!map->shared)
+        return;
+
+    /* Unlink the handle */
+    for (prev_map = &map->shared->maps; *prev_map != map; prev_map = &(*prev_map)->shared_next)
+        assert(*prev_map);
+    *prev_map = map->shared_next;
+
+    if (--map->shared->rc == 0) {
+        assert(!map->shared->sync_tail);
+        assert(!map->shared->maps);
+
+        /* Unlink and free the state */
+        for (prev = &H5_daos_map_shared_g; *prev != map->shared; prev = &(*prev)->next)
+            assert(*prev);
+        *prev = map->shared->next;
+        DV_free(map->shared->bloom);
+        DV_free(map->shared->bloom_rec_key);
+        DV_free(map->shared);
+    } /* end if */
 
-    /* Start H5 operation */
-    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map get value", map->obj.item.open_req,
-                                              NULL, NULL, dxpl_id)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    map->shared      = NULL;
+    map->shared_next = NULL;
+} /* end H5_daos_map_shared_release() */
 
-    /* Wait for the map to open if necessary */
-    if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        if (map->obj.item.open_req->status != 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
-    } /* end if */
-
-    /* Allocate argument struct for key value retrieval task */
-    if (NULL == (get_val_udata = (H5_daos_map_rw_ud_t *)DV_calloc(sizeof(H5_daos_map_rw_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "can't allocate buffer for map key value retrieval task arguments");
-    get_val_udata->md_rw_cb_ud.req = int_req;
-    get_val_udata->md_rw_cb_ud.obj = &map->obj;
-    get_val_udata->val_mem_type_id = val_mem_type_id;
-    get_val_udata->value_buf       = value;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_init_dkey_type
+ *
+ * Purpose:     Sets the datatype keys are converted to for use as dkeys.
+ *              For maps with native uint64 dkeys this is the native
+ *              64 bit integer type with the key type's signedness, so
+ *              DAOS can interpret the dkey directly and keys already in
+ *              that type need no conversion.  Otherwise it is the key's
+ *              file type.  Must be called after key_type_id and
+ *              key_file_type_id are set.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_init_dkey_type(H5_daos_map_t *map)
+{
+    H5T_sign_t key_sign;
+    herr_t     ret_value = SUCCEED;
 
-    /* Convert key (if necessary) */
-    if (H5_daos_map_key_conv(key_mem_type_id, map->key_file_type_id, key, &get_val_udata->key_buf,
-                             &get_val_udata->key_size, &get_val_udata->key_buf_alloc, dxpl_id) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
+    assert(map);
 
-    /* Set up dkey */
-    daos_const_iov_set((d_const_iov_t *)&get_val_udata->md_rw_cb_ud.dkey, get_val_udata->key_buf,
-                       (daos_size_t)get_val_udata->key_size);
-    get_val_udata->md_rw_cb_ud.free_dkey = FALSE;
+    if (map->dkey_uint64) {
+        if (H5T_SGN_ERROR == (key_sign = H5Tget_sign(map->key_type_id)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get key datatype sign");
+        map->key_dkey_type_id = key_sign == H5T_SGN_NONE ? H5T_NATIVE_UINT64 : H5T_NATIVE_INT64;
+    } /* end if */
+    else
+        map->key_dkey_type_id = map->key_file_type_id;
 
-    /* Check if the type conversion is needed */
-    if ((get_val_udata->val_need_tconv = H5_daos_need_tconv(map->val_file_type_id, val_mem_type_id)) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_init_dkey_type() */
 
-    /* Type conversion */
-    if (get_val_udata->val_need_tconv) {
-        /* Initialize type conversion */
-        if (H5_daos_tconv_init(map->val_file_type_id, &get_val_udata->val_file_type_size, val_mem_type_id,
-                               &get_val_udata->val_mem_type_size, 1, FALSE, FALSE, &get_val_udata->tconv_buf,
-                               &get_val_udata->bkg_buf, &reuse, &fill_bkg) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_rw_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous fetches and updates of
+ *              key-value pairs in a map.  Like H5_daos_md_rw_prep_cb,
+ *              but uses the object holding the map's key-value pairs.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_rw_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_md_rw_cb_ud_t *udata;
+    daos_obj_rw_t         *rw_args;
+    int                    ret_value = 0;
 
-        /* Reuse buffer as appropriate */
-        if (reuse == H5_DAOS_TCONV_REUSE_TCONV)
-            get_val_udata->tconv_buf = value;
-        else if (reuse == H5_DAOS_TCONV_REUSE_BKG)
-            get_val_udata->bkg_buf = value;
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map I/O task");
 
-        /* Fill background buffer if necessary */
-        if (fill_bkg && (get_val_udata->bkg_buf != value))
-            (void)memcpy(get_val_udata->bkg_buf, value, get_val_udata->val_mem_type_size);
+    assert(udata->req);
+    assert(udata->obj);
 
-        /* Set up sgl_iov to point to tconv_buf */
-        daos_iov_set(&get_val_udata->md_rw_cb_ud.sg_iov[0], get_val_udata->tconv_buf,
-                     (daos_size_t)get_val_udata->val_file_type_size);
-        get_val_udata->md_rw_cb_ud.free_sg_iov[0] = TRUE;
-    } /* end if */
-    else {
-        get_val_udata->val_file_type_size = map->val_file_type_size;
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_MAP);
 
-        /* Set up sgl_iov to point to value */
-        daos_iov_set(&get_val_udata->md_rw_cb_ud.sg_iov[0], value,
-                     (daos_size_t)get_val_udata->val_file_type_size);
-    } /* end else */
+    assert(udata->obj->item.type == H5I_MAP);
 
-    /* Set up iod */
-    memset(&get_val_udata->md_rw_cb_ud.iod[0], 0, sizeof(daos_iod_t));
-    daos_const_iov_set((d_const_iov_t *)&get_val_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_map_key_g,
-                       H5_daos_map_key_size_g);
-    get_val_udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
-    get_val_udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)get_val_udata->val_file_type_size;
-    get_val_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+    /* Set task arguments */
+    if (NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for map I/O task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh    = H5_DAOS_MAP_DATA_OH((H5_daos_map_t *)udata->obj);
+    rw_args->th    = udata->req->th;
+    rw_args->flags = udata->flags;
+    rw_args->dkey  = &udata->dkey;
+    rw_args->nr    = udata->nr;
+    rw_args->iods  = udata->iod;
+    rw_args->sgls  = udata->sgl;
 
-    get_val_udata->md_rw_cb_ud.free_akeys = FALSE;
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
-    /* Set up sgl */
-    get_val_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
-    get_val_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-    get_val_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &get_val_udata->md_rw_cb_ud.sg_iov[0];
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_rw_prep_cb() */
 
-    /* Set nr */
-    get_val_udata->md_rw_cb_ud.nr = 1u;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_val_io_init
+ *
+ * Purpose:     Sets up the iods and sgls for a fetch or update of len
+ *              bytes starting at offset of a single map value, using buf
+ *              for the value.  Maps that store their values out of line
+ *              use a byte array extent under the Map Value akey, plus the
+ *              value's descriptor under the Map Record akey so fetches
+ *              can tell whether the key exists.  The descriptor is
+ *              encoded in val_io for updates.  Other maps use a single
+ *              value under the Map Record akey, in which case offset must
+ *              be 0 and len the size of the value.  iods, sgls and
+ *              sg_iovs must have room for 2 entries.
+ *
+ * Return:      Number of iods set up (cannot fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+H5_daos_map_val_io_init(H5_daos_map_t *map, H5_daos_map_val_io_t *val_io, daos_iod_t *iods,
+                        daos_sg_list_t *sgls, daos_iov_t *sg_iovs, void *buf, size_t offset, size_t len)
+{
+    uint8_t *p;
 
-    /* Set task name */
-    get_val_udata->md_rw_cb_ud.task_name = "map key value retrieval";
+    assert(map);
+    assert(val_io);
+    assert(iods);
+    assert(sgls);
+    assert(sg_iovs);
+
+    /* Set up value sgl */
+    daos_iov_set(&sg_iovs[0], buf, (daos_size_t)len);
+    sgls[0].sg_nr     = 1;
+    sgls[0].sg_nr_out = 0;
+    sgls[0].sg_iovs   = &sg_iovs[0];
+
+    /* Set up value iod */
+    memset(&iods[0], 0, sizeof(daos_iod_t));
+    iods[0].iod_nr = 1u;
+    if (!map->large_vals) {
+        assert(offset == 0);
+        daos_const_iov_set((d_const_iov_t *)&iods[0].iod_name, H5_daos_map_key_g, H5_daos_map_key_size_g);
+        iods[0].iod_size = (daos_size_t)len;
+        iods[0].iod_type = DAOS_IOD_SINGLE;
+
+        return 1u;
+    } /* end if */
 
-    /* Create task to read map key value */
-    assert(!dep_task);
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
-                                 H5_daos_map_get_val_comp_cb, get_val_udata, &get_val_task) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map key value");
+    val_io->recx.rx_idx = (uint64_t)offset;
+    val_io->recx.rx_nr  = (uint64_t)len;
+    daos_const_iov_set((d_const_iov_t *)&iods[0].iod_name, H5_daos_map_val_key_g, H5_daos_map_val_key_size_g);
+    iods[0].iod_size  = 1;
+    iods[0].iod_recxs = &val_io->recx;
+    iods[0].iod_type  = DAOS_IOD_ARRAY;
+
+    /* Encode descriptor */
+    p = val_io->desc_buf;
+    UINT64ENCODE(p, (uint64_t)map->val_file_type_size)
+
+    /* Set up descriptor iod and sgl */
+    memset(&iods[1], 0, sizeof(daos_iod_t));
+    daos_const_iov_set((d_const_iov_t *)&iods[1].iod_name, H5_daos_map_key_g, H5_daos_map_key_size_g);
+    iods[1].iod_nr   = 1u;
+    iods[1].iod_size = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+    iods[1].iod_type = DAOS_IOD_SINGLE;
+    daos_iov_set(&sg_iovs[1], val_io->desc_buf, (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+    sgls[1].sg_nr     = 1;
+    sgls[1].sg_nr_out = 0;
+    sgls[1].sg_iovs   = &sg_iovs[1];
+
+    return 2u;
+} /* end H5_daos_map_val_io_init() */
 
-    /* Save map key value read task to be scheduled later and give
-     * it a reference to req and the map object */
-    assert(!first_task);
-    first_task = get_val_task;
-    dep_task   = get_val_task;
-    int_req->rc++;
-    map->obj.item.rc++;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_val_io_found
+ *
+ * Purpose:     Checks whether a fetch set up with
+ *              H5_daos_map_val_io_init found the key, and for maps that
+ *              store their values out of line that the fetched
+ *              descriptor matches the map's value size.
+ *
+ * Return:      Success:        TRUE if the key exists, FALSE if not
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5_daos_map_val_io_found(H5_daos_map_t *map, const H5_daos_map_val_io_t *val_io, const daos_iod_t *iods)
+{
+    const uint8_t *p;
+    uint64_t       val_len;
+    htri_t         ret_value = TRUE;
 
-    get_val_udata = NULL;
+    assert(map);
+    assert(val_io);
+    assert(iods);
+
+    if (!map->large_vals)
+        D_GOTO_DONE(iods[0].iod_size != 0);
+
+    /* Check descriptor */
+    if (iods[1].iod_size == 0)
+        D_GOTO_DONE(FALSE);
+    if (iods[1].iod_size != (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "map value descriptor has wrong size");
+    p = val_io->desc_buf;
+    UINT64DECODE(p, val_len)
+    if (val_len != (uint64_t)map->val_file_type_size)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "map value length does not match value datatype size");
 
 done:
-    if (int_req) {
-        /* Create task to finalize H5 operation */
-        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, int_req, &int_req->finalize_task) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
-        /* Schedule finalize task */
-        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
-                         H5_daos_err_to_string(ret));
-        else
-            /* finalize_task now owns a reference to req */
-            int_req->rc++;
-
-        /* If there was an error during setup, pass it to the request */
-        if (ret_value < 0)
-            int_req->status = -H5_DAOS_SETUP_ERROR;
-
-        /* Add the request to the map's request queue.  This will add the
-         * dependency on the map open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
-                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
-
-        /* Check for external async */
-        if (req) {
-            /* Return int_req as req */
-            *req = int_req;
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_val_io_found() */
 
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_conv_cache_reset
+ *
+ * Purpose:     Releases the key conversion plan cached on a map, if any.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_key_conv_cache_reset(H5_daos_map_key_conv_cache_t *cache)
+{
+    herr_t ret_value = SUCCEED;
 
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
-                             "map key value read operation failed in task \"%s\": %s", int_req->failed_task,
-                             H5_daos_err_to_string(int_req->status));
+    assert(cache);
 
-            /* Close internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* end else */
-    }     /* end if */
+    if (cache->mem_type_id != H5I_INVALID_HID && H5Tclose(cache->mem_type_id) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close key memory datatype");
+    if (cache->mem_parent_type_id != H5I_INVALID_HID && H5Tclose(cache->mem_parent_type_id) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close key memory type parent type");
+    if (cache->dkey_parent_type_id != H5I_INVALID_HID && H5Tclose(cache->dkey_parent_type_id) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close key dkey type parent type");
 
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        if (get_val_udata) {
-            if (get_val_udata->tconv_buf && (get_val_udata->tconv_buf != value)) {
-                DV_free(get_val_udata->tconv_buf);
-                get_val_udata->tconv_buf = NULL;
-            }
-            if (get_val_udata->bkg_buf && (get_val_udata->bkg_buf != value)) {
-                DV_free(get_val_udata->bkg_buf);
-                get_val_udata->bkg_buf = NULL;
-            }
-            get_val_udata->key_buf_alloc = DV_free(get_val_udata->key_buf_alloc);
-        }
-        get_val_udata = DV_free(get_val_udata);
-    } /* end if */
+    memset(cache, 0, sizeof(*cache));
+    cache->mem_type_id         = H5I_INVALID_HID;
+    cache->mem_parent_type_id  = H5I_INVALID_HID;
+    cache->dkey_parent_type_id = H5I_INVALID_HID;
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_get_val() */
+} /* end H5_daos_map_key_conv_cache_reset() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_get_val_comp_cb
+ * Function:    H5_daos_map_key_conv_plan
  *
- * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
- *              the value of a specified key in a map object. Currently
- *              checks for a failed task then frees private data.
+ * Purpose:     Determines how keys in the memory datatype
+ *              key_mem_type_id are converted to the map's dkey datatype
+ *              and caches the result on the map, replacing any previously
+ *              cached plan.
  *
  * Return:      Success:        0
- *              Failure:        Error code
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_map_get_val_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_map_key_conv_plan(H5_daos_map_t *map, hid_t key_mem_type_id)
 {
-    H5_daos_map_rw_ud_t *udata;
-    int                  ret_value = 0;
+    H5_daos_map_key_conv_cache_t *cache = &map->key_conv_cache;
+    htri_t                        need_tconv;
+    hbool_t                       fill_bkg  = FALSE;
+    herr_t                        ret_value = SUCCEED;
 
-    assert(H5_daos_task_list_g);
+    assert(map);
+    assert(key_mem_type_id >= 0);
+    assert(map->key_dkey_type_id >= 0);
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+    /* Release previous plan */
+    if (H5_daos_map_key_conv_cache_reset(cache) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release key conversion plan");
 
-    assert(udata->md_rw_cb_ud.req);
-    assert(udata->md_rw_cb_ud.req->file);
+    /* Check if type conversion is needed for the key */
+    if ((need_tconv = H5_daos_need_tconv(key_mem_type_id, map->key_dkey_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+    if (need_tconv) {
+        H5T_class_t type_class;
 
-    /* Handle errors in fetch task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->md_rw_cb_ud.req->status      = task->dt_result;
-        udata->md_rw_cb_ud.req->failed_task = "map key value fetch";
-    } /* end if */
-    else if (task->dt_result == 0) {
-        H5_daos_map_t *map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+        /* Get class */
+        if (H5T_NO_CLASS == (type_class = H5Tget_class(key_mem_type_id)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get datatype class");
 
-        assert(map);
+        /* Check for vlen */
+        if (type_class == H5T_VLEN) {
+            htri_t parent_need_tconv;
 
-        /* Check for missing key-value pair */
-        if (udata->md_rw_cb_ud.iod[0].iod_size == (uint64_t)0)
-            D_GOTO_ERROR(H5E_MAP, H5E_NOTFOUND, -H5_DAOS_H5_GET_ERROR, "key not found");
+            /* Get parent types */
+            if ((cache->mem_parent_type_id = H5Tget_super(key_mem_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get source type parent");
+            if ((cache->dkey_parent_type_id = H5Tget_super(map->key_dkey_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get destination type parent");
 
-        /* Perform type conversion if necessary */
-        if (udata->val_need_tconv) {
-            /* Type conversion */
-            if (H5Tconvert(map->val_file_type_id, udata->val_mem_type_id, 1, udata->tconv_buf, udata->bkg_buf,
-                           udata->md_rw_cb_ud.req->dxpl_id) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
-                             "can't perform type conversion");
+            /* Get parent sizes */
+            if (0 == (cache->mem_size = H5Tget_size(cache->mem_parent_type_id)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
+            if (0 == (cache->dkey_size = H5Tget_size(cache->dkey_parent_type_id)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
 
-            /* Copy to user's buffer if necessary */
-            if (udata->value_buf != udata->tconv_buf)
-                (void)memcpy(udata->value_buf, udata->tconv_buf, udata->val_mem_type_size);
-        } /* end if */
-    }     /* end else */
+            /* Check if type conversion is needed for the parent type */
+            if ((parent_need_tconv =
+                     H5_daos_need_tconv(cache->mem_parent_type_id, cache->dkey_parent_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+            if (parent_need_tconv) {
+                cache->kind = H5_DAOS_MAP_KEY_CONV_VLEN_ELEM;
+                if ((cache->need_bkg = H5_daos_need_bkg(cache->mem_parent_type_id, cache->dkey_parent_type_id,
+                                                        TRUE, &cache->dkey_size, &fill_bkg)) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't check if background buffer needed");
+            } /* end if */
+            else {
+                /* Parent types are not needed for conversion */
+                cache->kind = H5_DAOS_MAP_KEY_CONV_VLEN;
+                if (H5Tclose(cache->mem_parent_type_id) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close source type parent type");
+                cache->mem_parent_type_id = H5I_INVALID_HID;
+                if (H5Tclose(cache->dkey_parent_type_id) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close destination type parent type");
+                cache->dkey_parent_type_id = H5I_INVALID_HID;
+            } /* end else */
+        }     /* end if */
+        else {
+            htri_t is_vl_str = FALSE;
+
+            /* Check for VL string */
+            if (type_class == H5T_STRING)
+                if ((is_vl_str = H5Tis_variable_str(key_mem_type_id)) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't check for variable length string");
+            if (is_vl_str)
+                cache->kind = H5_DAOS_MAP_KEY_CONV_VL_STR;
+            else {
+                cache->kind = H5_DAOS_MAP_KEY_CONV_FIXED;
+                if (0 == (cache->mem_size = H5Tget_size(key_mem_type_id)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
+                if ((cache->need_bkg = H5_daos_need_bkg(key_mem_type_id, map->key_dkey_type_id, TRUE,
+                                                        &cache->dkey_size, &fill_bkg)) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't check if background buffer needed");
+            } /* end else */
+        }     /* end else */
+    }         /* end if */
+    else {
+        cache->kind = H5_DAOS_MAP_KEY_CONV_NONE;
+        if (0 == (cache->dkey_size = H5Tget_size(map->key_dkey_type_id)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
+    } /* end else */
+
+    /* Keep a private copy of the memory datatype to compare later keys
+     * against, so the application's ID is not pinned by the map */
+    if ((cache->mem_type_id = H5Tcopy(key_mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, FAIL, "can't copy key memory datatype");
 
 done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
-    /* Clean up */
-    if (udata) {
-        /* Close map */
-        if (udata->md_rw_cb_ud.obj && H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
-
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->md_rw_cb_ud.req->status      = ret_value;
-            udata->md_rw_cb_ud.req->failed_task = "map key value read completion callback";
-        } /* end if */
-
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-        /* Free private data */
-        if (udata->tconv_buf && (udata->tconv_buf != udata->value_buf))
-            DV_free(udata->tconv_buf);
-        if (udata->bkg_buf && (udata->bkg_buf != udata->value_buf))
-            DV_free(udata->bkg_buf);
-        if (udata->key_buf_alloc)
-            DV_free(udata->key_buf_alloc);
-        udata = DV_free(udata);
-    } /* end if */
-    else
-        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+    /* Cleanup on failure */
+    if (ret_value < 0 && H5_daos_map_key_conv_cache_reset(cache) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release key conversion plan");
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_get_val_comp_cb() */
+} /* end H5_daos_map_key_conv_plan() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_put
+ * Function:    H5_daos_map_key_conv
  *
- * Purpose:     Adds a key-value pair to the Map specified by map_id, or
- *              updates the value for the specified key if one was set
- *              previously. key_mem_type_id and val_mem_type_id specify
- *              the datatypes for the provided key and value buffers, and
- *              if different from those used to create the Map object, the
- *              key and value will be internally converted to the
- *              datatypes for the map object. Any further options can be
- *              specified through the property list dxpl_id.
+ * Purpose:     Converts the provided key from the memory type to the
+ *              map's dkey type.  Handles vlens differently from other
+ *              conversions in this connector, flattening them into a
+ *              buffer.  Does not support nested vlens.
+ *
+ *              How keys in key_mem_type_id are converted is determined
+ *              once and cached on the map, so repeated operations with
+ *              the same memory type only compare it against a private
+ *              copy of the cached type instead of rebuilding the plan.
+ *              An equal memory type under a different ID (such as the
+ *              copy made for a deferred operation) reuses the plan.
+ *              Keys that need no conversion are returned in place, and
+ *              converted keys that fit are placed in key_buf_local
+ *              instead of a newly allocated buffer.
+ *
+ * Parameters:  H5_daos_map_t *map: IN: Map the key is for.
+ *              hid_t key_mem_type_id: IN: Type ID that describes the
+ *                  data currently in key.
+ *              const void *key: IN: Buffer containing the key to be
+ *                  converted.
+ *              const void **key_buf: OUT: A pointer to a buffer
+ *                  containing the converted key will be placed here.
+ *              size_t *key_size: OUT: The size in bytes of the data
+ *                  pointed to by *key_buf will be placed here.
+ *              void *key_buf_local: IN: Buffer of
+ *                  H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE bytes that may be
+ *                  used to hold the converted key, or NULL.  It must
+ *                  remain valid as long as key_buf is needed.
+ *              void **key_buf_alloc: OUT: A pointer to a buffer allocated
+ *                  by this function to hold the key, if any, will be
+ *                  placed here.  This must be freed by the caller when
+ *                  key_buf is no longer needed.
+ *              hid_t dxpl_id: IN: Dataset transfer property list ID.
  *
  * Return:      Success:        0
- *              Failure:        -1, value not set.
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_map_put(void *_map, hid_t key_mem_type_id, const void *key, hid_t val_mem_type_id, const void *value,
-                hid_t dxpl_id, void H5VL_DAOS_UNUSED **req)
+static herr_t
+H5_daos_map_key_conv(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key, const void **key_buf,
+                     size_t *key_size, void *key_buf_local, void **key_buf_alloc, hid_t dxpl_id)
 {
-    H5_daos_map_rw_ud_t *write_udata = NULL;
-    H5_daos_map_t       *map         = (H5_daos_map_t *)_map;
-    union {
-        const void *const_buf;
-        void       *buf;
-    } safe_value                     = {.const_buf = value};
-    H5_daos_req_t *int_req           = NULL;
-    tse_task_t    *first_task        = NULL;
-    tse_task_t    *dep_task          = NULL;
-    tse_task_t    *bkg_buf_fill_task = NULL;
-    tse_task_t    *write_task        = NULL;
-    hbool_t        fill_bkg          = FALSE;
-    int            ret;
-    herr_t         ret_value = SUCCEED;
+    H5_daos_map_key_conv_cache_t *cache = &map->key_conv_cache;
+    uint8_t                       bkg_buf_local[H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE];
+    hid_t                         src_type_id;
+    hid_t                         dst_type_id;
+    const void                   *src_buf;
+    size_t                        nelem;
+    size_t                        conv_size;
+    htri_t                        types_equal = FALSE;
+    void                         *tconv_buf   = NULL;
+    void                         *bkg_buf     = NULL;
+    herr_t                        ret_value   = SUCCEED;
 
-    if (!_map)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
-    if (!key)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
-    if (!value)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value is NULL");
-
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
-
-    /* Check for write access */
-    if (!(map->obj.item.file->flags & H5F_ACC_RDWR))
-        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
-
-    /* Start H5 operation */
-    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map put value", map->obj.item.open_req,
-                                              NULL, NULL, dxpl_id)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
-
-    /* Wait for the map to open if necessary */
-    if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        if (map->obj.item.open_req->status != 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
-    } /* end if */
-
-    /* Allocate argument struct for key-value pair write task */
-    if (NULL == (write_udata = (H5_daos_map_rw_ud_t *)DV_calloc(sizeof(H5_daos_map_rw_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "can't allocate buffer for map key-value write task arguments");
-    write_udata->md_rw_cb_ud.req = int_req;
-    write_udata->md_rw_cb_ud.obj = &map->obj;
-    write_udata->val_mem_type_id = val_mem_type_id;
-    write_udata->value_buf       = safe_value.buf;
-
-    /* Convert key (if necessary) */
-    if (H5_daos_map_key_conv(key_mem_type_id, map->key_file_type_id, key, &write_udata->key_buf,
-                             &write_udata->key_size, &write_udata->key_buf_alloc, dxpl_id) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
-
-    /* Set up dkey */
-    daos_const_iov_set((d_const_iov_t *)&write_udata->md_rw_cb_ud.dkey, write_udata->key_buf,
-                       (daos_size_t)write_udata->key_size);
-    write_udata->md_rw_cb_ud.free_dkey = FALSE;
+    assert(map);
+    assert(key_mem_type_id >= 0);
+    assert(key);
+    assert(key_buf);
+    assert(key_size);
+    assert(key_buf_alloc);
+    assert(!*key_buf_alloc);
 
-    /* Check if the type conversion is needed */
-    if ((write_udata->val_need_tconv = H5_daos_need_tconv(map->val_file_type_id, val_mem_type_id)) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+    /* Determine how to convert keys in this memory type, if not cached.
+     * The cache holds its own copy of the type, so any ID for an equal
+     * type (including the copy made for a deferred operation) reuses the
+     * cached plan instead of replacing it. */
+    if (cache->mem_type_id != H5I_INVALID_HID &&
+        (types_equal = H5Tequal(cache->mem_type_id, key_mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't compare key memory datatypes");
+    if (!types_equal && H5_daos_map_key_conv_plan(map, key_mem_type_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't determine key conversion");
+
+    switch (cache->kind) {
+        case H5_DAOS_MAP_KEY_CONV_NONE:
+            /* Just return key */
+            *key_buf  = key;
+            *key_size = cache->dkey_size;
+            D_GOTO_DONE(SUCCEED);
+
+        case H5_DAOS_MAP_KEY_CONV_VL_STR:
+            /* Set return values to point to string (exclude null terminator
+             * since it's not needed */
+            *key_buf = (const void *)*((const char *const *)key);
+            if (*key_buf) {
+                *key_size = strlen(*(const char *const *)key);
+
+                /* If the key is '\0' (null string), write the null
+                 * terminator (to distinguish from NULL pointer) */
+                if (*key_size == 0)
+                    *key_size = 1;
+            } /* end if */
+            else {
+                /* If NULL was passed as the key, set the key to be the
+                 * magic value of {'\0', '\0'} */
+                if (key_buf_local)
+                    memset(key_buf_local, 0, 2);
+                else if (NULL == (*key_buf_alloc = DV_calloc(2)))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate space for NULL key");
+                *key_buf  = key_buf_local ? (const void *)key_buf_local : (const void *)*key_buf_alloc;
+                *key_size = 2;
+            } /* end else */
+            D_GOTO_DONE(SUCCEED);
 
-    /* Type conversion */
-    if (write_udata->val_need_tconv) {
-        /* Initialize type conversion */
-        if (H5_daos_tconv_init(val_mem_type_id, &write_udata->val_mem_type_size, map->val_file_type_id,
-                               &write_udata->val_file_type_size, 1, FALSE, TRUE, &write_udata->tconv_buf,
-                               &write_udata->bkg_buf, NULL, &fill_bkg) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
-    } /* end if */
-    else
-        write_udata->val_file_type_size = map->val_file_type_size;
+        case H5_DAOS_MAP_KEY_CONV_VLEN: {
+            const hvl_t *vl = (const hvl_t *)key;
 
-    /* Set up iod */
-    memset(&write_udata->md_rw_cb_ud.iod[0], 0, sizeof(daos_iod_t));
-    daos_const_iov_set((d_const_iov_t *)&write_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_map_key_g,
-                       H5_daos_map_key_size_g);
-    write_udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
-    write_udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)write_udata->val_file_type_size;
-    write_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+            /* Check for empty key - currently unsupported */
+            if (vl->len == 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL, "vl key cannot have length of 0");
 
-    write_udata->md_rw_cb_ud.free_akeys = FALSE;
+            /* Set return values to point to vlen buffer */
+            *key_buf  = vl->p;
+            *key_size = vl->len * cache->dkey_size;
+            D_GOTO_DONE(SUCCEED);
+        } /* end block */
 
-    /* Set up constant sgl info */
-    write_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
-    write_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-    write_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &write_udata->md_rw_cb_ud.sg_iov[0];
+        case H5_DAOS_MAP_KEY_CONV_VLEN_ELEM: {
+            const hvl_t *vl = (const hvl_t *)key;
 
-    /* Set nr */
-    write_udata->md_rw_cb_ud.nr = 1u;
+            /* Check for empty key - currently unsupported */
+            if (vl->len == 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL, "vl key cannot have length of 0");
 
-    /* Check for type conversion */
-    if (write_udata->val_need_tconv) {
-        /* Check if we need to fill background buffer */
-        if (fill_bkg) {
-            assert(write_udata->bkg_buf);
+            src_type_id = cache->mem_parent_type_id;
+            dst_type_id = cache->dkey_parent_type_id;
+            src_buf     = vl->p;
+            nelem       = vl->len;
+            break;
+        } /* end block */
 
-            /* Read data from map to background buffer */
-            daos_iov_set(&write_udata->md_rw_cb_ud.sg_iov[0], write_udata->bkg_buf,
-                         (daos_size_t)write_udata->val_file_type_size);
+        case H5_DAOS_MAP_KEY_CONV_FIXED:
+            src_type_id = cache->mem_type_id;
+            dst_type_id = map->key_dkey_type_id;
+            src_buf     = key;
+            nelem       = 1;
+            break;
 
-            /* Create task to read data from map to background buffer */
-            assert(!dep_task);
-            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
-                                         H5_daos_map_put_fill_comp_cb, write_udata, &bkg_buf_fill_task) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
-                             "can't create task to read data from map to background buffer");
+        default:
+            D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "invalid key conversion");
+    } /* end switch */
 
-            /* Save background buffer data read task to be scheduled later and give
-             * it a reference to req and the map object */
-            first_task = bkg_buf_fill_task;
-            dep_task   = bkg_buf_fill_task;
-            int_req->rc++;
-            map->obj.item.rc++;
+    /* Set up type conversion buffer, using the local buffer if the key
+     * fits */
+    conv_size = nelem * (cache->mem_size > cache->dkey_size ? cache->mem_size : cache->dkey_size);
+    if (key_buf_local && conv_size <= H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE)
+        tconv_buf = key_buf_local;
+    else if (NULL == (tconv_buf = *key_buf_alloc = DV_malloc(conv_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate type conversion buffer");
+
+    /* Set up background buffer (filled with zeros) if needed */
+    if (cache->need_bkg) {
+        if (nelem * cache->dkey_size <= sizeof(bkg_buf_local)) {
+            memset(bkg_buf_local, 0, nelem * cache->dkey_size);
+            bkg_buf = bkg_buf_local;
         } /* end if */
-        else {
-            /* Copy data to type conversion buffer */
-            (void)memcpy(write_udata->tconv_buf, value, (size_t)write_udata->val_mem_type_size);
-
-            /* Perform type conversion */
-            if (H5Tconvert(val_mem_type_id, map->val_file_type_id, 1, write_udata->tconv_buf,
-                           write_udata->bkg_buf, dxpl_id) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
-
-            /* Set sgl to write from tconv_buf */
-            daos_iov_set(&write_udata->md_rw_cb_ud.sg_iov[0], write_udata->tconv_buf,
-                         (daos_size_t)write_udata->val_file_type_size);
-        } /* end else */
-
-        write_udata->md_rw_cb_ud.free_sg_iov[0] = TRUE;
+        else if (NULL == (bkg_buf = DV_calloc(nelem * cache->dkey_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate background buffer");
     } /* end if */
-    else
-        /* Set sgl to write from value */
-        daos_const_iov_set((d_const_iov_t *)&write_udata->md_rw_cb_ud.sg_iov[0], value,
-                           (daos_size_t)write_udata->val_file_type_size);
-
-    /* Set task name */
-    write_udata->md_rw_cb_ud.task_name = "map key-value write";
 
-    /* Create task to write key-value pair to map */
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
-                                 H5_daos_md_rw_prep_cb, H5_daos_map_put_comp_cb, write_udata,
-                                 &write_task) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write key-value pair to map");
+    /* Copy data to type conversion buffer */
+    (void)memcpy(tconv_buf, src_buf, nelem * cache->mem_size);
 
-    /* Save map key-value write task to be scheduled later and give
-     * it a reference to req and the map object */
-    if (first_task) {
-        if (0 != (ret = tse_task_schedule(write_task, false)))
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
-                         "can't schedule task to write key-value pair to map: %s",
-                         H5_daos_err_to_string(ret));
-    }
-    else
-        first_task = write_task;
-    dep_task = write_task;
-    int_req->rc++;
-    map->obj.item.rc++;
+    /* Perform type conversion */
+    if (H5Tconvert(src_type_id, dst_type_id, nelem, tconv_buf, bkg_buf, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
 
-    write_udata = NULL;
+    /* Set return values to point to converted buffer */
+    *key_buf  = (const void *)tconv_buf;
+    *key_size = nelem * cache->dkey_size;
 
 done:
-    if (int_req) {
-        /* Create task to finalize H5 operation */
-        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, int_req, &int_req->finalize_task) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
-        /* Schedule finalize task */
-        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
-                         H5_daos_err_to_string(ret));
-        else
-            /* finalize_task now owns a reference to req */
-            int_req->rc++;
-
-        /* If there was an error during setup, pass it to the request */
-        if (ret_value < 0)
-            int_req->status = -H5_DAOS_SETUP_ERROR;
-
-        /* Add the request to the map's request queue.  This will add the
-         * dependency on the map open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_WRITE,
-                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
-
-        /* Check for external async */
-        if (req) {
-            /* Return int_req as req */
-            *req = int_req;
-
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
-                             "map key-value write operation failed in task \"%s\": %s", int_req->failed_task,
-                             H5_daos_err_to_string(int_req->status));
-
-            /* Close internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* end else */
-    }     /* end if */
-
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        if (write_udata) {
-            if (write_udata->tconv_buf && (write_udata->tconv_buf != value)) {
-                DV_free(write_udata->tconv_buf);
-                write_udata->tconv_buf = NULL;
-            }
-            if (write_udata->bkg_buf && (write_udata->bkg_buf != value)) {
-                DV_free(write_udata->bkg_buf);
-                write_udata->bkg_buf = NULL;
-            }
-            write_udata->key_buf_alloc = DV_free(write_udata->key_buf_alloc);
-        }
-        write_udata = DV_free(write_udata);
-    } /* end if */
+    /* Cleanup */
+    if (bkg_buf != (void *)bkg_buf_local)
+        bkg_buf = DV_free(bkg_buf);
+    if (ret_value < 0)
+        *key_buf_alloc = DV_free(*key_buf_alloc);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_put() */
+} /* end H5_daos_map_key_conv() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_put_fill_comp_cb
+ * Function:    H5_daos_map_key_conv_reverse
  *
- * Purpose:     Complete callback for asynchronous daos_obj_fetch to fill
- *              a type conversion background buffer when performing a map
- *              "put" operation that requires type conversion. Currently
- *              checks for a failed task and then performs type conversion.
+ * Purpose:     Converts the provided key from the source to destination
+ *              type.  Handles vlens differently from other conversions in
+ *              this connector, un-flattening them into buffers and hvl_t
+ *              / char * pointers.  Does not support nested vlens.
+ *
+ * Parameters:  hid_t src_type_id: IN: Type ID that describes the data
+ *                  currently in key.
+ *              hid_t dst_type_id: IN: Type ID to convert data in key to.
+ *              void *key: IN: Buffer containing the key to be converted.
+ *                  This function may convert it in place or otherwise
+ *                  change the contents of the buffer!
+ *              size_t key_size: IN: Size in bytes of the data pointed to
+ *                  by key.
+ *              void **key_buf: OUT: A pointer to a buffer containing the
+ *                  converted key will be placed here.
+ *              void **key_buf_alloc: IN/OUT: On entry, optionally
+ *                  contains a buffer of size *key_size.  On exit, will
+ *                  contain either this buffer or another one that must
+ *                  eventually be freed by the caller when key_buf is no
+ *                  longer needed.
+ *              H5_daos_vl_union_t *vl_union: IN: A pointer to a buffer
+ *                  large enough to hold an H5_daos_vl_union_t.  Must not
+ *                  be freed or go out of scope until key_buf is no longer
+ *                  needed.
+ *              hid_t dxpl_id: IN: Dataset transfer property list ID.
  *
  * Return:      Success:        0
- *              Failure:        Error code
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_map_put_fill_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_map_key_conv_reverse(hid_t src_type_id, hid_t dst_type_id, void *key, size_t key_size, void **key_buf,
+                             void **key_buf_alloc, H5_daos_vl_union_t *vl_union, hid_t dxpl_id)
 {
-    H5_daos_map_rw_ud_t *udata;
-    int                  ret_value = 0;
+    htri_t  need_tconv;
+    size_t  src_type_size;
+    size_t  dst_type_size;
+    hid_t   src_parent_type_id = H5I_INVALID_HID;
+    hid_t   dst_parent_type_id = H5I_INVALID_HID;
+    void   *tconv_buf          = NULL;
+    void   *bkg_buf            = NULL;
+    hbool_t fill_bkg           = FALSE;
+    herr_t  ret_value          = SUCCEED;
 
-    assert(H5_daos_task_list_g);
+    assert(src_type_id >= 0);
+    assert(dst_type_id >= 0);
+    assert(key);
+    assert(key_size > 0);
+    assert(key_buf);
+    assert(key_buf_alloc);
+    assert(vl_union);
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+    /* Check if type conversion is needed for the key */
+    if ((need_tconv = H5_daos_need_tconv(src_type_id, dst_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+    if (need_tconv) {
+        H5T_class_t type_class;
 
-    assert(udata->md_rw_cb_ud.req);
-    assert(udata->md_rw_cb_ud.req->file);
+        /* Get class */
+        if (H5T_NO_CLASS == (type_class = H5Tget_class(src_type_id)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get datatype class");
 
-    /* Handle errors in fetch task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->md_rw_cb_ud.req->status      = task->dt_result;
-        udata->md_rw_cb_ud.req->failed_task = "map put background buffer fill task";
-    } /* end if */
-    else if (task->dt_result == 0) {
-        H5_daos_map_t *map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+        /* Check for vlen */
+        if (type_class == H5T_VLEN) {
+            size_t src_parent_type_size;
+            size_t dst_parent_type_size;
+            htri_t parent_need_tconv;
 
-        assert(map);
+            /* Get parent types */
+            if ((src_parent_type_id = H5Tget_super(src_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get source type parent");
+            if ((dst_parent_type_id = H5Tget_super(dst_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get destination type parent");
 
-        /* Reset iod_size; if the key was not created then it could have
-         * been overwritten by daos_obj_fetch */
-        udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)udata->val_file_type_size;
+            /* Check if type conversion is needed for the parent type */
+            if ((parent_need_tconv = H5_daos_need_tconv(src_parent_type_id, dst_parent_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+            if (parent_need_tconv) {
+                /* Get source parent type size */
+                if (0 == (src_parent_type_size = H5Tget_size(src_parent_type_id)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
 
-        /* Copy data to type conversion buffer */
-        (void)memcpy(udata->tconv_buf, udata->value_buf, (size_t)udata->val_mem_type_size);
+                /* Calculate sequence length */
+                if (key_size % src_parent_type_size)
+                    D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                                 "key size is not a multiple of source datatype size");
+                vl_union->vl.len = key_size / src_parent_type_size;
 
-        /* Perform type conversion */
-        if (H5Tconvert(udata->val_mem_type_id, map->val_file_type_id, 1, udata->tconv_buf, udata->bkg_buf,
-                       udata->md_rw_cb_ud.req->dxpl_id) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+                /* Initialize type conversion */
+                if (H5_daos_tconv_init(src_parent_type_id, &src_parent_type_size, dst_parent_type_id,
+                                       &dst_parent_type_size, vl_union->vl.len, FALSE, FALSE, &tconv_buf,
+                                       &bkg_buf, NULL, &fill_bkg) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
 
-        /* Set sgl to write from tconv_buf */
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->tconv_buf, (daos_size_t)udata->val_file_type_size);
-    } /* end else */
+                /* Note we could reuse buffers here if we change around some of
+                 * the logic in H5_daos_tconv_init() to support being passed the
+                 * source buffer instead of the destination buffer */
 
-done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+                /* Copy data to type conversion buffer */
+                (void)memcpy(tconv_buf, key, key_size);
 
-    /* Clean up */
-    if (udata) {
-        /* Close map */
-        if (udata->md_rw_cb_ud.obj && H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+                /* If needed, fill the background buffer (with zeros) */
+                if (fill_bkg) {
+                    assert(bkg_buf);
+                    memset(bkg_buf, 0, vl_union->vl.len * dst_parent_type_size);
+                } /* end if */
 
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->md_rw_cb_ud.req->status      = ret_value;
-            udata->md_rw_cb_ud.req->failed_task = "map put background buffer fill completion callback";
-        } /* end if */
+                /* Perform type conversion */
+                if (H5Tconvert(src_parent_type_id, dst_parent_type_id, vl_union->vl.len, tconv_buf, bkg_buf,
+                               dxpl_id) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
 
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-    } /* end if */
+                /* Set return values to point to converted buffer */
+                vl_union->vl.p = tconv_buf;
+                *key_buf       = (void *)&(vl_union->vl);
+                /*if(tconv_buf != key) {*/
+                *key_buf_alloc = tconv_buf;
+                tconv_buf      = NULL;
+                /*}*/ /* end if */
+            }
+            else {
+                /* Just get parent size and set return values to point to vlen
+                 * buffer */
+                if (0 == (dst_parent_type_size = H5Tget_size(dst_parent_type_id)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't get size of datatype");
+
+                /* Calculate sequence length */
+                if (key_size % dst_parent_type_size)
+                    D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                                 "key size is not a multiple of source datatype size");
+                vl_union->vl.len = key_size / dst_parent_type_size;
+                vl_union->vl.p   = key;
+                *key_buf         = (void *)&(vl_union->vl);
+            } /* end else */
+        }     /* end if */
+        else {
+            htri_t is_vl_str = FALSE;
+
+            /* Check for VL string */
+            if (type_class == H5T_STRING)
+                if ((is_vl_str = H5Tis_variable_str(src_type_id)) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't check for variable length string");
+            if (is_vl_str) {
+                /* Check for magic value indicating key was passed as a NULL
+                 * pointer */
+                if (((char *)key)[0] == '\0' && key_size == 2)
+                    vl_union->vls = NULL;
+                else {
+                    /* Assign pointer and make sure it's NULL terminated */
+                    vl_union->vls = (char *)key;
+                    assert(vl_union->vls[key_size] == '\0');
+                } /* end if */
+
+                /* Set return value to point to string  */
+                *key_buf = (void *)&(vl_union->vls);
+            } /* end if */
+            else {
+                /* Initialize type conversion */
+                if (H5_daos_tconv_init(src_type_id, &src_type_size, dst_type_id, &dst_type_size, 1, FALSE,
+                                       FALSE, &tconv_buf, &bkg_buf, NULL, &fill_bkg) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+
+                /* Check size is correct */
+                if (key_size != src_type_size)
+                    D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                                 "key size does not match source datatype size");
+
+                /* Note we could reuse buffers here if we change around some of
+                 * the logic in H5_daos_tconv_init() to support being passed the
+                 * source buffer instead of the destination buffer */
+
+                /* Copy data to type conversion buffer */
+                (void)memcpy(tconv_buf, key, src_type_size);
+
+                /* If needed, fill the background buffer (with zeros) */
+                if (fill_bkg) {
+                    assert(bkg_buf);
+                    memset(bkg_buf, 0, dst_type_size);
+                } /* end if */
+
+                /* Perform type conversion */
+                if (H5Tconvert(src_type_id, dst_type_id, 1, tconv_buf, bkg_buf, dxpl_id) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+
+                /* Set return values to point to converted buffer */
+                *key_buf = tconv_buf;
+                /*if(tconv_buf != key) {*/
+                *key_buf_alloc = tconv_buf;
+                tconv_buf      = NULL;
+                /*}*/ /* end if */
+            }         /* end else */
+        }             /* end else */
+    }                 /* end if */
     else
-        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+        /* Just return key */
+        *key_buf = key;
+
+done:
+    /* Cleanup */
+    if (src_parent_type_id > 0 && H5Tclose(src_parent_type_id) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close source type parent type");
+    if (dst_parent_type_id > 0 && H5Tclose(dst_parent_type_id) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close destination type parent type");
+    if (tconv_buf && (tconv_buf != key))
+        DV_free(tconv_buf);
+    if (bkg_buf && (bkg_buf != key))
+        DV_free(bkg_buf);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_put_fill_comp_cb() */
+} /* end H5_daos_map_key_conv_reverse() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_put_comp_cb
+ * Function:    H5_daos_map_get_val
  *
- * Purpose:     Complete callback for asynchronous daos_obj_update to add
- *              a new key-value pair to a map object or to update an
- *              existing key-value pair in a map object. Currently checks
- *              for a failed task then frees private data.
+ * Purpose:     Retrieves, from the Map specified by map_id, the value
+ *              associated with the provided key.  key_mem_type_id and
+ *              val_mem_type_id specify the datatypes for the provided key
+ *              and value buffers. If key_mem_type_id is different from
+ *              that used to create the Map object the key will be
+ *              internally converted to the datatype for the map object
+ *              for the query, and if val_mem_type_id is different from
+ *              that used to create the Map object the returned value will
+ *              be converted to val_mem_type_id before the function
+ *              returns. Any further options can be specified through the
+ *              property list dxpl_id.
  *
  * Return:      Success:        0
- *              Failure:        Error code
- *
- *-------------------------------------------------------------------------
- */
-static int
-H5_daos_map_put_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
-{
-    H5_daos_map_rw_ud_t *udata;
-    int                  ret_value = 0;
-
-    assert(H5_daos_task_list_g);
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
-
-    assert(udata->md_rw_cb_ud.req);
-    assert(udata->md_rw_cb_ud.req->file);
-
-    /* Close map */
-    if (udata->md_rw_cb_ud.obj && H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
-
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
-    /* Handle errors in update task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->md_rw_cb_ud.req->status      = task->dt_result;
-        udata->md_rw_cb_ud.req->failed_task = "map key-value write";
-    } /* end if */
-
-    /* Release our reference to req */
-    if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-    /* Free private data */
-    if (udata->tconv_buf && (udata->tconv_buf != udata->value_buf))
-        DV_free(udata->tconv_buf);
-    if (udata->bkg_buf && (udata->bkg_buf != udata->value_buf))
-        DV_free(udata->bkg_buf);
-    if (udata->key_buf_alloc)
-        DV_free(udata->key_buf_alloc);
-    udata = DV_free(udata);
-
-done:
-    D_FUNC_LEAVE;
-} /* end H5_daos_map_put_comp_cb() */
-
-/*-------------------------------------------------------------------------
- * Function:    H5_daos_map_exists
- *
- * Purpose:     Check if the specified key exists in the map. The result
- *              will be returned via the "exists" parameter.
- *
- * Return:      Success:        0
- *              Failure:        -1
+ *              Failure:        -1, value not retrieved.
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_map_exists(void *_map, hid_t key_mem_type_id, const void *key, hbool_t *exists, hid_t dxpl_id,
-                   void **req)
+H5_daos_map_get_val(void *_map, hid_t key_mem_type_id, const void *key, hid_t val_mem_type_id, void *value,
+                    hid_t dxpl_id, void **req)
 {
-    H5_daos_map_exists_ud_t *exists_udata    = NULL;
-    H5_daos_map_t           *map             = (H5_daos_map_t *)_map;
-    H5_daos_req_t           *int_req         = NULL;
-    tse_task_t              *first_task      = NULL;
-    tse_task_t              *dep_task        = NULL;
-    tse_task_t              *map_exists_task = NULL;
-    int                      ret;
-    herr_t                   ret_value = SUCCEED;
+    H5_daos_map_t *map        = (H5_daos_map_t *)_map;
+    H5_daos_req_t *int_req    = NULL;
+    tse_task_t    *first_task = NULL;
+    tse_task_t    *dep_task   = NULL;
+    int            ret;
+    herr_t         ret_value = SUCCEED;
 
     if (!_map)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
     if (!key)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
-    if (!exists)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map exists pointer is NULL");
+    if (!value)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value is NULL");
 
     H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
     /* Start H5 operation */
-    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map key existence check",
-                                              map->obj.item.open_req, NULL, NULL, H5I_INVALID_HID)))
+    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map get value", map->obj.item.open_req,
+                                              NULL, NULL, dxpl_id)))
         D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
 
-    /* Wait for the map to open if necessary */
-    if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        if (map->obj.item.open_req->status != 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    /* Check if we can call the internal routine directly - the map open
+     * must be complete.  Otherwise defer it to a task that runs once the
+     * map is open, so this function does not block. */
+    if (map->obj.item.created || map->obj.item.open_req->status == 0) {
+        if (H5_daos_map_get_val_int(map, key_mem_type_id, key, val_mem_type_id, value, dxpl_id, int_req,
+                                    &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't read map key value");
     } /* end if */
-
-    /* Allocate argument struct for key existence checking task */
-    if (NULL == (exists_udata = (H5_daos_map_exists_ud_t *)DV_calloc(sizeof(H5_daos_map_exists_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "can't allocate buffer for map key existence check task arguments");
-    exists_udata->exists_ret      = exists;
-    exists_udata->md_rw_cb_ud.req = int_req;
-    exists_udata->md_rw_cb_ud.obj = &map->obj;
-
-    /* Convert key (if necessary) */
-    if (H5_daos_map_key_conv(key_mem_type_id, map->key_file_type_id, key, &exists_udata->key_buf,
-                             &exists_udata->key_size, &exists_udata->key_buf_alloc, dxpl_id) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
-
-    /* Set up dkey */
-    daos_const_iov_set((d_const_iov_t *)&exists_udata->md_rw_cb_ud.dkey, exists_udata->key_buf,
-                       (daos_size_t)exists_udata->key_size);
-    exists_udata->md_rw_cb_ud.free_dkey = FALSE;
-
-    /* Set up iod */
-    memset(&exists_udata->md_rw_cb_ud.iod[0], 0, sizeof(daos_iod_t));
-    daos_const_iov_set((d_const_iov_t *)&exists_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_map_key_g,
-                       H5_daos_map_key_size_g);
-    exists_udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
-    exists_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
-    exists_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
-
-    exists_udata->md_rw_cb_ud.free_akeys = FALSE;
-
-    /* Set nr */
-    exists_udata->md_rw_cb_ud.nr = 1u;
-
-    /* Set task name */
-    exists_udata->md_rw_cb_ud.task_name = "map key existence check";
-
-    /* Create task to read map metadata size */
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_exists_prep_cb,
-                                 H5_daos_map_exists_comp_cb, exists_udata, &map_exists_task) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map metadata size");
-
-    /* Save map metadata size read task to be scheduled later and give
-     * it a reference to req and the map object */
-    assert(!first_task);
-    first_task = map_exists_task;
-    dep_task   = map_exists_task;
-    int_req->rc++;
-    map->obj.item.rc++;
-
-    exists_udata = NULL;
+    else if (H5_daos_map_io_defer(map, H5_DAOS_MAP_IO_GET_VAL, key_mem_type_id, key, val_mem_type_id, value,
+                                  NULL, int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map key value");
 
 done:
     if (int_req) {
-        assert(map);
-
         /* Create task to finalize H5 operation */
         if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
                                 NULL, int_req, &int_req->finalize_task) < 0)
@@ -2846,7 +3493,7 @@ done:
             /* Check for failure */
             if (int_req->status < 0)
                 D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
-                             "map key exists operation failed in task \"%s\": %s", int_req->failed_task,
+                             "map key value read operation failed in task \"%s\": %s", int_req->failed_task,
                              H5_daos_err_to_string(int_req->status));
 
             /* Close internal request */
@@ -2855,71 +3502,137 @@ done:
         } /* end else */
     }     /* end if */
 
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        if (exists_udata)
-            exists_udata->key_buf_alloc = DV_free(exists_udata->key_buf_alloc);
-        exists_udata = DV_free(exists_udata);
-    } /* end if */
-
     D_FUNC_LEAVE;
-} /* end H5_daos_map_exists() */
+} /* end H5_daos_map_get_val() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_exists_prep_cb
+ * Function:    H5_daos_map_get_val_int
  *
- * Purpose:     Prepare callback for asynchronous daos_obj_fetch to check
- *              if a specified key value exists in a map object.
+ * Purpose:     Internal version of H5_daos_map_get_val().  The map must
+ *              be open.  Creates the task to read the value but does not
+ *              schedule it, instead returning it in *first_task.
  *
  * Return:      Success:        0
- *              Failure:        Error code
+ *              Failure:        -1, value not retrieved.
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_map_exists_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_map_get_val_int(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key, hid_t val_mem_type_id,
+                        void *value, hid_t dxpl_id, H5_daos_req_t *req, tse_task_t **first_task,
+                        tse_task_t **dep_task)
 {
-    H5_daos_map_exists_ud_t *udata;
-    daos_obj_rw_t           *rw_args;
-    int                      ret_value = 0;
+    H5_daos_map_rw_ud_t  *get_val_udata = NULL;
+    H5_daos_tconv_reuse_t reuse         = H5_DAOS_TCONV_REUSE_NONE;
+    tse_task_t           *get_val_task  = NULL;
+    hbool_t               fill_bkg      = FALSE;
+    herr_t                ret_value     = SUCCEED;
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for metadata I/O task");
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-    assert(udata->md_rw_cb_ud.req);
+    /* Allocate argument struct for key value retrieval task */
+    if (NULL == (get_val_udata = (H5_daos_map_rw_ud_t *)DV_calloc(sizeof(H5_daos_map_rw_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for map key value retrieval task arguments");
+    get_val_udata->md_rw_cb_ud.req = req;
+    get_val_udata->md_rw_cb_ud.obj = &map->obj;
+    get_val_udata->val_mem_type_id = H5I_INVALID_HID;
+    get_val_udata->value_buf       = value;
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_MAP);
+    /* Convert key (if necessary) */
+    if (H5_daos_map_key_conv(map, key_mem_type_id, key, &get_val_udata->key_buf, &get_val_udata->key_size,
+                             get_val_udata->key_buf_local, &get_val_udata->key_buf_alloc, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
 
-    assert(udata->md_rw_cb_ud.obj);
-    assert(udata->md_rw_cb_ud.req->file);
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&get_val_udata->md_rw_cb_ud.dkey, get_val_udata->key_buf,
+                       (daos_size_t)get_val_udata->key_size);
+    get_val_udata->md_rw_cb_ud.free_dkey = FALSE;
 
-    /* Set fetch task arguments */
-    if (NULL == (rw_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for metadata I/O task");
-    memset(rw_args, 0, sizeof(*rw_args));
-    rw_args->oh    = udata->md_rw_cb_ud.obj->obj_oh;
-    rw_args->th    = udata->md_rw_cb_ud.req->th;
-    rw_args->flags = udata->md_rw_cb_ud.flags;
-    rw_args->dkey  = &udata->md_rw_cb_ud.dkey;
-    rw_args->nr    = udata->md_rw_cb_ud.nr;
-    rw_args->iods  = udata->md_rw_cb_ud.iod;
+    /* Check if the type conversion is needed */
+    if ((get_val_udata->val_need_tconv = H5_daos_need_tconv(map->val_file_type_id, val_mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+
+    /* Type conversion */
+    if (get_val_udata->val_need_tconv) {
+        /* Copy memory type, it is needed after this function returns */
+        if ((get_val_udata->val_mem_type_id = H5Tcopy(val_mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, FAIL, "can't copy value memory datatype");
+
+        /* Initialize type conversion */
+        if (H5_daos_tconv_init(map->val_file_type_id, &get_val_udata->val_file_type_size, val_mem_type_id,
+                               &get_val_udata->val_mem_type_size, 1, FALSE, FALSE, &get_val_udata->tconv_buf,
+                               &get_val_udata->bkg_buf, &reuse, &fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+
+        /* Reuse buffer as appropriate */
+        if (reuse == H5_DAOS_TCONV_REUSE_TCONV)
+            get_val_udata->tconv_buf = value;
+        else if (reuse == H5_DAOS_TCONV_REUSE_BKG)
+            get_val_udata->bkg_buf = value;
+
+        /* Fill background buffer if necessary */
+        if (fill_bkg && (get_val_udata->bkg_buf != value))
+            (void)memcpy(get_val_udata->bkg_buf, value, get_val_udata->val_mem_type_size);
+
+        /* The sgl will point to tconv_buf */
+        get_val_udata->md_rw_cb_ud.free_sg_iov[0] = TRUE;
+    } /* end if */
+    else
+        get_val_udata->val_file_type_size = map->val_file_type_size;
+
+    /* Set up iods and sgls to read into tconv_buf or value, and set nr */
+    get_val_udata->md_rw_cb_ud.nr =
+        H5_daos_map_val_io_init(map, &get_val_udata->val_io, get_val_udata->md_rw_cb_ud.iod,
+                                get_val_udata->md_rw_cb_ud.sgl, get_val_udata->md_rw_cb_ud.sg_iov,
+                                get_val_udata->val_need_tconv ? get_val_udata->tconv_buf : value, 0,
+                                get_val_udata->val_file_type_size);
+
+    get_val_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set task name */
+    get_val_udata->md_rw_cb_ud.task_name = "map key value retrieval";
+
+    /* Create task to read map key value */
+    assert(!*dep_task);
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_rw_prep_cb,
+                                 H5_daos_map_get_val_comp_cb, get_val_udata, &get_val_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map key value");
+
+    /* Save map key value read task to be scheduled later and give
+     * it a reference to req and the map object */
+    assert(!*first_task);
+    *first_task = get_val_task;
+    *dep_task   = get_val_task;
+    req->rc++;
+    map->obj.item.rc++;
+
+    get_val_udata = NULL;
 
 done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
+    /* Cleanup on failure */
+    if (ret_value < 0 && get_val_udata) {
+        if (get_val_udata->tconv_buf && (get_val_udata->tconv_buf != value))
+            DV_free(get_val_udata->tconv_buf);
+        if (get_val_udata->bkg_buf && (get_val_udata->bkg_buf != value))
+            DV_free(get_val_udata->bkg_buf);
+        if (get_val_udata->val_mem_type_id >= 0 && H5Tclose(get_val_udata->val_mem_type_id) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close value memory datatype");
+        DV_free(get_val_udata->key_buf_alloc);
+        get_val_udata = DV_free(get_val_udata);
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_exists_prep_cb() */
+} /* end H5_daos_map_get_val_int() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_exists_comp_cb
+ * Function:    H5_daos_map_get_val_comp_cb
  *
- * Purpose:     Complete callback for asynchronous daos_obj_fetch to check
- *              if a specified key value exists in a map object. Currently
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
+ *              the value of a specified key in a map object. Currently
  *              checks for a failed task then frees private data.
  *
  * Return:      Success:        0
@@ -2928,33 +3641,52 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_map_exists_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_map_get_val_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_map_exists_ud_t *udata;
-    int                      ret_value = 0;
+    H5_daos_map_rw_ud_t *udata;
+    int                  ret_value = 0;
 
     assert(H5_daos_task_list_g);
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for metadata I/O task");
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
 
     assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.req->file);
 
     /* Handle errors in fetch task.  Only record error in udata->req_status if
      * it does not already contain an error (it could contain an error if
      * another task this task is not dependent on also failed). */
     if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
         udata->md_rw_cb_ud.req->status      = task->dt_result;
-        udata->md_rw_cb_ud.req->failed_task = "map key exists fetch";
+        udata->md_rw_cb_ud.req->failed_task = "map key value fetch";
     } /* end if */
     else if (task->dt_result == 0) {
-        assert(udata->md_rw_cb_ud.req->file);
+        H5_daos_map_t *map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+        htri_t         found;
 
-        /* Set output */
-        *udata->exists_ret = (udata->md_rw_cb_ud.iod[0].iod_size != 0);
-    } /* end if */
+        assert(map);
+
+        /* Check for missing key-value pair */
+        if ((found = H5_daos_map_val_io_found(map, &udata->val_io, udata->md_rw_cb_ud.iod)) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, -H5_DAOS_H5_GET_ERROR, "can't check map value");
+        if (!found)
+            D_GOTO_ERROR(H5E_MAP, H5E_NOTFOUND, -H5_DAOS_H5_GET_ERROR, "key not found");
+
+        /* Perform type conversion if necessary */
+        if (udata->val_need_tconv) {
+            /* Type conversion */
+            if (H5Tconvert(map->val_file_type_id, udata->val_mem_type_id, 1, udata->tconv_buf, udata->bkg_buf,
+                           udata->md_rw_cb_ud.req->dxpl_id) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't perform type conversion");
+
+            /* Copy to user's buffer if necessary */
+            if (udata->value_buf != udata->tconv_buf)
+                (void)memcpy(udata->value_buf, udata->tconv_buf, udata->val_mem_type_size);
+        } /* end if */
+    }     /* end else */
 
 done:
     /* Return task to task list */
@@ -2972,7 +3704,7 @@ done:
          * H5_daos_req_free_int, which updates req->status if it sees an error */
         if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
             udata->md_rw_cb_ud.req->status      = ret_value;
-            udata->md_rw_cb_ud.req->failed_task = "map key exists completion callback";
+            udata->md_rw_cb_ud.req->failed_task = "map key value read completion callback";
         } /* end if */
 
         /* Release our reference to req */
@@ -2980,6 +3712,13 @@ done:
             D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
         /* Free private data */
+        if (udata->val_mem_type_id >= 0 && H5Tclose(udata->val_mem_type_id) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                         "can't close value memory datatype");
+        if (udata->tconv_buf && (udata->tconv_buf != udata->value_buf))
+            DV_free(udata->tconv_buf);
+        if (udata->bkg_buf && (udata->bkg_buf != udata->value_buf))
+            DV_free(udata->bkg_buf);
         if (udata->key_buf_alloc)
             DV_free(udata->key_buf_alloc);
         udata = DV_free(udata);
@@ -2988,148 +3727,69 @@ done:
         assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_exists_comp_cb() */
+} /* end H5_daos_map_get_val_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_get
+ * Function:    H5_daos_map_put
  *
- * Purpose:     Gets certain information about a map
+ * Purpose:     Adds a key-value pair to the Map specified by map_id, or
+ *              updates the value for the specified key if one was set
+ *              previously. key_mem_type_id and val_mem_type_id specify
+ *              the datatypes for the provided key and value buffers, and
+ *              if different from those used to create the Map object, the
+ *              key and value will be internally converted to the
+ *              datatypes for the map object. Any further options can be
+ *              specified through the property list dxpl_id.
  *
  * Return:      Success:        0
- *              Failure:        -1
+ *              Failure:        -1, value not set.
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_map_get(void *_map, H5VL_map_args_t *map_args, hid_t dxpl_id, void H5VL_DAOS_UNUSED **req)
+H5_daos_map_put(void *_map, hid_t key_mem_type_id, const void *key, hid_t val_mem_type_id, const void *value,
+                hid_t dxpl_id, void **req)
 {
-    H5_daos_map_t *map        = (H5_daos_map_t *)_map;
+    H5_daos_map_t *map = (H5_daos_map_t *)_map;
+    union {
+        const void *const_buf;
+        void       *buf;
+    } safe_value              = {.const_buf = value};
     H5_daos_req_t *int_req    = NULL;
     tse_task_t    *first_task = NULL;
     tse_task_t    *dep_task   = NULL;
-    hid_t          map_id     = H5I_INVALID_HID;
     int            ret;
-    herr_t         ret_value = SUCCEED; /* Return value */
-
-    assert(map_args);
+    herr_t         ret_value = SUCCEED;
 
     if (!_map)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
+    if (!key)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
+    if (!value)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value is NULL");
 
     H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
-    switch (map_args->get.get_type) {
-        case H5VL_MAP_GET_MCPL: {
-            hid_t *plist_id = &map_args->get.args.get_mcpl.mcpl_id;
-
-            /* Wait for the map to open if necessary */
-            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (map->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
-            } /* end if */
-
-            /* Retrieve the map's creation property list */
-            if ((*plist_id = H5Pcopy(map->mcpl_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map creation property list");
-
-            /* Set map's object class on dcpl */
-            if (H5_daos_set_oclass_from_oid(*plist_id, map->obj.oid) < 0)
-                D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object class property");
-
-            break;
-        } /* end block */
-        case H5VL_MAP_GET_MAPL: {
-            hid_t *plist_id = &map_args->get.args.get_mapl.mapl_id;
-
-            /* Wait for the map to open if necessary */
-            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (map->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
-            } /* end if */
-
-            /* Retrieve the map's access property list */
-            if ((*plist_id = H5Pcopy(map->mapl_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map access property list");
-
-            break;
-        } /* end block */
-        case H5VL_MAP_GET_KEY_TYPE: {
-            hid_t *ret_id = &map_args->get.args.get_key_type.type_id;
-
-            /* Wait for the map to open if necessary */
-            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (map->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
-            } /* end if */
-
-            /* Retrieve the map's key datatype */
-            if ((*ret_id = H5Tcopy(map->key_type_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get key datatype ID of map");
-            break;
-        } /* end block */
-        case H5VL_MAP_GET_VAL_TYPE: {
-            hid_t *ret_id = &map_args->get.args.get_val_type.type_id;
-
-            /* Wait for the map to open if necessary */
-            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (map->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
-            } /* end if */
-
-            /* Retrieve the map's value datatype */
-            if ((*ret_id = H5Tcopy(map->val_type_id)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get value datatype ID of map");
-            break;
-        } /* end block */
-        case H5VL_MAP_GET_COUNT: {
-            H5_daos_iter_data_t iter_data;
-            hsize_t            *count = &map_args->get.args.get_count.count;
-
-            /* Wait for the map to open if necessary */
-            /* Needed because below code accesses map->key_type_id */
-            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (map->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
-            } /* end if */
-
-            /* Start H5 operation */
-            if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "get map key count",
-                                                      map->obj.item.open_req, NULL, NULL, dxpl_id)))
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
-
-            /* Initialize counter */
-            *count = 0;
-
-            /* Register ID for map */
-            if ((map_id = H5VLwrap_register(map, H5I_MAP)) < 0)
-                D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
-            map->obj.item.rc++;
-
-            /* Initialize iteration data */
-            H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC, FALSE, NULL,
-                                   map_id, count, NULL, int_req);
-            iter_data.u.map_iter_data.key_mem_type_id = map->key_type_id;
-            iter_data.u.map_iter_data.u.map_iter_op   = H5_daos_map_get_count_cb;
+    /* Check for write access */
+    if (!(map->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
 
-            /* Iterate over the keys, counting them */
-            if (H5_daos_map_iterate(map, &iter_data, &first_task, &dep_task) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "can't iterate over map keys");
+    /* Start H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map put value", map->obj.item.open_req,
+                                              NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
 
-            break;
-        } /* end block */
-        default:
-            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "can't get this type of information from map");
-    } /* end switch */
+    /* Check if we can call the internal routine directly - the map open
+     * must be complete.  Otherwise defer it to a task that runs once the
+     * map is open, so this function does not block. */
+    if (map->obj.item.created || map->obj.item.open_req->status == 0) {
+        if (H5_daos_map_put_int(map, key_mem_type_id, key, val_mem_type_id, value, dxpl_id, int_req,
+                                &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't write key-value pair to map");
+    } /* end if */
+    else if (H5_daos_map_io_defer(map, H5_DAOS_MAP_IO_PUT, key_mem_type_id, key, val_mem_type_id,
+                                  safe_value.buf, NULL, int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write key-value pair to map");
 
 done:
     if (int_req) {
@@ -3149,397 +3809,6329 @@ done:
         if (ret_value < 0)
             int_req->status = -H5_DAOS_SETUP_ERROR;
 
-        /* Add the request to the map's request queue.  This will add the
-         * dependency on the map open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
-                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_WRITE,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
+                             "map key-value write operation failed in task \"%s\": %s", int_req->failed_task,
+                             H5_daos_err_to_string(int_req->status));
+
+            /* Close internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    }     /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_int
+ *
+ * Purpose:     Internal version of H5_daos_map_put().  The map must be
+ *              open.  Creates the tasks to write the key-value pair and
+ *              returns the first one, unscheduled, in *first_task.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, value not set.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_put_int(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key, hid_t val_mem_type_id,
+                    const void *value, hid_t dxpl_id, H5_daos_req_t *req, tse_task_t **first_task,
+                    tse_task_t **dep_task)
+{
+    H5_daos_map_rw_ud_t *write_udata = NULL;
+    union {
+        const void *const_buf;
+        void       *buf;
+    } safe_value                     = {.const_buf = value};
+    tse_task_t *bkg_buf_fill_task    = NULL;
+    tse_task_t *write_task           = NULL;
+    hbool_t     fill_bkg             = FALSE;
+    int         ret;
+    herr_t      ret_value = SUCCEED;
+
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct for key-value pair write task */
+    if (NULL == (write_udata = (H5_daos_map_rw_ud_t *)DV_calloc(sizeof(H5_daos_map_rw_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for map key-value write task arguments");
+    write_udata->md_rw_cb_ud.req = req;
+    write_udata->md_rw_cb_ud.obj = &map->obj;
+    write_udata->val_mem_type_id = H5I_INVALID_HID;
+    write_udata->value_buf       = safe_value.buf;
+
+    /* Convert key (if necessary) */
+    if (H5_daos_map_key_conv(map, key_mem_type_id, key, &write_udata->key_buf, &write_udata->key_size,
+                             write_udata->key_buf_local, &write_udata->key_buf_alloc, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&write_udata->md_rw_cb_ud.dkey, write_udata->key_buf,
+                       (daos_size_t)write_udata->key_size);
+    write_udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Check if the type conversion is needed */
+    if ((write_udata->val_need_tconv = H5_daos_need_tconv(map->val_file_type_id, val_mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+
+    /* Type conversion */
+    if (write_udata->val_need_tconv) {
+        /* Initialize type conversion */
+        if (H5_daos_tconv_init(val_mem_type_id, &write_udata->val_mem_type_size, map->val_file_type_id,
+                               &write_udata->val_file_type_size, 1, FALSE, TRUE, &write_udata->tconv_buf,
+                               &write_udata->bkg_buf, NULL, &fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+    } /* end if */
+    else
+        write_udata->val_file_type_size = map->val_file_type_size;
+
+    /* Set up iods and sgls, and set nr.  The value sgl is pointed at the
+     * buffer to write from below. */
+    write_udata->md_rw_cb_ud.nr =
+        H5_daos_map_val_io_init(map, &write_udata->val_io, write_udata->md_rw_cb_ud.iod,
+                                write_udata->md_rw_cb_ud.sgl, write_udata->md_rw_cb_ud.sg_iov, safe_value.buf,
+                                0, write_udata->val_file_type_size);
+
+    write_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Check for type conversion */
+    if (write_udata->val_need_tconv) {
+        /* Check if we need to fill background buffer */
+        if (fill_bkg) {
+            assert(write_udata->bkg_buf);
+
+            /* Read data from map to background buffer */
+            daos_iov_set(&write_udata->md_rw_cb_ud.sg_iov[0], write_udata->bkg_buf,
+                         (daos_size_t)write_udata->val_file_type_size);
+
+            /* Copy memory type, it is needed by the background buffer
+             * fill callback after this function returns */
+            if ((write_udata->val_mem_type_id = H5Tcopy(val_mem_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, FAIL, "can't copy value memory datatype");
+
+            /* Create task to read data from map to background buffer */
+            assert(!*dep_task);
+            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_rw_prep_cb,
+                                         H5_daos_map_put_fill_comp_cb, write_udata, &bkg_buf_fill_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
+                             "can't create task to read data from map to background buffer");
+
+            /* Save background buffer data read task to be scheduled later and give
+             * it a reference to req and the map object */
+            *first_task = bkg_buf_fill_task;
+            *dep_task   = bkg_buf_fill_task;
+            req->rc++;
+            map->obj.item.rc++;
+        } /* end if */
+        else {
+            /* Copy data to type conversion buffer */
+            (void)memcpy(write_udata->tconv_buf, value, (size_t)write_udata->val_mem_type_size);
+
+            /* Perform type conversion */
+            if (H5Tconvert(val_mem_type_id, map->val_file_type_id, 1, write_udata->tconv_buf,
+                           write_udata->bkg_buf, dxpl_id) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+
+            /* Set sgl to write from tconv_buf */
+            daos_iov_set(&write_udata->md_rw_cb_ud.sg_iov[0], write_udata->tconv_buf,
+                         (daos_size_t)write_udata->val_file_type_size);
+        } /* end else */
+
+        write_udata->md_rw_cb_ud.free_sg_iov[0] = TRUE;
+    } /* end if */
+    else
+        /* Set sgl to write from value */
+        daos_const_iov_set((d_const_iov_t *)&write_udata->md_rw_cb_ud.sg_iov[0], value,
+                           (daos_size_t)write_udata->val_file_type_size);
+
+    /* Set task name */
+    write_udata->md_rw_cb_ud.task_name = "map key-value write";
+
+    /* Create task to write the key-value pair.  The write is conditional on
+     * whether the key exists, so new keys can be counted in the map's entry
+     * count.  The condition is chosen when the task runs. */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_map_put_prep_cb, H5_daos_map_put_comp_cb, write_udata,
+                                 &write_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write key-value pair to map");
+
+    /* Create task to free write_udata once the write is done, which may take
+     * a second attempt if the condition was wrong */
+    if (H5_daos_create_task(H5_daos_map_put_end_task, 1, &write_task, NULL, NULL, write_udata,
+                            &write_udata->end_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finish writing key-value pair");
+
+    /* Schedule end task and give it a reference to req and the map object.
+     * The write task does not need its own references since the end task
+     * depends on it. */
+    if (0 != (ret = tse_task_schedule(write_udata->end_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
+                     "can't schedule task to finish writing key-value pair: %s", H5_daos_err_to_string(ret));
+    *dep_task = write_udata->end_task;
+    req->rc++;
+    map->obj.item.rc++;
+    write_udata = NULL;
+
+    /* Schedule map key-value write task (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(write_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to write key-value pair: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = write_task;
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0 && write_udata) {
+        if (write_udata->tconv_buf && (write_udata->tconv_buf != value))
+            DV_free(write_udata->tconv_buf);
+        if (write_udata->bkg_buf && (write_udata->bkg_buf != value))
+            DV_free(write_udata->bkg_buf);
+        if (write_udata->val_mem_type_id >= 0 && H5Tclose(write_udata->val_mem_type_id) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close value memory datatype");
+        DV_free(write_udata->key_buf_alloc);
+        write_udata = DV_free(write_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put_int() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_fill_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to fill
+ *              a type conversion background buffer when performing a map
+ *              "put" operation that requires type conversion. Currently
+ *              checks for a failed task and then performs type conversion.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_put_fill_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rw_ud_t *udata;
+    int                  ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.req->file);
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "map put background buffer fill task";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        H5_daos_map_t *map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+
+        assert(map);
+
+        /* Copy data to type conversion buffer */
+        (void)memcpy(udata->tconv_buf, udata->value_buf, (size_t)udata->val_mem_type_size);
+
+        /* Perform type conversion */
+        if (H5Tconvert(udata->val_mem_type_id, map->val_file_type_id, 1, udata->tconv_buf, udata->bkg_buf,
+                       udata->md_rw_cb_ud.req->dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+
+        /* Set up iods and sgls again to write from tconv_buf.  This resets
+         * the iod sizes, which could have been overwritten by
+         * daos_obj_fetch if the key was not created. */
+        (void)H5_daos_map_val_io_init(map, &udata->val_io, udata->md_rw_cb_ud.iod, udata->md_rw_cb_ud.sgl,
+                                      udata->md_rw_cb_ud.sg_iov, udata->tconv_buf, 0,
+                                      udata->val_file_type_size);
+    } /* end else */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Clean up */
+    if (udata) {
+        /* Close map */
+        if (udata->md_rw_cb_ud.obj && H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map put background buffer fill completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+    } /* end if */
+    else
+        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put_fill_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous conditional
+ *              daos_obj_update to write a key-value pair to a map object.
+ *              On the first attempt, adds the key to the map's Bloom
+ *              filter and chooses whether to insert a new key or update
+ *              an existing one from the map's recent puts.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_put_prep_cb(tse_task_t *task, void *args)
+{
+    H5_daos_map_rw_ud_t *udata;
+    int                  ret_value;
+
+    /* Add the key to the Bloom filter and choose the condition if this is
+     * the first attempt */
+    if (NULL != (udata = tse_task_get_priv(task)) && !udata->md_rw_cb_ud.flags) {
+        H5_daos_map_bloom_add((H5_daos_map_t *)udata->md_rw_cb_ud.obj, udata->key_buf, udata->key_size);
+        udata->md_rw_cb_ud.flags = H5_daos_map_put_flags((H5_daos_map_t *)udata->md_rw_cb_ud.obj);
+    } /* end if */
+
+    /* Set up the update.  This handles errors, including a missing udata. */
+    ret_value = H5_daos_map_rw_prep_cb(task, args);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous conditional
+ *              daos_obj_update to write a key-value pair to a map object.
+ *              Counts a new key in the map's entry count.  If the key was
+ *              wrongly guessed to exist or not, repeats the update with
+ *              the other condition.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_put_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rw_ud_t *udata;
+    hbool_t              reinit = FALSE;
+    int                  ret;
+    int                  ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.obj);
+    assert(udata->end_task);
+
+    /* Check whether the update must be repeated with the other condition.
+     * Only record other errors in udata->req_status if it does not already
+     * contain an error (it could contain an error if another task this task
+     * is not dependent on also failed). */
+    if (H5_daos_map_put_retry((H5_daos_map_t *)udata->md_rw_cb_ud.obj, &udata->md_rw_cb_ud.flags,
+                              task->dt_result)) {
+        /* Re-register callback functions for re-initialized update task */
+        if (0 != (ret = tse_task_register_cbs(task, H5_daos_map_put_prep_cb, NULL, 0,
+                                              H5_daos_map_put_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't register callbacks for task to write key-value pair: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Register dependency on this task for the end task */
+        if (0 != (ret = tse_task_register_deps(udata->end_task, 1, &task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret,
+                         "can't create dependencies for task to finish writing key-value pair: %s",
+                         H5_daos_err_to_string(ret));
+
+        if (0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't re-initialize task to write key-value pair: %s", H5_daos_err_to_string(ret));
+        reinit = TRUE;
+    } /* end if */
+    else if (task->dt_result < -H5_DAOS_PRE_ERROR &&
+             udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "map key-value write";
+    } /* end if */
+
+done:
+    /* Handle errors in this function */
+    if (udata && ret_value < -H5_DAOS_SHORT_CIRCUIT &&
+        udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = ret_value;
+        udata->md_rw_cb_ud.req->failed_task = "map key-value write completion callback";
+    } /* end if */
+
+    /* Return task to task list if it is not being repeated */
+    if ((!reinit || ret_value < 0) && H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_end_task
+ *
+ * Purpose:     Finalizes writing a key-value pair to a map object, then
+ *              frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_put_end_task(tse_task_t *task)
+{
+    H5_daos_map_rw_ud_t *udata;
+    int                  ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.req->file);
+
+    /* Close map */
+    if (udata->md_rw_cb_ud.obj && H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = ret_value;
+        udata->md_rw_cb_ud.req->failed_task = "map key-value write end task";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    if (udata->val_mem_type_id >= 0 && H5Tclose(udata->val_mem_type_id) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close value memory datatype");
+    if (udata->tconv_buf && (udata->tconv_buf != udata->value_buf))
+        DV_free(udata->tconv_buf);
+    if (udata->bkg_buf && (udata->bkg_buf != udata->value_buf))
+        DV_free(udata->bkg_buf);
+    if (udata->key_buf_alloc)
+        DV_free(udata->key_buf_alloc);
+    udata = DV_free(udata);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put_end_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_flags
+ *
+ * Purpose:     Chooses the conditional flags for the first try of a put
+ *              to a map.  A put must know whether it added a key so the
+ *              map's entry count can be kept, which the conditional flags
+ *              tell without an extra read.  The put is tried as an update
+ *              of an existing key if most recent puts to the map found
+ *              their key, and as an insert otherwise, so a put takes one
+ *              write unless the guess is wrong.
+ *
+ * Return:      The flags
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_map_put_flags(const H5_daos_map_t *map)
+{
+    assert(map);
+
+    /* Legacy maps and maps not yet open have no count to keep */
+    if (!map->shared || map->shared->legacy)
+        return 0;
+
+    return map->shared->put_hint >= H5_DAOS_MAP_PUT_HINT_UPDATE ? DAOS_COND_AKEY_UPDATE
+                                                                 : DAOS_COND_AKEY_INSERT;
+} /* end H5_daos_map_put_flags() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_retry
+ *
+ * Purpose:     Handles the result of a put to a map tried with the flags
+ *              *flags.  Counts an added key and adjusts the map's put
+ *              hint.  If the put failed because the guess of whether its
+ *              key exists was wrong, flips *flags so the put can be
+ *              repeated with the other condition.
+ *
+ * Return:      TRUE if the put must be repeated with *flags
+ *              FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_map_put_retry(H5_daos_map_t *map, uint64_t *flags, int result)
+{
+    H5_daos_map_shared_t *shared;
+
+    assert(map);
+    assert(flags);
+
+    if (NULL == (shared = map->shared))
+        return FALSE;
+
+    if (*flags == DAOS_COND_AKEY_INSERT) {
+        if (result == 0) {
+            shared->count_delta++;
+            if (shared->put_hint > 0)
+                shared->put_hint--;
+        } /* end if */
+        else if (result == -DER_EXIST) {
+            if (shared->put_hint < H5_DAOS_MAP_PUT_HINT_MAX)
+                shared->put_hint++;
+            *flags = DAOS_COND_AKEY_UPDATE;
+            return TRUE;
+        } /* end if */
+    }     /* end if */
+    else if (*flags == DAOS_COND_AKEY_UPDATE) {
+        if (result == 0) {
+            if (shared->put_hint < H5_DAOS_MAP_PUT_HINT_MAX)
+                shared->put_hint++;
+        } /* end if */
+        else if (result == -DER_NONEXIST) {
+            if (shared->put_hint > 0)
+                shared->put_hint--;
+            *flags = DAOS_COND_AKEY_INSERT;
+            return TRUE;
+        } /* end if */
+    }     /* end if */
+
+    return FALSE;
+} /* end H5_daos_map_put_retry() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_exists
+ *
+ * Purpose:     Check if the specified key exists in the map. The result
+ *              will be returned via the "exists" parameter.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_map_exists(void *_map, hid_t key_mem_type_id, const void *key, hbool_t *exists, hid_t dxpl_id,
+                   void **req)
+{
+    H5_daos_map_t *map        = (H5_daos_map_t *)_map;
+    H5_daos_req_t *int_req    = NULL;
+    tse_task_t    *first_task = NULL;
+    tse_task_t    *dep_task   = NULL;
+    int            ret;
+    herr_t         ret_value = SUCCEED;
+
+    if (!_map)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
+    if (!key)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
+    if (!exists)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map exists pointer is NULL");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Start H5 operation.  The DXPL is only needed if the key conversion
+     * is deferred until the map is open. */
+    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map key existence check",
+                                              map->obj.item.open_req, NULL, NULL,
+                                              map->obj.item.created || map->obj.item.open_req->status == 0
+                                                  ? H5I_INVALID_HID
+                                                  : dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Check if we can call the internal routine directly - the map open
+     * must be complete.  Otherwise defer it to a task that runs once the
+     * map is open, so this function does not block. */
+    if (map->obj.item.created || map->obj.item.open_req->status == 0) {
+        if (H5_daos_map_exists_int(map, key_mem_type_id, key, exists, dxpl_id, int_req, &first_task,
+                                   &dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't check if key exists in map");
+    } /* end if */
+    else if (H5_daos_map_io_defer(map, H5_DAOS_MAP_IO_EXISTS, key_mem_type_id, key, H5I_INVALID_HID, NULL,
+                                  exists, int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to check if key exists in map");
+
+done:
+    if (int_req) {
+        assert(map);
+
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
+                             "map key exists operation failed in task \"%s\": %s", int_req->failed_task,
+                             H5_daos_err_to_string(int_req->status));
+
+            /* Close internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    }     /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_exists() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_exists_int
+ *
+ * Purpose:     Internal version of H5_daos_map_exists().  The map must be
+ *              open.  Creates the task to check for the key but does not
+ *              schedule it, instead returning it in *first_task.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_exists_int(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key, hbool_t *exists,
+                       hid_t dxpl_id, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_map_exists_ud_t *exists_udata    = NULL;
+    tse_task_t              *map_exists_task = NULL;
+    herr_t                   ret_value       = SUCCEED;
+
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct for key existence checking task */
+    if (NULL == (exists_udata = (H5_daos_map_exists_ud_t *)DV_calloc(sizeof(H5_daos_map_exists_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for map key existence check task arguments");
+    exists_udata->exists_ret      = exists;
+    exists_udata->md_rw_cb_ud.req = req;
+    exists_udata->md_rw_cb_ud.obj = &map->obj;
+
+    /* Convert key (if necessary) */
+    if (H5_daos_map_key_conv(map, key_mem_type_id, key, &exists_udata->key_buf, &exists_udata->key_size,
+                             exists_udata->key_buf_local, &exists_udata->key_buf_alloc, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&exists_udata->md_rw_cb_ud.dkey, exists_udata->key_buf,
+                       (daos_size_t)exists_udata->key_size);
+    exists_udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Set up iod */
+    memset(&exists_udata->md_rw_cb_ud.iod[0], 0, sizeof(daos_iod_t));
+    daos_const_iov_set((d_const_iov_t *)&exists_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_map_key_g,
+                       H5_daos_map_key_size_g);
+    exists_udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
+    exists_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
+    exists_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+
+    exists_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set nr */
+    exists_udata->md_rw_cb_ud.nr = 1u;
+
+    /* Set task name */
+    exists_udata->md_rw_cb_ud.task_name = "map key existence check";
+
+    /* Create task to read map metadata size */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_exists_prep_cb,
+                                 H5_daos_map_exists_comp_cb, exists_udata, &map_exists_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map metadata size");
+
+    /* Save map metadata size read task to be scheduled later and give
+     * it a reference to req and the map object */
+    assert(!*first_task);
+    *first_task = map_exists_task;
+    *dep_task   = map_exists_task;
+    req->rc++;
+    map->obj.item.rc++;
+
+    exists_udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0 && exists_udata) {
+        DV_free(exists_udata->key_buf_alloc);
+        exists_udata = DV_free(exists_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_exists_int() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_exists_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to check
+ *              if a specified key value exists in a map object.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_exists_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_exists_ud_t *udata;
+    daos_obj_rw_t           *rw_args;
+    int                      ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for metadata I/O task");
+
+    assert(udata->md_rw_cb_ud.req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_MAP);
+
+    assert(udata->md_rw_cb_ud.obj);
+    assert(udata->md_rw_cb_ud.req->file);
+
+    /* Skip the fetch if the map's Bloom filter shows the key is not in the
+     * map */
+    if (!H5_daos_map_bloom_test((H5_daos_map_t *)udata->md_rw_cb_ud.obj, udata->key_buf, udata->key_size)) {
+        *udata->exists_ret = FALSE;
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+    } /* end if */
+
+    /* Set fetch task arguments */
+    if (NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for metadata I/O task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh    = H5_DAOS_MAP_DATA_OH((H5_daos_map_t *)udata->md_rw_cb_ud.obj);
+    rw_args->th    = udata->md_rw_cb_ud.req->th;
+    rw_args->flags = udata->md_rw_cb_ud.flags;
+    rw_args->dkey  = &udata->md_rw_cb_ud.dkey;
+    rw_args->nr    = udata->md_rw_cb_ud.nr;
+    rw_args->iods  = udata->md_rw_cb_ud.iod;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_exists_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_exists_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to check
+ *              if a specified key value exists in a map object. Currently
+ *              checks for a failed task then frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_exists_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_exists_ud_t *udata;
+    int                      ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for metadata I/O task");
+
+    assert(udata->md_rw_cb_ud.req);
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "map key exists fetch";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        assert(udata->md_rw_cb_ud.req->file);
+
+        /* Set output */
+        *udata->exists_ret = (udata->md_rw_cb_ud.iod[0].iod_size != 0);
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Clean up */
+    if (udata) {
+        /* Close map */
+        if (udata->md_rw_cb_ud.obj && H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map key exists completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        if (udata->key_buf_alloc)
+            DV_free(udata->key_buf_alloc);
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_exists_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_io_defer
+ *
+ * Purpose:     Creates the tasks to perform a map get, put or exists
+ *              operation once the map is open, for when the open is not
+ *              yet complete and the key and value conversions therefore
+ *              cannot be set up yet.  The datatypes are copied so the
+ *              application may close them before the operation
+ *              completes.  Returns the first task, unscheduled, in
+ *              *first_task and the task that completes last in *dep_task.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_io_defer(H5_daos_map_t *map, H5_daos_map_io_type_t io_type, hid_t key_mem_type_id,
+                     const void *key, hid_t val_mem_type_id, void *value, hbool_t *exists, H5_daos_req_t *req,
+                     tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_map_io_task_ud_t *task_ud   = NULL;
+    tse_task_t               *io_task   = NULL;
+    herr_t                    ret_value = SUCCEED;
+
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(!*first_task);
+    assert(dep_task);
+    assert(!*dep_task);
+
+    /* Allocate argument struct */
+    if (NULL == (task_ud = (H5_daos_map_io_task_ud_t *)DV_calloc(sizeof(H5_daos_map_io_task_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate space for map I/O task udata struct");
+    task_ud->req             = req;
+    task_ud->map             = map;
+    task_ud->io_type         = io_type;
+    task_ud->key_mem_type_id = H5I_INVALID_HID;
+    task_ud->key             = key;
+    task_ud->val_mem_type_id = H5I_INVALID_HID;
+    task_ud->value           = value;
+    task_ud->exists          = exists;
+
+    /* Copy datatypes */
+    if ((task_ud->key_mem_type_id = H5Tcopy(key_mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, FAIL, "can't copy key memory datatype");
+    if (val_mem_type_id >= 0 && (task_ud->val_mem_type_id = H5Tcopy(val_mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOPY, FAIL, "can't copy value memory datatype");
+
+    /* Create end task for map I/O */
+    if (H5_daos_create_task(H5_daos_map_io_int_end_task, 0, NULL, NULL, NULL, task_ud, &task_ud->end_task) <
+        0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finish map I/O operation");
+
+    /* Create task to set up map I/O */
+    if (H5_daos_create_task(H5_daos_map_io_int_task, 0, NULL, NULL, NULL, task_ud, &io_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to perform map I/O operation");
+
+    /* Save task to be scheduled later and give it a reference to req and
+     * map */
+    *first_task = io_task;
+    *dep_task   = task_ud->end_task;
+    map->obj.item.rc++;
+    req->rc++;
+    task_ud = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (task_ud) {
+        assert(ret_value < 0);
+        if (task_ud->key_mem_type_id >= 0 && H5Tclose(task_ud->key_mem_type_id) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close key memory datatype");
+        if (task_ud->val_mem_type_id >= 0 && H5Tclose(task_ud->val_mem_type_id) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close value memory datatype");
+        task_ud = DV_free(task_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_io_defer() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_io_int_task
+ *
+ * Purpose:     Asynchronous task to set up and start a deferred map get,
+ *              put or exists operation once the map is open.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_io_int_task(tse_task_t *task)
+{
+    H5_daos_map_io_task_ud_t *udata      = NULL;
+    tse_task_t               *first_task = NULL;
+    tse_task_t               *dep_task   = NULL;
+    int                       ret;
+    int                       ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map I/O task");
+
+    assert(udata->end_task);
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_MAP);
+
+    /* Verify map was successfully opened */
+    if (udata->map->obj.item.open_req->status != 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, -H5_DAOS_PREREQ_ERROR, "map open is incomplete");
+
+    /* Call actual I/O routine */
+    switch (udata->io_type) {
+        case H5_DAOS_MAP_IO_GET_VAL:
+            if (H5_daos_map_get_val_int(udata->map, udata->key_mem_type_id, udata->key,
+                                        udata->val_mem_type_id, udata->value, udata->req->dxpl_id, udata->req,
+                                        &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_READERROR, -H5_DAOS_H5_GET_ERROR, "can't read map key value");
+            break;
+
+        case H5_DAOS_MAP_IO_PUT:
+            if (H5_daos_map_put_int(udata->map, udata->key_mem_type_id, udata->key, udata->val_mem_type_id,
+                                    udata->value, udata->req->dxpl_id, udata->req, &first_task,
+                                    &dep_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, -H5_DAOS_H5_COPY_ERROR,
+                             "can't write key-value pair to map");
+            break;
+
+        case H5_DAOS_MAP_IO_EXISTS:
+            if (H5_daos_map_exists_int(udata->map, udata->key_mem_type_id, udata->key, udata->exists,
+                                       udata->req->dxpl_id, udata->req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't check if key exists in map");
+            break;
+    } /* end switch */
+
+done:
+    if (udata) {
+        /* Make the end task depend on the I/O tasks */
+        if (dep_task && 0 != (ret = tse_task_register_deps(udata->end_task, 1, &dep_task)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't create dependency for map I/O end task: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule first task for map I/O: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Schedule end task */
+        if (0 != (ret = tse_task_schedule(udata->end_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule end task for map I/O: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "map I/O task";
+        } /* end if */
+    }     /* end if */
+    else {
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+        assert(!first_task);
+    } /* end else */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_io_int_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_io_int_end_task
+ *
+ * Purpose:     Finalizes a deferred map get, put or exists operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_io_int_end_task(tse_task_t *task)
+{
+    H5_daos_map_io_task_ud_t *udata     = NULL;
+    int                       ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map I/O task");
+
+    assert(task == udata->end_task);
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_DONE(udata->req);
+
+    /* Free IDs */
+    if (H5Tclose(udata->key_mem_type_id) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close key memory datatype");
+    if (udata->val_mem_type_id >= 0 && H5Tclose(udata->val_mem_type_id) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close value memory datatype");
+
+    /* Close map */
+    if (H5_daos_map_close_real(udata->map) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map used for I/O");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "map I/O end task";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free udata */
+    udata = DV_free(udata);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_io_int_end_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_put_multi
+ *
+ * Purpose:     Adds or updates count key-value pairs in the map specified
+ *              by map_id, as if H5Mput had been called for each of them,
+ *              but with all DAOS updates issued under a single request
+ *              with up to H5_DAOS_MAP_MULTI_WINDOW of them in flight at
+ *              once.  keys and values are arrays of count elements of
+ *              key_mem_type_id and val_mem_type_id.  If statuses is not
+ *              NULL, the outcome for each key is stored in it.  Value
+ *              conversions that need the previous value as a background
+ *              buffer are not supported.
+ *
+ * Return:      Non-negative if all keys succeeded/Negative otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_put_multi(hid_t map_id, hid_t key_mem_type_id, size_t count, const void *keys,
+                     hid_t val_mem_type_id, const void *values, herr_t *statuses, hid_t dxpl_id)
+{
+    H5_daos_map_multi_args_t args;
+    union {
+        const void *const_buf;
+        void       *buf;
+    } safe_values = {.const_buf = values};
+
+    args.map_id          = map_id;
+    args.op              = H5_DAOS_MAP_MULTI_PUT;
+    args.key_mem_type_id = key_mem_type_id;
+    args.count           = count;
+    args.keys            = keys;
+    args.val_mem_type_id = val_mem_type_id;
+    args.values          = safe_values.buf;
+    args.exists          = NULL;
+    args.statuses        = statuses;
+    args.dxpl_id         = dxpl_id;
+
+    return H5_daos_public_call(H5_daos_map_multi, &args);
+} /* end H5daos_map_put_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_get_multi
+ *
+ * Purpose:     Retrieves the values for count keys from the map specified
+ *              by map_id, as if H5Mget had been called for each of them,
+ *              but with all DAOS fetches issued under a single request
+ *              with up to H5_DAOS_MAP_MULTI_WINDOW of them in flight at
+ *              once.  keys and values are arrays of count elements of
+ *              key_mem_type_id and val_mem_type_id.  If statuses is not
+ *              NULL, the outcome for each key is stored in it; keys not
+ *              present in the map fail.
+ *
+ * Return:      Non-negative if all keys succeeded/Negative otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_get_multi(hid_t map_id, hid_t key_mem_type_id, size_t count, const void *keys,
+                     hid_t val_mem_type_id, void *values, herr_t *statuses, hid_t dxpl_id)
+{
+    H5_daos_map_multi_args_t args;
+
+    args.map_id          = map_id;
+    args.op              = H5_DAOS_MAP_MULTI_GET;
+    args.key_mem_type_id = key_mem_type_id;
+    args.count           = count;
+    args.keys            = keys;
+    args.val_mem_type_id = val_mem_type_id;
+    args.values          = values;
+    args.exists          = NULL;
+    args.statuses        = statuses;
+    args.dxpl_id         = dxpl_id;
+
+    return H5_daos_public_call(H5_daos_map_multi, &args);
+} /* end H5daos_map_get_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_exists_multi
+ *
+ * Purpose:     Checks whether each of count keys exists in the map
+ *              specified by map_id, as if H5Mexists had been called for
+ *              each of them, but with all DAOS fetches issued under a
+ *              single request with up to H5_DAOS_MAP_MULTI_WINDOW of them
+ *              in flight at once.  keys is an array of count elements of
+ *              key_mem_type_id and the results are stored in exists.  If
+ *              statuses is not NULL, the outcome for each key is stored
+ *              in it.
+ *
+ * Return:      Non-negative if all keys succeeded/Negative otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_exists_multi(hid_t map_id, hid_t key_mem_type_id, size_t count, const void *keys,
+                        hbool_t *exists, herr_t *statuses, hid_t dxpl_id)
+{
+    H5_daos_map_multi_args_t args;
+
+    args.map_id          = map_id;
+    args.op              = H5_DAOS_MAP_MULTI_EXISTS;
+    args.key_mem_type_id = key_mem_type_id;
+    args.count           = count;
+    args.keys            = keys;
+    args.val_mem_type_id = H5I_INVALID_HID;
+    args.values          = NULL;
+    args.exists          = exists;
+    args.statuses        = statuses;
+    args.dxpl_id         = dxpl_id;
+
+    return H5_daos_public_call(H5_daos_map_multi, &args);
+} /* end H5daos_map_exists_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_iterate_kv
+ *
+ * Purpose:     Iterates over the key-value pairs in the map map_id like
+ *              H5Miterate, but passes each key's value to op along with
+ *              the key.  The values for each batch of keys returned by a
+ *              DAOS dkey list are fetched concurrently while the previous
+ *              batch is being processed, and are converted to
+ *              val_mem_type_id together, instead of the operator issuing
+ *              a separate H5Mget for each key.  Blocks until iteration is
+ *              complete.
+ *
+ * Return:      Success:        The last value returned by op
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_iterate_kv(hid_t map_id, hsize_t *idx, hid_t key_mem_type_id, hid_t val_mem_type_id,
+                      H5_daos_map_iterate_kv_t op, void *op_data, hid_t dxpl_id)
+{
+    H5_daos_map_iterate_kv_args_t args;
+
+    args.map_id          = map_id;
+    args.idx             = idx;
+    args.key_mem_type_id = key_mem_type_id;
+    args.val_mem_type_id = val_mem_type_id;
+    args.op              = op;
+    args.op_data         = op_data;
+    args.dxpl_id         = dxpl_id;
+
+    return H5_daos_public_call(H5_daos_map_iterate_kv_op, &args);
+} /* end H5daos_map_iterate_kv() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iterate_kv_op
+ *
+ * Purpose:     Body of H5daos_map_iterate_kv(), run through
+ *              H5_daos_public_call().
+ *
+ * Return:      See H5daos_map_iterate_kv()
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_iterate_kv_op(void *_args)
+{
+    H5_daos_map_iterate_kv_args_t *args            = (H5_daos_map_iterate_kv_args_t *)_args;
+    hid_t                          map_id          = args->map_id;
+    hsize_t                       *idx             = args->idx;
+    hid_t                          key_mem_type_id = args->key_mem_type_id;
+    hid_t                          val_mem_type_id = args->val_mem_type_id;
+    H5_daos_map_iterate_kv_t       op              = args->op;
+    void                          *op_data         = args->op_data;
+    hid_t                          dxpl_id         = args->dxpl_id;
+    H5_daos_iter_data_t            iter_data;
+    H5_daos_map_t                 *map        = NULL;
+    H5_daos_req_t                 *int_req    = NULL;
+    tse_task_t                    *first_task = NULL;
+    tse_task_t                    *dep_task   = NULL;
+    herr_t                         iter_ret   = 0;
+    int                            ret;
+    herr_t                         ret_value = SUCCEED;
+
+    if (!op)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map iteration operator is NULL");
+    if (NULL == (map = (H5_daos_map_t *)H5VLobject(map_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (H5I_MAP != map->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a map");
+
+    if (dxpl_id == H5P_DEFAULT)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Start H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map iterate with values",
+                                              map->obj.item.open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Wait for the map to open if necessary */
+    if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+
+    /* Initialize iteration data */
+    H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC, FALSE, idx, map_id,
+                           op_data, &iter_ret, int_req);
+    iter_data.u.map_iter_data.key_mem_type_id  = key_mem_type_id;
+    iter_data.u.map_iter_data.val_mem_type_id  = val_mem_type_id;
+    iter_data.u.map_iter_data.fetch_vals       = TRUE;
+    iter_data.u.map_iter_data.u.map_iter_kv_op = op;
+
+    /* Perform map iteration */
+    if (H5_daos_map_iterate(map, &iter_data, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed");
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes */
+        if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if (int_req->status < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "map iteration failed in task \"%s\": %s",
+                         int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+        /* Close internal request */
+        if (H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+
+        /* Set return value, unless this function failed but the iteration
+         * did not */
+        if (!(ret_value < 0 && iter_ret >= 0))
+            ret_value = iter_ret;
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate_kv_op() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_iterate_partitioned
+ *
+ * Purpose:     Collectively iterates over the key-value pairs in the map
+ *              map_id, with each process iterating over a disjoint subset
+ *              of them.  The map's dkeys are split into the anchors
+ *              returned by daos_obj_anchor_split, and these are dealt out
+ *              to the processes in the file's communicator round-robin,
+ *              so that every process lists its own part of the map
+ *              concurrently with the others.  op is called on each
+ *              process only for the keys in that process's part.  If
+ *              splitting is not supported, process 0 iterates over the
+ *              whole map.
+ *
+ *              Once all processes are done, the total number of pairs
+ *              iterated over is returned in *nvisited, if not NULL, and
+ *              the results are reduced over all processes so that all
+ *              return the same value.
+ *
+ * Return:      Success:        The largest value returned by op on any
+ *                              process (0 unless op short-circuited)
+ *              Failure:        Negative, on all processes
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_iterate_partitioned(hid_t map_id, hid_t key_mem_type_id, H5M_iterate_t op, void *op_data,
+                               hsize_t *nvisited, hid_t dxpl_id)
+{
+    H5_daos_map_iterate_partitioned_args_t args;
+
+    args.map_id          = map_id;
+    args.key_mem_type_id = key_mem_type_id;
+    args.op              = op;
+    args.op_data         = op_data;
+    args.nvisited        = nvisited;
+    args.dxpl_id         = dxpl_id;
+
+    return H5_daos_public_call(H5_daos_map_iterate_partitioned_op, &args);
+} /* end H5daos_map_iterate_partitioned() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iterate_partitioned_op
+ *
+ * Purpose:     Body of H5daos_map_iterate_partitioned(), run through
+ *              H5_daos_public_call().
+ *
+ * Return:      See H5daos_map_iterate_partitioned()
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_iterate_partitioned_op(void *_args)
+{
+    H5_daos_map_iterate_partitioned_args_t *args            = (H5_daos_map_iterate_partitioned_args_t *)_args;
+    hid_t                                   map_id          = args->map_id;
+    hid_t                                   key_mem_type_id = args->key_mem_type_id;
+    H5M_iterate_t                           op              = args->op;
+    void                                   *op_data         = args->op_data;
+    hsize_t                                *nvisited        = args->nvisited;
+    hid_t                                   dxpl_id         = args->dxpl_id;
+    H5_daos_iter_data_t                     iter_data;
+    H5_daos_map_t                          *map            = NULL;
+    H5_daos_file_t                         *file           = NULL;
+    H5_daos_req_t                          *int_req        = NULL;
+    tse_task_t                             *first_task     = NULL;
+    tse_task_t                             *dep_task       = NULL;
+    uint32_t                                nparts         = 1;
+    hsize_t                                 nvisited_local = 0;
+    herr_t                                  iter_ret       = 0;
+    int                                     results[2];
+    int                                     ret;
+    herr_t                                  ret_value = SUCCEED;
+
+    if (NULL == (map = (H5_daos_map_t *)H5VLobject(map_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (H5I_MAP != map->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a map");
+    file = map->obj.item.file;
+    if (!op)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map iteration operator is NULL");
+
+    if (dxpl_id == H5P_DEFAULT)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Start H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(file, "partitioned map iterate", map->obj.item.open_req, NULL,
+                                              NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Wait for the map to open if necessary */
+    if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+
+    /* Find how many parts the map can be split into.  This only depends on
+     * the map's object class, so all processes get the same answer. */
+    if (0 != (ret = H5_daos_map_anchor_split(map, &nparts)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't split map for iteration: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Initialize iteration data */
+    H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC, FALSE,
+                           &nvisited_local, map_id, op_data, &iter_ret, int_req);
+    iter_data.u.map_iter_data.key_mem_type_id = key_mem_type_id;
+    iter_data.u.map_iter_data.u.map_iter_op   = op;
+
+    /* Assign parts to this process.  If the map cannot be split, process 0
+     * iterates over the whole map. */
+    if (nparts > 1) {
+        iter_data.u.map_iter_data.part_nr     = nparts;
+        iter_data.u.map_iter_data.part_next   = (uint32_t)file->my_rank;
+        iter_data.u.map_iter_data.part_stride = (uint32_t)file->num_procs;
+    } /* end if */
+
+    /* Perform map iteration if this process has anything to iterate over */
+    if (nparts > 1 ? (uint32_t)file->my_rank < nparts : file->my_rank == 0)
+        if (H5_daos_map_iterate(map, &iter_data, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed");
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes */
+        if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if (int_req->status < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "map iteration failed in task \"%s\": %s",
+                         int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+        /* Close internal request */
+        if (H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
+
+    /* Reduce the results over all processes, so that a failure on any
+     * process fails the iteration everywhere */
+    if (file) {
+        results[0] = ret_value < 0 || iter_ret < 0;
+        results[1] = iter_ret > 0 ? (int)iter_ret : 0;
+        if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, results, 2, MPI_INT, MPI_MAX, file->comm))
+            D_DONE_ERROR(H5E_MAP, H5E_MPI, FAIL, "can't reduce map iteration results (MPI_Allreduce)");
+        else if (results[0])
+            D_DONE_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed on at least one process");
+        else if (ret_value >= 0)
+            ret_value = (herr_t)results[1];
+
+        if (nvisited) {
+            uint64_t nvisited_all = (uint64_t)nvisited_local;
+
+            if (MPI_SUCCESS !=
+                MPI_Allreduce(MPI_IN_PLACE, &nvisited_all, 1, MPI_UINT64_T, MPI_SUM, file->comm))
+                D_DONE_ERROR(H5E_MAP, H5E_MPI, FAIL, "can't reduce map iteration count (MPI_Allreduce)");
+            *nvisited = (hsize_t)nvisited_all;
+        } /* end if */
+    }     /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate_partitioned_op() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_iterate_range
+ *
+ * Purpose:     Iterates in increasing key order over the keys in the map
+ *              map_id that are at least low_key and less than high_key
+ *              (or at most high_key if high_inclusive is set), calling op
+ *              on each.  Only supported for maps with 64 bit integer
+ *              keys, which keep their key-value pairs under native uint64
+ *              dkeys.
+ *
+ *              DAOS lists the dkeys within each anchor the map's data
+ *              object is split into in increasing uint64 order.  Each
+ *              anchor is first positioned at the lower bound, then listed
+ *              a batch at a time, with the batch size set by the map's
+ *              iterate hints, and the batches are merged so op sees the
+ *              keys in order as they are listed.  Listing an anchor stops
+ *              at its first key past the upper bound, so the number of
+ *              RPCs is bounded by the number of anchors and the number of
+ *              keys in the range.  A range spanning both negative and
+ *              non-negative signed keys is not contiguous in uint64
+ *              order, so it is visited in two passes, negative keys
+ *              first.  With DAOS versions that cannot position an anchor
+ *              at a key, the keys below the range are listed and skipped.
+ *
+ *              The rounds of RPCs are chained by their completion
+ *              callbacks (see H5_daos_map_range_advance), so this only
+ *              blocks once, for the whole iteration.
+ *
+ * Return:      Success:        Last value returned by op (non-negative)
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_iterate_range(hid_t map_id, hid_t key_mem_type_id, const void *low_key, const void *high_key,
+                         hbool_t high_inclusive, H5M_iterate_t op, void *op_data, hid_t dxpl_id)
+{
+    H5_daos_map_iterate_range_args_t args;
+
+    args.map_id          = map_id;
+    args.key_mem_type_id = key_mem_type_id;
+    args.low_key         = low_key;
+    args.high_key        = high_key;
+    args.high_inclusive  = high_inclusive;
+    args.op              = op;
+    args.op_data         = op_data;
+    args.dxpl_id         = dxpl_id;
+
+    return H5_daos_public_call(H5_daos_map_iterate_range_op, &args);
+} /* end H5daos_map_iterate_range() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iterate_range_op
+ *
+ * Purpose:     Body of H5daos_map_iterate_range(), run through
+ *              H5_daos_public_call().
+ *
+ * Return:      See H5daos_map_iterate_range()
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_iterate_range_op(void *_args)
+{
+    H5_daos_map_iterate_range_args_t *args            = (H5_daos_map_iterate_range_args_t *)_args;
+    hid_t                             map_id          = args->map_id;
+    hid_t                             key_mem_type_id = args->key_mem_type_id;
+    const void                       *low_key         = args->low_key;
+    const void                       *high_key        = args->high_key;
+    hbool_t                           high_inclusive  = args->high_inclusive;
+    H5M_iterate_t                     op              = args->op;
+    void                             *op_data         = args->op_data;
+    hid_t                             dxpl_id         = args->dxpl_id;
+    H5_daos_map_range_t               range;
+    H5_daos_map_t                    *map        = NULL;
+    H5_daos_req_t                    *int_req    = NULL;
+    tse_task_t                       *first_task = NULL;
+    tse_task_t                       *dep_task   = NULL;
+    uint8_t                           key_buf_local[H5_DAOS_MAP_KEY_BUF_LOCAL_SIZE];
+    const void                       *key_buf       = NULL;
+    void                             *key_buf_alloc = NULL;
+    size_t                            key_size      = 0;
+    size_t                            dkey_prefetch_size;
+    size_t                            dkey_alloc_size;
+    uint64_t                          lower;
+    uint64_t                          upper;
+    hbool_t                           is_signed;
+    uint32_t                          i;
+    int                               ret;
+    herr_t                            ret_value = H5_ITER_CONT;
+
+    memset(&range, 0, sizeof(range));
+
+    if (NULL == (map = (H5_daos_map_t *)H5VLobject(map_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (H5I_MAP != map->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a map");
+    if (!low_key || !high_key)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key range bound is NULL");
+    if (!op)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map iteration operator is NULL");
+
+    if (dxpl_id == H5P_DEFAULT)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Wait for the map to open if necessary */
+    if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+
+    /* Only maps with native uint64 dkeys have ordered keys */
+    if (!map->dkey_uint64)
+        D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL,
+                     "key range iteration is only supported for maps with 64 bit integer keys");
+#if !CHECK_DAOS_API_VERSION(2, 2)
+    /* The dkeys of a map are only listed in order within an anchor */
+    D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL, "key range iteration requires DAOS 2.2 or later");
+#endif
+
+    /* Convert range bounds to native dkey values */
+    is_signed = map->key_dkey_type_id == H5T_NATIVE_INT64;
+    if (H5_daos_map_key_conv(map, key_mem_type_id, low_key, &key_buf, &key_size, key_buf_local,
+                             &key_buf_alloc, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert lower bound key");
+    assert(key_size == sizeof(uint64_t));
+    (void)memcpy(&lower, key_buf, sizeof(uint64_t));
+    key_buf_alloc = DV_free(key_buf_alloc);
+    if (H5_daos_map_key_conv(map, key_mem_type_id, high_key, &key_buf, &key_size, key_buf_local,
+                             &key_buf_alloc, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert upper bound key");
+    assert(key_size == sizeof(uint64_t));
+    (void)memcpy(&upper, key_buf, sizeof(uint64_t));
+    key_buf_alloc = DV_free(key_buf_alloc);
+
+    /* Check for empty range */
+    if (is_signed ? (int64_t)lower > (int64_t)upper : lower > upper)
+        D_GOTO_DONE(H5_ITER_CONT);
+    if (!high_inclusive) {
+        if (lower == upper)
+            D_GOTO_DONE(H5_ITER_CONT);
+        upper--;
+    } /* end if */
+
+    /* Split the range into passes over inclusive intervals that do not wrap
+     * around in uint64 order.  Negative signed keys follow the non-negative
+     * ones in that order. */
+    if (is_signed && (int64_t)lower < 0 && (int64_t)upper >= 0) {
+        range.pass_lower[0] = lower;
+        range.pass_upper[0] = UINT64_MAX;
+        range.pass_lower[1] = 0;
+        range.pass_upper[1] = upper;
+        range.npasses       = 2;
+    } /* end if */
+    else {
+        range.pass_lower[0] = lower;
+        range.pass_upper[0] = upper;
+        range.npasses       = 1;
+    } /* end else */
+
+    /* Get map iterate hints */
+    if (map->mapl_id == H5P_MAP_ACCESS_DEFAULT)
+        dkey_prefetch_size = H5_daos_plist_cache_g->mapl_cache.dkey_prefetch_size;
+    else if (H5Pget_map_iterate_hints(map->mapl_id, &dkey_prefetch_size, &dkey_alloc_size) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map iterate hints");
+    range.batch_nr = (uint32_t)MIN(MAX(dkey_prefetch_size, 1), UINT32_MAX);
+
+    /* Set up iteration state and a buffer for each part of the map's data
+     * object.  The anchors are set up at the start of each pass. */
+    range.map             = map;
+    range.map_id          = map_id;
+    range.key_mem_type_id = key_mem_type_id;
+    range.op              = op;
+    range.op_data         = op_data;
+    range.op_ret          = H5_ITER_CONT;
+    daos_iov_set(&range.lower_dkey, &range.lower, (daos_size_t)sizeof(uint64_t));
+    if (0 != (ret = H5_daos_map_anchor_split(map, &range.nparts)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't split map for iteration: %s",
+                     H5_daos_err_to_string(ret));
+    if (NULL == (range.parts = (H5_daos_map_range_part_t *)DV_calloc(range.nparts *
+                                                                       sizeof(H5_daos_map_range_part_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate map key range anchors");
+    for (i = 0; i < range.nparts; i++) {
+        H5_daos_map_range_part_t *part = &range.parts[i];
+
+        part->range = &range;
+        if (NULL == (part->kds = (daos_key_desc_t *)DV_malloc(range.batch_nr * sizeof(daos_key_desc_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate map key range key descriptors");
+        if (NULL == (part->keys = (uint64_t *)DV_malloc(range.batch_nr * sizeof(uint64_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate map key range key buffer");
+        daos_iov_set(&part->sg_iov, part->keys, (daos_size_t)(range.batch_nr * sizeof(uint64_t)));
+        part->sgl.sg_nr   = 1;
+        part->sgl.sg_iovs = &part->sg_iov;
+    } /* end for */
+
+    /* Start H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map key range iterate",
+                                              map->obj.item.open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    range.req = int_req;
+
+    /* Create task to start the iteration */
+    if (H5_daos_create_task(H5_daos_map_range_task, 0, NULL, NULL, NULL, &range, &first_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to start map key range iteration");
+
+    /* Create task to be completed once the iteration is done */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &range.end_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create end task for map key range iteration");
+    if (0 != (ret = tse_task_schedule(range.end_task, false))) {
+        range.end_task = NULL;
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule end task for map key range iteration: %s",
+                     H5_daos_err_to_string(ret));
+    } /* end if */
+    dep_task = range.end_task;
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes.  This must be done even on
+         * failure since the tasks use range. */
+        if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if (int_req->status < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, range.op_ret < 0 ? range.op_ret : FAIL,
+                         "map iteration failed in task \"%s\": %s", int_req->failed_task,
+                         H5_daos_err_to_string(int_req->status));
+        else if (ret_value >= 0)
+            ret_value = range.op_ret;
+
+        /* Close internal request */
+        if (H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
+
+    key_buf_alloc = DV_free(key_buf_alloc);
+    if (range.parts) {
+        for (i = 0; i < range.nparts; i++) {
+            DV_free(range.parts[i].kds);
+            DV_free(range.parts[i].keys);
+        } /* end for */
+        range.parts = DV_free(range.parts);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate_range_op() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_get_partial
+ *
+ * Purpose:     Reads len bytes starting at byte offset of the value for
+ *              the specified key in the map map_id into buf, without
+ *              datatype conversion.  For maps that store their values
+ *              out of line only the requested extent of the value is
+ *              fetched.  For other maps the whole value is fetched and
+ *              the requested bytes copied out.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_get_partial(hid_t map_id, hid_t key_mem_type_id, const void *key, size_t offset, size_t len,
+                       void *buf, hid_t dxpl_id)
+{
+    H5_daos_map_get_partial_args_t args;
+
+    args.map_id          = map_id;
+    args.key_mem_type_id = key_mem_type_id;
+    args.key             = key;
+    args.offset          = offset;
+    args.len             = len;
+    args.buf             = buf;
+    args.dxpl_id         = dxpl_id;
+
+    return H5_daos_public_call(H5_daos_map_get_partial_op, &args);
+} /* end H5daos_map_get_partial() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_partial_op
+ *
+ * Purpose:     Body of H5daos_map_get_partial(), run through
+ *              H5_daos_public_call().
+ *
+ * Return:      See H5daos_map_get_partial()
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_get_partial_op(void *_args)
+{
+    H5_daos_map_get_partial_args_t *args            = (H5_daos_map_get_partial_args_t *)_args;
+    hid_t                           map_id          = args->map_id;
+    hid_t                           key_mem_type_id = args->key_mem_type_id;
+    const void                     *key             = args->key;
+    size_t                          offset          = args->offset;
+    size_t                          len             = args->len;
+    void                           *buf             = args->buf;
+    hid_t                           dxpl_id         = args->dxpl_id;
+    H5_daos_map_t                  *map             = NULL;
+    H5_daos_req_t                  *int_req         = NULL;
+    tse_task_t                     *first_task      = NULL;
+    tse_task_t                     *dep_task        = NULL;
+    int                             ret;
+    herr_t                          ret_value = SUCCEED;
+
+    if (NULL == (map = (H5_daos_map_t *)H5VLobject(map_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (H5I_MAP != map->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a map");
+    if (!key)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
+    if (!buf && len > 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer is NULL");
+
+    if (dxpl_id == H5P_DEFAULT)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Start H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map get partial value",
+                                              map->obj.item.open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Wait for the map to open if necessary */
+    if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+
+    /* Check the extent against the value size.  Written so offset + len
+     * cannot wrap around. */
+    if (offset > map->val_file_type_size || len > map->val_file_type_size - offset)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "value extent is past the end of the value");
+
+    /* Read the extent */
+    if (len > 0 && H5_daos_map_get_partial_int(map, key_mem_type_id, key, offset, len, buf, dxpl_id,
+                                               int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't read map key value");
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes */
+        if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if (int_req->status < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
+                         "map partial value read operation failed in task \"%s\": %s", int_req->failed_task,
+                         H5_daos_err_to_string(int_req->status));
+
+        /* Close internal request */
+        if (H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get_partial_op() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_partial_int
+ *
+ * Purpose:     Internal version of H5daos_map_get_partial().  The map
+ *              must be open and the extent must be within the value.
+ *              Creates the task to read the extent but does not schedule
+ *              it, instead returning it in *first_task.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_get_partial_int(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key, size_t offset,
+                            size_t len, void *buf, hid_t dxpl_id, H5_daos_req_t *req, tse_task_t **first_task,
+                            tse_task_t **dep_task)
+{
+    H5_daos_map_rw_ud_t *get_udata = NULL;
+    tse_task_t          *get_task  = NULL;
+    herr_t               ret_value = SUCCEED;
+
+    assert(map);
+    assert(buf);
+    assert(len > 0);
+    assert(offset <= map->val_file_type_size && len <= map->val_file_type_size - offset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct for partial value read task */
+    if (NULL == (get_udata = (H5_daos_map_rw_ud_t *)DV_calloc(sizeof(H5_daos_map_rw_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for map partial value read task arguments");
+    get_udata->md_rw_cb_ud.req    = req;
+    get_udata->md_rw_cb_ud.obj    = &map->obj;
+    get_udata->val_mem_type_id    = H5I_INVALID_HID;
+    get_udata->value_buf          = buf;
+    get_udata->val_file_type_size = map->val_file_type_size;
+    get_udata->val_offset         = offset;
+    get_udata->val_len            = len;
+
+    /* Convert key (if necessary) */
+    if (H5_daos_map_key_conv(map, key_mem_type_id, key, &get_udata->key_buf, &get_udata->key_size,
+                             get_udata->key_buf_local, &get_udata->key_buf_alloc, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&get_udata->md_rw_cb_ud.dkey, get_udata->key_buf,
+                       (daos_size_t)get_udata->key_size);
+    get_udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Set up iods and sgls, and set nr.  Values stored out of line are read
+     * directly into buf, others are read whole into a temporary buffer. */
+    if (map->large_vals)
+        get_udata->md_rw_cb_ud.nr =
+            H5_daos_map_val_io_init(map, &get_udata->val_io, get_udata->md_rw_cb_ud.iod,
+                                    get_udata->md_rw_cb_ud.sgl, get_udata->md_rw_cb_ud.sg_iov, buf, offset,
+                                    len);
+    else {
+        if (NULL == (get_udata->tconv_buf = DV_malloc(map->val_file_type_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map value");
+        get_udata->md_rw_cb_ud.nr = H5_daos_map_val_io_init(
+            map, &get_udata->val_io, get_udata->md_rw_cb_ud.iod, get_udata->md_rw_cb_ud.sgl,
+            get_udata->md_rw_cb_ud.sg_iov, get_udata->tconv_buf, 0, map->val_file_type_size);
+    } /* end else */
+
+    get_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set task name */
+    get_udata->md_rw_cb_ud.task_name = "map partial value retrieval";
+
+    /* Create task to read map value extent */
+    assert(!*dep_task);
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_rw_prep_cb,
+                                 H5_daos_map_get_partial_comp_cb, get_udata, &get_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map value");
+
+    /* Save map value read task to be scheduled later and give it a
+     * reference to req and the map object */
+    assert(!*first_task);
+    *first_task = get_task;
+    *dep_task   = get_task;
+    req->rc++;
+    map->obj.item.rc++;
+
+    get_udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0 && get_udata) {
+        DV_free(get_udata->tconv_buf);
+        DV_free(get_udata->key_buf_alloc);
+        get_udata = DV_free(get_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get_partial_int() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_partial_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
+ *              part of the value of a specified key in a map object.
+ *              Checks that the key was found, copies the requested bytes
+ *              out of the whole value if it was read, then frees private
+ *              data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_get_partial_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rw_ud_t *udata;
+    int                  ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.req->file);
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "map partial value fetch";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        H5_daos_map_t *map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+        htri_t         found;
+
+        assert(map);
+
+        /* Check for missing key-value pair */
+        if ((found = H5_daos_map_val_io_found(map, &udata->val_io, udata->md_rw_cb_ud.iod)) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, -H5_DAOS_H5_GET_ERROR, "can't check map value");
+        if (!found)
+            D_GOTO_ERROR(H5E_MAP, H5E_NOTFOUND, -H5_DAOS_H5_GET_ERROR, "key not found");
+
+        /* Copy requested bytes out of the whole value if necessary */
+        if (udata->tconv_buf)
+            (void)memcpy(udata->value_buf, (uint8_t *)udata->tconv_buf + udata->val_offset, udata->val_len);
+    } /* end else */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Clean up */
+    if (udata) {
+        /* Close map */
+        if (udata->md_rw_cb_ud.obj && H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map partial value read completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        DV_free(udata->tconv_buf);
+        DV_free(udata->key_buf_alloc);
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get_partial_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_multi
+ *
+ * Purpose:     Performs a batched multi-key map operation for
+ *              H5daos_map_put_multi, H5daos_map_get_multi and
+ *              H5daos_map_exists_multi.  The keys are handled by up to
+ *              H5_DAOS_MAP_MULTI_WINDOW slots, each with its own key and
+ *              type conversion buffers.  Each slot has one DAOS operation
+ *              in flight at a time and starts the operation for the next
+ *              unprocessed key when its current one completes, so only
+ *              the slots, and not the keys, need per-operation state.
+ *              Failures for individual keys are recorded in statuses and
+ *              do not stop the other keys.  Blocks until all keys are
+ *              done.  Run through H5_daos_public_call() with an
+ *              H5_daos_map_multi_args_t.
+ *
+ * Return:      Non-negative if all keys succeeded/Negative otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_multi(void *_args)
+{
+    H5_daos_map_multi_args_t *args            = (H5_daos_map_multi_args_t *)_args;
+    hid_t                     map_id          = args->map_id;
+    H5_daos_map_multi_op_t    op              = args->op;
+    hid_t                     key_mem_type_id = args->key_mem_type_id;
+    size_t                    count           = args->count;
+    const void               *keys            = args->keys;
+    hid_t                     val_mem_type_id = args->val_mem_type_id;
+    void                     *values          = args->values;
+    hbool_t                  *exists          = args->exists;
+    herr_t                   *statuses        = args->statuses;
+    hid_t                     dxpl_id         = args->dxpl_id;
+    H5_daos_map_multi_ud_t    multi_udata;
+    H5_daos_map_t            *map        = NULL;
+    H5_daos_req_t            *int_req    = NULL;
+    tse_task_t               *first_task = NULL;
+    tse_task_t               *dep_task   = NULL;
+    hbool_t                   fill_bkg   = FALSE;
+    const char               *op_name    = op == H5_DAOS_MAP_MULTI_PUT   ? "map put multiple values"
+                                           : op == H5_DAOS_MAP_MULTI_GET ? "map get multiple values"
+                                                                         : "map multiple key existence check";
+    size_t                    i;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
+
+    memset(&multi_udata, 0, sizeof(multi_udata));
+
+    if (count > 0 && !keys)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map keys buffer is NULL");
+    if (count > 0 && op != H5_DAOS_MAP_MULTI_EXISTS && !values)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map values buffer is NULL");
+    if (count > 0 && op == H5_DAOS_MAP_MULTI_EXISTS && !exists)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map exists buffer is NULL");
+    if (NULL == (map = (H5_daos_map_t *)H5VLobject(map_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (H5I_MAP != map->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a map");
+
+    /* Check for write access */
+    if (op == H5_DAOS_MAP_MULTI_PUT && !(map->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    /* Mark all keys as failed until they succeed */
+    if (statuses)
+        for (i = 0; i < count; i++)
+            statuses[i] = FAIL;
+
+    if (count == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    if (dxpl_id == H5P_DEFAULT)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Start H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, op_name, map->obj.item.open_req, NULL, NULL,
+                                              dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Wait for the map to open if necessary */
+    if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+
+    /* Set up shared state */
+    multi_udata.req             = int_req;
+    multi_udata.map             = map;
+    multi_udata.op              = op;
+    multi_udata.count           = count;
+    multi_udata.keys            = (const uint8_t *)keys;
+    multi_udata.key_mem_type_id = key_mem_type_id;
+    multi_udata.values          = (uint8_t *)values;
+    multi_udata.val_mem_type_id = val_mem_type_id;
+    multi_udata.exists          = exists;
+    multi_udata.statuses        = statuses;
+    if (0 == (multi_udata.key_mem_type_size = H5Tget_size(key_mem_type_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get key memory datatype size");
+
+    /* Check if type conversion is needed for the values */
+    if (op != H5_DAOS_MAP_MULTI_EXISTS) {
+        if ((multi_udata.val_need_tconv =
+                 op == H5_DAOS_MAP_MULTI_PUT ? H5_daos_need_tconv(val_mem_type_id, map->val_file_type_id)
+                                             : H5_daos_need_tconv(map->val_file_type_id, val_mem_type_id)) <
+            0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+        if (0 == (multi_udata.val_mem_type_size = H5Tget_size(val_mem_type_id)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get value memory datatype size");
+        multi_udata.val_file_type_size = map->val_file_type_size;
+    } /* end if */
+
+    /* Allocate and set up slots */
+    multi_udata.nslots = MIN(count, H5_DAOS_MAP_MULTI_WINDOW);
+    if (NULL == (multi_udata.slots = (H5_daos_map_multi_slot_t *)DV_calloc(
+                     multi_udata.nslots * sizeof(H5_daos_map_multi_slot_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate batched map operation slots");
+    for (i = 0; i < multi_udata.nslots; i++) {
+        H5_daos_map_multi_slot_t *slot = &multi_udata.slots[i];
+
+        slot->md_rw_cb_ud.req = int_req;
+        slot->md_rw_cb_ud.obj = &map->obj;
+        slot->multi_udata     = &multi_udata;
+
+        /* Initialize type conversion.  The buffers are reused for every key
+         * handled by this slot. */
+        if (multi_udata.val_need_tconv) {
+            if (op == H5_DAOS_MAP_MULTI_PUT) {
+                if (H5_daos_tconv_init(val_mem_type_id, &multi_udata.val_mem_type_size,
+                                       map->val_file_type_id, &multi_udata.val_file_type_size, 1, FALSE,
+                                       TRUE, &slot->tconv_buf, &slot->bkg_buf, NULL, &fill_bkg) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+
+                /* Filling the background buffer would need another fetch for
+                 * each key */
+                if (fill_bkg)
+                    D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL,
+                                 "value conversion needing a background buffer is not supported for "
+                                 "batched map put");
+            } /* end if */
+            else if (H5_daos_tconv_init(map->val_file_type_id, &multi_udata.val_file_type_size,
+                                        val_mem_type_id, &multi_udata.val_mem_type_size, 1, FALSE, FALSE,
+                                        &slot->tconv_buf, &slot->bkg_buf, NULL, &multi_udata.fill_bkg) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+        } /* end if */
+    }     /* end for */
+
+    /* Create task to start the first key in each slot */
+    if (H5_daos_create_task(H5_daos_map_multi_task, 0, NULL, NULL, NULL, &multi_udata, &first_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to start batched map operation");
+
+    /* Create task to be completed once all keys are done */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &multi_udata.end_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create end task for batched map operation");
+    if (0 != (ret = tse_task_schedule(multi_udata.end_task, false))) {
+        multi_udata.end_task = NULL;
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule end task for batched map operation: %s",
+                     H5_daos_err_to_string(ret));
+    } /* end if */
+    dep_task = multi_udata.end_task;
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item,
+                                op == H5_DAOS_MAP_MULTI_PUT ? H5_DAOS_OP_TYPE_WRITE : H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes.  This must be done even on
+         * failure since the tasks use multi_udata. */
+        if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if (int_req->status < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
+                         "batched map operation failed in task \"%s\": %s", int_req->failed_task,
+                         H5_daos_err_to_string(int_req->status));
+
+        /* Close internal request */
+        if (H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
+
+    /* Check that every key succeeded */
+    if (ret_value >= 0 && multi_udata.nsucceeded < count)
+        D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "%zu of %zu keys failed", count - multi_udata.nsucceeded,
+                     count);
+
+    /* Free slots */
+    if (multi_udata.slots) {
+        for (i = 0; i < multi_udata.nslots; i++) {
+            assert(!multi_udata.slots[i].key_buf_alloc);
+            DV_free(multi_udata.slots[i].tconv_buf);
+            DV_free(multi_udata.slots[i].bkg_buf);
+        } /* end for */
+        multi_udata.slots = DV_free(multi_udata.slots);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_multi_task
+ *
+ * Purpose:     Asynchronous task to start the first key in each slot of a
+ *              batched multi-key map operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_multi_task(tse_task_t *task)
+{
+    H5_daos_map_multi_ud_t *udata;
+    size_t                  i;
+    int                     ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for batched map operation task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_MAP);
+
+    /* Start the first key in each slot */
+    for (i = 0; i < udata->nslots; i++)
+        if (H5_daos_map_multi_slot_start(&udata->slots[i]) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't start batched map operation");
+
+done:
+    if (udata) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "batched map operation start";
+        } /* end if */
+
+        /* Complete end task now if no keys were started */
+        if (udata->nactive == 0 && udata->end_task)
+            tse_task_complete(udata->end_task, 0);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_multi_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_multi_slot_start
+ *
+ * Purpose:     Starts the DAOS operation for the next unprocessed key of
+ *              a batched multi-key map operation in the given slot.  Keys
+ *              that fail conversion are skipped, leaving their status as
+ *              failed.  Does nothing if there are no keys left.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_multi_slot_start(H5_daos_map_multi_slot_t *slot)
+{
+    H5_daos_map_multi_ud_t *multi_udata;
+    H5_daos_map_t          *map;
+    uint8_t                *value;
+    herr_t                  ret_value = SUCCEED;
+
+    assert(slot);
+    assert(slot->multi_udata);
+    assert(!slot->key_buf_alloc);
+
+    multi_udata = slot->multi_udata;
+    map         = multi_udata->map;
+
+    while (multi_udata->next_idx < multi_udata->count) {
+        slot->idx = multi_udata->next_idx++;
+        value     = multi_udata->values ? multi_udata->values + (slot->idx * multi_udata->val_mem_type_size)
+                                        : NULL;
+
+        /* Convert key (if necessary) */
+        if (H5_daos_map_key_conv(map, multi_udata->key_mem_type_id,
+                                 multi_udata->keys + (slot->idx * multi_udata->key_mem_type_size),
+                                 &slot->key_buf, &slot->key_size, slot->key_buf_local, &slot->key_buf_alloc,
+                                 multi_udata->req->dxpl_id) < 0)
+            continue;
+
+        /* Keys ruled out by the map's Bloom filter need no fetch.  Keys
+         * being put are added to it. */
+        if (multi_udata->op == H5_DAOS_MAP_MULTI_EXISTS) {
+            if (!H5_daos_map_bloom_test(map, slot->key_buf, slot->key_size)) {
+                multi_udata->exists[slot->idx] = FALSE;
+                multi_udata->nsucceeded++;
+                if (multi_udata->statuses)
+                    multi_udata->statuses[slot->idx] = SUCCEED;
+                slot->key_buf_alloc = DV_free(slot->key_buf_alloc);
+                continue;
+            } /* end if */
+        }     /* end if */
+        else if (multi_udata->op == H5_DAOS_MAP_MULTI_PUT)
+            H5_daos_map_bloom_add(map, slot->key_buf, slot->key_size);
+
+        /* Set up dkey */
+        daos_const_iov_set((d_const_iov_t *)&slot->md_rw_cb_ud.dkey, slot->key_buf,
+                           (daos_size_t)slot->key_size);
+
+        if (multi_udata->op == H5_DAOS_MAP_MULTI_EXISTS) {
+            /* Set up iod to fetch only the size of the map record */
+            memset(&slot->md_rw_cb_ud.iod[0], 0, sizeof(daos_iod_t));
+            daos_const_iov_set((d_const_iov_t *)&slot->md_rw_cb_ud.iod[0].iod_name, H5_daos_map_key_g,
+                               H5_daos_map_key_size_g);
+            slot->md_rw_cb_ud.iod[0].iod_nr   = 1u;
+            slot->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
+            slot->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+
+            /* Set nr */
+            slot->md_rw_cb_ud.nr = 1u;
+        } /* end if */
+        else {
+            if (multi_udata->val_need_tconv) {
+                if (multi_udata->op == H5_DAOS_MAP_MULTI_PUT) {
+                    /* Convert value to type conversion buffer */
+                    (void)memcpy(slot->tconv_buf, value, multi_udata->val_mem_type_size);
+                    if (H5Tconvert(multi_udata->val_mem_type_id, map->val_file_type_id, 1, slot->tconv_buf,
+                                   slot->bkg_buf, multi_udata->req->dxpl_id) < 0) {
+                        slot->key_buf_alloc = DV_free(slot->key_buf_alloc);
+                        continue;
+                    } /* end if */
+                }     /* end if */
+                else if (multi_udata->fill_bkg)
+                    /* Fill background buffer from value buffer */
+                    (void)memcpy(slot->bkg_buf, value, multi_udata->val_mem_type_size);
+            } /* end if */
+
+            /* Set up iods and sgls for tconv_buf or value, and set nr */
+            slot->md_rw_cb_ud.nr = H5_daos_map_val_io_init(
+                map, &slot->val_io, slot->md_rw_cb_ud.iod, slot->md_rw_cb_ud.sgl, slot->md_rw_cb_ud.sg_iov,
+                multi_udata->val_need_tconv ? slot->tconv_buf : value, 0, multi_udata->val_file_type_size);
+        } /* end else */
+
+        /* Puts are conditional, so new keys can be counted in the map's
+         * entry count */
+        slot->md_rw_cb_ud.flags = multi_udata->op == H5_DAOS_MAP_MULTI_PUT ? H5_daos_map_put_flags(map) : 0;
+
+        /* Set task name */
+        slot->md_rw_cb_ud.task_name = "batched map operation";
+
+        /* Start the DAOS operation for this key */
+        if (H5_daos_map_multi_slot_issue(slot) < 0) {
+            slot->key_buf_alloc = DV_free(slot->key_buf_alloc);
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't start batched map operation for key");
+        } /* end if */
+
+        break;
+    } /* end while */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_multi_slot_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_multi_slot_issue
+ *
+ * Purpose:     Creates and schedules the DAOS operation for the key
+ *              currently set up in the given slot of a batched multi-key
+ *              map operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_multi_slot_issue(H5_daos_map_multi_slot_t *slot)
+{
+    H5_daos_map_multi_ud_t *multi_udata;
+    tse_task_t             *io_task = NULL;
+    int                     ret;
+    herr_t                  ret_value = SUCCEED;
+
+    assert(slot);
+    assert(slot->multi_udata);
+
+    multi_udata = slot->multi_udata;
+
+    /* Create task for this key */
+    if (H5_daos_create_daos_task(multi_udata->op == H5_DAOS_MAP_MULTI_PUT ? DAOS_OPC_OBJ_UPDATE
+                                                                          : DAOS_OPC_OBJ_FETCH,
+                                 0, NULL, H5_daos_map_multi_prep_cb, H5_daos_map_multi_comp_cb, slot,
+                                 &io_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task for batched map operation");
+
+    /* Schedule task */
+    if (0 != (ret = tse_task_schedule(io_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task for batched map operation: %s",
+                     H5_daos_err_to_string(ret));
+    multi_udata->nactive++;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_multi_slot_issue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_multi_prep_cb
+ *
+ * Purpose:     Prepare callback for the asynchronous daos_obj_update or
+ *              daos_obj_fetch for one key of a batched multi-key map
+ *              operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_multi_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_multi_slot_t *slot;
+    daos_obj_rw_t            *rw_args;
+    int                       ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (slot = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for batched map operation task");
+
+    assert(slot->md_rw_cb_ud.req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(slot->md_rw_cb_ud.req);
+
+    assert(slot->md_rw_cb_ud.obj);
+
+    /* Set task arguments.  Existence checks only fetch the value size. */
+    if (NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for batched map operation task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh    = H5_DAOS_MAP_DATA_OH((H5_daos_map_t *)slot->md_rw_cb_ud.obj);
+    rw_args->th    = slot->md_rw_cb_ud.req->th;
+    rw_args->flags = slot->md_rw_cb_ud.flags;
+    rw_args->dkey  = &slot->md_rw_cb_ud.dkey;
+    rw_args->nr    = slot->md_rw_cb_ud.nr;
+    rw_args->iods  = slot->md_rw_cb_ud.iod;
+    rw_args->sgls  = slot->multi_udata->op == H5_DAOS_MAP_MULTI_EXISTS ? NULL : slot->md_rw_cb_ud.sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_multi_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_multi_comp_cb
+ *
+ * Purpose:     Complete callback for the asynchronous daos_obj_update or
+ *              daos_obj_fetch for one key of a batched multi-key map
+ *              operation.  Records the outcome for the key, then starts
+ *              the next key in the same slot.  Completes the operation's
+ *              end task once no keys are left in flight.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_multi_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_multi_slot_t *slot;
+    H5_daos_map_multi_ud_t   *multi_udata   = NULL;
+    hbool_t                   key_succeeded = FALSE;
+    hbool_t                   retry         = FALSE;
+    int                       ret_value     = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (slot = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for batched map operation task");
+
+    multi_udata = slot->multi_udata;
+
+    /* Check the outcome for this key.  Failures of individual keys are only
+     * recorded in the key's status, so they do not fail the request.  A put
+     * whose guess of whether its key exists was wrong is repeated with the
+     * other condition. */
+    if (multi_udata->op == H5_DAOS_MAP_MULTI_PUT &&
+        H5_daos_map_put_retry(multi_udata->map, &slot->md_rw_cb_ud.flags, task->dt_result))
+        retry = TRUE;
+    else if (task->dt_result == 0) {
+        switch (multi_udata->op) {
+            case H5_DAOS_MAP_MULTI_PUT:
+                key_succeeded = TRUE;
+                break;
+
+            case H5_DAOS_MAP_MULTI_GET:
+                /* Check for missing key-value pair */
+                if (H5_daos_map_val_io_found(multi_udata->map, &slot->val_io, slot->md_rw_cb_ud.iod) <= 0)
+                    break;
+
+                /* Perform type conversion if necessary */
+                if (multi_udata->val_need_tconv) {
+                    if (H5Tconvert(multi_udata->map->val_file_type_id, multi_udata->val_mem_type_id, 1,
+                                   slot->tconv_buf, slot->bkg_buf, multi_udata->req->dxpl_id) < 0)
+                        break;
+                    (void)memcpy(multi_udata->values + (slot->idx * multi_udata->val_mem_type_size),
+                                 slot->tconv_buf, multi_udata->val_mem_type_size);
+                } /* end if */
+                key_succeeded = TRUE;
+                break;
+
+            case H5_DAOS_MAP_MULTI_EXISTS:
+                multi_udata->exists[slot->idx] = (slot->md_rw_cb_ud.iod[0].iod_size != 0);
+                key_succeeded                  = TRUE;
+                break;
+
+            default:
+                assert(0 && "unknown batched map operation");
+        } /* end switch */
+    }     /* end if */
+    if (key_succeeded) {
+        multi_udata->nsucceeded++;
+        if (multi_udata->statuses)
+            multi_udata->statuses[slot->idx] = SUCCEED;
+    } /* end if */
+
+    if (!retry)
+        slot->key_buf_alloc = DV_free(slot->key_buf_alloc);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if (multi_udata) {
+        multi_udata->nactive--;
+
+        /* Repeat the put of this key or start the next key in this slot,
+         * unless the request has failed or been canceled */
+        if (ret_value >= 0 && multi_udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            if (retry) {
+                /* The new task now owns the key buffer */
+                if (H5_daos_map_multi_slot_issue(slot) < 0)
+                    D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                                 "can't repeat put in batched map operation");
+                else
+                    retry = FALSE;
+            } /* end if */
+            else if (H5_daos_map_multi_slot_start(slot) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't start next key of batched map operation");
+        } /* end if */
+
+        /* Free the key buffer if the repeated put was not started */
+        if (retry)
+            slot->key_buf_alloc = DV_free(slot->key_buf_alloc);
+
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && multi_udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            multi_udata->req->status      = ret_value;
+            multi_udata->req->failed_task = "batched map operation completion callback";
+        } /* end if */
+
+        /* Complete end task once no keys are in flight */
+        if (multi_udata->nactive == 0)
+            tse_task_complete(multi_udata->end_task, 0);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_multi_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get
+ *
+ * Purpose:     Gets certain information about a map
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_map_get(void *_map, H5VL_map_args_t *map_args, hid_t dxpl_id, void H5VL_DAOS_UNUSED **req)
+{
+    H5_daos_map_t *map        = (H5_daos_map_t *)_map;
+    H5_daos_req_t *int_req    = NULL;
+    tse_task_t    *first_task = NULL;
+    tse_task_t    *dep_task   = NULL;
+    int            ret;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    assert(map_args);
+
+    if (!_map)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    switch (map_args->get.get_type) {
+        case H5VL_MAP_GET_MCPL: {
+            hid_t *plist_id = &map_args->get.args.get_mcpl.mcpl_id;
+
+            /* Wait for the map to open if necessary */
+            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (map->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
+            } /* end if */
+
+            /* Retrieve the map's creation property list */
+            if ((*plist_id = H5Pcopy(map->mcpl_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map creation property list");
+
+            /* Set map's object class on dcpl */
+            if (H5_daos_set_oclass_from_oid(*plist_id, map->obj.oid) < 0)
+                D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object class property");
+
+            break;
+        } /* end block */
+        case H5VL_MAP_GET_MAPL: {
+            hid_t *plist_id = &map_args->get.args.get_mapl.mapl_id;
+
+            /* Wait for the map to open if necessary */
+            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (map->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
+            } /* end if */
+
+            /* Retrieve the map's access property list */
+            if ((*plist_id = H5Pcopy(map->mapl_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map access property list");
+
+            break;
+        } /* end block */
+        case H5VL_MAP_GET_KEY_TYPE: {
+            hid_t *ret_id = &map_args->get.args.get_key_type.type_id;
+
+            /* Wait for the map to open if necessary */
+            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (map->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
+            } /* end if */
+
+            /* Retrieve the map's key datatype */
+            if ((*ret_id = H5Tcopy(map->key_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get key datatype ID of map");
+            break;
+        } /* end block */
+        case H5VL_MAP_GET_VAL_TYPE: {
+            hid_t *ret_id = &map_args->get.args.get_val_type.type_id;
+
+            /* Wait for the map to open if necessary */
+            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (map->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
+            } /* end if */
+
+            /* Retrieve the map's value datatype */
+            if ((*ret_id = H5Tcopy(map->val_type_id)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get value datatype ID of map");
+            break;
+        } /* end block */
+        case H5VL_MAP_GET_COUNT: {
+            H5_daos_map_get_count_ud_t *count_udata = NULL;
+            tse_task_t                 *count_task  = NULL;
+            tse_task_t                 *end_task    = NULL;
+            hsize_t                    *count       = &map_args->get.args.get_count.count;
+
+            /* Wait for the map to open if necessary */
+            /* Needed because below code accesses map->key_type_id */
+            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (map->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "group open failed");
+            } /* end if */
+
+            /* Start H5 operation */
+            if (NULL == (int_req = H5_daos_req_create(map->obj.item.file, "get map key count",
+                                                      map->obj.item.open_req, NULL, NULL, dxpl_id)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+            /* Initialize counter */
+            *count = 0;
+
+            /* Allocate argument struct */
+            if (NULL == (count_udata = (H5_daos_map_get_count_ud_t *)DV_calloc(
+                             sizeof(H5_daos_map_get_count_ud_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                             "can't allocate buffer for map entry count task arguments");
+            count_udata->md_rw_cb_ud.req = int_req;
+            count_udata->md_rw_cb_ud.obj = &map->obj;
+            count_udata->map             = map;
+            count_udata->count           = count;
+
+            /* Set up dkey and akey.  Point to global name buffers, do not
+             * free.  The rest of the iod and the sgl are set up when the
+             * fetch runs. */
+            daos_const_iov_set((d_const_iov_t *)&count_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
+                               H5_daos_int_md_key_size_g);
+            daos_const_iov_set((d_const_iov_t *)&count_udata->md_rw_cb_ud.iod[0].iod_name,
+                               H5_daos_map_count_key_g, H5_daos_map_count_key_size_g);
+            count_udata->md_rw_cb_ud.nr         = 1u;
+            count_udata->md_rw_cb_ud.free_dkey  = FALSE;
+            count_udata->md_rw_cb_ud.free_akeys = FALSE;
+            count_udata->md_rw_cb_ud.task_name  = "map entry count read";
+
+            /* Create task to read the rank slots of the entry count */
+            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_get_count_fetch_prep_cb,
+                                         H5_daos_map_get_count_fetch_comp_cb, count_udata, &first_task) < 0) {
+                count_udata = DV_free(count_udata);
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map entry count");
+            } /* end if */
+            dep_task = first_task;
+
+            /* Create task to count the keys of a legacy map */
+            if (H5_daos_create_task(H5_daos_map_get_count_task, 1, &dep_task, NULL, NULL, count_udata,
+                                    &count_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to get map entry count");
+            count_udata->next_task = count_task;
+            if (0 != (ret = tse_task_schedule(count_task, false)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to get map entry count: %s",
+                             H5_daos_err_to_string(ret));
+            dep_task = count_task;
+
+            /* Create task to finish and free count_udata, and give it a
+             * reference to req and the map */
+            if (H5_daos_create_task(H5_daos_map_get_count_end_task, 1, &dep_task, NULL, NULL, count_udata,
+                                    &end_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finish map entry count");
+            if (0 != (ret = tse_task_schedule(end_task, false)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
+                             "can't schedule task to finish map entry count: %s", H5_daos_err_to_string(ret));
+            dep_task = end_task;
+            int_req->rc++;
+            map->obj.item.rc++;
+
+            break;
+        } /* end block */
+        default:
+            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "can't get this type of information from map");
+    } /* end switch */
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "map get operation failed in task \"%s\": %s",
+                             int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+            /* Close internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    }     /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_count_cb
+ *
+ * Purpose:     Iterate callback for H5Mget_count()
+ *
+ * Return:      Success:        0 (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_get_count_cb(hid_t H5VL_DAOS_UNUSED map_id, const void H5VL_DAOS_UNUSED *key, void *_int_count)
+{
+    hsize_t *int_count = (hsize_t *)_int_count;
+
+    (*int_count)++;
+
+    return 0;
+} /* end H5_daos_map_get_count_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_count_fetch_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to read
+ *              the rank slots of a map's entry count, along with the
+ *              header giving their number.  Reads enough slots for this
+ *              job and for any larger job seen to change the map, so the
+ *              fetch is normally only repeated if a larger job changed
+ *              the map since.  Skips the fetch for known legacy maps.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_get_count_fetch_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_get_count_ud_t *udata;
+    H5_daos_map_shared_t       *shared;
+    daos_obj_rw_t              *fetch_args;
+    uint8_t                    *tmp_realloc;
+    int                         ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map entry count read task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->map);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_MAP);
+
+    shared = udata->map->shared;
+    assert(shared);
+
+    /* Legacy maps are counted by iteration */
+    if (shared->legacy)
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+
+    /* Choose the number of cells to read, unless a repeated fetch already
+     * chose it from the header */
+    if (udata->ncells == 0)
+        udata->ncells = 1 + MAX(MAX((uint64_t)H5_DAOS_MAP_COUNT_NSLOTS_MIN,
+                                    (uint64_t)udata->map->obj.item.file->num_procs),
+                                shared->nslots);
+
+    /* Allocate the buffer, and zero it so slots never written read as 0 */
+    if (NULL == (tmp_realloc = (uint8_t *)DV_realloc(udata->buf,
+                                                     (size_t)udata->ncells * H5_DAOS_ENCODED_UINT64_T_SIZE)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate buffer for map entry count");
+    udata->buf = tmp_realloc;
+    memset(udata->buf, 0, (size_t)udata->ncells * H5_DAOS_ENCODED_UINT64_T_SIZE);
+
+    /* Set up iod.  The record size is left to DAOS so a map with no entry
+     * count reads nothing. */
+    udata->recx.rx_idx                  = 0;
+    udata->recx.rx_nr                   = udata->ncells;
+    udata->md_rw_cb_ud.iod[0].iod_nr    = 1u;
+    udata->md_rw_cb_ud.iod[0].iod_size  = DAOS_REC_ANY;
+    udata->md_rw_cb_ud.iod[0].iod_recxs = &udata->recx;
+    udata->md_rw_cb_ud.iod[0].iod_type  = DAOS_IOD_ARRAY;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->buf,
+                 (daos_size_t)udata->ncells * H5_DAOS_ENCODED_UINT64_T_SIZE);
+    udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
+    udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+    udata->md_rw_cb_ud.sgl[0].sg_iovs   = &udata->md_rw_cb_ud.sg_iov[0];
+
+    /* Set fetch task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for map entry count read task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh   = udata->map->obj.obj_oh;
+    fetch_args->th   = udata->md_rw_cb_ud.req->th;
+    fetch_args->dkey = &udata->md_rw_cb_ud.dkey;
+    fetch_args->nr   = udata->md_rw_cb_ud.nr;
+    fetch_args->iods = udata->md_rw_cb_ud.iod;
+    fetch_args->sgls = udata->md_rw_cb_ud.sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get_count_fetch_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_count_fetch_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
+ *              the rank slots of a map's entry count.  Sums the slots of
+ *              the other ranks and this process's own count, which is
+ *              this rank's slot plus the changes made in this process
+ *              and not yet synced.  Repeats the fetch if the header names
+ *              more slots than were read.  If the map has no entry count
+ *              it is a legacy map and is counted by iteration.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_get_count_fetch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_get_count_ud_t *udata;
+    hbool_t                     reinit = FALSE;
+    int                         ret;
+    int                         ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map entry count read task");
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+    } /* end if */
+    else if (task->dt_result == 0) {
+        H5_daos_map_shared_t *shared = udata->map->shared;
+        uint8_t              *p      = udata->buf;
+        uint64_t              nslots;
+        uint64_t              cell;
+        uint64_t              own_idx = 1 + (uint64_t)shared->rank;
+        uint64_t              i;
+        int64_t               total = 0;
+
+        if (udata->md_rw_cb_ud.iod[0].iod_size == 0)
+            /* No entry count means the map was written by a version that did
+             * not maintain one */
+            shared->legacy = TRUE;
+        else {
+            UINT64DECODE(p, nslots);
+            if (nslots + 1 > udata->ncells) {
+                /* Read again, with all slots */
+                udata->ncells = nslots + 1;
+                reinit        = TRUE;
+            } /* end if */
+            else {
+                assert(own_idx < udata->ncells);
+
+                /* Sum the slots of the other ranks.  This rank's slot is
+                 * only used if nothing is known of it yet. */
+                for (i = 1; i < udata->ncells; i++) {
+                    UINT64DECODE(p, cell);
+                    if (i != own_idx)
+                        total += (int64_t)cell;
+                    else if (!shared->count_known) {
+                        shared->count_base  = (int64_t)cell;
+                        shared->count_known = TRUE;
+                    } /* end if */
+                }     /* end for */
+                if (nslots > shared->nslots)
+                    shared->nslots = nslots;
+
+                total += shared->count_base + shared->count_pending + shared->count_delta;
+                *udata->count = total > 0 ? (hsize_t)total : 0;
+            } /* end else */
+        }     /* end else */
+    }         /* end if */
+
+    if (reinit) {
+        /* Re-register callback functions for re-initialized fetch task */
+        if (0 != (ret = tse_task_register_cbs(task, H5_daos_map_get_count_fetch_prep_cb, NULL, 0,
+                                              H5_daos_map_get_count_fetch_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't register callbacks for task to read map entry count: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Register dependency on this task for the next task */
+        assert(udata->next_task);
+        if (0 != (ret = tse_task_register_deps(udata->next_task, 1, &task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret,
+                         "can't create dependencies for task after map entry count read: %s",
+                         H5_daos_err_to_string(ret));
+
+        if (0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't re-initialize task to read map entry count: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+
+done:
+    if (udata) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map entry count read completion callback";
+        } /* end if */
+    }     /* end if */
+
+    /* Return task to task list if it is not being repeated */
+    if ((!reinit || ret_value < 0) && H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get_count_fetch_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_rec_read_init
+ *
+ * Purpose:     Initializes the user data for reading the Bloom filter
+ *              records of a map.  Allocates the buffer for listing the
+ *              record akeys.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_rec_read_init(H5_daos_map_rec_read_ud_t *udata, H5_daos_map_t *map, H5_daos_req_t *req)
+{
+    char  *akey_buf  = NULL;
+    herr_t ret_value = SUCCEED;
+
+    assert(udata);
+    assert(map);
+    assert(req);
+
+    udata->md_rw_cb_ud.req = req;
+    udata->md_rw_cb_ud.obj = &map->obj;
+    udata->map             = map;
+
+    /* Set up dkey.  Point to global name buffer, do not free. */
+    daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
+                       H5_daos_int_md_key_size_g);
+    udata->md_rw_cb_ud.free_dkey  = FALSE;
+    udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Allocate buffer for listing the record akeys */
+    if (NULL == (akey_buf = (char *)DV_malloc(H5_DAOS_ITER_SIZE_INIT)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for akeys");
+    daos_iov_set(&udata->list_sg_iov, akey_buf, (daos_size_t)H5_DAOS_ITER_SIZE_INIT);
+    udata->list_sgl.sg_nr     = 1;
+    udata->list_sgl.sg_nr_out = 0;
+    udata->list_sgl.sg_iovs   = &udata->list_sg_iov;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_rec_read_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_rec_read
+ *
+ * Purpose:     Creates and schedules the tasks to list and read the
+ *              Bloom filter records of a map, after *dep_task if it is
+ *              not NULL.  *dep_task is set to the read task.  The caller
+ *              must set udata->next_task to the task that depends on the
+ *              read task before the tasks run, and must keep the user
+ *              data and the map alive until that task runs.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_rec_read(H5_daos_map_rec_read_ud_t *udata, tse_task_t **dep_task)
+{
+    tse_task_t *list_task = NULL;
+    int         ret;
+    herr_t      ret_value = SUCCEED;
+
+    assert(udata);
+    assert(dep_task);
+
+    /* Create task to list the records */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_LIST_AKEY, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_map_rec_list_prep_cb, H5_daos_map_rec_list_comp_cb, udata,
+                                 &list_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to list map records");
+    if (0 != (ret = tse_task_schedule(list_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to list map records: %s",
+                     H5_daos_err_to_string(ret));
+    *dep_task = list_task;
+
+    /* Create task to read the records found */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_map_rec_fetch_prep_cb,
+                                 H5_daos_map_rec_fetch_comp_cb, udata, &udata->fetch_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map records");
+    if (0 != (ret = tse_task_schedule(udata->fetch_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to read map records: %s",
+                     H5_daos_err_to_string(ret));
+    *dep_task = udata->fetch_task;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_rec_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_rec_read_free
+ *
+ * Purpose:     Frees the buffers in the user data for reading the
+ *              Bloom filter records of a map.  Does not free the user data
+ *              itself.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_map_rec_read_free(H5_daos_map_rec_read_ud_t *udata)
+{
+    assert(udata);
+
+    udata->list_sg_iov.iov_buf = DV_free(udata->list_sg_iov.iov_buf);
+    udata->rec_keys            = DV_free(udata->rec_keys);
+    udata->rec_buf             = DV_free(udata->rec_buf);
+} /* end H5_daos_map_rec_read_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_rec_list_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_list_akey to
+ *              find the Bloom filter records of a map.  Skips the list if
+ *              the caller asked to read nothing.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_rec_list_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rec_read_ud_t *udata;
+    daos_obj_list_akey_t      *list_args;
+    int                        ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map record list task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->map);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_MAP);
+
+    /* Check if there is nothing to read */
+    if (udata->skip)
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+
+    /* Reset akey_nr */
+    udata->akey_nr = H5_DAOS_ITER_LEN;
+
+    /* Set list task arguments */
+    if (NULL == (list_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for map record list task");
+    memset(list_args, 0, sizeof(*list_args));
+    list_args->oh          = udata->map->obj.obj_oh;
+    list_args->th          = udata->md_rw_cb_ud.req->th;
+    list_args->dkey        = &udata->md_rw_cb_ud.dkey;
+    list_args->nr          = &udata->akey_nr;
+    list_args->kds         = udata->kds;
+    list_args->sgl         = &udata->list_sgl;
+    list_args->type        = DAOS_IOD_NONE;
+    list_args->akey_anchor = &udata->anchor;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_rec_list_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_rec_list_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_list_akey to
+ *              find the Bloom filter records of a map.  Saves the akeys
+ *              of the records, then repeats the list until all akeys are
+ *              seen.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_rec_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rec_read_ud_t *udata;
+    hbool_t                    reinit = FALSE;
+    int                        ret;
+    int                        ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map record list task");
+
+    assert(udata->fetch_task);
+
+    /* Check for buffer not large enough */
+    if (task->dt_result == -DER_KEY2BIG) {
+        size_t akey_buf_len;
+        char  *tmp_realloc;
+
+        /* Allocate larger buffer */
+        akey_buf_len = udata->list_sg_iov.iov_buf_len * 2;
+        if (NULL == (tmp_realloc = (char *)DV_realloc(udata->list_sg_iov.iov_buf, akey_buf_len)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't reallocate key buffer");
+
+        /* Update SGL */
+        daos_iov_set(&udata->list_sg_iov, tmp_realloc, (daos_size_t)akey_buf_len);
+        udata->list_sgl.sg_nr_out = 0;
+
+        reinit = TRUE;
+    } /* end if */
+    else if (task->dt_result < -H5_DAOS_PRE_ERROR) {
+        /* Handle errors in list task.  Only record error in udata->req_status
+         * if it does not already contain an error (it could contain an error
+         * if another task this task is not dependent on also failed). */
+        if (udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = task->dt_result;
+            udata->md_rw_cb_ud.req->failed_task = "map record list";
+        } /* end if */
+    }     /* end if */
+    else if (task->dt_result == 0) {
+        uint8_t *p = (uint8_t *)udata->list_sg_iov.iov_buf;
+        uint32_t i;
+
+        /* Save the akeys of the records, including this rank's own, which
+         * holds keys put through this rank before the map was opened */
+        for (i = 0; i < udata->akey_nr; i++) {
+            size_t key_len = (size_t)udata->kds[i].kd_key_len;
+
+            if (key_len == H5_DAOS_MAP_BLOOM_REC_KEY_SIZE &&
+                !memcmp(p, H5_daos_map_bloom_key_g, H5_daos_map_bloom_key_size_g)) {
+                /* Make room for another record if necessary */
+                if (udata->nrecs == udata->rec_keys_nalloc) {
+                    size_t   nalloc = udata->rec_keys_nalloc ? 2 * udata->rec_keys_nalloc : H5_DAOS_ITER_LEN;
+                    uint8_t *tmp_realloc;
+
+                    if (NULL == (tmp_realloc = (uint8_t *)DV_realloc(udata->rec_keys, nalloc * key_len)))
+                        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                                     "can't reallocate map record akey buffer");
+                    udata->rec_keys        = tmp_realloc;
+                    udata->rec_keys_nalloc = nalloc;
+                } /* end if */
+
+                (void)memcpy(&udata->rec_keys[udata->nrecs * key_len], p, key_len);
+                udata->nrecs++;
+            } /* end if */
+
+            /* Advance to next akey */
+            p += key_len;
+        } /* end for */
+
+        /* Repeat the list if there are more akeys */
+        if (!daos_anchor_is_eof(&udata->anchor))
+            reinit = TRUE;
+    } /* end if */
+
+    if (reinit) {
+        /* Re-register callback functions for re-initialized akey list task */
+        if (0 != (ret = tse_task_register_cbs(task, H5_daos_map_rec_list_prep_cb, NULL, 0,
+                                              H5_daos_map_rec_list_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't register callbacks for task to list map records: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Register dependency on this task for the record read task */
+        if (0 != (ret = tse_task_register_deps(udata->fetch_task, 1, &task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't create dependencies for map record read task: %s",
+                         H5_daos_err_to_string(ret));
+
+        if (0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't re-initialize task to list map records: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+
+done:
+    if (udata) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map record list completion callback";
+        } /* end if */
+    }     /* end if */
+
+    /* Return task to task list if it is not being repeated */
+    if ((!reinit || ret_value < 0) && H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_rec_list_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_rec_fetch_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to read
+ *              the next batch of the Bloom filter records found by the
+ *              list.  Skips the read if there are none left.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_rec_fetch_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rec_read_ud_t *udata;
+    daos_obj_rw_t             *fetch_args;
+    size_t                     buf_size = 0;
+    size_t                     rec_size;
+    size_t                     rec_idx;
+    size_t                     i;
+    int                        ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map record read task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->map);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_MAP);
+
+    /* Check if there is nothing (left) to read */
+    if (udata->skip || udata->next_rec >= udata->nrecs)
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+
+    assert(udata->map->shared);
+
+    /* Choose the records to read, bounding the size of the batch */
+    rec_size = (size_t)udata->map->shared->bloom_size;
+    for (udata->fetch_nr = 0;
+         udata->fetch_nr < H5_DAOS_MAP_REC_FETCH_MAX && udata->next_rec + udata->fetch_nr < udata->nrecs;
+         udata->fetch_nr++) {
+        if (udata->fetch_nr > 0 && buf_size + rec_size > H5_DAOS_MAP_REC_FETCH_BYTES)
+            break;
+        buf_size += rec_size;
+    } /* end for */
+
+    /* Make sure the buffer is large enough, and zero it so a record removed
+     * since the list reads as empty */
+    if (buf_size > udata->rec_buf_size) {
+        uint8_t *tmp_realloc;
+
+        if (NULL == (tmp_realloc = (uint8_t *)DV_realloc(udata->rec_buf, buf_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate buffer for map records");
+        udata->rec_buf      = tmp_realloc;
+        udata->rec_buf_size = buf_size;
+    } /* end if */
+    memset(udata->rec_buf, 0, buf_size);
+
+    /* Set up iods and sgls */
+    buf_size = 0;
+    for (i = 0; i < udata->fetch_nr; i++) {
+        rec_idx = udata->next_rec + i;
+        daos_iov_set(&udata->iods[i].iod_name, &udata->rec_keys[rec_idx * H5_DAOS_MAP_BLOOM_REC_KEY_SIZE],
+                     (daos_size_t)H5_DAOS_MAP_BLOOM_REC_KEY_SIZE);
+        udata->iods[i].iod_nr    = 1u;
+        udata->iods[i].iod_size  = (daos_size_t)rec_size;
+        udata->iods[i].iod_type  = DAOS_IOD_SINGLE;
+        udata->iods[i].iod_recxs = NULL;
+
+        daos_iov_set(&udata->sg_iovs[i], &udata->rec_buf[buf_size], (daos_size_t)rec_size);
+        udata->sgls[i].sg_nr     = 1;
+        udata->sgls[i].sg_nr_out = 0;
+        udata->sgls[i].sg_iovs   = &udata->sg_iovs[i];
+
+        buf_size += rec_size;
+    } /* end for */
+
+    /* Set fetch task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for map record read task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh   = udata->map->obj.obj_oh;
+    fetch_args->th   = udata->md_rw_cb_ud.req->th;
+    fetch_args->dkey = &udata->md_rw_cb_ud.dkey;
+    fetch_args->nr   = (unsigned)udata->fetch_nr;
+    fetch_args->iods = udata->iods;
+    fetch_args->sgls = udata->sgls;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_rec_fetch_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_rec_fetch_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
+ *              a batch of the Bloom filter records of a map.  Combines
+ *              the records into the map's filter, then repeats the read
+ *              until all records are read.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_rec_fetch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rec_read_ud_t *udata;
+    hbool_t                    reinit = FALSE;
+    int                        ret;
+    int                        ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map record read task");
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "map record read";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        H5_daos_map_shared_t *shared = udata->map->shared;
+        uint8_t              *p      = udata->rec_buf;
+        uint64_t              j;
+        size_t                i;
+
+        assert(udata->next_task);
+        assert(shared->bloom);
+
+        /* Combine the records into the map's filter */
+        for (i = 0; i < udata->fetch_nr; i++) {
+            for (j = 0; j < shared->bloom_size; j++)
+                shared->bloom[j] |= p[j];
+            p += shared->bloom_size;
+        } /* end for */
+
+        /* Repeat the read if there are more records */
+        udata->next_rec += udata->fetch_nr;
+        if (udata->next_rec < udata->nrecs)
+            reinit = TRUE;
+    } /* end if */
+
+    if (reinit) {
+        /* Re-register callback functions for re-initialized fetch task */
+        if (0 != (ret = tse_task_register_cbs(task, H5_daos_map_rec_fetch_prep_cb, NULL, 0,
+                                              H5_daos_map_rec_fetch_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't register callbacks for task to read map records: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Register dependency on this task for the next task */
+        if (0 != (ret = tse_task_register_deps(udata->next_task, 1, &task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret,
+                         "can't create dependencies for task after map record read: %s",
+                         H5_daos_err_to_string(ret));
+
+        if (0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't re-initialize task to read map records: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+
+done:
+    if (udata) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map record read completion callback";
+        } /* end if */
+    }     /* end if */
+
+    /* Return task to task list if it is not being repeated */
+    if ((!reinit || ret_value < 0) && H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_rec_fetch_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_count_task
+ *
+ * Purpose:     Asynchronous task to count the entries in a legacy map,
+ *              which has no entry count, by iterating over the map's
+ *              keys.  Completes once the iteration is done.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_get_count_task(tse_task_t *task)
+{
+    H5_daos_map_get_count_ud_t *udata;
+    H5_daos_iter_data_t         iter_data;
+    tse_task_t                 *metatask   = NULL;
+    tse_task_t                 *first_task = NULL;
+    tse_task_t                 *dep_task   = NULL;
+    hid_t                       map_id     = H5I_INVALID_HID;
+    int                         ret;
+    int                         ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map entry count task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->map);
+
+    /* Check for previous errors */
+    H5_DAOS_PREP_REQ_PROG(udata->md_rw_cb_ud.req);
+
+    if (udata->map->shared->legacy) {
+        /* Register ID for map for key iteration */
+        if ((map_id = H5VLwrap_register(udata->map, H5I_MAP)) < 0)
+            D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, -H5_DAOS_SETUP_ERROR, "unable to atomize object handle");
+        udata->map->obj.item.rc++;
+
+        /* Initialize iteration data */
+        H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC, FALSE, NULL,
+                               map_id, udata->count, NULL, udata->md_rw_cb_ud.req);
+        iter_data.u.map_iter_data.key_mem_type_id = udata->map->key_type_id;
+        iter_data.u.map_iter_data.u.map_iter_op   = H5_daos_map_get_count_cb;
+
+        /* Iterate over the keys, counting them */
+        if (H5_daos_map_iterate(udata->map, &iter_data, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADITER, -H5_DAOS_SETUP_ERROR, "can't iterate over map keys");
+    } /* end if */
+
+done:
+    /* Close map ID since iteration task will now own it.  No need to mark
+     * as nonblocking close since the ID rc shouldn't drop to 0. */
+    if ((map_id >= 0) && (H5Idec_ref(map_id) < 0))
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map ID");
+
+    if (udata) {
+        /* Create metatask to complete this task after dep_task if necessary */
+        if (dep_task) {
+            /* Create metatask */
+            if (H5_daos_create_task(H5_daos_metatask_autocomp_other, 1, &dep_task, NULL, NULL, task,
+                                    &metatask) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create metatask for map entry count task");
+            else {
+                /* Schedule metatask */
+                assert(first_task);
+                if (0 != (ret = tse_task_schedule(metatask, false)))
+                    D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret,
+                                 "can't schedule metatask for map entry count task: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end else */
+        }     /* end if */
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule initial task for map entry count: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map entry count task";
+        } /* end if */
+    }     /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Complete task if necessary */
+    if (!metatask) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get_count_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_count_end_task
+ *
+ * Purpose:     Finalizes retrieving the number of entries in a map by
+ *              freeing private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_get_count_end_task(tse_task_t *task)
+{
+    H5_daos_map_get_count_ud_t *udata     = NULL;
+    int                         ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map entry count end task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_DONE(udata->md_rw_cb_ud.req);
+
+    /* Close map */
+    if (H5_daos_map_close_real(udata->map) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = ret_value;
+        udata->md_rw_cb_ud.req->failed_task = "map entry count end task";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free udata */
+    DV_free(udata->buf);
+    udata = DV_free(udata);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get_count_end_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_count_sync
+ *
+ * Purpose:     Creates tasks to write the changes to a map's entry count
+ *              made in this process to this rank's slot, so other
+ *              processes see them.  If the value of the slot is not known
+ *              yet, for example because the map was opened after this
+ *              rank last changed it, the slot is read first.  The changes
+ *              are taken when the write runs, so they include all
+ *              operations on the map that complete before it.  Syncs of
+ *              the same map are run in the order they are created.  Does
+ *              nothing for legacy maps.
+ *
+ *              Each rank writes only its own slot, so ranks never
+ *              overwrite each other's changes.  DAOS has no atomic add,
+ *              so a single shared count would need a read-modify-write
+ *              that loses updates when two ranks sync at once.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_count_sync(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                       tse_task_t **dep_task)
+{
+    H5_daos_map_count_sync_ud_t *sync_udata = NULL;
+    H5_daos_map_shared_t        *shared;
+    tse_task_t                  *read_task  = NULL;
+    tse_task_t                  *write_task = NULL;
+    tse_task_t                  *deps[2];
+    int                          ndeps = 0;
+    int                          ret;
+    herr_t                       ret_value = SUCCEED;
+
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Nothing to do if the map was never opened or has no entry count */
+    shared = map->shared;
+    if (!shared || shared->legacy)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Allocate argument struct */
+    if (NULL == (sync_udata = (H5_daos_map_count_sync_ud_t *)DV_calloc(sizeof(H5_daos_map_count_sync_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for map entry count sync task arguments");
+    sync_udata->md_rw_cb_ud.req = req;
+    sync_udata->md_rw_cb_ud.obj = &map->obj;
+    sync_udata->shared          = shared;
+
+    /* Set up dkey and iod.  Point to global name buffers, do not free.  The
+     * recxs and record size are set by the task using them. */
+    daos_const_iov_set((d_const_iov_t *)&sync_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
+                       H5_daos_int_md_key_size_g);
+    daos_const_iov_set((d_const_iov_t *)&sync_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_map_count_key_g,
+                       H5_daos_map_count_key_size_g);
+    sync_udata->md_rw_cb_ud.iod[0].iod_recxs = sync_udata->recxs;
+    sync_udata->md_rw_cb_ud.iod[0].iod_type  = DAOS_IOD_ARRAY;
+    sync_udata->md_rw_cb_ud.nr               = 1u;
+    sync_udata->md_rw_cb_ud.free_dkey        = FALSE;
+    sync_udata->md_rw_cb_ud.free_akeys       = FALSE;
+
+    /* Set up sgl */
+    daos_iov_set(&sync_udata->md_rw_cb_ud.sg_iov[0], sync_udata->buf, (daos_size_t)sizeof(sync_udata->buf));
+    sync_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
+    sync_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+    sync_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &sync_udata->md_rw_cb_ud.sg_iov[0];
+
+    /* Set task name */
+    sync_udata->md_rw_cb_ud.task_name = "map entry count sync";
+
+    /* Wait for the caller's tasks and for the last sync of the map */
+    if (*dep_task)
+        deps[ndeps++] = *dep_task;
+    if (shared->sync_tail && shared->sync_tail != *dep_task)
+        deps[ndeps++] = shared->sync_tail;
+
+    /* Read the header and this rank's slot first if the slot's value is not
+     * known.  The record size is left to DAOS so a map with no entry count
+     * reads nothing. */
+    if (!shared->count_known) {
+        sync_udata->recxs[0].rx_idx             = 0;
+        sync_udata->recxs[0].rx_nr              = 1;
+        sync_udata->recxs[1].rx_idx             = 1 + (uint64_t)shared->rank;
+        sync_udata->recxs[1].rx_nr              = 1;
+        sync_udata->md_rw_cb_ud.iod[0].iod_nr   = 2u;
+        sync_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
+
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, ndeps, ndeps ? deps : NULL, H5_daos_md_rw_prep_cb,
+                                     H5_daos_map_count_read_comp_cb, sync_udata, &read_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map entry count");
+        deps[0] = read_task;
+        ndeps   = 1;
+    } /* end if */
+
+    /* Create task to write the slot */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, ndeps, ndeps ? deps : NULL,
+                                 H5_daos_map_count_write_prep_cb, H5_daos_map_count_write_comp_cb, sync_udata,
+                                 &write_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write map entry count");
+
+    /* Schedule the first task (or save it to be scheduled later) and give the
+     * write task a reference to req and the map */
+    if (*first_task) {
+        if (read_task && 0 != (ret = tse_task_schedule(read_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to read map entry count: %s",
+                         H5_daos_err_to_string(ret));
+        if (0 != (ret = tse_task_schedule(write_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to write map entry count: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else {
+        *first_task = read_task ? read_task : write_task;
+        if (read_task && 0 != (ret = tse_task_schedule(write_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to write map entry count: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end else */
+    shared->sync_tail = write_task;
+    *dep_task         = write_task;
+    req->rc++;
+    map->obj.item.rc++;
+    sync_udata = NULL;
+
+done:
+    /* Cleanup on failure, unless a task was created with the user data */
+    if (ret_value < 0 && !read_task && !write_task)
+        sync_udata = DV_free(sync_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_count_sync() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_count_read_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
+ *              the header and this rank's slot of a map's entry count
+ *              before writing the slot.  Saves the slot's value, unless a
+ *              count read it in the meantime.  If the map has no entry
+ *              count it is a legacy map and the write is skipped.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_count_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_count_sync_ud_t *udata;
+    H5_daos_map_shared_t        *shared;
+    uint8_t                     *p;
+    uint64_t                     nslots;
+    uint64_t                     cell;
+    int                          ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map entry count read task");
+
+    shared = udata->shared;
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "map entry count read";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        if (udata->md_rw_cb_ud.iod[0].iod_size == 0)
+            /* No entry count means the map was written by a version that did
+             * not maintain one */
+            shared->legacy = TRUE;
+        else {
+            p = udata->buf;
+            UINT64DECODE(p, nslots);
+            UINT64DECODE(p, cell);
+            if (!shared->count_known) {
+                shared->count_base  = (int64_t)cell;
+                shared->count_known = TRUE;
+            } /* end if */
+            if (nslots > shared->nslots)
+                shared->nslots = nslots;
+        } /* end else */
+    }     /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_count_read_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_count_write_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update to write
+ *              this rank's slot of a map's entry count.  Takes the
+ *              changes made in this process since the last sync.  Also
+ *              raises the count's header if this job has more ranks than
+ *              it names.  Skips the write if there is nothing to write or
+ *              the slot's value could not be read.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_count_write_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_count_sync_ud_t *udata;
+    H5_daos_map_shared_t        *shared;
+    H5_daos_map_t               *map;
+    daos_obj_rw_t               *update_args;
+    uint64_t                     num_procs;
+    uint8_t                     *p;
+    unsigned                     nr        = 0;
+    int                          ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map entry count write task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.obj);
+    assert(udata->shared);
+
+    map       = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+    shared    = udata->shared;
+    num_procs = (uint64_t)map->obj.item.file->num_procs;
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_MAP);
+
+    /* Check if there is anything to write */
+    if (shared->legacy || !shared->count_known || (shared->count_delta == 0 && shared->nslots >= num_procs))
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+
+    /* Take the changes */
+    shared->count_pending = shared->count_delta;
+    shared->count_delta   = 0;
+
+    /* Set up the recxs and encode the cells.  The header is only written to
+     * raise it. */
+    p = udata->buf;
+    if (shared->nslots < num_procs) {
+        udata->header           = num_procs;
+        udata->recxs[nr].rx_idx = 0;
+        udata->recxs[nr].rx_nr  = 1;
+        UINT64ENCODE(p, num_procs);
+        nr++;
+    } /* end if */
+    udata->recxs[nr].rx_idx = 1 + (uint64_t)shared->rank;
+    udata->recxs[nr].rx_nr  = 1;
+    UINT64ENCODE(p, (uint64_t)(shared->count_base + shared->count_pending));
+    nr++;
+    udata->md_rw_cb_ud.iod[0].iod_nr   = nr;
+    udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+    daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->buf, (daos_size_t)nr * H5_DAOS_ENCODED_UINT64_T_SIZE);
+
+    /* Set update task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for map entry count write task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = map->obj.obj_oh;
+    update_args->th   = udata->md_rw_cb_ud.req->th;
+    update_args->dkey = &udata->md_rw_cb_ud.dkey;
+    update_args->nr   = udata->md_rw_cb_ud.nr;
+    update_args->iods = udata->md_rw_cb_ud.iod;
+    update_args->sgls = udata->md_rw_cb_ud.sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_count_write_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_count_write_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update to write
+ *              this rank's slot of a map's entry count.  Updates the
+ *              slot's known value, or returns the changes to be synced
+ *              again if they were not written, then frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_count_write_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_count_sync_ud_t *udata;
+    H5_daos_map_shared_t        *shared;
+    int                          ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map entry count write task");
+
+    shared = udata->shared;
+
+    /* Update the slot's known value */
+    if (task->dt_result == 0) {
+        shared->count_base += shared->count_pending;
+        if (udata->header > shared->nslots)
+            shared->nslots = udata->header;
+    } /* end if */
+    else
+        shared->count_delta += shared->count_pending;
+    shared->count_pending = 0;
+
+    /* Later syncs no longer need to wait for this one */
+    if (shared->sync_tail == task)
+        shared->sync_tail = NULL;
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+    } /* end if */
+
+    /* Close map */
+    if (H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = ret_value;
+        udata->md_rw_cb_ud.req->failed_task = "map entry count write completion callback";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    udata = DV_free(udata);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_count_write_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_hash
+ *
+ * Purpose:     Computes the two hashes of a converted map key used to
+ *              derive its bit positions in a map's Bloom filter.  The
+ *              first is the 64 bit FNV-1a hash of the key and the second
+ *              is derived from it by a further mixing step, and is always
+ *              odd.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_map_bloom_hash(const void *key, size_t key_size, uint64_t *h1, uint64_t *h2)
+{
+    const uint8_t *key_p = (const uint8_t *)key;
+    /* Initialize hash value in accordance with the FNV algorithm */
+    uint64_t hash = 0xcbf29ce484222325;
+    /* Initialize FNV prime number in accordance with the FNV algorithm */
+    const uint64_t fnv_prime = 0x100000001b3;
+    size_t         i;
+
+    assert(key || key_size == 0);
+    assert(h1);
+    assert(h2);
+
+    for (i = 0; i < key_size; i++) {
+        hash ^= (uint64_t)key_p[i];
+        hash *= fnv_prime;
+    } /* end for */
+    *h1 = hash;
+
+    /* Mix the bits further so the second hash is not correlated with the
+     * first */
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccd;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53;
+    hash ^= hash >> 33;
+    *h2 = hash | 1;
+} /* end H5_daos_map_bloom_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_alloc
+ *
+ * Purpose:     Allocates an empty Bloom filter of bloom_size bytes in the
+ *              state shared by a map's handles, and names this rank's
+ *              record of it.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_bloom_alloc(H5_daos_map_shared_t *shared, uint64_t bloom_size)
+{
+    uint8_t *p;
+    herr_t   ret_value = SUCCEED;
+
+    assert(shared);
+    assert(!shared->bloom);
+    assert(bloom_size > 0);
+
+    if (NULL == (shared->bloom = (uint8_t *)DV_calloc(bloom_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate map Bloom filter");
+    if (NULL == (shared->bloom_rec_key = (uint8_t *)DV_malloc(H5_DAOS_MAP_BLOOM_REC_KEY_SIZE)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for map Bloom filter record akey");
+    shared->bloom_size = bloom_size;
+
+    /* Name this rank's record */
+    (void)memcpy(shared->bloom_rec_key, H5_daos_map_bloom_key_g, H5_daos_map_bloom_key_size_g);
+    p = shared->bloom_rec_key + H5_daos_map_bloom_key_size_g;
+    UINT64ENCODE(p, (uint64_t)shared->rank)
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0)
+        shared->bloom = DV_free(shared->bloom);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_add
+ *
+ * Purpose:     Adds a converted key to a map's Bloom filter, so later
+ *              checks for it do not skip the map.  The filter is marked
+ *              dirty so it is written out at the next flush or close.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_map_bloom_add(H5_daos_map_t *map, const void *key, size_t key_size)
+{
+    H5_daos_map_shared_t *shared;
+    uint64_t              nbits;
+    uint64_t              h1;
+    uint64_t              h2;
+    uint64_t              bit;
+    unsigned              i;
+
+    assert(map);
+
+    shared = map->shared;
+    if (!shared || !shared->bloom)
+        return;
+
+    nbits = shared->bloom_size * 8;
+    H5_daos_map_bloom_hash(key, key_size, &h1, &h2);
+    for (i = 0; i < H5_DAOS_MAP_BLOOM_NHASH; i++) {
+        bit = (h1 + (uint64_t)i * h2) % nbits;
+        shared->bloom[bit / 8] |= (uint8_t)(1 << (bit % 8));
+    } /* end for */
+
+    shared->bloom_dirty = TRUE;
+} /* end H5_daos_map_bloom_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_test
+ *
+ * Purpose:     Checks a converted key against a map's Bloom filter.  The
+ *              filter holds the keys put through any handle on the map in
+ *              this process, and those put by other processes as of the
+ *              last time their records were read: when the map was first
+ *              opened in this process, and at each collective flush of a
+ *              file opened read-write (see H5_daos_map_file_sync()).  As
+ *              with other data in a parallel HDF5 file, a key put by
+ *              another process is only guaranteed to be seen once both
+ *              processes have flushed the file, or the other process has
+ *              closed the map and this process opened it afterwards.
+ *
+ * Return:      FALSE if the key is definitely not in the map, TRUE if it
+ *              may be or if the filter cannot tell
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_map_bloom_test(H5_daos_map_t *map, const void *key, size_t key_size)
+{
+    H5_daos_map_shared_t *shared;
+    uint64_t              nbits;
+    uint64_t              h1;
+    uint64_t              h2;
+    uint64_t              bit;
+    unsigned              i;
+
+    assert(map);
+
+    shared = map->shared;
+    if (!shared || !shared->bloom || !shared->bloom_loaded)
+        return TRUE;
+
+    nbits = shared->bloom_size * 8;
+    H5_daos_map_bloom_hash(key, key_size, &h1, &h2);
+    for (i = 0; i < H5_DAOS_MAP_BLOOM_NHASH; i++) {
+        bit = (h1 + (uint64_t)i * h2) % nbits;
+        if (!(shared->bloom[bit / 8] & (uint8_t)(1 << (bit % 8))))
+            return FALSE;
+    } /* end for */
+
+    return TRUE;
+} /* end H5_daos_map_bloom_test() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_load
+ *
+ * Purpose:     Creates asynchronous tasks to load an opened map's Bloom
+ *              filter, if it has one.  Reads the size of the filter, then
+ *              combines the Bloom filter records of all ranks that added
+ *              keys to the map into the filter shared by the map's
+ *              handles in this process.  Nothing is read if another
+ *              handle on the map in this process already loaded it.  If
+ *              reload is TRUE the filter is known to exist and only the
+ *              records are read again.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_bloom_load(H5_daos_map_t *map, hbool_t reload, H5_daos_req_t *req, tse_task_t **first_task,
+                       tse_task_t **dep_task)
+{
+    H5_daos_map_bloom_load_ud_t *load_udata = NULL;
+    tse_task_t                  *size_task  = NULL;
+    tse_task_t                  *end_task   = NULL;
+    tse_task_t                  *read_dep   = NULL;
+    int                          ret;
+    herr_t                       ret_value = SUCCEED;
+
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct */
+    if (NULL == (load_udata = (H5_daos_map_bloom_load_ud_t *)DV_calloc(sizeof(H5_daos_map_bloom_load_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for map Bloom filter load task arguments");
+    if (H5_daos_map_rec_read_init(&load_udata->rec_read, map, req) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't set up reading map records");
+    load_udata->reload = reload;
+    read_dep           = *dep_task;
+
+    if (!reload) {
+        /* Set up iod to read the filter size.  Point to global name buffer,
+         * do not free. */
+        daos_const_iov_set((d_const_iov_t *)&load_udata->rec_read.md_rw_cb_ud.iod[0].iod_name,
+                           H5_daos_map_bloom_size_key_g, H5_daos_map_bloom_size_key_size_g);
+        load_udata->rec_read.md_rw_cb_ud.iod[0].iod_nr   = 1u;
+        load_udata->rec_read.md_rw_cb_ud.iod[0].iod_size = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+        load_udata->rec_read.md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+        load_udata->rec_read.md_rw_cb_ud.nr              = 1u;
+
+        /* Set up sgl */
+        daos_iov_set(&load_udata->rec_read.md_rw_cb_ud.sg_iov[0], load_udata->size_buf,
+                     (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+        load_udata->rec_read.md_rw_cb_ud.sgl[0].sg_nr     = 1;
+        load_udata->rec_read.md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+        load_udata->rec_read.md_rw_cb_ud.sgl[0].sg_iovs   = &load_udata->rec_read.md_rw_cb_ud.sg_iov[0];
+
+        /* Set task name */
+        load_udata->rec_read.md_rw_cb_ud.task_name = "map Bloom filter size read";
+
+        /* Create task to read the filter size */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                     H5_daos_map_bloom_size_prep_cb, H5_daos_map_bloom_size_comp_cb,
+                                     load_udata, &size_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map Bloom filter size");
+        read_dep = size_task;
+    } /* end if */
+
+    /* Create tasks to list and read the records */
+    if (H5_daos_map_rec_read(&load_udata->rec_read, &read_dep) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't read map Bloom filter records");
+
+    /* Create task to finish loading the filter and free load_udata */
+    if (H5_daos_create_task(H5_daos_map_bloom_load_end_task, 1, &read_dep, NULL, NULL, load_udata,
+                            &end_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finish loading map Bloom filter");
+    load_udata->rec_read.next_task = end_task;
+
+    /* Schedule end task and give it a reference to req and the map.  The
+     * earlier tasks do not need their own references since the end task
+     * depends on them. */
+    if (0 != (ret = tse_task_schedule(end_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
+                     "can't schedule task to finish loading map Bloom filter: %s",
+                     H5_daos_err_to_string(ret));
+    *dep_task = end_task;
+    req->rc++;
+    map->obj.item.rc++;
+    load_udata = NULL;
+
+done:
+    /* Schedule size read task (or save it to be scheduled later).  On
+     * failure the tasks that depend on it see the error set in req by the
+     * caller. */
+    if (size_task) {
+        if (*first_task) {
+            if (0 != (ret = tse_task_schedule(size_task, false)))
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
+                             "can't schedule task to read map Bloom filter size: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            *first_task = size_task;
+    } /* end if */
+
+    /* Cleanup on failure, if no task was created that uses load_udata */
+    if (load_udata && !size_task && read_dep == *dep_task) {
+        assert(ret_value < 0);
+        H5_daos_map_rec_read_free(&load_udata->rec_read);
+        load_udata = DV_free(load_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_load() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_size_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to read
+ *              the size of a map's Bloom filter.  Skips the read, and the
+ *              records, if another handle on the map in this process
+ *              already loaded the filter.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_bloom_size_prep_cb(tse_task_t *task, void *args)
+{
+    H5_daos_map_bloom_load_ud_t *udata;
+    H5_daos_map_t               *map = NULL;
+    int                          ret_value;
+
+    if (NULL != (udata = tse_task_get_priv(task)))
+        map = udata->rec_read.map;
+
+    if (map && map->shared && map->shared->bloom_loaded) {
+        /* Use the filter already loaded */
+        map->bloom_size      = map->shared->bloom_size;
+        udata->rec_read.skip = TRUE;
+        ret_value            = -H5_DAOS_SHORT_CIRCUIT;
+        tse_task_complete(task, ret_value);
+    } /* end if */
+    else
+        /* Set up the fetch.  This handles errors, including a missing udata. */
+        ret_value = H5_daos_md_rw_prep_cb(task, args);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_size_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_size_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
+ *              the size of a map's Bloom filter.  Allocates the filter if
+ *              the map has one and no other handle in this process did,
+ *              otherwise skips reading the map's records.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_bloom_size_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_bloom_load_ud_t *udata;
+    H5_daos_map_t               *map;
+    uint8_t                     *p;
+    uint64_t                     bloom_size = 0;
+    int                          ret_value  = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map Bloom filter size read task");
+
+    map = udata->rec_read.map;
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR &&
+        udata->rec_read.md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->rec_read.md_rw_cb_ud.req->status      = task->dt_result;
+        udata->rec_read.md_rw_cb_ud.req->failed_task = udata->rec_read.md_rw_cb_ud.task_name;
+    } /* end if */
+    else if (task->dt_result == 0) {
+        assert(map->shared);
+
+        /* Decode filter size.  Maps created without a filter have no size
+         * record. */
+        if (udata->rec_read.md_rw_cb_ud.iod[0].iod_size != 0) {
+            p = udata->size_buf;
+            UINT64DECODE(p, bloom_size)
+        } /* end if */
+
+        if (bloom_size > 0) {
+            /* Another handle in this process may be loading the filter too.
+             * The records are combined into it either way. */
+            if (!map->shared->bloom && H5_daos_map_bloom_alloc(map->shared, bloom_size) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate map Bloom filter");
+            map->bloom_size = bloom_size;
+        } /* end if */
+        else
+            udata->rec_read.skip = TRUE;
+    } /* end if */
+
+done:
+    /* Handle errors in this function */
+    if (udata && ret_value < -H5_DAOS_SHORT_CIRCUIT &&
+        udata->rec_read.md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->rec_read.md_rw_cb_ud.req->status      = ret_value;
+        udata->rec_read.md_rw_cb_ud.req->failed_task = "map Bloom filter size read completion callback";
+    } /* end if */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_size_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_load_end_task
+ *
+ * Purpose:     Finalizes loading a map's Bloom filter.  Marks the filter
+ *              usable once all records were read, then frees private
+ *              data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_bloom_load_end_task(tse_task_t *task)
+{
+    H5_daos_map_bloom_load_ud_t *udata     = NULL;
+    H5_daos_map_shared_t        *shared;
+    int                          ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map Bloom filter load end task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_DONE(udata->rec_read.md_rw_cb_ud.req);
+
+    /* The filter can rule out keys once a load has read all records */
+    shared = udata->rec_read.map->shared;
+    if (ret_value == 0 && shared && shared->bloom)
+        shared->bloom_loaded = TRUE;
+
+    /* Close map */
+    if (H5_daos_map_close_real(udata->rec_read.map) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT &&
+        udata->rec_read.md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->rec_read.md_rw_cb_ud.req->status      = ret_value;
+        udata->rec_read.md_rw_cb_ud.req->failed_task = "map Bloom filter load end task";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->rec_read.md_rw_cb_ud.req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free udata */
+    H5_daos_map_rec_read_free(&udata->rec_read);
+    udata = DV_free(udata);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_load_end_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_sync
+ *
+ * Purpose:     Creates an asynchronous task to write a map's Bloom filter
+ *              to this rank's Bloom filter record, so processes that read
+ *              the records afterwards see the keys put in this process.
+ *              Each rank writes only its own record, so ranks never
+ *              overwrite each other's keys and the number of records is
+ *              bounded by the number of ranks.  The filter written holds
+ *              every record read at open, including this rank's previous
+ *              one, so no key is lost when the record is replaced.  Syncs
+ *              of the same map are run in the order they are created.
+ *              Does nothing when the task runs if no keys were added
+ *              since the last write.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_bloom_sync(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
+                       tse_task_t **dep_task)
+{
+    H5_daos_md_rw_cb_ud_t *sync_udata  = NULL;
+    H5_daos_map_shared_t  *shared;
+    tse_task_t            *update_task = NULL;
+    tse_task_t            *deps[2];
+    int                    ndeps = 0;
+    int                    ret;
+    herr_t                 ret_value = SUCCEED;
+
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Nothing to do if the map was never opened or has no filter */
+    shared = map->shared;
+    if (!shared || !shared->bloom)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Allocate argument struct */
+    if (NULL == (sync_udata = (H5_daos_md_rw_cb_ud_t *)DV_calloc(sizeof(H5_daos_md_rw_cb_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for map Bloom filter write task arguments");
+    sync_udata->req = req;
+    sync_udata->obj = &map->obj;
+
+    /* Set up dkey.  Point to global name buffer, do not free.  The iod and
+     * sgl are set up by the prepare callback. */
+    daos_const_iov_set((d_const_iov_t *)&sync_udata->dkey, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g);
+    sync_udata->nr         = 1u;
+    sync_udata->free_dkey  = FALSE;
+    sync_udata->free_akeys = FALSE;
+
+    /* Set task name */
+    sync_udata->task_name = "map Bloom filter write";
+
+    /* Wait for the caller's tasks and for the last sync of the map */
+    if (*dep_task)
+        deps[ndeps++] = *dep_task;
+    if (shared->sync_tail && shared->sync_tail != *dep_task)
+        deps[ndeps++] = shared->sync_tail;
+
+    /* Create task to write this rank's record */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, ndeps, ndeps ? deps : NULL,
+                                 H5_daos_map_bloom_sync_prep_cb, H5_daos_map_bloom_sync_comp_cb, sync_udata,
+                                 &update_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write map Bloom filter");
+
+    /* Schedule write task (or save it to be scheduled later) and give it a
+     * reference to req and the map */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(update_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to write map Bloom filter: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = update_task;
+    shared->sync_tail = update_task;
+    *dep_task         = update_task;
+    req->rc++;
+    map->obj.item.rc++;
+    sync_udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0 && !update_task)
+        sync_udata = DV_free(sync_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_sync() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_sync_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update to write
+ *              this rank's Bloom filter record of a map.  Skips the write
+ *              if the filter has not changed, or if it was never fully
+ *              loaded and would replace the record with less than it
+ *              holds.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_bloom_sync_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_md_rw_cb_ud_t *udata;
+    H5_daos_map_shared_t  *shared;
+    daos_obj_rw_t         *update_args;
+    int                    ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map Bloom filter write task");
+
+    assert(udata->req);
+    assert(udata->obj);
+
+    shared = ((H5_daos_map_t *)udata->obj)->shared;
+    assert(shared);
+    assert(shared->bloom);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_MAP);
+
+    /* Nothing to do if the filter has not changed */
+    if (!shared->bloom_loaded || !shared->bloom_dirty)
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+
+    /* Keys added after this point will be written by the next sync */
+    shared->bloom_dirty = FALSE;
+
+    /* Set up iod */
+    daos_iov_set(&udata->iod[0].iod_name, shared->bloom_rec_key, (daos_size_t)H5_DAOS_MAP_BLOOM_REC_KEY_SIZE);
+    udata->iod[0].iod_nr   = 1u;
+    udata->iod[0].iod_size = (daos_size_t)shared->bloom_size;
+    udata->iod[0].iod_type = DAOS_IOD_SINGLE;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->sg_iov[0], shared->bloom, (daos_size_t)shared->bloom_size);
+    udata->sgl[0].sg_nr     = 1;
+    udata->sgl[0].sg_nr_out = 0;
+    udata->sgl[0].sg_iovs   = &udata->sg_iov[0];
+
+    /* Set update task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for map Bloom filter write task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = udata->obj->obj_oh;
+    update_args->th   = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr   = udata->nr;
+    update_args->iods = udata->iod;
+    update_args->sgls = udata->sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_sync_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_sync_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update to write
+ *              this rank's Bloom filter record of a map.  Marks the
+ *              filter dirty again if the write failed, then frees private
+ *              data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_bloom_sync_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_md_rw_cb_ud_t *udata;
+    H5_daos_map_shared_t  *shared;
+    int                    ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map Bloom filter write task");
+
+    shared = ((H5_daos_map_t *)udata->obj)->shared;
+
+    /* Later syncs no longer need to wait for this one */
+    if (shared->sync_tail == task)
+        shared->sync_tail = NULL;
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR) {
+        /* Keep the filter dirty so a later sync writes it */
+        shared->bloom_dirty = TRUE;
+
+        if (udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = task->dt_result;
+            udata->req->failed_task = udata->task_name;
+        } /* end if */
+    }     /* end if */
+
+    /* Close map */
+    if (H5_daos_map_close_real((H5_daos_map_t *)udata->obj) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "map Bloom filter write completion callback";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    udata = DV_free(udata);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_sync_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_sync
+ *
+ * Purpose:     Creates tasks to sync the changes to a map's Bloom filter
+ *              and entry count made in this process, if the map's file
+ *              is open read-write.  Waits for the map to be opened or
+ *              created first if necessary, since the changes are kept in
+ *              the map's shared state, which is only attached then.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_sync(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+
+    /* Nothing to sync if the file is open read-only */
+    if (!(map->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_DONE(SUCCEED);
+
+    /* Wait for the map to open if necessary.  If the open failed there is
+     * nothing to sync. */
+    if (!map->shared && map->obj.item.open_req->status != 0)
+        if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+    if (H5_daos_map_bloom_sync(map, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't sync map Bloom filter");
+    if (H5_daos_map_count_sync(map, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't sync map entry count");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_sync() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_file_sync
+ *
+ * Purpose:     Creates asynchronous tasks to merge the changes to all
+ *              maps open in this process on a file opened read-write with
+ *              those made by the other processes.  Every map's Bloom
+ *              filter and entry count are synced as in
+ *              H5_daos_map_flush(), then, if the file is open in more than
+ *              one process, all processes wait in a barrier and read
+ *              every rank's Bloom filter records again, combining them
+ *              into their filters.  Afterwards the filters in all
+ *              processes hold every key put before the flush.  Must be
+ *              called collectively, as part of H5Fflush.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_map_file_sync(H5_daos_file_t *file, H5_daos_req_t *req, tse_task_t **first_task,
+                      tse_task_t **dep_task)
+{
+    H5_daos_map_file_sync_ud_t *sync_udata = NULL;
+    tse_task_t                 *sync_task;
+    tse_task_t                 *barrier_task;
+    int                         nphases;
+    int                         i;
+    int                         ret;
+    herr_t                      ret_value = SUCCEED;
+
+    assert(file);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    if (!(file->flags & H5F_ACC_RDWR))
+        D_GOTO_DONE(SUCCEED);
+
+    /* Sync the maps, then reload their filters once all processes did */
+    nphases = file->num_procs > 1 ? 2 : 1;
+    for (i = 0; i < nphases; i++) {
+        if (i > 0) {
+            /* Create task for barrier, and give it a reference to req */
+            if (H5_daos_create_task(H5_daos_mpi_ibarrier_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                    NULL, H5_daos_map_file_barrier_comp_cb, req, &barrier_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create MPI barrier task");
+            req->rc++;
+            if (*first_task) {
+                if (0 != (ret = tse_task_schedule(barrier_task, false)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule MPI barrier task: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end if */
+            else
+                *first_task = barrier_task;
+            *dep_task = barrier_task;
+        } /* end if */
+
+        /* Allocate argument struct */
+        if (NULL ==
+            (sync_udata = (H5_daos_map_file_sync_ud_t *)DV_calloc(sizeof(H5_daos_map_file_sync_ud_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                         "can't allocate buffer for map file sync task arguments");
+        sync_udata->req    = req;
+        sync_udata->file   = file;
+        sync_udata->reload = i > 0;
+
+        /* Create task to find the maps once the operations before the flush
+         * completed, and give it a reference to req */
+        if (H5_daos_create_task(H5_daos_map_file_sync_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                NULL, NULL, sync_udata, &sync_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to sync maps");
+        req->rc++;
+        sync_udata = NULL;
+
+        /* Schedule task (or save it to be scheduled later) */
+        if (*first_task) {
+            if (0 != (ret = tse_task_schedule(sync_task, false)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to sync maps: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            *first_task = sync_task;
+        *dep_task = sync_task;
+    } /* end for */
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0)
+        sync_udata = DV_free(sync_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_file_sync() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_file_sync_task
+ *
+ * Purpose:     Asynchronous task to sync, or reload the Bloom filters of,
+ *              all maps open on a file in this process.  Uses one open
+ *              handle on each map.  Completes once all maps are done.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_file_sync_task(tse_task_t *task)
+{
+    H5_daos_map_file_sync_ud_t *udata;
+    H5_daos_map_shared_t       *shared;
+    H5_daos_file_t             *file;
+    tse_task_t                **deps     = NULL;
+    tse_task_t                 *metatask = NULL;
+    size_t                      nmaps    = 0;
+    size_t                      ndeps    = 0;
+    int                         ret;
+    int                         ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map file sync task");
+
+    assert(udata->req);
+    assert(udata->file);
+
+    file = udata->file;
+
+    /* Check for previous errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    /* Count the maps */
+    for (shared = H5_daos_map_shared_g; shared; shared = shared->next)
+        if (shared->maps && H5_DAOS_MAP_SHARED_IN_FILE(shared, file))
+            nmaps++;
+    if (nmaps == 0)
+        D_GOTO_DONE(0);
+
+    if (NULL == (deps = (tse_task_t **)DV_malloc(nmaps * sizeof(tse_task_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate array of map sync tasks");
+
+    /* Sync or reload each map independently of the others */
+    for (shared = H5_daos_map_shared_g; shared; shared = shared->next) {
+        tse_task_t *first_task = NULL;
+        tse_task_t *dep_task   = NULL;
+
+        if (!shared->maps || !H5_DAOS_MAP_SHARED_IN_FILE(shared, file))
+            continue;
+
+        if (udata->reload) {
+            if (shared->bloom && shared->bloom_loaded &&
+                H5_daos_map_bloom_load(shared->maps, TRUE, udata->req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't reload map Bloom filter");
+        } /* end if */
+        else if (H5_daos_map_sync(shared->maps, udata->req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't sync map");
+
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule initial task for map sync: %s",
+                         H5_daos_err_to_string(ret));
+        if (dep_task)
+            deps[ndeps++] = dep_task;
+    } /* end for */
+
+done:
+    if (udata) {
+        /* Create metatask to complete this task after the maps are done */
+        if (ndeps > 0) {
+            if (H5_daos_create_task(H5_daos_metatask_autocomp_other, (unsigned)ndeps, deps, NULL, NULL, task,
+                                    &metatask) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create metatask for map file sync task");
+            else if (0 != (ret = tse_task_schedule(metatask, false)))
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule metatask for map file sync task: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "map file sync task";
+        } /* end if */
+
+        /* Release our reference to req.  The tasks created hold their own. */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    DV_free(deps);
+
+    /* Complete task if necessary */
+    if (!metatask) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_file_sync_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_file_barrier_comp_cb
+ *
+ * Purpose:     Complete callback for the asynchronous MPI_Ibarrier
+ *              between syncing and reloading the maps on a file.
+ *              Releases the task's reference to req.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_file_barrier_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_req_t *req;
+    int            ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (req = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map file sync barrier task");
+
+    /* Handle errors in barrier task.  Only record error in req->status if it
+     * does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status      = task->dt_result;
+        req->failed_task = "MPI_Ibarrier";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_file_barrier_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_specific
+ *
+ * Purpose:     Performs a map "specific" operation
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_map_specific(void *_item, H5VL_map_args_t *map_args, hid_t dxpl_id, void **req)
+{
+    H5_daos_item_t *item        = (H5_daos_item_t *)_item;
+    H5_daos_map_t  *map         = NULL;
+    H5_daos_req_t  *int_req     = NULL;
+    H5_daos_req_t  *int_int_req = NULL;
+    tse_task_t     *first_task  = NULL;
+    tse_task_t     *dep_task    = NULL;
+    hbool_t         collective_md_read;
+    hbool_t         collective_md_write;
+    herr_t          iter_ret = 0;
+    hid_t           map_id   = H5I_INVALID_HID;
+    hid_t           mapl_id  = H5P_MAP_ACCESS_DEFAULT;
+    int             ret;
+    herr_t          ret_value = SUCCEED;
+
+    assert(map_args);
+
+    if (!_item)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Determine metadata I/O mode setting (collective vs. independent)
+     * for metadata reads and writes according to file-wide setting on FAPL.
+     */
+    H5_DAOS_GET_METADATA_IO_MODES(item->file, mapl_id, H5P_MAP_ACCESS_DEFAULT, collective_md_read,
+                                  collective_md_write, H5E_MAP, FAIL);
+
+    /* Start H5 operation */
+    if (NULL ==
+        (int_req = H5_daos_req_create(item->file, "map specific", item->open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    switch (map_args->specific.specific_type) {
+        /* H5Miterate(_by_name) */
+        case H5VL_MAP_ITER: {
+            H5_daos_iter_data_t iter_data;
+            H5VL_loc_params_t  *loc_params      = &map_args->specific.args.iterate.loc_params;
+            hsize_t            *idx             = &map_args->specific.args.iterate.idx;
+            hid_t               key_mem_type_id = map_args->specific.args.iterate.key_mem_type_id;
+            H5M_iterate_t       op              = map_args->specific.args.iterate.op;
+            void               *op_data         = map_args->specific.args.iterate.op_data;
+
+            int_req->op_name = "map iterate";
+
+            switch (loc_params->type) {
+                /* H5Miterate */
+                case H5VL_OBJECT_BY_SELF: {
+                    /* Use item as the map for iteration */
+                    if (item->type != H5I_MAP)
+                        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "item not a map");
+
+                    map = (H5_daos_map_t *)item;
+                    map->obj.item.rc++;
+                    break;
+                } /* H5VL_OBJECT_BY_SELF */
+
+                /* H5Miterate_by_name */
+                case H5VL_OBJECT_BY_NAME: {
+                    H5VL_loc_params_t sub_loc_params;
+
+                    /* Start internal H5 operation for target map open.  This will
+                     * not be visible to the API, will not be added to an operation
+                     * pool, and will be integrated into this function's task chain. */
+                    if (NULL == (int_int_req = H5_daos_req_create(
+                                     item->file, "target map open within map iterate by name", NULL, NULL,
+                                     int_req, H5I_INVALID_HID)))
+                        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+                    /* Open target_map */
+                    sub_loc_params.obj_type = item->type;
+                    sub_loc_params.type     = H5VL_OBJECT_BY_SELF;
+                    if (NULL == (map = H5_daos_map_open_int(
+                                     item, &sub_loc_params, loc_params->loc_data.loc_by_name.name,
+                                     loc_params->loc_data.loc_by_name.lapl_id, int_int_req,
+                                     collective_md_read, &first_task, &dep_task)))
+                        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map for operation");
+
+                    /* Create task to finalize internal operation */
+                    if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0,
+                                            dep_task ? &dep_task : NULL, NULL, NULL, int_int_req,
+                                            &int_int_req->finalize_task) < 0)
+                        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
+                                     "can't create task to finalize internal operation");
+
+                    /* Schedule finalize task (or save it to be scheduled later),
+                     * give it ownership of int_int_req, and update task pointers */
+                    if (first_task) {
+                        if (0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
+                            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
+                                         "can't schedule task to finalize H5 operation: %s",
+                                         H5_daos_err_to_string(ret));
+                    } /* end if */
+                    else
+                        first_task = int_int_req->finalize_task;
+                    dep_task    = int_int_req->finalize_task;
+                    int_int_req = NULL;
+
+                    break;
+                } /* H5VL_OBJECT_BY_NAME */
+
+                case H5VL_OBJECT_BY_IDX:
+                case H5VL_OBJECT_BY_TOKEN:
+                default:
+                    D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "invalid loc_params type");
+            } /* end switch */
+
+            /* Wait for the map to open if necessary */
+            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (map->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+            } /* end if */
+
+            /* Register ID for map */
+            if ((map_id = H5VLwrap_register(map, H5I_MAP)) < 0)
+                D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
+
+            /* Initialize iteration data */
+            H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC, FALSE, idx,
+                                   map_id, op_data, NULL, int_req);
+            iter_data.u.map_iter_data.key_mem_type_id = key_mem_type_id;
+            iter_data.u.map_iter_data.u.map_iter_op   = op;
+
+            /* Handle iteration return value TODO: how to handle if called async? */
+            if (!req)
+                iter_data.op_ret_p = &iter_ret;
+
+            /* Perform map iteration */
+            if (H5_daos_map_iterate(map, &iter_data, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed");
+
+            break;
+        } /* H5VL_MAP_ITER */
+
+        case H5VL_MAP_DELETE: {
+            H5VL_loc_params_t *loc_params      = &map_args->specific.args.del.loc_params;
+            hid_t              key_mem_type_id = map_args->specific.args.del.key_mem_type_id;
+            const void        *key             = map_args->specific.args.del.key;
+
+            int_req->op_name = "map key delete";
+
+            /* Verify loc_params */
+            if (H5VL_OBJECT_BY_SELF != loc_params->type)
+                D_GOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL,
+                             "unsupported map key delete location parameters type");
+            map = (H5_daos_map_t *)item;
+            map->obj.item.rc++;
+
+            /* Wait for the map to open if necessary */
+            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
+                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (map->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+            } /* end if */
+
+            /* Perform key delete */
+            if ((ret_value = H5_daos_map_delete_key(map, key_mem_type_id, key, collective_md_write, int_req,
+                                                    &first_task, &dep_task)) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTREMOVE, FAIL, "map key delete failed");
+
+            break;
+        } /* H5VL_MAP_DELETE */
+
+        default:
+            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid or unsupported map specific operation");
+    } /* end switch */
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, item, H5_DAOS_OP_TYPE_WRITE, H5_DAOS_OP_SCOPE_OBJ, FALSE,
+                                !req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async.  Disabled for iteration for now. */
+        if (req && map_args->specific.specific_type != H5VL_MAP_ITER) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
+                             "map specific operation failed in task \"%s\": %s", int_req->failed_task,
+                             H5_daos_err_to_string(int_req->status));
+
+            /* Close internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+
+            /* Set return value for map iteration, unless this function failed but
+             * the iteration did not */
+            if (map_args->specific.specific_type == H5VL_MAP_ITER && !(ret_value < 0 && iter_ret >= 0))
+                ret_value = iter_ret;
+        } /* end else */
+    }     /* end if */
+
+    if (map_id >= 0) {
+        map->obj.item.nonblocking_close = TRUE;
+        if ((ret = H5Idec_ref(map_id)) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map ID");
+        if (ret)
+            map->obj.item.nonblocking_close = FALSE;
+        map_id = -1;
+        map    = NULL;
+    } /* end if */
+    else if (map) {
+        if (H5_daos_map_close_real(map) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map");
+        map = NULL;
+    } /* end else */
+
+    /* Close internal request for target object open */
+    if (int_int_req && H5_daos_req_free_int(int_int_req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_specific() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iterate
+ *
+ * Purpose:     Iterates over all key-value pairs stored in the Map
+ *              specified by map_id, making the callback specified by op
+ *              for each. The idx parameter is an in/out parameter that
+ *              may be used to restart a previously interrupted iteration.
+ *              At the start of iteration idx should be set to 0, and to
+ *              restart iteration at the same location on a subsequent
+ *              call to H5Miterate, idx should be the same value as
+ *              returned by the previous call.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_iterate(H5_daos_map_t *map, H5_daos_iter_data_t *iter_data, tse_task_t **first_task,
+                    tse_task_t **dep_task)
+{
+    daos_anchor_t start_anchor;
+    size_t        dkey_prefetch_size = 0;
+    size_t        dkey_alloc_size    = 0;
+    int           ret;
+    herr_t        ret_value = SUCCEED;
+
+    assert(map);
+    assert(iter_data);
+    assert(iter_data->req);
+    assert(first_task);
+    assert(dep_task);
+    assert(H5_DAOS_ITER_TYPE_MAP == iter_data->iter_type);
+    assert(H5_INDEX_NAME == iter_data->index_type);
+    assert(H5_ITER_INC == iter_data->iter_order);
+
+    if (!iter_data->u.map_iter_data.u.map_iter_op)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "operator is NULL");
+
+    /* Restart from *idx_p by passing over that many pairs.  The dkey list
+     * order is stable as long as the map is not modified between calls.  A
+     * partitioned iteration lists its anchors in no fixed order relative to
+     * the whole map so it cannot be restarted. */
+    if (iter_data->idx_p && (*iter_data->idx_p != 0)) {
+        if (iter_data->u.map_iter_data.part_nr > 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL,
+                         "partitioned iteration restart not supported (must start from 0)");
+        iter_data->u.map_iter_data.skip = *iter_data->idx_p;
+    } /* end if */
+
+    /* Get map iterate hints */
+    if (map->mapl_id == H5P_MAP_ACCESS_DEFAULT) {
+        dkey_prefetch_size = H5_daos_plist_cache_g->mapl_cache.dkey_prefetch_size;
+        dkey_alloc_size    = H5_daos_plist_cache_g->mapl_cache.dkey_alloc_size;
+    }
+    else if (H5Pget_map_iterate_hints(map->mapl_id, &dkey_prefetch_size, &dkey_alloc_size) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map iterate hints");
+
+    /* If the iteration is partitioned, start from the first anchor assigned
+     * to this process */
+    if (iter_data->u.map_iter_data.part_nr > 0) {
+        assert(iter_data->u.map_iter_data.part_next < iter_data->u.map_iter_data.part_nr);
+        assert(iter_data->u.map_iter_data.part_stride > 0);
+
+        memset(&start_anchor, 0, sizeof(start_anchor));
+        if (0 != (ret = H5_daos_map_anchor_set(map, iter_data->u.map_iter_data.part_next, &start_anchor)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't set anchor for map iteration: %s",
+                         H5_daos_err_to_string(ret));
+        iter_data->u.map_iter_data.part_next += iter_data->u.map_iter_data.part_stride;
+        iter_data->start_anchor = &start_anchor;
+    } /* end if */
+
+    /* Increment reference count on map ID */
+    if (H5Iinc_ref(iter_data->iter_root_obj) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINC, FAIL, "can't increment reference count on iteration base object");
+
+    /* Start iteration */
+    if (0 != (ret = H5_daos_list_key_init(iter_data, &map->obj, NULL, DAOS_OPC_OBJ_LIST_DKEY,
+                                          H5_daos_map_iterate_list_comp_cb, TRUE, NULL,
+                                          dkey_prefetch_size, dkey_alloc_size, first_task, dep_task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't start map iteration: %s",
+                     H5_daos_err_to_string(ret));
+
+done:
+    iter_data->start_anchor = NULL;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_anchor_split
+ *
+ * Purpose:     Retrieves the number of anchors the dkeys of a map can be
+ *              split into for listing them in parallel.  Returns 1 in
+ *              *nparts if the DAOS library does not support splitting
+ *              enumeration.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_anchor_split(H5_daos_map_t *map, uint32_t *nparts)
+{
+    assert(map);
+    assert(nparts);
+
+#if CHECK_DAOS_API_VERSION(2, 2)
+    *nparts = 0;
+    return daos_obj_anchor_split(H5_DAOS_MAP_DATA_OH(map), nparts, NULL);
+#else
+    *nparts = 1;
+    return 0;
+#endif
+} /* end H5_daos_map_anchor_split() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_anchor_set
+ *
+ * Purpose:     Sets anchor to list only the part of the map's dkeys with
+ *              index idx out of those returned by
+ *              H5_daos_map_anchor_split.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_anchor_set(H5_daos_map_t *map, uint32_t idx, daos_anchor_t *anchor)
+{
+    assert(map);
+    assert(anchor);
+
+#if CHECK_DAOS_API_VERSION(2, 2)
+    return daos_obj_anchor_set(H5_DAOS_MAP_DATA_OH(map), idx, anchor);
+#else
+    (void)idx;
+    return -DER_NOSYS;
+#endif
+} /* end H5_daos_map_anchor_set() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iterate_list_comp_cb
+ *
+ * Purpose:     Completion callback for dkey list for map iteration.
+ *              Initiates operation on each key-value pair and reissues
+ *              list operation if appropriate.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_iter_ud_t        *udata         = NULL;
+    H5_daos_map_iter_op_ud_t *iter_op_udata = NULL;
+    H5_daos_map_iter_batch_t *batch         = NULL;
+    H5_daos_req_t            *req           = NULL;
+    tse_task_t               *query_task    = NULL;
+    tse_task_t               *first_task    = NULL;
+    tse_task_t               *dep_task      = NULL;
+    int                       ret;
+    int                       ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for operation finalize task");
+
+    /* Assign req convenience pointer.  We do this so we can still handle errors
+     * after transfering ownership of udata.  This should be safe since the
+     * iteration metatask holds a reference to req until all iteration is
+     * complete at this level. */
+    req = udata->iter_data->req;
+
+    /* Check for buffer not large enough */
+    if (task->dt_result == -DER_REC2BIG) {
+        char  *tmp_realloc = NULL;
+        size_t key_buf_len = 2 * (udata->sg_iov.iov_buf_len + 1);
+
+        /* Reallocate larger buffer */
+        if (NULL == (tmp_realloc = (char *)DV_realloc(udata->sg_iov.iov_buf, key_buf_len)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't reallocate key buffer");
+
+        /* Update sg_iov */
+        daos_iov_set(&udata->sg_iov, tmp_realloc, (daos_size_t)(key_buf_len - 1));
+
+        /* Reissue list operation */
+        if (0 != (ret = H5_daos_list_key_start(udata, DAOS_OPC_OBJ_LIST_DKEY,
+                                               H5_daos_map_iterate_list_comp_cb, &first_task, &dep_task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't start iteration");
+        udata = NULL;
+    } /* end if */
+    else {
+        /* Handle errors in list task.  Only record error in req->status
+         * if it does not already contain an error (it could contain an error if
+         * another task this task is not dependent on also failed). */
+        if (task->dt_result < -H5_DAOS_PRE_ERROR && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            req->status      = task->dt_result;
+            req->failed_task = "map iterate key list completion callback";
+        } /* end if */
+        else if (task->dt_result == 0) {
+            H5_daos_map_t *map = (H5_daos_map_t *)udata->target_obj;
+            uint32_t       i;
+            char          *p = udata->sg_iov.iov_buf;
+
+            assert(map);
+
+            /* Start fetching the values for this batch of keys if requested */
+            if (udata->iter_data->u.map_iter_data.fetch_vals && udata->nr > 0)
+                if (H5_daos_map_iter_batch_start(udata, map, &batch) < 0)
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                                 "can't start fetching map values for iteration");
+
+            /* Loop over returned dkeys */
+            for (i = 0; i < udata->nr; i++) {
+                /* Allocate iter op udata */
+                if (NULL ==
+                    (iter_op_udata = (H5_daos_map_iter_op_ud_t *)DV_calloc(sizeof(H5_daos_map_iter_op_ud_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                                 "can't allocate iteration op user data");
+                iter_op_udata->generic_ud.req   = req;
+                iter_op_udata->iter_ud          = udata;
+                iter_op_udata->key_dkey_type_id = map->key_dkey_type_id;
+                iter_op_udata->key_mem_type_id  = udata->iter_data->u.map_iter_data.key_mem_type_id;
+
+                /* Check for key sharing dkey with other metadata.  Maps with
+                 * native uint64 dkeys keep no metadata in their data
+                 * object. */
+                iter_op_udata->shared_dkey =
+                    !map->dkey_uint64 && ((udata->kds[i].kd_key_len == H5_daos_int_md_key_size_g &&
+                                           !memcmp(p, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g)) ||
+                                          (udata->kds[i].kd_key_len == H5_daos_attr_key_size_g &&
+                                           !memcmp(p, H5_daos_attr_key_g, H5_daos_attr_key_size_g)));
+                if (batch) {
+                    /* The value fetch also tells us whether this dkey holds a
+                     * map record, so no separate query is needed */
+                    iter_op_udata->batch     = batch;
+                    iter_op_udata->batch_idx = (size_t)i;
+                    batch->rc++;
+                } /* end if */
+                else if (iter_op_udata->shared_dkey) {
+                    daos_obj_rw_t *rw_args;
+
+                    iter_op_udata->generic_ud.task_name = "map key record query task";
+
+                    /* Set up dkey */
+                    daos_iov_set(&iter_op_udata->dkey, (void *)p, udata->kds[i].kd_key_len);
+
+                    /* Set up iod */
+                    memset(&iter_op_udata->iod, 0, sizeof(daos_iod_t));
+                    daos_const_iov_set((d_const_iov_t *)&iter_op_udata->iod.iod_name, H5_daos_map_key_g,
+                                       H5_daos_map_key_size_g);
+                    iter_op_udata->iod.iod_nr   = 1u;
+                    iter_op_udata->iod.iod_type = DAOS_IOD_SINGLE;
+                    iter_op_udata->iod.iod_size = DAOS_REC_ANY;
+
+                    /* Create task to query record in dkey */
+                    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, dep_task ? 1 : 0,
+                                                 dep_task ? &dep_task : NULL, H5_daos_generic_prep_cb,
+                                                 H5_daos_map_iterate_query_comp_cb, iter_op_udata,
+                                                 &query_task) < 0)
+                        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                                     "can't create task to check for value in map");
+
+                    /* Set fetch task arguments */
+                    if (NULL == (rw_args = daos_task_get_args(query_task)))
+                        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                                     "can't get arguments for metadata I/O task");
+                    memset(rw_args, 0, sizeof(*rw_args));
+                    rw_args->oh    = H5_DAOS_MAP_DATA_OH(map);
+                    rw_args->th    = DAOS_TX_NONE;
+                    rw_args->flags = 0;
+                    rw_args->dkey  = &iter_op_udata->dkey;
+                    rw_args->nr    = 1u;
+                    rw_args->iods  = &iter_op_udata->iod;
+
+                    /* Schedule record query task (or save it to be scheduled later) */
+                    if (first_task) {
+                        if (0 != (ret = tse_task_schedule(query_task, false)))
+                            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret,
+                                         "can't schedule task to check for value in map: %s",
+                                         H5_daos_err_to_string(ret));
+                    } /* end if */
+                    else
+                        first_task = query_task;
+                    dep_task = query_task;
+                } /* end if */
+
+                iter_op_udata->key_buf = p;
+                iter_op_udata->key_len = udata->kds[i].kd_key_len;
+
+                /* Create task for iter op.  If values are being fetched it
+                 * must also wait for them to be converted. */
+                {
+                    tse_task_t *op_deps[2];
+                    int         op_ndeps = 0;
+
+                    if (dep_task)
+                        op_deps[op_ndeps++] = dep_task;
+                    if (batch)
+                        op_deps[op_ndeps++] = batch->conv_task;
+                    if (H5_daos_create_task(H5_daos_map_iterate_op_task, op_ndeps, op_ndeps ? op_deps : NULL,
+                                            NULL, NULL, iter_op_udata, &iter_op_udata->op_task) < 0)
+                        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                                     "can't create task for iteration op");
+                }
+
+                /* Schedule iter op (or save it to be scheduled later) and
+                 * transfer ownership of iter_op_udata */
+                if (first_task) {
+                    if (0 != (ret = tse_task_schedule(iter_op_udata->op_task, false)))
+                        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task for iteration op: %s",
+                                     H5_daos_err_to_string(ret));
+                } /* end if */
+                else
+                    first_task = iter_op_udata->op_task;
+                dep_task      = iter_op_udata->op_task;
+                iter_op_udata = NULL;
+
+                /* Advance to next akey */
+                p += udata->kds[i].kd_key_len;
+            } /* end for */
+
+            /* If this process has more anchors to list in a partitioned
+             * iteration, move on to the next one */
+            if (daos_anchor_is_eof(&udata->anchor) &&
+                udata->iter_data->u.map_iter_data.part_next < udata->iter_data->u.map_iter_data.part_nr) {
+                memset(&udata->anchor, 0, sizeof(udata->anchor));
+                if (0 != (ret = H5_daos_map_anchor_set(map, udata->iter_data->u.map_iter_data.part_next,
+                                                       &udata->anchor)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't set anchor for map iteration: %s",
+                                 H5_daos_err_to_string(ret));
+                udata->iter_data->u.map_iter_data.part_next += udata->iter_data->u.map_iter_data.part_stride;
+            } /* end if */
+
+            /* Continue iteration if we're not done */
+            if (!daos_anchor_is_eof(&udata->anchor) && (req->status == -H5_DAOS_INCOMPLETE)) {
+                if (0 !=
+                    (ret = H5_daos_list_key_start(udata, DAOS_OPC_OBJ_LIST_DKEY,
+                                                  H5_daos_map_iterate_list_comp_cb, &first_task, &dep_task)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't start iteration");
+                udata = NULL;
+            } /* end if */
+        }     /* end else */
+    }         /* end else */
+
+done:
+    /* If we still own udata then iteration is complete.  Register dependency
+     * for metatask and schedule it. */
+    if (udata) {
+        if (dep_task && 0 != (ret = tse_task_register_deps(udata->iter_metatask, 1, &dep_task)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't create dependencies for iteration metatask: %s",
+                         H5_daos_err_to_string(ret));
+
+        if (first_task) {
+            if (0 != (ret = tse_task_schedule(udata->iter_metatask, false)))
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule iteration metatask: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            first_task = udata->iter_metatask;
+        udata = NULL;
+    } /* end if */
+
+    /* Schedule first task */
+    if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+        D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret,
+                     "can't schedule initial task for map iteration dkey list comp cb: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-        /* Check for external async */
-        if (req) {
-            /* Return int_req as req */
-            *req = int_req;
+    /* Release our reference to the value batch */
+    if (batch) {
+        H5_daos_map_iter_batch_decref(batch);
+        batch = NULL;
+    } /* end if */
 
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+    /* Clean up on error */
+    if (ret_value < 0) {
+        if (iter_op_udata) {
+            if (iter_op_udata->key_buf_alloc)
+                iter_op_udata->key_buf_alloc = DV_free(iter_op_udata->key_buf_alloc);
+            if (iter_op_udata->batch)
+                H5_daos_map_iter_batch_decref(iter_op_udata->batch);
+            iter_op_udata = DV_free(iter_op_udata);
         } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "map get operation failed in task \"%s\": %s",
-                             int_req->failed_task, H5_daos_err_to_string(int_req->status));
 
-            /* Close internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* end else */
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value != -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            req->status      = ret_value;
+            req->failed_task = "map iteration dkey list completion callback";
+        } /* end if */
     }     /* end if */
 
-    if (map_id >= 0) {
-        map->obj.item.nonblocking_close = TRUE;
-        if ((ret = H5Idec_ref(map_id)) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map ID");
-        if (ret)
-            map->obj.item.nonblocking_close = FALSE;
-        map_id = H5I_INVALID_HID;
-    } /* end if */
+    /* Make sure we cleaned up */
+    assert(!udata);
+    assert(!iter_op_udata);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_get() */
+} /* end H5_daos_map_iterate_list_key_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_get_count_cb
+ * Function:    H5_daos_map_iterate_query_comp_cb
  *
- * Purpose:     Iterate callback for H5Mget_count()
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to query
+ *              whether a key-value pair in a map object is actually a map
+ *              record key or if it is a dkey representing other metadata.
+ *              Currently just checks for a failed task.
  *
- * Return:      Success:        0 (never fails)
+ * Return:      Success:        0
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_map_get_count_cb(hid_t H5VL_DAOS_UNUSED map_id, const void H5VL_DAOS_UNUSED *key, void *_int_count)
+static int
+H5_daos_map_iterate_query_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    hsize_t *int_count = (hsize_t *)_int_count;
+    H5_daos_map_iter_op_ud_t *udata;
+    int                       ret_value = 0;
 
-    (*int_count)++;
+    assert(H5_daos_task_list_g);
 
-    return 0;
-} /* end H5_daos_map_get_count_cb() */
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map iteration record query task");
+
+    assert(udata->generic_ud.req);
+    assert(udata->generic_ud.req->file);
+
+    /* Handle errors in task.  Only record error in udata->req_status if it does
+     * not already contain an error (it could contain an error if another task
+     * this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->generic_ud.req->status      = task->dt_result;
+        udata->generic_ud.req->failed_task = udata->generic_ud.task_name;
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate_query_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_specific
+ * Function:    H5_daos_map_iterate_op_task
  *
- * Purpose:     Performs a map "specific" operation
+ * Purpose:     Perform operation on a map key-value pair during iteration.
  *
  * Return:      Success:        0
- *              Failure:        -1
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_map_specific(void *_item, H5VL_map_args_t *map_args, hid_t dxpl_id, void **req)
+static int
+H5_daos_map_iterate_op_task(tse_task_t *task)
 {
-    H5_daos_item_t *item        = (H5_daos_item_t *)_item;
-    H5_daos_map_t  *map         = NULL;
-    H5_daos_req_t  *int_req     = NULL;
-    H5_daos_req_t  *int_int_req = NULL;
-    tse_task_t     *first_task  = NULL;
-    tse_task_t     *dep_task    = NULL;
-    hbool_t         collective_md_read;
-    hbool_t         collective_md_write;
-    herr_t          iter_ret = 0;
-    hid_t           map_id   = H5I_INVALID_HID;
-    hid_t           mapl_id  = H5P_MAP_ACCESS_DEFAULT;
-    int             ret;
-    herr_t          ret_value = SUCCEED;
-
-    assert(map_args);
-
-    if (!_item)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
-
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
-
-    /* Determine metadata I/O mode setting (collective vs. independent)
-     * for metadata reads and writes according to file-wide setting on FAPL.
-     */
-    H5_DAOS_GET_METADATA_IO_MODES(item->file, mapl_id, H5P_MAP_ACCESS_DEFAULT, collective_md_read,
-                                  collective_md_write, H5E_MAP, FAIL);
-
-    /* Start H5 operation */
-    if (NULL ==
-        (int_req = H5_daos_req_create(item->file, "map specific", item->open_req, NULL, NULL, dxpl_id)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
-
-    switch (map_args->specific.specific_type) {
-        /* H5Miterate(_by_name) */
-        case H5VL_MAP_ITER: {
-            H5_daos_iter_data_t iter_data;
-            H5VL_loc_params_t  *loc_params      = &map_args->specific.args.iterate.loc_params;
-            hsize_t            *idx             = &map_args->specific.args.iterate.idx;
-            hid_t               key_mem_type_id = map_args->specific.args.iterate.key_mem_type_id;
-            H5M_iterate_t       op              = map_args->specific.args.iterate.op;
-            void               *op_data         = map_args->specific.args.iterate.op_data;
-
-            int_req->op_name = "map iterate";
-
-            switch (loc_params->type) {
-                /* H5Miterate */
-                case H5VL_OBJECT_BY_SELF: {
-                    /* Use item as the map for iteration */
-                    if (item->type != H5I_MAP)
-                        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "item not a map");
+    H5_daos_map_iter_op_ud_t *udata      = NULL;
+    H5_daos_req_t            *req        = NULL;
+    tse_task_t               *first_task = NULL;
+    tse_task_t               *dep_task   = NULL;
+    int                       ret;
+    int                       ret_value = 0;
 
-                    map = (H5_daos_map_t *)item;
-                    map->obj.item.rc++;
-                    break;
-                } /* H5VL_OBJECT_BY_SELF */
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for iteration operation task");
 
-                /* H5Miterate_by_name */
-                case H5VL_OBJECT_BY_NAME: {
-                    H5VL_loc_params_t sub_loc_params;
+    /* Set task name in case it was set for the map key record query task */
+    udata->generic_ud.task_name = "map iteration op";
 
-                    /* Start internal H5 operation for target map open.  This will
-                     * not be visible to the API, will not be added to an operation
-                     * pool, and will be integrated into this function's task chain. */
-                    if (NULL == (int_int_req = H5_daos_req_create(
-                                     item->file, "target map open within map iterate by name", NULL, NULL,
-                                     int_req, H5I_INVALID_HID)))
-                        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    /* Assign req convenience pointer.  We do this so we can still handle errors
+     * after transfering ownership of udata.  This should be safe since the
+     * iteration metatask holds a reference to req until all iteration is
+     * complete at this level. */
+    req = udata->generic_ud.req;
 
-                    /* Open target_map */
-                    sub_loc_params.obj_type = item->type;
-                    sub_loc_params.type     = H5VL_OBJECT_BY_SELF;
-                    if (NULL == (map = H5_daos_map_open_int(
-                                     item, &sub_loc_params, loc_params->loc_data.loc_by_name.name,
-                                     loc_params->loc_data.loc_by_name.lapl_id, int_int_req,
-                                     collective_md_read, &first_task, &dep_task)))
-                        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't open map for operation");
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(req, H5E_MAP);
 
-                    /* Create task to finalize internal operation */
-                    if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0,
-                                            dep_task ? &dep_task : NULL, NULL, NULL, int_int_req,
-                                            &int_int_req->finalize_task) < 0)
-                        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
-                                     "can't create task to finalize internal operation");
+    /* Check if this key's dkey was a dkey shared with other metadata.
+     * If it was, skip processing of this key. */
+    if (udata->batch ? !udata->batch->vals[udata->batch_idx].found
+                     : (udata->shared_dkey && udata->iod.iod_size == 0))
+        D_GOTO_DONE(0);
 
-                    /* Schedule finalize task (or save it to be scheduled later),
-                     * give it ownership of int_int_req, and update task pointers */
-                    if (first_task) {
-                        if (0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
-                            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL,
-                                         "can't schedule task to finalize H5 operation: %s",
-                                         H5_daos_err_to_string(ret));
-                    } /* end if */
-                    else
-                        first_task = int_int_req->finalize_task;
-                    dep_task    = int_int_req->finalize_task;
-                    int_int_req = NULL;
+    /* Pass over pairs already iterated over when restarting.  idx already
+     * counts them. */
+    if (udata->iter_ud->iter_data->u.map_iter_data.skip > 0) {
+        udata->iter_ud->iter_data->u.map_iter_data.skip--;
+        D_GOTO_DONE(0);
+    } /* end if */
 
-                    break;
-                } /* H5VL_OBJECT_BY_NAME */
+    /* Add null terminator temporarily.  Only necessary for VL strings
+     * but it would take about as much time to check for VL string again
+     * after the callback as it does to just always swap in the null
+     * terminator so just do this for simplicity. */
+    udata->char_replace_loc  = &((char *)udata->key_buf)[udata->key_len];
+    udata->char_replace_char = *udata->char_replace_loc;
+    *udata->char_replace_loc = '\0';
 
-                case H5VL_OBJECT_BY_IDX:
-                case H5VL_OBJECT_BY_TOKEN:
-                default:
-                    D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "invalid loc_params type");
-            } /* end switch */
+    /* Convert key (if necessary) */
+    if (H5_daos_map_key_conv_reverse(udata->key_dkey_type_id, udata->key_mem_type_id, udata->key_buf,
+                                     (size_t)udata->key_len, &udata->key_buf, &udata->key_buf_alloc,
+                                     &udata->vl_union, req->dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_H5_TCONV_ERROR, "can't convert key");
 
-            /* Wait for the map to open if necessary */
-            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (map->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
-            } /* end if */
+    /* Call the map iteration callback operator function on the current key-value pair */
+    if (udata->batch)
+        udata->iter_ud->iter_data->op_ret = udata->iter_ud->iter_data->u.map_iter_data.u.map_iter_kv_op(
+            udata->iter_ud->iter_data->iter_root_obj, udata->key_buf,
+            (const uint8_t *)udata->batch->val_buf +
+                (udata->batch->vals[udata->batch_idx].conv_idx * udata->batch->val_mem_type_size),
+            udata->iter_ud->iter_data->op_data);
+    else if (udata->iter_ud->iter_data->async_op) {
+        if (udata->iter_ud->iter_data->u.map_iter_data.u.map_iter_op_async(
+                udata->iter_ud->iter_data->iter_root_obj, udata->key_buf, udata->iter_ud->iter_data->op_data,
+                &udata->iter_ud->iter_data->op_ret, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADITER, -H5_DAOS_CALLBACK_ERROR, "operator function returned failure");
+    } /* end if */
+    else
+        udata->iter_ud->iter_data->op_ret = udata->iter_ud->iter_data->u.map_iter_data.u.map_iter_op(
+            udata->iter_ud->iter_data->iter_root_obj, udata->key_buf, udata->iter_ud->iter_data->op_data);
 
-            /* Register ID for map */
-            if ((map_id = H5VLwrap_register(map, H5I_MAP)) < 0)
-                D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
+    /* Check for failure from operator return */
+    if (udata->iter_ud->iter_data->op_ret < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADITER, -H5_DAOS_CALLBACK_ERROR, "operator function returned failure");
 
-            /* Initialize iteration data */
-            H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC, FALSE, idx,
-                                   map_id, op_data, NULL, int_req);
-            iter_data.u.map_iter_data.key_mem_type_id = key_mem_type_id;
-            iter_data.u.map_iter_data.u.map_iter_op   = op;
+    /* Advance idx */
+    if (udata->iter_ud->iter_data->idx_p)
+        (*udata->iter_ud->iter_data->idx_p)++;
 
-            /* Handle iteration return value TODO: how to handle if called async? */
-            if (!req)
-                iter_data.op_ret_p = &iter_ret;
+    /* Check for short-circuit success */
+    if (udata->iter_ud->iter_data->op_ret) {
+        udata->iter_ud->iter_data->req->status        = -H5_DAOS_SHORT_CIRCUIT;
+        udata->iter_ud->iter_data->short_circuit_init = TRUE;
 
-            /* Perform map iteration */
-            if (H5_daos_map_iterate(map, &iter_data, &first_task, &dep_task) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed");
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+    } /* end if */
 
-            break;
-        } /* H5VL_MAP_ITER */
+done:
+    /* Check for tasks scheduled, in this case we need to schedule a task to
+     * mark this task complete and free udata */
+    if (dep_task) {
+        tse_task_t *op_end_task;
 
-        case H5VL_MAP_DELETE: {
-            H5VL_loc_params_t *loc_params      = &map_args->specific.args.del.loc_params;
-            hid_t              key_mem_type_id = map_args->specific.args.del.key_mem_type_id;
-            const void        *key             = map_args->specific.args.del.key;
+        assert(udata);
 
-            int_req->op_name = "map key delete";
+        /* Schedule task to complete this task and free udata */
+        if (H5_daos_create_task(H5_daos_map_iter_op_end, 1, &dep_task, NULL, NULL, udata, &op_end_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task to finish iteration op");
+        else {
+            /* Schedule map iter op end task and give it ownership of udata */
+            assert(first_task);
+            if (0 != (ret = tse_task_schedule(op_end_task, false)))
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task to finish map iteration op: %s",
+                             H5_daos_err_to_string(ret));
+            udata    = NULL;
+            dep_task = op_end_task;
+        } /* end else */
 
-            /* Verify loc_params */
-            if (H5VL_OBJECT_BY_SELF != loc_params->type)
-                D_GOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL,
-                             "unsupported map key delete location parameters type");
-            map = (H5_daos_map_t *)item;
-            map->obj.item.rc++;
+        /* Schedule first task */
+        assert(first_task);
+        if (0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule initial task for map iteration op: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        assert(!first_task);
 
-            /* Wait for the map to open if necessary */
-            if (!map->obj.item.created && map->obj.item.open_req->status != 0) {
-                if (H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (map->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
-            } /* end if */
+    /* Handle errors */
+    if (ret_value < 0 && req) {
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value != -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            req->status      = ret_value;
+            req->failed_task = udata->generic_ud.task_name;
+        } /* end if */
+    }     /* end if */
 
-            /* Perform key delete */
-            if ((ret_value = H5_daos_map_delete_key(map, key_mem_type_id, key, collective_md_write, int_req,
-                                                    &first_task, &dep_task)) < 0)
-                D_GOTO_ERROR(H5E_MAP, H5E_CANTREMOVE, FAIL, "map key delete failed");
+    /* Complete task and free udata if we still own udata */
+    if (udata) {
+        /* Replace char */
+        if (udata->char_replace_loc)
+            *udata->char_replace_loc = udata->char_replace_char;
 
-            break;
-        } /* H5VL_MAP_DELETE */
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-        default:
-            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid or unsupported map specific operation");
-    } /* end switch */
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
 
-done:
-    if (int_req) {
-        /* Create task to finalize H5 operation */
-        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, int_req, &int_req->finalize_task) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
-        /* Schedule finalize task */
-        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
-                         H5_daos_err_to_string(ret));
-        else
-            /* finalize_task now owns a reference to req */
-            int_req->rc++;
+        /* Free private data */
+        if (udata->key_buf_alloc)
+            DV_free(udata->key_buf_alloc);
+        if (udata->batch)
+            H5_daos_map_iter_batch_decref(udata->batch);
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
-        /* If there was an error during setup, pass it to the request */
-        if (ret_value < 0)
-            int_req->status = -H5_DAOS_SETUP_ERROR;
+    /* Make sure we cleaned up */
+    assert(!udata);
 
-        /* Add the request to the map's request queue.  This will add the
-         * dependency on the map open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, item, H5_DAOS_OP_TYPE_WRITE, H5_DAOS_OP_SCOPE_OBJ, FALSE,
-                                !req) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate_op_task() */
 
-        /* Check for external async.  Disabled for iteration for now. */
-        if (req && map_args->specific.specific_type != H5VL_MAP_ITER) {
-            /* Return int_req as req */
-            *req = int_req;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iter_op_end
+ *
+ * Purpose:     Completes the map iteration op and frees its udata.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_iter_op_end(tse_task_t *task)
+{
+    H5_daos_map_iter_op_ud_t *udata;
+    int                       ret_value = 0;
 
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for task");
+
+    /* Replace char */
+    if (udata->char_replace_loc)
+        *udata->char_replace_loc = udata->char_replace_char;
+
+    /* Check if we need to update the request status due to an operator return */
+    if (udata->iter_ud->iter_data->async_op &&
+        udata->iter_ud->iter_data->req->status >= -H5_DAOS_INCOMPLETE) {
+        /* Check for failure from operator return */
+        if (udata->iter_ud->iter_data->op_ret < 0) {
+            udata->iter_ud->iter_data->req->status      = -H5_DAOS_CALLBACK_ERROR;
+            udata->iter_ud->iter_data->req->failed_task = "map iteration callback operator function";
+            D_DONE_ERROR(H5E_LINK, H5E_BADITER, -H5_DAOS_CALLBACK_ERROR,
+                         "operator function returned failure");
         } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        else if (udata->iter_ud->iter_data->op_ret) {
+            /* Short-circuit success */
+            udata->iter_ud->iter_data->req->status        = -H5_DAOS_SHORT_CIRCUIT;
+            udata->iter_ud->iter_data->short_circuit_init = TRUE;
+        } /* end if */
+    }     /* end if */
 
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL,
-                             "map specific operation failed in task \"%s\": %s", int_req->failed_task,
-                             H5_daos_err_to_string(int_req->status));
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, udata->op_task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-            /* Close internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+    /* Complete op task */
+    tse_task_complete(udata->op_task, 0);
 
-            /* Set return value for map iteration, unless this function failed but
-             * the iteration did not */
-            if (map_args->specific.specific_type == H5VL_MAP_ITER && !(ret_value < 0 && iter_ret >= 0))
-                ret_value = iter_ret;
-        } /* end else */
-    }     /* end if */
+    /* Free udata */
+    if (udata->key_buf_alloc)
+        DV_free(udata->key_buf_alloc);
+    if (udata->batch)
+        H5_daos_map_iter_batch_decref(udata->batch);
+    DV_free(udata);
 
-    if (map_id >= 0) {
-        map->obj.item.nonblocking_close = TRUE;
-        if ((ret = H5Idec_ref(map_id)) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map ID");
-        if (ret)
-            map->obj.item.nonblocking_close = FALSE;
-        map_id = -1;
-        map    = NULL;
-    } /* end if */
-    else if (map) {
-        if (H5_daos_map_close_real(map) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map");
-        map = NULL;
-    } /* end else */
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-    /* Close internal request for target object open */
-    if (int_int_req && H5_daos_req_free_int(int_int_req) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_specific() */
+} /* end H5_daos_map_iter_op_end() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_iterate
+ * Function:    H5_daos_map_iter_batch_start
  *
- * Purpose:     Iterates over all key-value pairs stored in the Map
- *              specified by map_id, making the callback specified by op
- *              for each. The idx parameter is an in/out parameter that
- *              may be used to restart a previously interrupted iteration.
- *              At the start of iteration idx should be set to 0, and to
- *              restart iteration at the same location on a subsequent
- *              call to H5Miterate, idx should be the same value as
- *              returned by the previous call.
+ * Purpose:     Starts fetching the values for all keys returned by the
+ *              last dkey list operation of a map iteration.  One fetch
+ *              task is created and scheduled for each key, and a single
+ *              task is created that converts all fetched values to the
+ *              memory type once they have arrived.  The iteration op
+ *              tasks for this batch must depend on *batch->conv_task.
+ *
+ *              On success, the batch is returned with one reference held
+ *              by the caller.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_map_iterate(H5_daos_map_t *map, H5_daos_iter_data_t *iter_data, tse_task_t **first_task,
-                    tse_task_t **dep_task)
+H5_daos_map_iter_batch_start(H5_daos_iter_ud_t *iter_ud, H5_daos_map_t *map, H5_daos_map_iter_batch_t **batch)
 {
-    size_t dkey_prefetch_size = 0;
-    size_t dkey_alloc_size    = 0;
-    int    ret;
-    herr_t ret_value = SUCCEED;
+    H5_daos_map_iter_batch_t *new_batch = NULL;
+    tse_task_t               *fetch_task;
+    hbool_t                   fill_bkg = FALSE;
+    char                     *p        = iter_ud->sg_iov.iov_buf;
+    size_t                    i;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
 
+    assert(iter_ud);
     assert(map);
-    assert(iter_data);
-    assert(iter_data->req);
-    assert(first_task);
-    assert(dep_task);
-    assert(H5_DAOS_ITER_TYPE_MAP == iter_data->iter_type);
-    assert(H5_INDEX_NAME == iter_data->index_type);
-    assert(H5_ITER_INC == iter_data->iter_order);
+    assert(batch);
+    assert(iter_ud->nr > 0);
+
+    /* Allocate batch */
+    if (NULL == (new_batch = (H5_daos_map_iter_batch_t *)DV_calloc(sizeof(H5_daos_map_iter_batch_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate map iteration value batch");
+    new_batch->generic_ud.req       = iter_ud->iter_data->req;
+    new_batch->generic_ud.task_name = "map iteration value fetch";
+    new_batch->map                  = map;
+    new_batch->val_mem_type_id      = iter_ud->iter_data->u.map_iter_data.val_mem_type_id;
+    new_batch->nr                   = (size_t)iter_ud->nr;
+    new_batch->rc                   = 1;
+
+    if (NULL == (new_batch->vals =
+                     (H5_daos_map_iter_val_t *)DV_calloc(new_batch->nr * sizeof(H5_daos_map_iter_val_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate map iteration value array");
+
+    /* Set up the value buffer for the whole batch, converting in place if
+     * necessary */
+    if ((new_batch->val_need_tconv = H5_daos_need_tconv(map->val_file_type_id, new_batch->val_mem_type_id)) <
+        0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+    if (new_batch->val_need_tconv) {
+        if (H5_daos_tconv_init(map->val_file_type_id, &new_batch->val_file_type_size,
+                               new_batch->val_mem_type_id, &new_batch->val_mem_type_size, new_batch->nr, TRUE,
+                               FALSE, &new_batch->val_buf, &new_batch->bkg_buf, NULL, &fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+    } /* end if */
+    else {
+        new_batch->val_file_type_size = map->val_file_type_size;
+        new_batch->val_mem_type_size  = map->val_file_type_size;
+        if (NULL == (new_batch->val_buf = DV_calloc(new_batch->nr * new_batch->val_file_type_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate map iteration value buffer");
+    } /* end else */
 
-    if (!iter_data->u.map_iter_data.u.map_iter_op)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "operator is NULL");
+    /* Create task to convert the values once they have all been fetched.  It
+     * holds its own reference to the batch. */
+    if (H5_daos_create_task(H5_daos_map_iter_batch_conv_task, 0, NULL, NULL, NULL, new_batch,
+                            &new_batch->conv_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to convert map values");
+    new_batch->rc++;
 
-    /* Iteration restart not supported */
-    if (iter_data->idx_p && (*iter_data->idx_p != 0))
-        D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL, "iteration restart not supported (must start from 0)");
+    /* Create and schedule a fetch task for each key.  These do not depend on
+     * anything, so all values in the batch are fetched concurrently. */
+    for (i = 0; i < new_batch->nr; i++) {
+        H5_daos_map_iter_val_t *val = &new_batch->vals[i];
+        daos_obj_rw_t          *rw_args;
 
-    /* Get map iterate hints */
-    if (map->mapl_id == H5P_MAP_ACCESS_DEFAULT) {
-        dkey_prefetch_size = H5_daos_plist_cache_g->mapl_cache.dkey_prefetch_size;
-        dkey_alloc_size    = H5_daos_plist_cache_g->mapl_cache.dkey_alloc_size;
-    }
-    else if (H5Pget_map_iterate_hints(map->mapl_id, &dkey_prefetch_size, &dkey_alloc_size) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map iterate hints");
+        /* Set up dkey */
+        daos_iov_set(&val->dkey, (void *)p, iter_ud->kds[i].kd_key_len);
+
+        /* Set up iods and sgls to read into this key's slot in the value
+         * buffer */
+        val->nr = H5_daos_map_val_io_init(map, &val->val_io, val->iod, val->sgl, val->sg_iov,
+                                          (uint8_t *)new_batch->val_buf + (i * new_batch->val_file_type_size),
+                                          0, new_batch->val_file_type_size);
+
+        /* Create fetch task */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_generic_prep_cb,
+                                     H5_daos_map_iter_batch_fetch_comp_cb, new_batch, &fetch_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to fetch map value");
+
+        /* Set fetch task arguments */
+        if (NULL == (rw_args = daos_task_get_args(fetch_task)))
+            D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "can't get arguments for map value fetch task");
+        memset(rw_args, 0, sizeof(*rw_args));
+        rw_args->oh    = H5_DAOS_MAP_DATA_OH(map);
+        rw_args->th    = DAOS_TX_NONE;
+        rw_args->flags = 0;
+        rw_args->dkey  = &val->dkey;
+        rw_args->nr    = val->nr;
+        rw_args->iods  = val->iod;
+        rw_args->sgls  = val->sgl;
+
+        /* The conversion task must wait for this fetch */
+        if (0 != (ret = tse_task_register_deps(new_batch->conv_task, 1, &fetch_task)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create dependencies for value conversion: %s",
+                         H5_daos_err_to_string(ret));
 
-    /* Increment reference count on map ID */
-    if (H5Iinc_ref(iter_data->iter_root_obj) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINC, FAIL, "can't increment reference count on iteration base object");
+        /* Schedule fetch task */
+        if (0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to fetch map value: %s",
+                         H5_daos_err_to_string(ret));
 
-    /* Start iteration */
-    if (0 != (ret = H5_daos_list_key_init(iter_data, &map->obj, NULL, DAOS_OPC_OBJ_LIST_DKEY,
-                                          H5_daos_map_iterate_list_comp_cb, TRUE, dkey_prefetch_size,
-                                          dkey_alloc_size, first_task, dep_task)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't start map iteration: %s",
-                     H5_daos_err_to_string(ret));
+        /* Advance to next dkey */
+        p += iter_ud->kds[i].kd_key_len;
+    } /* end for */
 
 done:
+    /* Schedule conversion task.  If we failed it will still run once the
+     * fetches already scheduled complete and release its reference. */
+    if (new_batch && new_batch->conv_task && 0 != (ret = tse_task_schedule(new_batch->conv_task, false)))
+        D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to convert map values: %s",
+                     H5_daos_err_to_string(ret));
+
+    if (ret_value < 0) {
+        if (new_batch)
+            H5_daos_map_iter_batch_decref(new_batch);
+    } /* end if */
+    else
+        *batch = new_batch;
+
     D_FUNC_LEAVE;
-} /* end H5_daos_map_iterate() */
+} /* end H5_daos_map_iter_batch_start() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_iterate_list_comp_cb
+ * Function:    H5_daos_map_iter_batch_fetch_comp_cb
  *
- * Purpose:     Completion callback for dkey list for map iteration.
- *              Initiates operation on each key-value pair and reissues
- *              list operation if appropriate.
+ * Purpose:     Complete callback for the daos_obj_fetch of a single value
+ *              prefetched during map iteration.  Only records errors; the
+ *              value is converted with the rest of its batch.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -3547,224 +10139,339 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_map_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_map_iter_batch_fetch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_iter_ud_t        *udata         = NULL;
-    H5_daos_map_iter_op_ud_t *iter_op_udata = NULL;
-    H5_daos_req_t            *req           = NULL;
-    tse_task_t               *query_task    = NULL;
-    tse_task_t               *first_task    = NULL;
-    tse_task_t               *dep_task      = NULL;
-    int                       ret;
+    H5_daos_map_iter_batch_t *batch;
     int                       ret_value = 0;
 
     assert(H5_daos_task_list_g);
 
     /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
+    if (NULL == (batch = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for operation finalize task");
+                     "can't get private data for map value fetch task");
 
-    /* Assign req convenience pointer.  We do this so we can still handle errors
-     * after transfering ownership of udata.  This should be safe since the
-     * iteration metatask holds a reference to req until all iteration is
-     * complete at this level. */
-    req = udata->iter_data->req;
+    /* Handle errors in fetch task.  Only record error in req->status if it
+     * does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && batch->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        batch->generic_ud.req->status      = task->dt_result;
+        batch->generic_ud.req->failed_task = "map iteration value fetch";
+    } /* end if */
 
-    /* Check for buffer not large enough */
-    if (task->dt_result == -DER_REC2BIG) {
-        char  *tmp_realloc = NULL;
-        size_t key_buf_len = 2 * (udata->sg_iov.iov_buf_len + 1);
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-        /* Reallocate larger buffer */
-        if (NULL == (tmp_realloc = (char *)DV_realloc(udata->sg_iov.iov_buf, key_buf_len)))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't reallocate key buffer");
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iter_batch_fetch_comp_cb() */
 
-        /* Update sg_iov */
-        daos_iov_set(&udata->sg_iov, tmp_realloc, (daos_size_t)(key_buf_len - 1));
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iter_batch_conv_task
+ *
+ * Purpose:     Asynchronous task to convert all values prefetched for a
+ *              batch of keys during map iteration.  Values that were not
+ *              found (keys in dkeys shared with other metadata) are
+ *              skipped, and the rest are packed and converted with a
+ *              single call to H5Tconvert.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_iter_batch_conv_task(tse_task_t *task)
+{
+    H5_daos_map_iter_batch_t *batch     = NULL;
+    size_t                    nconv     = 0;
+    size_t                    i;
+    int                       ret_value = 0;
 
-        /* Reissue list operation */
-        if (0 != (ret = H5_daos_list_key_start(udata, DAOS_OPC_OBJ_LIST_DKEY,
-                                               H5_daos_map_iterate_list_comp_cb, &first_task, &dep_task)))
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't start iteration");
-        udata = NULL;
-    } /* end if */
-    else {
-        /* Handle errors in list task.  Only record error in req->status
-         * if it does not already contain an error (it could contain an error if
-         * another task this task is not dependent on also failed). */
-        if (task->dt_result < -H5_DAOS_PRE_ERROR && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            req->status      = task->dt_result;
-            req->failed_task = "map iterate key list completion callback";
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (batch = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map value conversion task");
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(batch->generic_ud.req);
+
+    /* Pack found values at the start of the buffer */
+    for (i = 0; i < batch->nr; i++) {
+        htri_t found;
+
+        if ((found = H5_daos_map_val_io_found(batch->map, &batch->vals[i].val_io, batch->vals[i].iod)) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, -H5_DAOS_H5_GET_ERROR, "can't check map value");
+        batch->vals[i].found = (hbool_t)found;
+        if (found) {
+            if (nconv != i)
+                (void)memmove((uint8_t *)batch->val_buf + (nconv * batch->val_file_type_size),
+                              (uint8_t *)batch->val_buf + (i * batch->val_file_type_size),
+                              batch->val_file_type_size);
+            batch->vals[i].conv_idx = nconv++;
         } /* end if */
-        else if (task->dt_result == 0) {
-            H5_daos_map_t *map = (H5_daos_map_t *)udata->target_obj;
-            uint32_t       i;
-            char          *p = udata->sg_iov.iov_buf;
+    }     /* end for */
 
-            assert(map);
+    /* Perform type conversion if necessary */
+    if (batch->val_need_tconv && nconv > 0)
+        if (H5Tconvert(batch->map->val_file_type_id, batch->val_mem_type_id, nconv, batch->val_buf,
+                       batch->bkg_buf, batch->generic_ud.req->dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
 
-            /* Loop over returned dkeys */
-            for (i = 0; i < udata->nr; i++) {
-                /* Allocate iter op udata */
-                if (NULL ==
-                    (iter_op_udata = (H5_daos_map_iter_op_ud_t *)DV_calloc(sizeof(H5_daos_map_iter_op_ud_t))))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
-                                 "can't allocate iteration op user data");
-                iter_op_udata->generic_ud.req   = req;
-                iter_op_udata->iter_ud          = udata;
-                iter_op_udata->key_file_type_id = map->key_file_type_id;
-                iter_op_udata->key_mem_type_id  = udata->iter_data->u.map_iter_data.key_mem_type_id;
+done:
+    if (batch) {
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && batch->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            batch->generic_ud.req->status      = ret_value;
+            batch->generic_ud.req->failed_task = "map iteration value conversion task";
+        } /* end if */
 
-                /* Check for key sharing dkey with other metadata */
-                iter_op_udata->shared_dkey = (udata->kds[i].kd_key_len == H5_daos_int_md_key_size_g &&
-                                              !memcmp(p, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g)) ||
-                                             (udata->kds[i].kd_key_len == H5_daos_attr_key_size_g &&
-                                              !memcmp(p, H5_daos_attr_key_g, H5_daos_attr_key_size_g));
-                if (iter_op_udata->shared_dkey) {
-                    daos_obj_rw_t *rw_args;
+        /* Release our reference to the batch */
+        H5_daos_map_iter_batch_decref(batch);
+    } /* end if */
 
-                    iter_op_udata->generic_ud.task_name = "map key record query task";
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-                    /* Set up dkey */
-                    daos_iov_set(&iter_op_udata->dkey, (void *)p, udata->kds[i].kd_key_len);
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
 
-                    /* Set up iod */
-                    memset(&iter_op_udata->iod, 0, sizeof(daos_iod_t));
-                    daos_const_iov_set((d_const_iov_t *)&iter_op_udata->iod.iod_name, H5_daos_map_key_g,
-                                       H5_daos_map_key_size_g);
-                    iter_op_udata->iod.iod_nr   = 1u;
-                    iter_op_udata->iod.iod_type = DAOS_IOD_SINGLE;
-                    iter_op_udata->iod.iod_size = DAOS_REC_ANY;
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iter_batch_conv_task() */
 
-                    /* Create task to query record in dkey */
-                    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, dep_task ? 1 : 0,
-                                                 dep_task ? &dep_task : NULL, H5_daos_generic_prep_cb,
-                                                 H5_daos_map_iterate_query_comp_cb, iter_op_udata,
-                                                 &query_task) < 0)
-                        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                                     "can't create task to check for value in map");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iter_batch_decref
+ *
+ * Purpose:     Releases a reference to a batch of values prefetched
+ *              during map iteration, freeing it if this was the last
+ *              reference.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_map_iter_batch_decref(H5_daos_map_iter_batch_t *batch)
+{
+    assert(batch);
+    assert(batch->rc > 0);
+
+    if (--batch->rc == 0) {
+        DV_free(batch->val_buf);
+        DV_free(batch->bkg_buf);
+        DV_free(batch->vals);
+        DV_free(batch);
+    } /* end if */
+} /* end H5_daos_map_iter_batch_decref() */
 
-                    /* Set fetch task arguments */
-                    if (NULL == (rw_args = daos_task_get_args(query_task)))
-                        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                                     "can't get arguments for metadata I/O task");
-                    memset(rw_args, 0, sizeof(*rw_args));
-                    rw_args->oh    = map->obj.obj_oh;
-                    rw_args->th    = DAOS_TX_NONE;
-                    rw_args->flags = 0;
-                    rw_args->dkey  = &iter_op_udata->dkey;
-                    rw_args->nr    = 1u;
-                    rw_args->iods  = &iter_op_udata->iod;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_range_task
+ *
+ * Purpose:     Asynchronous task to start an ordered key range
+ *              iteration once the map is open.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_range_task(tse_task_t *task)
+{
+    H5_daos_map_range_t *range;
+    int                  ret_value = 0;
 
-                    /* Schedule record query task (or save it to be scheduled later) */
-                    if (first_task) {
-                        if (0 != (ret = tse_task_schedule(query_task, false)))
-                            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret,
-                                         "can't schedule task to check for value in map: %s",
-                                         H5_daos_err_to_string(ret));
-                    } /* end if */
-                    else
-                        first_task = query_task;
-                    dep_task = query_task;
-                } /* end if */
+    /* Get private data */
+    if (NULL == (range = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map key range iteration task");
 
-                iter_op_udata->key_buf = p;
-                iter_op_udata->key_len = udata->kds[i].kd_key_len;
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(range->req, H5E_MAP);
 
-                /* Create task for iter op */
-                if (H5_daos_create_task(H5_daos_map_iterate_op_task, dep_task ? 1 : 0,
-                                        dep_task ? &dep_task : NULL, NULL, NULL, iter_op_udata,
-                                        &iter_op_udata->op_task) < 0)
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                                 "can't create task for iteration op");
+done:
+    /* Start the first round, or complete the end task on error.
+     * H5_daos_map_range_advance() handles its own errors. */
+    if (range) {
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && range->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            range->req->status      = ret_value;
+            range->req->failed_task = "map key range iteration start";
+        } /* end if */
+        (void)H5_daos_map_range_advance(range);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
-                /* Schedule iter op (or save it to be scheduled later) and
-                 * transfer ownership of iter_op_udata */
-                if (first_task) {
-                    if (0 != (ret = tse_task_schedule(iter_op_udata->op_task, false)))
-                        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task for iteration op: %s",
-                                     H5_daos_err_to_string(ret));
-                } /* end if */
-                else
-                    first_task = iter_op_udata->op_task;
-                dep_task      = iter_op_udata->op_task;
-                iter_op_udata = NULL;
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
 
-                /* Advance to next akey */
-                p += udata->kds[i].kd_key_len;
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_range_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_range_advance
+ *
+ * Purpose:     Advances an ordered key range iteration once no RPCs are
+ *              in flight.  Visits the listed keys in order, calling the
+ *              operator on those in the range, until either an anchor
+ *              with keys left has used up its batch, in which case the
+ *              next round of RPCs is started, or the iteration is done,
+ *              in which case the end task is completed.  Starting a pass
+ *              positions its anchors at its lower bound first where DAOS
+ *              supports it.  Errors are recorded in the request.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_range_advance(H5_daos_map_range_t *range)
+{
+    H5_daos_vl_union_t vl_union;
+    void              *op_key_buf    = NULL;
+    void              *key_buf_alloc = NULL;
+    uint32_t           i;
+    int                ret;
+    int                ret_value = 0;
+
+    assert(range);
+    assert(range->req);
+    assert(range->nactive == 0);
+
+    /* Stop on errors in this or previous tasks */
+    while (range->req->status >= -H5_DAOS_INCOMPLETE) {
+        H5_daos_map_range_part_t *min_part = NULL;
+        uint64_t                  key;
+
+        /* Start the next pass if the current one is done */
+        if (!range->pass_started) {
+            if (range->pass == range->npasses)
+                break;
+            range->lower = range->pass_lower[range->pass];
+            range->upper = range->pass_upper[range->pass];
+
+            /* Start each anchor at the beginning of its part */
+            for (i = 0; i < range->nparts; i++) {
+                H5_daos_map_range_part_t *part = &range->parts[i];
+
+                memset(&part->anchor, 0, sizeof(part->anchor));
+                if (0 != (ret = H5_daos_map_anchor_set(range->map, i, &part->anchor)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't set anchor for map iteration: %s",
+                                 H5_daos_err_to_string(ret));
+                part->nkeys  = 0;
+                part->next   = 0;
+                part->listed = FALSE;
             } /* end for */
+            range->pass_started = TRUE;
+
+#if CHECK_DAOS_API_VERSION(2, 4)
+            /* Position each anchor at the lower bound of the pass */
+            range->seek = TRUE;
+            if (0 != (ret = H5_daos_map_range_round(range)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't position map key range anchors");
+            D_GOTO_DONE(0);
+#endif
+        } /* end if */
+        range->seek = FALSE;
+
+        /* List the next batch of each anchor whose batch is used up.  The
+         * smallest unvisited key can only be found once every anchor with
+         * keys left has a batch, so the round is repeated if an anchor with
+         * keys left returned none. */
+        for (i = 0; i < range->nparts; i++)
+            if (range->parts[i].next == range->parts[i].nkeys && !range->parts[i].listed)
+                break;
+        if (i < range->nparts) {
+            if (0 != (ret = H5_daos_map_range_round(range)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, ret, "can't list map keys in range");
+            D_GOTO_DONE(0);
+        } /* end if */
 
-            /* Continue iteration if we're not done */
-            if (!daos_anchor_is_eof(&udata->anchor) && (req->status == -H5_DAOS_INCOMPLETE)) {
-                if (0 !=
-                    (ret = H5_daos_list_key_start(udata, DAOS_OPC_OBJ_LIST_DKEY,
-                                                  H5_daos_map_iterate_list_comp_cb, &first_task, &dep_task)))
-                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't start iteration");
-                udata = NULL;
-            } /* end if */
-        }     /* end else */
-    }         /* end else */
+        /* Find the smallest unvisited key */
+        for (i = 0; i < range->nparts; i++) {
+            H5_daos_map_range_part_t *part = &range->parts[i];
 
-done:
-    /* If we still own udata then iteration is complete.  Register dependency
-     * for metatask and schedule it. */
-    if (udata) {
-        if (dep_task && 0 != (ret = tse_task_register_deps(udata->iter_metatask, 1, &dep_task)))
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't create dependencies for iteration metatask: %s",
-                         H5_daos_err_to_string(ret));
+            if (part->next < part->nkeys &&
+                (!min_part || part->keys[part->next] < min_part->keys[min_part->next]))
+                min_part = part;
+        } /* end for */
 
-        if (first_task) {
-            if (0 != (ret = tse_task_schedule(udata->iter_metatask, false)))
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule iteration metatask: %s",
-                             H5_daos_err_to_string(ret));
+        /* Move on to the next pass if all anchors are done */
+        if (!min_part) {
+            range->pass++;
+            range->pass_started = FALSE;
+            continue;
         } /* end if */
-        else
-            first_task = udata->iter_metatask;
-        udata = NULL;
-    } /* end if */
 
-    /* Schedule first task */
-    if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
-        D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret,
-                     "can't schedule initial task for map iteration dkey list comp cb: %s",
-                     H5_daos_err_to_string(ret));
+        key = min_part->keys[min_part->next++];
+
+        /* Skip keys below the range, only listed if the anchors could not be
+         * positioned.  Once past the range no later key of this anchor can be
+         * in it. */
+        if (key < range->lower)
+            continue;
+        if (key > range->upper) {
+            min_part->next   = min_part->nkeys;
+            min_part->listed = TRUE;
+            continue;
+        } /* end if */
+
+        /* Convert key to memory type */
+        if (H5_daos_map_key_conv_reverse(range->map->key_dkey_type_id, range->key_mem_type_id, &key,
+                                         sizeof(uint64_t), &op_key_buf, &key_buf_alloc, &vl_union,
+                                         range->req->dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't convert key");
+
+        /* Call the map iteration callback operator function on the key */
+        range->op_ret = range->op(range->map_id, op_key_buf, range->op_data);
+        key_buf_alloc = DV_free(key_buf_alloc);
+        if (range->op_ret < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADITER, -H5_DAOS_CALLBACK_ERROR, "operator function returned failure");
+
+        /* Stop if the operator asked to */
+        if (range->op_ret != H5_ITER_CONT)
+            break;
+    } /* end while */
 
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    /* Iteration is done */
+    if (range->end_task)
+        tse_task_complete(range->end_task, 0);
 
-    /* Clean up on error */
-    if (ret_value < 0) {
-        if (iter_op_udata) {
-            if (iter_op_udata->key_buf_alloc)
-                iter_op_udata->key_buf_alloc = DV_free(iter_op_udata->key_buf_alloc);
-            iter_op_udata = DV_free(iter_op_udata);
-        } /* end if */
+done:
+    key_buf_alloc = DV_free(key_buf_alloc);
 
+    if (ret_value < 0) {
         /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if (ret_value != -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            req->status      = ret_value;
-            req->failed_task = "map iteration dkey list completion callback";
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && range->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            range->req->status      = ret_value;
+            range->req->failed_task = "map key range iteration";
         } /* end if */
-    }     /* end if */
 
-    /* Make sure we cleaned up */
-    assert(!udata);
-    assert(!iter_op_udata);
+        /* Complete end task unless RPCs of a partly started round will do so
+         * when they complete */
+        if (range->nactive == 0 && range->end_task)
+            tse_task_complete(range->end_task, 0);
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_iterate_list_key_comp_cb() */
+} /* end H5_daos_map_range_advance() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_iterate_query_comp_cb
+ * Function:    H5_daos_map_range_round
  *
- * Purpose:     Complete callback for asynchronous daos_obj_fetch to query
- *              whether a key-value pair in a map object is actually a map
- *              record key or if it is a dkey representing other metadata.
- *              Currently just checks for a failed task.
+ * Purpose:     Starts one round of RPCs of an ordered key range
+ *              iteration: positions every anchor at the lower bound of
+ *              the current pass if range->seek is set, otherwise lists
+ *              the next batch of every anchor whose batch is used up and
+ *              that has keys left.  The RPCs of a round run in parallel,
+ *              and the last to complete advances the iteration.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -3772,41 +10479,66 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_map_iterate_query_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_map_range_round(H5_daos_map_range_t *range)
 {
-    H5_daos_map_iter_op_ud_t *udata;
-    int                       ret_value = 0;
+    tse_task_t *rpc_task = NULL;
+    uint32_t    i;
+    int         ret;
+    int         ret_value = 0;
 
-    assert(H5_daos_task_list_g);
+    assert(range);
+    assert(range->nactive == 0);
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for map iteration record query task");
+    for (i = 0; i < range->nparts; i++) {
+        H5_daos_map_range_part_t *part = &range->parts[i];
 
-    assert(udata->generic_ud.req);
-    assert(udata->generic_ud.req->file);
+        if (part->listed)
+            continue;
 
-    /* Handle errors in task.  Only record error in udata->req_status if it does
-     * not already contain an error (it could contain an error if another task
-     * this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->generic_ud.req->status      = task->dt_result;
-        udata->generic_ud.req->failed_task = udata->generic_ud.task_name;
-    } /* end if */
+        if (range->seek) {
+#if CHECK_DAOS_API_VERSION(2, 4)
+            /* Create task to position the anchor at the lower bound */
+            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_KEY2ANCHOR, 0, NULL, H5_daos_map_range_seek_prep_cb,
+                                         H5_daos_map_range_comp_cb, part, &rpc_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create task to position map key range anchor");
+#else
+            D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, -H5_DAOS_SETUP_ERROR,
+                         "map key range anchors cannot be positioned with this DAOS version");
+#endif
+        } /* end if */
+        else if (part->next == part->nkeys) {
+            /* Create task to list the next batch of keys */
+            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_LIST_DKEY, 0, NULL, H5_daos_map_range_list_prep_cb,
+                                         H5_daos_map_range_comp_cb, part, &rpc_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create task to list map keys in range");
+        } /* end if */
+        else
+            continue;
 
-done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+        /* Schedule task */
+        if (0 != (ret = tse_task_schedule(rpc_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task for map key range listing: %s",
+                         H5_daos_err_to_string(ret));
+        range->nactive++;
+    } /* end for */
 
+    /* A round is only started when an anchor needs an RPC */
+    assert(range->nactive > 0);
+
+done:
     D_FUNC_LEAVE;
-} /* end H5_daos_map_iterate_query_comp_cb() */
+} /* end H5_daos_map_range_round() */
 
+#if CHECK_DAOS_API_VERSION(2, 4)
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_iterate_op_task
+ * Function:    H5_daos_map_range_seek_prep_cb
  *
- * Purpose:     Perform operation on a map key-value pair during iteration.
+ * Purpose:     Prepare callback for asynchronous daos_obj_key2anchor to
+ *              position an anchor of an ordered key range iteration at
+ *              the lower bound of the current pass, so listing starts at
+ *              the first dkey of the anchor not below it.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -3814,151 +10546,106 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_map_iterate_op_task(tse_task_t *task)
+H5_daos_map_range_seek_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_map_iter_op_ud_t *udata      = NULL;
-    H5_daos_req_t            *req        = NULL;
-    tse_task_t               *first_task = NULL;
-    tse_task_t               *dep_task   = NULL;
-    int                       ret;
+    H5_daos_map_range_part_t *part;
+    daos_obj_key2anchor_t    *seek_args;
     int                       ret_value = 0;
 
     /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
+    if (NULL == (part = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for iteration operation task");
-
-    /* Set task name in case it was set for the map key record query task */
-    udata->generic_ud.task_name = "map iteration op";
-
-    /* Assign req convenience pointer.  We do this so we can still handle errors
-     * after transfering ownership of udata.  This should be safe since the
-     * iteration metatask holds a reference to req until all iteration is
-     * complete at this level. */
-    req = udata->generic_ud.req;
-
-    /* Handle errors in previous tasks */
-    H5_DAOS_PREP_REQ(req, H5E_MAP);
-
-    /* Check if this key's dkey was a dkey shared with other metadata.
-     * If it was, skip processing of this key. */
-    if (udata->shared_dkey && udata->iod.iod_size == 0)
-        D_GOTO_DONE(0);
-
-    /* Add null terminator temporarily.  Only necessary for VL strings
-     * but it would take about as much time to check for VL string again
-     * after the callback as it does to just always swap in the null
-     * terminator so just do this for simplicity. */
-    udata->char_replace_loc  = &((char *)udata->key_buf)[udata->key_len];
-    udata->char_replace_char = *udata->char_replace_loc;
-    *udata->char_replace_loc = '\0';
-
-    /* Convert key (if necessary) */
-    if (H5_daos_map_key_conv_reverse(udata->key_file_type_id, udata->key_mem_type_id, udata->key_buf,
-                                     (size_t)udata->key_len, &udata->key_buf, &udata->key_buf_alloc,
-                                     &udata->vl_union, req->dxpl_id) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_H5_TCONV_ERROR, "can't convert key");
-
-    /* Call the map iteration callback operator function on the current key-value pair */
-    if (udata->iter_ud->iter_data->async_op) {
-        if (udata->iter_ud->iter_data->u.map_iter_data.u.map_iter_op_async(
-                udata->iter_ud->iter_data->iter_root_obj, udata->key_buf, udata->iter_ud->iter_data->op_data,
-                &udata->iter_ud->iter_data->op_ret, &first_task, &dep_task) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_BADITER, -H5_DAOS_CALLBACK_ERROR, "operator function returned failure");
-    } /* end if */
-    else
-        udata->iter_ud->iter_data->op_ret = udata->iter_ud->iter_data->u.map_iter_data.u.map_iter_op(
-            udata->iter_ud->iter_data->iter_root_obj, udata->key_buf, udata->iter_ud->iter_data->op_data);
-
-    /* Check for failure from operator return */
-    if (udata->iter_ud->iter_data->op_ret < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_BADITER, -H5_DAOS_CALLBACK_ERROR, "operator function returned failure");
+                     "can't get private data for map key range anchor positioning task");
 
-    /* Advance idx */
-    if (udata->iter_ud->iter_data->idx_p)
-        (*udata->iter_ud->iter_data->idx_p)++;
+    assert(part->range);
 
-    /* Check for short-circuit success */
-    if (udata->iter_ud->iter_data->op_ret) {
-        udata->iter_ud->iter_data->req->status        = -H5_DAOS_SHORT_CIRCUIT;
-        udata->iter_ud->iter_data->short_circuit_init = TRUE;
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(part->range->req);
 
-        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
-    } /* end if */
+    /* Set task arguments */
+    if (NULL == (seek_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for map key range anchor positioning task");
+    memset(seek_args, 0, sizeof(*seek_args));
+    seek_args->oh     = H5_DAOS_MAP_DATA_OH(part->range->map);
+    seek_args->th     = part->range->req->th;
+    seek_args->dkey   = &part->range->lower_dkey;
+    seek_args->anchor = &part->anchor;
 
 done:
-    /* Check for tasks scheduled, in this case we need to schedule a task to
-     * mark this task complete and free udata */
-    if (dep_task) {
-        tse_task_t *op_end_task;
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
-        assert(udata);
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_range_seek_prep_cb() */
+#endif /* CHECK_DAOS_API_VERSION(2, 4) */
 
-        /* Schedule task to complete this task and free udata */
-        if (H5_daos_create_task(H5_daos_map_iter_op_end, 1, &dep_task, NULL, NULL, udata, &op_end_task) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                         "can't create task to finish iteration op");
-        else {
-            /* Schedule map iter op end task and give it ownership of udata */
-            assert(first_task);
-            if (0 != (ret = tse_task_schedule(op_end_task, false)))
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task to finish map iteration op: %s",
-                             H5_daos_err_to_string(ret));
-            udata    = NULL;
-            dep_task = op_end_task;
-        } /* end else */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_range_list_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_list_dkey to
+ *              list the next batch of dkeys of an anchor of an ordered
+ *              key range iteration.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_range_list_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_range_part_t *part;
+    daos_obj_list_dkey_t     *list_args;
+    int                       ret_value = 0;
 
-        /* Schedule first task */
-        assert(first_task);
-        if (0 != (ret = tse_task_schedule(first_task, false)))
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule initial task for map iteration op: %s",
-                         H5_daos_err_to_string(ret));
-    } /* end if */
-    else
-        assert(!first_task);
+    /* Get private data */
+    if (NULL == (part = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map key range list task");
+
+    assert(part->range);
 
     /* Handle errors */
-    if (ret_value < 0 && req) {
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if (ret_value != -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            req->status      = ret_value;
-            req->failed_task = udata->generic_ud.task_name;
-        } /* end if */
-    }     /* end if */
+    H5_DAOS_PREP_REQ_PROG(part->range->req);
 
-    /* Complete task and free udata if we still own udata */
-    if (udata) {
-        /* Replace char */
-        if (udata->char_replace_loc)
-            *udata->char_replace_loc = udata->char_replace_char;
+    /* Reset batch */
+    part->nkeys         = part->range->batch_nr;
+    part->next          = 0;
+    part->sgl.sg_nr_out = 0;
 
-        /* Return task to task list */
-        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    /* Set task arguments */
+    if (NULL == (list_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for map key range list task");
+    memset(list_args, 0, sizeof(*list_args));
+    list_args->oh          = H5_DAOS_MAP_DATA_OH(part->range->map);
+    list_args->th          = part->range->req->th;
+    list_args->nr          = &part->nkeys;
+    list_args->kds         = part->kds;
+    list_args->sgl         = &part->sgl;
+    list_args->dkey_anchor = &part->anchor;
+    list_args->incr_order  = true;
 
-        /* Complete this task */
+done:
+    if (ret_value < 0) {
+        if (part)
+            part->nkeys = 0;
         tse_task_complete(task, ret_value);
-
-        /* Free private data */
-        if (udata->key_buf_alloc)
-            DV_free(udata->key_buf_alloc);
-        udata = DV_free(udata);
     } /* end if */
-    else
-        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
-
-    /* Make sure we cleaned up */
-    assert(!udata);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_iterate_op_task() */
+} /* end H5_daos_map_range_list_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_iter_op_end
+ * Function:    H5_daos_map_range_comp_cb
  *
- * Purpose:     Completes the map iteration op and frees its udata.
+ * Purpose:     Complete callback for the asynchronous daos_obj_key2anchor
+ *              or daos_obj_list_dkey of an anchor of an ordered key range
+ *              iteration.  After a list, marks the anchor as listed if it
+ *              has no keys left or its batch ends past the range.
+ *              Advances the iteration once no RPCs of the round are left
+ *              in flight.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -3966,58 +10653,68 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_map_iter_op_end(tse_task_t *task)
+H5_daos_map_range_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_map_iter_op_ud_t *udata;
+    H5_daos_map_range_part_t *part;
+    H5_daos_map_range_t      *range = NULL;
+    uint32_t                  i;
     int                       ret_value = 0;
 
+    assert(H5_daos_task_list_g);
+
     /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for task");
+    if (NULL == (part = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for map key range list task");
+
+    range = part->range;
+
+    /* Handle errors in task.  Only record error in req->status if it does
+     * not already contain an error (it could contain an error if another
+     * task this task is not dependent on also failed).  An anchor with no
+     * dkeys at or after the lower bound has nothing to list. */
+    if (range->seek && task->dt_result == -DER_NONEXIST)
+        part->listed = TRUE;
+    else if (task->dt_result < -H5_DAOS_PRE_ERROR && range->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        range->req->status      = task->dt_result;
+        range->req->failed_task = range->seek ? "map key range anchor positioning" : "map key range list";
+    } /* end if */
+    else if (task->dt_result == 0 && !range->seek) {
+        /* All dkeys of a map's data object are native uint64 values */
+        for (i = 0; i < part->nkeys; i++)
+            if (part->kds[i].kd_key_len != sizeof(uint64_t))
+                D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "map dkey is not a native uint64");
+
+        /* Check if there is nothing left to list in the range */
+        if (daos_anchor_is_eof(&part->anchor) ||
+            (part->nkeys > 0 && part->keys[part->nkeys - 1] >= range->upper))
+            part->listed = TRUE;
+    } /* end if */
 
-    /* Replace char */
-    if (udata->char_replace_loc)
-        *udata->char_replace_loc = udata->char_replace_char;
+    /* Nothing was listed if the task did not succeed */
+    if (task->dt_result != 0 && !range->seek)
+        part->nkeys = 0;
 
-    /* Check if we need to update the request status due to an operator return */
-    if (udata->iter_ud->iter_data->async_op &&
-        udata->iter_ud->iter_data->req->status >= -H5_DAOS_INCOMPLETE) {
-        /* Check for failure from operator return */
-        if (udata->iter_ud->iter_data->op_ret < 0) {
-            udata->iter_ud->iter_data->req->status      = -H5_DAOS_CALLBACK_ERROR;
-            udata->iter_ud->iter_data->req->failed_task = "map iteration callback operator function";
-            D_DONE_ERROR(H5E_LINK, H5E_BADITER, -H5_DAOS_CALLBACK_ERROR,
-                         "operator function returned failure");
-        } /* end if */
-        else if (udata->iter_ud->iter_data->op_ret) {
-            /* Short-circuit success */
-            udata->iter_ud->iter_data->req->status        = -H5_DAOS_SHORT_CIRCUIT;
-            udata->iter_ud->iter_data->short_circuit_init = TRUE;
+done:
+    if (range) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && range->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            range->req->status      = ret_value;
+            range->req->failed_task = "map key range list completion callback";
         } /* end if */
-    }     /* end if */
-
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, udata->op_task) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
-    /* Complete op task */
-    tse_task_complete(udata->op_task, 0);
 
-    /* Free udata */
-    if (udata->key_buf_alloc)
-        DV_free(udata->key_buf_alloc);
-    DV_free(udata);
+        /* Advance the iteration once all RPCs of this round are done */
+        assert(range->nactive > 0);
+        if (--range->nactive == 0)
+            (void)H5_daos_map_range_advance(range);
+    } /* end if */
 
-done:
     /* Return task to task list */
     if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
         D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-    /* Complete this task */
-    tse_task_complete(task, ret_value);
-
     D_FUNC_LEAVE;
-} /* end H5_daos_map_iter_op_end() */
+} /* end H5_daos_map_range_comp_cb() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_map_delete_key
@@ -4068,8 +10765,8 @@ H5_daos_map_delete_key(H5_daos_map_t *map, hid_t key_mem_type_id, const void *ke
         delete_udata->map = map;
 
         /* Convert key (if necessary) */
-        if (H5_daos_map_key_conv(key_mem_type_id, map->key_file_type_id, key, &delete_udata->key_buf,
-                                 &delete_udata->key_size, &delete_udata->key_buf_alloc, req->dxpl_id) < 0)
+        if (H5_daos_map_key_conv(map, key_mem_type_id, key, &delete_udata->key_buf, &delete_udata->key_size,
+                                 delete_udata->key_buf_local, &delete_udata->key_buf_alloc, req->dxpl_id) < 0)
             D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
 
         /* Set up dkey */
@@ -4077,14 +10774,20 @@ H5_daos_map_delete_key(H5_daos_map_t *map, hid_t key_mem_type_id, const void *ke
                            (daos_size_t)delete_udata->key_size);
 
         /* Check for key sharing dkey with other metadata.  If dkey is shared, only
-         * delete akey, otherwise delete dkey. */
-        if (((delete_udata->key_size == H5_daos_int_md_key_size_g) &&
-             !memcmp(key, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g)) ||
-            ((delete_udata->key_size == H5_daos_attr_key_size_g) &&
-             !memcmp(key, H5_daos_attr_key_g, H5_daos_attr_key_size_g))) {
-            /* Set up akey */
-            daos_const_iov_set((d_const_iov_t *)&delete_udata->akey, H5_daos_map_key_g,
+         * delete akey, otherwise delete dkey.  Maps with native uint64 dkeys
+         * keep no metadata in their data object. */
+        if (!map->dkey_uint64 && (((delete_udata->key_size == H5_daos_int_md_key_size_g) &&
+                                   !memcmp(key, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g)) ||
+                                  ((delete_udata->key_size == H5_daos_attr_key_size_g) &&
+                                   !memcmp(key, H5_daos_attr_key_g, H5_daos_attr_key_size_g)))) {
+            /* Set up akeys.  Maps that store their values out of line also
+             * need the value akey removed. */
+            daos_const_iov_set((d_const_iov_t *)&delete_udata->akeys[0], H5_daos_map_key_g,
                                H5_daos_map_key_size_g);
+            delete_udata->akey_nr = 1;
+            if (map->large_vals)
+                daos_const_iov_set((d_const_iov_t *)&delete_udata->akeys[delete_udata->akey_nr++],
+                                   H5_daos_map_val_key_g, H5_daos_map_val_key_size_g);
 
             delete_udata->shared_dkey = TRUE;
 
@@ -4165,12 +10868,12 @@ H5_daos_map_delete_key_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
                      "can't get arguments for attribute deletion task");
     memset(punch_args, 0, sizeof(*punch_args));
-    punch_args->oh      = udata->map->obj.obj_oh;
+    punch_args->oh      = H5_DAOS_MAP_DATA_OH(udata->map);
     punch_args->th      = DAOS_TX_NONE;
     punch_args->dkey    = &udata->dkey;
-    punch_args->akeys   = udata->shared_dkey ? &udata->akey : NULL;
+    punch_args->akeys   = udata->shared_dkey ? udata->akeys : NULL;
     punch_args->flags   = DAOS_COND_PUNCH;
-    punch_args->akey_nr = udata->shared_dkey ? 1 : 0;
+    punch_args->akey_nr = udata->shared_dkey ? udata->akey_nr : 0;
 
 done:
     if (ret_value < 0)
@@ -4212,6 +10915,12 @@ H5_daos_map_delete_key_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         udata->req->status      = task->dt_result;
         udata->req->failed_task = "map key deletion task";
     } /* end if */
+    else if (task->dt_result == 0) {
+        /* The conditional punch only succeeds if the key existed */
+        assert(udata->map);
+        if (udata->map->shared)
+            udata->map->shared->count_delta--;
+    } /* end if */
 
 done:
     /* Return task to task list */
@@ -4281,6 +10990,10 @@ H5_daos_map_close_real(H5_daos_map_t *map)
             if (0 != (ret = daos_obj_close(map->obj.obj_oh, NULL /*event*/)))
                 D_DONE_ERROR(H5E_MAP, H5E_CANTCLOSEOBJ, FAIL, "can't close map DAOS object: %s",
                              H5_daos_err_to_string(ret));
+        if (!daos_handle_is_inval(map->data_oh))
+            if (0 != (ret = daos_obj_close(map->data_oh, NULL /*event*/)))
+                D_DONE_ERROR(H5E_MAP, H5E_CANTCLOSEOBJ, FAIL, "can't close map data DAOS object: %s",
+                             H5_daos_err_to_string(ret));
         if (map->key_type_id != H5I_INVALID_HID && H5Idec_ref(map->key_type_id) < 0)
             D_DONE_ERROR(H5E_MAP, H5E_CANTDEC, FAIL, "failed to close datatype");
         if (map->key_file_type_id != H5I_INVALID_HID && H5Idec_ref(map->key_file_type_id) < 0)
@@ -4295,6 +11008,10 @@ H5_daos_map_close_real(H5_daos_map_t *map)
         if (map->mapl_id != H5I_INVALID_HID && map->mapl_id != H5P_MAP_ACCESS_DEFAULT)
             if (H5Idec_ref(map->mapl_id) < 0)
                 D_DONE_ERROR(H5E_MAP, H5E_CANTDEC, FAIL, "failed to close mapl");
+        if (H5_daos_map_key_conv_cache_reset(&map->key_conv_cache) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTRELEASE, FAIL, "can't release key conversion plan");
+        H5_daos_name_cache_free(&map->obj.attr_name_cache);
+        H5_daos_map_shared_release(map);
         map = H5FL_FREE(H5_daos_map_t, map);
     } /* end if */
 
@@ -4334,10 +11051,12 @@ H5_daos_map_close(void *_map, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
     /* Check if the map's request queue is empty, if so we can close it
      * immediately.  Also close if the pool is empty and has no start task (and
      * hence does not depend on anything).  Also close if it is marked to close
-     * nonblocking. */
+     * nonblocking.  Do not close immediately if this process's changes to the
+     * map's entry count or Bloom filter still need to be synced. */
     if (((map->obj.item.open_req->status == 0 || map->obj.item.open_req->status < -H5_DAOS_CANCELED) &&
          (!map->obj.item.cur_op_pool || (map->obj.item.cur_op_pool->type == H5_DAOS_OP_TYPE_EMPTY &&
-                                         !map->obj.item.cur_op_pool->start_task))) ||
+                                         !map->obj.item.cur_op_pool->start_task)) &&
+         (!map->shared || (map->shared->count_delta == 0 && !map->shared->bloom_dirty))) ||
         map->obj.item.nonblocking_close) {
         if (H5_daos_map_close_real(map) < 0)
             D_GOTO_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map");
@@ -4356,15 +11075,26 @@ H5_daos_map_close(void *_map, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
         task_ud->req  = int_req;
         task_ud->item = &map->obj.item;
 
+        /* Sync this process's changes to the map's Bloom filter and entry
+         * count */
+        if (H5_daos_map_sync(map, int_req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't sync map");
+
         /* Create task to close map */
-        if (H5_daos_create_task(H5_daos_object_close_task, 0, NULL, NULL, NULL, task_ud, &close_task) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to close map");
+        if (H5_daos_create_task(H5_daos_object_close_task, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                                NULL, NULL, task_ud, &close_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to close map");
 
-        /* Save task to be scheduled later and give it a reference to req and
-         * map */
-        assert(!first_task);
-        first_task = close_task;
-        dep_task   = close_task;
+        /* Schedule task (or save it to be scheduled later) and give it a
+         * reference to req */
+        if (first_task) {
+            if (0 != (ret = tse_task_schedule(close_task, false)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to close map: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            first_task = close_task;
+        dep_task = close_task;
         /* No need to take a reference to map here since the purpose is to
          * release the API's reference */
         int_req->rc++;
@@ -4435,7 +11165,8 @@ done:
  *
  * Purpose:     Flushes a DAOS map.  Creates a barrier task so all async
  *              ops created before the flush execute before all async ops
- *              created after the flush.
+ *              created after the flush, then syncs this process's
+ *              changes to the map's Bloom filter and entry count.
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -4446,8 +11177,7 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_map_flush(H5_daos_map_t H5VL_DAOS_UNUSED *map, H5_daos_req_t H5VL_DAOS_UNUSED *req,
-                  tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_map_flush(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
     tse_task_t *barrier_task = NULL;
     herr_t      ret_value    = SUCCEED; /* Return value */
@@ -4464,6 +11194,11 @@ H5_daos_map_flush(H5_daos_map_t H5VL_DAOS_UNUSED *map, H5_daos_req_t H5VL_DAOS_U
     *first_task = barrier_task;
     *dep_task   = barrier_task;
 
+    /* Sync this process's changes to the map's Bloom filter and entry
+     * count, as in H5_daos_map_close() */
+    if (H5_daos_map_sync(map, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't sync map");
+
 done:
     D_FUNC_LEAVE;
 } /* end H5_daos_map_flush() */
@@ -152,6 +152,21 @@ typedef struct H5_daos_object_update_num_attrs_key_ud_t {
     uint8_t               nattrs_new_buf[H5_DAOS_ENCODED_NUM_ATTRS_SIZE];
 } H5_daos_object_update_num_attrs_key_ud_t;
 
+/* Task user data for retrieving information about a link or attribute
+ * creation order index */
+typedef struct H5_daos_object_get_corder_info_ud_t {
+    H5_daos_md_rw_cb_ud_t  md_rw_cb_ud; /* Must be first */
+    H5_daos_corder_info_t *corder_info;
+    hbool_t                attr_index;
+    hbool_t                get_holes;
+    uint8_t                nobjs_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
+    uint8_t                max_corder_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    uint8_t                nholes_buf[H5_DAOS_ENCODED_UINT64_T_SIZE];
+    uint8_t                fmt_buf[H5_DAOS_ENCODED_CORDER_FMT_SIZE];
+    uint8_t               *holes_buf;
+    daos_recx_t            holes_recx;
+} H5_daos_object_get_corder_info_ud_t;
+
 /* User data struct for object reference count operations */
 typedef struct H5_daos_obj_rw_rc_ud_t {
     H5_daos_req_t  *req;
@@ -199,6 +214,11 @@ static int    H5_daos_object_get_info_task(tse_task_t *task);
 static int    H5_daos_object_get_info_end(tse_task_t *task);
 static int    H5_daos_get_num_attrs_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_get_num_attrs_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_get_corder_info_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_get_corder_holes_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_get_corder_holes_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_corder_hole_cmp(const void *_hole1, const void *_hole2);
+static int    H5_daos_get_corder_info_free_udata(H5_daos_object_get_corder_info_ud_t *udata, int ret_value);
 static int    H5_daos_object_update_num_attrs_key_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_object_update_num_attrs_key_comp_cb(tse_task_t *task, void *args);
 
@@ -942,7 +962,7 @@ H5_daos_object_get_oid_by_idx(H5_daos_obj_t *loc_obj, const H5VL_loc_params_t *l
     /* Retrieve the name of the link at the given index */
     if (H5_daos_link_get_name_by_idx_alloc(
             get_oid_udata->target_grp, loc_params->loc_data.loc_by_idx.idx_type,
-            loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
+            loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL,
             &get_oid_udata->link_name, &get_oid_udata->link_name_len, &get_oid_udata->path_buf, NULL, req,
             first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "can't get link name");
@@ -1211,7 +1231,8 @@ H5_daos_object_oid_bcast(H5_daos_file_t *file, daos_obj_id_t *oid, H5_daos_req_t
     oid_bcast_udata->bcast_udata.buffer         = oid_bcast_udata->oid_buf;
     oid_bcast_udata->bcast_udata.buffer_len     = H5_DAOS_ENCODED_OID_SIZE;
     oid_bcast_udata->bcast_udata.count          = H5_DAOS_ENCODED_OID_SIZE;
-    oid_bcast_udata->bcast_udata.comm           = req->file->comm;
+    oid_bcast_udata->bcast_udata.lane           = NULL;
+    oid_bcast_udata->bcast_udata.prefetch       = FALSE;
     oid_bcast_udata->oid                        = oid;
 
     /* Create task for broadcast */
@@ -2480,7 +2501,7 @@ H5_daos_group_copy_helper(H5_daos_group_t *src_grp, H5_daos_group_t *dst_grp, co
     /* Copy the group */
     if (NULL == (copied_group = H5_daos_group_create_helper(dst_grp->obj.item.file, FALSE, src_grp->gcpl_id,
                                                             src_grp->gapl_id, dst_grp, name, strlen(name),
-                                                            FALSE, int_int_req, first_task, dep_task)))
+                                                            FALSE, int_int_req, first_task, dep_task, NULL)))
         D_GOTO_ERROR(H5E_SYM, H5E_CANTCOPY, NULL, "can't create new group");
 
     /* Create task to finalize internal operation */
@@ -3711,6 +3732,11 @@ H5_daos_object_specific(void *_item, const H5VL_loc_params_t *loc_params,
             iter_data.u.obj_iter_data.u.obj_iter_op = visit_args->op;
             iter_data.u.obj_iter_data.obj_name      = ".";
 
+            /* Allow visiting sibling objects concurrently (and making
+             * callbacks out of order) if the file was opened with
+             * H5daos_set_unordered_visit() */
+            iter_data.unordered = item->file->fapl_cache.unordered_visit;
+
             if (H5_daos_object_visit(target_obj_p, target_obj, &iter_data, int_req, &first_task, &dep_task) <
                 0)
                 D_GOTO_ERROR(H5E_OBJECT, H5E_BADITER, FAIL, "object visiting failed");
@@ -4362,6 +4388,7 @@ H5_daos_object_visit_task(tse_task_t *task)
         H5_DAOS_ITER_DATA_INIT(sub_iter_data, H5_DAOS_ITER_TYPE_LINK, udata->iter_data.index_type,
                                udata->iter_data.iter_order, FALSE, udata->iter_data.idx_p,
                                udata->target_obj_id, udata, NULL, udata->req);
+        sub_iter_data.unordered                             = udata->iter_data.unordered;
         sub_iter_data.async_op                              = TRUE;
         sub_iter_data.u.link_iter_data.u.link_iter_op_async = H5_daos_object_visit_link_iter_cb;
 
@@ -5151,6 +5178,956 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_get_num_attrs_comp_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_object_get_corder_info
+ *
+ * Purpose:     Creates asynchronous tasks for retrieving information
+ *              about an object's link (if attr_index is FALSE, in which
+ *              case target_obj must be a group) or attribute creation
+ *              order index: the number of entries in the index, the
+ *              maximum creation order value, the number of hole ranges
+ *              in the index and the index's format record.  If get_holes
+ *              is TRUE, the hole ranges themselves are also read, sorted
+ *              and placed in an array allocated for corder_info->holes,
+ *              which must be freed by the caller with DV_free().  The
+ *              fields in *corder_info are not guaranteed to be valid
+ *              until after *dep_task (as returned from this function) is
+ *              complete.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_object_get_corder_info(H5_daos_obj_t *target_obj, hbool_t attr_index, hbool_t get_holes,
+                               H5_daos_corder_info_t *corder_info, H5_daos_req_t *req,
+                               tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_object_get_corder_info_ud_t *udata       = NULL;
+    tse_task_t                          *fetch_task  = NULL;
+    tse_task_t                          *holes_task  = NULL;
+    int                                  ret;
+    herr_t                               ret_value = SUCCEED;
+
+    assert(target_obj);
+    assert(corder_info);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+    assert(attr_index || target_obj->item.type == H5I_GROUP);
+    H5daos_compile_assert(H5_DAOS_ENCODED_NUM_LINKS_SIZE == 8);
+    H5daos_compile_assert(H5_DAOS_ENCODED_NUM_ATTRS_SIZE == 8);
+    H5daos_compile_assert(H5_DAOS_ENCODED_CRT_ORDER_SIZE == 8);
+
+    memset(corder_info, 0, sizeof(*corder_info));
+
+    /* Allocate argument struct for fetch tasks */
+    if (NULL == (udata = (H5_daos_object_get_corder_info_ud_t *)DV_calloc(
+                     sizeof(H5_daos_object_get_corder_info_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for creation order index info fetch callback arguments");
+    udata->corder_info     = corder_info;
+    udata->attr_index      = attr_index;
+    udata->get_holes       = get_holes;
+    udata->md_rw_cb_ud.req = req;
+    udata->md_rw_cb_ud.obj = target_obj;
+
+    /* Set up dkey */
+    if (attr_index)
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.dkey, H5_daos_attr_key_g,
+                           H5_daos_attr_key_size_g);
+    else
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.dkey, H5_daos_link_corder_key_g,
+                           H5_daos_link_corder_key_size_g);
+    udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Set up iods */
+    if (attr_index) {
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_nattr_key_g,
+                           H5_daos_nattr_key_size_g);
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[1].iod_name,
+                           H5_daos_max_attr_corder_key_g, H5_daos_max_attr_corder_key_size_g);
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[2].iod_name,
+                           H5_daos_nattr_corder_holes_key_g, H5_daos_nattr_corder_holes_key_size_g);
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[3].iod_name,
+                           H5_daos_attr_corder_fmt_key_g, H5_daos_attr_corder_fmt_key_size_g);
+    } /* end if */
+    else {
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_nlinks_key_g,
+                           H5_daos_nlinks_key_size_g);
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[1].iod_name,
+                           H5_daos_max_link_corder_key_g, H5_daos_max_link_corder_key_size_g);
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[2].iod_name,
+                           H5_daos_nlink_corder_holes_key_g, H5_daos_nlink_corder_holes_key_size_g);
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[3].iod_name,
+                           H5_daos_link_corder_fmt_key_g, H5_daos_link_corder_fmt_key_size_g);
+    } /* end else */
+    udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
+    udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)H5_DAOS_ENCODED_NUM_LINKS_SIZE;
+    udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+    udata->md_rw_cb_ud.iod[1].iod_nr   = 1u;
+    udata->md_rw_cb_ud.iod[1].iod_size = (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+    udata->md_rw_cb_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
+    udata->md_rw_cb_ud.iod[2].iod_nr   = 1u;
+    udata->md_rw_cb_ud.iod[2].iod_size = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+    udata->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
+    udata->md_rw_cb_ud.iod[3].iod_nr   = 1u;
+    udata->md_rw_cb_ud.iod[3].iod_size = (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE;
+    udata->md_rw_cb_ud.iod[3].iod_type = DAOS_IOD_SINGLE;
+
+    udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set up sgls */
+    daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->nobjs_buf, (daos_size_t)H5_DAOS_ENCODED_NUM_LINKS_SIZE);
+    daos_iov_set(&udata->md_rw_cb_ud.sg_iov[1], udata->max_corder_buf,
+                 (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+    daos_iov_set(&udata->md_rw_cb_ud.sg_iov[2], udata->nholes_buf, (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+    daos_iov_set(&udata->md_rw_cb_ud.sg_iov[3], udata->fmt_buf, (daos_size_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE);
+    udata->md_rw_cb_ud.sgl[0].sg_iovs = &udata->md_rw_cb_ud.sg_iov[0];
+    udata->md_rw_cb_ud.sgl[1].sg_iovs = &udata->md_rw_cb_ud.sg_iov[1];
+    udata->md_rw_cb_ud.sgl[2].sg_iovs = &udata->md_rw_cb_ud.sg_iov[2];
+    udata->md_rw_cb_ud.sgl[3].sg_iovs = &udata->md_rw_cb_ud.sg_iov[3];
+    udata->md_rw_cb_ud.sgl[0].sg_nr = udata->md_rw_cb_ud.sgl[1].sg_nr = 1;
+    udata->md_rw_cb_ud.sgl[2].sg_nr = udata->md_rw_cb_ud.sgl[3].sg_nr = 1;
+
+    udata->md_rw_cb_ud.nr = 4u;
+
+    udata->md_rw_cb_ud.task_name = "creation order index info retrieval task";
+
+    /* Create task to fetch the index info */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_md_rw_prep_cb, H5_daos_get_corder_info_comp_cb, udata,
+                                 &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL,
+                     "can't create task to get creation order index info");
+
+    /* Create task to fetch the hole ranges if requested.  The prep callback
+     * skips the fetch if the index turns out not to have any holes. */
+    if (get_holes)
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, &fetch_task, H5_daos_get_corder_holes_prep_cb,
+                                     H5_daos_get_corder_holes_comp_cb, udata, &holes_task) < 0)
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL,
+                         "can't create task to get creation order index holes");
+
+    /* Schedule fetch task (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL,
+                         "can't schedule task to get creation order index info: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = fetch_task;
+    *dep_task  = fetch_task;
+    fetch_task = NULL;
+
+    /* Schedule holes fetch task.  Give the tasks a reference to req and
+     * target_obj, which will be released by the last task */
+    if (holes_task) {
+        if (0 != (ret = tse_task_schedule(holes_task, false)))
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL,
+                         "can't schedule task to get creation order index holes: %s",
+                         H5_daos_err_to_string(ret));
+        *dep_task  = holes_task;
+        holes_task = NULL;
+    } /* end if */
+    req->rc++;
+    target_obj->item.rc++;
+    udata = NULL;
+
+done:
+    if (ret_value < 0) {
+        if (holes_task)
+            tse_task_complete(holes_task, -H5_DAOS_SETUP_ERROR);
+        if (fetch_task)
+            tse_task_complete(fetch_task, -H5_DAOS_SETUP_ERROR);
+        udata = DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_object_get_corder_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_corder_info_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous task to retrieve
+ *              information about a creation order index.  Currently
+ *              checks for a failed task then decodes the index info.
+ *              Frees private data if the hole ranges were not requested.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_get_corder_info_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_object_get_corder_info_ud_t *udata;
+    uint8_t                             *p;
+    int                                  ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for creation order index info fetch task");
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+    } /* end if */
+    else if (task->dt_result == 0) {
+        /* Decode each value, missing records mean the value is 0 */
+        if (udata->md_rw_cb_ud.iod[0].iod_size != (uint64_t)0) {
+            p = udata->nobjs_buf;
+            UINT64DECODE(p, udata->corder_info->nobjs);
+        } /* end if */
+        if (udata->md_rw_cb_ud.iod[1].iod_size != (uint64_t)0) {
+            p = udata->max_corder_buf;
+            UINT64DECODE(p, udata->corder_info->max_corder);
+        } /* end if */
+        if (udata->md_rw_cb_ud.iod[2].iod_size != (uint64_t)0) {
+            p = udata->nholes_buf;
+            UINT64DECODE(p, udata->corder_info->nholes);
+        } /* end if */
+
+        /* A missing format record means the index is in the older,
+         * compacted format */
+        if (udata->md_rw_cb_ud.iod[3].iod_size != (uint64_t)0) {
+            if (udata->md_rw_cb_ud.iod[3].iod_size != (uint64_t)H5_DAOS_ENCODED_CORDER_FMT_SIZE)
+                D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                             "creation order index format record size is invalid");
+            if (H5_daos_corder_fmt_decode(udata->fmt_buf, udata->corder_info) < 0)
+                D_GOTO_ERROR(H5E_OBJECT, H5E_CANTDECODE, -H5_DAOS_BAD_VALUE,
+                             "can't decode creation order index format record");
+        } /* end if */
+    } /* end else */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Free private data if the holes fetch task won't */
+    if (udata) {
+        if (!udata->get_holes)
+            ret_value = H5_daos_get_corder_info_free_udata(udata, ret_value);
+        else if (ret_value < -H5_DAOS_SHORT_CIRCUIT &&
+                 udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "creation order index info retrieval completion callback";
+        } /* end if */
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_corder_info_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_corder_holes_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous task to retrieve the
+ *              hole ranges of a creation order index.  Skips the fetch
+ *              if the index has no holes, otherwise allocates the holes
+ *              buffer and sets arguments for the DAOS operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_get_corder_holes_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_object_get_corder_info_ud_t *udata;
+    daos_obj_rw_t                       *fetch_args;
+    daos_size_t                          holes_size;
+    int                                  ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for creation order index holes fetch task");
+
+    assert(udata->md_rw_cb_ud.req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_OBJECT);
+
+    assert(udata->md_rw_cb_ud.obj);
+
+    /* Nothing to fetch if the index doesn't have any holes */
+    if (udata->corder_info->nholes == 0) {
+        tse_task_complete(task, 0);
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* Allocate buffer for the encoded hole ranges */
+    holes_size = (daos_size_t)udata->corder_info->nholes * H5_DAOS_ENCODED_CORDER_HOLE_SIZE;
+    if (NULL == (udata->holes_buf = (uint8_t *)DV_malloc(holes_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate buffer for creation order index holes");
+
+    /* Set up iod */
+    memset(&udata->md_rw_cb_ud.iod[0], 0, sizeof(daos_iod_t));
+    if (udata->attr_index)
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[0].iod_name,
+                           H5_daos_attr_corder_holes_key_g, H5_daos_attr_corder_holes_key_size_g);
+    else
+        daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[0].iod_name,
+                           H5_daos_link_corder_holes_key_g, H5_daos_link_corder_holes_key_size_g);
+    udata->holes_recx.rx_idx            = 0;
+    udata->holes_recx.rx_nr             = udata->corder_info->nholes;
+    udata->md_rw_cb_ud.iod[0].iod_nr    = 1u;
+    udata->md_rw_cb_ud.iod[0].iod_size  = (daos_size_t)H5_DAOS_ENCODED_CORDER_HOLE_SIZE;
+    udata->md_rw_cb_ud.iod[0].iod_recxs = &udata->holes_recx;
+    udata->md_rw_cb_ud.iod[0].iod_type  = DAOS_IOD_ARRAY;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->holes_buf, holes_size);
+    udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+
+    udata->md_rw_cb_ud.nr = 1u;
+
+    udata->md_rw_cb_ud.task_name = "creation order index holes retrieval task";
+
+    /* Set fetch task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for metadata I/O task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh    = udata->md_rw_cb_ud.obj->obj_oh;
+    fetch_args->th    = udata->md_rw_cb_ud.req->th;
+    fetch_args->flags = DAOS_COND_AKEY_FETCH;
+    fetch_args->dkey  = &udata->md_rw_cb_ud.dkey;
+    fetch_args->nr    = udata->md_rw_cb_ud.nr;
+    fetch_args->iods  = udata->md_rw_cb_ud.iod;
+    fetch_args->sgls  = udata->md_rw_cb_ud.sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_corder_holes_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_corder_holes_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous task to retrieve the
+ *              hole ranges of a creation order index.  Checks for a
+ *              failed task, decodes the ranges, sorts them and computes
+ *              the number of slots skipped by each range and the ranges
+ *              before it, then frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_get_corder_holes_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_object_get_corder_info_ud_t *udata;
+    H5_daos_corder_hole_t               *holes;
+    const uint8_t                       *p;
+    uint64_t                             skip = 0;
+    uint64_t                             i;
+    int                                  ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for creation order index holes fetch task");
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+    } /* end if */
+    else if (task->dt_result == 0 && udata->corder_info->nholes > 0) {
+        if (udata->md_rw_cb_ud.iod[0].iod_size != (daos_size_t)H5_DAOS_ENCODED_CORDER_HOLE_SIZE)
+            D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                         "creation order index holes record size is invalid");
+
+        /* Decode the ranges */
+        if (NULL == (holes = (H5_daos_corder_hole_t *)DV_malloc((size_t)udata->corder_info->nholes *
+                                                                sizeof(H5_daos_corder_hole_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate creation order index holes");
+        udata->corder_info->holes = holes;
+        p                         = udata->holes_buf;
+        for (i = 0; i < udata->corder_info->nholes; i++) {
+            UINT64DECODE(p, holes[i].start);
+            UINT64DECODE(p, holes[i].end);
+            holes[i].rec = i;
+            if (holes[i].end <= holes[i].start)
+                D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                             "creation order index hole range is invalid");
+        } /* end for */
+
+        /* Sort the ranges and compute the running total of skipped slots */
+        qsort(holes, (size_t)udata->corder_info->nholes, sizeof(H5_daos_corder_hole_t),
+              H5_daos_corder_hole_cmp);
+        for (i = 0; i < udata->corder_info->nholes; i++) {
+            if (i > 0 && holes[i].start <= holes[i - 1].end)
+                D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                             "creation order index hole ranges overlap");
+            skip += holes[i].end - holes[i].start;
+            holes[i].skip = skip;
+        } /* end for */
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if (udata)
+        ret_value = H5_daos_get_corder_info_free_udata(udata, ret_value);
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_corder_holes_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_corder_info_free_udata
+ *
+ * Purpose:     Releases the resources held by the user data for
+ *              creation order index info retrieval.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_get_corder_info_free_udata(H5_daos_object_get_corder_info_ud_t *udata, int ret_value)
+{
+    assert(udata);
+
+    if (udata->md_rw_cb_ud.obj && H5_daos_object_close(&udata->md_rw_cb_ud.obj->item) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except
+     * for H5_daos_req_free_int, which updates req->status if it sees an
+     * error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = ret_value;
+        udata->md_rw_cb_ud.req->failed_task = "creation order index info retrieval completion callback";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    DV_free(udata->holes_buf);
+    DV_free(udata);
+
+    return ret_value;
+} /* end H5_daos_get_corder_info_free_udata() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_hole_cmp
+ *
+ * Purpose:     qsort() comparison callback to sort creation order index
+ *              hole ranges by their start slot.
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_corder_hole_cmp(const void *_hole1, const void *_hole2)
+{
+    const H5_daos_corder_hole_t *hole1 = (const H5_daos_corder_hole_t *)_hole1;
+    const H5_daos_corder_hole_t *hole2 = (const H5_daos_corder_hole_t *)_hole2;
+
+    return (hole1->start > hole2->start) - (hole1->start < hole2->start);
+} /* end H5_daos_corder_hole_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_to_slot
+ *
+ * Purpose:     Translates an index value (in increasing creation order)
+ *              into the slot holding that entry in a creation order
+ *              index, skipping over the index's hole ranges.  The hole
+ *              ranges must have been retrieved if corder_info->nholes is
+ *              nonzero.
+ *
+ *              Hole range i is preceded by start - (skip - (end -
+ *              start)) entries, which increases with i, so the last range
+ *              preceded by at most idx entries is found with a binary
+ *              search and the slot is idx plus that range's skip.
+ *
+ * Return:      The slot for the index value (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint64_t
+H5_daos_corder_idx_to_slot(const H5_daos_corder_info_t *corder_info, uint64_t idx)
+{
+    const H5_daos_corder_hole_t *hole;
+    uint64_t                     lo = 0;
+    uint64_t                     hi;
+    uint64_t                     mid;
+
+    assert(corder_info);
+    assert(corder_info->nholes == 0 || corder_info->holes);
+
+    /* Find the number of hole ranges preceded by at most idx entries */
+    hi = corder_info->nholes;
+    while (lo < hi) {
+        mid  = lo + (hi - lo) / 2;
+        hole = &corder_info->holes[mid];
+        if (hole->start - (hole->skip - (hole->end - hole->start)) <= idx)
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* end while */
+
+    return lo == 0 ? idx : idx + corder_info->holes[lo - 1].skip;
+} /* end H5_daos_corder_idx_to_slot() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_holes_insert
+ *
+ * Purpose:     Determines the changes to a creation order index's hole
+ *              records needed to add the given (previously used) slot to
+ *              the index's holes.  The slot is merged into the range(s)
+ *              it is adjacent to, keeping the ranges compact.  At most
+ *              two records change: a new range is appended, a range the
+ *              slot extends is rewritten, or when the slot joins two
+ *              ranges one of them is rewritten as the union and the
+ *              other is replaced by the last record, which is dropped.
+ *              The records to write (in increasing record order) and the
+ *              new number of holes are returned in *update.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_corder_holes_insert(const H5_daos_corder_info_t *corder_info, uint64_t slot,
+                            H5_daos_corder_holes_update_t *update)
+{
+    const H5_daos_corder_hole_t *before = NULL;
+    const H5_daos_corder_hole_t *after  = NULL;
+    uint64_t                     recs[2];
+    uint64_t                     starts[2];
+    uint64_t                     ends[2];
+    uint64_t                     last_rec;
+    uint64_t                     lo = 0;
+    uint64_t                     hi;
+    uint64_t                     mid;
+    uint8_t                     *p;
+    unsigned                     i;
+    herr_t                       ret_value = SUCCEED;
+
+    assert(corder_info);
+    assert(corder_info->nholes == 0 || corder_info->holes);
+    assert(update);
+
+    memset(update, 0, sizeof(*update));
+
+    /* Find the first range that starts after the slot */
+    hi = corder_info->nholes;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (corder_info->holes[mid].start <= slot)
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* end while */
+    if (lo > 0) {
+        before = &corder_info->holes[lo - 1];
+        if (slot < before->end)
+            D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "creation order index slot is already a hole");
+        if (before->end != slot)
+            before = NULL;
+    } /* end if */
+    if (lo < corder_info->nholes && corder_info->holes[lo].start == slot + 1)
+        after = &corder_info->holes[lo];
+
+    if (before && after) {
+        /* The slot joins two ranges - rewrite one as the union and move the
+         * last record over the other */
+        last_rec       = corder_info->nholes - 1;
+        update->nholes = corder_info->nholes - 1;
+        if (after->rec == last_rec) {
+            recs[0]       = before->rec;
+            update->nrecs = 1;
+        } /* end if */
+        else if (before->rec == last_rec) {
+            recs[0]       = after->rec;
+            update->nrecs = 1;
+        } /* end if */
+        else {
+            const H5_daos_corder_hole_t *last = NULL;
+
+            /* Find the range in the last record */
+            for (mid = 0; mid < corder_info->nholes; mid++)
+                if (corder_info->holes[mid].rec == last_rec) {
+                    last = &corder_info->holes[mid];
+                    break;
+                } /* end if */
+            assert(last);
+
+            recs[0]       = before->rec;
+            recs[1]       = after->rec;
+            starts[1]     = last->start;
+            ends[1]       = last->end;
+            update->nrecs = 2;
+        } /* end else */
+        starts[0] = before->start;
+        ends[0]   = after->end;
+    } /* end if */
+    else if (before || after) {
+        /* Extend the adjacent range */
+        update->nholes = corder_info->nholes;
+        update->nrecs  = 1;
+        recs[0]        = before ? before->rec : after->rec;
+        starts[0]      = before ? before->start : slot;
+        ends[0]        = before ? slot + 1 : after->end;
+    } /* end if */
+    else {
+        /* Append a new range */
+        update->nholes = corder_info->nholes + 1;
+        update->nrecs  = 1;
+        recs[0]        = corder_info->nholes;
+        starts[0]      = slot;
+        ends[0]        = slot + 1;
+    } /* end else */
+
+    /* Put the records in increasing order */
+    if (update->nrecs == 2 && recs[1] < recs[0]) {
+        uint64_t tmp;
+
+        tmp       = recs[0];
+        recs[0]   = recs[1];
+        recs[1]   = tmp;
+        tmp       = starts[0];
+        starts[0] = starts[1];
+        starts[1] = tmp;
+        tmp       = ends[0];
+        ends[0]   = ends[1];
+        ends[1]   = tmp;
+    } /* end if */
+
+    /* Encode the records */
+    p = update->recs_buf;
+    for (i = 0; i < update->nrecs; i++) {
+        update->recxs[i].rx_idx = recs[i];
+        update->recxs[i].rx_nr  = 1;
+        UINT64ENCODE(p, starts[i]);
+        UINT64ENCODE(p, ends[i]);
+    } /* end for */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_holes_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_compact_needed
+ *
+ * Purpose:     Determines whether a sparse creation order index that
+ *              will hold nobjs entries should be compacted, which is the
+ *              case once more than 1/H5_DAOS_CORDER_COMPACT_DIV of its
+ *              slots are holes.  The index's slots are those below
+ *              max_corder - slot_base, i.e. max_corder until the index
+ *              is first compacted.
+ *
+ * Return:      TRUE if the index should be compacted, FALSE otherwise
+ *              (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5_daos_corder_compact_needed(const H5_daos_corder_info_t *corder_info, uint64_t nobjs)
+{
+    uint64_t nslots;
+
+    assert(corder_info);
+    assert(corder_info->sparse);
+    assert(corder_info->max_corder >= corder_info->slot_base);
+
+    nslots = corder_info->max_corder - corder_info->slot_base;
+    assert(nobjs <= nslots);
+
+    return (nslots - nobjs) > nslots / H5_DAOS_CORDER_COMPACT_DIV;
+} /* end H5_daos_corder_compact_needed() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_get_slots
+ *
+ * Purpose:     Fills slots with the nslots slots of a sparse creation
+ *              order index that hold entries, in increasing order,
+ *              skipping the index's hole ranges and skip_slot (the slot
+ *              of an entry being deleted, if it has not been added to
+ *              the holes).  The hole ranges must have been retrieved if
+ *              corder_info->nholes is nonzero.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_corder_get_slots(const H5_daos_corder_info_t *corder_info, uint64_t skip_slot, uint64_t *slots,
+                         size_t nslots)
+{
+    uint64_t end;
+    uint64_t slot;
+    uint64_t hole      = 0;
+    size_t   i         = 0;
+    herr_t   ret_value = SUCCEED;
+
+    assert(corder_info);
+    assert(corder_info->sparse);
+    assert(corder_info->nholes == 0 || corder_info->holes);
+    assert(slots || nslots == 0);
+
+    end = corder_info->max_corder - corder_info->slot_base;
+    for (slot = 0; slot < end; slot++) {
+        /* Jump over hole ranges */
+        if (hole < corder_info->nholes && slot == corder_info->holes[hole].start) {
+            slot = corder_info->holes[hole++].end - 1;
+            continue;
+        } /* end if */
+        if (slot == skip_slot)
+            continue;
+
+        if (i == nslots)
+            D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL,
+                         "creation order index has more entries than expected");
+        slots[i++] = slot;
+    } /* end for */
+
+    if (i != nslots)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "creation order index has fewer entries than expected");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_get_slots() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_fmt_encode
+ *
+ * Purpose:     Encodes the format record of a sparse creation order
+ *              index with the given slot base and compaction mark into
+ *              buf, which must hold H5_DAOS_ENCODED_CORDER_FMT_SIZE
+ *              bytes.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_corder_fmt_encode(uint8_t *buf, uint64_t slot_base, uint64_t compact_mark)
+{
+    uint64_t fmt = H5_DAOS_CORDER_FMT_SPARSE;
+
+    assert(buf);
+    assert(slot_base <= compact_mark);
+
+    UINT64ENCODE(buf, fmt);
+    UINT64ENCODE(buf, slot_base);
+    UINT64ENCODE(buf, compact_mark);
+} /* end H5_daos_corder_fmt_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_fmt_decode
+ *
+ * Purpose:     Decodes a creation order index format record from buf
+ *              into corder_info.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_corder_fmt_decode(const uint8_t *buf, H5_daos_corder_info_t *corder_info)
+{
+    uint64_t fmt;
+    herr_t   ret_value = SUCCEED;
+
+    assert(buf);
+    assert(corder_info);
+
+    UINT64DECODE(buf, fmt);
+    if (fmt != H5_DAOS_CORDER_FMT_SPARSE)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_UNSUPPORTED, FAIL, "unknown creation order index format %llu",
+                     (unsigned long long)fmt);
+    UINT64DECODE(buf, corder_info->slot_base);
+    UINT64DECODE(buf, corder_info->compact_mark);
+    if (corder_info->slot_base > corder_info->compact_mark)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "creation order index slot base is invalid");
+    corder_info->sparse = TRUE;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_fmt_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_cache_append
+ *
+ * Purpose:     Appends a copy of the given name to the end of a name
+ *              cache that is being built.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_name_cache_append(H5_daos_name_cache_t *cache, const char *name)
+{
+    size_t name_len;
+    herr_t ret_value = SUCCEED;
+
+    assert(cache);
+    assert(name);
+
+    name_len = strlen(name);
+
+    /* Extend name offset array if necessary */
+    if (cache->nnames == cache->name_offs_nalloc) {
+        size_t  new_nalloc = cache->name_offs_nalloc ? 2 * cache->name_offs_nalloc : 16;
+        size_t *tmp_realloc;
+
+        if (NULL == (tmp_realloc = (size_t *)DV_realloc(cache->name_offs, new_nalloc * sizeof(size_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate name cache offset array");
+        cache->name_offs        = tmp_realloc;
+        cache->name_offs_nalloc = new_nalloc;
+    } /* end if */
+
+    /* Extend name buffer if necessary */
+    if (cache->names_buf_len + name_len + 1 > cache->names_buf_nalloc) {
+        size_t new_nalloc = cache->names_buf_nalloc ? 2 * cache->names_buf_nalloc : 256;
+        char  *tmp_realloc;
+
+        while (cache->names_buf_len + name_len + 1 > new_nalloc)
+            new_nalloc *= 2;
+        if (NULL == (tmp_realloc = (char *)DV_realloc(cache->names_buf, new_nalloc)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate name cache buffer");
+        cache->names_buf        = tmp_realloc;
+        cache->names_buf_nalloc = new_nalloc;
+    } /* end if */
+
+    /* Add name */
+    cache->name_offs[cache->nnames++] = cache->names_buf_len;
+    memcpy(cache->names_buf + cache->names_buf_len, name, name_len + 1);
+    cache->names_buf_len += name_len + 1;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_name_cache_append() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_cache_install
+ *
+ * Purpose:     Replaces the contents of a name cache with a newly built
+ *              name list, taking ownership of the built list's buffers.
+ *              build_gen must be the file's modification generation
+ *              counter as read before the names were enumerated, so the
+ *              cache is automatically invalid if the object was modified
+ *              while it was being built.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_name_cache_install(H5_daos_name_cache_t *cache, H5_daos_name_cache_t *built, uint64_t build_gen)
+{
+    assert(cache);
+    assert(built);
+
+    H5_daos_name_cache_free(cache);
+
+    *cache       = *built;
+    cache->valid = TRUE;
+    cache->gen   = build_gen;
+
+    memset(built, 0, sizeof(*built));
+} /* end H5_daos_name_cache_install() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_cache_lookup
+ *
+ * Purpose:     Retrieves the name at index idx in a name cache, if the
+ *              cache is valid for the file's current modification
+ *              generation counter cur_gen.  The name is copied to
+ *              name_out (truncated and null terminated if it doesn't fit,
+ *              like the other "get name" routines) and its length is
+ *              returned in *name_len.
+ *
+ * Return:      Success:        TRUE if the name was found in the cache,
+ *                              FALSE if the cache is not valid
+ *              Failure:        FAIL (index out of range)
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5_daos_name_cache_lookup(const H5_daos_name_cache_t *cache, uint64_t cur_gen, uint64_t idx, char *name_out,
+                          size_t name_out_size, size_t *name_len)
+{
+    const char *name;
+    htri_t      ret_value = TRUE;
+
+    assert(cache);
+    assert(name_len);
+
+    if (!cache->valid || cache->gen != cur_gen)
+        D_GOTO_DONE(FALSE);
+
+    if (idx >= (uint64_t)cache->nnames)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, FAIL, "index value out of range");
+
+    name      = cache->names_buf + cache->name_offs[idx];
+    *name_len = strlen(name);
+    if (name_out && name_out_size > 0) {
+        size_t copy_len = MIN(*name_len, name_out_size - 1);
+
+        memcpy(name_out, name, copy_len);
+        name_out[copy_len] = '\0';
+    } /* end if */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_name_cache_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_cache_free
+ *
+ * Purpose:     Frees the buffers held by a name cache and marks it
+ *              invalid.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_name_cache_free(H5_daos_name_cache_t *cache)
+{
+    assert(cache);
+
+    cache->name_offs = DV_free(cache->name_offs);
+    cache->names_buf = DV_free(cache->names_buf);
+    memset(cache, 0, sizeof(*cache));
+} /* end H5_daos_name_cache_free() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_object_update_num_attrs_key
  *
@@ -5618,12 +6595,15 @@ done:
 static int
 H5_daos_obj_write_rc_task(tse_task_t *task)
 {
-    H5_daos_obj_rw_rc_ud_t *udata;
-    H5_daos_req_t          *req = NULL;
-    uint64_t                cur_rc;
-    uint64_t                new_rc;
-    int                     ret;
-    int                     ret_value = 0;
+    H5_daos_obj_rw_rc_ud_t  *udata;
+    H5_daos_generic_cb_ud_t *data_punch_udata     = NULL;
+    tse_task_t              *data_punch_task      = NULL;
+    hbool_t                  data_punch_scheduled = FALSE;
+    H5_daos_req_t           *req                  = NULL;
+    uint64_t                 cur_rc;
+    uint64_t                 new_rc;
+    int                      ret;
+    int                      ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
@@ -5654,9 +6634,48 @@ H5_daos_obj_write_rc_task(tse_task_t *task)
         tse_task_t       *punch_task;
         daos_obj_punch_t *punch_args;
 
+        /* Maps with native uint64 dkeys keep their key-value pairs in a
+         * separate object, punch it first */
+        if ((*udata->obj_p)->item.type == H5I_MAP && ((H5_daos_map_t *)*udata->obj_p)->dkey_uint64) {
+            if (NULL == (data_punch_udata =
+                             (H5_daos_generic_cb_ud_t *)DV_malloc(sizeof(H5_daos_generic_cb_ud_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                             "can't allocate user data for map data object punch task");
+            data_punch_udata->req       = req;
+            data_punch_udata->task_name = "map data object punch due to ref count dropping to 0";
+
+            /* Create task for data object punch */
+            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_PUNCH, 0, NULL, NULL, H5_daos_generic_comp_cb,
+                                         data_punch_udata, &data_punch_task) < 0)
+                D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create task to delete map data object");
+
+            /* The task now owns data_punch_udata, give it a reference to req.
+             * If it cannot be scheduled it is completed with the error below,
+             * which releases both. */
+            req->rc++;
+            data_punch_udata = NULL;
+
+            /* Set punch task arguments */
+            if (NULL == (punch_args = daos_task_get_args(data_punch_task)))
+                D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                             "can't get arguments for map data object punch task");
+            memset(punch_args, 0, sizeof(*punch_args));
+            punch_args->oh = ((H5_daos_map_t *)*udata->obj_p)->data_oh;
+            punch_args->th = req->th;
+
+            /* Schedule data object punch task */
+            if (0 != (ret = tse_task_schedule(data_punch_task, false)))
+                D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, ret,
+                             "can't schedule task for map data object delete: %s",
+                             H5_daos_err_to_string(ret));
+            data_punch_scheduled = TRUE;
+        } /* end if */
+
         /* Create task for object punch */
-        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_PUNCH, 0, NULL, NULL, H5_daos_obj_write_rc_comp_cb, udata,
-                                     &punch_task) < 0)
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_PUNCH, data_punch_task ? 1 : 0,
+                                     data_punch_task ? &data_punch_task : NULL, NULL,
+                                     H5_daos_obj_write_rc_comp_cb, udata, &punch_task) < 0)
             D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
                          "can't create task to delete object");
 
@@ -5741,11 +6760,20 @@ done:
         } /* end if */
     }     /* end if */
 
+    /* Complete the map data object punch task if it was never scheduled.
+     * Its completion callback releases its user data and reference to
+     * req. */
+    if (data_punch_task && !data_punch_scheduled) {
+        assert(ret_value < 0);
+        tse_task_complete(data_punch_task, ret_value);
+    } /* end if */
+
     /* Release req */
     if (req && H5_daos_req_free_int(req) < 0)
         D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
     /* Cleanup */
+    data_punch_udata = DV_free(data_punch_udata);
     if (udata) {
         assert(ret_value < 0);
 
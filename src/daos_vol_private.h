@@ -27,6 +27,7 @@
 /* System headers */
 #include <assert.h>
 #include <errno.h>
+#include <pthread.h>
 
 /* Hash table */
 #include "util/daos_vol_hash_table.h"
@@ -34,6 +35,9 @@
 /* Task list */
 #include "util/daos_vol_task_list.h"
 
+/* Free lists */
+#include "util/daos_vol_free_list.h"
+
 /* For DAOS compatibility */
 typedef d_iov_t     daos_iov_t;
 typedef d_sg_list_t daos_sg_list_t;
@@ -151,6 +155,7 @@ typedef d_sg_list_t daos_sg_list_t;
 #define H5_DAOS_SEQ_LIST_LEN       128
 #define H5_DAOS_ITER_LEN           128
 #define H5_DAOS_ITER_SIZE_INIT     (4 * 1024)
+#define H5_DAOS_VISIT_WINDOW       16
 #define H5_DAOS_ATTR_NUM_AKEYS     5
 #define H5_DAOS_ATTR_NAME_BUF_SIZE 2048
 #define H5_DAOS_POINT_BUF_LEN      128
@@ -174,6 +179,20 @@ typedef d_sg_list_t daos_sg_list_t;
 /* Size of buffer for writing link creation order info */
 #define H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)
 
+/* Size of an encoded creation order index hole range ([start, end) pair) */
+#define H5_DAOS_ENCODED_CORDER_HOLE_SIZE (2 * H5_DAOS_ENCODED_CRT_ORDER_SIZE)
+
+/* Size of an encoded creation order index format record (format, slot base
+ * and compaction mark) */
+#define H5_DAOS_ENCODED_CORDER_FMT_SIZE (3 * H5_DAOS_ENCODED_UINT64_T_SIZE)
+
+/* Creation order index format stored in the format record */
+#define H5_DAOS_CORDER_FMT_SPARSE 1
+
+/* A sparse creation order index is compacted once more than
+ * 1/H5_DAOS_CORDER_COMPACT_DIV of its slots are holes */
+#define H5_DAOS_CORDER_COMPACT_DIV 2
+
 /* Definitions for building oids */
 #define H5_DAOS_TYPE_MASK  0x00000000c0000000ull
 #define H5_DAOS_TYPE_GRP   0x0000000000000000ull
@@ -181,6 +200,15 @@ typedef d_sg_list_t daos_sg_list_t;
 #define H5_DAOS_TYPE_DTYPE 0x0000000080000000ull
 #define H5_DAOS_TYPE_MAP   0x00000000c0000000ull
 
+/* Flags set in oid.hi (below the type bits) of a map that keeps its
+ * key-value pairs in a separate data object with native uint64 dkeys, and
+ * of that data object */
+#define H5_DAOS_MAP_DKEY_UINT64 0x0000000020000000ull
+#define H5_DAOS_MAP_DATA_OBJ    0x0000000010000000ull
+
+/* Flag set in oid.hi of a map that stores its values out of line */
+#define H5_DAOS_MAP_LARGE_VALS 0x0000000008000000ull
+
 /* Predefined object indices */
 #define H5_DAOS_OIDX_GMD        0ull
 #define H5_DAOS_OIDX_ROOT       1ull
@@ -190,13 +218,60 @@ typedef d_sg_list_t daos_sg_list_t;
 #define H5_DAOS_ADDR_OIDLO_MASK 0x000000003fffffffll
 #define H5_DAOS_ADDR_OIDHI_MASK 0xffffffffc0000000ll
 
-/* Number of object indices to allocate at a time */
-#define H5_DAOS_OIDX_NALLOC 1024
+/* Initial number of object indices to allocate at a time.  Each time a
+ * block is used up the next allocation doubles, up to
+ * H5_DAOS_OIDX_NALLOC_MAX */
+#define H5_DAOS_OIDX_NALLOC     1024
+#define H5_DAOS_OIDX_NALLOC_MAX (1024 * 1024)
+
+/* Maximum number of extra bytes to receive with the first broadcast of
+ * object info on open, in case rank 0 needs to send more than fits in the
+ * fixed size first broadcast.  See H5_daos_mpi_ibcast_task(). */
+#define H5_DAOS_BCAST_PREFETCH_MAX (64 * 1024)
+
+/* Size of each of the two slots in a node's shared memory window used for
+ * node-local broadcasts.  Larger broadcasts are sent within the node with
+ * MPI_Ibcast instead.  See H5daos_set_node_local_bcast(). */
+#define H5_DAOS_NODE_BCAST_SLOT_SIZE (256 * 1024)
+
+/* Coalesced broadcasts (see H5_daos_bcast_stream_t).  Broadcasts of up to
+ * H5_DAOS_BCAST_COALESCE_MAX bytes are coalesced.  Frames are received with
+ * a broadcast of H5_DAOS_BCAST_FRAME_SIZE bytes, followed by a second
+ * broadcast of the rest of longer frames, and rank 0 sends a frame without
+ * waiting for the next progress tick once H5_DAOS_BCAST_FRAME_MAX bytes of
+ * data are queued.  A frame starts with a header holding its length and
+ * number of entries, followed by a descriptor holding the lane index and
+ * size of each entry, then the data of all entries. */
+#define H5_DAOS_BCAST_COALESCE_MAX    (64 * 1024)
+#define H5_DAOS_BCAST_FRAME_SIZE      (16 * 1024)
+#define H5_DAOS_BCAST_FRAME_MAX       (256 * 1024)
+#define H5_DAOS_BCAST_FRAME_HDR_SIZE  (2 * H5_DAOS_ENCODED_UINT64_T_SIZE)
+#define H5_DAOS_BCAST_FRAME_DESC_SIZE (2 * H5_DAOS_ENCODED_UINT64_T_SIZE)
 
 /* Polling interval (in milliseconds) when waiting for asynchronous tasks to
  * finish */
 #define H5_DAOS_ASYNC_POLL_INTERVAL 1
 
+/* Number of times to make progress without blocking, and the longest
+ * interval (in the same units as H5_DAOS_ASYNC_POLL_INTERVAL) to block for,
+ * when waiting with H5_DAOS_WAIT_ADAPTIVE.  See H5_daos_progress(). */
+#define H5_DAOS_WAIT_SPIN_COUNT   64
+#define H5_DAOS_WAIT_MAX_INTERVAL 64
+
+/* Initial and longest interval (in microseconds) between attempts by the
+ * background progress thread to make progress while operations are in
+ * flight.  The thread blocks without a timeout while there are none.  See
+ * H5_daos_progress_thread_func(). */
+#define H5_DAOS_PROGRESS_THREAD_INTERVAL     1000
+#define H5_DAOS_PROGRESS_THREAD_MAX_INTERVAL 64000
+
+/* Default budgets for the number of small and bulk raw data I/O tasks in
+ * flight at once, and the largest raw data I/O (in bytes) considered small.
+ * See H5_daos_io_budget_acquire(). */
+#define H5_DAOS_SMALL_IO_BUDGET_DEF 256
+#define H5_DAOS_BULK_IO_BUDGET_DEF  32
+#define H5_DAOS_SMALL_IO_MAX        ((size_t)(64 * 1024))
+
 /* Predefined timeouts for different modes in which to make progress using
  * H5_daos_progress */
 #define H5_DAOS_PROGRESS_KICK (uint64_t)0
@@ -293,6 +368,43 @@ typedef d_sg_list_t daos_sg_list_t;
 /* Property to specify independent metadata I/O */
 #define H5_DAOS_IND_MD_IO_PROP_NAME "h5daos_independent_md_writes"
 
+/* Property to allow recursive visits to make callbacks out of order */
+#define H5_DAOS_UNORDERED_VISIT_PROP_NAME "h5daos_unordered_visit"
+
+/* Property to specify the number of object indices to reserve up front */
+#define H5_DAOS_OIDX_PREALLOC_PROP_NAME "h5daos_oidx_prealloc"
+
+/* Property to route broadcasts through node leaders and shared memory */
+#define H5_DAOS_NODE_LOCAL_BCAST_PROP_NAME "h5daos_node_local_bcast"
+
+/* Property to specify the number of collective error checks to batch */
+#define H5_DAOS_COLL_ERR_BATCH_PROP_NAME "h5daos_coll_err_batch"
+
+/* Property to specify the number of collective lanes on a file */
+#define H5_DAOS_COLL_LANES_PROP_NAME "h5daos_coll_lanes"
+
+/* Property to coalesce broadcasts from different collective lanes */
+#define H5_DAOS_BCAST_COALESCE_PROP_NAME "h5daos_bcast_coalesce"
+
+/* Property to specify the policy for waiting on asynchronous operations */
+#define H5_DAOS_WAIT_MODE_PROP_NAME "h5daos_wait_mode"
+
+/* Property to specify the size in bits of a map's Bloom filter */
+#define H5_DAOS_MAP_BLOOM_PROP_NAME "h5daos_map_bloom_filter"
+
+/* Largest allowed map Bloom filter, in bits (64 MiB) */
+#define H5_DAOS_MAP_BLOOM_MAX_BITS ((uint64_t)1 << 29)
+
+/* Number of bits set in a map's Bloom filter for each key */
+#define H5_DAOS_MAP_BLOOM_NHASH 6
+
+/* Property to specify the value size above which a map stores its values out
+ * of line */
+#define H5_DAOS_MAP_LARGE_VAL_PROP_NAME "h5daos_map_large_value_threshold"
+
+/* Default value size above which maps store their values out of line (1 MiB) */
+#define H5_DAOS_MAP_LARGE_VAL_THRESHOLD_DEFAULT ((size_t)1 << 20)
+
 /* DSINC - There are serious problems in HDF5 when trying to call
  * H5Pregister2/H5Punregister on the H5P_FILE_ACCESS class.
  */
@@ -496,21 +608,151 @@ typedef struct H5_daos_ocpl_cache_t {
     hbool_t track_acorder;
 } H5_daos_ocpl_cache_t;
 
+/* Cached list of link or attribute names in name order, used to answer
+ * by-index name order queries without enumerating the object's keys each
+ * time.  The cache is only valid while gen matches the file's matching
+ * modification generation counter. */
+typedef struct H5_daos_name_cache_t {
+    hbool_t  valid;
+    uint64_t gen;
+    size_t   nnames;
+    size_t   name_offs_nalloc;
+    size_t  *name_offs;
+    size_t   names_buf_len;
+    size_t   names_buf_nalloc;
+    char    *names_buf;
+} H5_daos_name_cache_t;
+
 /* Common object information */
 typedef struct H5_daos_obj_t {
     H5_daos_item_t       item; /* Must be first */
     daos_obj_id_t        oid;
     daos_handle_t        obj_oh;
     H5_daos_ocpl_cache_t ocpl_cache;
+    H5_daos_name_cache_t attr_name_cache;
 } H5_daos_obj_t;
 
 /* The FAPL cache struct */
 typedef struct H5_daos_fapl_cache_t {
-    daos_oclass_id_t default_object_class;
-    hbool_t          is_collective_md_read;
-    hbool_t          is_collective_md_write;
+    daos_oclass_id_t    default_object_class;
+    hbool_t             is_collective_md_read;
+    hbool_t             is_collective_md_write;
+    hbool_t             unordered_visit;
+    uint64_t            oidx_prealloc;
+    hbool_t             node_local_bcast;
+    unsigned            coll_err_batch;
+    unsigned            coll_lanes;
+    hbool_t             bcast_coalesce;
+    H5_daos_wait_mode_t wait_mode;
 } H5_daos_fapl_cache_t;
 
+/* Communicators and shared memory used for node-local broadcasts in a
+ * collective lane of a file.  Broadcasts from rank 0 are sent to rank 0 on
+ * each node (the node leader) over leader_comm, then copied by the leader
+ * into one of two slots in shm, which the other ranks on the node read after
+ * a barrier on comm.  comm is MPI_COMM_NULL if node-local broadcasts are not
+ * in use. */
+typedef struct H5_daos_node_bcast_t {
+    MPI_Comm comm;
+    MPI_Comm leader_comm;
+    MPI_Win  win;
+    uint8_t *shm;
+    int      rank;
+    int      nleaders;
+    uint64_t nbcast;
+} H5_daos_node_bcast_t;
+
+/* A broadcast in the coalesced broadcast stream of a file, on a rank other
+ * than rank 0.  Either a broadcast waiting for its data, with task and
+ * bcast_ud set, or data received before the broadcast it belongs to started,
+ * in buf.  prefetch_copy has the same meaning as for broadcasts in the MPI
+ * request table. */
+typedef struct H5_daos_bcast_entry_t {
+    tse_task_t                     *task;
+    struct H5_daos_mpi_ibcast_ud_t *bcast_ud;
+    uint8_t                        *buf;
+    int                             count;
+    hbool_t                         prefetch_copy;
+    struct H5_daos_bcast_entry_t   *next;
+} H5_daos_bcast_entry_t;
+
+/* A collective lane of a file.  Collective requests on a file are assigned
+ * to its lanes in turn, in the order they are enqueued, which is the same on
+ * all ranks.  Each lane has its own duplicate of the file's communicator, so
+ * the MPI operations of requests in different lanes are never matched with
+ * each other and may be in flight at once.  Requests in the same lane run
+ * one after another, through req_tail.  State that collective requests
+ * update identically on all ranks, and which therefore relies on them
+ * running in the same order on all ranks, is kept per lane: the collective
+ * object index allocation, the broadcast prefetch buffer (see
+ * H5_daos_mpi_ibcast_task()) and the node-local broadcast slots.  The
+ * lane's coalesced broadcasts waiting for data and received data not yet
+ * wanted are kept in order in bcast_waiting and bcast_recvd. */
+typedef struct H5_daos_coll_lane_t {
+    MPI_Comm               comm;
+    H5_daos_node_bcast_t   node_bcast;
+    struct H5_daos_req_t  *req_tail;
+    uint64_t               next_oidx;
+    uint64_t               max_oidx;
+    uint64_t               oidx_nalloc;
+    uint8_t               *bcast_prefetch_buf;
+    int                    bcast_prefetch_len;
+    int                    bcast_prefetch_count;
+    int                    bcast_prefetch_ext;
+    uint64_t               bcast_prefetch_id;
+    H5_daos_bcast_entry_t *bcast_waiting_head;
+    H5_daos_bcast_entry_t *bcast_waiting_tail;
+    H5_daos_bcast_entry_t *bcast_recvd_head;
+    H5_daos_bcast_entry_t *bcast_recvd_tail;
+} H5_daos_coll_lane_t;
+
+/* Coalesced broadcast stream of a file.  Rank 0 queues the data of small
+ * broadcasts made in any of the file's collective lanes, and once per
+ * progress tick sends all data queued on the file as one frame, broadcast
+ * on comm (see H5_DAOS_BCAST_FRAME_SIZE for the frame format).  out_desc
+ * and out_data hold the descriptors and data of the out_nentries queued
+ * entries, and queued streams are linked through next_queued.  The
+ * broadcasts of sent frames and their buffers are kept in sent_reqs and
+ * sent_bufs until they complete.  The other ranks keep one frame broadcast
+ * (into in_buf) posted while any of the file's broadcasts waits for data,
+ * and pass each entry of a received frame to the next waiting broadcast of
+ * its lane.  Since every rank makes the same broadcasts in each lane, every
+ * frame sent is received.  comm is MPI_COMM_NULL if broadcasts are not
+ * coalesced. */
+typedef struct H5_daos_bcast_stream_t {
+    MPI_Comm                       comm;
+    struct H5_daos_file_t         *file;
+    uint8_t                       *out_desc;
+    uint8_t                       *out_data;
+    size_t                         out_desc_alloc;
+    size_t                         out_data_len;
+    size_t                         out_data_alloc;
+    unsigned                       out_nentries;
+    hbool_t                        queued;
+    struct H5_daos_bcast_stream_t *next_queued;
+    MPI_Request                   *sent_reqs;
+    uint8_t                      **sent_bufs;
+    int                            nsent;
+    int                            sent_alloc;
+    uint8_t                       *in_buf;
+    size_t                         in_alloc;
+    hbool_t                        in_posted;
+    unsigned                       nwaiting;
+} H5_daos_bcast_stream_t;
+
+/* Deferred collective error checks on a file.  Requests whose collective
+ * error check was deferred are added to the list from head to tail when
+ * they finalize, and are all checked with a single MPI_Iallreduce by the
+ * next flush request.  nqueued counts deferred requests enqueued since the
+ * last flush request was enqueued, and flush_gen counts flush requests. */
+typedef struct H5_daos_coll_err_batch_t {
+    struct H5_daos_req_t *head;
+    struct H5_daos_req_t *tail;
+    int                   nreqs;
+    unsigned              nqueued;
+    uint64_t              flush_gen;
+} H5_daos_coll_err_batch_t;
+
 /* Structure for caching the default values
  * for various properties in HDF5's default
  * property lists */
@@ -591,8 +833,14 @@ typedef struct H5_daos_file_t {
     int                       num_procs;
     uint64_t                  next_oidx;
     uint64_t                  max_oidx;
-    uint64_t                  next_oidx_collective;
-    uint64_t                  max_oidx_collective;
+    uint64_t                  oidx_nalloc;
+    uint64_t                  link_mod_gen;
+    uint64_t                  attr_mod_gen;
+    H5_daos_coll_lane_t      *coll_lanes;
+    unsigned                  ncoll_lanes;
+    uint64_t                  coll_seq;
+    H5_daos_bcast_stream_t    bcast_stream;
+    H5_daos_coll_err_batch_t  coll_err_batch;
 } H5_daos_file_t;
 
 /* The GCPL cache struct */
@@ -606,6 +854,7 @@ typedef struct H5_daos_group_t {
     hid_t                gcpl_id;
     hid_t                gapl_id;
     H5_daos_gcpl_cache_t gcpl_cache;
+    H5_daos_name_cache_t link_name_cache;
 } H5_daos_group_t;
 
 /* Different algorithms for handling fill values on dataset reads */
@@ -669,6 +918,34 @@ typedef struct H5_daos_dtype_t {
     hid_t         tapl_id;
 } H5_daos_dtype_t;
 
+/* How keys in a given memory datatype are converted to a map's dkey
+ * datatype */
+typedef enum H5_daos_map_key_conv_kind_t {
+    H5_DAOS_MAP_KEY_CONV_NONE,     /* Key used as is */
+    H5_DAOS_MAP_KEY_CONV_FIXED,    /* Fixed-size key converted with H5Tconvert */
+    H5_DAOS_MAP_KEY_CONV_VL_STR,   /* Variable-length string key used as is */
+    H5_DAOS_MAP_KEY_CONV_VLEN,     /* Vlen key whose elements are used as is */
+    H5_DAOS_MAP_KEY_CONV_VLEN_ELEM /* Vlen key whose elements are converted with H5Tconvert */
+} H5_daos_map_key_conv_kind_t;
+
+/* Key conversion plan for the memory datatype most recently used for keys
+ * with a map, so the conversion need not be worked out on every operation.
+ * mem_type_id is a private copy of that datatype, so the application's ID
+ * is not held open by the map. */
+typedef struct H5_daos_map_key_conv_cache_t {
+    hid_t                       mem_type_id; /* H5I_INVALID_HID if no plan is cached */
+    H5_daos_map_key_conv_kind_t kind;
+    size_t                      mem_size;  /* Size of a key (or vlen element) in memory */
+    size_t                      dkey_size; /* Size of a key (or vlen element) in the dkey */
+    htri_t                      need_bkg;
+    hid_t                       mem_parent_type_id;  /* Vlen element memory type, for VLEN_ELEM */
+    hid_t                       dkey_parent_type_id; /* Vlen element dkey type, for VLEN_ELEM */
+} H5_daos_map_key_conv_cache_t;
+
+/* State shared by the handles open on a map in this process, defined in
+ * daos_vol_map.c */
+typedef struct H5_daos_map_shared_t H5_daos_map_shared_t;
+
 /* The map struct */
 typedef struct H5_daos_map_t {
     H5_daos_obj_t obj; /* Must be first */
@@ -676,12 +953,30 @@ typedef struct H5_daos_map_t {
     size_t        val_file_type_size;
     hid_t         key_type_id;
     hid_t         key_file_type_id;
+    hid_t         key_dkey_type_id; /* Type keys are converted to for dkeys.  Not a separate reference. */
     hid_t         val_type_id;
     hid_t         val_file_type_id;
     hid_t         mcpl_id;
     hid_t         mapl_id;
+    uint64_t      bloom_size;  /* Size of the map's Bloom filter in bytes, 0 if the map has none */
+    hbool_t       dkey_uint64; /* Whether key-value pairs are kept in data_oh under native uint64 dkeys */
+    daos_obj_id_t data_oid;    /* OID of the key-value pair data object, if dkey_uint64 */
+    daos_handle_t data_oh;     /* Open handle to the key-value pair data object, if dkey_uint64 */
+    hbool_t       large_vals;  /* Whether values are stored out of line as byte arrays */
+
+    /* Conversion plan for keys in the last key memory datatype used */
+    H5_daos_map_key_conv_cache_t key_conv_cache;
+
+    /* State shared by all handles open on the map in this process, such as
+     * the map's Bloom filter and the changes to its entry count not yet
+     * synced.  NULL until the map is open. */
+    H5_daos_map_shared_t *shared;
+    struct H5_daos_map_t *shared_next; /* Next handle attached to shared */
 } H5_daos_map_t;
 
+/* DAOS object handle holding the key-value pairs of a map */
+#define H5_DAOS_MAP_DATA_OH(map) ((map)->dkey_uint64 ? (map)->data_oh : (map)->obj.obj_oh)
+
 /* The attribute struct */
 typedef struct H5_daos_attr_t {
     H5_daos_item_t item; /* Must be first */
@@ -715,18 +1010,37 @@ typedef enum {
 /* Enum type for distinguishing between I/O reads and writes. */
 typedef enum H5_daos_io_type_t { IO_READ, IO_WRITE } H5_daos_io_type_t;
 
+/* Priority classes for DAOS tasks.  Metadata tasks are never held back,
+ * while small and bulk raw data I/O tasks each have their own budget of
+ * tasks in flight, so metadata and small I/O are not queued behind large
+ * amounts of bulk I/O. */
+typedef enum H5_daos_io_class_t {
+    H5_DAOS_IO_CLASS_META,
+    H5_DAOS_IO_CLASS_SMALL,
+    H5_DAOS_IO_CLASS_BULK,
+    H5_DAOS_IO_CLASS_NCLASSES
+} H5_daos_io_class_t;
+
+/* Priority class for raw data I/O of nbytes bytes */
+#define H5_DAOS_IO_CLASS(nbytes)                                                                             \
+    ((nbytes) <= H5_DAOS_SMALL_IO_MAX ? H5_DAOS_IO_CLASS_SMALL : H5_DAOS_IO_CLASS_BULK)
+
 /* Forward declaration for generic request struct */
 typedef struct H5_daos_req_t H5_daos_req_t;
 
-/* Task user data for asynchronous MPI broadcast */
+/* Task user data for asynchronous MPI broadcast.  The broadcast is made in
+ * the collective lane of req, which is set in lane when the broadcast
+ * starts. */
 typedef struct H5_daos_mpi_ibcast_ud_t {
-    H5_daos_req_t *req;
-    H5_daos_obj_t *obj;
-    tse_task_t    *bcast_metatask;
-    void          *buffer;
-    int            buffer_len;
-    int            count;
-    MPI_Comm       comm;
+    H5_daos_req_t       *req;
+    H5_daos_obj_t       *obj;
+    tse_task_t          *bcast_metatask;
+    void                *buffer;
+    int                  buffer_len;
+    int                  count;
+    H5_daos_coll_lane_t *lane;
+    hbool_t              prefetch;
+    uint64_t             prefetch_id;
 } H5_daos_mpi_ibcast_ud_t;
 
 /* Task user data for asynchronous MPI broadcast (with flexible array member) */
@@ -753,9 +1067,30 @@ struct H5_daos_req_t {
     const char           *failed_task;
     const char           *op_name;
     hbool_t               in_progress;
+    /* Whether the request can be canceled after it starts.  Only set for
+     * read-only and raw data requests, which cannot leave a metadata update
+     * half done. */
+    hbool_t cancel_in_flight;
     struct {
         H5_daos_mpi_ibcast_ud_t err_check_ud;
         int                     coll_status;
+        hbool_t                 chained;
+        hbool_t                 deferred;
+        hbool_t                 ordered;
+        hbool_t                 pending;
+        uint64_t                flush_gen;
+        H5_daos_req_t          *next_deferred;
+        /* The collective lane of the request and its position in the
+         * order collective requests were assigned to lanes in.  Requests
+         * nested in another operation share its lane and seq, and are
+         * numbered after it by sub_seq (nsub counts them).  A barrier
+         * request waits for the requests in all lanes, and all later
+         * requests wait for it. */
+        H5_daos_coll_lane_t *lane;
+        uint64_t             seq;
+        uint64_t             sub_seq;
+        uint64_t             nsub;
+        hbool_t              barrier;
     } collective;
 };
 
@@ -812,15 +1147,66 @@ typedef struct H5_daos_md_rw_cb_ud_t {
     daos_key_t     dkey;
     unsigned       nr;
     uint64_t       flags;
-    daos_iod_t     iod[7];
-    daos_sg_list_t sgl[7];
-    daos_iov_t     sg_iov[7];
+    daos_iod_t     iod[8];
+    daos_sg_list_t sgl[8];
+    daos_iov_t     sg_iov[8];
     hbool_t        free_dkey;
     hbool_t        free_akeys;
-    hbool_t        free_sg_iov[7];
+    hbool_t        free_sg_iov[8];
     const char    *task_name;
 } H5_daos_md_rw_cb_ud_t;
 
+/* A hole range of a sparse creation order index, decoded.  skip is the total
+ * number of slots in this range and all ranges before it, rec is the record
+ * holding the range in the index's holes akey. */
+typedef struct H5_daos_corder_hole_t {
+    uint64_t start;
+    uint64_t end;
+    uint64_t skip;
+    uint64_t rec;
+} H5_daos_corder_hole_t;
+
+/* Information about a link or attribute creation order index.  Indices
+ * started by this version of the connector are "sparse", which is recorded
+ * in the index's format record when its first entry is added.  A deletion
+ * from a sparse index leaves the other entries in place and records the
+ * unused slot in a list of [start, end) hole ranges, so deletions don't
+ * need to shift the rest of the index.  The ranges are stored unordered as
+ * an array of records so a deletion only rewrites the (at most two) records
+ * it changes, and are sorted by start when read.  Adjacent ranges are
+ * always merged, so an index never has more than nobjs + 1 ranges.
+ *
+ * An entry added to a sparse index is placed in slot corder - slot_base.
+ * Once more than 1/H5_DAOS_CORDER_COMPACT_DIV of the slots are holes the
+ * index is compacted: the entries are moved to slots 0 through nobjs - 1,
+ * the holes are cleared, compact_mark is set to max_corder and slot_base
+ * to max_corder - nobjs.  Each entry moved by a compaction (those with a
+ * creation order value below compact_mark) gets a record mapping its
+ * creation order value to its slot, so it can still be found directly when
+ * deleting by name, and one mapping its slot back to its creation order
+ * value for the next compaction.
+ *
+ * Indices without a format record were created by older versions of the
+ * connector and keep using the shifting scheme until they are emptied. */
+typedef struct H5_daos_corder_info_t {
+    uint64_t               nobjs;
+    uint64_t               max_corder;
+    uint64_t               nholes;
+    H5_daos_corder_hole_t *holes;
+    hbool_t                sparse;
+    uint64_t               slot_base;
+    uint64_t               compact_mark;
+} H5_daos_corder_info_t;
+
+/* The hole records to write to a creation order index's holes akey after
+ * adding a slot to its holes, and the new number of holes */
+typedef struct H5_daos_corder_holes_update_t {
+    uint64_t    nholes;
+    unsigned    nrecs;
+    daos_recx_t recxs[2];
+    uint8_t     recs_buf[2 * H5_DAOS_ENCODED_CORDER_HOLE_SIZE];
+} H5_daos_corder_holes_update_t;
+
 /* Task user data for generic metadata I/O (with flexible array member) */
 typedef struct H5_daos_md_rw_cb_ud_flex_t {
     H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
@@ -843,6 +1229,8 @@ typedef struct H5_daos_oidx_generate_ud_t {
     uint64_t               *oidx_out;
     uint64_t               *next_oidx;
     uint64_t               *max_oidx;
+    uint64_t                nalloc;
+    uint64_t                num_oids;
 } H5_daos_oidx_generate_ud_t;
 
 /* Task user data for broadcasting the next OIDX
@@ -855,6 +1243,7 @@ typedef struct H5_daos_oidx_bcast_ud_t {
     uint64_t               *oidx_out;
     uint64_t               *next_oidx;
     uint64_t               *max_oidx;
+    uint64_t                nalloc;
 } H5_daos_oidx_bcast_ud_t;
 
 /* Task user data for OID encoding */
@@ -894,6 +1283,10 @@ typedef herr_t (*H5_daos_link_iterate_async_t)(hid_t group, const char *name, co
 typedef herr_t (*H5_daos_map_iterate_async_t)(hid_t map, const void *key, void *op_data, herr_t *op_ret,
                                               tse_task_t **first_task, tse_task_t **dep_task);
 
+/* Function type for the body of a public H5daos routine run through
+ * H5_daos_public_call() */
+typedef herr_t (*H5_daos_public_op_t)(void *op_args);
+
 /* Function type for asynchronous object visit callbacks */
 typedef herr_t (*H5_daos_object_visit_async_t)(hid_t obj, const char *name, const H5O_info2_t *info,
                                                void *op_data, herr_t *op_ret, tse_task_t **first_task,
@@ -904,15 +1297,17 @@ typedef herr_t (*H5_daos_object_visit_async_t)(hid_t obj, const char *name, cons
  * link, attribute and object iteration/visiting.
  */
 typedef struct H5_daos_iter_data_t {
-    H5_iter_order_t iter_order;
-    H5_index_t      index_type;
-    hbool_t         is_recursive;
-    hbool_t         async_op;
-    hsize_t        *idx_p;
-    hid_t           iter_root_obj;
-    void           *op_data;
-    herr_t          op_ret;
-    herr_t         *op_ret_p;
+    H5_iter_order_t      iter_order;
+    H5_index_t           index_type;
+    hbool_t              is_recursive;
+    hbool_t              unordered; /* Recursive visit may make callbacks out of order */
+    hbool_t              async_op;
+    hsize_t             *idx_p;
+    const daos_anchor_t *start_anchor; /* Anchor to start the base level from, or NULL */
+    hid_t                iter_root_obj;
+    void                *op_data;
+    herr_t               op_ret;
+    herr_t              *op_ret_p;
 
     hbool_t        short_circuit_init;
     H5_daos_req_t *req;
@@ -941,8 +1336,15 @@ typedef struct H5_daos_iter_data_t {
             union {
                 H5M_iterate_t               map_iter_op;
                 H5_daos_map_iterate_async_t map_iter_op_async;
+                H5_daos_map_iterate_kv_t    map_iter_kv_op;
             } u;
-            hid_t key_mem_type_id;
+            hid_t    key_mem_type_id;
+            hid_t    val_mem_type_id;
+            hbool_t  fetch_vals;  /* Whether to prefetch values and call map_iter_kv_op */
+            uint32_t part_nr;     /* Number of anchors the dkeys are split into, 0 if not partitioned */
+            uint32_t part_next;   /* Next anchor to list once the current one is exhausted */
+            uint32_t part_stride; /* Distance between the anchors listed by this process */
+            hsize_t  skip;        /* Pairs still to pass over when restarting from *idx_p */
         } map_iter_data;
 
         struct {
@@ -970,6 +1372,7 @@ typedef struct H5_daos_iter_ud_t {
     daos_iov_t           sg_iov;
     daos_anchor_t        anchor;
     hbool_t              base_iter;
+    const char          *path_prefix; /* Link path to this level (unordered visits only), not owned */
     tse_task_t          *iter_metatask;
 } H5_daos_iter_ud_t;
 
@@ -1038,27 +1441,31 @@ extern H5VL_DAOS_PRIVATE H5_daos_plist_cache_t *H5_daos_plist_cache_g;
 /* Global variable for DAOS task list */
 extern H5VL_DAOS_PRIVATE H5_daos_task_list_t *H5_daos_task_list_g;
 
-/* DAOS task and MPI request for current in-flight MPI operation.  Only allow
- * one at a time for now since:
- * - All MPI operations must be in the same order across all ranks, therefore
- *   we cannot start MPI operations in an HDF5 operation until all MPI
- *   operations in previous HDF5 operations are complete
- * - All individual HDF5 operations can only process MPI operations one at a
- *   time */
-extern tse_task_t *H5_daos_mpi_task_g;
-extern MPI_Request H5_daos_mpi_req_g;
-
-/* Last collective request scheduled.  As described above, only one collective
- * operation can be in flight at any one time. */
+/* Last collective request scheduled that is not tied to a file.  All MPI
+ * operations on a communicator must be started in the same order on all
+ * ranks, therefore we cannot start MPI operations in an HDF5 operation until
+ * all MPI operations in previous HDF5 operations on the same communicator are
+ * complete.  Collective requests on a file are ordered through the
+ * req_tail of their collective lane instead (see H5_daos_coll_lane_t), since
+ * each lane has its own communicator, so collective operations on different
+ * files, or in different lanes of one file, may be in flight at once. */
 extern struct H5_daos_req_t *H5_daos_collective_req_tail;
 
 /* Counter to keep track of the level of recursion with
- * regards to top-level connector callback routines.
- * It should be incremented upon entering any top-level
- * connector callback routine (marked by the presence
- * of D_FUNC_LEAVE_API) and decremented upon leaving
- * that routine. */
-extern int H5_daos_api_count;
+ * regards to top-level connector callback routines on
+ * this thread.  It should be incremented upon entering
+ * any top-level connector callback routine (marked by
+ * the presence of D_FUNC_LEAVE_API) and decremented
+ * upon leaving that routine. */
+extern __thread int H5_daos_api_count;
+
+/* Whether this thread holds H5_daos_api_mutex_g */
+extern __thread hbool_t H5_daos_api_locked;
+
+/* Whether the background progress thread is running, and the mutex held
+ * while inside a top-level connector callback to keep it out */
+extern hbool_t         H5_daos_progress_thread_on_g;
+extern pthread_mutex_t H5_daos_api_mutex_g;
 
 /* Constant Keys */
 extern H5VL_DAOS_PRIVATE const char H5_daos_int_md_key_g[];
@@ -1069,14 +1476,24 @@ extern H5VL_DAOS_PRIVATE const char H5_daos_link_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_link_corder_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_nlinks_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_max_link_corder_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_link_corder_holes_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_nlink_corder_holes_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_link_corder_fmt_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_type_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_space_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_attr_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_nattr_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_max_attr_corder_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_attr_corder_holes_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_nattr_corder_holes_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_attr_corder_fmt_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_ktype_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_vtype_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_map_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_map_count_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_map_bloom_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_map_bloom_size_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_map_val_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_blob_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_fillval_key_g[];
 
@@ -1088,14 +1505,24 @@ extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_link_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_link_corder_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_nlinks_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_max_link_corder_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_link_corder_holes_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_nlink_corder_holes_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_link_corder_fmt_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_type_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_space_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_attr_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_nattr_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_max_attr_corder_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_attr_corder_holes_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_nattr_corder_holes_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_attr_corder_fmt_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_ktype_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_vtype_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_map_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_map_count_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_map_bloom_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_map_bloom_size_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_map_val_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_blob_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_fillval_key_size_g;
 
@@ -1138,6 +1565,8 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_get_mpi_info(hid_t fapl_id, MPI_Comm *comm, MPI
                                               int *mpi_size);
 H5VL_DAOS_PRIVATE herr_t H5_daos_comm_info_get(hid_t fapl_id, MPI_Comm *comm, MPI_Info *info);
 H5VL_DAOS_PRIVATE herr_t H5_daos_comm_info_free(MPI_Comm *comm, MPI_Info *info);
+H5VL_DAOS_PRIVATE herr_t H5_daos_coll_lanes_init(H5_daos_file_t *file);
+H5VL_DAOS_PRIVATE herr_t H5_daos_coll_lanes_free(H5_daos_file_t *file);
 
 /* File callbacks */
 H5VL_DAOS_PRIVATE void  *H5_daos_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id,
@@ -1193,20 +1622,27 @@ H5VL_DAOS_PRIVATE htri_t H5_daos_link_follow(H5_daos_group_t *grp, const char *n
                                              hbool_t crt_missing_grp, H5_daos_req_t *req,
                                              daos_obj_id_t ***oid_ptr, hbool_t *link_exists,
                                              tse_task_t **first_task, tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE htri_t H5_daos_link_follow_crt_path(H5_daos_group_t *grp, const char *path,
+                                                      size_t path_len, H5_daos_req_t *req,
+                                                      daos_obj_id_t ***oid_ptr, tse_task_t **first_task,
+                                                      tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_iterate(H5_daos_group_t     *target_grp,
                                               H5_daos_iter_data_t *link_iter_data, tse_task_t **first_task,
                                               tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_get_name_by_idx(H5_daos_group_t *target_grp, H5_index_t index_type,
                                                       H5_iter_order_t iter_order, uint64_t idx,
+                                                      const H5_daos_corder_info_t *corder_info,
                                                       size_t *link_name_size, char *link_name_out,
                                                       size_t link_name_out_size, H5_daos_req_t *req,
                                                       tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp,
                                                             H5_index_t index_type, H5_iter_order_t iter_order,
-                                                            uint64_t idx, const char **link_name,
-                                                            size_t *link_name_size, char **link_name_buf,
-                                                            size_t *link_name_buf_size, H5_daos_req_t *req,
-                                                            tse_task_t **first_task, tse_task_t **dep_task);
+                                                            uint64_t idx,
+                                                            const H5_daos_corder_info_t *corder_info,
+                                                            const char **link_name, size_t *link_name_size,
+                                                            char **link_name_buf, size_t *link_name_buf_size,
+                                                            H5_daos_req_t *req, tse_task_t **first_task,
+                                                            tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_get_crt_order_by_name(H5_daos_group_t *target_grp,
                                                             const char *link_name, uint64_t *crt_order,
                                                             H5_daos_req_t *req, tse_task_t **first_task,
@@ -1238,7 +1674,7 @@ H5VL_DAOS_PRIVATE void *H5_daos_group_create_helper(H5_daos_file_t *file, hbool_
                                                     hid_t gapl_id, H5_daos_group_t *parent_grp,
                                                     const char *name, size_t name_len, hbool_t collective,
                                                     H5_daos_req_t *req, tse_task_t **first_task,
-                                                    tse_task_t **dep_task);
+                                                    tse_task_t **dep_task, tse_task_t **open_dep_task);
 H5VL_DAOS_PRIVATE int   H5_daos_group_open_helper(H5_daos_file_t *file, H5_daos_group_t *grp, hid_t gapl_id,
                                                   hbool_t collective, H5_daos_req_t *req,
                                                   tse_task_t **first_task, tse_task_t **dep_task);
@@ -1330,6 +1766,8 @@ H5VL_DAOS_PRIVATE H5_daos_dtype_t *H5_daos_datatype_open_helper(H5_daos_file_t *
                                                                 tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE htri_t           H5_daos_detect_vl_vlstr_ref(hid_t type_id);
 H5VL_DAOS_PRIVATE htri_t           H5_daos_need_tconv(hid_t src_type_id, hid_t dst_type_id);
+H5VL_DAOS_PRIVATE htri_t           H5_daos_need_bkg(hid_t src_type_id, hid_t dst_type_id, hbool_t dst_file,
+                                                    size_t *dst_type_size, hbool_t *fill_bkg);
 H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_init(hid_t src_type_id, size_t *src_type_size, hid_t dst_type_id,
                                             size_t *dst_type_size, size_t num_elem, hbool_t clear_tconv_buf,
                                             hbool_t dst_file, void **tconv_buf, void **bkg_buf,
@@ -1371,6 +1809,26 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_object_update_num_attrs_key(H5_daos_obj_t *targ
                                                              tse_task_cb_t prep_cb, tse_task_cb_t comp_cb,
                                                              H5_daos_req_t *req, tse_task_t **first_task,
                                                              tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE herr_t H5_daos_object_get_corder_info(H5_daos_obj_t *target_obj, hbool_t attr_index,
+                                                        hbool_t get_holes, H5_daos_corder_info_t *corder_info,
+                                                        H5_daos_req_t *req, tse_task_t **first_task,
+                                                        tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE uint64_t H5_daos_corder_idx_to_slot(const H5_daos_corder_info_t *corder_info, uint64_t idx);
+H5VL_DAOS_PRIVATE herr_t   H5_daos_corder_holes_insert(const H5_daos_corder_info_t *corder_info, uint64_t slot,
+                                                       H5_daos_corder_holes_update_t *update);
+H5VL_DAOS_PRIVATE hbool_t  H5_daos_corder_compact_needed(const H5_daos_corder_info_t *corder_info,
+                                                         uint64_t nobjs);
+H5VL_DAOS_PRIVATE herr_t   H5_daos_corder_get_slots(const H5_daos_corder_info_t *corder_info,
+                                                    uint64_t skip_slot, uint64_t *slots, size_t nslots);
+H5VL_DAOS_PRIVATE void     H5_daos_corder_fmt_encode(uint8_t *buf, uint64_t slot_base, uint64_t compact_mark);
+H5VL_DAOS_PRIVATE herr_t   H5_daos_corder_fmt_decode(const uint8_t *buf, H5_daos_corder_info_t *corder_info);
+H5VL_DAOS_PRIVATE herr_t   H5_daos_name_cache_append(H5_daos_name_cache_t *cache, const char *name);
+H5VL_DAOS_PRIVATE void     H5_daos_name_cache_install(H5_daos_name_cache_t *cache, H5_daos_name_cache_t *built,
+                                                      uint64_t build_gen);
+H5VL_DAOS_PRIVATE htri_t   H5_daos_name_cache_lookup(const H5_daos_name_cache_t *cache, uint64_t cur_gen,
+                                                     uint64_t idx, char *name_out, size_t name_out_size,
+                                                     size_t *name_len);
+H5VL_DAOS_PRIVATE void     H5_daos_name_cache_free(H5_daos_name_cache_t *cache);
 H5VL_DAOS_PRIVATE int    H5_daos_obj_read_rc(H5_daos_obj_t **obj_p, H5_daos_obj_t *obj, uint64_t *rc,
                                              unsigned *rc_uint, H5_daos_req_t *req, tse_task_t **first_task,
                                              tse_task_t **dep_task);
@@ -1447,6 +1905,8 @@ H5VL_DAOS_PRIVATE H5_daos_map_t *H5_daos_map_open_int(H5_daos_item_t          *i
 H5VL_DAOS_PRIVATE herr_t         H5_daos_map_close_real(H5_daos_map_t *map);
 H5VL_DAOS_PRIVATE herr_t H5_daos_map_flush(H5_daos_map_t *map, H5_daos_req_t *req, tse_task_t **first_task,
                                            tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE herr_t H5_daos_map_file_sync(H5_daos_file_t *file, H5_daos_req_t *req,
+                                               tse_task_t **first_task, tse_task_t **dep_task);
 
 /* Blob callbacks */
 H5VL_DAOS_PRIVATE herr_t H5_daos_blob_put(void *_file, const void *buf, size_t size, void *blob_id,
@@ -1476,7 +1936,16 @@ H5VL_DAOS_PRIVATE herr_t         H5_daos_req_free_int(H5_daos_req_t *req);
 H5VL_DAOS_PRIVATE herr_t H5_daos_req_enqueue(H5_daos_req_t *req, tse_task_t *first_task, H5_daos_item_t *item,
                                              H5_daos_op_pool_type_t op_type, H5_daos_op_pool_scope_t scope,
                                              hbool_t collective, hbool_t sync);
-H5VL_DAOS_PRIVATE void   H5_daos_op_pool_free(H5_daos_op_pool_t *op_pool);
+H5VL_DAOS_PRIVATE herr_t H5_daos_req_enqueue_multi(H5_daos_req_t *req, tse_task_t *first_task, size_t nitems,
+                                                   H5_daos_item_t **items, H5_daos_op_pool_type_t op_type,
+                                                   H5_daos_op_pool_scope_t scope, hbool_t collective,
+                                                   hbool_t sync);
+H5VL_DAOS_PRIVATE herr_t H5_daos_req_enqueue_create(H5_daos_req_t *req, tse_task_t *first_task,
+                                                    H5_daos_item_t *loc_item, H5_daos_item_t *new_item,
+                                                    hbool_t anon, H5_daos_op_pool_type_t op_type,
+                                                    hbool_t collective, hbool_t sync);
+H5VL_DAOS_PRIVATE H5_daos_coll_lane_t *H5_daos_req_coll_lane(H5_daos_req_t *req);
+H5VL_DAOS_PRIVATE void                 H5_daos_op_pool_free(H5_daos_op_pool_t *op_pool);
 
 /* Generic asynchronous routines */
 H5VL_DAOS_PRIVATE herr_t H5_daos_progress(H5_daos_req_t *req, uint64_t timeout);
@@ -1488,20 +1957,29 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_create_daos_task(daos_opc_t daos_opc, unsigned
                                                   tse_task_cb_t task_comp_cb, void *task_priv,
                                                   tse_task_t **taskp);
 H5VL_DAOS_PRIVATE herr_t H5_daos_task_wait(tse_task_t **first_task, tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE herr_t H5_daos_io_budget_acquire(H5_daos_io_class_t io_class, tse_task_t *task,
+                                                   tse_task_t **gate_out);
+H5VL_DAOS_PRIVATE void   H5_daos_io_budget_release(H5_daos_io_class_t io_class);
+H5VL_DAOS_PRIVATE void   H5_daos_io_budget_cancel(H5_daos_io_class_t io_class, tse_task_t *gate);
+H5VL_DAOS_PRIVATE void   H5_daos_api_lock(void);
+H5VL_DAOS_PRIVATE void   H5_daos_api_unlock(void);
+H5VL_DAOS_PRIVATE herr_t H5_daos_public_call(H5_daos_public_op_t op, void *op_args);
 H5VL_DAOS_PRIVATE int    H5_daos_list_key_start(H5_daos_iter_ud_t *iter_udata, daos_opc_t opc,
                                                 tse_task_cb_t comp_cb, tse_task_t **first_task,
                                                 tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE int    H5_daos_list_key_init(H5_daos_iter_data_t *iter_data, H5_daos_obj_t *target_obj,
                                                daos_key_t *dkey, daos_opc_t opc, tse_task_cb_t comp_cb,
-                                               hbool_t base_iter, size_t key_prefetch_size,
-                                               size_t key_buf_size_init, tse_task_t **first_task,
-                                               tse_task_t **dep_task);
+                                               hbool_t base_iter, const char *path_prefix,
+                                               size_t key_prefetch_size, size_t key_buf_size_init,
+                                               tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_mpi_ibcast(H5_daos_mpi_ibcast_ud_t *_bcast_udata, H5_daos_obj_t *obj,
-                                            size_t buffer_size, hbool_t empty, tse_task_cb_t bcast_prep_cb,
-                                            tse_task_cb_t bcast_comp_cb, H5_daos_req_t *req,
-                                            tse_task_t **first_task, tse_task_t **dep_task);
+                                            size_t buffer_size, hbool_t empty, hbool_t prefetch,
+                                            tse_task_cb_t bcast_prep_cb, tse_task_cb_t bcast_comp_cb,
+                                            H5_daos_req_t *req, tse_task_t **first_task,
+                                            tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_collective_error_check(H5_daos_obj_t *obj, H5_daos_req_t *req,
                                                         tse_task_t **first_task, tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE herr_t H5_daos_collective_error_check_flush(H5_daos_file_t *file);
 
 /* Asynchronous task routines */
 H5VL_DAOS_PRIVATE int H5_daos_h5op_finalize(tse_task_t *task);
@@ -1528,17 +2006,32 @@ herr_t H5_daos_dump_obj_keys(daos_handle_t obj);
  * incremented at the very beginning of every top-level
  * connector callback, before anything else occurs. It
  * should be decremented before leaving that callback,
- * after everything else has occurred.
+ * after everything else has occurred.  Public H5daos
+ * routines are not called with the HDF5 library lock
+ * held.  Those that only use property lists or fields
+ * fixed when a file is opened use
+ * H5_daos_inc_public_api_cnt(), which takes no lock.
+ * Those that use the scheduler or other shared connector
+ * state run through H5_daos_public_call() instead.
  */
 static inline void
 H5_daos_inc_api_cnt()
+{
+    /* Keep the background progress thread and other application threads
+     * out until we leave the top-level connector callback */
+    if (H5_daos_api_count++ == 0 && H5_daos_progress_thread_on_g)
+        H5_daos_api_lock();
+}
+static inline void
+H5_daos_inc_public_api_cnt()
 {
     H5_daos_api_count++;
 }
 static inline void
 H5_daos_dec_api_cnt()
 {
-    H5_daos_api_count--;
+    if (--H5_daos_api_count == 0 && H5_daos_api_locked)
+        H5_daos_api_unlock();
 }
 
 /* Routine for setting const IOVEC */
@@ -14,8 +14,14 @@
 #include "util/daos_vol_err.h" /* DAOS connector error handling           */
 #include "util/daos_vol_mem.h" /* DAOS connector memory management        */
 
-static int H5_daos_op_pool_start_task(tse_task_t *task);
-static int H5_daos_op_pool_end_task(tse_task_t *task);
+static int    H5_daos_op_pool_start_task(tse_task_t *task);
+static int    H5_daos_op_pool_end_task(tse_task_t *task);
+static herr_t H5_daos_req_enqueue_pool(H5_daos_req_t *req, tse_task_t *first_task, H5_daos_item_t *item,
+                                       H5_daos_op_pool_type_t op_type, H5_daos_op_pool_scope_t scope,
+                                       hbool_t sync);
+static herr_t H5_daos_req_coll_dep(H5_daos_req_t *prev_req, tse_task_t *first_task);
+
+static H5_daos_op_pool_t **H5_daos_item_obj_pool(H5_daos_item_t *item);
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_req_wait
@@ -41,18 +47,43 @@ H5_daos_req_wait(void *_req, uint64_t timeout, H5_DAOS_REQ_STATUS_OUT_TYPE *stat
     if (!req)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "request object is NULL");
 
-    /* Wait until request finished */
-    if (H5_daos_progress(req, timeout) < 0)
+    /* If this request's collective error check was deferred and no
+     * deferred checks have been flushed since it was enqueued, flush them
+     * now so the wait can complete.  This depends only on the order of API
+     * calls, so it is the same on all ranks as long as the wait is made
+     * collectively.  Only do this for blocking waits, since the number of
+     * calls made with a timeout may differ between ranks. */
+    if (req->collective.deferred && req->collective.ordered && timeout == H5_DAOS_PROGRESS_WAIT &&
+        req->collective.flush_gen == req->file->coll_err_batch.flush_gen)
+        if (H5_daos_collective_error_check_flush(req->file) < 0)
+            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't check deferred collective errors");
+
+    /* Wait until request finished.  A request canceled before it started
+     * need not be waited for, its tasks only release its resources. */
+    if (req->status == -H5_DAOS_CANCELED && !req->in_progress) {
+        if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't progress scheduler");
+    } /* end if */
+    else if (H5_daos_progress(req, timeout) < 0)
         D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't progress scheduler");
 
     /* Set status if requested */
     if (status) {
-        if (req->status > -H5_DAOS_INCOMPLETE)
+        if (req->status == -H5_DAOS_CANCELED && !req->in_progress)
+            /* Canceled before it started, none of its tasks will touch the
+             * application's buffers */
+            *status = H5_DAOS_REQ_STATUS_OUT_CANCELED;
+        else if (req->collective.pending)
+            *status = H5_DAOS_REQ_STATUS_OUT_IN_PROGRESS;
+        else if (req->status > -H5_DAOS_INCOMPLETE)
             *status = H5_DAOS_REQ_STATUS_OUT_SUCCEED;
         else if (req->status >= -H5_DAOS_SHORT_CIRCUIT)
             *status = H5_DAOS_REQ_STATUS_OUT_IN_PROGRESS;
         else if (req->status == -H5_DAOS_CANCELED)
-            *status = H5_DAOS_REQ_STATUS_OUT_CANCELED;
+            /* A canceled request may still have DAOS operations in flight
+             * that use the application's buffers */
+            *status = req->finalize_task ? H5_DAOS_REQ_STATUS_OUT_IN_PROGRESS
+                                         : H5_DAOS_REQ_STATUS_OUT_CANCELED;
         else
             *status = H5_DAOS_REQ_STATUS_OUT_FAIL;
     } /* end if */
@@ -95,7 +126,26 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_req_cancel
  *
- * Purpose:     Cancels the provided request.
+ * Purpose:     Cancels the provided request.  If the request has not
+ *              started it will never start, and is reported as canceled
+ *              immediately.
+ *
+ *              Read-only and raw data requests (those with
+ *              cancel_in_flight set) can also be canceled while in
+ *              progress.  All of their tasks that have not yet been sent
+ *              to DAOS are skipped through the usual short-circuit path
+ *              in their prep callbacks and task functions, which releases
+ *              their buffers and user data as they are skipped.  DAOS
+ *              operations already in flight cannot be aborted through the
+ *              DAOS task API and are left to finish, so such a request is
+ *              reported as in progress until these drain, after which it
+ *              is reported as canceled.
+ *
+ *              Requests that modify metadata are made of several updates
+ *              that must all be applied to keep the file consistent, so
+ *              once started they run to completion.  So do requests that
+ *              are part of a collective chain, since skipping their tasks
+ *              on only some ranks would hang the others.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -119,17 +169,33 @@ H5_daos_req_cancel(void *_req)
     if (!req)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "request object is NULL");
 
-    /* Check if the operation is in progress. If it is, we can't cancel it */
-    if (!req->in_progress) {
-        /* Cancel operation */
-        req->status = H5_DAOS_CANCELED;
-#if H5VL_VERSION >= 2
-        *status = H5_DAOS_REQ_STATUS_OUT_CANCELED;
-#endif
+    /* Mark the request as canceled if it has not already finished, failed, or
+     * short-circuited.  Every task that has not yet run will see this and
+     * skip its work. */
+    if (req->status == -H5_DAOS_INCOMPLETE &&
+        (!req->in_progress || (req->cancel_in_flight && !req->collective.chained))) {
+        req->status      = -H5_DAOS_CANCELED;
+        req->failed_task = "canceled by application";
+
+        /* Kick the scheduler so the skipped tasks run, releasing their
+         * resources now instead of at the next API call */
+        if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't progress scheduler");
     } /* end if */
+
 #if H5VL_VERSION >= 2
-    else
+    /* Set status.  A request canceled before it started has nothing in
+     * flight, even though its finalize task has not run yet. */
+    if (req->status == -H5_DAOS_CANCELED && !req->in_progress)
+        *status = H5_DAOS_REQ_STATUS_OUT_CANCELED;
+    else if (req->finalize_task || req->collective.pending)
         *status = H5_DAOS_REQ_STATUS_OUT_IN_PROGRESS;
+    else if (req->status == -H5_DAOS_CANCELED)
+        *status = H5_DAOS_REQ_STATUS_OUT_CANCELED;
+    else if (req->status > -H5_DAOS_INCOMPLETE)
+        *status = H5_DAOS_REQ_STATUS_OUT_SUCCEED;
+    else
+        *status = H5_DAOS_REQ_STATUS_OUT_FAIL;
 #endif
 
 done:
@@ -257,6 +323,20 @@ H5_daos_req_create(H5_daos_file_t *file, const char *op_name, H5_daos_req_t *pre
     ret_value->op_name     = op_name;
     ret_value->in_progress = FALSE;
 
+    ret_value->cancel_in_flight = FALSE;
+
+    ret_value->collective.chained       = FALSE;
+    ret_value->collective.deferred      = FALSE;
+    ret_value->collective.ordered       = FALSE;
+    ret_value->collective.pending       = FALSE;
+    ret_value->collective.flush_gen     = 0;
+    ret_value->collective.next_deferred = NULL;
+    ret_value->collective.lane          = NULL;
+    ret_value->collective.seq           = 0;
+    ret_value->collective.sub_seq       = 0;
+    ret_value->collective.nsub          = 0;
+    ret_value->collective.barrier       = FALSE;
+
 done:
     D_FUNC_LEAVE;
 } /* end H5_daos_req_create() */
@@ -419,12 +499,35 @@ done:
 } /* end H5_daos_op_pool_end_task() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_req_enqueue
+ * Function:    H5_daos_item_obj_pool
  *
- * Purpose:     Adds a request to an object, file, or global operation
- *              pool.  If collective is true it is also added to the
- *              collective operation queue.  If dep_req is provided that
- *              is added as a dependency.  Also schedules first_task.
+ * Purpose:     Returns the location of the pointer to item's current
+ *              object scope operation pool.  Files use the pool of their
+ *              root group.
+ *
+ * Return:      Pointer to the current op pool pointer (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_daos_op_pool_t **
+H5_daos_item_obj_pool(H5_daos_item_t *item)
+{
+    assert(item);
+
+    return item->type == H5I_FILE ? &((H5_daos_file_t *)item)->root_grp->obj.item.cur_op_pool
+                                  : &item->cur_op_pool;
+} /* end H5_daos_item_obj_pool() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_req_enqueue_pool
+ *
+ * Purpose:     Adds a request to the attribute, object, file, or global
+ *              operation pool for item at the given scope, creating
+ *              dependencies on the previous pool at that level and on
+ *              the pools of all enclosing scopes as necessary.  If sync
+ *              is TRUE and the request would not have to wait for
+ *              anything, it is not added to a pool.  Does not schedule
+ *              first_task.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -433,10 +536,9 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_req_enqueue(H5_daos_req_t *req, tse_task_t *first_task, H5_daos_item_t *item,
-                    H5_daos_op_pool_type_t op_type, H5_daos_op_pool_scope_t scope, hbool_t collective,
-                    hbool_t sync)
+static herr_t
+H5_daos_req_enqueue_pool(H5_daos_req_t *req, tse_task_t *first_task, H5_daos_item_t *item,
+                         H5_daos_op_pool_type_t op_type, H5_daos_op_pool_scope_t scope, hbool_t sync)
 {
     H5_daos_op_pool_t    **parent_cur_op_pool[4] = {NULL};
     H5_daos_op_pool_t     *tmp_pool              = NULL;
@@ -444,6 +546,7 @@ H5_daos_req_enqueue(H5_daos_req_t *req, tse_task_t *first_task, H5_daos_item_t *
     H5_daos_op_pool_t     *tmp_new_pool_alloc_2  = NULL;
     hbool_t                create_new_pool;
     hbool_t                init_pool;
+    hbool_t                might_skip_pool          = FALSE;
     hbool_t                must_schedule_start_task = FALSE;
     hbool_t                must_schedule_end_task   = FALSE;
     H5_daos_op_pool_type_t new_type                 = H5_DAOS_OP_TYPE_EMPTY;
@@ -453,440 +556,573 @@ H5_daos_req_enqueue(H5_daos_req_t *req, tse_task_t *first_task, H5_daos_item_t *
     herr_t                 ret_value = SUCCEED;
 
     assert(req);
-    assert(op_type >= H5_DAOS_OP_TYPE_READ && op_type <= H5_DAOS_OP_TYPE_NOPOOL);
-    assert(scope >= H5_DAOS_OP_SCOPE_ATTR && scope <= H5_DAOS_OP_SCOPE_GLOB);
-
-    /* If there's no first task there's nothing to do */
-    if (!first_task)
-        D_GOTO_DONE(SUCCEED);
-
-    /* Check if we don't need to add to a pool */
-    if (op_type != H5_DAOS_OP_TYPE_NOPOOL && (item || scope == H5_DAOS_OP_SCOPE_GLOB)) {
-        hbool_t might_skip_pool = FALSE;
-
-        /* Assign parent_cur_op_pool and parent_static_op_pool */
-        switch (scope) {
-            case H5_DAOS_OP_SCOPE_ATTR:
-                assert(item);
-                assert(item->file == req->file);
-                assert(item->type == H5I_ATTR);
-                parent_cur_op_pool[0] = &item->cur_op_pool;
-                if (((H5_daos_attr_t *)item)->parent) {
-                    parent_cur_op_pool[1] = &((H5_daos_attr_t *)item)->parent->item.cur_op_pool;
-                    parent_cur_op_pool[2] = &item->file->item.cur_op_pool;
-                    parent_cur_op_pool[3] = &H5_daos_glob_cur_op_pool_g;
-                    nlevels               = 4;
-                } /* end if */
-                else {
-                    /* Attribute parent object is incomplete, in this case the
-                     * parent object is not managed by the API so we don't need
-                     * to worry about requests being added to its pool so we can
-                     * just ignore it here */
-                    parent_cur_op_pool[1] = &item->file->item.cur_op_pool;
-                    parent_cur_op_pool[2] = &H5_daos_glob_cur_op_pool_g;
-                    nlevels               = 3;
-                } /* end if */
-                break;
-
-            case H5_DAOS_OP_SCOPE_OBJ:
-                assert(item);
-                assert(item->file == req->file);
-                parent_cur_op_pool[0] = item->type == H5I_FILE
-                                            ? &((H5_daos_file_t *)item)->root_grp->obj.item.cur_op_pool
-                                            : &item->cur_op_pool;
+    assert(first_task);
+    assert(op_type >= H5_DAOS_OP_TYPE_READ && op_type < H5_DAOS_OP_TYPE_NOPOOL);
+    assert(item || scope == H5_DAOS_OP_SCOPE_GLOB);
+
+    /* Assign parent_cur_op_pool and parent_static_op_pool */
+    switch (scope) {
+        case H5_DAOS_OP_SCOPE_ATTR:
+            assert(item);
+            assert(item->file == req->file);
+            assert(item->type == H5I_ATTR);
+            parent_cur_op_pool[0] = &item->cur_op_pool;
+            if (((H5_daos_attr_t *)item)->parent) {
+                parent_cur_op_pool[1] = &((H5_daos_attr_t *)item)->parent->item.cur_op_pool;
+                parent_cur_op_pool[2] = &item->file->item.cur_op_pool;
+                parent_cur_op_pool[3] = &H5_daos_glob_cur_op_pool_g;
+                nlevels               = 4;
+            } /* end if */
+            else {
+                /* Attribute parent object is incomplete, in this case the
+                 * parent object is not managed by the API so we don't need
+                 * to worry about requests being added to its pool so we can
+                 * just ignore it here */
                 parent_cur_op_pool[1] = &item->file->item.cur_op_pool;
                 parent_cur_op_pool[2] = &H5_daos_glob_cur_op_pool_g;
                 nlevels               = 3;
-                break;
+            } /* end if */
+            break;
 
-            case H5_DAOS_OP_SCOPE_FILE:
-                assert(item);
-                assert(item->file == req->file);
-                parent_cur_op_pool[0] = &item->file->item.cur_op_pool;
-                parent_cur_op_pool[1] = &H5_daos_glob_cur_op_pool_g;
-                nlevels               = 2;
-                break;
+        case H5_DAOS_OP_SCOPE_OBJ:
+            assert(item);
+            assert(item->file == req->file);
+            parent_cur_op_pool[0] = H5_daos_item_obj_pool(item);
+            parent_cur_op_pool[1] = &item->file->item.cur_op_pool;
+            parent_cur_op_pool[2] = &H5_daos_glob_cur_op_pool_g;
+            nlevels               = 3;
+            break;
 
-            case H5_DAOS_OP_SCOPE_GLOB:
-                parent_cur_op_pool[0] = &H5_daos_glob_cur_op_pool_g;
-                nlevels               = 1;
-                break;
+        case H5_DAOS_OP_SCOPE_FILE:
+            assert(item);
+            assert(item->file == req->file);
+            parent_cur_op_pool[0] = &item->file->item.cur_op_pool;
+            parent_cur_op_pool[1] = &H5_daos_glob_cur_op_pool_g;
+            nlevels               = 2;
+            break;
 
-            default:
-                assert(0 && "Unknown scope");
-        } /* end switch */
+        case H5_DAOS_OP_SCOPE_GLOB:
+            parent_cur_op_pool[0] = &H5_daos_glob_cur_op_pool_g;
+            nlevels               = 1;
+            break;
 
-        /* Determine if we need to allocate and/or initialize a new pool */
-        if (!*parent_cur_op_pool[0]) {
-            /* No pool present at this level, check for sync execution,
-             * otherwise must create a new pool */
-            if (sync)
-                might_skip_pool = TRUE;
-            create_new_pool = TRUE;
-            init_pool       = TRUE;
-        } /* end if */
-        else if ((*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_EMPTY) {
-            /* Empty pool present, must initialize */
-            assert(!(*parent_cur_op_pool[0])->end_task);
+        default:
+            assert(0 && "Unknown scope");
+    } /* end switch */
 
-            /* Check for sync execution */
-            if (sync && !(*parent_cur_op_pool[0])->start_task)
-                might_skip_pool = TRUE;
+    /* Determine if we need to allocate and/or initialize a new pool */
+    if (!*parent_cur_op_pool[0]) {
+        /* No pool present at this level, check for sync execution,
+         * otherwise must create a new pool */
+        if (sync)
+            might_skip_pool = TRUE;
+        create_new_pool = TRUE;
+        init_pool       = TRUE;
+    } /* end if */
+    else if ((*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_EMPTY) {
+        /* Empty pool present, must initialize */
+        assert(!(*parent_cur_op_pool[0])->end_task);
+
+        /* Check for sync execution */
+        if (sync && !(*parent_cur_op_pool[0])->start_task)
+            might_skip_pool = TRUE;
 
-            /* Take over empty pool */
-            create_new_pool = FALSE;
-            init_pool       = TRUE;
+        /* Take over empty pool */
+        create_new_pool = FALSE;
+        init_pool       = TRUE;
 
-            /* Assign tmp_pool pointer */
-            tmp_pool = *parent_cur_op_pool[0];
-        } /* end if */
-        else if (((op_type == H5_DAOS_OP_TYPE_READ &&
-                   ((*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ ||
-                    (*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_WRITE ||
-                    (*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ_ORDERED)) ||
-                  (op_type == H5_DAOS_OP_TYPE_WRITE &&
-                   ((*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ ||
-                    (*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_WRITE)) ||
-                  (op_type == H5_DAOS_OP_TYPE_READ_ORDERED &&
-                   ((*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ ||
-                    (*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ_ORDERED)))) {
-            assert((*parent_cur_op_pool[0])->end_task);
+        /* Assign tmp_pool pointer */
+        tmp_pool = *parent_cur_op_pool[0];
+    } /* end if */
+    else if (((op_type == H5_DAOS_OP_TYPE_READ &&
+               ((*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ ||
+                (*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_WRITE ||
+                (*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ_ORDERED)) ||
+              (op_type == H5_DAOS_OP_TYPE_WRITE &&
+               ((*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ ||
+                (*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_WRITE)) ||
+              (op_type == H5_DAOS_OP_TYPE_READ_ORDERED &&
+               ((*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ ||
+                (*parent_cur_op_pool[0])->type == H5_DAOS_OP_TYPE_READ_ORDERED)))) {
+        assert((*parent_cur_op_pool[0])->end_task);
+
+        /* Check for sync execution */
+        if (sync && !(*parent_cur_op_pool[0])->start_task)
+            might_skip_pool = TRUE;
+
+        /* Use existing pool */
+        create_new_pool = FALSE;
+        init_pool       = FALSE;
+        tmp_pool        = *parent_cur_op_pool[0];
+
+        /* Op type is compatible with current pool type.  Can add to current
+         * pool if the parent op gens are not different. */
+        for (i = 1; i < nlevels; i++)
+            if ((*parent_cur_op_pool[0])->op_gens[i] != (*parent_cur_op_pool[i])->op_gens[0]) {
+                assert((*parent_cur_op_pool[0])->op_gens[i] < (*parent_cur_op_pool[i])->op_gens[0]);
+
+                /* Create and init new pool */
+                create_new_pool = TRUE;
+                init_pool       = TRUE;
+            } /* end if */
 
+        if (!init_pool) {
             /* Check for sync execution */
             if (sync && !(*parent_cur_op_pool[0])->start_task)
                 might_skip_pool = TRUE;
 
-            /* Use existing pool */
-            create_new_pool = FALSE;
-            init_pool       = FALSE;
-            tmp_pool        = *parent_cur_op_pool[0];
-
-            /* Op type is compatible with current pool type.  Can add to current
-             * pool if the parent op gens are not different. */
-            for (i = 1; i < nlevels; i++)
-                if ((*parent_cur_op_pool[0])->op_gens[i] != (*parent_cur_op_pool[i])->op_gens[0]) {
-                    assert((*parent_cur_op_pool[0])->op_gens[i] < (*parent_cur_op_pool[i])->op_gens[0]);
-
-                    /* Create and init new pool */
-                    create_new_pool = TRUE;
-                    init_pool       = TRUE;
-                } /* end if */
-
-            if (!init_pool) {
-                /* Check for sync execution */
-                if (sync && !(*parent_cur_op_pool[0])->start_task)
-                    might_skip_pool = TRUE;
-
-                /* Prepare to upgrade pool type if appropriate */
-                if (op_type > (*parent_cur_op_pool[0])->type)
-                    new_type = op_type;
+            /* Prepare to upgrade pool type if appropriate */
+            if (op_type > (*parent_cur_op_pool[0])->type)
+                new_type = op_type;
+        } /* end if */
+    }     /* end if */
+    else {
+        assert((*parent_cur_op_pool[0])->end_task);
+
+        /* Cannot combine with existing pool, create new one */
+        create_new_pool = TRUE;
+        init_pool       = TRUE;
+    } /* end else */
+
+    /* Check for sync execution */
+    if (might_skip_pool) {
+        assert(sync);
+        for (i = 1; i < nlevels; i++)
+            if (*parent_cur_op_pool[i] && (*parent_cur_op_pool[i])->end_task) {
+                might_skip_pool = FALSE;
+                break;
             } /* end if */
-        }     /* end if */
-        else {
-            assert((*parent_cur_op_pool[0])->end_task);
 
-            /* Cannot combine with existing pool, create new one */
-            create_new_pool = TRUE;
-            init_pool       = TRUE;
-        } /* end else */
+        if (might_skip_pool)
+            D_GOTO_DONE(SUCCEED);
+    } /* end if */
 
-        /* Check for sync execution */
-        if (might_skip_pool) {
-            assert(sync);
-            for (i = 1; i < nlevels; i++)
-                if (*parent_cur_op_pool[i] && (*parent_cur_op_pool[i])->end_task) {
-                    might_skip_pool = FALSE;
-                    break;
-                } /* end if */
+    /* upgrade pool type if appropriate */
+    if (new_type != H5_DAOS_OP_TYPE_EMPTY)
+        (*parent_cur_op_pool[0])->type = new_type;
 
-            if (might_skip_pool)
-                goto skip_pool;
-        } /* end if */
+    /* Create new pool if appropriate */
+    if (create_new_pool) {
+        /* Allocate pool struct */
+        if (NULL == (tmp_new_pool_alloc = (H5_daos_op_pool_t *)DV_calloc(sizeof(H5_daos_op_pool_t))))
+            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTALLOC, FAIL, "can't allocate operation pool struct");
+        tmp_pool = tmp_new_pool_alloc;
 
-        /* upgrade pool type if appropriate */
-        if (new_type != H5_DAOS_OP_TYPE_EMPTY)
-            (*parent_cur_op_pool[0])->type = new_type;
-
-        /* Create new pool if appropriate */
-        if (create_new_pool) {
-            /* Allocate pool struct */
-            if (NULL == (tmp_new_pool_alloc = (H5_daos_op_pool_t *)DV_calloc(sizeof(H5_daos_op_pool_t))))
-                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTALLOC, FAIL, "can't allocate operation pool struct");
-            tmp_pool = tmp_new_pool_alloc;
-
-            /* Initialize ref count */
-            tmp_pool->rc = 1;
-
-            /* Handle previous pool */
-            if (*parent_cur_op_pool[0]) {
-                assert((*parent_cur_op_pool[0])->type != H5_DAOS_OP_TYPE_EMPTY);
-
-                /* Only need to create dependencies if the previous pool hasn't
-                 * already completed */
-                if ((*parent_cur_op_pool[0])->end_task) {
-                    /* Create dep task for previous pool if necessary.  This will be
-                     * completed by the end task.  We do this to prevent tse from
-                     * propagating errors between pools. */
-                    if (!(*parent_cur_op_pool[0])->dep_task) {
-                        if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL,
-                                                &(*parent_cur_op_pool[0])->dep_task) < 0)
-                            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                         "can't create dep task for operation pool");
+        /* Initialize ref count */
+        tmp_pool->rc = 1;
 
-                        if (0 != (ret = tse_task_schedule((*parent_cur_op_pool[0])->dep_task, false)))
-                            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
-                                         "can't schedule final dependency task for operation pool: %s",
-                                         H5_daos_err_to_string(ret));
-                    } /* end if */
+        /* Handle previous pool */
+        if (*parent_cur_op_pool[0]) {
+            assert((*parent_cur_op_pool[0])->type != H5_DAOS_OP_TYPE_EMPTY);
 
-                    /* Create start task */
-                    if (H5_daos_create_task(H5_daos_op_pool_start_task, 0, NULL, NULL, NULL, tmp_pool,
-                                            &tmp_pool->start_task) < 0)
+            /* Only need to create dependencies if the previous pool hasn't
+             * already completed */
+            if ((*parent_cur_op_pool[0])->end_task) {
+                /* Create dep task for previous pool if necessary.  This will be
+                 * completed by the end task.  We do this to prevent tse from
+                 * propagating errors between pools. */
+                if (!(*parent_cur_op_pool[0])->dep_task) {
+                    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL,
+                                            &(*parent_cur_op_pool[0])->dep_task) < 0)
                         D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                     "can't create start task for operation pool");
-                    must_schedule_start_task = TRUE;
+                                     "can't create dep task for operation pool");
 
-                    /* Create dependency on previous pool dep task */
-                    if ((ret = tse_task_register_deps(tmp_pool->start_task, 1,
-                                                      &(*parent_cur_op_pool[0])->dep_task)) < 0)
-                        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                     "can't create dependencies for start task for operation pool: %s",
+                    if (0 != (ret = tse_task_schedule((*parent_cur_op_pool[0])->dep_task, false)))
+                        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                                     "can't schedule final dependency task for operation pool: %s",
                                      H5_daos_err_to_string(ret));
                 } /* end if */
 
-                /* Initialize op_gens[0] */
-                tmp_pool->op_gens[0] = (*parent_cur_op_pool[0])->op_gens[0];
+                /* Create start task */
+                if (H5_daos_create_task(H5_daos_op_pool_start_task, 0, NULL, NULL, NULL, tmp_pool,
+                                        &tmp_pool->start_task) < 0)
+                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                 "can't create start task for operation pool");
+                must_schedule_start_task = TRUE;
+
+                /* Create dependency on previous pool dep task */
+                if ((ret = tse_task_register_deps(tmp_pool->start_task, 1,
+                                                  &(*parent_cur_op_pool[0])->dep_task)) < 0)
+                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                 "can't create dependencies for start task for operation pool: %s",
+                                 H5_daos_err_to_string(ret));
             } /* end if */
-            else
-                /* Initialize op_gens[0] */
-                tmp_pool->op_gens[0] = 0;
+
+            /* Initialize op_gens[0] */
+            tmp_pool->op_gens[0] = (*parent_cur_op_pool[0])->op_gens[0];
         } /* end if */
+        else
+            /* Initialize op_gens[0] */
+            tmp_pool->op_gens[0] = 0;
+    } /* end if */
 
-        /* Initialize pool if appropriate */
-        if (init_pool) {
-            assert(!tmp_pool->end_task);
+    /* Initialize pool if appropriate */
+    if (init_pool) {
+        assert(!tmp_pool->end_task);
 
-            /* Assign pool type */
-            tmp_pool->type = op_type;
+        /* Assign pool type */
+        tmp_pool->type = op_type;
 
-            /* Create end task */
-            if (H5_daos_create_task(H5_daos_op_pool_end_task, 0, NULL, NULL, NULL, tmp_pool,
-                                    &tmp_pool->end_task) < 0)
-                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't create end task for operation pool");
-            must_schedule_end_task = TRUE;
+        /* Create end task */
+        if (H5_daos_create_task(H5_daos_op_pool_end_task, 0, NULL, NULL, NULL, tmp_pool,
+                                &tmp_pool->end_task) < 0)
+            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't create end task for operation pool");
+        must_schedule_end_task = TRUE;
 
-            /* If any higher level pools are non-empty, close them and create a new
-             * empty pool */
-            /* Adjust higher level pools if necessary */
-            for (i = 1; i < nlevels; i++) {
-                hbool_t must_schedule_higher_start_task;
+        /* If any higher level pools are non-empty, close them and create a new
+         * empty pool */
+        /* Adjust higher level pools if necessary */
+        for (i = 1; i < nlevels; i++) {
+            hbool_t must_schedule_higher_start_task;
 
-                must_schedule_higher_start_task = FALSE;
+            must_schedule_higher_start_task = FALSE;
 
-                /* Check if we must create a new higher level pool */
-                if (!*parent_cur_op_pool[i] || (*parent_cur_op_pool[i])->type != H5_DAOS_OP_TYPE_EMPTY) {
-                    /* Allocate pool struct */
-                    if (NULL ==
-                        (tmp_new_pool_alloc_2 = (H5_daos_op_pool_t *)DV_calloc(sizeof(H5_daos_op_pool_t))))
-                        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTALLOC, FAIL,
-                                     "can't allocate operation pool struct");
+            /* Check if we must create a new higher level pool */
+            if (!*parent_cur_op_pool[i] || (*parent_cur_op_pool[i])->type != H5_DAOS_OP_TYPE_EMPTY) {
+                /* Allocate pool struct */
+                if (NULL ==
+                    (tmp_new_pool_alloc_2 = (H5_daos_op_pool_t *)DV_calloc(sizeof(H5_daos_op_pool_t))))
+                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTALLOC, FAIL,
+                                 "can't allocate operation pool struct");
 
-                    /* Initialize ref count */
-                    tmp_new_pool_alloc_2->rc = 1;
+                /* Initialize ref count */
+                tmp_new_pool_alloc_2->rc = 1;
 
-                    /* Set op_type */
-                    tmp_new_pool_alloc_2->type = H5_DAOS_OP_TYPE_EMPTY;
+                /* Set op_type */
+                tmp_new_pool_alloc_2->type = H5_DAOS_OP_TYPE_EMPTY;
 
-                    /* Create start task */
-                    if (H5_daos_create_task(H5_daos_op_pool_start_task, 0, NULL, NULL, NULL,
-                                            tmp_new_pool_alloc_2, &tmp_new_pool_alloc_2->start_task) < 0)
-                        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                     "can't create start task for operation pool");
-                    must_schedule_higher_start_task = TRUE;
-
-                    /* If a previous higher level pool exists (and is
-                     * non-empty), create a dependency on it for tmp_pool */
-                    if (*parent_cur_op_pool[i]) {
-                        /* Create the dependency on the higher level pool's dep
-                         * task.  If the higher level pool is empty, the previous
-                         * dependency will have been handled at a lower level than
-                         * the current pool (by this line of code). */
-
-                        /* Only need to create dependencies if the higher level
-                         * pool hasn't already completed */
-                        if ((*parent_cur_op_pool[i])->end_task) {
-                            /* Create dep task for higher level pool if necessary.  This will be
-                             * completed by the end task.  We do this to prevent tse from
-                             * propagating errors between pools. */
-                            if (!(*parent_cur_op_pool[i])->dep_task) {
-                                if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL,
-                                                        &(*parent_cur_op_pool[i])->dep_task) < 0)
-                                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                                 "can't create dep task for operation pool");
-
-                                if (0 != (ret = tse_task_schedule((*parent_cur_op_pool[i])->dep_task, false)))
-                                    D_GOTO_ERROR(
-                                        H5E_VOL, H5E_CANTINIT, FAIL,
-                                        "can't schedule final dependency task for operation pool: %s",
-                                        H5_daos_err_to_string(ret));
-                            } /* end if */
-
-                            /* Create start task for tmp_pool if necessary */
-                            if (!tmp_pool->start_task) {
-                                if (H5_daos_create_task(H5_daos_op_pool_start_task, 0, NULL, NULL, NULL,
-                                                        tmp_pool, &tmp_pool->start_task) < 0)
-                                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                                 "can't create start task for operation pool");
-                                must_schedule_start_task = TRUE;
-                            } /* end if */
-
-                            /* Create dependency */
-                            if ((ret = tse_task_register_deps(tmp_pool->start_task, 1,
-                                                              &(*parent_cur_op_pool[i])->dep_task)) < 0)
+                /* Create start task */
+                if (H5_daos_create_task(H5_daos_op_pool_start_task, 0, NULL, NULL, NULL,
+                                        tmp_new_pool_alloc_2, &tmp_new_pool_alloc_2->start_task) < 0)
+                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                 "can't create start task for operation pool");
+                must_schedule_higher_start_task = TRUE;
+
+                /* If a previous higher level pool exists (and is
+                 * non-empty), create a dependency on it for tmp_pool */
+                if (*parent_cur_op_pool[i]) {
+                    /* Create the dependency on the higher level pool's dep
+                     * task.  If the higher level pool is empty, the previous
+                     * dependency will have been handled at a lower level than
+                     * the current pool (by this line of code). */
+
+                    /* Only need to create dependencies if the higher level
+                     * pool hasn't already completed */
+                    if ((*parent_cur_op_pool[i])->end_task) {
+                        /* Create dep task for higher level pool if necessary.  This will be
+                         * completed by the end task.  We do this to prevent tse from
+                         * propagating errors between pools. */
+                        if (!(*parent_cur_op_pool[i])->dep_task) {
+                            if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL,
+                                                    &(*parent_cur_op_pool[i])->dep_task) < 0)
                                 D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                             "can't register task dependency: %s",
-                                             H5_daos_err_to_string(ret));
+                                             "can't create dep task for operation pool");
+
+                            if (0 != (ret = tse_task_schedule((*parent_cur_op_pool[i])->dep_task, false)))
+                                D_GOTO_ERROR(
+                                    H5E_VOL, H5E_CANTINIT, FAIL,
+                                    "can't schedule final dependency task for operation pool: %s",
+                                    H5_daos_err_to_string(ret));
                         } /* end if */
 
-                        /* Set parent op_gens[0] */
-                        tmp_new_pool_alloc_2->op_gens[0] = (*parent_cur_op_pool[i])->op_gens[0];
-                    } /* end if */
-                    else
-                        /* Set parent op_gens[0] */
-                        tmp_new_pool_alloc_2->op_gens[0] = 0;
-
-                    /* Set new pool in parent object, and transfer parent
-                     * object's reference to the new pool */
-                    if (*parent_cur_op_pool[i])
-                        H5_daos_op_pool_free(*parent_cur_op_pool[i]);
-                    *parent_cur_op_pool[i] = tmp_new_pool_alloc_2;
-                    tmp_new_pool_alloc_2   = NULL;
-                } /* end if */
-                else if (!(*parent_cur_op_pool[i])->start_task) {
-                    /* Empty pool does not have a start task, must create one */
-                    if (H5_daos_create_task(H5_daos_op_pool_start_task, 0, NULL, NULL, NULL,
-                                            *parent_cur_op_pool[i],
-                                            &(*parent_cur_op_pool[i])->start_task) < 0)
-                        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                     "can't create start task for operation pool");
-                    must_schedule_higher_start_task = TRUE;
-                } /* end if */
+                        /* Create start task for tmp_pool if necessary */
+                        if (!tmp_pool->start_task) {
+                            if (H5_daos_create_task(H5_daos_op_pool_start_task, 0, NULL, NULL, NULL,
+                                                    tmp_pool, &tmp_pool->start_task) < 0)
+                                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                             "can't create start task for operation pool");
+                            must_schedule_start_task = TRUE;
+                        } /* end if */
 
-                /* The higher level pool is now empty, register this pool's dep
-                 * task as a dependency for the higher level pools' start tasks
-                 */
-                /* Create dep task for this pool if necessary.  This will be
-                 * completed by the end task.  We do this to prevent tse from
-                 * propagating errors between pools. */
-                if (!tmp_pool->dep_task) {
-                    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &tmp_pool->dep_task) < 0)
-                        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                     "can't create dep task for operation pool");
+                        /* Create dependency */
+                        if ((ret = tse_task_register_deps(tmp_pool->start_task, 1,
+                                                          &(*parent_cur_op_pool[i])->dep_task)) < 0)
+                            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                         "can't register task dependency: %s",
+                                         H5_daos_err_to_string(ret));
+                    } /* end if */
 
-                    if (0 != (ret = tse_task_schedule(tmp_pool->dep_task, false)))
-                        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
-                                     "can't schedule final dependency task for operation pool: %s",
-                                     H5_daos_err_to_string(ret));
+                    /* Set parent op_gens[0] */
+                    tmp_new_pool_alloc_2->op_gens[0] = (*parent_cur_op_pool[i])->op_gens[0];
                 } /* end if */
+                else
+                    /* Set parent op_gens[0] */
+                    tmp_new_pool_alloc_2->op_gens[0] = 0;
+
+                /* Set new pool in parent object, and transfer parent
+                 * object's reference to the new pool */
+                if (*parent_cur_op_pool[i])
+                    H5_daos_op_pool_free(*parent_cur_op_pool[i]);
+                *parent_cur_op_pool[i] = tmp_new_pool_alloc_2;
+                tmp_new_pool_alloc_2   = NULL;
+            } /* end if */
+            else if (!(*parent_cur_op_pool[i])->start_task) {
+                /* Empty pool does not have a start task, must create one */
+                if (H5_daos_create_task(H5_daos_op_pool_start_task, 0, NULL, NULL, NULL,
+                                        *parent_cur_op_pool[i],
+                                        &(*parent_cur_op_pool[i])->start_task) < 0)
+                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                 "can't create start task for operation pool");
+                must_schedule_higher_start_task = TRUE;
+            } /* end if */
 
-                /* Create dependency */
-                if ((ret = tse_task_register_deps((*parent_cur_op_pool[i])->start_task, 1,
-                                                  &tmp_pool->dep_task)) < 0)
-                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't register task dependency: %s",
-                                 H5_daos_err_to_string(ret));
-
-                /* Set higher level op_gen */
-                tmp_pool->op_gens[i] = (*parent_cur_op_pool[i])->op_gens[0];
+            /* The higher level pool is now empty, register this pool's dep
+             * task as a dependency for the higher level pools' start tasks
+             */
+            /* Create dep task for this pool if necessary.  This will be
+             * completed by the end task.  We do this to prevent tse from
+             * propagating errors between pools. */
+            if (!tmp_pool->dep_task) {
+                if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &tmp_pool->dep_task) < 0)
+                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                 "can't create dep task for operation pool");
 
-                /* Schedule higher level start task if required */
-                if (must_schedule_higher_start_task &&
-                    0 != (ret = tse_task_schedule((*parent_cur_op_pool[i])->start_task, false)))
+                if (0 != (ret = tse_task_schedule(tmp_pool->dep_task, false)))
                     D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
-                                 "can't schedule close task for operation pool: %s",
+                                 "can't schedule final dependency task for operation pool: %s",
                                  H5_daos_err_to_string(ret));
-            } /* end for */
+            } /* end if */
 
-            /* Pool is initialized, adjust op_gen */
-            tmp_pool->op_gens[0]++;
-        } /* end if */
-        else if (!tmp_pool->end_task) {
-            /* There is no end task, create one */
-            if (H5_daos_create_task(H5_daos_op_pool_end_task, 0, NULL, NULL, NULL, tmp_pool,
-                                    &tmp_pool->end_task) < 0)
-                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't create end task for operation pool");
-            must_schedule_end_task = TRUE;
-        } /* end if */
+            /* Create dependency */
+            if ((ret = tse_task_register_deps((*parent_cur_op_pool[i])->start_task, 1,
+                                              &tmp_pool->dep_task)) < 0)
+                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't register task dependency: %s",
+                             H5_daos_err_to_string(ret));
+
+            /* Set higher level op_gen */
+            tmp_pool->op_gens[i] = (*parent_cur_op_pool[i])->op_gens[0];
+
+            /* Schedule higher level start task if required */
+            if (must_schedule_higher_start_task &&
+                0 != (ret = tse_task_schedule((*parent_cur_op_pool[i])->start_task, false)))
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                             "can't schedule close task for operation pool: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end for */
 
-        /* Add request to the pool */
-        /* Register dependency for pool end task on this request */
-        assert(tmp_pool);
-        assert(tmp_pool->end_task);
-        if ((ret = tse_task_register_deps(tmp_pool->end_task, 1, &req->finalize_task)) < 0)
+        /* Pool is initialized, adjust op_gen */
+        tmp_pool->op_gens[0]++;
+    } /* end if */
+    else if (!tmp_pool->end_task) {
+        /* There is no end task, create one */
+        if (H5_daos_create_task(H5_daos_op_pool_end_task, 0, NULL, NULL, NULL, tmp_pool,
+                                &tmp_pool->end_task) < 0)
+            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't create end task for operation pool");
+        must_schedule_end_task = TRUE;
+    } /* end if */
+
+    /* Add request to the pool */
+    /* Register dependency for pool end task on this request */
+    assert(tmp_pool);
+    assert(tmp_pool->end_task);
+    if ((ret = tse_task_register_deps(tmp_pool->end_task, 1, &req->finalize_task)) < 0)
+        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't register task dependency: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Schedule end task if appropriate and give it a reference to the pool
+     */
+    if (must_schedule_end_task) {
+        if (0 != (ret = tse_task_schedule(tmp_pool->end_task, false)))
+            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                         "can't schedule task to end operation pool: %s", H5_daos_err_to_string(ret));
+        tmp_pool->rc++;
+    } /* end if */
+
+    if (tmp_pool->start_task) {
+        /* Register dependency for first task */
+        if ((ret = tse_task_register_deps(first_task, 1, &tmp_pool->start_task)) < 0)
             D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't register task dependency: %s",
                          H5_daos_err_to_string(ret));
 
-        /* Schedule end task if appropriate and give it a reference to the pool
-         */
-        if (must_schedule_end_task) {
-            if (0 != (ret = tse_task_schedule(tmp_pool->end_task, false)))
+        /* Schedule pool start task if appropriate. */
+        if (must_schedule_start_task)
+            if (0 != (ret = tse_task_schedule(tmp_pool->start_task, false)))
                 D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                             "can't schedule task to end operation pool: %s", H5_daos_err_to_string(ret));
-            tmp_pool->rc++;
-        } /* end if */
-
-        if (tmp_pool->start_task) {
-            /* Register dependency for first task */
-            if ((ret = tse_task_register_deps(first_task, 1, &tmp_pool->start_task)) < 0)
-                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't register task dependency: %s",
+                             "can't schedule task to start operation pool: %s",
                              H5_daos_err_to_string(ret));
+    } /* end if */
 
-            /* Schedule pool start task if appropriate. */
-            if (must_schedule_start_task)
-                if (0 != (ret = tse_task_schedule(tmp_pool->start_task, false)))
-                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
-                                 "can't schedule task to start operation pool: %s",
-                                 H5_daos_err_to_string(ret));
-        } /* end if */
+    /* Set new pool as current pool if appropriate, and transfer item's
+     * reference to the new pool */
+    if (create_new_pool) {
+        if (*parent_cur_op_pool[0])
+            H5_daos_op_pool_free(*parent_cur_op_pool[0]);
+        *parent_cur_op_pool[0] = tmp_pool;
+        tmp_pool               = NULL;
+        tmp_new_pool_alloc     = NULL;
+    } /* end if */
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0) {
+        tmp_new_pool_alloc   = DV_free(tmp_new_pool_alloc);
+        tmp_new_pool_alloc_2 = DV_free(tmp_new_pool_alloc_2);
+    } /* end if */
+
+    /* Make sure we cleaned up */
+    assert(tmp_new_pool_alloc == NULL);
+    assert(tmp_new_pool_alloc_2 == NULL);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_req_enqueue_pool() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_req_enqueue
+ *
+ * Purpose:     Adds a request to an object, file, or global operation
+ *              pool.  If collective is true it is also added to the
+ *              collective operation queue.  If dep_req is provided that
+ *              is added as a dependency.  Also schedules first_task.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Neil Fortner
+ *              October, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_req_enqueue(H5_daos_req_t *req, tse_task_t *first_task, H5_daos_item_t *item,
+                    H5_daos_op_pool_type_t op_type, H5_daos_op_pool_scope_t scope, hbool_t collective,
+                    hbool_t sync)
+{
+    return H5_daos_req_enqueue_multi(req, first_task, item ? 1 : 0, &item, op_type, scope, collective, sync);
+} /* end H5_daos_req_enqueue() */
 
-        /* Set new pool as current pool if appropriate, and transfer item's
-         * reference to the new pool */
-        if (create_new_pool) {
-            if (*parent_cur_op_pool[0])
-                H5_daos_op_pool_free(*parent_cur_op_pool[0]);
-            *parent_cur_op_pool[0] = tmp_pool;
-            tmp_pool               = NULL;
-            tmp_new_pool_alloc     = NULL;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_req_enqueue_multi
+ *
+ * Purpose:     Like H5_daos_req_enqueue(), but adds the request to the
+ *              operation pools of each of the nitems objects in items,
+ *              for operations that touch several objects.  The request
+ *              then only waits for conflicting operations on those
+ *              objects (and in enclosing scopes), instead of for every
+ *              operation in the file.  If nitems is greater than 1, all
+ *              items must be in the same file and scope must be
+ *              H5_DAOS_OP_SCOPE_OBJ.  Also schedules first_task.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_req_enqueue_multi(H5_daos_req_t *req, tse_task_t *first_task, size_t nitems, H5_daos_item_t **items,
+                          H5_daos_op_pool_type_t op_type, H5_daos_op_pool_scope_t scope, hbool_t collective,
+                          hbool_t sync)
+{
+    H5_daos_file_t      *file;
+    H5_daos_coll_lane_t *lane;
+    H5_daos_req_t       *holder;
+    size_t               i, j;
+    int                  ret;
+    herr_t               ret_value = SUCCEED;
+
+    assert(req);
+    assert(nitems == 0 || items);
+    assert(nitems <= 1 || scope == H5_DAOS_OP_SCOPE_OBJ);
+    assert(op_type >= H5_DAOS_OP_TYPE_READ && op_type <= H5_DAOS_OP_TYPE_NOPOOL);
+    assert(scope >= H5_DAOS_OP_SCOPE_ATTR && scope <= H5_DAOS_OP_SCOPE_GLOB);
+
+    /* If there's no first task there's nothing to do */
+    if (!first_task)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Requests that only read can be canceled after they start */
+    if (op_type == H5_DAOS_OP_TYPE_READ || op_type == H5_DAOS_OP_TYPE_READ_ORDERED)
+        req->cancel_in_flight = TRUE;
+
+    /* Add to the operation pool of each item, or the global pool */
+    if (op_type != H5_DAOS_OP_TYPE_NOPOOL) {
+        if (nitems == 0) {
+            if (scope == H5_DAOS_OP_SCOPE_GLOB &&
+                H5_daos_req_enqueue_pool(req, first_task, NULL, op_type, scope, sync) < 0)
+                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't add request to operation pool");
         } /* end if */
+        else
+            for (i = 0; i < nitems; i++) {
+                /* Skip items sharing an object pool with an earlier item (a
+                 * file uses its root group's pool).  Adding the request to a
+                 * pool twice could make it wait for itself. */
+                for (j = 0; j < i; j++)
+                    if (H5_daos_item_obj_pool(items[j]) == H5_daos_item_obj_pool(items[i]))
+                        break;
+                if (j < i)
+                    continue;
+
+                /* A request in several pools must not skip any of them */
+                if (H5_daos_req_enqueue_pool(req, first_task, items[i], op_type, scope,
+                                             sync && nitems == 1) < 0)
+                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't add request to operation pool");
+            } /* end for */
     }     /* end if */
 
-skip_pool:
-    /* Add dependency on H5_daos_collective_req_tail and update it if this is a
-     * collective operation.  This cannot cause a deadlock since this schedules
-     * requests in order, and requests can never be scheduled out of order by
-     * the main pool scheme above. */
-    if (collective && (!item || item->file->num_procs > 1)) {
-        if (H5_daos_collective_req_tail) {
-            /* Create dep task for previous collective request if necessary.
-             * This will be completed by the request finalize task.  We do this
-             * to prevent tse from propagating errors between requests. */
-            if (!H5_daos_collective_req_tail->dep_task) {
-                if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL,
-                                        &H5_daos_collective_req_tail->dep_task) < 0)
-                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't create dep task for request");
-
-                if (0 != (ret = tse_task_schedule(H5_daos_collective_req_tail->dep_task, false)))
-                    D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
-                                 "can't schedule final dependency task for request: %s",
-                                 H5_daos_err_to_string(ret));
+    /* Add dependency on the last collective request and update it if this is
+     * a collective operation.  Collective requests on a file are assigned to
+     * the file's collective lanes in turn and only wait for the last request
+     * in their lane, since each lane has its own communicator, so collective
+     * operations on different files or in different lanes may overlap.  A
+     * barrier request waits for the last request in every lane and becomes
+     * the last request in every lane.  This cannot cause a deadlock since
+     * this schedules requests in order, and requests can never be scheduled
+     * out of order by the main pool scheme above.
+     * Requests with a deferred collective error check are always added, since
+     * the batched check relies on them being assigned to lanes in the same
+     * order on all ranks.  Requests that were already given a lane while
+     * being set up are also always added. */
+    if ((collective || req->collective.deferred || req->collective.lane) &&
+        (nitems == 0 || items[0]->file->num_procs > 1)) {
+        if (req->file) {
+            file = req->file;
+            lane = H5_daos_req_coll_lane(req);
+
+            /* A request nested in an operation that holds a lane is placed
+             * in the issue order after the operation and the requests
+             * nested in it before */
+            if (!req->collective.lane) {
+                holder = req->parent_req;
+                while (!holder->collective.lane || holder->collective.sub_seq > 0)
+                    holder = holder->parent_req;
+                req->collective.lane    = lane;
+                req->collective.seq     = holder->collective.seq;
+                req->collective.sub_seq = ++holder->collective.nsub;
             } /* end if */
 
-            /* Create dependency */
-            if ((ret = tse_task_register_deps(first_task, 1, &H5_daos_collective_req_tail->dep_task)) < 0)
-                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't register task dependency: %s",
-                             H5_daos_err_to_string(ret));
-        } /* end if */
+            if (req->collective.barrier) {
+                for (i = 0; i < file->ncoll_lanes; i++) {
+                    /* Skip requests that are also the last request of an
+                     * earlier lane */
+                    for (j = 0; j < i; j++)
+                        if (file->coll_lanes[j].req_tail == file->coll_lanes[i].req_tail)
+                            break;
+                    if (j == i && H5_daos_req_coll_dep(file->coll_lanes[i].req_tail, first_task) < 0)
+                        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                     "can't add dependency on collective request");
+                } /* end for */
+                for (i = 0; i < file->ncoll_lanes; i++)
+                    file->coll_lanes[i].req_tail = req;
+            } /* end if */
+            else {
+                if (H5_daos_req_coll_dep(lane->req_tail, first_task) < 0)
+                    D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                                 "can't add dependency on collective request");
+                lane->req_tail = req;
+            } /* end else */
+        }     /* end if */
+        else {
+            if (H5_daos_req_coll_dep(H5_daos_collective_req_tail, first_task) < 0)
+                D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL,
+                             "can't add dependency on collective request");
+            H5_daos_collective_req_tail = req;
+        } /* end else */
+
+        req->collective.chained = TRUE;
 
-        H5_daos_collective_req_tail = req;
+        /* Count deferred collective error checks */
+        if (req->collective.deferred) {
+            req->collective.ordered   = TRUE;
+            req->collective.flush_gen = req->file->coll_err_batch.flush_gen;
+            req->file->coll_err_batch.nqueued++;
+        } /* end if */
     } /* end if */
 
     /* Add dependencies on prerequisites if necessary */
@@ -914,15 +1150,135 @@ done:
         D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule first task for operation: %s",
                      H5_daos_err_to_string(ret));
 
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        tmp_new_pool_alloc   = DV_free(tmp_new_pool_alloc);
-        tmp_new_pool_alloc_2 = DV_free(tmp_new_pool_alloc_2);
+    /* Flush deferred collective error checks if this is a synchronous
+     * operation (which must not be left pending) or the batch is full */
+    if (ret_value >= 0 && req->collective.ordered &&
+        (sync || req->file->coll_err_batch.nqueued >= req->file->fapl_cache.coll_err_batch))
+        if (H5_daos_collective_error_check_flush(req->file) < 0)
+            D_DONE_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't check deferred collective errors");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_req_enqueue_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_req_coll_dep
+ *
+ * Purpose:     Makes first_task depend on the completion of the
+ *              collective request prev_req, if it is not NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_req_coll_dep(H5_daos_req_t *prev_req, tse_task_t *first_task)
+{
+    int    ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(first_task);
+
+    if (!prev_req)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Create dep task for previous collective request if necessary.  This
+     * will be completed by the request finalize task.  We do this to prevent
+     * tse from propagating errors between requests. */
+    if (!prev_req->dep_task) {
+        if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &prev_req->dep_task) < 0)
+            D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't create dep task for request");
+
+        if (0 != (ret = tse_task_schedule(prev_req->dep_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule final dependency task for request: %s",
+                         H5_daos_err_to_string(ret));
     } /* end if */
 
-    /* Make sure we cleaned up */
-    assert(tmp_new_pool_alloc == NULL);
-    assert(tmp_new_pool_alloc_2 == NULL);
+    /* Create dependency */
+    if ((ret = tse_task_register_deps(first_task, 1, &prev_req->dep_task)) < 0)
+        D_GOTO_ERROR(H5E_DAOS_ASYNC, H5E_CANTINIT, FAIL, "can't register task dependency: %s",
+                     H5_daos_err_to_string(ret));
 
+done:
     D_FUNC_LEAVE;
-} /* end H5_daos_req_enqueue() */
+} /* end H5_daos_req_coll_dep() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_req_coll_lane
+ *
+ * Purpose:     Returns the collective lane of the operation req is part
+ *              of, which is the lane of req or of the closest of its
+ *              parent requests that has one.  If none has a lane yet,
+ *              the outermost request is assigned the next lane of its
+ *              file in turn.  Since lanes must be assigned in the same
+ *              order on all ranks, this must first be called for an
+ *              operation while it is set up or enqueued, not from a
+ *              task.
+ *
+ * Return:      The collective lane
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_daos_coll_lane_t *
+H5_daos_req_coll_lane(H5_daos_req_t *req)
+{
+    H5_daos_file_t *file;
+
+    assert(req);
+
+    /* Find the request holding the lane, or the outermost request */
+    while (!req->collective.lane && req->parent_req)
+        req = req->parent_req;
+
+    /* Assign the next lane */
+    if (!req->collective.lane) {
+        file = req->file;
+        assert(file);
+        assert(file->ncoll_lanes > 0);
+
+        req->collective.seq  = file->coll_seq++;
+        req->collective.lane = &file->coll_lanes[req->collective.seq % file->ncoll_lanes];
+    } /* end if */
+
+    return req->collective.lane;
+} /* end H5_daos_req_coll_lane() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_req_enqueue_create
+ *
+ * Purpose:     Adds the request for an object create to an operation
+ *              pool and schedules first_task.  A create that links the
+ *              new object into loc_item goes into loc_item's pool.  An
+ *              anonymous create (anon true) touches only the new object,
+ *              so it goes into new_item's pool instead of the file pool,
+ *              and neither waits for nor holds up other operations in
+ *              the file.  If setup failed before the new object was
+ *              created (new_item NULL), an anonymous create falls back to
+ *              the file pool.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_req_enqueue_create(H5_daos_req_t *req, tse_task_t *first_task, H5_daos_item_t *loc_item,
+                           H5_daos_item_t *new_item, hbool_t anon, H5_daos_op_pool_type_t op_type,
+                           hbool_t collective, hbool_t sync)
+{
+    H5_daos_item_t         *item;
+    H5_daos_op_pool_scope_t scope;
+
+    if (!anon) {
+        item  = loc_item;
+        scope = H5_DAOS_OP_SCOPE_OBJ;
+    } /* end if */
+    else if (new_item) {
+        item  = new_item;
+        scope = H5_DAOS_OP_SCOPE_OBJ;
+    } /* end if */
+    else {
+        item  = loc_item;
+        scope = H5_DAOS_OP_SCOPE_FILE;
+    } /* end else */
+
+    return H5_daos_req_enqueue(req, first_task, item, op_type, scope, collective, sync);
+} /* end H5_daos_req_enqueue_create() */
@@ -30,7 +30,7 @@ H5daos_get_poh(hid_t file_id, daos_handle_t *poh)
     H5_daos_file_t *file      = NULL;
     herr_t          ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     if (file_id < 0)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file ID is invalid");
@@ -63,7 +63,7 @@ H5daos_get_pool(hid_t file_id, char *pool)
     H5_daos_file_t *file      = NULL;
     herr_t          ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    H5_daos_inc_public_api_cnt();
 
     if (file_id < 0)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file ID is invalid");
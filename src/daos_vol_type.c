@@ -32,9 +32,6 @@ static int H5_daos_datatype_open_recv_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_datatype_open_end(H5_daos_dtype_t *dtype, uint8_t *p, uint64_t type_buf_len,
                                      uint64_t tcpl_buf_len, hid_t dxpl_id);
 
-static htri_t H5_daos_need_bkg(hid_t src_type_id, hid_t dst_type_id, hbool_t dst_file, size_t *dst_type_size,
-                               hbool_t *fill_bkg);
-
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_detect_vl_vlstr_ref
  *
@@ -197,7 +194,7 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-static htri_t
+htri_t
 H5_daos_need_bkg(hid_t src_type_id, hid_t dst_type_id, hbool_t dst_file, size_t *dst_type_size,
                  hbool_t *fill_bkg)
 {
@@ -605,11 +602,9 @@ done:
             op_type = H5_DAOS_OP_TYPE_WRITE_ORDERED;
 
         /* Add the request to the object's request queue.  This will add the
-         * dependency on the group open if necessary.  If this is an anonymous
-         * create add to the file pool. */
-        if (H5_daos_req_enqueue(int_req, first_task, item, op_type,
-                                target_obj ? H5_DAOS_OP_SCOPE_OBJ : H5_DAOS_OP_SCOPE_FILE, collective,
-                                !req) < 0)
+         * dependency on the group open if necessary. */
+        if (H5_daos_req_enqueue_create(int_req, first_task, item, ret_value ? &dtype->obj.item : NULL,
+                                       !target_obj, op_type, collective, !req) < 0)
             D_DONE_ERROR(H5E_DATATYPE, H5E_CANTINIT, NULL, "can't add request to request queue");
 
         /* Check for external async */
@@ -1045,7 +1040,8 @@ done:
     /* Cleanup on failure */
     if (NULL == ret_value) {
         /* Broadcast datatype info if needed */
-        if (must_bcast && H5_daos_mpi_ibcast(NULL, &dtype->obj, H5_DAOS_TINFO_BCAST_BUF_SIZE, TRUE, NULL,
+        if (must_bcast && H5_daos_mpi_ibcast(NULL, &dtype->obj, H5_DAOS_TINFO_BCAST_BUF_SIZE, TRUE, TRUE,
+                                             NULL,
                                              item->file->my_rank == 0 ? H5_daos_datatype_open_bcast_comp_cb
                                                                       : H5_daos_datatype_open_recv_comp_cb,
                                              int_req, &first_task, &dep_task) < 0)
@@ -1176,7 +1172,7 @@ H5_daos_datatype_open_helper(H5_daos_file_t *file, hid_t tapl_id, hbool_t collec
         bcast_udata->bcast_udata.buffer     = bcast_udata->flex_buf;
         bcast_udata->bcast_udata.buffer_len = H5_DAOS_TINFO_BCAST_BUF_SIZE;
         bcast_udata->bcast_udata.count      = H5_DAOS_TINFO_BCAST_BUF_SIZE;
-        bcast_udata->bcast_udata.comm       = req->file->comm;
+        bcast_udata->bcast_udata.lane       = NULL;
 
         tinfo_buf_size = H5_DAOS_TINFO_BCAST_BUF_SIZE;
     } /* end if */
@@ -1296,7 +1292,7 @@ done:
     if (bcast_udata) {
         assert(tinfo_buf_size == H5_DAOS_TINFO_BCAST_BUF_SIZE);
         if (H5_daos_mpi_ibcast(&bcast_udata->bcast_udata, &dtype->obj, tinfo_buf_size,
-                               NULL == ret_value ? TRUE : FALSE, NULL,
+                               NULL == ret_value ? TRUE : FALSE, TRUE, NULL,
                                file->my_rank == 0 ? H5_daos_datatype_open_bcast_comp_cb
                                                   : H5_daos_datatype_open_recv_comp_cb,
                                req, first_task, dep_task) < 0) {
@@ -2068,6 +2064,7 @@ H5_daos_datatype_close_real(H5_daos_dtype_t *dtype)
         if (dtype->tapl_id != H5I_INVALID_HID && dtype->tapl_id != H5P_DATATYPE_ACCESS_DEFAULT)
             if (H5Idec_ref(dtype->tapl_id) < 0)
                 D_DONE_ERROR(H5E_DATATYPE, H5E_CANTDEC, FAIL, "failed to close tapl");
+        H5_daos_name_cache_free(&dtype->obj.attr_name_cache);
         dtype = H5FL_FREE(H5_daos_dtype_t, dtype);
     } /* end if */
 
@@ -285,12 +285,16 @@ typedef enum {
 #define D_FUNC_LEAVE_API                                                                                     \
     do {                                                                                                     \
         /* If at the top level of connector callbacks, make                                                  \
-         * all "unsafe" task list tasks available.                                                           \
+         * all "unsafe" task list tasks available.  Public                                                   \
+         * routines that take no lock leave this to the                                                      \
+         * background progress thread if it is running.                                                      \
          */                                                                                                  \
-        H5_daos_dec_api_cnt();                                                                               \
-        if ((H5_daos_api_count == 0) && H5_daos_task_list_g)                                                 \
+        if ((H5_daos_api_count == 1) && H5_daos_task_list_g &&                                               \
+            (H5_daos_api_locked || !H5_daos_progress_thread_on_g))                                           \
             H5_daos_task_list_safe(H5_daos_task_list_g);                                                     \
         PRINT_ERROR_STACK;                                                                                   \
+        /* Only now let the background progress thread back in */                                          \
+        H5_daos_dec_api_cnt();                                                                               \
         return ret_value;                                                                                    \
     } while (0)
 
@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: Implements typed free lists for the structures the connector
+ *          allocates for every chunk I/O or link operation, so that these
+ *          do not go through malloc and free each time. Typical usage
+ *          would be as follows:
+ *
+ *          1. Declare a free list for a type at file scope with
+ *             H5_DAOS_FL_DEFINE_STATIC
+ *          2. Allocate blocks of that type with H5_DAOS_FL_MALLOC or
+ *             H5_DAOS_FL_CALLOC instead of DV_malloc/DV_calloc
+ *          3. Return blocks with H5_DAOS_FL_FREE instead of DV_free,
+ *             including from task completion callbacks
+ *
+ *          Each free list is a singly-linked stack of freed blocks, with
+ *          the link stored in the block itself. At most
+ *          H5_DAOS_FREE_LIST_MAX_FREE blocks are kept on a list; blocks
+ *          beyond that are returned to the system. Free lists register
+ *          themselves on first use so that H5_daos_free_list_term can
+ *          release all cached blocks when the connector is terminated and
+ *          H5_daos_free_list_get_stats can report on all of them.
+ *
+ *          Free lists are not thread-safe, like the rest of the
+ *          connector's state. They are only used while holding the API
+ *          mutex or from the task scheduler.
+ */
+
+#include "daos_vol_free_list.h"
+
+#include "daos_vol_private.h"
+
+#include "daos_vol_mem.h"
+
+/* Freed block, reusing the block's own memory for the link */
+typedef struct H5_daos_free_list_node_t {
+    struct H5_daos_free_list_node_t *next;
+} H5_daos_free_list_node_t;
+
+/* All free lists used so far */
+static H5_daos_free_list_t *H5_daos_free_lists_g = NULL;
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_free_list_malloc
+ *
+ * Purpose:     Allocates a block from the given free list, re-using a
+ *              previously freed block if one is available.
+ *
+ * Return:      Success:    Pointer to new block
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5_daos_free_list_malloc(H5_daos_free_list_t *fl)
+{
+    H5_daos_free_list_node_t *node;
+    void                     *ret_value = NULL;
+
+    assert(fl);
+    assert(fl->block_size >= sizeof(H5_daos_free_list_node_t));
+
+    /* Register the free list on first use */
+    if (!fl->registered) {
+        fl->next             = H5_daos_free_lists_g;
+        H5_daos_free_lists_g = fl;
+        fl->registered       = TRUE;
+    } /* end if */
+
+    if (fl->head) {
+        /* Pop block from head of list */
+        node     = (H5_daos_free_list_node_t *)fl->head;
+        fl->head = node->next;
+        fl->stats.ncached--;
+        fl->stats.cached_bytes -= fl->block_size;
+        fl->stats.nreused++;
+        ret_value = node;
+    } /* end if */
+    else if (NULL == (ret_value = DV_malloc(fl->block_size)))
+        return NULL;
+
+    fl->stats.nallocs++;
+
+    return ret_value;
+} /* end H5_daos_free_list_malloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_free_list_calloc
+ *
+ * Purpose:     Allocates a block from the given free list and clears it.
+ *
+ * Return:      Success:    Pointer to new block
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5_daos_free_list_calloc(H5_daos_free_list_t *fl)
+{
+    void *ret_value = NULL;
+
+    assert(fl);
+
+    if (NULL != (ret_value = H5_daos_free_list_malloc(fl)))
+        memset(ret_value, 0, fl->block_size);
+
+    return ret_value;
+} /* end H5_daos_free_list_calloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_free_list_free
+ *
+ * Purpose:     Returns a block to the given free list for re-use, or to
+ *              the system if the free list is already full. block may be
+ *              NULL, in which case nothing is done.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5_daos_free_list_free(H5_daos_free_list_t *fl, void *block)
+{
+    H5_daos_free_list_node_t *node;
+
+    assert(fl);
+
+    if (!block)
+        return NULL;
+
+    assert(fl->registered);
+
+    fl->stats.nfrees++;
+
+    if (fl->stats.ncached >= H5_DAOS_FREE_LIST_MAX_FREE)
+        return DV_free(block);
+
+    /* Push block to head of list */
+    node       = (H5_daos_free_list_node_t *)block;
+    node->next = (H5_daos_free_list_node_t *)fl->head;
+    fl->head   = node;
+    fl->stats.ncached++;
+    fl->stats.cached_bytes += fl->block_size;
+
+    return NULL;
+} /* end H5_daos_free_list_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_free_list_term
+ *
+ * Purpose:     Returns all blocks cached on all free lists to the system
+ *              and resets the free lists' statistics. Must be called
+ *              before checking for leaked memory.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_free_list_term(void)
+{
+    H5_daos_free_list_t      *fl;
+    H5_daos_free_list_t      *next_fl;
+    H5_daos_free_list_node_t *node;
+
+    for (fl = H5_daos_free_lists_g; fl; fl = next_fl) {
+        next_fl = fl->next;
+
+        while (fl->head) {
+            node     = (H5_daos_free_list_node_t *)fl->head;
+            fl->head = node->next;
+            DV_free(node);
+        } /* end while */
+
+        memset(&fl->stats, 0, sizeof(fl->stats));
+        fl->next       = NULL;
+        fl->registered = FALSE;
+    } /* end for */
+
+    H5_daos_free_lists_g = NULL;
+} /* end H5_daos_free_list_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_free_list_get_stats
+ *
+ * Purpose:     Retrieves allocator statistics summed over all free lists
+ *              used so far.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_free_list_get_stats(H5_daos_alloc_stats_t *stats)
+{
+    H5_daos_free_list_t *fl;
+
+    assert(stats);
+
+    memset(stats, 0, sizeof(*stats));
+
+    for (fl = H5_daos_free_lists_g; fl; fl = fl->next) {
+        stats->nallocs += fl->stats.nallocs;
+        stats->nreused += fl->stats.nreused;
+        stats->nfrees += fl->stats.nfrees;
+        stats->ncached += fl->stats.ncached;
+        stats->cached_bytes += fl->stats.cached_bytes;
+    } /* end for */
+} /* end H5_daos_free_list_get_stats() */
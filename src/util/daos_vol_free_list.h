@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef DAOS_VOL_FREE_LIST_H_
+#define DAOS_VOL_FREE_LIST_H_
+
+#include "daos_vol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Maximum number of freed blocks kept on a single free list for re-use */
+#define H5_DAOS_FREE_LIST_MAX_FREE 4096
+
+/* Free list structure */
+typedef struct H5_daos_free_list_t {
+    const char                 *name;
+    size_t                      block_size;
+    hbool_t                     registered;
+    struct H5_daos_free_list_t *next;
+    void                       *head;
+    H5_daos_alloc_stats_t       stats;
+} H5_daos_free_list_t;
+
+/* Static initializer for a free list of blocks of type t */
+#define H5_DAOS_FREE_LIST_INITIALIZER(t)                                                                     \
+    {                                                                                                        \
+        #t, sizeof(t), FALSE, NULL, NULL, { 0 }                                                              \
+    }
+
+/* Convenience macros, modeled on HDF5's H5FL interface, to declare and use a
+ * file-local free list for blocks of type t */
+#define H5_DAOS_FL_DEFINE_STATIC(t) static H5_daos_free_list_t t##_fl_g = H5_DAOS_FREE_LIST_INITIALIZER(t)
+#define H5_DAOS_FL_MALLOC(t)        ((t *)H5_daos_free_list_malloc(&t##_fl_g))
+#define H5_DAOS_FL_CALLOC(t)        ((t *)H5_daos_free_list_calloc(&t##_fl_g))
+#define H5_DAOS_FL_FREE(t, obj)     ((t *)H5_daos_free_list_free(&t##_fl_g, obj))
+
+/* Allocates a block from the given free list */
+void *H5_daos_free_list_malloc(H5_daos_free_list_t *fl);
+
+/* Allocates a zeroed block from the given free list */
+void *H5_daos_free_list_calloc(H5_daos_free_list_t *fl);
+
+/* Returns a block to the given free list.  Always returns NULL. */
+void *H5_daos_free_list_free(H5_daos_free_list_t *fl, void *block);
+
+/* Releases all cached blocks on all free lists */
+void H5_daos_free_list_term(void);
+
+/* Retrieves allocator statistics summed over all free lists */
+void H5_daos_free_list_get_stats(H5_daos_alloc_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DAOS_VOL_FREE_LIST_H_ */
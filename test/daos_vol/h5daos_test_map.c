@@ -22,6 +22,23 @@
 #define NUMB_KEYS       4 /* Don't set this too high because this test uses linear search */
 #define LARGE_NUMB_KEYS 1024
 #define LARGE_NUMB_MAPS 128
+#define MULTI_NUMB_KEYS 64
+#define ASYNC_NUMB_KEYS 256
+#define COUNT_NUMB_KEYS 32
+#define COUNT_DEL_KEYS  8
+#define BLOOM_NUMB_KEYS 64
+#define BLOOM_NBITS     4096
+#define RANGE_NUMB_KEYS 64
+#define PARTIAL_NELMTS  64
+#define CORDER_NOBJS    16
+#define CORDER_NAME_LEN 16
+#define CANCEL_NKEYS    256
+#define KV_NUMB_KEYS    100
+#define KV_BATCH        8
+#define KV_STOP         13
+
+/* Creation order test deletes the first, the last and a run in the middle */
+#define CORDER_DELETED(I) ((I) == 0 || ((I) >= 5 && (I) <= 7) || (I) == CORDER_NOBJS - 1)
 
 #define MAP_INT_INT_NAME       "map_int_int"
 #define MAP_ENUM_ENUM_NAME     "map_enum_enum"
@@ -35,6 +52,18 @@
 #define MAP_VL_TCONV2_NAME     "map_vl_tconv2"
 #define MAP_MANY_ENTRIES_NAME  "map_many_entries"
 #define MAP_NONEXISTENT_MAP    "map_nonexistent"
+#define MAP_MULTI_NAME         "map_multi"
+#define MAP_ASYNC_NAME         "map_async"
+#define MAP_COUNT_NAME         "map_count"
+#define MAP_BLOOM_NAME         "map_bloom"
+#define MAP_RANGE_INT_NAME     "map_range_int"
+#define MAP_RANGE_UINT_NAME    "map_range_uint"
+#define MAP_PARTIAL_NAME       "map_partial"
+#define MAP_PARTIAL_OOL_NAME   "map_partial_ool"
+#define CORDER_GROUP_NAME      "corder_group"
+#define CORDER_MAP_NAME        "corder_map"
+#define MAP_CANCEL_NAME        "map_cancel"
+#define MAP_KV_NAME            "map_kv"
 
 #define CPTR(VAR, CONST) ((VAR) = (CONST), &(VAR))
 
@@ -4602,6 +4631,1552 @@ error:
     return 1;
 } /* end test_nonexistent_map() */
 
+/*
+ * Tests H5daos_map_put_multi(), H5daos_map_get_multi() and
+ * H5daos_map_exists_multi()
+ */
+static int
+test_multi(hid_t file_id)
+{
+    hid_t   map_id = -1;
+    int     keys[MULTI_NUMB_KEYS];
+    int     vals[MULTI_NUMB_KEYS];
+    int     vals_out[MULTI_NUMB_KEYS];
+    int     probe_keys[2 * MULTI_NUMB_KEYS];
+    hbool_t exists[2 * MULTI_NUMB_KEYS];
+    herr_t  statuses[2 * MULTI_NUMB_KEYS];
+    hsize_t count;
+    herr_t  ret;
+    int     i;
+
+    TESTING("multi-key put, get and exists");
+    HDputs("");
+
+    /* Even keys are put in the map, odd keys are not */
+    for (i = 0; i < MULTI_NUMB_KEYS; i++) {
+        keys[i]               = 2 * i;
+        vals[i]               = rand();
+        probe_keys[2 * i]     = 2 * i;
+        probe_keys[2 * i + 1] = 2 * i + 1;
+    } /* end for */
+
+    if ((map_id = H5Mcreate(file_id, MAP_MULTI_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT,
+                            H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    TESTING_2("H5daos_map_put_multi()");
+
+    memset(statuses, -1, sizeof(statuses));
+    if (H5daos_map_put_multi(map_id, H5T_NATIVE_INT, MULTI_NUMB_KEYS, keys, H5T_NATIVE_INT, vals, statuses,
+                             H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to put keys\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < MULTI_NUMB_KEYS; i++)
+        if (statuses[i] < 0) {
+            H5_FAILED();
+            AT();
+            printf("failed status returned for key index %d\n", i);
+            goto error;
+        } /* end if */
+    if (H5Mget_count(map_id, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (count != (hsize_t)MULTI_NUMB_KEYS) {
+        H5_FAILED();
+        AT();
+        printf("incorrect count after put: %llu\n", (long long unsigned)count);
+        goto error;
+    } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5daos_map_get_multi()");
+
+    memset(vals_out, 0, sizeof(vals_out));
+    memset(statuses, -1, sizeof(statuses));
+    if (H5daos_map_get_multi(map_id, H5T_NATIVE_INT, MULTI_NUMB_KEYS, keys, H5T_NATIVE_INT, vals_out,
+                             statuses, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to get keys\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < MULTI_NUMB_KEYS; i++)
+        if (statuses[i] < 0 || vals_out[i] != vals[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value returned for key index %d\n", i);
+            goto error;
+        } /* end if */
+
+    /* Getting a key that is not in the map fails for that key only */
+    H5E_BEGIN_TRY
+    {
+        ret = H5daos_map_get_multi(map_id, H5T_NATIVE_INT, 4, probe_keys, H5T_NATIVE_INT, vals_out, statuses,
+                                   H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("getting nonexistent keys should have failed\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < 4; i++)
+        if ((statuses[i] < 0) != (i % 2 == 1)) {
+            H5_FAILED();
+            AT();
+            printf("incorrect status returned for probe index %d\n", i);
+            goto error;
+        } /* end if */
+    if (vals_out[0] != vals[0] || vals_out[2] != vals[1]) {
+        H5_FAILED();
+        AT();
+        printf("incorrect value returned for existing key\n");
+        goto error;
+    } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5daos_map_exists_multi()");
+
+    memset(statuses, -1, sizeof(statuses));
+    if (H5daos_map_exists_multi(map_id, H5T_NATIVE_INT, 2 * MULTI_NUMB_KEYS, probe_keys, exists, statuses,
+                                H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to check if keys exist\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < 2 * MULTI_NUMB_KEYS; i++)
+        if (statuses[i] < 0 || !exists[i] != (i % 2 == 1)) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value returned for probe index %d\n", i);
+            goto error;
+        } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_multi() */
+
+/*
+ * Tests asynchronous map put and get through an event set
+ */
+static int
+test_async(hid_t file_id)
+{
+    hid_t   map_id = -1;
+    hid_t   es_id  = -1;
+    int     keys[ASYNC_NUMB_KEYS];
+    int     vals[ASYNC_NUMB_KEYS];
+    int     vals_out[ASYNC_NUMB_KEYS];
+    size_t  num_in_progress;
+    hbool_t op_failed;
+    hbool_t exists;
+    int     i;
+
+    TESTING("asynchronous put and get");
+    HDputs("");
+
+    for (i = 0; i < ASYNC_NUMB_KEYS; i++) {
+        keys[i] = i;
+        vals[i] = rand();
+    } /* end for */
+
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    if ((map_id = H5Mcreate(file_id, MAP_ASYNC_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT,
+                            H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    TESTING_2("H5Mput_async()");
+
+    for (i = 0; i < ASYNC_NUMB_KEYS; i++)
+        if (H5Mput_async(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals[i], H5P_DEFAULT, es_id) <
+            0) {
+            H5_FAILED();
+            AT();
+            printf("failed to put key %d\n", i);
+            goto error;
+        } /* end if */
+
+    /* A synchronous operation on the map is ordered after the puts still in
+     * flight, so it must see the last key */
+    if (H5Mexists(map_id, H5T_NATIVE_INT, &keys[ASYNC_NUMB_KEYS - 1], &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (!exists) {
+        H5_FAILED();
+        AT();
+        printf("key put asynchronously not found\n");
+        goto error;
+    } /* end if */
+
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous puts failed\n");
+        goto error;
+    } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5Mget_async()");
+
+    memset(vals_out, 0, sizeof(vals_out));
+    for (i = 0; i < ASYNC_NUMB_KEYS; i++)
+        if (H5Mget_async(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals_out[i], H5P_DEFAULT, es_id) <
+            0) {
+            H5_FAILED();
+            AT();
+            printf("failed to get key %d\n", i);
+            goto error;
+        } /* end if */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous gets failed\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < ASYNC_NUMB_KEYS; i++)
+        if (vals_out[i] != vals[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value returned for key %d\n", i);
+            goto error;
+        } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("asynchronous get ordered after put");
+
+    /* Overwrite each value and read it back without waiting in between */
+    for (i = 0; i < ASYNC_NUMB_KEYS; i++) {
+        vals[i]     = ~vals[i];
+        vals_out[i] = 0;
+        if (H5Mput_async(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals[i], H5P_DEFAULT, es_id) <
+            0)
+            TEST_ERROR;
+        if (H5Mget_async(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals_out[i], H5P_DEFAULT, es_id) <
+            0)
+            TEST_ERROR;
+    } /* end for */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous put and get failed\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < ASYNC_NUMB_KEYS; i++)
+        if (vals_out[i] != vals[i]) {
+            H5_FAILED();
+            AT();
+            printf("get did not see preceding put for key %d\n", i);
+            goto error;
+        } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+        H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_async() */
+
+/*
+ * Tests that H5Mget_count() follows puts of new keys, overwrites and
+ * deletes, through one handle and through two handles open at once
+ */
+static int
+test_count(hid_t file_id)
+{
+    hid_t map_id  = -1;
+    hid_t map_id2 = -1;
+    int   key;
+    int   val;
+    int   i;
+
+    TESTING("entry count after put, overwrite and delete");
+    HDputs("");
+
+    if ((map_id = H5Mcreate(file_id, MAP_COUNT_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT,
+                            H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    TESTING_2("H5Mget_count() after put");
+    for (key = 0; key < COUNT_NUMB_KEYS; key++) {
+        val = rand();
+        if (H5Mput(map_id, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    map_id = -1;
+    if (test_map_get_count(file_id, MAP_COUNT_NAME, COUNT_NUMB_KEYS, FALSE))
+        goto error;
+    PASSED();
+    fflush(stdout);
+
+    if ((map_id = H5Mopen(file_id, MAP_COUNT_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    TESTING_2("H5Mget_count() after overwrite");
+    for (key = 0; key < COUNT_NUMB_KEYS; key++) {
+        val = rand();
+        if (H5Mput(map_id, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if (test_map_get_count(file_id, MAP_COUNT_NAME, COUNT_NUMB_KEYS, FALSE))
+        goto error;
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5Mget_count() after delete");
+    for (key = 0; key < COUNT_DEL_KEYS; key++)
+        if (H5Mdelete(map_id, H5T_NATIVE_INT, &key, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+    if (test_map_get_count(file_id, MAP_COUNT_NAME, COUNT_NUMB_KEYS - COUNT_DEL_KEYS, FALSE))
+        goto error;
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    map_id = -1;
+    if (test_map_get_count(file_id, MAP_COUNT_NAME, COUNT_NUMB_KEYS - COUNT_DEL_KEYS, FALSE))
+        goto error;
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5Mget_count() with two handles");
+
+    /* Each handle puts new keys, and the second also overwrites a key put
+     * by the first, which must not be counted twice */
+    if ((map_id = H5Mopen(file_id, MAP_COUNT_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((map_id2 = H5Mopen(file_id, MAP_COUNT_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < COUNT_DEL_KEYS; i++) {
+        key = COUNT_NUMB_KEYS + i;
+        val = rand();
+        if (H5Mput(map_id, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        key = COUNT_NUMB_KEYS + COUNT_DEL_KEYS + i;
+        if (H5Mput(map_id2, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+    } /* end for */
+    key = COUNT_NUMB_KEYS;
+    if (H5Mput(map_id2, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (test_map_get_count(file_id, MAP_COUNT_NAME, COUNT_NUMB_KEYS + COUNT_DEL_KEYS, FALSE))
+        goto error;
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    map_id = -1;
+    if (H5Mclose(map_id2) < 0)
+        TEST_ERROR;
+    map_id2 = -1;
+    if (test_map_get_count(file_id, MAP_COUNT_NAME, COUNT_NUMB_KEYS + COUNT_DEL_KEYS, FALSE))
+        goto error;
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+        H5Mclose(map_id2);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_count() */
+
+/*
+ * Tests H5Mexists() on a map with a Bloom filter, which must never report a
+ * key put through any handle, or by any rank before a collective flush, as
+ * absent
+ */
+static int
+test_bloom(hid_t file_id)
+{
+    hid_t    mcpl_id = -1;
+    hid_t    map_id  = -1;
+    hid_t    map_id2 = -1;
+    uint64_t nbits;
+    hbool_t  exists;
+    int      mpi_size;
+    int      key;
+    int      val;
+    int      i;
+
+    TESTING("map Bloom filter");
+    HDputs("");
+
+    if ((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5daos_set_map_bloom_filter(mcpl_id, BLOOM_NBITS) < 0)
+        TEST_ERROR;
+    if (H5daos_get_map_bloom_filter(mcpl_id, &nbits) < 0)
+        TEST_ERROR;
+    if (nbits != BLOOM_NBITS) {
+        H5_FAILED();
+        AT();
+        printf("incorrect Bloom filter size returned: %llu\n", (long long unsigned)nbits);
+        goto error;
+    } /* end if */
+
+    if ((map_id = H5Mcreate(file_id, MAP_BLOOM_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT, mcpl_id,
+                            H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    TESTING_2("H5Mexists() with Bloom filter");
+
+    /* Even keys are put in the map, odd keys are not */
+    for (key = 0; key < 2 * BLOOM_NUMB_KEYS; key += 2) {
+        val = rand();
+        if (H5Mput(map_id, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+    } /* end for */
+    for (key = 0; key < 2 * BLOOM_NUMB_KEYS; key++) {
+        if (H5Mexists(map_id, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (!exists != (key % 2 == 1)) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value returned for key %d\n", key);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* The filter must be saved when the map is closed */
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    if ((map_id = H5Mopen(file_id, MAP_BLOOM_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (key = 0; key < 2 * BLOOM_NUMB_KEYS; key++) {
+        if (H5Mexists(map_id, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (!exists != (key % 2 == 1)) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value returned for key %d after reopen\n", key);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5Mexists() for key put through another handle");
+
+    if ((map_id2 = H5Mopen(file_id, MAP_BLOOM_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* A key put through one open handle must exist through the other */
+    key = 2 * BLOOM_NUMB_KEYS + 1;
+    val = rand();
+    if (H5Mput(map_id, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (H5Mexists(map_id2, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (!exists) {
+        H5_FAILED();
+        AT();
+        printf("key put through another handle reported absent\n");
+        goto error;
+    } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5Mexists() after closing two modified handles");
+
+    /* Both handles add keys the other has not seen, so closing the second
+     * must not erase the bits saved by the first */
+    key = 2 * BLOOM_NUMB_KEYS + 3;
+    if (H5Mput(map_id2, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    map_id = -1;
+    if (H5Mclose(map_id2) < 0)
+        TEST_ERROR;
+    map_id2 = -1;
+
+    if ((map_id = H5Mopen(file_id, MAP_BLOOM_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (key = 2 * BLOOM_NUMB_KEYS + 1; key <= 2 * BLOOM_NUMB_KEYS + 3; key += 2) {
+        if (H5Mexists(map_id, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (!exists) {
+            H5_FAILED();
+            AT();
+            printf("key %d reported absent after both handles were closed\n", key);
+            goto error;
+        } /* end if */
+    } /* end for */
+    key = 2 * BLOOM_NUMB_KEYS + 5;
+    if (H5Mexists(map_id, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (exists) {
+        H5_FAILED();
+        AT();
+        printf("key that was never put reported present\n");
+        goto error;
+    } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5Mexists() for keys put by other ranks after H5Fflush");
+
+    if (MPI_SUCCESS != MPI_Comm_size(MPI_COMM_WORLD, &mpi_size))
+        TEST_ERROR;
+
+    /* Each rank puts its own key.  After a collective flush every rank must
+     * see the keys put by all ranks. */
+    key = 2 * BLOOM_NUMB_KEYS + 7 + 2 * mpi_rank;
+    val = rand();
+    if (H5Mput(map_id, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+    for (i = 0; i < mpi_size; i++) {
+        key = 2 * BLOOM_NUMB_KEYS + 7 + 2 * i;
+        if (H5Mexists(map_id, H5T_NATIVE_INT, &key, &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (!exists) {
+            H5_FAILED();
+            AT();
+            printf("key put by rank %d reported absent after flush\n", i);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    PASSED();
+    fflush(stdout);
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(mcpl_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+        H5Mclose(map_id2);
+        H5Pclose(mcpl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_bloom() */
+
+/*
+ * Tests H5daos_map_iterate_range() on maps with signed and unsigned 64 bit
+ * integer keys
+ */
+#if !defined(DAOS_API_VERSION_MAJOR) || !defined(DAOS_API_VERSION_MINOR) ||                                \
+    (DAOS_API_VERSION_MAJOR < 2 || (DAOS_API_VERSION_MAJOR == 2 && DAOS_API_VERSION_MINOR < 2))
+static int
+test_range(hid_t file_id)
+{
+    (void)file_id; /* silence compiler */
+
+    TESTING("ordered key range iteration");
+    SKIPPED();
+    printf("    key range iteration requires DAOS 2.2 or later\n");
+
+    return 0;
+} /* end test_range() */
+#else
+typedef struct {
+    const uint64_t *expected;
+    size_t          nexpected;
+    size_t          ncalls;
+    size_t          stop_at;
+} range_ud_t;
+
+static herr_t
+map_range_cb(hid_t map_id, const void *_key, void *_range_ud)
+{
+    range_ud_t *range_ud = (range_ud_t *)_range_ud;
+    uint64_t    key;
+
+    (void)map_id; /* silence compiler */
+
+    /* Keys must be visited in order and only if they are in the range */
+    memcpy(&key, _key, sizeof(key));
+    if (range_ud->ncalls >= range_ud->nexpected || key != range_ud->expected[range_ud->ncalls]) {
+        H5_FAILED();
+        AT();
+        printf("unexpected key 0x%llx at position %llu\n", (long long unsigned)key,
+               (long long unsigned)range_ud->ncalls);
+        return -1;
+    } /* end if */
+
+    /* Check for short circuit */
+    if (++range_ud->ncalls == range_ud->stop_at)
+        return 1;
+
+    return 0;
+} /* end map_range_cb */
+
+/*
+ * Iterates over [low, high), or [low, high] if high_incl is set, in map_id,
+ * whose keys are the nkeys entries of keys in increasing order, and checks
+ * the keys visited
+ */
+static int
+test_map_range(hid_t map_id, hid_t key_dtype, hbool_t is_signed, const uint64_t *keys, size_t nkeys,
+               uint64_t low, uint64_t high, hbool_t high_incl, size_t stop_at)
+{
+    range_ud_t range_ud;
+    uint64_t  *expected = NULL;
+    size_t     nexpected;
+    herr_t     ret;
+    size_t     i;
+
+    if (NULL == (expected = (uint64_t *)malloc((nkeys ? nkeys : 1) * sizeof(uint64_t))))
+        TEST_ERROR;
+    for (i = 0, nexpected = 0; i < nkeys; i++) {
+        if (is_signed ? (int64_t)keys[i] < (int64_t)low : keys[i] < low)
+            continue;
+        if (is_signed ? (int64_t)keys[i] > (int64_t)high : keys[i] > high)
+            continue;
+        if (keys[i] == high && !high_incl)
+            continue;
+        expected[nexpected++] = keys[i];
+    } /* end for */
+
+    memset(&range_ud, 0, sizeof(range_ud));
+    range_ud.expected  = expected;
+    range_ud.nexpected = nexpected;
+    range_ud.stop_at   = stop_at;
+    if ((ret = H5daos_map_iterate_range(map_id, key_dtype, &low, &high, high_incl, map_range_cb, &range_ud,
+                                        H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to iterate over key range\n");
+        goto error;
+    } /* end if */
+
+    /* Check that the iteration visited the whole range or stopped where
+     * requested */
+    if (stop_at && stop_at <= nexpected) {
+        if (ret != 1 || range_ud.ncalls != stop_at) {
+            H5_FAILED();
+            AT();
+            printf("iteration did not stop after %llu keys\n", (long long unsigned)stop_at);
+            goto error;
+        } /* end if */
+    } /* end if */
+    else if (ret != 0 || range_ud.ncalls != nexpected) {
+        H5_FAILED();
+        AT();
+        printf("visited %llu keys, expected %llu\n", (long long unsigned)range_ud.ncalls,
+               (long long unsigned)nexpected);
+        goto error;
+    } /* end if */
+
+    free(expected);
+
+    return 0;
+
+error:
+    free(expected);
+
+    return 1;
+} /* end test_map_range() */
+
+static int
+test_range(hid_t file_id)
+{
+    hid_t    map_id = -1;
+    uint64_t keys[RANGE_NUMB_KEYS + 2];
+    uint64_t key;
+    int      val = 0;
+    int      i;
+    int      nerrors = 0;
+
+    TESTING("ordered key range iteration");
+    HDputs("");
+
+    TESTING_2("signed keys");
+
+    /* Keys are multiples of 3 on both sides of zero, plus the extremes, in
+     * increasing signed order */
+    keys[0] = (uint64_t)INT64_MIN;
+    for (i = 0; i < RANGE_NUMB_KEYS; i++)
+        keys[i + 1] = (uint64_t)((int64_t)3 * (i - RANGE_NUMB_KEYS / 2));
+    keys[RANGE_NUMB_KEYS + 1] = (uint64_t)INT64_MAX;
+
+    if ((map_id = H5Mcreate(file_id, MAP_RANGE_INT_NAME, H5T_NATIVE_INT64, H5T_NATIVE_INT, H5P_DEFAULT,
+                            H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = RANGE_NUMB_KEYS + 1; i >= 0; i--)
+        if (H5Mput(map_id, H5T_NATIVE_INT64, &keys[i], H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+
+    /* Ranges below, above and across zero, the whole key space with and
+     * without its largest key, empty ranges, a range of a single key and an
+     * iteration stopped early */
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)-40,
+                              (uint64_t)50, FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)-90,
+                              (uint64_t)-10, FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)10,
+                              (uint64_t)60, FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)INT64_MIN,
+                              (uint64_t)INT64_MAX, FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)INT64_MIN,
+                              (uint64_t)INT64_MAX, TRUE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)5,
+                              (uint64_t)5, FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)7,
+                              (uint64_t)5, TRUE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)-3,
+                              (uint64_t)-3, TRUE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_INT64, TRUE, keys, RANGE_NUMB_KEYS + 2, (uint64_t)-40,
+                              (uint64_t)50, FALSE, 3);
+    if (nerrors)
+        goto error;
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    map_id = -1;
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("unsigned keys");
+
+    /* Keys are multiples of 5 at the bottom of the key space and around
+     * 2^63, plus the largest key, in increasing unsigned order */
+    for (i = 0; i < RANGE_NUMB_KEYS / 2; i++)
+        keys[i] = (uint64_t)5 * (uint64_t)i;
+    for (i = 0; i < RANGE_NUMB_KEYS / 2; i++)
+        keys[RANGE_NUMB_KEYS / 2 + i] = ((uint64_t)1 << 63) + (uint64_t)5 * (uint64_t)i - 50;
+    keys[RANGE_NUMB_KEYS] = UINT64_MAX;
+
+    if ((map_id = H5Mcreate(file_id, MAP_RANGE_UINT_NAME, H5T_NATIVE_UINT64, H5T_NATIVE_INT, H5P_DEFAULT,
+                            H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i <= RANGE_NUMB_KEYS; i++)
+        if (H5Mput(map_id, H5T_NATIVE_UINT64, &keys[i], H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+
+    key = (uint64_t)1 << 63;
+    nerrors += test_map_range(map_id, H5T_NATIVE_UINT64, FALSE, keys, RANGE_NUMB_KEYS + 1, 7, 100, FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_UINT64, FALSE, keys, RANGE_NUMB_KEYS + 1, key - 12, key + 12,
+                              FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_UINT64, FALSE, keys, RANGE_NUMB_KEYS + 1, 0, UINT64_MAX,
+                              FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_UINT64, FALSE, keys, RANGE_NUMB_KEYS + 1, 0, UINT64_MAX,
+                              TRUE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_UINT64, FALSE, keys, RANGE_NUMB_KEYS + 1, UINT64_MAX,
+                              UINT64_MAX, TRUE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_UINT64, FALSE, keys, RANGE_NUMB_KEYS + 1, 100, 7, FALSE, 0);
+    nerrors += test_map_range(map_id, H5T_NATIVE_UINT64, FALSE, keys, RANGE_NUMB_KEYS + 1, 0, UINT64_MAX,
+                              FALSE, 5);
+    if (nerrors)
+        goto error;
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_range() */
+#endif
+
+/*
+ * Tests H5daos_map_get_partial() on maps that store their values inline and
+ * out of line
+ */
+static int
+test_map_get_partial(hid_t file_id, const char *map_name, hid_t mcpl_id, hid_t val_dtype)
+{
+    hid_t  map_id = -1;
+    int    key;
+    int    val[PARTIAL_NELMTS];
+    int    buf[PARTIAL_NELMTS];
+    size_t val_size = sizeof(val);
+    herr_t ret;
+    int    i;
+
+    for (i = 0; i < PARTIAL_NELMTS; i++)
+        val[i] = rand();
+
+    if ((map_id =
+             H5Mcreate(file_id, map_name, H5T_NATIVE_INT, val_dtype, H5P_DEFAULT, mcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    key = 1;
+    if (H5Mput(map_id, H5T_NATIVE_INT, &key, val_dtype, val, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+
+    /* Read the whole value, a prefix, an extent in the middle, the last
+     * element, and nothing */
+    memset(buf, 0, sizeof(buf));
+    if (H5daos_map_get_partial(map_id, H5T_NATIVE_INT, &key, 0, val_size, buf, H5P_DEFAULT) < 0 ||
+        memcmp(buf, val, val_size)) {
+        H5_FAILED();
+        AT();
+        printf("incorrect whole value read\n");
+        goto error;
+    } /* end if */
+    memset(buf, 0, sizeof(buf));
+    if (H5daos_map_get_partial(map_id, H5T_NATIVE_INT, &key, 0, 4 * sizeof(int), buf, H5P_DEFAULT) < 0 ||
+        memcmp(buf, val, 4 * sizeof(int))) {
+        H5_FAILED();
+        AT();
+        printf("incorrect value prefix read\n");
+        goto error;
+    } /* end if */
+    memset(buf, 0, sizeof(buf));
+    if (H5daos_map_get_partial(map_id, H5T_NATIVE_INT, &key, 10 * sizeof(int) + 2, 20 * sizeof(int), buf,
+                               H5P_DEFAULT) < 0 ||
+        memcmp(buf, (char *)val + 10 * sizeof(int) + 2, 20 * sizeof(int))) {
+        H5_FAILED();
+        AT();
+        printf("incorrect value extent read\n");
+        goto error;
+    } /* end if */
+    memset(buf, 0, sizeof(buf));
+    if (H5daos_map_get_partial(map_id, H5T_NATIVE_INT, &key, val_size - sizeof(int), sizeof(int), buf,
+                               H5P_DEFAULT) < 0 ||
+        buf[0] != val[PARTIAL_NELMTS - 1]) {
+        H5_FAILED();
+        AT();
+        printf("incorrect value suffix read\n");
+        goto error;
+    } /* end if */
+    if (H5daos_map_get_partial(map_id, H5T_NATIVE_INT, &key, val_size, 0, NULL, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to read empty extent\n");
+        goto error;
+    } /* end if */
+
+    /* Extents past the end of the value, including ones whose end does
+     * not fit in a size_t, and keys not in the map must fail */
+    H5E_BEGIN_TRY
+    {
+        ret = H5daos_map_get_partial(map_id, H5T_NATIVE_INT, &key, val_size - 4, 8, buf, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("extent past the end of the value should not have been read\n");
+        goto error;
+    } /* end if */
+    H5E_BEGIN_TRY
+    {
+        ret = H5daos_map_get_partial(map_id, H5T_NATIVE_INT, &key, SIZE_MAX - 2, 4, buf, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("extent wrapping around should not have been read\n");
+        goto error;
+    } /* end if */
+    key = 2;
+    H5E_BEGIN_TRY
+    {
+        ret = H5daos_map_get_partial(map_id, H5T_NATIVE_INT, &key, 0, 4, buf, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("value of nonexistent key should not have been read\n");
+        goto error;
+    } /* end if */
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_map_get_partial() */
+
+static int
+test_partial(hid_t file_id)
+{
+    hid_t   mcpl_id   = -1;
+    hid_t   val_dtype = -1;
+    hsize_t dims[1]   = {PARTIAL_NELMTS};
+
+    TESTING("partial value reads");
+    HDputs("");
+
+    if ((val_dtype = H5Tarray_create2(H5T_NATIVE_INT, 1, dims)) < 0)
+        TEST_ERROR;
+    if ((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0)
+        TEST_ERROR;
+
+    TESTING_2("H5daos_map_get_partial() with values stored inline");
+    if (test_map_get_partial(file_id, MAP_PARTIAL_NAME, mcpl_id, val_dtype))
+        goto error;
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("H5daos_map_get_partial() with values stored out of line");
+    if (H5daos_set_map_large_value_threshold(mcpl_id, PARTIAL_NELMTS * sizeof(int) / 2) < 0)
+        TEST_ERROR;
+    if (test_map_get_partial(file_id, MAP_PARTIAL_OOL_NAME, mcpl_id, val_dtype))
+        goto error;
+    PASSED();
+    fflush(stdout);
+
+    if (H5Pclose(mcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Tclose(val_dtype) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(mcpl_id);
+        H5Tclose(val_dtype);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_partial() */
+
+/*
+ * Tests creation order iteration over the links in a group and the
+ * attributes on a map after some of them are deleted
+ */
+typedef struct {
+    const char *expected;
+    int         nexpected;
+    int         ncalls;
+    int         dec;
+} corder_ud_t;
+
+static int
+corder_check_name(const char *name, corder_ud_t *corder_ud)
+{
+    int idx;
+
+    /* Names must be visited in the order the remaining ones were created */
+    idx = corder_ud->dec ? corder_ud->nexpected - 1 - corder_ud->ncalls : corder_ud->ncalls;
+    if (corder_ud->ncalls >= corder_ud->nexpected ||
+        strcmp(name, corder_ud->expected + idx * CORDER_NAME_LEN)) {
+        H5_FAILED();
+        AT();
+        printf("unexpected name %s at position %d\n", name, corder_ud->ncalls);
+        return -1;
+    } /* end if */
+    corder_ud->ncalls++;
+
+    return 0;
+} /* end corder_check_name() */
+
+static herr_t
+corder_link_cb(hid_t group_id, const char *name, const H5L_info2_t *info, void *_corder_ud)
+{
+    (void)group_id; /* silence compiler */
+    (void)info;
+
+    return corder_check_name(name, (corder_ud_t *)_corder_ud);
+} /* end corder_link_cb */
+
+static herr_t
+corder_attr_cb(hid_t loc_id, const char *name, const H5A_info_t *info, void *_corder_ud)
+{
+    (void)loc_id; /* silence compiler */
+    (void)info;
+
+    return corder_check_name(name, (corder_ud_t *)_corder_ud);
+} /* end corder_attr_cb */
+
+/*
+ * Checks the names of the links in loc_id (attributes on the object if
+ * attrs is TRUE) by creation order index and creation order iteration in
+ * both directions
+ */
+static int
+test_corder_names(hid_t loc_id, hbool_t attrs, const char *expected, int nexpected)
+{
+    corder_ud_t corder_ud;
+    char        name[CORDER_NAME_LEN];
+    hsize_t     idx;
+    int         dec;
+    int         i;
+
+    for (i = 0; i < nexpected; i++) {
+        if ((attrs ? H5Aget_name_by_idx(loc_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)i, name,
+                                        sizeof(name), H5P_DEFAULT)
+                   : H5Lget_name_by_idx(loc_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)i, name,
+                                        sizeof(name), H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (strcmp(name, expected + i * CORDER_NAME_LEN)) {
+            H5_FAILED();
+            AT();
+            printf("name %s at creation order index %d, expected %s\n", name, i,
+                   expected + i * CORDER_NAME_LEN);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    for (dec = 0; dec <= 1; dec++) {
+        memset(&corder_ud, 0, sizeof(corder_ud));
+        corder_ud.expected  = expected;
+        corder_ud.nexpected = nexpected;
+        corder_ud.dec       = dec;
+        idx                 = 0;
+        if ((attrs ? H5Aiterate2(loc_id, H5_INDEX_CRT_ORDER, dec ? H5_ITER_DEC : H5_ITER_INC, &idx,
+                                 corder_attr_cb, &corder_ud)
+                   : H5Literate2(loc_id, H5_INDEX_CRT_ORDER, dec ? H5_ITER_DEC : H5_ITER_INC, &idx,
+                                 corder_link_cb, &corder_ud)) < 0)
+            TEST_ERROR;
+        if (corder_ud.ncalls != nexpected) {
+            H5_FAILED();
+            AT();
+            printf("visited %d names, expected %d\n", corder_ud.ncalls, nexpected);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    return 0;
+
+error:
+    return 1;
+} /* end test_corder_names() */
+
+static int
+test_corder(hid_t file_id)
+{
+    hid_t      gcpl_id  = -1;
+    hid_t      mcpl_id  = -1;
+    hid_t      group_id = -1;
+    hid_t      map_id   = -1;
+    hid_t      attr_id  = -1;
+    hid_t      space_id = -1;
+    H5G_info_t group_info;
+    char       name[CORDER_NAME_LEN];
+    char       expected[CORDER_NOBJS + 1][CORDER_NAME_LEN];
+    int        nexpected;
+    int        i;
+
+    TESTING("creation order iteration after deletes");
+    HDputs("");
+
+    if ((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_link_creation_order(gcpl_id, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
+        TEST_ERROR;
+    if ((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_attr_creation_order(mcpl_id, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
+        TEST_ERROR;
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR;
+
+    TESTING_2("link creation order after deletes");
+
+    if ((group_id = H5Gcreate2(file_id, CORDER_GROUP_NAME, H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < CORDER_NOBJS; i++) {
+        snprintf(name, sizeof(name), "map_%02d", i);
+        if ((map_id = H5Mcreate(group_id, name, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Mclose(map_id) < 0)
+            TEST_ERROR;
+        map_id = -1;
+    } /* end for */
+
+    /* Delete the first, the last and a run in the middle, leaving holes in
+     * the creation order index */
+    for (i = 0, nexpected = 0; i < CORDER_NOBJS; i++) {
+        snprintf(name, sizeof(name), "map_%02d", i);
+        if (CORDER_DELETED(i)) {
+            if (H5Ldelete(group_id, name, H5P_DEFAULT) < 0)
+                TEST_ERROR;
+        } /* end if */
+        else
+            strcpy(expected[nexpected++], name);
+    } /* end for */
+
+    if (H5Gget_info(group_id, &group_info) < 0)
+        TEST_ERROR;
+    if (group_info.nlinks != (hsize_t)nexpected) {
+        H5_FAILED();
+        AT();
+        printf("group has %llu links, expected %d\n", (long long unsigned)group_info.nlinks, nexpected);
+        goto error;
+    } /* end if */
+    if (test_corder_names(group_id, FALSE, expected[0], nexpected))
+        goto error;
+
+    /* A link created after the deletes comes last */
+    snprintf(name, sizeof(name), "map_%02d", CORDER_NOBJS);
+    if ((map_id = H5Mcreate(group_id, name, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT, H5P_DEFAULT,
+                            H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    map_id = -1;
+    strcpy(expected[nexpected++], name);
+    if (test_corder_names(group_id, FALSE, expected[0], nexpected))
+        goto error;
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("attribute creation order after deletes");
+
+    if ((map_id = H5Mcreate(group_id, CORDER_MAP_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT, mcpl_id,
+                            H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < CORDER_NOBJS; i++) {
+        snprintf(name, sizeof(name), "attr_%02d", i);
+        if ((attr_id = H5Acreate2(map_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Aclose(attr_id) < 0)
+            TEST_ERROR;
+        attr_id = -1;
+    } /* end for */
+    for (i = 0, nexpected = 0; i < CORDER_NOBJS; i++) {
+        snprintf(name, sizeof(name), "attr_%02d", i);
+        if (CORDER_DELETED(i)) {
+            if (H5Adelete(map_id, name) < 0)
+                TEST_ERROR;
+        } /* end if */
+        else
+            strcpy(expected[nexpected++], name);
+    } /* end for */
+    if (test_corder_names(map_id, TRUE, expected[0], nexpected))
+        goto error;
+
+    PASSED();
+    fflush(stdout);
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(mcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(gcpl_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Mclose(map_id);
+        H5Gclose(group_id);
+        H5Sclose(space_id);
+        H5Pclose(mcpl_id);
+        H5Pclose(gcpl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_corder() */
+
+/*
+ * Tests canceling asynchronous map operations, some of which may already be
+ * in progress
+ */
+static int
+test_cancel(hid_t file_id)
+{
+    hid_t   map_id = -1;
+    hid_t   es_id  = -1;
+    int     keys[2 * CANCEL_NKEYS];
+    int     vals[2 * CANCEL_NKEYS];
+    int     vals_out[CANCEL_NKEYS];
+    size_t  num_not_canceled;
+    size_t  num_in_progress;
+    hbool_t op_failed;
+    hbool_t exists;
+    hsize_t count;
+    hsize_t nexists;
+    int     i;
+
+    TESTING("canceling asynchronous operations");
+    HDputs("");
+
+    for (i = 0; i < 2 * CANCEL_NKEYS; i++) {
+        keys[i] = i;
+        vals[i] = rand() & 0x7fffffff;
+    } /* end for */
+
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    if ((map_id = H5Mcreate(file_id, MAP_CANCEL_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT,
+                            H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < CANCEL_NKEYS; i++)
+        if (H5Mput(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals[i], H5P_DEFAULT) < 0)
+            TEST_ERROR;
+
+    TESTING_2("canceling reads");
+
+    /* Each canceled read either completed or left its buffer untouched */
+    for (i = 0; i < CANCEL_NKEYS; i++) {
+        vals_out[i] = -1;
+        if (H5Mget_async(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals_out[i], H5P_DEFAULT, es_id) <
+            0)
+            TEST_ERROR;
+    } /* end for */
+    if (H5EScancel(es_id, &num_not_canceled, &op_failed) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to cancel reads\n");
+        goto error;
+    } /* end if */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("canceled reads did not finish\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < CANCEL_NKEYS; i++)
+        if (vals_out[i] != -1 && vals_out[i] != vals[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value returned by canceled read of key %d\n", i);
+            goto error;
+        } /* end if */
+
+    /* The map is still usable */
+    for (i = 0; i < CANCEL_NKEYS; i++)
+        if (H5Mget(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals_out[i], H5P_DEFAULT) < 0 ||
+            vals_out[i] != vals[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value returned after cancel for key %d\n", i);
+            goto error;
+        } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("canceling puts");
+
+    /* Puts that started run to completion and the others never start, so
+     * each new key is either fully present or absent and the count
+     * matches */
+    for (i = CANCEL_NKEYS; i < 2 * CANCEL_NKEYS; i++)
+        if (H5Mput_async(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals[i], H5P_DEFAULT, es_id) <
+            0)
+            TEST_ERROR;
+    if (H5EScancel(es_id, &num_not_canceled, &op_failed) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to cancel puts\n");
+        goto error;
+    } /* end if */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("canceled puts did not finish\n");
+        goto error;
+    } /* end if */
+    for (i = 0, nexists = 0; i < 2 * CANCEL_NKEYS; i++) {
+        if (H5Mexists(map_id, H5T_NATIVE_INT, &keys[i], &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (!exists) {
+            if (i < CANCEL_NKEYS) {
+                H5_FAILED();
+                AT();
+                printf("key %d put before the cancel is missing\n", i);
+                goto error;
+            } /* end if */
+            continue;
+        } /* end if */
+        nexists++;
+        if (H5Mget(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals_out[0], H5P_DEFAULT) < 0 ||
+            vals_out[0] != vals[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value for key %d after canceled put\n", i);
+            goto error;
+        } /* end if */
+    }     /* end for */
+    if (H5Mget_count(map_id, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (count != nexists) {
+        H5_FAILED();
+        AT();
+        printf("map count %llu does not match %llu keys present after canceled puts\n",
+               (long long unsigned)count, (long long unsigned)nexists);
+        goto error;
+    } /* end if */
+
+    PASSED();
+    fflush(stdout);
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+        H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_cancel() */
+
+typedef struct {
+    int    nseen[KV_NUMB_KEYS];
+    size_t ncalls;
+    size_t stop_at;
+} kv_ud_t;
+
+/* Keys are KV_KEY(i) and values KV_VAL(i) for i in [0, KV_NUMB_KEYS) */
+#define KV_KEY(I)   (3 * (I)-50)
+#define KV_VAL(KEY) (-7 * (KEY) + 1)
+
+static herr_t
+map_kv_cb(hid_t map_id, const void *_key, const void *_value, void *_kv_ud)
+{
+    kv_ud_t *kv_ud = (kv_ud_t *)_kv_ud;
+    int      key;
+    int      value;
+
+    (void)map_id; /* silence compiler */
+
+    /* The key must be one of the keys put, and the value converted from the
+     * file datatype must be the one put with it */
+    memcpy(&key, _key, sizeof(key));
+    memcpy(&value, _value, sizeof(value));
+    if (key < KV_KEY(0) || key > KV_KEY(KV_NUMB_KEYS - 1) || (key - KV_KEY(0)) % 3) {
+        H5_FAILED();
+        AT();
+        printf("unexpected key %d\n", key);
+        return -1;
+    } /* end if */
+    if (value != KV_VAL(key)) {
+        H5_FAILED();
+        AT();
+        printf("incorrect value %d for key %d\n", value, key);
+        return -1;
+    } /* end if */
+    kv_ud->nseen[(key - KV_KEY(0)) / 3]++;
+
+    /* Check for short circuit */
+    if (++kv_ud->ncalls == kv_ud->stop_at)
+        return 1;
+
+    return 0;
+} /* end map_kv_cb */
+
+/*
+ * Tests H5daos_map_iterate_kv() with several batches of keys, type
+ * conversion of keys and values, stopping early and restarting from idx
+ */
+static int
+test_iterate_kv(hid_t file_id)
+{
+    hid_t   map_id  = -1;
+    hid_t   mapl_id = -1;
+    kv_ud_t kv_ud;
+    hsize_t idx;
+    herr_t  ret;
+    int     key;
+    int     val;
+    int     i;
+
+    TESTING("iteration over keys and values");
+    HDputs("");
+
+    /* Store keys and values as big-endian 64-bit integers so both are
+     * converted to and from the native int memory type */
+    if ((map_id = H5Mcreate(file_id, MAP_KV_NAME, H5T_STD_I64BE, H5T_STD_I64BE, H5P_DEFAULT, H5P_DEFAULT,
+                            H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < KV_NUMB_KEYS; i++) {
+        key = KV_KEY(i);
+        val = KV_VAL(key);
+        if (H5Mput(map_id, H5T_NATIVE_INT, &key, H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    map_id = -1;
+
+    /* Reopen with a prefetch size much smaller than the number of keys so
+     * the values are fetched in several batches */
+    if ((mapl_id = H5Pcreate(H5P_MAP_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_map_iterate_hints(mapl_id, KV_BATCH, 64) < 0)
+        TEST_ERROR;
+    if ((map_id = H5Mopen(file_id, MAP_KV_NAME, mapl_id)) < 0)
+        TEST_ERROR;
+
+    TESTING_2("full iteration in batches");
+    memset(&kv_ud, 0, sizeof(kv_ud));
+    idx = 0;
+    if ((ret = H5daos_map_iterate_kv(map_id, &idx, H5T_NATIVE_INT, H5T_NATIVE_INT, map_kv_cb, &kv_ud,
+                                     H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to iterate over keys and values\n");
+        goto error;
+    } /* end if */
+    if (ret != 0 || idx != KV_NUMB_KEYS || kv_ud.ncalls != KV_NUMB_KEYS) {
+        H5_FAILED();
+        AT();
+        printf("visited %llu pairs with idx %llu, expected %d\n", (long long unsigned)kv_ud.ncalls,
+               (long long unsigned)idx, KV_NUMB_KEYS);
+        goto error;
+    } /* end if */
+    for (i = 0; i < KV_NUMB_KEYS; i++)
+        if (kv_ud.nseen[i] != 1) {
+            H5_FAILED();
+            AT();
+            printf("key %d visited %d times\n", KV_KEY(i), kv_ud.nseen[i]);
+            goto error;
+        } /* end if */
+    PASSED();
+    fflush(stdout);
+
+    TESTING_2("stopping early");
+    memset(&kv_ud, 0, sizeof(kv_ud));
+    kv_ud.stop_at = KV_STOP;
+    idx           = 0;
+    if ((ret = H5daos_map_iterate_kv(map_id, &idx, H5T_NATIVE_INT, H5T_NATIVE_INT, map_kv_cb, &kv_ud,
+                                     H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to iterate over keys and values\n");
+        goto error;
+    } /* end if */
+    if (ret != 1 || idx != KV_STOP || kv_ud.ncalls != KV_STOP) {
+        H5_FAILED();
+        AT();
+        printf("iteration did not stop after %d pairs\n", KV_STOP);
+        goto error;
+    } /* end if */
+    PASSED();
+    fflush(stdout);
+
+    /* Continue with the same idx and counts, so each key must have been
+     * visited exactly once over both calls */
+    TESTING_2("restarting from idx");
+    kv_ud.stop_at = 0;
+    if ((ret = H5daos_map_iterate_kv(map_id, &idx, H5T_NATIVE_INT, H5T_NATIVE_INT, map_kv_cb, &kv_ud,
+                                     H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to restart iteration over keys and values\n");
+        goto error;
+    } /* end if */
+    if (ret != 0 || idx != KV_NUMB_KEYS || kv_ud.ncalls != KV_NUMB_KEYS) {
+        H5_FAILED();
+        AT();
+        printf("visited %llu pairs with idx %llu after restart, expected %d\n",
+               (long long unsigned)kv_ud.ncalls, (long long unsigned)idx, KV_NUMB_KEYS);
+        goto error;
+    } /* end if */
+    for (i = 0; i < KV_NUMB_KEYS; i++)
+        if (kv_ud.nseen[i] != 1) {
+            H5_FAILED();
+            AT();
+            printf("key %d visited %d times over both calls\n", KV_KEY(i), kv_ud.nseen[i]);
+            goto error;
+        } /* end if */
+    PASSED();
+    fflush(stdout);
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(mapl_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+        H5Pclose(mapl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_iterate_kv() */
+
 /*
  * main function
  */
@@ -4648,6 +6223,15 @@ main(int argc, char **argv)
     nerrors += test_many_entries(file_id);
     nerrors += test_many_maps(file_id);
     nerrors += test_nonexistent_map(file_id);
+    nerrors += test_multi(file_id);
+    nerrors += test_async(file_id);
+    nerrors += test_count(file_id);
+    nerrors += test_bloom(file_id);
+    nerrors += test_range(file_id);
+    nerrors += test_partial(file_id);
+    nerrors += test_corder(file_id);
+    nerrors += test_cancel(file_id);
+    nerrors += test_iterate_kv(file_id);
 
     if (H5Pclose(fapl_id) < 0) {
         nerrors++;
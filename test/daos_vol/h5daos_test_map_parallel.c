@@ -14,11 +14,6 @@
 
 #define PARALLEL_FILENAME "h5daos_test_map_parallel.h5"
 
-/*
- * Currently unsupported functionality
- */
-#define NO_GET_MAP_COUNT
-
 /*
  * Global variables
  */
@@ -33,6 +28,7 @@ static herr_t iterate_func1(hid_t map_id, const void *key, void *op_data);
 static herr_t iterate_func2(hid_t map_id, const void *key, void *op_data);
 static herr_t iterate_func3(hid_t map_id, const void *key, void *op_data);
 static herr_t iterate_func4(hid_t map_id, const void *key, void *op_data);
+static herr_t iterate_func5(hid_t map_id, const void *key, void *op_data);
 
 typedef struct delete_rank_0_test_info {
     size_t  key_count;
@@ -44,6 +40,13 @@ typedef struct delete_all_ranks_test_info {
     size_t pass_number;
 } delete_all_ranks_test_info;
 
+typedef struct iterate_partitioned_test_info {
+    int   *visited;
+    size_t total_keys;
+    size_t key_count;
+    size_t stop_at;
+} iterate_partitioned_test_info;
+
 /*
  * A test to simply create a map on rank 0 only and then
  * ensure that all ranks can re-open the map.
@@ -467,12 +470,10 @@ test_insert_keys_all_ranks()
     MAP_TEST_INSERT_RANK_0_ONLY_KEY_C_TYPE *retrieved_keys = NULL;
     MAP_TEST_INSERT_RANK_0_ONLY_VAL_C_TYPE *vals           = NULL;
     MAP_TEST_INSERT_RANK_0_ONLY_VAL_C_TYPE *retrieved_vals = NULL;
-#ifndef NO_GET_MAP_COUNT
-    hsize_t key_count;
-#endif
-    size_t i;
-    hid_t  file_id = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
-    hid_t  map_id = H5I_INVALID_HID;
+    hsize_t                                 key_count;
+    size_t                                  i;
+    hid_t file_id = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
+    hid_t map_id = H5I_INVALID_HID;
 
     TESTING_2("inserting different keys on all ranks then retrieving values on all ranks");
 
@@ -564,7 +565,6 @@ test_insert_keys_all_ranks()
         goto error;
     }
 
-#ifndef NO_GET_MAP_COUNT
     /*
      * Make sure the map key count matches what is expected.
      */
@@ -580,7 +580,6 @@ test_insert_keys_all_ranks()
                (long long)(mpi_size * MAP_TEST_INSERT_ALL_RANKS_N_KEYS_PER_RANK));
         goto error;
     }
-#endif
 
     if (NULL == (retrieved_keys = (MAP_TEST_INSERT_ALL_RANKS_KEY_C_TYPE *)malloc(
                      (size_t)(MAP_TEST_INSERT_ALL_RANKS_N_KEYS_PER_RANK * mpi_size) *
@@ -1916,6 +1915,223 @@ error:
     return 1;
 }
 
+/*
+ * A test to create a map on all ranks and insert some keys on all
+ * ranks. After this, all ranks iterate over the map collectively with
+ * H5daos_map_iterate_partitioned and check that every key was visited
+ * by exactly one rank.
+ */
+#define MAP_TEST_ITERATE_PARTITIONED_MAP_NAME   "iterate_partitioned_map"
+#define MAP_TEST_ITERATE_PARTITIONED_KEY_TYPE   H5T_NATIVE_INT
+#define MAP_TEST_ITERATE_PARTITIONED_VAL_TYPE   H5T_NATIVE_INT
+#define MAP_TEST_ITERATE_PARTITIONED_KEY_C_TYPE int
+#define MAP_TEST_ITERATE_PARTITIONED_VAL_C_TYPE int
+#define MAP_TEST_ITERATE_PARTITIONED_N_KEYS     100
+static int
+test_iterate_partitioned()
+{
+    MAP_TEST_ITERATE_PARTITIONED_KEY_C_TYPE cur_key;
+    MAP_TEST_ITERATE_PARTITIONED_VAL_C_TYPE cur_val;
+    iterate_partitioned_test_info           test_info;
+    hsize_t                                 nvisited;
+    herr_t                                  ret;
+    size_t                                  i;
+    size_t                                  total_keys;
+    hid_t file_id = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
+    hid_t map_id = H5I_INVALID_HID;
+
+    TESTING_2("insert keys on all ranks - partitioned iteration over keys on all ranks");
+
+    total_keys        = (size_t)mpi_size * MAP_TEST_ITERATE_PARTITIONED_N_KEYS;
+    test_info.visited = NULL;
+
+    if (NULL == (test_info.visited = (int *)calloc(total_keys, sizeof(int)))) {
+        H5_FAILED();
+        HDputs("    failed to allocate buffer for visited keys");
+        goto error;
+    }
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create FAPL");
+        goto error;
+    }
+
+    if (H5Pset_all_coll_metadata_ops(fapl_id, 1) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set collective metadata reads");
+        goto error;
+    }
+
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set MPI on FAPL");
+        goto error;
+    }
+
+    if ((file_id = H5Fopen(PARALLEL_FILENAME, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open file");
+        goto error;
+    }
+
+    if ((map_id = H5Mcreate(file_id, MAP_TEST_ITERATE_PARTITIONED_MAP_NAME,
+                            MAP_TEST_ITERATE_PARTITIONED_KEY_TYPE, MAP_TEST_ITERATE_PARTITIONED_VAL_TYPE,
+                            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create map");
+        goto error;
+    }
+
+    /*
+     * Insert some keys on all ranks.
+     */
+    for (i = 0; i < MAP_TEST_ITERATE_PARTITIONED_N_KEYS; i++) {
+        /* Keys range from 0 to ((mpi_size * MAP_TEST_ITERATE_PARTITIONED_N_KEYS) - 1) */
+        cur_key = (MAP_TEST_ITERATE_PARTITIONED_KEY_C_TYPE)(
+            ((size_t)mpi_rank * MAP_TEST_ITERATE_PARTITIONED_N_KEYS) + i);
+        cur_val = mpi_rank;
+
+        if (H5Mput(map_id, MAP_TEST_ITERATE_PARTITIONED_KEY_TYPE, &cur_key,
+                   MAP_TEST_ITERATE_PARTITIONED_VAL_TYPE, &cur_val, H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            printf("    failed to set key-value pair %lld in map\n", (long long)i);
+            goto error;
+        }
+    }
+
+    /*
+     * Re-open the map to ensure the keys make it.
+     */
+    if (H5Mclose(map_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close map");
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file");
+        goto error;
+    }
+
+    if ((file_id = H5Fopen(PARALLEL_FILENAME, H5F_ACC_RDONLY, fapl_id)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open file");
+        goto error;
+    }
+
+    if ((map_id = H5Mopen(file_id, MAP_TEST_ITERATE_PARTITIONED_MAP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open map");
+        goto error;
+    }
+
+    /*
+     * Iterate over all keys collectively, then combine the keys visited by
+     * each rank and make sure every key was visited exactly once.
+     */
+    test_info.total_keys = total_keys;
+    test_info.stop_at    = 0;
+    test_info.key_count  = 0;
+    if ((ret = H5daos_map_iterate_partitioned(map_id, MAP_TEST_ITERATE_PARTITIONED_KEY_TYPE, iterate_func5,
+                                              &test_info, &nvisited, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDputs("    partitioned iteration over keys in map failed");
+        goto error;
+    }
+
+    if (ret != H5_ITER_CONT) {
+        H5_FAILED();
+        printf("    partitioned iteration returned %lld instead of 0\n", (long long)ret);
+        goto error;
+    }
+
+    if (nvisited != (hsize_t)total_keys) {
+        H5_FAILED();
+        printf("    partitioned iteration visited %lld keys instead of %lld\n", (long long)nvisited,
+               (long long)total_keys);
+        goto error;
+    }
+
+    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, test_info.visited, (int)total_keys, MPI_INT, MPI_SUM,
+                                     MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDputs("    MPI_Allreduce failed");
+        goto error;
+    }
+
+    for (i = 0; i < total_keys; i++)
+        if (test_info.visited[i] != 1) {
+            H5_FAILED();
+            printf("    key %lld was visited %d times\n", (long long)i, test_info.visited[i]);
+            goto error;
+        }
+
+    /*
+     * Stop each rank's iteration after its first key and make sure the
+     * operator's return value is passed back.
+     */
+    test_info.stop_at   = 1;
+    test_info.key_count = 0;
+    memset(test_info.visited, 0, total_keys * sizeof(int));
+    if ((ret = H5daos_map_iterate_partitioned(map_id, MAP_TEST_ITERATE_PARTITIONED_KEY_TYPE, iterate_func5,
+                                              &test_info, NULL, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDputs("    partitioned iteration over keys in map failed");
+        goto error;
+    }
+
+    if (ret != 1) {
+        H5_FAILED();
+        printf("    partitioned iteration stopped early returned %lld instead of 1\n", (long long)ret);
+        goto error;
+    }
+
+    if (test_info.key_count > 1) {
+        H5_FAILED();
+        printf("    partitioned iteration continued after the operator stopped it\n");
+        goto error;
+    }
+
+    if (H5Mclose(map_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close map");
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close FAPL");
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file");
+        goto error;
+    }
+
+    free(test_info.visited);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    free(test_info.visited);
+
+    return 1;
+}
+
 /*
  * A key iteration function for the test_insert_keys_one_rank_iterate_all_ranks
  * test which counts the number of keys and makes sure that each key
@@ -2090,6 +2306,33 @@ done:
     return ret_val;
 }
 
+/*
+ * A key iteration function for the test_iterate_partitioned test which
+ * records each key visited by this rank, and stops the iteration once
+ * stop_at keys have been visited if stop_at is nonzero.
+ */
+static herr_t
+iterate_func5(hid_t map_id, const void *key, void *op_data)
+{
+    MAP_TEST_ITERATE_PARTITIONED_KEY_C_TYPE cur_key   = *(const MAP_TEST_ITERATE_PARTITIONED_KEY_C_TYPE *)key;
+    iterate_partitioned_test_info          *test_info = (iterate_partitioned_test_info *)op_data;
+
+    (void)map_id;
+
+    if (cur_key < 0 || (size_t)cur_key >= test_info->total_keys) {
+        H5_FAILED();
+        printf("    unexpected key %lld returned by iteration\n", (long long)cur_key);
+        return H5_ITER_ERROR;
+    }
+
+    test_info->visited[cur_key]++;
+
+    if (++test_info->key_count == test_info->stop_at)
+        return 1;
+
+    return H5_ITER_CONT;
+}
+
 int
 main(int argc, char **argv)
 {
@@ -2139,6 +2382,7 @@ main(int argc, char **argv)
     nerrors += test_delete_keys_all_ranks_iterate_all_ranks();
     nerrors += test_update_keys_rank_0_only_read_all_ranks();
     nerrors += test_update_keys_all_ranks_read_all_ranks();
+    nerrors += test_iterate_partitioned();
 
     if (nerrors)
         goto error;
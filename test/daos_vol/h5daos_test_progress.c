@@ -0,0 +1,423 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: Tests the background progress thread of the DAOS VOL connector,
+ *          started with HDF5_DAOS_PROGRESS_THREAD
+ */
+
+#include <pthread.h>
+
+#include "h5daos_test.h"
+
+#include "daos_vol.h"
+
+/*
+ * Definitions
+ */
+#define TRUE  1
+#define FALSE 0
+
+#define FILENAME "h5daos_test_progress.h5"
+
+#define PROGRESS_DSET_NAME "progress_dset"
+#define PROGRESS_MAP_NAME  "progress_map"
+
+#define PROGRESS_NELMTS  (64 * 1024)
+#define PROGRESS_NKEYS   256
+#define PROGRESS_NSTATS  1000
+#define PROGRESS_TIMEOUT 30 /* Seconds to wait for the thread to finish an operation */
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+typedef struct {
+    hid_t  map_id;
+    size_t ncalls;
+    int    error;
+} progress_iter_ud_t;
+
+typedef struct {
+    volatile int done;
+    int          error;
+} progress_stats_ud_t;
+
+static int   test_progress_async(hid_t file_id);
+static int   test_progress_public(hid_t file_id);
+static void *progress_stats_thread(void *_stats_ud);
+static int   test_progress(hid_t file_id);
+
+/*
+ * Starts an asynchronous read and then waits for the read buffer to fill
+ * without calling into HDF5, so the read can only complete if the progress
+ * thread drives it
+ */
+static int
+test_progress_async(hid_t file_id)
+{
+    hid_t           dset_id  = -1;
+    hid_t           space_id = -1;
+    hid_t           es_id    = -1;
+    hsize_t         dims     = PROGRESS_NELMTS;
+    int            *wbuf     = NULL;
+    volatile int   *rbuf     = NULL;
+    struct timespec delay    = {0, 1000000};
+    size_t          num_in_progress;
+    hbool_t         op_failed;
+    hbool_t         filled = FALSE;
+    long            nwaits;
+    size_t          i;
+
+    if (NULL == (wbuf = malloc(PROGRESS_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = malloc(PROGRESS_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < PROGRESS_NELMTS; i++) {
+        wbuf[i] = (int)i + 1;
+        rbuf[i] = 0;
+    } /* end for */
+
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    if ((space_id = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, PROGRESS_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+
+    if (H5Dread_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, (int *)rbuf, es_id) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to start asynchronous read\n");
+        goto error;
+    } /* end if */
+
+    /* Stay out of HDF5 until the last element arrives.  Native ints are not
+     * converted, so DAOS reads straight into rbuf. */
+    for (nwaits = 0; nwaits < PROGRESS_TIMEOUT * 1000L; nwaits++) {
+        if (rbuf[PROGRESS_NELMTS - 1] == PROGRESS_NELMTS) {
+            filled = TRUE;
+            break;
+        } /* end if */
+        (void)nanosleep(&delay, NULL);
+    } /* end for */
+    if (!filled) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous read did not complete without calling into HDF5\n");
+        goto error;
+    } /* end if */
+
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous read failed\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < PROGRESS_NELMTS; i++)
+        if (rbuf[i] != wbuf[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value read at index %zu\n", i);
+            goto error;
+        } /* end if */
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+    free(wbuf);
+    free((int *)rbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed);
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+    free(wbuf);
+    free((int *)rbuf);
+
+    return 1;
+} /* end test_progress_async() */
+
+/*
+ * Iteration operator that calls public H5daos routines from inside the
+ * connector, where they must neither take the connector's locks again nor
+ * release the HDF5 library lock held by the iteration
+ */
+static herr_t
+progress_iter_cb(hid_t map_id, const void *key, const void *value, void *_iter_ud)
+{
+    progress_iter_ud_t   *iter_ud = (progress_iter_ud_t *)_iter_ud;
+    H5_daos_alloc_stats_t stats;
+    int                   val_out;
+
+    (void)map_id; /* silence compiler */
+
+    if (H5daos_get_alloc_stats(&stats) < 0) {
+        iter_ud->error = 1;
+        return -1;
+    } /* end if */
+    if (H5daos_map_get_multi(iter_ud->map_id, H5T_NATIVE_INT, 1, key, H5T_NATIVE_INT, &val_out, NULL,
+                             H5P_DEFAULT) < 0 ||
+        memcmp(&val_out, value, sizeof(int))) {
+        iter_ud->error = 1;
+        return -1;
+    } /* end if */
+    iter_ud->ncalls++;
+
+    return 0;
+} /* end progress_iter_cb() */
+
+/*
+ * Calls H5daos_get_alloc_stats() repeatedly, concurrently with the main
+ * thread's public H5daos calls
+ */
+static void *
+progress_stats_thread(void *_stats_ud)
+{
+    progress_stats_ud_t  *stats_ud = (progress_stats_ud_t *)_stats_ud;
+    H5_daos_alloc_stats_t stats;
+    int                   i;
+
+    for (i = 0; i < PROGRESS_NSTATS && !stats_ud->done; i++)
+        if (H5daos_get_alloc_stats(&stats) < 0) {
+            stats_ud->error = 1;
+            break;
+        } /* end if */
+
+    return NULL;
+} /* end progress_stats_thread() */
+
+/*
+ * Calls public H5daos routines that use the connector's scheduler while the
+ * progress thread is running, from the main thread, from a second
+ * application thread and from inside an iteration
+ */
+static int
+test_progress_public(hid_t file_id)
+{
+    hid_t               map_id = -1;
+    progress_iter_ud_t  iter_ud;
+    progress_stats_ud_t stats_ud;
+    pthread_t           stats_thread;
+    hbool_t             thread_started = FALSE;
+    hsize_t             idx            = 0;
+    int                 keys[PROGRESS_NKEYS];
+    int                 vals[PROGRESS_NKEYS];
+    int                 vals_out[PROGRESS_NKEYS];
+    int                 i;
+
+    memset(&stats_ud, 0, sizeof(stats_ud));
+    for (i = 0; i < PROGRESS_NKEYS; i++) {
+        keys[i]     = i;
+        vals[i]     = -i;
+        vals_out[i] = 1;
+    } /* end for */
+
+    if ((map_id = H5Mcreate(file_id, PROGRESS_MAP_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT, H5P_DEFAULT,
+                            H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Another application thread enters the connector through public
+     * routines while this one does */
+    if (pthread_create(&stats_thread, NULL, progress_stats_thread, &stats_ud) != 0)
+        TEST_ERROR;
+    thread_started = TRUE;
+
+    if (H5daos_map_put_multi(map_id, H5T_NATIVE_INT, PROGRESS_NKEYS, keys, H5T_NATIVE_INT, vals, NULL,
+                             H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to put values\n");
+        goto error;
+    } /* end if */
+    if (H5daos_map_get_multi(map_id, H5T_NATIVE_INT, PROGRESS_NKEYS, keys, H5T_NATIVE_INT, vals_out, NULL,
+                             H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to get values\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < PROGRESS_NKEYS; i++)
+        if (vals_out[i] != vals[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value for key %d\n", i);
+            goto error;
+        } /* end if */
+
+    /* Public routines called from inside the connector */
+    memset(&iter_ud, 0, sizeof(iter_ud));
+    iter_ud.map_id = map_id;
+    if (H5daos_map_iterate_kv(map_id, &idx, H5T_NATIVE_INT, H5T_NATIVE_INT, progress_iter_cb, &iter_ud,
+                              H5P_DEFAULT) < 0 ||
+        iter_ud.error) {
+        H5_FAILED();
+        AT();
+        printf("failed to call public routines during iteration\n");
+        goto error;
+    } /* end if */
+    if (iter_ud.ncalls != PROGRESS_NKEYS || idx != PROGRESS_NKEYS) {
+        H5_FAILED();
+        AT();
+        printf("iterated over %zu keys, expected %d\n", iter_ud.ncalls, PROGRESS_NKEYS);
+        goto error;
+    } /* end if */
+
+    stats_ud.done = 1;
+    thread_started = FALSE;
+    if (pthread_join(stats_thread, NULL) != 0)
+        TEST_ERROR;
+    if (stats_ud.error) {
+        H5_FAILED();
+        AT();
+        printf("concurrent H5daos_get_alloc_stats() failed\n");
+        goto error;
+    } /* end if */
+
+    if (H5Mclose(map_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    if (thread_started) {
+        stats_ud.done = 1;
+        (void)pthread_join(stats_thread, NULL);
+    } /* end if */
+    H5E_BEGIN_TRY
+    {
+        H5Mclose(map_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_progress_public() */
+
+/*
+ * Tests operations with the background progress thread running
+ */
+static int
+test_progress(hid_t file_id)
+{
+    int nerrors = 0;
+
+    TESTING("background progress thread");
+    HDputs("");
+
+    TESTING_2("asynchronous read completes outside of HDF5");
+    if (test_progress_async(file_id))
+        nerrors++;
+    else
+        PASSED();
+
+    TESTING_2("public routines from several threads and nested");
+    if (test_progress_public(file_id))
+        nerrors++;
+    else
+        PASSED();
+
+    fflush(stdout);
+
+    return nerrors;
+} /* end test_progress() */
+
+/*
+ * main function
+ */
+int
+main(int argc, char **argv)
+{
+    hid_t fapl_id = -1, file_id = -1;
+    int   nerrors = 0;
+    int   provided;
+
+    /* Read when the connector is initialized, so it must be set before the
+     * first HDF5 call */
+    if (setenv("HDF5_DAOS_PROGRESS_THREAD", "1", 1) < 0) {
+        printf("failed to set environment\n");
+        return 1;
+    } /* end if */
+
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+#ifndef H5_HAVE_THREADSAFE
+    TESTING("background progress thread");
+    SKIPPED();
+    printf("    the progress thread requires a thread-safe build of HDF5\n");
+    MPI_Finalize();
+    return 0;
+#endif
+    if (provided != MPI_THREAD_MULTIPLE) {
+        TESTING("background progress thread");
+        SKIPPED();
+        printf("    the progress thread requires MPI_THREAD_MULTIPLE\n");
+        MPI_Finalize();
+        return 0;
+    } /* end if */
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if ((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    nerrors += test_progress(file_id);
+
+    if (H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors)
+        goto error;
+
+    if (MAINPROCESS)
+        puts("All DAOS progress thread tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    if (MAINPROCESS)
+        printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
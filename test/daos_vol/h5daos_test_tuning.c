@@ -0,0 +1,1438 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: Tests the tuning settings of the DAOS VOL connector, taken
+ *          from the environment when the connector is initialized or from
+ *          file access properties
+ */
+
+#include "h5daos_test.h"
+
+#include "daos_vol.h"
+
+/*
+ * Definitions
+ */
+#define TRUE  1
+#define FALSE 0
+
+#define FILENAME "h5daos_test_tuning.h5"
+
+/* In-flight budgets set for this test, well below the number of chunks
+ * accessed at once */
+#define SMALL_BUDGET "2"
+#define BULK_BUDGET  "1"
+
+#define BUDGET_NCHUNKS     64
+#define BUDGET_CHUNK       16
+#define BUDGET_BULK_NCHUNK 4
+#define BUDGET_BULK_CHUNK  (128 * 1024)
+
+#define BUDGET_DSET_NAME      "budget_dset"
+#define BUDGET_TCONV_NAME     "budget_tconv_dset"
+#define BUDGET_ASYNC_NAME     "budget_async_dset"
+#define BUDGET_BULK_DSET_NAME "budget_bulk_dset"
+
+#define VISIT_FILENAME  "h5daos_test_tuning_visit.h5"
+#define VISIT_NGROUPS   4
+#define VISIT_NSUBS     4
+#define VISIT_NOBJS     (1 + VISIT_NGROUPS + VISIT_NGROUPS * VISIT_NSUBS)
+#define VISIT_NAME_SIZE 16
+
+/* Objects created in each open of the file.  More than the connector's
+ * smallest first OIDX block (1024), so later blocks are also used. */
+#define OIDX_FILENAME  "h5daos_test_tuning_oidx.h5"
+#define OIDX_PREALLOC  16
+#define OIDX_NOBJS     1100
+#define OIDX_NOPENS    2
+#define OIDX_NAME_SIZE 16
+
+/* Enough objects opened in a row to reuse each shared memory slot many
+ * times, and a datatype whose encoding is larger than a slot */
+#define BCAST_FILENAME       "h5daos_test_tuning_bcast.h5"
+#define BCAST_NDSETS         16
+#define BCAST_LARGE_NAME     "large_type_dset"
+#define BCAST_LARGE_NMEMBERS 8192
+#define BCAST_NAME_SIZE      64
+
+/* More collective operations than fit in one batch of error checks */
+#define COLL_ERR_FILENAME  "h5daos_test_tuning_coll_err.h5"
+#define COLL_ERR_BATCH     4
+#define COLL_ERR_NGROUPS   11
+#define COLL_ERR_MISSING   "missing_group"
+#define COLL_ERR_NAME_SIZE 16
+
+/* More collective operations in flight than there are lanes */
+#define LANES_FILENAME  "h5daos_test_tuning_lanes.h5"
+#define LANES_NLANES    3
+#define LANES_NDSETS    10
+#define LANES_NAME_SIZE 16
+
+#define WAIT_FILENAME  "h5daos_test_tuning_wait.h5"
+#define WAIT_DSET_NAME "wait_dset"
+#define WAIT_NELMTS    (16 * 1024)
+
+#define STATS_DSET_NAME "stats_dset"
+#define STATS_NCHUNKS   32
+#define STATS_CHUNK     8
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+typedef struct {
+    char   names[VISIT_NOBJS][VISIT_NAME_SIZE];
+    size_t nnames;
+    int    error;
+} visit_ud_t;
+
+static int test_budget_dset(hid_t file_id, const char *name, hid_t file_type_id, hsize_t nchunks,
+                            hsize_t chunk_size);
+static int test_budget_async(hid_t file_id);
+static int test_budget(hid_t file_id);
+static int visit_record(visit_ud_t *visit_ud, const char *name);
+static int test_unordered_visit(void);
+static int oidx_create_dsets(hid_t file_id, int first, int count);
+static int oidx_check_dsets(hid_t file_id, int count);
+static int test_oidx_prealloc(void);
+static int test_node_local_bcast(void);
+static int test_coll_err_batch(void);
+static int test_coll_lanes(hbool_t coalesce);
+static int test_wait_mode(void);
+static int test_alloc_stats(hid_t file_id);
+
+/*
+ * Writes every chunk of a new chunked dataset with a single H5Dwrite and
+ * reads it back, so many more chunks are accessed at once than the budget
+ * for their priority class allows in flight.  Memory is always
+ * H5T_NATIVE_INT, so file_type_id selects whether type conversion is done.
+ */
+static int
+test_budget_dset(hid_t file_id, const char *name, hid_t file_type_id, hsize_t nchunks, hsize_t chunk_size)
+{
+    hid_t   dset_id  = -1;
+    hid_t   space_id = -1;
+    hid_t   dcpl_id  = -1;
+    hsize_t dims     = nchunks * chunk_size;
+    int    *wbuf     = NULL;
+    int    *rbuf     = NULL;
+    hsize_t i;
+
+    if (NULL == (wbuf = malloc((size_t)dims * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = calloc((size_t)dims, sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < dims; i++)
+        wbuf[i] = (int)i;
+
+    if ((space_id = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, &chunk_size) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, name, file_type_id, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to write dataset\n");
+        goto error;
+    } /* end if */
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to read dataset\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < dims; i++)
+        if (rbuf[i] != wbuf[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value read at index %llu\n", (unsigned long long)i);
+            goto error;
+        } /* end if */
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    free(wbuf);
+    free(rbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+    free(wbuf);
+    free(rbuf);
+
+    return 1;
+} /* end test_budget_dset() */
+
+/*
+ * Writes and reads each chunk of a chunked dataset with its own
+ * asynchronous operation, so each operation's I/O task is the first task of
+ * its request and many requests wait on the budget at once.
+ */
+static int
+test_budget_async(hid_t file_id)
+{
+    hid_t   dset_id     = -1;
+    hid_t   space_id    = -1;
+    hid_t   mem_space   = -1;
+    hid_t   dcpl_id     = -1;
+    hid_t   es_id       = -1;
+    hsize_t dims        = BUDGET_NCHUNKS * BUDGET_CHUNK;
+    hsize_t chunk_dims  = BUDGET_CHUNK;
+    int     wbuf[BUDGET_NCHUNKS * BUDGET_CHUNK];
+    int     rbuf[BUDGET_NCHUNKS * BUDGET_CHUNK];
+    size_t  num_in_progress;
+    hbool_t op_failed;
+    hsize_t start;
+    int     i;
+
+    for (i = 0; i < BUDGET_NCHUNKS * BUDGET_CHUNK; i++) {
+        wbuf[i] = i;
+        rbuf[i] = -1;
+    } /* end for */
+
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    if ((space_id = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mem_space = H5Screate_simple(1, &chunk_dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, &chunk_dims) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, BUDGET_ASYNC_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Write each chunk without waiting */
+    for (i = 0; i < BUDGET_NCHUNKS; i++) {
+        start = (hsize_t)i * BUDGET_CHUNK;
+        if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, &start, NULL, &chunk_dims, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mem_space, space_id, H5P_DEFAULT, &wbuf[start], es_id) <
+            0) {
+            H5_FAILED();
+            AT();
+            printf("failed to write chunk %d\n", i);
+            goto error;
+        } /* end if */
+    }     /* end for */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous writes failed\n");
+        goto error;
+    } /* end if */
+
+    /* Read each chunk without waiting */
+    for (i = 0; i < BUDGET_NCHUNKS; i++) {
+        start = (hsize_t)i * BUDGET_CHUNK;
+        if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, &start, NULL, &chunk_dims, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dread_async(dset_id, H5T_NATIVE_INT, mem_space, space_id, H5P_DEFAULT, &rbuf[start], es_id) <
+            0) {
+            H5_FAILED();
+            AT();
+            printf("failed to read chunk %d\n", i);
+            goto error;
+        } /* end if */
+    }     /* end for */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous reads failed\n");
+        goto error;
+    } /* end if */
+
+    for (i = 0; i < BUDGET_NCHUNKS * BUDGET_CHUNK; i++)
+        if (rbuf[i] != wbuf[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value read at index %d\n", i);
+            goto error;
+        } /* end if */
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mem_space) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed);
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mem_space);
+        H5Sclose(space_id);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_budget_async() */
+
+/*
+ * Tests raw data I/O with in-flight budgets much smaller than the number of
+ * chunks accessed, set through HDF5_DAOS_SMALL_IO_BUDGET and
+ * HDF5_DAOS_BULK_IO_BUDGET
+ */
+static int
+test_budget(hid_t file_id)
+{
+    int nerrors = 0;
+
+    TESTING("raw data I/O over the in-flight budget");
+    HDputs("");
+
+    TESTING_2("small chunks, one operation");
+    if (test_budget_dset(file_id, BUDGET_DSET_NAME, H5T_NATIVE_INT, BUDGET_NCHUNKS, BUDGET_CHUNK))
+        nerrors++;
+    else
+        PASSED();
+
+    TESTING_2("small chunks with type conversion");
+    if (test_budget_dset(file_id, BUDGET_TCONV_NAME, H5T_STD_I64BE, BUDGET_NCHUNKS, BUDGET_CHUNK))
+        nerrors++;
+    else
+        PASSED();
+
+    TESTING_2("small chunks, one asynchronous operation each");
+    if (test_budget_async(file_id))
+        nerrors++;
+    else
+        PASSED();
+
+    TESTING_2("bulk chunks, one operation");
+    if (test_budget_dset(file_id, BUDGET_BULK_DSET_NAME, H5T_NATIVE_INT, BUDGET_BULK_NCHUNK,
+                         BUDGET_BULK_CHUNK))
+        nerrors++;
+    else
+        PASSED();
+
+    fflush(stdout);
+
+    return nerrors;
+} /* end test_budget() */
+
+/*
+ * Records a visited path, checking that it was not seen before and that
+ * its parent group was seen before it
+ */
+static int
+visit_record(visit_ud_t *visit_ud, const char *name)
+{
+    const char *slash;
+    hbool_t     parent_seen;
+    size_t      i;
+
+    if (visit_ud->nnames == VISIT_NOBJS || strlen(name) >= VISIT_NAME_SIZE)
+        return -1;
+
+    parent_seen = (NULL == (slash = strrchr(name, '/')));
+    for (i = 0; i < visit_ud->nnames; i++) {
+        if (!strcmp(visit_ud->names[i], name))
+            return -1;
+        if (slash && strlen(visit_ud->names[i]) == (size_t)(slash - name) &&
+            !strncmp(visit_ud->names[i], name, (size_t)(slash - name)))
+            parent_seen = TRUE;
+    } /* end for */
+    if (!parent_seen)
+        return -1;
+
+    strcpy(visit_ud->names[visit_ud->nnames++], name);
+
+    return 0;
+} /* end visit_record() */
+
+/*
+ * H5Ovisit3() callback for test_unordered_visit()
+ */
+static herr_t
+visit_obj_cb(hid_t obj_id, const char *name, const H5O_info2_t *info, void *_visit_ud)
+{
+    visit_ud_t *visit_ud = (visit_ud_t *)_visit_ud;
+
+    (void)obj_id; /* silence compiler */
+
+    if (info->type != H5O_TYPE_GROUP || visit_record(visit_ud, name) < 0) {
+        visit_ud->error = 1;
+        return -1;
+    } /* end if */
+
+    return 0;
+} /* end visit_obj_cb() */
+
+/*
+ * H5Lvisit2() callback for test_unordered_visit()
+ */
+static herr_t
+visit_link_cb(hid_t group_id, const char *name, const H5L_info2_t *info, void *_visit_ud)
+{
+    visit_ud_t *visit_ud = (visit_ud_t *)_visit_ud;
+
+    (void)group_id; /* silence compiler */
+
+    if (info->type != H5L_TYPE_HARD || visit_record(visit_ud, name) < 0) {
+        visit_ud->error = 1;
+        return -1;
+    } /* end if */
+
+    return 0;
+} /* end visit_link_cb() */
+
+/*
+ * Tests recursive visits of a two-level group tree in a file opened with
+ * H5daos_set_unordered_visit().  Every object must be visited exactly once
+ * and after its parent group.
+ */
+static int
+test_unordered_visit(void)
+{
+    hid_t      fapl_id   = -1;
+    hid_t      file_id   = -1;
+    hid_t      group_id  = -1;
+    hid_t      sub_id    = -1;
+    hbool_t    unordered = FALSE;
+    visit_ud_t visit_ud;
+    char       name[VISIT_NAME_SIZE];
+    int        i, j;
+
+    TESTING("unordered visits");
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5daos_set_unordered_visit(fapl_id, TRUE) < 0)
+        TEST_ERROR;
+    if (H5daos_get_unordered_visit(fapl_id, &unordered) < 0 || !unordered) {
+        H5_FAILED();
+        AT();
+        printf("unordered visit setting not retrieved\n");
+        goto error;
+    } /* end if */
+
+    if ((file_id = H5Fcreate(VISIT_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < VISIT_NGROUPS; i++) {
+        snprintf(name, sizeof(name), "g%d", i);
+        if ((group_id = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        for (j = 0; j < VISIT_NSUBS; j++) {
+            snprintf(name, sizeof(name), "s%d", j);
+            if ((sub_id = H5Gcreate2(group_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (H5Gclose(sub_id) < 0)
+                TEST_ERROR;
+            sub_id = -1;
+        } /* end for */
+        if (H5Gclose(group_id) < 0)
+            TEST_ERROR;
+        group_id = -1;
+    } /* end for */
+
+    /* The root group is visited as "." */
+    memset(&visit_ud, 0, sizeof(visit_ud));
+    if (H5Ovisit3(file_id, H5_INDEX_NAME, H5_ITER_INC, visit_obj_cb, &visit_ud, H5O_INFO_BASIC) < 0 ||
+        visit_ud.error || visit_ud.nnames != VISIT_NOBJS) {
+        H5_FAILED();
+        AT();
+        printf("object visit returned %zu objects, expected %d\n", visit_ud.nnames, VISIT_NOBJS);
+        goto error;
+    } /* end if */
+
+    memset(&visit_ud, 0, sizeof(visit_ud));
+    if (H5Lvisit2(file_id, H5_INDEX_NAME, H5_ITER_INC, visit_link_cb, &visit_ud) < 0 || visit_ud.error ||
+        visit_ud.nnames != VISIT_NOBJS - 1) {
+        H5_FAILED();
+        AT();
+        printf("link visit returned %zu links, expected %d\n", visit_ud.nnames, VISIT_NOBJS - 1);
+        goto error;
+    } /* end if */
+
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(sub_id);
+        H5Gclose(group_id);
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    fflush(stdout);
+
+    return 1;
+} /* end test_unordered_visit() */
+
+/*
+ * Creates count scalar datasets, each holding its own index starting at
+ * first
+ */
+static int
+oidx_create_dsets(hid_t file_id, int first, int count)
+{
+    hid_t space_id = -1;
+    hid_t dset_id  = -1;
+    char  name[OIDX_NAME_SIZE];
+    int   i;
+
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR;
+    for (i = first; i < first + count; i++) {
+        snprintf(name, sizeof(name), "d%d", i);
+        if ((dset_id = H5Dcreate2(file_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            AT();
+            printf("failed to create dataset %d\n", i);
+            goto error;
+        } /* end if */
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &i) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR;
+        dset_id = -1;
+    } /* end for */
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end oidx_create_dsets() */
+
+/*
+ * Checks that each of the first count datasets still holds its own index,
+ * so no two objects were given the same OIDX
+ */
+static int
+oidx_check_dsets(hid_t file_id, int count)
+{
+    hid_t dset_id = -1;
+    char  name[OIDX_NAME_SIZE];
+    int   val;
+    int   i;
+
+    for (i = 0; i < count; i++) {
+        snprintf(name, sizeof(name), "d%d", i);
+        if ((dset_id = H5Dopen2(file_id, name, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        val = -1;
+        if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &val) < 0)
+            TEST_ERROR;
+        if (val != i) {
+            H5_FAILED();
+            AT();
+            printf("dataset %d holds %d\n", i, val);
+            goto error;
+        } /* end if */
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR;
+        dset_id = -1;
+    } /* end for */
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end oidx_check_dsets() */
+
+/*
+ * Tests object creation with H5daos_set_oidx_prealloc(), over more than one
+ * OIDX block and over several opens of the file, each of which discards the
+ * unused part of its last block
+ */
+static int
+test_oidx_prealloc(void)
+{
+    hid_t    fapl_id  = -1;
+    hid_t    file_id  = -1;
+    uint64_t num_oidx = 0;
+    int      i;
+
+    TESTING("OIDX preallocation and block growth");
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5daos_set_oidx_prealloc(fapl_id, OIDX_PREALLOC) < 0)
+        TEST_ERROR;
+    if (H5daos_get_oidx_prealloc(fapl_id, &num_oidx) < 0 || num_oidx != OIDX_PREALLOC) {
+        H5_FAILED();
+        AT();
+        printf("OIDX preallocation setting not retrieved\n");
+        goto error;
+    } /* end if */
+
+    for (i = 0; i < OIDX_NOPENS; i++) {
+        if (i == 0) {
+            if ((file_id = H5Fcreate(OIDX_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+                TEST_ERROR;
+        } /* end if */
+        else if ((file_id = H5Fopen(OIDX_FILENAME, H5F_ACC_RDWR, fapl_id)) < 0)
+            TEST_ERROR;
+
+        if (oidx_create_dsets(file_id, i * OIDX_NOBJS, OIDX_NOBJS))
+            goto error;
+        if (oidx_check_dsets(file_id, (i + 1) * OIDX_NOBJS))
+            goto error;
+
+        if (H5Fclose(file_id) < 0)
+            TEST_ERROR;
+        file_id = -1;
+    } /* end for */
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    fflush(stdout);
+
+    return 1;
+} /* end test_oidx_prealloc() */
+
+/*
+ * Tests opening objects collectively in a file opened with
+ * H5daos_set_node_local_bcast(), so that rank 0 broadcasts their
+ * metadata.  Node-local broadcasts are only used when the test is run
+ * with more than one process.
+ */
+static int
+test_node_local_bcast(void)
+{
+    hid_t   fapl_id    = -1;
+    hid_t   file_id    = -1;
+    hid_t   space_id   = -1;
+    hid_t   type_id    = -1;
+    hid_t   dset_id    = -1;
+    hbool_t node_local = FALSE;
+    hsize_t dims;
+    char    name[BCAST_NAME_SIZE];
+    int     i;
+
+    TESTING("node-local broadcasts");
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0)
+        TEST_ERROR;
+    if (H5Pset_all_coll_metadata_ops(fapl_id, TRUE) < 0)
+        TEST_ERROR;
+    if (H5daos_set_node_local_bcast(fapl_id, TRUE) < 0)
+        TEST_ERROR;
+    if (H5daos_get_node_local_bcast(fapl_id, &node_local) < 0 || !node_local) {
+        H5_FAILED();
+        AT();
+        printf("node-local broadcast setting not retrieved\n");
+        goto error;
+    } /* end if */
+
+    /* Datasets with a different extent each, and one with a datatype too
+     * large for a shared memory slot */
+    if ((file_id = H5Fcreate(BCAST_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < BCAST_NDSETS; i++) {
+        dims = (hsize_t)i + 1;
+        snprintf(name, sizeof(name), "dset%d", i);
+        if ((space_id = H5Screate_simple(1, &dims, NULL)) < 0)
+            TEST_ERROR;
+        if ((dset_id = H5Dcreate2(file_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                                  H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR;
+        dset_id = -1;
+        if (H5Sclose(space_id) < 0)
+            TEST_ERROR;
+        space_id = -1;
+    } /* end for */
+    if ((type_id = H5Tcreate(H5T_COMPOUND, BCAST_LARGE_NMEMBERS)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < BCAST_LARGE_NMEMBERS; i++) {
+        snprintf(name, sizeof(name), "member_with_a_long_name_to_grow_the_encoding_%d", i);
+        if (H5Tinsert(type_id, name, (size_t)i, H5T_NATIVE_CHAR) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, BCAST_LARGE_NAME, type_id, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    space_id = -1;
+    if (H5Tclose(type_id) < 0)
+        TEST_ERROR;
+    type_id = -1;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    /* Reopen everything, twice, so each rank must get every object's
+     * metadata from the right broadcast */
+    if ((file_id = H5Fopen(BCAST_FILENAME, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < 2 * BCAST_NDSETS; i++) {
+        snprintf(name, sizeof(name), "dset%d", i % BCAST_NDSETS);
+        if ((dset_id = H5Dopen2(file_id, name, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if ((space_id = H5Dget_space(dset_id)) < 0)
+            TEST_ERROR;
+        if (H5Sget_simple_extent_dims(space_id, &dims, NULL) != 1 ||
+            dims != (hsize_t)(i % BCAST_NDSETS) + 1) {
+            H5_FAILED();
+            AT();
+            printf("wrong extent for dataset %s\n", name);
+            goto error;
+        } /* end if */
+        if (H5Sclose(space_id) < 0)
+            TEST_ERROR;
+        space_id = -1;
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR;
+        dset_id = -1;
+    } /* end for */
+    if ((dset_id = H5Dopen2(file_id, BCAST_LARGE_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((type_id = H5Dget_type(dset_id)) < 0)
+        TEST_ERROR;
+    if (H5Tget_nmembers(type_id) != BCAST_LARGE_NMEMBERS) {
+        H5_FAILED();
+        AT();
+        printf("wrong datatype for dataset %s\n", BCAST_LARGE_NAME);
+        goto error;
+    } /* end if */
+    if (H5Tclose(type_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Tclose(type_id);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    fflush(stdout);
+
+    return 1;
+} /* end test_node_local_bcast() */
+
+/*
+ * Tests collective operations with H5daos_set_coll_err_batch(): operations
+ * issued together succeed, a failed operation is still reported as failed,
+ * and operations issued after it are unaffected
+ */
+static int
+test_coll_err_batch(void)
+{
+    hid_t    fapl_id    = -1;
+    hid_t    file_id    = -1;
+    hid_t    es_id      = -1;
+    hid_t    fail_es_id = -1;
+    hid_t    group_id   = -1;
+    hid_t    group_ids[COLL_ERR_NGROUPS];
+    unsigned batch_size = 0;
+    char     name[COLL_ERR_NAME_SIZE];
+    size_t   num_in_progress;
+    hbool_t  op_failed;
+    int      i;
+
+    TESTING("batched collective error checks");
+
+    for (i = 0; i < COLL_ERR_NGROUPS; i++)
+        group_ids[i] = -1;
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0)
+        TEST_ERROR;
+    if (H5Pset_all_coll_metadata_ops(fapl_id, TRUE) < 0)
+        TEST_ERROR;
+    if (H5daos_set_coll_err_batch(fapl_id, COLL_ERR_BATCH) < 0)
+        TEST_ERROR;
+    if (H5daos_get_coll_err_batch(fapl_id, &batch_size) < 0 || batch_size != COLL_ERR_BATCH) {
+        H5_FAILED();
+        AT();
+        printf("collective error check batch size not retrieved\n");
+        goto error;
+    } /* end if */
+
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    if ((file_id = H5Fcreate(COLL_ERR_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Create groups without waiting, then wait on all of them at once */
+    for (i = 0; i < COLL_ERR_NGROUPS; i++) {
+        snprintf(name, sizeof(name), "g%d", i);
+        if ((group_ids[i] = H5Gcreate_async(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT, es_id)) <
+            0) {
+            H5_FAILED();
+            AT();
+            printf("failed to create group %s\n", name);
+            goto error;
+        } /* end if */
+    }     /* end for */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous group creations failed\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < COLL_ERR_NGROUPS; i++) {
+        if (H5Gclose(group_ids[i]) < 0)
+            TEST_ERROR;
+        group_ids[i] = -1;
+    } /* end for */
+
+    /* A failed open must be reported, either right away or by the wait.  It
+     * gets its own event set, which is left holding the failure. */
+    if ((fail_es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    op_failed = FALSE;
+    H5E_BEGIN_TRY
+    {
+        if ((group_id = H5Gopen_async(file_id, COLL_ERR_MISSING, H5P_DEFAULT, fail_es_id)) < 0)
+            op_failed = TRUE;
+        else if (H5ESwait(fail_es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0)
+            op_failed = TRUE;
+    }
+    H5E_END_TRY;
+    if (!op_failed) {
+        H5_FAILED();
+        AT();
+        printf("opening a missing group was not reported as failed\n");
+        goto error;
+    } /* end if */
+    if (group_id >= 0) {
+        H5E_BEGIN_TRY
+        {
+            H5Gclose(group_id);
+        }
+        H5E_END_TRY;
+        group_id = -1;
+    } /* end if */
+    H5E_BEGIN_TRY
+    {
+        H5ESclose(fail_es_id);
+    }
+    H5E_END_TRY;
+    fail_es_id = -1;
+
+    /* Operations after the failure still succeed */
+    for (i = 0; i < COLL_ERR_NGROUPS; i++) {
+        snprintf(name, sizeof(name), "g%d", i);
+        if ((group_ids[i] = H5Gopen_async(file_id, name, H5P_DEFAULT, es_id)) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous group opens failed after an earlier failure\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < COLL_ERR_NGROUPS; i++) {
+        if (H5Gclose(group_ids[i]) < 0)
+            TEST_ERROR;
+        group_ids[i] = -1;
+    } /* end for */
+
+    if (H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed);
+        for (i = 0; i < COLL_ERR_NGROUPS; i++)
+            H5Gclose(group_ids[i]);
+        H5Gclose(group_id);
+        H5Fclose(file_id);
+        H5ESclose(fail_es_id);
+        H5ESclose(es_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    fflush(stdout);
+
+    return 1;
+} /* end test_coll_err_batch() */
+
+/*
+ * Tests collective operations issued without waiting on a file opened with
+ * H5daos_set_coll_lanes(), so that they run in several collective lanes at
+ * once.  Node-local broadcasts and batched collective error checks are
+ * enabled too, since their state is kept per lane.  If coalesce is set, the
+ * broadcasts of all lanes are packed together with
+ * H5daos_set_bcast_coalesce().
+ */
+static int
+test_coll_lanes(hbool_t coalesce)
+{
+    hid_t    fapl_id  = -1;
+    hid_t    file_id  = -1;
+    hid_t    es_id    = -1;
+    hid_t    space_id = -1;
+    hid_t    dset_ids[LANES_NDSETS];
+    unsigned nlanes = 0;
+    hbool_t  coalesce_out;
+    hsize_t  dims;
+    char     name[LANES_NAME_SIZE];
+    size_t   num_in_progress;
+    hbool_t  op_failed;
+    herr_t   status;
+    int      i;
+
+    if (coalesce)
+        TESTING("collective lanes with coalesced broadcasts");
+    else
+        TESTING("collective lanes");
+
+    for (i = 0; i < LANES_NDSETS; i++)
+        dset_ids[i] = -1;
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5daos_get_coll_lanes(fapl_id, &nlanes) < 0 || nlanes != H5_DAOS_COLL_LANES_DEFAULT) {
+        H5_FAILED();
+        AT();
+        printf("default number of collective lanes not retrieved\n");
+        goto error;
+    } /* end if */
+    H5E_BEGIN_TRY
+    {
+        status = H5daos_set_coll_lanes(fapl_id, 0);
+    }
+    H5E_END_TRY;
+    if (status >= 0) {
+        H5_FAILED();
+        AT();
+        printf("zero collective lanes accepted\n");
+        goto error;
+    } /* end if */
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0)
+        TEST_ERROR;
+    if (H5Pset_all_coll_metadata_ops(fapl_id, TRUE) < 0)
+        TEST_ERROR;
+    if (H5daos_set_node_local_bcast(fapl_id, TRUE) < 0)
+        TEST_ERROR;
+    if (H5daos_set_coll_err_batch(fapl_id, COLL_ERR_BATCH) < 0)
+        TEST_ERROR;
+    if (H5daos_set_coll_lanes(fapl_id, LANES_NLANES) < 0)
+        TEST_ERROR;
+    if (H5daos_get_coll_lanes(fapl_id, &nlanes) < 0 || nlanes != LANES_NLANES) {
+        H5_FAILED();
+        AT();
+        printf("number of collective lanes not retrieved\n");
+        goto error;
+    } /* end if */
+    if (H5daos_get_bcast_coalesce(fapl_id, &coalesce_out) < 0 || coalesce_out) {
+        H5_FAILED();
+        AT();
+        printf("default broadcast coalescing setting not retrieved\n");
+        goto error;
+    } /* end if */
+    if (coalesce) {
+        if (H5daos_set_bcast_coalesce(fapl_id, TRUE) < 0)
+            TEST_ERROR;
+        if (H5daos_get_bcast_coalesce(fapl_id, &coalesce_out) < 0 || !coalesce_out) {
+            H5_FAILED();
+            AT();
+            printf("broadcast coalescing setting not retrieved\n");
+            goto error;
+        } /* end if */
+    } /* end if */
+
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    if ((file_id = H5Fcreate(LANES_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Create datasets with a different extent each without waiting */
+    for (i = 0; i < LANES_NDSETS; i++) {
+        dims = (hsize_t)i + 1;
+        snprintf(name, sizeof(name), "dset%d", i);
+        if ((space_id = H5Screate_simple(1, &dims, NULL)) < 0)
+            TEST_ERROR;
+        if ((dset_ids[i] = H5Dcreate_async(file_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                                           H5P_DEFAULT, H5P_DEFAULT, es_id)) < 0)
+            TEST_ERROR;
+        if (H5Sclose(space_id) < 0)
+            TEST_ERROR;
+        space_id = -1;
+    } /* end for */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous dataset creations failed\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < LANES_NDSETS; i++) {
+        if (H5Dclose(dset_ids[i]) < 0)
+            TEST_ERROR;
+        dset_ids[i] = -1;
+    } /* end for */
+
+    /* Open them again without waiting, so each rank must get every
+     * dataset's metadata from the broadcast in the right lane */
+    for (i = 0; i < LANES_NDSETS; i++) {
+        snprintf(name, sizeof(name), "dset%d", i);
+        if ((dset_ids[i] = H5Dopen_async(file_id, name, H5P_DEFAULT, es_id)) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if (H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed) < 0 || op_failed || num_in_progress) {
+        H5_FAILED();
+        AT();
+        printf("asynchronous dataset opens failed\n");
+        goto error;
+    } /* end if */
+    for (i = 0; i < LANES_NDSETS; i++) {
+        if ((space_id = H5Dget_space(dset_ids[i])) < 0)
+            TEST_ERROR;
+        if (H5Sget_simple_extent_dims(space_id, &dims, NULL) != 1 || dims != (hsize_t)i + 1) {
+            H5_FAILED();
+            AT();
+            printf("wrong extent for dataset dset%d\n", i);
+            goto error;
+        } /* end if */
+        if (H5Sclose(space_id) < 0)
+            TEST_ERROR;
+        space_id = -1;
+        if (H5Dclose(dset_ids[i]) < 0)
+            TEST_ERROR;
+        dset_ids[i] = -1;
+    } /* end for */
+
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed);
+        for (i = 0; i < LANES_NDSETS; i++)
+            H5Dclose(dset_ids[i]);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+        H5ESclose(es_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    fflush(stdout);
+
+    return 1;
+} /* end test_coll_lanes() */
+
+/*
+ * Tests blocking and non-blocking waits on a file opened with the adaptive
+ * wait mode set with H5daos_set_wait_mode()
+ */
+static int
+test_wait_mode(void)
+{
+    hid_t               fapl_id   = -1;
+    hid_t               file_id   = -1;
+    hid_t               space_id  = -1;
+    hid_t               dset_id   = -1;
+    hid_t               es_id     = -1;
+    hsize_t             dims      = WAIT_NELMTS;
+    H5_daos_wait_mode_t wait_mode = H5_DAOS_WAIT_POLL;
+    int                *wbuf      = NULL;
+    int                *rbuf      = NULL;
+    size_t              num_in_progress;
+    hbool_t             op_failed;
+    herr_t              ret;
+    int                 i;
+
+    TESTING("adaptive wait mode");
+
+    if (NULL == (wbuf = malloc(WAIT_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = calloc(WAIT_NELMTS, sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < WAIT_NELMTS; i++)
+        wbuf[i] = WAIT_NELMTS - i;
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+
+    /* Values that are not a wait mode are rejected */
+    H5E_BEGIN_TRY
+    {
+        ret = H5daos_set_wait_mode(fapl_id, (H5_daos_wait_mode_t)(H5_DAOS_WAIT_ADAPTIVE + 1));
+    }
+    H5E_END_TRY;
+    if (ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("invalid wait mode accepted\n");
+        goto error;
+    } /* end if */
+
+    if (H5daos_set_wait_mode(fapl_id, H5_DAOS_WAIT_ADAPTIVE) < 0)
+        TEST_ERROR;
+    if (H5daos_get_wait_mode(fapl_id, &wait_mode) < 0 || wait_mode != H5_DAOS_WAIT_ADAPTIVE) {
+        H5_FAILED();
+        AT();
+        printf("wait mode not retrieved\n");
+        goto error;
+    } /* end if */
+
+    if ((es_id = H5EScreate()) < 0)
+        TEST_ERROR;
+    if ((file_id = H5Fcreate(WAIT_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+    if ((space_id = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, WAIT_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Blocking waits inside the connector */
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        H5_FAILED();
+        AT();
+        printf("failed to write dataset\n");
+        goto error;
+    } /* end if */
+
+    /* Non-blocking waits from the application */
+    if (H5Dread_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf, es_id) < 0)
+        TEST_ERROR;
+    do {
+        if (H5ESwait(es_id, 0, &num_in_progress, &op_failed) < 0 || op_failed) {
+            H5_FAILED();
+            AT();
+            printf("asynchronous read failed\n");
+            goto error;
+        } /* end if */
+    } while (num_in_progress);
+    for (i = 0; i < WAIT_NELMTS; i++)
+        if (rbuf[i] != wbuf[i]) {
+            H5_FAILED();
+            AT();
+            printf("incorrect value read at index %d\n", i);
+            goto error;
+        } /* end if */
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    free(wbuf);
+    free(rbuf);
+
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5ESwait(es_id, UINT64_MAX, &num_in_progress, &op_failed);
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+        H5ESclose(es_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    free(wbuf);
+    free(rbuf);
+    fflush(stdout);
+
+    return 1;
+} /* end test_wait_mode() */
+
+/*
+ * Tests the statistics returned by H5daos_get_alloc_stats() over chunked
+ * I/O, which allocates per-chunk user data from a free list.  Every block
+ * taken during a blocking operation is given back by the time it returns,
+ * and the second operation reuses blocks freed by the first.
+ */
+static int
+test_alloc_stats(hid_t file_id)
+{
+    hid_t                 dset_id  = -1;
+    hid_t                 space_id = -1;
+    hid_t                 dcpl_id  = -1;
+    hsize_t               dims     = STATS_NCHUNKS * STATS_CHUNK;
+    hsize_t               chunk    = STATS_CHUNK;
+    H5_daos_alloc_stats_t before, after_write, after_read;
+    int                   buf[STATS_NCHUNKS * STATS_CHUNK];
+    herr_t                ret;
+    int                   i;
+
+    TESTING("allocation statistics");
+
+    for (i = 0; i < STATS_NCHUNKS * STATS_CHUNK; i++)
+        buf[i] = i;
+
+    H5E_BEGIN_TRY
+    {
+        ret = H5daos_get_alloc_stats(NULL);
+    }
+    H5E_END_TRY;
+    if (ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("NULL statistics buffer accepted\n");
+        goto error;
+    } /* end if */
+
+    if ((space_id = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, &chunk) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, STATS_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    if (H5daos_get_alloc_stats(&before) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR;
+    if (H5daos_get_alloc_stats(&after_write) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR;
+    if (H5daos_get_alloc_stats(&after_read) < 0)
+        TEST_ERROR;
+
+    if (after_write.nallocs - before.nallocs < STATS_NCHUNKS ||
+        after_read.nallocs - after_write.nallocs < STATS_NCHUNKS) {
+        H5_FAILED();
+        AT();
+        printf("fewer allocations than chunks accessed\n");
+        goto error;
+    } /* end if */
+    if (after_write.nallocs - before.nallocs != after_write.nfrees - before.nfrees ||
+        after_read.nallocs - after_write.nallocs != after_read.nfrees - after_write.nfrees) {
+        H5_FAILED();
+        AT();
+        printf("blocks still allocated after a blocking operation\n");
+        goto error;
+    } /* end if */
+    if (after_read.nreused == after_write.nreused) {
+        H5_FAILED();
+        AT();
+        printf("no blocks reused from the free lists\n");
+        goto error;
+    } /* end if */
+    if (after_read.nreused > after_read.nallocs || after_read.ncached == 0 ||
+        after_read.cached_bytes < after_read.ncached) {
+        H5_FAILED();
+        AT();
+        printf("inconsistent statistics\n");
+        goto error;
+    } /* end if */
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+    fflush(stdout);
+
+    return 1;
+} /* end test_alloc_stats() */
+
+/*
+ * main function
+ */
+int
+main(int argc, char **argv)
+{
+    hid_t fapl_id = -1, file_id = -1;
+    int   nerrors = 0;
+
+    /* These are read when the connector is initialized, so they must be set
+     * before the first HDF5 call */
+    if (setenv("HDF5_DAOS_SMALL_IO_BUDGET", SMALL_BUDGET, 1) < 0 ||
+        setenv("HDF5_DAOS_BULK_IO_BUDGET", BULK_BUDGET, 1) < 0) {
+        printf("failed to set environment\n");
+        return 1;
+    } /* end if */
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if ((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    nerrors += test_budget(file_id);
+    nerrors += test_unordered_visit();
+    nerrors += test_oidx_prealloc();
+    nerrors += test_node_local_bcast();
+    nerrors += test_coll_err_batch();
+    nerrors += test_coll_lanes(FALSE);
+    nerrors += test_coll_lanes(TRUE);
+    nerrors += test_wait_mode();
+    nerrors += test_alloc_stats(file_id);
+
+    if (H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors)
+        goto error;
+
+    if (MAINPROCESS)
+        puts("All DAOS tuning tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    if (MAINPROCESS)
+        printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */